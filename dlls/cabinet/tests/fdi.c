@@ -114,6 +114,50 @@ static const struct
     { 'H','e','l','l','o',' ','W','o','r','l','d','!' }
 };
 
+/* an MSZIP cabinet with two blocks of a repeated sentence, the second block
+ * only contains matches referring to the history of the first one */
+
+static const struct
+{
+    struct CFHEADER header;
+    struct CFFOLDER folder;
+    struct CFFILE file;
+    UCHAR szName[sizeof("file.dat")];
+    struct CFDATA data1;
+    UCHAR ab1[159];
+    struct CFDATA data2;
+    UCHAR ab2[30];
+} mszip_history_cab =
+{
+    { {'M','S','C','F'}, 0, 274, 0, sizeof(struct CFHEADER) + sizeof(struct CFFOLDER), 0, 3,1, 1, 1, 0, 0x1225, 0x2013 },
+    { sizeof(struct CFHEADER) + sizeof(struct CFFOLDER) + sizeof(struct CFFILE) + sizeof("file.dat"), 2, tcompTYPE_MSZIP },
+    { 0x9000, 0, 0, 0x1225, 0x2013, 0x20 },
+    { 'f','i','l','e','.','d','a','t',0 },
+    { 0, 159, 0x8000 },
+    {
+      'C', 'K', 0xed, 0xca, 0xdb, 0x15, 0x82, 0x30, 0x14, 0x00, 0xb0, 0x55,
+      0xee, 0x04, 0x4c, 0xd3, 0x05, 0x40, 0x8b, 0x6f, 0x0b, 0xd5, 0xaa, 0x30,
+      0xbd, 0xcc, 0xc1, 0xc9, 0x77, 0x92, 0xce, 0x39, 0xe6, 0x76, 0x39, 0xdc,
+      0x62, 0xa8, 0xe5, 0xfb, 0x8c, 0xb1, 0xfc, 0xe2, 0xda, 0x1e, 0xd3, 0x2b,
+      0xca, 0x27, 0xd7, 0x78, 0x6f, 0x7c, 0xef, 0xd7, 0x25, 0x8e, 0xe5, 0xd4,
+      0x45, 0x92, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65,
+      0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65,
+      0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65,
+      0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65,
+      0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65,
+      0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65,
+      0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65,
+      0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96, 0xe5,
+      0x7d, 0xe6, 0x3f
+    },
+    { 0, 30, 0x1000 },
+    {
+      'C', 'K', 0xed, 0xca, 0x31, 0x0d, 0x00, 0x00, 0x00, 0x80, 0xa0, 0xfe,
+      0xad, 0xed, 0xe1, 0xe0, 0x46, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x96,
+      0x65, 0x59, 0x96, 0xe5, 0x7f, 0x0e
+    }
+};
+
 #include <poppack.h>
 
 struct mem_data
@@ -935,6 +979,152 @@ static void test_FDICopy(void)
 }
 
 
+struct verify_data
+{
+    const char *expected;
+    DWORD size;
+    DWORD pos;
+    BOOL mismatch;
+};
+
+static UINT CDECL fdi_verify_write(INT_PTR hf, void *pv, UINT cb)
+{
+    struct verify_data *data = (struct verify_data *)hf;
+
+    if (cb > data->size - data->pos || memcmp(data->expected + data->pos, pv, cb))
+        data->mismatch = TRUE;
+    data->pos += cb;
+    return cb;
+}
+
+static struct verify_data verify_data;
+
+static INT_PTR CDECL fdi_verify_notify(FDINOTIFICATIONTYPE fdint, FDINOTIFICATION *info)
+{
+    switch (fdint)
+    {
+    case fdintCOPY_FILE:
+        ok(info->cb == verify_data.size, "expected %lu, got %ld\n", verify_data.size, info->cb);
+        return (INT_PTR)&verify_data;
+
+    case fdintCLOSE_FILE_INFO:
+        ok(info->hf == (INT_PTR)&verify_data, "got handle %#Ix\n", info->hf);
+        return TRUE;
+
+    default:
+        return 0;
+    }
+}
+
+static void test_FDICopy_mszip(void)
+{
+    static const char *words[] = {"cabinet ", "folder ", "block ", "deflate ", "window ", "\r\n", "0123 "};
+    DWORD i, size, written, seed = 0x1234, start, elapsed;
+    char name[] = "extract.cab", file[] = "big.dat";
+    char path[MAX_PATH + 1], *data;
+    CCAB cabParams;
+    HANDLE handle;
+    HFDI hfdi;
+    HFCI hfci;
+    ERF erf;
+    BOOL ret;
+
+    /* compressible data spanning many blocks and several folders */
+    size = winetest_interactive ? 64 * 1024 * 1024 : 4 * 1024 * 1024;
+    data = HeapAlloc(GetProcessHeap(), 0, size);
+    for (i = 0; i < size;)
+    {
+        const char *word;
+
+        seed = seed * 1103515245 + 12345;
+        word = words[(seed >> 16) % ARRAY_SIZE(words)];
+        while (*word && i < size) data[i++] = *word++;
+        if (!(seed >> 29) && i < size) data[i++] = 'a' + (seed >> 8) % 26;
+    }
+
+    handle = CreateFileA(file, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, NULL);
+    ok(handle != INVALID_HANDLE_VALUE, "failed to create %s\n", file);
+    WriteFile(handle, data, size, &written, NULL);
+    CloseHandle(handle);
+
+    set_cab_parameters(&cabParams);
+    hfci = FCICreate(&erf, file_placed, mem_alloc, mem_free, fci_open,
+                     fci_read, fci_write, fci_close, fci_seek,
+                     fci_delete, get_temp_file, &cabParams, NULL);
+    ok(hfci != NULL, "Failed to create an FCI context\n");
+    add_file(hfci, file);
+    ret = FCIFlushCabinet(hfci, FALSE, get_next_cabinet, progress);
+    ok(ret, "Failed to flush the cabinet\n");
+    FCIDestroy(hfci);
+
+    lstrcpyA(path, CURR_DIR);
+    lstrcatA(path, "\\");
+
+    hfdi = FDICreate(fdi_alloc, fdi_free, fdi_open, fdi_read,
+                     fdi_verify_write, fdi_close, fdi_seek, cpuUNKNOWN, &erf);
+    ok(hfdi != NULL, "FDICreate error %d\n", erf.erfOper);
+
+    verify_data.expected = data;
+    verify_data.size = size;
+    verify_data.pos = 0;
+    verify_data.mismatch = FALSE;
+
+    start = GetTickCount();
+    ret = FDICopy(hfdi, name, path, 0, fdi_verify_notify, NULL, 0);
+    elapsed = GetTickCount() - start;
+    ok(ret, "FDICopy error %d\n", erf.erfOper);
+    ok(verify_data.pos == size, "expected %lu bytes, got %lu\n", size, verify_data.pos);
+    ok(!verify_data.mismatch, "extracted data doesn't match\n");
+    trace("decompressed %lu MB in %lu ms\n", size >> 20, elapsed);
+
+    FDIDestroy(hfdi);
+
+    DeleteFileA(file);
+    DeleteFileA(name);
+    HeapFree(GetProcessHeap(), 0, data);
+}
+
+static void test_FDICopy_mszip_history(void)
+{
+    static const char text[] = "The quick brown fox jumps over the lazy dog. ";
+    char name[] = "history.cab", path[MAX_PATH + 1], *data;
+    DWORD i, size = mszip_history_cab.file.cbFile, written;
+    HANDLE handle;
+    HFDI hfdi;
+    ERF erf;
+    BOOL ret;
+
+    data = HeapAlloc(GetProcessHeap(), 0, size);
+    for (i = 0; i < size; i++) data[i] = text[i % (sizeof(text) - 1)];
+
+    handle = CreateFileA(name, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, NULL);
+    ok(handle != INVALID_HANDLE_VALUE, "failed to create %s\n", name);
+    WriteFile(handle, &mszip_history_cab, sizeof(mszip_history_cab), &written, NULL);
+    CloseHandle(handle);
+
+    lstrcpyA(path, CURR_DIR);
+    lstrcatA(path, "\\");
+
+    hfdi = FDICreate(fdi_alloc, fdi_free, fdi_open, fdi_read,
+                     fdi_verify_write, fdi_close, fdi_seek, cpuUNKNOWN, &erf);
+    ok(hfdi != NULL, "FDICreate error %d\n", erf.erfOper);
+
+    verify_data.expected = data;
+    verify_data.size = size;
+    verify_data.pos = 0;
+    verify_data.mismatch = FALSE;
+
+    ret = FDICopy(hfdi, name, path, 0, fdi_verify_notify, NULL, 0);
+    ok(ret, "FDICopy error %d\n", erf.erfOper);
+    ok(verify_data.pos == size, "expected %lu bytes, got %lu\n", size, verify_data.pos);
+    ok(!verify_data.mismatch, "extracted data doesn't match\n");
+
+    FDIDestroy(hfdi);
+
+    DeleteFileA(name);
+    HeapFree(GetProcessHeap(), 0, data);
+}
+
 START_TEST(fdi)
 {
     int len;
@@ -947,4 +1137,6 @@ START_TEST(fdi)
     test_FDIDestroy();
     test_FDIIsCabinet();
     test_FDICopy();
+    test_FDICopy_mszip();
+    test_FDICopy_mszip_history();
 }
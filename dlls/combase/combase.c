@@ -426,6 +426,7 @@ static void com_cleanup_tlsdata(void)
     if (tlsdata->context_token)
         IObjContext_Release(tlsdata->context_token);
 
+    free(tlsdata->message_state_cache);
     free(tlsdata);
     NtCurrentTeb()->ReservedForOle = NULL;
 }
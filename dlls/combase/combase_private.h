@@ -93,6 +93,7 @@ struct tlsdata
     DWORD             spies_lock;
     DWORD             cancelcount;
     CO_MTA_USAGE_COOKIE implicit_mta_cookie; /* mta referenced by roapi from sta thread */
+    struct message_state *message_state_cache; /* call state kept for reuse by the next call */
 };
 
 extern HRESULT WINAPI InternalTlsAllocData(struct tlsdata **data);
@@ -123,8 +123,34 @@ struct message_state
     HWND target_hwnd;
     DWORD target_tid;
     struct dispatch_params params;
+    RPC_CLIENT_INTERFACE cif;
 };
 
+/* a call state is needed for each call, keep the last freed one around for the next call on the thread */
+static struct message_state *alloc_message_state(void)
+{
+    struct message_state *message_state = NULL;
+    struct tlsdata *tlsdata;
+
+    if (SUCCEEDED(com_get_tlsdata(&tlsdata)) && tlsdata->message_state_cache)
+    {
+        message_state = tlsdata->message_state_cache;
+        tlsdata->message_state_cache = NULL;
+        return message_state;
+    }
+    return malloc(sizeof(*message_state));
+}
+
+static void free_message_state(struct message_state *message_state)
+{
+    struct tlsdata *tlsdata;
+
+    if (message_state && SUCCEEDED(com_get_tlsdata(&tlsdata)) && !tlsdata->message_state_cache)
+        tlsdata->message_state_cache = message_state;
+    else
+        free(message_state);
+}
+
 typedef struct
 {
     ULONG conformance; /* NDR */
@@ -1175,17 +1201,12 @@ static HRESULT WINAPI ClientRpcChannelBuffer_GetBuffer(LPRPCCHANNELBUFFER iface,
 
     TRACE("(%p)->(%p,%s)\n", This, olemsg, debugstr_guid(riid));
 
-    cif = calloc(1, sizeof(RPC_CLIENT_INTERFACE));
-    if (!cif)
-        return E_OUTOFMEMORY;
-
-    message_state = malloc(sizeof(*message_state));
+    message_state = alloc_message_state();
     if (!message_state)
-    {
-        free(cif);
         return E_OUTOFMEMORY;
-    }
 
+    cif = &message_state->cif;
+    memset(cif, 0, sizeof(*cif));
     cif->Length = sizeof(RPC_CLIENT_INTERFACE);
     /* RPC interface ID = COM interface ID */
     cif->InterfaceId.SyntaxGUID = This->iid;
@@ -1566,14 +1587,13 @@ static HRESULT WINAPI ClientRpcChannelBuffer_FreeBuffer(LPRPCCHANNELBUFFER iface
     else
         status = I_RpcFreeBuffer(msg);
 
-    free(msg->RpcInterfaceInformation);
     msg->RpcInterfaceInformation = NULL;
 
     if (message_state->params.stub)
         IRpcStubBuffer_Release(message_state->params.stub);
     if (message_state->params.chan)
         IRpcChannelBuffer_Release(message_state->params.chan);
-    free(message_state);
+    free_message_state(message_state);
 
     TRACE("-- %ld\n", status);
 
@@ -1893,7 +1913,7 @@ void rpc_execute_call(struct dispatch_params *params)
         goto exit;
     }
 
-    message_state = malloc(sizeof(*message_state));
+    message_state = alloc_message_state();
     if (!message_state)
     {
         params->hr = E_OUTOFMEMORY;
@@ -1986,7 +2006,7 @@ exit_reset_state:
     msg->BufferLength += message_state->prefix_data_len;
 
 exit:
-    free(message_state);
+    free_message_state(message_state);
     if (params->handle) SetEvent(params->handle);
 }
 
@@ -215,14 +215,9 @@ static ID3D12RootSignature *create_default_root_signature(ID3D12Device *device)
     return root_signature;
 }
 
-#define create_pipeline_state(a, b, c, d) create_pipeline_state_(__LINE__, a, b, c, d)
-static ID3D12PipelineState *create_pipeline_state_(unsigned int line, ID3D12Device *device,
+static void init_pipeline_state_desc(D3D12_GRAPHICS_PIPELINE_STATE_DESC *pipeline_state_desc,
         ID3D12RootSignature *root_signature, DXGI_FORMAT rt_format, const D3D12_SHADER_BYTECODE *ps)
 {
-    D3D12_GRAPHICS_PIPELINE_STATE_DESC pipeline_state_desc;
-    ID3D12PipelineState *pipeline_state;
-    HRESULT hr;
-
     static const DWORD vs_code[] =
     {
 #if 0
@@ -268,18 +263,29 @@ static ID3D12PipelineState *create_pipeline_state_(unsigned int line, ID3D12Devi
     if (!ps)
         ps = &default_ps;
 
-    memset(&pipeline_state_desc, 0, sizeof(pipeline_state_desc));
-    pipeline_state_desc.pRootSignature = root_signature;
-    pipeline_state_desc.VS = vs;
-    pipeline_state_desc.PS = *ps;
-    pipeline_state_desc.BlendState.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
-    pipeline_state_desc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
-    pipeline_state_desc.RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
-    pipeline_state_desc.SampleMask = ~(UINT)0;
-    pipeline_state_desc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-    pipeline_state_desc.NumRenderTargets = 1;
-    pipeline_state_desc.RTVFormats[0] = rt_format;
-    pipeline_state_desc.SampleDesc.Count = 1;
+    memset(pipeline_state_desc, 0, sizeof(*pipeline_state_desc));
+    pipeline_state_desc->pRootSignature = root_signature;
+    pipeline_state_desc->VS = vs;
+    pipeline_state_desc->PS = *ps;
+    pipeline_state_desc->BlendState.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+    pipeline_state_desc->RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
+    pipeline_state_desc->RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
+    pipeline_state_desc->SampleMask = ~(UINT)0;
+    pipeline_state_desc->PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+    pipeline_state_desc->NumRenderTargets = 1;
+    pipeline_state_desc->RTVFormats[0] = rt_format;
+    pipeline_state_desc->SampleDesc.Count = 1;
+}
+
+#define create_pipeline_state(a, b, c, d) create_pipeline_state_(__LINE__, a, b, c, d)
+static ID3D12PipelineState *create_pipeline_state_(unsigned int line, ID3D12Device *device,
+        ID3D12RootSignature *root_signature, DXGI_FORMAT rt_format, const D3D12_SHADER_BYTECODE *ps)
+{
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC pipeline_state_desc;
+    ID3D12PipelineState *pipeline_state;
+    HRESULT hr;
+
+    init_pipeline_state_desc(&pipeline_state_desc, root_signature, rt_format, ps);
     hr = ID3D12Device_CreateGraphicsPipelineState(device, &pipeline_state_desc,
             &IID_ID3D12PipelineState, (void **)&pipeline_state);
     ok_(__FILE__, line)(hr == S_OK, "Failed to create graphics pipeline state, hr %#lx.\n", hr);
@@ -1497,6 +1503,202 @@ static void test_invalid_command_queue_types(void)
     ok(!refcount, "Device has %lu references left.\n", refcount);
 }
 
+static void test_pipeline_library(void)
+{
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC pipeline_state_desc;
+    ID3D12PipelineState *pipeline_state, *loaded_state;
+    ID3D12RootSignature *root_signature;
+    ID3D12PipelineLibrary *library;
+    SIZE_T size, empty_size;
+    ID3D12Device1 *device1;
+    ID3D12Device *device;
+    ULONG refcount;
+    DWORD *blob;
+    HRESULT hr;
+
+    if (!(device = create_device()))
+    {
+        skip("Failed to create Direct3D 12 device.\n");
+        return;
+    }
+
+    if (FAILED(ID3D12Device_QueryInterface(device, &IID_ID3D12Device1, (void **)&device1)))
+    {
+        skip("ID3D12Device1 is not available.\n");
+        ID3D12Device_Release(device);
+        return;
+    }
+
+    /* The pipeline state is created before any pipeline library exists. */
+    root_signature = create_default_root_signature(device);
+    init_pipeline_state_desc(&pipeline_state_desc, root_signature, DXGI_FORMAT_R8G8B8A8_UNORM, NULL);
+    hr = ID3D12Device_CreateGraphicsPipelineState(device, &pipeline_state_desc,
+            &IID_ID3D12PipelineState, (void **)&pipeline_state);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+
+    hr = ID3D12Device1_CreatePipelineLibrary(device1, NULL, 0, &IID_ID3D12PipelineLibrary, (void **)&library);
+    if (hr == DXGI_ERROR_UNSUPPORTED)
+    {
+        skip("Pipeline libraries are not supported.\n");
+        ID3D12PipelineState_Release(pipeline_state);
+        ID3D12RootSignature_Release(root_signature);
+        ID3D12Device1_Release(device1);
+        ID3D12Device_Release(device);
+        return;
+    }
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    empty_size = ID3D12PipelineLibrary_GetSerializedSize(library);
+    ok(empty_size, "Got zero size.\n");
+
+    hr = ID3D12PipelineLibrary_StorePipeline(library, L"pipeline", pipeline_state);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    hr = ID3D12PipelineLibrary_StorePipeline(library, L"pipeline", pipeline_state);
+    ok(hr == E_INVALIDARG, "Got unexpected hr %#lx.\n", hr);
+
+    size = ID3D12PipelineLibrary_GetSerializedSize(library);
+    ok(size > empty_size, "Got size %Iu, empty size %Iu.\n", size, empty_size);
+    blob = calloc(1, size);
+    hr = ID3D12PipelineLibrary_Serialize(library, blob, 1);
+    ok(hr == E_INVALIDARG, "Got unexpected hr %#lx.\n", hr);
+    hr = ID3D12PipelineLibrary_Serialize(library, blob, size);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    refcount = ID3D12PipelineLibrary_Release(library);
+    ok(!refcount, "Pipeline library has %lu references left.\n", refcount);
+
+    hr = ID3D12Device1_CreatePipelineLibrary(device1, blob, size, &IID_ID3D12PipelineLibrary, (void **)&library);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+
+    hr = ID3D12PipelineLibrary_LoadGraphicsPipeline(library, L"pipeline", &pipeline_state_desc,
+            &IID_ID3D12PipelineState, (void **)&loaded_state);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    ID3D12PipelineState_Release(loaded_state);
+
+    hr = ID3D12PipelineLibrary_LoadGraphicsPipeline(library, L"missing", &pipeline_state_desc,
+            &IID_ID3D12PipelineState, (void **)&loaded_state);
+    ok(hr == E_INVALIDARG, "Got unexpected hr %#lx.\n", hr);
+
+    pipeline_state_desc.VS = pipeline_state_desc.PS;
+    hr = ID3D12PipelineLibrary_LoadGraphicsPipeline(library, L"pipeline", &pipeline_state_desc,
+            &IID_ID3D12PipelineState, (void **)&loaded_state);
+    ok(hr == E_INVALIDARG, "Got unexpected hr %#lx.\n", hr);
+
+    refcount = ID3D12PipelineLibrary_Release(library);
+    ok(!refcount, "Pipeline library has %lu references left.\n", refcount);
+
+    blob[0] = 0xdeadbeef;
+    hr = ID3D12Device1_CreatePipelineLibrary(device1, blob, size, &IID_ID3D12PipelineLibrary, (void **)&library);
+    ok(hr == E_INVALIDARG || hr == D3D12_ERROR_DRIVER_VERSION_MISMATCH, "Got unexpected hr %#lx.\n", hr);
+    free(blob);
+
+    ID3D12PipelineState_Release(pipeline_state);
+    ID3D12RootSignature_Release(root_signature);
+    ID3D12Device1_Release(device1);
+    refcount = ID3D12Device_Release(device);
+    ok(!refcount, "Device has %lu references left.\n", refcount);
+}
+
+static void test_multi_stage_pipeline_states(void)
+{
+    static const DWORD gs_code[] =
+    {
+#if 0
+        struct vertex
+        {
+            float4 position : SV_POSITION;
+        };
+
+        [maxvertexcount(3)]
+        void main(triangle vertex input[3], inout TriangleStream<vertex> output)
+        {
+            for (uint i = 0; i < 3; ++i)
+                output.Append(input[i]);
+        }
+#endif
+        0x43425844, 0x8e49d18d, 0x6d08d6e5, 0xb7015628, 0xf9351fdd, 0x00000001, 0x00000164, 0x00000003,
+        0x0000002c, 0x00000060, 0x00000094, 0x4e475349, 0x0000002c, 0x00000001, 0x00000008, 0x00000020,
+        0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000f0f, 0x505f5653, 0x5449534f, 0x004e4f49,
+        0x4e47534f, 0x0000002c, 0x00000001, 0x00000008, 0x00000020, 0x00000000, 0x00000001, 0x00000003,
+        0x00000000, 0x0000000f, 0x505f5653, 0x5449534f, 0x004e4f49, 0x52444853, 0x000000c8, 0x00020040,
+        0x00000032, 0x05000061, 0x002010f2, 0x00000003, 0x00000000, 0x00000001, 0x02000068, 0x00000001,
+        0x0100185d, 0x0100285c, 0x04000067, 0x001020f2, 0x00000000, 0x00000001, 0x0200005e, 0x00000003,
+        0x05000036, 0x00100012, 0x00000000, 0x00004001, 0x00000000, 0x01000030, 0x07000050, 0x00100022,
+        0x00000000, 0x0010000a, 0x00000000, 0x00004001, 0x00000003, 0x03040003, 0x0010001a, 0x00000000,
+        0x07000036, 0x001020f2, 0x00000000, 0x00a01e46, 0x0010000a, 0x00000000, 0x00000000, 0x01000013,
+        0x0700001e, 0x00100012, 0x00000000, 0x0010000a, 0x00000000, 0x00004001, 0x00000001, 0x01000016,
+        0x0100003e,
+    };
+    static const float white[] = {1.0f, 1.0f, 1.0f, 1.0f};
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC pipeline_state_desc;
+    ID3D12PipelineState *pipeline_states[16];
+    ID3D12GraphicsCommandList *command_list;
+    LARGE_INTEGER frequency, start, end;
+    struct test_context_desc desc;
+    struct test_context context;
+    ID3D12CommandQueue *queue;
+    DWORD bad_gs_code[ARRAY_SIZE(gs_code)];
+    unsigned int i;
+    HRESULT hr;
+
+    memset(&desc, 0, sizeof(desc));
+    desc.no_pipeline = TRUE;
+    if (!init_test_context(&context, &desc))
+        return;
+    command_list = context.list[0];
+    queue = context.queue;
+
+    /* a geometry shader with an invalid checksum fails while the other stages may be translating */
+    memcpy(bad_gs_code, gs_code, sizeof(gs_code));
+    bad_gs_code[1] ^= 0x1;
+
+    init_pipeline_state_desc(&pipeline_state_desc, context.root_signature, DXGI_FORMAT_B8G8R8A8_UNORM, NULL);
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&start);
+    for (i = 0; i < ARRAY_SIZE(pipeline_states); ++i)
+    {
+        pipeline_state_desc.GS.pShaderBytecode = gs_code;
+        pipeline_state_desc.GS.BytecodeLength = sizeof(gs_code);
+        hr = ID3D12Device_CreateGraphicsPipelineState(context.device, &pipeline_state_desc,
+                &IID_ID3D12PipelineState, (void **)&pipeline_states[i]);
+        ok(hr == S_OK, "%u: Got unexpected hr %#lx.\n", i, hr);
+
+        pipeline_state_desc.GS.pShaderBytecode = bad_gs_code;
+        pipeline_state_desc.GS.BytecodeLength = sizeof(bad_gs_code);
+        context.pipeline_state = (ID3D12PipelineState *)0xdeadbeef;
+        hr = ID3D12Device_CreateGraphicsPipelineState(context.device, &pipeline_state_desc,
+                &IID_ID3D12PipelineState, (void **)&context.pipeline_state);
+        ok(hr == E_INVALIDARG, "%u: Got unexpected hr %#lx.\n", i, hr);
+        ok(!context.pipeline_state, "%u: Got unexpected pipeline state %p.\n", i, context.pipeline_state);
+    }
+    QueryPerformanceCounter(&end);
+    trace("Created %u VS/GS/PS pipeline states in %.2f ms.\n", i,
+            (end.QuadPart - start.QuadPart) * 1000.0 / frequency.QuadPart);
+
+    /* the pipelines built concurrently draw like the others */
+    context.pipeline_state = pipeline_states[0];
+    for (i = 1; i < ARRAY_SIZE(pipeline_states); ++i)
+        ID3D12PipelineState_Release(pipeline_states[i]);
+
+    create_render_target(&context);
+
+    ID3D12GraphicsCommandList_ClearRenderTargetView(command_list, context.rtv[0], white, 0, NULL);
+
+    ID3D12GraphicsCommandList_OMSetRenderTargets(command_list, 1, &context.rtv[0], FALSE, NULL);
+    ID3D12GraphicsCommandList_SetGraphicsRootSignature(command_list, context.root_signature);
+    ID3D12GraphicsCommandList_SetPipelineState(command_list, context.pipeline_state);
+    ID3D12GraphicsCommandList_IASetPrimitiveTopology(command_list, D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    ID3D12GraphicsCommandList_RSSetViewports(command_list, 1, &context.viewport);
+    ID3D12GraphicsCommandList_RSSetScissorRects(command_list, 1, &context.scissor_rect);
+    ID3D12GraphicsCommandList_DrawInstanced(command_list, 3, 1, 0, 0);
+
+    transition_sub_resource_state(command_list, context.render_target[0], 0,
+            D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_COPY_SOURCE);
+
+    check_sub_resource_uint(context.render_target[0], 0, queue, command_list, 0xff00ff00, 0);
+
+    destroy_test_context(&context);
+}
+
 START_TEST(d3d12)
 {
     BOOL enable_debug_layer = FALSE;
@@ -1533,4 +1735,6 @@ START_TEST(d3d12)
     test_swapchain_backbuffer_index();
     test_desktop_window();
     test_invalid_command_queue_types();
+    test_pipeline_library();
+    test_multi_stage_pipeline_states();
 }
@@ -407,10 +407,12 @@ HRESULT WINAPI D3DCompile2(const void *data, SIZE_T data_size, const char *filen
     struct vkd3d_shader_preprocess_info preprocess_info;
     struct vkd3d_shader_hlsl_source_info hlsl_info;
     struct vkd3d_shader_compile_option options[3];
+    struct vkd3d_shader_code byte_code, preprocessed = {0};
     struct vkd3d_shader_compile_info compile_info;
     struct vkd3d_shader_compile_option *option;
-    struct vkd3d_shader_code byte_code;
+    struct shader_cache_key cache_key;
     const D3D_SHADER_MACRO *macro;
+    BOOL use_cache = FALSE;
     size_t profile_len, i;
     char *messages;
     HRESULT hr;
@@ -532,11 +534,34 @@ HRESULT WINAPI D3DCompile2(const void *data, SIZE_T data_size, const char *filen
         option->value = VKD3D_SHADER_COMPILE_OPTION_PACK_MATRIX_COLUMN_MAJOR;
     }
 
+    /* The cache is keyed on the preprocessed source, so that changes to
+     * included files are taken into account. */
+    if (shader_cache_enabled() && !vkd3d_shader_preprocess(&compile_info, &preprocessed, &messages))
+    {
+        use_cache = shader_cache_get_key(&cache_key, &preprocessed, filename, entry_point, profile,
+                flags, effect_flags, secondary_flags, secondary_data, secondary_data_size);
+        if (use_cache && shader_cache_load(&cache_key, shader_blob, messages_blob, &hr))
+        {
+            vkd3d_shader_free_messages(messages);
+            vkd3d_shader_free_shader_code(&preprocessed);
+            return hr;
+        }
+
+        /* On a miss, the original source is compiled, so that the line numbers
+         * in the messages match those of an uncached compile. */
+        vkd3d_shader_free_messages(messages);
+        messages = NULL;
+    }
+
     ret = vkd3d_shader_compile(&compile_info, &byte_code, &messages);
+    vkd3d_shader_free_shader_code(&preprocessed);
 
     if (ret)
         ERR("Failed to compile shader, vkd3d result %d.\n", ret);
 
+    if (use_cache)
+        shader_cache_store(&cache_key, hresult_from_vkd3d_result(ret), ret ? NULL : &byte_code, messages);
+
     if (messages)
     {
         if (*messages && ERR_ON(d3dcompiler))
@@ -740,3 +765,18 @@ HRESULT WINAPI D3DLoadModule(const void *data, SIZE_T size, ID3D11Module **modul
     FIXME("data %p, size %Iu, module %p stub!\n", data, size, module);
     return E_NOTIMPL;
 }
+
+BOOL WINAPI DllMain(HINSTANCE inst, DWORD reason, void *reserved)
+{
+    switch (reason)
+    {
+        case DLL_PROCESS_ATTACH:
+            DisableThreadLibraryCalls(inst);
+            break;
+        case DLL_PROCESS_DETACH:
+            if (reserved) break;
+            shader_cache_cleanup();
+            break;
+    }
+    return TRUE;
+}
@@ -512,6 +512,21 @@ enum bwriterdeclusage
 #define T2_REG          4
 #define T3_REG          5
 
+struct shader_cache_key
+{
+    BYTE hash[32];
+};
+
+BOOL shader_cache_enabled(void);
+BOOL shader_cache_get_key(struct shader_cache_key *key, const struct vkd3d_shader_code *preprocessed,
+        const char *filename, const char *entry_point, const char *profile, UINT flags,
+        UINT effect_flags, UINT secondary_flags, const void *secondary_data, SIZE_T secondary_data_size);
+BOOL shader_cache_load(const struct shader_cache_key *key, ID3DBlob **shader_blob,
+        ID3DBlob **messages_blob, HRESULT *hr);
+void shader_cache_store(const struct shader_cache_key *key, HRESULT hr,
+        const struct vkd3d_shader_code *code, const char *messages);
+void shader_cache_cleanup(void);
+
 struct bwriter_shader *SlAssembleShader(const char *text, char **messages);
 HRESULT shader_write_bytecode(const struct bwriter_shader *shader, uint32_t **result, uint32_t *size);
 void SlDeleteShader(struct bwriter_shader *shader);
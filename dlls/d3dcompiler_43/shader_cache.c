@@ -0,0 +1,399 @@
+/*
+ * Persistent cache of compiled shaders
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include "d3dcompiler_private.h"
+#include "winreg.h"
+#include "bcrypt.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(d3dcompiler);
+
+#define SHADER_CACHE_MAGIC MAKE_TAG('D', '3', 'C', 'C')
+#define SHADER_CACHE_VERSION 1
+
+struct shader_cache_header
+{
+    DWORD magic;
+    DWORD version;
+    HRESULT hr;
+    DWORD code_size;
+    DWORD messages_size;
+    BYTE hash[32];
+};
+
+struct shader_cache_entry
+{
+    WCHAR name[80];
+    ULONGLONG size;
+    FILETIME time;
+};
+
+static WCHAR cache_dir[MAX_PATH];
+static const char *build_id;
+static ULONGLONG cache_max_size;
+static LONG64 cache_size;
+static INIT_ONCE cache_init_once = INIT_ONCE_STATIC_INIT;
+
+static struct
+{
+    LONG hits;
+    LONG misses;
+    LONG stores;
+    LONG evictions;
+} cache_stats;
+
+static CRITICAL_SECTION cache_trim_cs;
+static CRITICAL_SECTION_DEBUG cache_trim_cs_debug =
+{
+    0, 0, &cache_trim_cs,
+    { &cache_trim_cs_debug.ProcessLocksList,
+      &cache_trim_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": cache_trim_cs") }
+};
+static CRITICAL_SECTION cache_trim_cs = { &cache_trim_cs_debug, -1, 0, 0, 0, 0 };
+
+static ULONGLONG scan_cache_dir(struct shader_cache_entry **entries, size_t *count)
+{
+    struct shader_cache_entry *new_entries;
+    size_t capacity = 0;
+    WIN32_FIND_DATAW data;
+    ULONGLONG total = 0;
+    WCHAR path[MAX_PATH];
+    HANDLE handle;
+
+    if (entries)
+    {
+        *entries = NULL;
+        *count = 0;
+    }
+
+    swprintf(path, ARRAY_SIZE(path), L"%s\\*.bin", cache_dir);
+    if ((handle = FindFirstFileW(path, &data)) == INVALID_HANDLE_VALUE)
+        return 0;
+    do
+    {
+        ULONGLONG size = ((ULONGLONG)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            continue;
+        total += size;
+        if (!entries || wcslen(data.cFileName) >= ARRAY_SIZE((*entries)->name))
+            continue;
+        if (*count == capacity)
+        {
+            capacity = max(capacity * 2, 64);
+            if (!(new_entries = realloc(*entries, capacity * sizeof(**entries))))
+                break;
+            *entries = new_entries;
+        }
+        wcscpy((*entries)[*count].name, data.cFileName);
+        (*entries)[*count].size = size;
+        (*entries)[*count].time = data.ftLastWriteTime;
+        ++*count;
+    } while (FindNextFileW(handle, &data));
+    FindClose(handle);
+
+    return total;
+}
+
+/* The cache is disabled unless a size is configured. */
+static BOOL WINAPI init_shader_cache(INIT_ONCE *once, void *param, void **context)
+{
+    const char *(CDECL *wine_get_build_id)(void);
+    DWORD size = 0, type, len;
+    WCHAR *p;
+    HKEY key;
+
+    if (!RegOpenKeyW(HKEY_CURRENT_USER, L"Software\\Wine\\D3DCompiler", &key))
+    {
+        len = sizeof(size);
+        if (RegQueryValueExW(key, L"ShaderCacheSize", NULL, &type, (BYTE *)&size, &len) || type != REG_DWORD)
+            size = 0;
+        len = sizeof(cache_dir);
+        if (RegQueryValueExW(key, L"ShaderCachePath", NULL, &type, (BYTE *)cache_dir, &len) || type != REG_SZ)
+            cache_dir[0] = 0;
+        RegCloseKey(key);
+    }
+
+    if (!size)
+    {
+        TRACE("Shader cache disabled.\n");
+        return TRUE;
+    }
+
+    /* Entries written by another build of the compiler are never reused. */
+    wine_get_build_id = (void *)GetProcAddress(GetModuleHandleW(L"ntdll.dll"), "wine_get_build_id");
+    build_id = wine_get_build_id ? wine_get_build_id() : NULL;
+
+    if (!cache_dir[0] && !ExpandEnvironmentStringsW(L"%LOCALAPPDATA%\\wine\\d3dcompiler",
+            cache_dir, ARRAY_SIZE(cache_dir)))
+        return TRUE;
+    if (cache_dir[0] == '%')
+        return TRUE;
+
+    /* create the intermediate directories as well */
+    for (p = cache_dir + 3; (p = wcschr(p, '\\')); ++p)
+    {
+        *p = 0;
+        CreateDirectoryW(cache_dir, NULL);
+        *p = '\\';
+    }
+    if (!CreateDirectoryW(cache_dir, NULL) && GetLastError() != ERROR_ALREADY_EXISTS)
+    {
+        WARN("Failed to create shader cache directory %s, error %lu.\n",
+                debugstr_w(cache_dir), GetLastError());
+        return TRUE;
+    }
+
+    cache_size = scan_cache_dir(NULL, NULL);
+    cache_max_size = (ULONGLONG)size << 20;
+    TRACE("Using shader cache %s, size %I64u / %I64u.\n", debugstr_w(cache_dir), cache_size, cache_max_size);
+    return TRUE;
+}
+
+BOOL shader_cache_enabled(void)
+{
+    InitOnceExecuteOnce(&cache_init_once, init_shader_cache, NULL, NULL);
+    return !!cache_max_size;
+}
+
+static void hash_data(BCRYPT_HASH_HANDLE hash, const void *data, SIZE_T size)
+{
+    ULONG len = size;
+
+    BCryptHashData(hash, (UCHAR *)&len, sizeof(len), 0);
+    if (size) BCryptHashData(hash, (UCHAR *)data, size, 0);
+}
+
+static void hash_string(BCRYPT_HASH_HANDLE hash, const char *str)
+{
+    hash_data(hash, str, str ? strlen(str) + 1 : 0);
+}
+
+BOOL shader_cache_get_key(struct shader_cache_key *key, const struct vkd3d_shader_code *preprocessed,
+        const char *filename, const char *entry_point, const char *profile, UINT flags,
+        UINT effect_flags, UINT secondary_flags, const void *secondary_data, SIZE_T secondary_data_size)
+{
+    UINT values[4] = {D3D_COMPILER_VERSION, flags, effect_flags, secondary_flags};
+    BCRYPT_HASH_HANDLE hash;
+
+    if (BCryptCreateHash(BCRYPT_SHA256_ALG_HANDLE, &hash, NULL, 0, NULL, 0, 0))
+        return FALSE;
+
+    hash_string(hash, build_id);
+    hash_string(hash, vkd3d_shader_get_version(NULL, NULL));
+    hash_data(hash, values, sizeof(values));
+    hash_string(hash, filename);
+    hash_string(hash, entry_point);
+    hash_string(hash, profile);
+    hash_data(hash, secondary_data, secondary_data_size);
+    hash_data(hash, preprocessed->code, preprocessed->size);
+
+    BCryptFinishHash(hash, key->hash, sizeof(key->hash), 0);
+    BCryptDestroyHash(hash);
+    return TRUE;
+}
+
+static void get_entry_path(const struct shader_cache_key *key, WCHAR *path, size_t size)
+{
+    WCHAR *p;
+    size_t i;
+
+    p = path + swprintf(path, size, L"%s\\", cache_dir);
+    for (i = 0; i < ARRAY_SIZE(key->hash); ++i)
+        p += swprintf(p, size - (p - path), L"%02x", key->hash[i]);
+    wcscpy(p, L".bin");
+}
+
+static HRESULT create_blob(const void *data, SIZE_T size, ID3DBlob **blob)
+{
+    HRESULT hr;
+
+    if (SUCCEEDED(hr = D3DCreateBlob(size, blob)))
+        memcpy(ID3D10Blob_GetBufferPointer(*blob), data, size);
+    return hr;
+}
+
+BOOL shader_cache_load(const struct shader_cache_key *key, ID3DBlob **shader_blob,
+        ID3DBlob **messages_blob, HRESULT *hr)
+{
+    struct shader_cache_header header;
+    WCHAR path[MAX_PATH + 80];
+    DWORD read, size, high;
+    HRESULT blob_hr;
+    FILETIME now;
+    char *buffer;
+    HANDLE file;
+
+    get_entry_path(key, path, ARRAY_SIZE(path));
+    file = CreateFileW(path, GENERIC_READ | FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        InterlockedIncrement(&cache_stats.misses);
+        return FALSE;
+    }
+
+    /* The entry sizes come from the file and are checked against its size
+     * before they are used. */
+    size = GetFileSize(file, &high);
+    if (size == INVALID_FILE_SIZE || high || size < sizeof(header)
+            || !ReadFile(file, &header, sizeof(header), &read, NULL) || read != sizeof(header)
+            || header.magic != SHADER_CACHE_MAGIC || header.version != SHADER_CACHE_VERSION
+            || memcmp(header.hash, key->hash, sizeof(header.hash))
+            || header.code_size > size - sizeof(header)
+            || header.messages_size != size - sizeof(header) - header.code_size
+            || !(buffer = malloc(size - sizeof(header) + 1)))
+    {
+        CloseHandle(file);
+        InterlockedIncrement(&cache_stats.misses);
+        return FALSE;
+    }
+
+    size -= sizeof(header);
+    if (!ReadFile(file, buffer, size, &read, NULL) || read != size)
+    {
+        free(buffer);
+        CloseHandle(file);
+        InterlockedIncrement(&cache_stats.misses);
+        return FALSE;
+    }
+
+    /* Use the write time to track usage for eviction. */
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file, NULL, NULL, &now);
+    CloseHandle(file);
+
+    /* Only allocation failures override the cached result. */
+    *hr = header.hr;
+    if (header.messages_size && messages_blob && FAILED(blob_hr = create_blob(buffer + header.code_size,
+            header.messages_size, messages_blob)))
+    {
+        *hr = blob_hr;
+        goto done;
+    }
+    if (SUCCEEDED(header.hr) && shader_blob && FAILED(blob_hr = create_blob(buffer, header.code_size, shader_blob)))
+    {
+        *hr = blob_hr;
+        if (messages_blob && *messages_blob)
+        {
+            ID3D10Blob_Release(*messages_blob);
+            *messages_blob = NULL;
+        }
+    }
+
+done:
+    free(buffer);
+    InterlockedIncrement(&cache_stats.hits);
+    TRACE("Found shader %s in the cache, hr %#lx.\n", debugstr_w(path), header.hr);
+    return TRUE;
+}
+
+static int __cdecl compare_entry_time(const void *a, const void *b)
+{
+    const struct shader_cache_entry *entry_a = a, *entry_b = b;
+
+    return CompareFileTime(&entry_a->time, &entry_b->time);
+}
+
+/* Evict the least recently used entries until the cache fits in 3/4 of its limit. */
+static void shader_cache_trim(void)
+{
+    struct shader_cache_entry *entries;
+    ULONGLONG total, target;
+    WCHAR path[MAX_PATH + 80];
+    size_t count, i;
+
+    if (!TryEnterCriticalSection(&cache_trim_cs))
+        return;
+
+    total = scan_cache_dir(&entries, &count);
+    target = cache_max_size / 4 * 3;
+    if (total > cache_max_size && entries)
+    {
+        qsort(entries, count, sizeof(*entries), compare_entry_time);
+        for (i = 0; i < count && total > target; ++i)
+        {
+            swprintf(path, ARRAY_SIZE(path), L"%s\\%s", cache_dir, entries[i].name);
+            if (!DeleteFileW(path))
+                continue;
+            total -= entries[i].size;
+            InterlockedIncrement(&cache_stats.evictions);
+        }
+        TRACE("Trimmed shader cache to %I64u bytes.\n", total);
+    }
+    cache_size = total;
+    free(entries);
+
+    LeaveCriticalSection(&cache_trim_cs);
+}
+
+void shader_cache_store(const struct shader_cache_key *key, HRESULT hr,
+        const struct vkd3d_shader_code *code, const char *messages)
+{
+    WCHAR path[MAX_PATH + 80], tmp_path[MAX_PATH + 80];
+    struct shader_cache_header header;
+    DWORD written, size;
+    HANDLE file;
+    BOOL ret;
+
+    header.magic = SHADER_CACHE_MAGIC;
+    header.version = SHADER_CACHE_VERSION;
+    header.hr = hr;
+    header.code_size = code ? code->size : 0;
+    header.messages_size = messages ? strlen(messages) : 0;
+    memcpy(header.hash, key->hash, sizeof(header.hash));
+    size = sizeof(header) + header.code_size + header.messages_size;
+
+    if (size > cache_max_size / 16)
+        return;
+
+    /* Write to a temporary file and rename it, so that concurrent readers
+     * never see partial entries. */
+    get_entry_path(key, path, ARRAY_SIZE(path));
+    swprintf(tmp_path, ARRAY_SIZE(tmp_path), L"%s.%04lx.tmp", path, GetCurrentThreadId());
+    file = CreateFileW(tmp_path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    ret = WriteFile(file, &header, sizeof(header), &written, NULL)
+            && (!header.code_size || WriteFile(file, code->code, header.code_size, &written, NULL))
+            && (!header.messages_size || WriteFile(file, messages, header.messages_size, &written, NULL));
+    CloseHandle(file);
+
+    if (!ret || !MoveFileExW(tmp_path, path, MOVEFILE_REPLACE_EXISTING))
+    {
+        WARN("Failed to write shader cache entry %s, error %lu.\n", debugstr_w(path), GetLastError());
+        DeleteFileW(tmp_path);
+        return;
+    }
+
+    InterlockedIncrement(&cache_stats.stores);
+    if (InterlockedAdd64(&cache_size, size) > cache_max_size)
+        shader_cache_trim();
+}
+
+void shader_cache_cleanup(void)
+{
+    if (!cache_max_size)
+        return;
+    TRACE("Shader cache hits %ld, misses %ld, stores %ld, evictions %ld.\n",
+            cache_stats.hits, cache_stats.misses, cache_stats.stores, cache_stats.evictions);
+}
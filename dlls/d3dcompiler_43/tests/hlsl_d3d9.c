@@ -1835,11 +1835,219 @@ static void test_no_output_blob(void)
     ok(!errors, "Unexpected errors blob.\n");
 }
 
+/* Set the write time of the cache entries back, so that reading them can
+ * be detected, and return how many there are. */
+static unsigned int age_cache_entries(const char *dir)
+{
+    static const FILETIME old_time = {0x256d4000, 0x01bf53eb}; /* 2000-01-01 */
+    char path[MAX_PATH];
+    WIN32_FIND_DATAA data;
+    unsigned int count = 0;
+    HANDLE find, file;
+
+    sprintf(path, "%s\\*.bin", dir);
+    if ((find = FindFirstFileA(path, &data)) == INVALID_HANDLE_VALUE)
+        return 0;
+    do
+    {
+        sprintf(path, "%s\\%s", dir, data.cFileName);
+        file = CreateFileA(path, FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                NULL, OPEN_EXISTING, 0, NULL);
+        ok(file != INVALID_HANDLE_VALUE, "Failed to open %s, error %lu.\n", debugstr_a(path), GetLastError());
+        SetFileTime(file, NULL, NULL, &old_time);
+        CloseHandle(file);
+        ++count;
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+    return count;
+}
+
+static unsigned int count_aged_cache_entries(const char *dir)
+{
+    char path[MAX_PATH];
+    WIN32_FIND_DATAA data;
+    unsigned int count = 0;
+    HANDLE find;
+
+    sprintf(path, "%s\\*.bin", dir);
+    if ((find = FindFirstFileA(path, &data)) == INVALID_HANDLE_VALUE)
+        return 0;
+    do
+    {
+        if (data.ftLastWriteTime.dwHighDateTime < 0x01c00000)
+            ++count;
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+    return count;
+}
+
+static void test_compile_storm(const char *cache_dir)
+{
+    static const char ps_source[] =
+        "float4 main() : COLOR\n"
+        "{\n"
+        "    return float4(VALUE, 0.25, 0.5, 1.0);\n"
+        "}";
+    static const char fail_source[] =
+        "float4 main() : COLOR\n"
+        "{\n"
+        "    return undefined_variable;\n"
+        "}";
+    static const unsigned int count = 64;
+    ID3D10Blob *blobs[64], *blob, *errors, *first_errors = NULL;
+    LARGE_INTEGER start, end, freq;
+    D3D_SHADER_MACRO macros[2];
+    unsigned int i, pass, entries = 0;
+    char value[16];
+    HRESULT hr;
+
+    QueryPerformanceFrequency(&freq);
+    macros[0].Name = "VALUE";
+    macros[0].Definition = value;
+    macros[1].Name = NULL;
+    macros[1].Definition = NULL;
+
+    /* The second pass compiles the same shaders again and should return
+     * identical bytecode, whether or not it comes from a cache. */
+    for (pass = 0; pass < 2; ++pass)
+    {
+        QueryPerformanceCounter(&start);
+        for (i = 0; i < count; ++i)
+        {
+            sprintf(value, "%u.0", i);
+            hr = D3DCompile(ps_source, strlen(ps_source), NULL, macros, NULL, "main", "ps_2_0", 0, 0, &blob, NULL);
+            ok(hr == S_OK, "Pass %u, shader %u: got unexpected hr %#lx.\n", pass, i, hr);
+            if (FAILED(hr))
+                return;
+
+            if (!pass)
+            {
+                blobs[i] = blob;
+                continue;
+            }
+            ok(ID3D10Blob_GetBufferSize(blob) == ID3D10Blob_GetBufferSize(blobs[i])
+                    && !memcmp(ID3D10Blob_GetBufferPointer(blob), ID3D10Blob_GetBufferPointer(blobs[i]),
+                    ID3D10Blob_GetBufferSize(blob)), "Shader %u: got different bytecode.\n", i);
+            ID3D10Blob_Release(blob);
+        }
+        QueryPerformanceCounter(&end);
+        trace("Pass %u: compiled %u shaders in %I64u us.\n", pass, count,
+                (end.QuadPart - start.QuadPart) * 1000000 / freq.QuadPart);
+        if (cache_dir && !pass)
+            age_cache_entries(cache_dir);
+    }
+
+    /* With the cache enabled, the first pass stored every shader, and the
+     * second one read them back. */
+    if (cache_dir)
+    {
+        ok(!count_aged_cache_entries(cache_dir), "Got %u entries not read from the cache.\n",
+                count_aged_cache_entries(cache_dir));
+        entries = age_cache_entries(cache_dir);
+        ok(entries == count || broken(!entries), "Got %u cache entries.\n", entries);
+    }
+
+    ok(ID3D10Blob_GetBufferSize(blobs[0]) != ID3D10Blob_GetBufferSize(blobs[1])
+            || memcmp(ID3D10Blob_GetBufferPointer(blobs[0]), ID3D10Blob_GetBufferPointer(blobs[1]),
+            ID3D10Blob_GetBufferSize(blobs[0])), "Got identical bytecode for different defines.\n");
+    for (i = 0; i < count; ++i)
+        ID3D10Blob_Release(blobs[i]);
+
+    for (pass = 0; pass < 2; ++pass)
+    {
+        blob = (ID3D10Blob *)0xdeadbeef;
+        errors = NULL;
+        hr = D3DCompile(fail_source, strlen(fail_source), NULL, NULL, NULL, "main", "ps_2_0", 0, 0, &blob, &errors);
+        ok(hr == E_FAIL, "Pass %u: got unexpected hr %#lx.\n", pass, hr);
+        ok(!blob, "Pass %u: got unexpected blob %p.\n", pass, blob);
+        ok(!!errors, "Pass %u: expected errors.\n", pass);
+        if (!errors)
+            continue;
+        if (!pass)
+        {
+            first_errors = errors;
+            continue;
+        }
+        /* a cached failure returns the same messages, with the same line numbers */
+        ok(first_errors && ID3D10Blob_GetBufferSize(errors) == ID3D10Blob_GetBufferSize(first_errors)
+                && !memcmp(ID3D10Blob_GetBufferPointer(errors), ID3D10Blob_GetBufferPointer(first_errors),
+                ID3D10Blob_GetBufferSize(errors)), "Got different error messages.\n");
+        ID3D10Blob_Release(errors);
+    }
+    if (first_errors)
+        ID3D10Blob_Release(first_errors);
+
+    if (cache_dir && entries)
+    {
+        ok(age_cache_entries(cache_dir) == count + 1, "Expected the failed compile to be cached.\n");
+        hr = D3DCompile(fail_source, strlen(fail_source), NULL, NULL, NULL, "main", "ps_2_0", 0, 0, &blob, &errors);
+        ok(hr == E_FAIL, "Got unexpected hr %#lx.\n", hr);
+        ok(!blob, "Got unexpected blob %p.\n", blob);
+        ok(!!errors, "Expected errors.\n");
+        if (errors)
+            ID3D10Blob_Release(errors);
+        ok(count_aged_cache_entries(cache_dir) == count,
+                "Expected the failed compile to be read from the cache.\n");
+    }
+}
+
+static void test_shader_cache(void)
+{
+    char dir[MAX_PATH], path[MAX_PATH + 32], **argv;
+    PROCESS_INFORMATION info;
+    STARTUPINFOA startup;
+    WIN32_FIND_DATAA data;
+    DWORD size = 16;
+    HANDLE find;
+    HKEY key;
+
+    GetTempPathA(ARRAY_SIZE(dir), dir);
+    sprintf(dir + strlen(dir), "d3dcompiler_cache_%lu", GetCurrentProcessId());
+    ok(CreateDirectoryA(dir, NULL), "Failed to create %s, error %lu.\n", debugstr_a(dir), GetLastError());
+
+    /* the cache settings are read once per process */
+    ok(!RegCreateKeyA(HKEY_CURRENT_USER, "Software\\Wine\\D3DCompiler", &key), "Failed to create key.\n");
+    RegSetValueExA(key, "ShaderCacheSize", 0, REG_DWORD, (BYTE *)&size, sizeof(size));
+    RegSetValueExA(key, "ShaderCachePath", 0, REG_SZ, (BYTE *)dir, strlen(dir) + 1);
+
+    winetest_get_mainargs(&argv);
+    sprintf(path, "%s hlsl_d3d9 compile_storm \"%s\"", argv[0], dir);
+    memset(&startup, 0, sizeof(startup));
+    startup.cb = sizeof(startup);
+    ok(CreateProcessA(NULL, path, NULL, NULL, FALSE, 0, NULL, NULL, &startup, &info),
+            "CreateProcess failed, error %lu.\n", GetLastError());
+    wait_child_process(info.hProcess);
+    CloseHandle(info.hProcess);
+    CloseHandle(info.hThread);
+
+    RegDeleteValueA(key, "ShaderCacheSize");
+    RegDeleteValueA(key, "ShaderCachePath");
+    RegCloseKey(key);
+
+    sprintf(path, "%s\\*", dir);
+    if ((find = FindFirstFileA(path, &data)) != INVALID_HANDLE_VALUE)
+    {
+        do
+        {
+            sprintf(path, "%s\\%s", dir, data.cFileName);
+            DeleteFileA(path);
+        } while (FindNextFileA(find, &data));
+        FindClose(find);
+    }
+    RemoveDirectoryA(dir);
+}
+
 START_TEST(hlsl_d3d9)
 {
-    char buffer[20];
+    char buffer[20], **argv;
     HMODULE mod;
 
+    if (winetest_get_mainargs(&argv) >= 4 && !strcmp(argv[2], "compile_storm"))
+    {
+        test_compile_storm(argv[3]);
+        return;
+    }
+
     if (!(mod = LoadLibraryA("d3dx9_36.dll")))
     {
         win_skip("Failed to load d3dx9_36.dll.\n");
@@ -1869,4 +2077,6 @@ START_TEST(hlsl_d3d9)
     test_fail();
     test_include();
     test_no_output_blob();
+    test_compile_storm(NULL);
+    test_shader_cache();
 }
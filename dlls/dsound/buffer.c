@@ -1177,6 +1177,8 @@ void secondarybuffer_destroy(IDirectSoundBufferImpl *This)
     free(This->notifies);
     free(This->pwfx);
     free(This->committedbuff);
+    free(This->tmp_buffer);
+    free(This->cp_buffer);
 
     if (This->filters) {
         int i;
@@ -1257,6 +1259,8 @@ HRESULT IDirectSoundBufferImpl_Duplicate(
     dsb->committedbuff = committedbuff;
     dsb->use_committed = FALSE;
     dsb->committed_mixpos = 0;
+    dsb->tmp_buffer = dsb->cp_buffer = NULL;
+    dsb->tmp_buffer_len = dsb->cp_buffer_len = 0;
     DSOUND_RecalcFormat(dsb);
 
     InitializeSRWLock(&dsb->lock);
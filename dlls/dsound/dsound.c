@@ -233,8 +233,10 @@ static ULONG DirectSoundDevice_Release(DirectSoundDevice * device)
         if(device->mmdevice)
             IMMDevice_Release(device->mmdevice);
         CloseHandle(device->sleepev);
-        free(device->tmp_buffer);
-        free(device->cp_buffer);
+        if (device->mix_work) {
+            WaitForThreadpoolWorkCallbacks(device->mix_work, FALSE);
+            CloseThreadpoolWork(device->mix_work);
+        }
         free(device->buffer);
         device->mixlock.DebugInfo->Spare[0] = 0;
         DeleteCriticalSection(&device->mixlock);
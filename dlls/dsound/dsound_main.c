@@ -83,6 +83,7 @@ const WCHAR wine_vxd_drv[] = L"winemm.vxd";
 
 /* All default settings, you most likely don't want to touch these, see wiki on UsefulRegistryKeys */
 int ds_hel_buflen = 32768 * 2;
+int ds_mix_threads = 1;
 
 /*
  * Get a config key from either the app-specific or the default config
@@ -134,10 +135,14 @@ void setup_dsound_options(void)
     if (!get_config_key( hkey, appkey, "HelBuflen", buffer, MAX_PATH ))
         ds_hel_buflen = atoi(buffer);
 
+    if (!get_config_key( hkey, appkey, "MixThreads", buffer, MAX_PATH ))
+        ds_mix_threads = max(1, min(atoi(buffer), 16));
+
     if (appkey) RegCloseKey( appkey );
     if (hkey) RegCloseKey( hkey );
 
     TRACE("ds_hel_buflen = %d\n", ds_hel_buflen);
+    TRACE("ds_mix_threads = %d\n", ds_mix_threads);
 }
 
 static const char * get_device_id(LPCGUID pGuid)
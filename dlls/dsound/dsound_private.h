@@ -35,6 +35,7 @@
 #define DS_MAX_CHANNELS 6
 
 extern int ds_hel_buflen;
+extern int ds_mix_threads;
 
 /*****************************************************************************
  * Predeclare the interface implementation structures
@@ -88,8 +89,10 @@ struct DirectSoundDevice
     int                         speaker_num[DS_MAX_CHANNELS];
     int                         num_speakers;
     int                         lfe_channel;
-    float *tmp_buffer, *cp_buffer;
-    DWORD                       tmp_buffer_len, cp_buffer_len;
+    /* used to mix the secondary buffers in parallel */
+    PTP_WORK                    mix_work;
+    LONG                        mix_next;
+    DWORD                       mix_frames;
 
     DSVOLUMEPAN                 volpan;
 
@@ -152,6 +155,9 @@ struct IDirectSoundBufferImpl
     LONG64                      freqAccNum;
     /* used for mixing */
     DWORD                       sec_mixpos;
+    float *tmp_buffer, *cp_buffer;
+    DWORD                       tmp_buffer_len, cp_buffer_len;
+    BOOL                        mix_active, mix_audible;
     /* Holds a copy of the next 'writelead' bytes, to be used for mixing. This makes it
      * so that these bytes get played once even if this region of the buffer gets overwritten,
      * which is more in-line with native DirectSound behavior. */
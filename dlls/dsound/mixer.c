@@ -314,6 +314,25 @@ static UINT cp_fields_noresample(IDirectSoundBufferImpl *dsb, UINT count)
     return count;
 }
 
+/* Independent partial sums let the compiler use SIMD registers and break
+ * the dependency chain of a single accumulator. */
+static inline float fir_dot_product(const float *coeffs, const float *samples, int count)
+{
+    float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    int j;
+
+    for (j = 0; j + 4 <= count; j += 4) {
+        sum0 += coeffs[j] * samples[j];
+        sum1 += coeffs[j + 1] * samples[j + 1];
+        sum2 += coeffs[j + 2] * samples[j + 2];
+        sum3 += coeffs[j + 3] * samples[j + 3];
+    }
+    for (; j < count; j++)
+        sum0 += coeffs[j] * samples[j];
+
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
 static UINT cp_fields_resample(IDirectSoundBufferImpl *dsb, UINT count, LONG64 *freqAccNum)
 {
     UINT i, channel;
@@ -340,15 +359,15 @@ static UINT cp_fields_resample(IDirectSoundBufferImpl *dsb, UINT count, LONG64 *
     if (!secondarybuffer_is_audible(dsb))
         return max_ipos;
 
-    if (!dsb->device->cp_buffer) {
-        dsb->device->cp_buffer = malloc(len);
-        dsb->device->cp_buffer_len = len;
-    } else if (len > dsb->device->cp_buffer_len) {
-        dsb->device->cp_buffer = realloc(dsb->device->cp_buffer, len);
-        dsb->device->cp_buffer_len = len;
+    if (!dsb->cp_buffer) {
+        dsb->cp_buffer = malloc(len);
+        dsb->cp_buffer_len = len;
+    } else if (len > dsb->cp_buffer_len) {
+        dsb->cp_buffer = realloc(dsb->cp_buffer, len);
+        dsb->cp_buffer_len = len;
     }
 
-    fir_copy = dsb->device->cp_buffer;
+    fir_copy = dsb->cp_buffer;
     intermediate = fir_copy + fir_cachesize;
 
     if(dsb->use_committed) {
@@ -388,12 +407,8 @@ static UINT cp_fields_resample(IDirectSoundBufferImpl *dsb, UINT count, LONG64 *
         assert(ipos + fir_used <= required_input);
 
         for (channel = 0; channel < dsb->mix_channels; channel++) {
-            int j;
-            float sum = 0.0;
             float* cache = &intermediate[channel * required_input + ipos];
-            for (j = 0; j < fir_used; j++)
-                sum += fir_copy[j] * cache[j];
-            dsb->put(dsb, i * ostride, channel, sum * dsb->firgain);
+            dsb->put(dsb, i * ostride, channel, fir_dot_product(fir_copy, cache, fir_used) * dsb->firgain);
         }
     }
 
@@ -462,20 +477,20 @@ static void DSOUND_MixToTemporary(IDirectSoundBufferImpl *dsb, DWORD frames)
 	HRESULT hr;
 	int i;
 
-	if (dsb->device->tmp_buffer_len < size_bytes || !dsb->device->tmp_buffer)
+	if (dsb->tmp_buffer_len < size_bytes || !dsb->tmp_buffer)
 	{
-		dsb->device->tmp_buffer_len = size_bytes;
-		dsb->device->tmp_buffer = realloc(dsb->device->tmp_buffer, size_bytes);
+		dsb->tmp_buffer_len = size_bytes;
+		dsb->tmp_buffer = realloc(dsb->tmp_buffer, size_bytes);
 	}
 	if(dsb->put_aux == putieee32_sum)
-		memset(dsb->device->tmp_buffer, 0, dsb->device->tmp_buffer_len);
+		memset(dsb->tmp_buffer, 0, dsb->tmp_buffer_len);
 
 	cp_fields(dsb, frames, &dsb->freqAccNum);
 
 	if (size_bytes > 0) {
 		for (i = 0; i < dsb->num_filters; i++) {
 			if (dsb->filters[i].inplace) {
-				hr = IMediaObjectInPlace_Process(dsb->filters[i].inplace, size_bytes, (BYTE*)dsb->device->tmp_buffer, 0, DMO_INPLACE_NORMAL);
+				hr = IMediaObjectInPlace_Process(dsb->filters[i].inplace, size_bytes, (BYTE*)dsb->tmp_buffer, 0, DMO_INPLACE_NORMAL);
 
 				if (FAILED(hr))
 					WARN("IMediaObjectInPlace_Process failed for filter %u\n", i);
@@ -509,28 +524,35 @@ static void DSOUND_MixerVol(const IDirectSoundBufferImpl *dsb, INT frames)
 	for (i = 0; i < channels; ++i)
 		vols[i] = dsb->volpan.dwTotalAmpFactor[i] / ((float)0xFFFF);
 
+	if (channels == 2) {
+		/* common stereo case, without the inner loop */
+		for (i = 0; i < frames * 2; i += 2) {
+			dsb->tmp_buffer[i] *= vols[0];
+			dsb->tmp_buffer[i + 1] *= vols[1];
+		}
+		return;
+	}
+
 	for(i = 0; i < frames; ++i){
 		for(chan = 0; chan < channels; ++chan){
-			dsb->device->tmp_buffer[i * channels + chan] *= vols[chan];
+			dsb->tmp_buffer[i * channels + chan] *= vols[chan];
 		}
 	}
 }
 
 /**
- * Mix (at most) the given number of bytes into the given position of the
- * device buffer, from the secondary buffer "dsb" (starting at the current
- * mix position for that buffer).
+ * Convert (at most) the given number of frames from the secondary buffer
+ * "dsb" (starting at the current mix position for that buffer) into its
+ * temporary buffer, ready to be mixed into the device buffer.
  *
- * Returns the number of bytes actually mixed into the device buffer. This
- * will match fraglen unless the end of the secondary buffer is reached
- * (and it is not looping).
+ * Returns the number of frames actually converted. This will match frames
+ * unless the end of the secondary buffer is reached (and it is not looping).
  *
  * dsb  = the secondary buffer to mix from
- * fraglen = number of bytes to mix
+ * frames = number of frames to mix
  */
-static DWORD DSOUND_MixInBuffer(IDirectSoundBufferImpl *dsb, float *mix_buffer, DWORD frames)
+static DWORD DSOUND_MixInBuffer(IDirectSoundBufferImpl *dsb, DWORD frames)
 {
-	float *ibuf;
 	DWORD oldpos;
 
 	TRACE("sec_mixpos=%ld/%ld\n", dsb->sec_mixpos, dsb->buflen);
@@ -539,13 +561,10 @@ static DWORD DSOUND_MixInBuffer(IDirectSoundBufferImpl *dsb, float *mix_buffer,
 	/* Resample buffer to temporary buffer specifically allocated for this purpose, if needed */
 	oldpos = dsb->sec_mixpos;
 	DSOUND_MixToTemporary(dsb, frames);
-	ibuf = dsb->device->tmp_buffer;
 
-	if (secondarybuffer_is_audible(dsb)) {
+	if ((dsb->mix_audible = secondarybuffer_is_audible(dsb))) {
 		/* Apply volume if needed */
 		DSOUND_MixerVol(dsb, frames);
-
-		mixieee32(ibuf, mix_buffer, frames * dsb->device->pwfx->nChannels);
 	}
 
 	/* check for notification positions */
@@ -569,7 +588,7 @@ static DWORD DSOUND_MixInBuffer(IDirectSoundBufferImpl *dsb, float *mix_buffer,
  *
  * Returns: the number of frames beyond the writepos that were mixed.
  */
-static DWORD DSOUND_MixOne(IDirectSoundBufferImpl *dsb, float *mix_buffer, DWORD frames)
+static DWORD DSOUND_MixOne(IDirectSoundBufferImpl *dsb, DWORD frames)
 {
 	DWORD primary_done = 0;
 
@@ -594,7 +613,7 @@ static DWORD DSOUND_MixOne(IDirectSoundBufferImpl *dsb, float *mix_buffer, DWORD
 	/* First try to mix to the end of the buffer if possible
 	 * Theoretically it would allow for better optimization
 	*/
-	primary_done += DSOUND_MixInBuffer(dsb, mix_buffer, frames);
+	primary_done += DSOUND_MixInBuffer(dsb, frames);
 
 	TRACE("total mixed data=%ld\n", primary_done);
 
@@ -602,6 +621,44 @@ static DWORD DSOUND_MixOne(IDirectSoundBufferImpl *dsb, float *mix_buffer, DWORD
 	return primary_done;
 }
 
+/**
+ * Convert the next frames of a playing secondary buffer into its temporary
+ * buffer. Buffers are independent from each other, so this can run on
+ * several threads at once.
+ */
+static void DSOUND_PrepareOne(IDirectSoundBufferImpl *dsb, DWORD frames)
+{
+	dsb->mix_active = dsb->mix_audible = FALSE;
+
+	TRACE("MixToPrimary for %p, state=%ld\n", dsb, dsb->state);
+
+	if (dsb->buflen && dsb->state) {
+		TRACE("Checking %p, frames=%ld\n", dsb, frames);
+		AcquireSRWLockShared(&dsb->lock);
+		if (dsb->state != STATE_STOPPED) {
+
+			/* if the buffer was starting, it must be playing now */
+			if (dsb->state == STATE_STARTING)
+				dsb->state = STATE_PLAYING;
+
+			/* convert next buffer data, mixed into the main buffer later */
+			DSOUND_MixOne(dsb, frames);
+
+			dsb->mix_active = TRUE;
+		}
+		ReleaseSRWLockShared(&dsb->lock);
+	}
+}
+
+static void CALLBACK DSOUND_PrepareWork(TP_CALLBACK_INSTANCE *instance, void *context, TP_WORK *work)
+{
+	DirectSoundDevice *device = context;
+	LONG i;
+
+	while ((i = InterlockedIncrement(&device->mix_next) - 1) < device->nrofbuffers)
+		DSOUND_PrepareOne(device->buffers[i], device->mix_frames);
+}
+
 /**
  * For a DirectSoundDevice, go through all the currently playing buffers and
  * mix them in to the device buffer.
@@ -612,36 +669,40 @@ static DWORD DSOUND_MixOne(IDirectSoundBufferImpl *dsb, float *mix_buffer, DWORD
  * Returns:  the length beyond the writepos that was mixed to.
  */
 
-static void DSOUND_MixToPrimary(const DirectSoundDevice *device, float *mix_buffer, DWORD frames, BOOL *all_stopped)
+static void DSOUND_MixToPrimary(DirectSoundDevice *device, float *mix_buffer, DWORD frames, BOOL *all_stopped)
 {
-	INT i;
+	INT i, workers = 0;
 	IDirectSoundBufferImpl	*dsb;
 
 	/* unless we find a running buffer, all have stopped */
 	*all_stopped = TRUE;
 
 	TRACE("(frames %ld)\n", frames);
-	for (i = 0; i < device->nrofbuffers; i++) {
-		dsb = device->buffers[i];
-
-		TRACE("MixToPrimary for %p, state=%ld\n", dsb, dsb->state);
-
-		if (dsb->buflen && dsb->state) {
-			TRACE("Checking %p, frames=%ld\n", dsb, frames);
-			AcquireSRWLockShared(&dsb->lock);
-			if (dsb->state != STATE_STOPPED) {
 
-				/* if the buffer was starting, it must be playing now */
-				if (dsb->state == STATE_STARTING)
-					dsb->state = STATE_PLAYING;
+	/* with enough buffers, convert them in parallel on the thread pool */
+	if (ds_mix_threads > 1 && device->nrofbuffers >= 2 * ds_mix_threads) {
+		if (!device->mix_work)
+			device->mix_work = CreateThreadpoolWork(DSOUND_PrepareWork, device, NULL);
+		if (device->mix_work)
+			workers = ds_mix_threads - 1;
+	}
 
-				/* mix next buffer into the main buffer */
-				DSOUND_MixOne(dsb, mix_buffer, frames);
+	device->mix_next = 0;
+	device->mix_frames = frames;
+	for (i = 0; i < workers; i++)
+		SubmitThreadpoolWork(device->mix_work);
+	DSOUND_PrepareWork(NULL, device, NULL);
+	if (workers)
+		WaitForThreadpoolWorkCallbacks(device->mix_work, FALSE);
 
-				*all_stopped = FALSE;
-			}
-			ReleaseSRWLockShared(&dsb->lock);
-		}
+	/* accumulate the converted buffers in order */
+	for (i = 0; i < device->nrofbuffers; i++) {
+		dsb = device->buffers[i];
+		if (!dsb->mix_active)
+			continue;
+		if (dsb->mix_audible)
+			mixieee32(dsb->tmp_buffer, mix_buffer, frames * device->pwfx->nChannels);
+		*all_stopped = FALSE;
 	}
 }
 
@@ -688,8 +749,8 @@ static void DSOUND_WaveQueue(DirectSoundDevice *device, LPBYTE pos, DWORD bytes)
  * The mixing procedure goes:
  *
  * secondary->buffer (secondary format)
- *   =[Resample]=> device->tmp_buffer (float format)
- *   =[Volume]=> device->tmp_buffer (float format)
+ *   =[Resample]=> secondary->tmp_buffer (float format)
+ *   =[Volume]=> secondary->tmp_buffer (float format)
  *   =[Reformat]=> device->buffer (device format, skipped on float)
  */
 static void DSOUND_PerformMix(DirectSoundDevice *device)
@@ -1881,6 +1881,126 @@ static void test_AcquireResources(void)
     IDirectSound_Release(dsound);
 }
 
+static BOOL WINAPI null_enum_cb(GUID *guid, const char *desc, const char *module, void *user)
+{
+    return FALSE;
+}
+
+/* set the MixThreads option for this executable only, or remove it if NULL */
+static void set_mix_threads(const char *value)
+{
+    char path[MAX_PATH + 64], name[MAX_PATH], *p;
+    HKEY key;
+
+    if (!GetModuleFileNameA(0, name, MAX_PATH)) return;
+    p = strrchr(name, '\\') ? strrchr(name, '\\') + 1 : name;
+    sprintf(path, "Software\\Wine\\AppDefaults\\%s\\DirectSound", p);
+
+    if (value)
+    {
+        if (RegCreateKeyA(HKEY_CURRENT_USER, path, &key)) return;
+        RegSetValueExA(key, "MixThreads", 0, REG_SZ, (const BYTE *)value, strlen(value) + 1);
+        RegCloseKey(key);
+    }
+    else
+    {
+        RegDeleteKeyA(HKEY_CURRENT_USER, path);
+        *strrchr(path, '\\') = 0;
+        RegDeleteKeyA(HKEY_CURRENT_USER, path);
+    }
+
+    /* the options are reloaded on enumeration */
+    DirectSoundEnumerateA(null_enum_cb, NULL);
+}
+
+static void test_many_voices(const char *mix_threads)
+{
+    static const DWORD rates[] = {8000, 11025, 22050, 32000, 44100, 48000, 96000};
+    IDirectSoundBuffer *primary, *secondary[64];
+    IDirectSound8 *dsound;
+    DSBUFFERDESC bufdesc;
+    WAVEFORMATEX fmt;
+    DWORD start, play, write, size;
+    unsigned int i, j, count;
+    void *ptr;
+    HRESULT hr;
+
+    set_mix_threads(mix_threads);
+
+    hr = DirectSoundCreate8(NULL, &dsound, NULL);
+    ok(hr == DS_OK || hr == DSERR_NODRIVER, "Got hr %#lx.\n", hr);
+    if (FAILED(hr))
+        goto done;
+
+    hr = IDirectSound8_SetCooperativeLevel(dsound, get_hwnd(), DSSCL_PRIORITY);
+    ok(hr == DS_OK, "Got hr %#lx.\n", hr);
+
+    bufdesc.dwSize = sizeof(bufdesc);
+    bufdesc.dwFlags = DSBCAPS_PRIMARYBUFFER;
+    bufdesc.dwBufferBytes = 0;
+    bufdesc.dwReserved = 0;
+    bufdesc.lpwfxFormat = NULL;
+    bufdesc.guid3DAlgorithm = GUID_NULL;
+
+    hr = IDirectSound8_CreateSoundBuffer(dsound, &bufdesc, &primary, NULL);
+    ok(hr == S_OK, "CreateSoundBuffer failed: %08lx\n", hr);
+    if (hr != S_OK) {
+        IDirectSound_Release(dsound);
+        goto done;
+    }
+
+    /* voices at mismatched rates, so that most of them need resampling */
+    for (count = 0; count < ARRAY_SIZE(secondary); count++) {
+        fmt.wFormatTag = WAVE_FORMAT_PCM;
+        fmt.nChannels = count % 2 + 1;
+        fmt.nSamplesPerSec = rates[count % ARRAY_SIZE(rates)] + count;
+        fmt.wBitsPerSample = 16;
+        fmt.nBlockAlign = fmt.nChannels * fmt.wBitsPerSample / 8;
+        fmt.nAvgBytesPerSec = fmt.nBlockAlign * fmt.nSamplesPerSec;
+        fmt.cbSize = 0;
+
+        bufdesc.dwFlags = DSBCAPS_GETCURRENTPOSITION2 | DSBCAPS_CTRLVOLUME | DSBCAPS_CTRLPAN | DSBCAPS_CTRLFREQUENCY;
+        bufdesc.dwBufferBytes = fmt.nAvgBytesPerSec / 2;
+        bufdesc.lpwfxFormat = &fmt;
+
+        hr = IDirectSound8_CreateSoundBuffer(dsound, &bufdesc, &secondary[count], NULL);
+        ok(hr == S_OK, "CreateSoundBuffer failed: %08lx\n", hr);
+        if (hr != S_OK)
+            break;
+
+        hr = IDirectSoundBuffer_Lock(secondary[count], 0, 0, &ptr, &size, NULL, NULL, DSBLOCK_ENTIREBUFFER);
+        ok(hr == S_OK, "Lock failed: %08lx\n", hr);
+        for (j = 0; j < size / sizeof(short); j++)
+            ((short *)ptr)[j] = (j * (count + 1) * 64) & 0x3fff;
+        IDirectSoundBuffer_Unlock(secondary[count], ptr, size, NULL, 0);
+
+        IDirectSoundBuffer_SetVolume(secondary[count], -600 - (LONG)count * 10);
+        IDirectSoundBuffer_SetPan(secondary[count], (LONG)count * 100 - 3200);
+    }
+
+    start = GetTickCount();
+    for (i = 0; i < count; i++) {
+        hr = IDirectSoundBuffer_Play(secondary[i], 0, 0, DSBPLAY_LOOPING);
+        ok(hr == S_OK, "Play failed: %08lx\n", hr);
+    }
+    Sleep(300);
+
+    for (i = 0; i < count; i++) {
+        hr = IDirectSoundBuffer_GetCurrentPosition(secondary[i], &play, &write);
+        ok(hr == S_OK, "GetCurrentPosition failed: %08lx\n", hr);
+        ok(play != 0, "voice %u didn't play\n", i);
+        IDirectSoundBuffer_Stop(secondary[i]);
+        IDirectSoundBuffer_Release(secondary[i]);
+    }
+    trace("played %u voices with %s mix threads for %lu ms\n", count, mix_threads ? mix_threads : "default",
+          GetTickCount() - start);
+
+    IDirectSoundBuffer_Release(primary);
+    IDirectSound_Release(dsound);
+done:
+    if (mix_threads) set_mix_threads(NULL);
+}
+
 START_TEST(dsound8)
 {
     DWORD cookie;
@@ -1895,6 +2015,9 @@ START_TEST(dsound8)
     test_first_device();
     test_primary_flags();
     test_AcquireResources();
+    test_many_voices(NULL);
+    /* convert the buffers in parallel */
+    test_many_voices("4");
 
     hr = CoRegisterClassObject(&testdmo_clsid, (IUnknown *)&testdmo_cf,
             CLSCTX_INPROC_SERVER, REGCLS_MULTIPLEUSE, &cookie);
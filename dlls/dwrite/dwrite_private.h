@@ -307,6 +307,9 @@ extern HRESULT create_text_format(const WCHAR *family_name, IDWriteFontCollectio
         DWRITE_FONT_STYLE style, DWRITE_FONT_STRETCH stretch, float size, const WCHAR *locale, REFIID riid,
         void **out);
 extern HRESULT create_textlayout(const struct textlayout_desc*,IDWriteTextLayout**);
+struct shaping_cache;
+extern struct shaping_cache *create_shaping_cache(void);
+extern void release_shaping_cache(struct shaping_cache *cache);
 extern HRESULT create_trimmingsign(IDWriteFactory7 *factory, IDWriteTextFormat *format,
         IDWriteInlineObject **sign);
 extern HRESULT create_typography(IDWriteTypography**);
@@ -351,6 +354,7 @@ extern HRESULT factory_get_cached_fontface(IDWriteFactory7 *factory, IDWriteFont
         DWRITE_FONT_SIMULATIONS simulations, struct list **cache, REFIID riid, void **obj);
 extern void factory_detach_fontcollection(IDWriteFactory7 *factory, IDWriteFontCollection3 *collection);
 extern void factory_detach_gdiinterop(IDWriteFactory7 *factory, IDWriteGdiInterop1 *interop);
+extern struct shaping_cache *factory_get_shaping_cache(IDWriteFactory7 *factory);
 extern struct fontfacecached *factory_cache_fontface(IDWriteFactory7 *factory, struct list *fontfaces,
         IDWriteFontFace5 *fontface);
 extern void    get_logfont_from_font(IDWriteFont*,LOGFONTW*);
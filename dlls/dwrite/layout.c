@@ -950,7 +950,6 @@ static HRESULT layout_shape_get_glyphs(struct dwrite_textlayout *layout, struct
     unsigned int max_count;
     HRESULT hr;
 
-    run->descr.localeName = get_layout_range_by_pos(layout, run->descr.textPosition)->locale;
     run->clustermap = calloc(run->descr.stringLength, sizeof(*run->clustermap));
     if (!run->clustermap)
         return E_OUTOFMEMORY;
@@ -965,9 +964,6 @@ static HRESULT layout_shape_get_glyphs(struct dwrite_textlayout *layout, struct
     if (!context->text_props || !context->glyph_props)
         return E_OUTOFMEMORY;
 
-    if (FAILED(hr = layout_shape_get_user_features(layout, context)))
-        return hr;
-
     for (;;)
     {
         hr = IDWriteTextAnalyzer2_GetGlyphs(context->analyzer, run->descr.string, run->descr.stringLength, run->run.fontFace,
@@ -1114,26 +1110,344 @@ static HRESULT layout_shape_get_positions(struct dwrite_textlayout *layout, stru
         WARN("%s: failed to get glyph placement info, hr %#lx.\n", debugstr_rundescr(&run->descr), hr);
     }
 
-    if (SUCCEEDED(hr))
-        hr = layout_shape_apply_character_spacing(layout, context);
-
     run->run.glyphAdvances = run->advances;
     run->run.glyphOffsets = run->offsets;
 
     return hr;
 }
 
+/* Shaping results are cached per factory, because applications tend to recreate
+   layouts with the same contents over and over. Cached runs are looked up by text
+   and every parameter that affects shaping, serialized to a single key. */
+
+#define SHAPING_CACHE_MAX_SIZE 0x200000
+#define SHAPING_CACHE_MAX_LENGTH 1024
+
+struct shaping_cache
+{
+    CRITICAL_SECTION cs;
+    struct wine_rb_tree tree;
+    struct list mru;
+    size_t size;
+    unsigned int hits;
+    unsigned int misses;
+};
+
+struct shaping_cache_key
+{
+    UINT32 hash;
+    UINT32 size;
+    BYTE *data;
+    size_t capacity;
+};
+
+struct shaping_cache_entry
+{
+    struct wine_rb_entry entry;
+    struct list mru;
+    struct shaping_cache_key key;
+    IDWriteFontFile *file;
+    size_t size;
+    UINT32 length;
+    UINT32 glyph_count;
+    UINT16 *glyphs;
+    UINT16 *clustermap;
+    DWRITE_SHAPING_GLYPH_PROPERTIES *glyph_props;
+    float *advances;
+    DWRITE_GLYPH_OFFSET *offsets;
+};
+
+static int shaping_cache_compare(const void *k, const struct wine_rb_entry *e)
+{
+    const struct shaping_cache_entry *entry = WINE_RB_ENTRY_VALUE(e, const struct shaping_cache_entry, entry);
+    const struct shaping_cache_key *key = k, *key2 = &entry->key;
+
+    if (key->hash != key2->hash) return key->hash < key2->hash ? -1 : 1;
+    if (key->size != key2->size) return key->size < key2->size ? -1 : 1;
+    return memcmp(key->data, key2->data, key->size);
+}
+
+struct shaping_cache *create_shaping_cache(void)
+{
+    struct shaping_cache *cache;
+
+    if (!(cache = calloc(1, sizeof(*cache))))
+        return NULL;
+
+    wine_rb_init(&cache->tree, shaping_cache_compare);
+    list_init(&cache->mru);
+    InitializeCriticalSection(&cache->cs);
+    cache->cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": shaping_cache.lock");
+
+    return cache;
+}
+
+static void shaping_cache_release_entry(struct shaping_cache_entry *entry)
+{
+    IDWriteFontFile_Release(entry->file);
+    free(entry->key.data);
+    free(entry);
+}
+
+void release_shaping_cache(struct shaping_cache *cache)
+{
+    struct shaping_cache_entry *entry, *entry2;
+
+    TRACE("%u hits, %u misses.\n", cache->hits, cache->misses);
+
+    LIST_FOR_EACH_ENTRY_SAFE(entry, entry2, &cache->mru, struct shaping_cache_entry, mru)
+    {
+        list_remove(&entry->mru);
+        shaping_cache_release_entry(entry);
+    }
+
+    cache->cs.DebugInfo->Spare[0] = 0;
+    DeleteCriticalSection(&cache->cs);
+    free(cache);
+}
+
+static void shaping_cache_key_append(struct shaping_cache_key *key, const void *data, size_t size)
+{
+    const BYTE *ptr = data;
+    size_t i;
+
+    if (!key->data) return;
+
+    if (key->size + size > key->capacity)
+    {
+        size_t capacity = max(key->capacity * 2, key->size + size);
+        BYTE *new_data;
+
+        if (!(new_data = realloc(key->data, capacity)))
+        {
+            free(key->data);
+            key->data = NULL;
+            return;
+        }
+        key->data = new_data;
+        key->capacity = capacity;
+    }
+
+    for (i = 0; i < size; ++i)
+        key->hash = (key->hash ^ ptr[i]) * 16777619;
+    memcpy(key->data + key->size, data, size);
+    key->size += size;
+}
+
+static BOOL layout_shape_get_cache_key(const struct dwrite_textlayout *layout, const struct shaping_context *context,
+        struct shaping_cache_key *key)
+{
+    const struct regular_layout_run *run = context->run;
+    struct dwrite_fontface *fontface = unsafe_impl_from_IDWriteFontFace(run->run.fontFace);
+    const WCHAR *locale = run->descr.localeName;
+    UINT32 flags, value;
+    unsigned int i;
+
+    if (run->descr.stringLength > SHAPING_CACHE_MAX_LENGTH || !fontface->file)
+        return FALSE;
+
+    memset(key, 0, sizeof(*key));
+    key->hash = 2166136261;
+    key->capacity = 64 + (run->descr.stringLength + wcslen(locale)) * sizeof(WCHAR);
+    if (!(key->data = malloc(key->capacity)))
+        return FALSE;
+
+    flags = !!run->run.isSideways | ((run->run.bidiLevel & 1) << 1);
+    shaping_cache_key_append(key, &fontface->file, sizeof(fontface->file));
+    shaping_cache_key_append(key, &fontface->index, sizeof(fontface->index));
+    shaping_cache_key_append(key, &fontface->simulations, sizeof(fontface->simulations));
+    shaping_cache_key_append(key, &run->run.fontEmSize, sizeof(run->run.fontEmSize));
+    shaping_cache_key_append(key, &flags, sizeof(flags));
+    shaping_cache_key_append(key, &run->sa.script, sizeof(run->sa.script));
+    shaping_cache_key_append(key, &run->sa.shapes, sizeof(run->sa.shapes));
+    shaping_cache_key_append(key, &layout->measuringmode, sizeof(layout->measuringmode));
+    if (is_layout_gdi_compatible(layout))
+    {
+        shaping_cache_key_append(key, &layout->ppdip, sizeof(layout->ppdip));
+        shaping_cache_key_append(key, &layout->transform, sizeof(layout->transform));
+    }
+
+    value = wcslen(locale);
+    shaping_cache_key_append(key, &value, sizeof(value));
+    shaping_cache_key_append(key, locale, value * sizeof(WCHAR));
+
+    shaping_cache_key_append(key, &context->user_features.range_count, sizeof(context->user_features.range_count));
+    for (i = 0; i < context->user_features.range_count; ++i)
+    {
+        const DWRITE_TYPOGRAPHIC_FEATURES *features = context->user_features.features[i];
+
+        shaping_cache_key_append(key, &context->user_features.range_lengths[i],
+                sizeof(context->user_features.range_lengths[i]));
+        shaping_cache_key_append(key, &features->featureCount, sizeof(features->featureCount));
+        shaping_cache_key_append(key, features->features, features->featureCount * sizeof(*features->features));
+    }
+
+    shaping_cache_key_append(key, &run->descr.stringLength, sizeof(run->descr.stringLength));
+    shaping_cache_key_append(key, run->descr.string, run->descr.stringLength * sizeof(WCHAR));
+
+    return !!key->data;
+}
+
+static BOOL layout_shape_get_cached_run(struct shaping_cache *cache, const struct shaping_cache_key *key,
+        struct shaping_context *context)
+{
+    struct regular_layout_run *run = context->run;
+    struct shaping_cache_entry *entry;
+    struct wine_rb_entry *e;
+    UINT32 count;
+
+    EnterCriticalSection(&cache->cs);
+
+    if (!(e = wine_rb_get(&cache->tree, key)))
+    {
+        cache->misses++;
+        LeaveCriticalSection(&cache->cs);
+        return FALSE;
+    }
+
+    entry = WINE_RB_ENTRY_VALUE(e, struct shaping_cache_entry, entry);
+    list_remove(&entry->mru);
+    list_add_head(&cache->mru, &entry->mru);
+    cache->hits++;
+
+    count = max(entry->glyph_count, 1);
+    run->clustermap = malloc(entry->length * sizeof(*run->clustermap));
+    run->glyphs = malloc(count * sizeof(*run->glyphs));
+    run->advances = malloc(count * sizeof(*run->advances));
+    run->offsets = malloc(count * sizeof(*run->offsets));
+    context->glyph_props = malloc(count * sizeof(*context->glyph_props));
+    if (run->clustermap && run->glyphs && run->advances && run->offsets && context->glyph_props)
+    {
+        memcpy(run->clustermap, entry->clustermap, entry->length * sizeof(*run->clustermap));
+        memcpy(run->glyphs, entry->glyphs, entry->glyph_count * sizeof(*run->glyphs));
+        memcpy(run->advances, entry->advances, entry->glyph_count * sizeof(*run->advances));
+        memcpy(run->offsets, entry->offsets, entry->glyph_count * sizeof(*run->offsets));
+        memcpy(context->glyph_props, entry->glyph_props, entry->glyph_count * sizeof(*context->glyph_props));
+        run->glyphcount = entry->glyph_count;
+    }
+    else
+    {
+        free(run->clustermap);
+        free(run->glyphs);
+        free(run->advances);
+        free(run->offsets);
+        free(context->glyph_props);
+        run->clustermap = run->glyphs = NULL;
+        run->advances = NULL;
+        run->offsets = NULL;
+        context->glyph_props = NULL;
+        e = NULL;
+    }
+
+    LeaveCriticalSection(&cache->cs);
+
+    if (!e) return FALSE;
+
+    run->run.glyphIndices = run->glyphs;
+    run->descr.clusterMap = run->clustermap;
+    run->run.glyphAdvances = run->advances;
+    run->run.glyphOffsets = run->offsets;
+
+    return TRUE;
+}
+
+static void layout_shape_cache_run(struct shaping_cache *cache, struct shaping_cache_key *key,
+        const struct shaping_context *context)
+{
+    const struct regular_layout_run *run = context->run;
+    struct dwrite_fontface *fontface = unsafe_impl_from_IDWriteFontFace(run->run.fontFace);
+    struct shaping_cache_entry *entry, *old_entry;
+    UINT32 length = run->descr.stringLength, count = run->glyphcount;
+    size_t size;
+    BYTE *ptr;
+
+    size = sizeof(*entry) + key->size + length * sizeof(*entry->clustermap) + count * (sizeof(*entry->glyphs) +
+            sizeof(*entry->glyph_props) + sizeof(*entry->advances) + sizeof(*entry->offsets));
+    if (size > SHAPING_CACHE_MAX_SIZE / 16) return;
+
+    if (!(entry = calloc(1, size - key->size))) return;
+
+    ptr = (BYTE *)(entry + 1);
+    entry->advances = (float *)ptr;
+    ptr += count * sizeof(*entry->advances);
+    entry->offsets = (DWRITE_GLYPH_OFFSET *)ptr;
+    ptr += count * sizeof(*entry->offsets);
+    entry->glyphs = (UINT16 *)ptr;
+    ptr += count * sizeof(*entry->glyphs);
+    entry->clustermap = (UINT16 *)ptr;
+    ptr += length * sizeof(*entry->clustermap);
+    entry->glyph_props = (DWRITE_SHAPING_GLYPH_PROPERTIES *)ptr;
+
+    memcpy(entry->advances, run->advances, count * sizeof(*entry->advances));
+    memcpy(entry->offsets, run->offsets, count * sizeof(*entry->offsets));
+    memcpy(entry->glyphs, run->glyphs, count * sizeof(*entry->glyphs));
+    memcpy(entry->clustermap, run->clustermap, length * sizeof(*entry->clustermap));
+    memcpy(entry->glyph_props, context->glyph_props, count * sizeof(*entry->glyph_props));
+    entry->length = length;
+    entry->glyph_count = count;
+    entry->size = size;
+
+    /* The key buffer is handed over to the entry. */
+    entry->key = *key;
+    key->data = NULL;
+    entry->file = fontface->file;
+    IDWriteFontFile_AddRef(entry->file);
+
+    EnterCriticalSection(&cache->cs);
+
+    while (cache->size + size > SHAPING_CACHE_MAX_SIZE && !list_empty(&cache->mru))
+    {
+        old_entry = LIST_ENTRY(list_tail(&cache->mru), struct shaping_cache_entry, mru);
+        cache->size -= old_entry->size;
+        wine_rb_remove(&cache->tree, &old_entry->entry);
+        list_remove(&old_entry->mru);
+        shaping_cache_release_entry(old_entry);
+    }
+
+    if (wine_rb_put(&cache->tree, &entry->key, &entry->entry) == -1)
+    {
+        /* Another thread has shaped the same run. */
+        LeaveCriticalSection(&cache->cs);
+        shaping_cache_release_entry(entry);
+        return;
+    }
+
+    list_add_head(&cache->mru, &entry->mru);
+    cache->size += size;
+
+    LeaveCriticalSection(&cache->cs);
+}
+
 static HRESULT layout_shape_run(struct dwrite_textlayout *layout, struct regular_layout_run *run)
 {
     struct shaping_context context = { 0 };
+    struct shaping_cache_key key = { 0 };
+    struct shaping_cache *cache;
     HRESULT hr;
 
     context.analyzer = get_text_analyzer();
     context.run = run;
 
-    if (SUCCEEDED(hr = layout_shape_get_glyphs(layout, &context)))
-        hr = layout_shape_get_positions(layout, &context);
+    run->descr.localeName = get_layout_range_by_pos(layout, run->descr.textPosition)->locale;
+
+    if (SUCCEEDED(hr = layout_shape_get_user_features(layout, &context)))
+    {
+        if (!(cache = factory_get_shaping_cache(layout->factory)) ||
+                !layout_shape_get_cache_key(layout, &context, &key) ||
+                !layout_shape_get_cached_run(cache, &key, &context))
+        {
+            if (SUCCEEDED(hr = layout_shape_get_glyphs(layout, &context)))
+                hr = layout_shape_get_positions(layout, &context);
+
+            if (SUCCEEDED(hr) && key.data)
+                layout_shape_cache_run(cache, &key, &context);
+        }
+    }
+
+    if (SUCCEEDED(hr))
+        hr = layout_shape_apply_character_spacing(layout, &context);
 
+    free(key.data);
     layout_shape_clear_context(&context);
 
     /* Special treatment for runs that don't produce visual output, shaping code adds normal glyphs for them,
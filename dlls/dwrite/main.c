@@ -608,6 +608,8 @@ struct dwritefactory
     struct list collection_loaders;
     struct list file_loaders;
 
+    struct shaping_cache *shaping_cache;
+
     CRITICAL_SECTION cs;
 };
 
@@ -663,6 +665,8 @@ static void release_dwritefactory(struct dwritefactory *factory)
         IDWriteFontCollection1_Release(factory->eudc_collection);
     if (factory->fallback)
         release_system_fontfallback(factory->fallback);
+    if (factory->shaping_cache)
+        release_shaping_cache(factory->shaping_cache);
 
     factory->cs.DebugInfo->Spare[0] = 0;
     DeleteCriticalSection(&factory->cs);
@@ -2101,6 +2105,20 @@ static void init_dwritefactory(struct dwritefactory *factory, DWRITE_FACTORY_TYP
     factory->cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": dwritefactory.lock");
 }
 
+struct shaping_cache *factory_get_shaping_cache(IDWriteFactory7 *iface)
+{
+    struct dwritefactory *factory = impl_from_IDWriteFactory7(iface);
+    struct shaping_cache *cache;
+
+    EnterCriticalSection(&factory->cs);
+    if (!factory->shaping_cache)
+        factory->shaping_cache = create_shaping_cache();
+    cache = factory->shaping_cache;
+    LeaveCriticalSection(&factory->cs);
+
+    return cache;
+}
+
 void factory_detach_fontcollection(IDWriteFactory7 *iface, IDWriteFontCollection3 *collection)
 {
     struct dwritefactory *factory = impl_from_IDWriteFactory7(iface);
@@ -7052,6 +7052,155 @@ if (SUCCEEDED(hr))
     IDWriteFactory_Release(factory);
 }
 
+enum layout_change
+{
+    LAYOUT_CHANGE_NONE,
+    LAYOUT_CHANGE_FONT_SIZE,
+    LAYOUT_CHANGE_FEATURES,
+    LAYOUT_CHANGE_LOCALE,
+};
+
+static void get_changed_layout_metrics(IDWriteFactory *factory, const WCHAR *text, enum layout_change change,
+        DWRITE_TEXT_METRICS *metrics, DWRITE_CLUSTER_METRICS *clusters, UINT32 *count)
+{
+    DWRITE_TEXT_RANGE range = { 0, ~0u };
+    DWRITE_FONT_FEATURE feature;
+    IDWriteTypography *typography;
+    IDWriteTextFormat *format;
+    IDWriteTextLayout *layout;
+    HRESULT hr;
+
+    hr = IDWriteFactory_CreateTextFormat(factory, L"Tahoma", NULL, DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE_NORMAL,
+            DWRITE_FONT_STRETCH_NORMAL, 12.0f, L"en-us", &format);
+    ok(hr == S_OK, "Failed to create text format, hr %#lx.\n", hr);
+
+    hr = IDWriteFactory_CreateTextLayout(factory, text, wcslen(text), format, 500.0f, 100.0f, &layout);
+    ok(hr == S_OK, "Failed to create text layout, hr %#lx.\n", hr);
+
+    switch (change)
+    {
+        case LAYOUT_CHANGE_NONE:
+            break;
+        case LAYOUT_CHANGE_FONT_SIZE:
+            hr = IDWriteTextLayout_SetFontSize(layout, 24.0f, range);
+            ok(hr == S_OK, "Failed to set font size, hr %#lx.\n", hr);
+            break;
+        case LAYOUT_CHANGE_FEATURES:
+            hr = IDWriteFactory_CreateTypography(factory, &typography);
+            ok(hr == S_OK, "Failed to create typography, hr %#lx.\n", hr);
+            feature.nameTag = DWRITE_FONT_FEATURE_TAG_KERNING;
+            feature.parameter = 0;
+            hr = IDWriteTypography_AddFontFeature(typography, feature);
+            ok(hr == S_OK, "Failed to add font feature, hr %#lx.\n", hr);
+            hr = IDWriteTextLayout_SetTypography(layout, typography, range);
+            ok(hr == S_OK, "Failed to set typography, hr %#lx.\n", hr);
+            IDWriteTypography_Release(typography);
+            break;
+        case LAYOUT_CHANGE_LOCALE:
+            hr = IDWriteTextLayout_SetLocaleName(layout, L"tr-tr", range);
+            ok(hr == S_OK, "Failed to set locale name, hr %#lx.\n", hr);
+            break;
+    }
+
+    hr = IDWriteTextLayout_GetMetrics(layout, metrics);
+    ok(hr == S_OK, "Failed to get layout metrics, hr %#lx.\n", hr);
+    hr = IDWriteTextLayout_GetClusterMetrics(layout, clusters, 64, count);
+    ok(hr == S_OK, "Failed to get cluster metrics, hr %#lx.\n", hr);
+
+    IDWriteTextLayout_Release(layout);
+    IDWriteTextFormat_Release(format);
+}
+
+static void test_repeated_layouts(void)
+{
+    static const WCHAR *strings[] =
+    {
+        L"OK",
+        L"Cancel",
+        L"File Edit View Help",
+        L"abc \x5d0\x5d1\x5d2 def",
+        L"The quick brown fox jumps over the lazy dog.",
+    };
+    DWRITE_CLUSTER_METRICS expected[ARRAY_SIZE(strings)][64], clusters[64];
+    DWRITE_TEXT_METRICS expected_metrics[ARRAY_SIZE(strings)], metrics;
+    UINT32 expected_count[ARRAY_SIZE(strings)], count;
+    static const WCHAR kerning_text[] = L"AVATAR To Wa";
+    IDWriteFactory *factory, *reference_factory;
+    IDWriteTextFormat *format;
+    IDWriteTextLayout *layout;
+    unsigned int i, j, length;
+    DWORD start;
+    HRESULT hr;
+
+    factory = create_factory();
+
+    hr = IDWriteFactory_CreateTextFormat(factory, L"Tahoma", NULL, DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE_NORMAL,
+            DWRITE_FONT_STRETCH_NORMAL, 12.0f, L"en-us", &format);
+    ok(hr == S_OK, "Failed to create text format, hr %#lx.\n", hr);
+
+    /* Layouts for the same text are expected to give the same results, whether shaping is done again or not. */
+    start = GetTickCount();
+    for (i = 0; i < 10000; ++i)
+    {
+        j = i % ARRAY_SIZE(strings);
+        length = wcslen(strings[j]);
+
+        hr = IDWriteFactory_CreateTextLayout(factory, strings[j], length, format, 500.0f, 100.0f, &layout);
+        ok(hr == S_OK, "Failed to create text layout, hr %#lx.\n", hr);
+
+        hr = IDWriteTextLayout_GetMetrics(layout, &metrics);
+        ok(hr == S_OK, "Failed to get layout metrics, hr %#lx.\n", hr);
+        hr = IDWriteTextLayout_GetClusterMetrics(layout, clusters, ARRAY_SIZE(clusters), &count);
+        ok(hr == S_OK, "Failed to get cluster metrics, hr %#lx.\n", hr);
+
+        if (i < ARRAY_SIZE(strings))
+        {
+            expected_metrics[j] = metrics;
+            expected_count[j] = count;
+            memcpy(expected[j], clusters, count * sizeof(*clusters));
+        }
+        else if (memcmp(&metrics, &expected_metrics[j], sizeof(metrics)) || count != expected_count[j] ||
+                memcmp(clusters, expected[j], count * sizeof(*clusters)))
+        {
+            ok(0, "Unexpected metrics for layout %u, string %s.\n", i, wine_dbgstr_w(strings[j]));
+            IDWriteTextLayout_Release(layout);
+            break;
+        }
+
+        IDWriteTextLayout_Release(layout);
+    }
+    trace("Created %u layouts in %lu ms.\n", i, GetTickCount() - start);
+
+    /* Layouts that only differ by font size, features or locale must not reuse the cached runs. Compare them
+       to the results of a new factory, where nothing is cached yet. */
+    get_changed_layout_metrics(factory, kerning_text, LAYOUT_CHANGE_NONE, &expected_metrics[0], expected[0], &expected_count[0]);
+    for (i = LAYOUT_CHANGE_FONT_SIZE; i <= LAYOUT_CHANGE_LOCALE; ++i)
+    {
+        winetest_push_context("change %u", i);
+
+        get_changed_layout_metrics(factory, kerning_text, i, &metrics, clusters, &count);
+        reference_factory = create_factory();
+        get_changed_layout_metrics(reference_factory, kerning_text, i, &expected_metrics[1], expected[1], &expected_count[1]);
+        IDWriteFactory_Release(reference_factory);
+
+        ok(!memcmp(&metrics, &expected_metrics[1], sizeof(metrics)), "Unexpected layout metrics.\n");
+        ok(count == expected_count[1], "Unexpected cluster count %u.\n", count);
+        ok(!memcmp(clusters, expected[1], count * sizeof(*clusters)), "Unexpected cluster metrics.\n");
+        if (i == LAYOUT_CHANGE_FONT_SIZE)
+        {
+            ok(metrics.width > expected_metrics[0].width * 1.5f, "Unexpected width %.8e, 12pt width %.8e.\n",
+                    metrics.width, expected_metrics[0].width);
+            ok(clusters[0].width > expected[0][0].width, "Unexpected cluster width %.8e, 12pt width %.8e.\n",
+                    clusters[0].width, expected[0][0].width);
+        }
+
+        winetest_pop_context();
+    }
+
+    IDWriteTextFormat_Release(format);
+    IDWriteFactory_Release(factory);
+}
+
 START_TEST(layout)
 {
     IDWriteFactory *factory;
@@ -7108,6 +7257,7 @@ START_TEST(layout)
     test_text_format_axes();
     test_layout_range_length();
     test_HitTestTextRange();
+    test_repeated_layouts();
 
     IDWriteFactory_Release(factory);
 }
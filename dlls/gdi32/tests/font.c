@@ -7964,6 +7964,256 @@ done:
     DeleteDC(hdc);
 }
 
+static INT CALLBACK count_font_proc(const LOGFONTA *elf, const TEXTMETRICA *ntm, DWORD type, LPARAM lParam)
+{
+    (*(DWORD *)lParam)++;
+    return 1;
+}
+
+static DWORD count_fonts(void)
+{
+    LOGFONTA lf;
+    DWORD count = 0;
+    HDC hdc = GetDC(0);
+
+    memset(&lf, 0, sizeof(lf));
+    lf.lfCharSet = DEFAULT_CHARSET;
+    EnumFontFamiliesExA(hdc, &lf, count_font_proc, (LPARAM)&count, 0);
+    ReleaseDC(0, hdc);
+    return count;
+}
+
+static void test_font_list_startup(void)
+{
+    char path_name[MAX_PATH], **argv;
+    PROCESS_INFORMATION info;
+    STARTUPINFOA startup;
+    DWORD i, start, count, expect = count_fonts();
+
+    winetest_get_mainargs(&argv);
+    sprintf(path_name, "%s font font_list", argv[0]);
+
+    /* every process should see the same font list, whether it scanned the
+       font directories or not */
+    for (i = 0; i < 3; i++)
+    {
+        memset(&startup, 0, sizeof(startup));
+        startup.cb = sizeof(startup);
+        start = GetTickCount();
+        ok(CreateProcessA(NULL, path_name, NULL, NULL, FALSE, 0, NULL, NULL, &startup, &info),
+            "CreateProcess failed.\n");
+        WaitForSingleObject(info.hProcess, INFINITE);
+        ok(GetExitCodeProcess(info.hProcess, &count), "GetExitCodeProcess failed.\n");
+        ok(count == expect, "got %lu fonts, expected %lu\n", count, expect);
+        trace("process %lu: %lu fonts, %lu ms\n", i, count, GetTickCount() - start);
+        CloseHandle(info.hProcess);
+        CloseHandle(info.hThread);
+    }
+}
+
+static DWORD run_font_child(const char *args)
+{
+    char path_name[MAX_PATH], **argv;
+    PROCESS_INFORMATION info;
+    STARTUPINFOA startup;
+    DWORD ret = ~0u;
+
+    winetest_get_mainargs(&argv);
+    sprintf(path_name, "%s font %s", argv[0], args);
+    memset(&startup, 0, sizeof(startup));
+    startup.cb = sizeof(startup);
+    ok(CreateProcessA(NULL, path_name, NULL, NULL, FALSE, 0, NULL, NULL, &startup, &info),
+        "CreateProcess failed.\n");
+    WaitForSingleObject(info.hProcess, INFINITE);
+    ok(GetExitCodeProcess(info.hProcess, &ret), "GetExitCodeProcess failed.\n");
+    CloseHandle(info.hProcess);
+    CloseHandle(info.hThread);
+    return ret;
+}
+
+static void test_font_list_dir_change(void)
+{
+    char path[MAX_PATH];
+    DWORD size, written, count, expect;
+    void *data;
+    HANDLE file;
+    BOOL ret;
+
+    /* Windows only loads the fonts listed in the registry */
+    if (!winetest_platform_is_wine)
+    {
+        skip("Font directories are not scanned.\n");
+        return;
+    }
+
+    expect = run_font_child("font_list");
+    ok(!run_font_child("font_installed wine_test"), "wine_test is already installed.\n");
+
+    data = get_res_data("wine_test.ttf", &size);
+    ok(!!data, "Failed to get resource.\n");
+    GetWindowsDirectoryA(path, MAX_PATH);
+    strcat(path, "\\fonts\\wine_catalog_test.ttf");
+    file = CreateFileA(path, GENERIC_WRITE, 0, NULL, CREATE_NEW, 0, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        skip("Failed to create %s, error %lu.\n", path, GetLastError());
+        return;
+    }
+    ret = WriteFile(file, data, size, &written, NULL);
+    ok(ret && written == size, "WriteFile failed, error %lu.\n", GetLastError());
+    CloseHandle(file);
+
+    /* the catalog saved by the previous processes is stale once the directory changed */
+    ok(run_font_child("font_installed wine_test"), "wine_test is not installed.\n");
+    count = run_font_child("font_list");
+    ok(count > expect, "got %lu fonts, expected more than %lu\n", count, expect);
+
+    ret = DeleteFileA(path);
+    ok(ret, "DeleteFile failed, error %lu.\n", GetLastError());
+
+    ok(!run_font_child("font_installed wine_test"), "wine_test is still installed.\n");
+    count = run_font_child("font_list");
+    ok(count == expect, "got %lu fonts, expected %lu\n", count, expect);
+}
+
+static DWORD render_glyph_hash(void)
+{
+    static const BYTE qualities[] = {NONANTIALIASED_QUALITY, ANTIALIASED_QUALITY};
+    static const char text[] = "The quick brown fox jumps over the lazy dog";
+    RECT r = {0, 0, 512, 64};
+    HBITMAP hbmp, hbmpprev;
+    DWORD i, hash = 2166136261u;
+    BITMAPINFO bmi;
+    HFONT hfont;
+    LOGFONTA lf;
+    BYTE *data;
+    HDC hdc;
+
+    hdc = CreateCompatibleDC(0);
+    memset(&bmi, 0, sizeof(bmi));
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biWidth = r.right;
+    bmi.bmiHeader.biHeight = r.bottom;
+    bmi.bmiHeader.biCompression = BI_RGB;
+    hbmp = CreateDIBSection(hdc, &bmi, DIB_RGB_COLORS, (void **)&data, NULL, 0);
+    hbmpprev = SelectObject(hdc, hbmp);
+    FillRect(hdc, &r, GetStockObject(WHITE_BRUSH));
+
+    memset(&lf, 0, sizeof(lf));
+    strcpy(lf.lfFaceName, "Arial");
+    lf.lfHeight = 24;
+    for (i = 0; i < ARRAY_SIZE(qualities); i++)
+    {
+        lf.lfQuality = qualities[i];
+        hfont = SelectObject(hdc, CreateFontIndirectA(&lf));
+        TextOutA(hdc, 0, i * 32, text, strlen(text));
+        DeleteObject(SelectObject(hdc, hfont));
+    }
+
+    for (i = 0; i < r.right * r.bottom * 4; i++) hash = (hash ^ data[i]) * 16777619;
+
+    SelectObject(hdc, hbmpprev);
+    DeleteObject(hbmp);
+    DeleteDC(hdc);
+    return hash;
+}
+
+static void test_shared_glyph_cache_child(const char *arg)
+{
+    HANDLE ready, done;
+    DWORD hash = render_glyph_hash();
+
+    if (!strcmp(arg, "hold"))
+    {
+        ready = OpenEventA(EVENT_ALL_ACCESS, FALSE, "wine_test_glyph_cache_ready");
+        done = OpenEventA(EVENT_ALL_ACCESS, FALSE, "wine_test_glyph_cache_done");
+        SetEvent(ready);
+        WaitForSingleObject(done, INFINITE);
+        CloseHandle(ready);
+        CloseHandle(done);
+    }
+    ExitProcess(hash);
+}
+
+static HANDLE run_shared_glyph_child(const char *arg)
+{
+    char path_name[MAX_PATH], **argv;
+    PROCESS_INFORMATION info;
+    STARTUPINFOA startup;
+
+    winetest_get_mainargs(&argv);
+    sprintf(path_name, "%s font shared_glyph %s", argv[0], arg);
+    memset(&startup, 0, sizeof(startup));
+    startup.cb = sizeof(startup);
+    if (!CreateProcessA(NULL, path_name, NULL, NULL, FALSE, 0, NULL, NULL, &startup, &info))
+        return NULL;
+    CloseHandle(info.hThread);
+    return info.hProcess;
+}
+
+static DWORD wait_shared_glyph_child(HANDLE process)
+{
+    DWORD code = 0;
+
+    ok(WaitForSingleObject(process, 30000) == WAIT_OBJECT_0, "child didn't exit\n");
+    GetExitCodeProcess(process, &code);
+    CloseHandle(process);
+    return code;
+}
+
+static void test_shared_glyph_cache(void)
+{
+    /* offset and size of the glyph data area in the Wine shared glyph cache */
+    static const SIZE_T data_offset = 16 * sizeof(LONG) + 0x10000 * 24, data_size = 32 * 1024 * 1024;
+    DWORD expect = render_glyph_hash(), hash;
+    HANDLE ready, done, holder, child, mapping;
+    BYTE *ptr;
+
+    if (!is_truetype_font_installed("Arial"))
+    {
+        skip("Arial is not installed\n");
+        return;
+    }
+
+    ready = CreateEventA(NULL, TRUE, FALSE, "wine_test_glyph_cache_ready");
+    done = CreateEventA(NULL, TRUE, FALSE, "wine_test_glyph_cache_done");
+    SetEnvironmentVariableA("WINE_SHARED_GLYPH_CACHE", "1");
+
+    /* the first child fills the cache and keeps it mapped until we're done */
+    holder = run_shared_glyph_child("hold");
+    ok(!!holder, "CreateProcess failed.\n");
+    ok(!WaitForSingleObject(ready, 30000), "child didn't start\n");
+
+    /* this one renders from the cached glyphs */
+    child = run_shared_glyph_child("");
+    hash = wait_shared_glyph_child(child);
+    ok(hash == expect, "got hash %#lx, expected %#lx\n", hash, expect);
+
+    /* another process may write anything to the cache, including bogus glyph metrics */
+    mapping = OpenFileMappingA(FILE_MAP_WRITE, FALSE, "Global\\__wine_glyph_cache");
+    if (mapping && (ptr = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0)))
+    {
+        memset(ptr + data_offset, 0xff, data_size);
+        UnmapViewOfFile(ptr);
+
+        child = run_shared_glyph_child("");
+        hash = wait_shared_glyph_child(child);
+        ok(hash == expect, "got hash %#lx, expected %#lx\n", hash, expect);
+    }
+    else win_skip("shared glyph cache not available\n");
+    if (mapping) CloseHandle(mapping);
+
+    SetEvent(done);
+    hash = wait_shared_glyph_child(holder);
+    ok(hash == expect, "got hash %#lx, expected %#lx\n", hash, expect);
+
+    SetEnvironmentVariableA("WINE_SHARED_GLYPH_CACHE", NULL);
+    CloseHandle(ready);
+    CloseHandle(done);
+}
+
 START_TEST(font)
 {
     static const char *test_names[] =
@@ -7982,6 +8232,12 @@ START_TEST(font)
     {
         if (!strcmp(argv[2], "AddFontMemResource"))
             test_AddFontMemResource();
+        else if (!strcmp(argv[2], "font_list"))
+            ExitProcess(count_fonts());
+        else if (!strcmp(argv[2], "font_installed") && argc >= 4)
+            ExitProcess(is_font_installed(argv[3]));
+        else if (!strcmp(argv[2], "shared_glyph"))
+            test_shared_glyph_cache_child(argc >= 4 ? argv[3] : "");
         return;
     }
 
@@ -8055,6 +8311,9 @@ START_TEST(font)
     test_select_object();
     test_font_weight();
     test_text_out_fill();
+    test_font_list_startup();
+    test_font_list_dir_change();
+    test_shared_glyph_cache();
 
     /* These tests should be last test until RemoveFontResource
      * is properly implemented.
@@ -1161,23 +1161,17 @@ static void test_CopyFileEx(void)
     ok(hfile != INVALID_HANDLE_VALUE, "failed to open destination file, error %ld\n", GetLastError());
     SetLastError(0xdeadbeef);
     retok = CopyFileExA(source, dest, copy_progress_cb, hfile, NULL, 0);
-    todo_wine
     ok(!retok, "CopyFileExA unexpectedly succeeded\n");
-    todo_wine
     ok(GetLastError() == ERROR_REQUEST_ABORTED, "expected ERROR_REQUEST_ABORTED, got %ld\n", GetLastError());
     ok(GetFileAttributesA(dest) != INVALID_FILE_ATTRIBUTES, "file was deleted\n");
 
     hfile = CreateFileA(dest, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_WRITE | FILE_SHARE_DELETE,
                         NULL, OPEN_EXISTING, 0, 0);
-    todo_wine
     ok(hfile != INVALID_HANDLE_VALUE, "failed to open destination file, error %ld\n", GetLastError());
     SetLastError(0xdeadbeef);
     retok = CopyFileExA(source, dest, copy_progress_cb, hfile, NULL, 0);
-    todo_wine
     ok(!retok, "CopyFileExA unexpectedly succeeded\n");
-    todo_wine
     ok(GetLastError() == ERROR_REQUEST_ABORTED, "expected ERROR_REQUEST_ABORTED, got %ld\n", GetLastError());
-    todo_wine
     ok(GetFileAttributesA(dest) == INVALID_FILE_ATTRIBUTES, "file was not deleted\n");
 
     retok = CopyFileExA(source, NULL, copy_progress_cb, hfile, NULL, 0);
@@ -1193,6 +1187,94 @@ static void test_CopyFileEx(void)
     ok(!ret, "DeleteFileA unexpectedly succeeded\n");
 }
 
+struct copy_progress
+{
+    unsigned int calls;
+    LONGLONG total_size;
+    LONGLONG transferred;
+};
+
+static DWORD WINAPI copy_progress_size_cb(LARGE_INTEGER total_size, LARGE_INTEGER total_transferred,
+                                          LARGE_INTEGER stream_size, LARGE_INTEGER stream_transferred,
+                                          DWORD stream, DWORD reason, HANDLE source, HANDLE dest, LPVOID userdata)
+{
+    struct copy_progress *progress = userdata;
+
+    if (!progress->calls++)
+        ok(reason == CALLBACK_STREAM_SWITCH, "expected CALLBACK_STREAM_SWITCH, got %lu\n", reason);
+    else
+        ok(reason == CALLBACK_CHUNK_FINISHED, "expected CALLBACK_CHUNK_FINISHED, got %lu\n", reason);
+    ok(total_transferred.QuadPart >= progress->transferred, "transferred size went back from %s to %s\n",
+       wine_dbgstr_longlong(progress->transferred), wine_dbgstr_longlong(total_transferred.QuadPart));
+    ok(total_transferred.QuadPart <= total_size.QuadPart, "transferred %s of %s\n",
+       wine_dbgstr_longlong(total_transferred.QuadPart), wine_dbgstr_longlong(total_size.QuadPart));
+    progress->total_size = total_size.QuadPart;
+    progress->transferred = total_transferred.QuadPart;
+    return PROGRESS_CONTINUE;
+}
+
+static void test_CopyFileEx_progress(void)
+{
+    static const DWORD file_size = 9 * 1024 * 1024 + 123;
+    char temp_path[MAX_PATH], source[MAX_PATH], dest[MAX_PATH];
+    struct copy_progress progress = {0};
+    unsigned char *data, *copy;
+    DWORD ret, count, i, start;
+    HANDLE hfile;
+    BOOL retok;
+
+    GetTempPathA(MAX_PATH, temp_path);
+    ret = GetTempFileNameA(temp_path, "pfx", 0, source);
+    ok(ret != 0, "GetTempFileNameA error %ld\n", GetLastError());
+    ret = GetTempFileNameA(temp_path, "pfx", 0, dest);
+    ok(ret != 0, "GetTempFileNameA error %ld\n", GetLastError());
+
+    data = HeapAlloc(GetProcessHeap(), 0, file_size);
+    copy = HeapAlloc(GetProcessHeap(), 0, file_size);
+    for (i = 0; i < file_size; i++) data[i] = i * 7 + (i >> 12);
+
+    hfile = CreateFileA(source, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, 0);
+    ok(hfile != INVALID_HANDLE_VALUE, "failed to open source file, error %ld\n", GetLastError());
+    retok = WriteFile(hfile, data, file_size, &count, NULL);
+    ok(retok && count == file_size, "WriteFile failed, error %ld\n", GetLastError());
+    CloseHandle(hfile);
+
+    start = GetTickCount();
+    retok = CopyFileExA(source, dest, copy_progress_size_cb, &progress, NULL, 0);
+    ok(retok, "CopyFileExA failed, error %ld\n", GetLastError());
+    trace("copied %lu bytes in %lu ms\n", file_size, GetTickCount() - start);
+    ok(progress.calls >= 2, "got %u progress calls\n", progress.calls);
+    ok(progress.total_size == file_size, "got total size %s\n", wine_dbgstr_longlong(progress.total_size));
+    ok(progress.transferred == file_size, "got transferred %s\n", wine_dbgstr_longlong(progress.transferred));
+
+    hfile = CreateFileA(dest, GENERIC_READ, 0, NULL, OPEN_EXISTING, 0, 0);
+    ok(hfile != INVALID_HANDLE_VALUE, "failed to open destination file, error %ld\n", GetLastError());
+    ok(GetFileSize(hfile, NULL) == file_size, "got size %lu\n", GetFileSize(hfile, NULL));
+    retok = ReadFile(hfile, copy, file_size, &count, NULL);
+    ok(retok && count == file_size, "ReadFile failed, error %ld\n", GetLastError());
+    ok(!memcmp(data, copy, file_size), "data differs\n");
+    CloseHandle(hfile);
+
+    /* many small files */
+    hfile = CreateFileA(source, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, 0);
+    ok(hfile != INVALID_HANDLE_VALUE, "failed to open source file, error %ld\n", GetLastError());
+    WriteFile(hfile, data, 4096 + 17, &count, NULL);
+    CloseHandle(hfile);
+
+    start = GetTickCount();
+    for (i = 0; i < 200; i++)
+    {
+        retok = CopyFileA(source, dest, FALSE);
+        ok(retok, "CopyFileA failed, error %ld\n", GetLastError());
+    }
+    trace("copied 200 small files in %lu ms\n", GetTickCount() - start);
+
+    HeapFree(GetProcessHeap(), 0, data);
+    HeapFree(GetProcessHeap(), 0, copy);
+    DeleteFileA(source);
+    DeleteFileA(dest);
+}
+
 /*
  *   Debugging routine to dump a buffer in a hexdump-like fashion.
  */
@@ -6244,6 +6326,7 @@ START_TEST(file)
     test_CopyFileW();
     test_CopyFile2();
     test_CopyFileEx();
+    test_CopyFileEx_progress();
     test_CreateFile();
     test_CreateFileA();
     test_CreateFileW();
@@ -28,6 +28,7 @@
 #include "winbase.h"
 #include "winreg.h"
 #include "winternl.h"
+#include "wine/heap_stats.h"
 #include "wine/test.h"
 
 /* some undocumented flags (names are made up) */
@@ -427,6 +428,24 @@ static void test_HeapCreate(void)
     ret = HeapFree( heap, 0, ptr1 );
     ok( ret, "HeapFree failed, error %lu\n", GetLastError() );
 
+    /* growing a large block keeps its contents, whether it is moved or not */
+    ptr = HeapAlloc( heap, 0, 1 << 20 );
+    ok( !!ptr, "HeapAlloc failed, error %lu\n", GetLastError() );
+    memset( ptr, 0x55, 1 << 20 );
+    for (size = 2 << 20; size <= (32 << 20); size += 3 << 19)
+    {
+        ptr1 = HeapReAlloc( heap, HEAP_ZERO_MEMORY, ptr, size );
+        ok( !!ptr1, "HeapReAlloc failed, error %lu\n", GetLastError() );
+        if (!ptr1) break;
+        ptr = ptr1;
+        ok( HeapSize( heap, 0, ptr ) == size, "HeapSize returned %#Ix\n", HeapSize( heap, 0, ptr ) );
+        ok( ptr[(1 << 20) - 1] == 0x55, "got %#x\n", ptr[(1 << 20) - 1] );
+        ok( !ptr[size - 1], "got %#x\n", ptr[size - 1] );
+        ptr[size - 1] = 0xaa;
+    }
+    ret = HeapFree( heap, 0, ptr );
+    ok( ret, "HeapFree failed, error %lu\n", GetLastError() );
+
     ret = HeapDestroy( heap );
     ok( ret, "HeapDestroy failed, error %lu\n", GetLastError() );
 
@@ -3727,6 +3746,206 @@ static void test_heap_sizes(void)
     test_heap_size( 0x150000 );
 }
 
+static void get_heap_statistics( HANDLE heap, HEAP_WINE_STATISTICS *stats, SIZE_T size )
+{
+    BOOL ret;
+
+    ret = pHeapQueryInformation( heap, HeapWineStatistics, stats, size, NULL );
+    ok( ret, "HeapQueryInformation failed, error %lu\n", GetLastError() );
+}
+
+static ULONG64 get_bin_allocations( const HEAP_WINE_STATISTICS *stats )
+{
+    ULONG64 count = 0;
+    ULONG i;
+
+    for (i = 0; i < stats->BinCount; i++) count += stats->Bins[i].Allocations;
+    return count;
+}
+
+static ULONG64 get_bin_frees( const HEAP_WINE_STATISTICS *stats )
+{
+    ULONG64 count = 0;
+    ULONG i;
+
+    for (i = 0; i < stats->BinCount; i++) count += stats->Bins[i].Frees;
+    return count;
+}
+
+static void test_heap_statistics(void)
+{
+    HEAP_WINE_STATISTICS *stats, *prev;
+    SIZE_T size;
+    HANDLE heap;
+    void *ptr, *large;
+    BOOL ret;
+
+    heap = HeapCreate( HEAP_GROWABLE, 0, 0 );
+    ok( !!heap, "HeapCreate failed, error %lu\n", GetLastError() );
+
+    size = 0;
+    SetLastError( 0xdeadbeef );
+    ret = pHeapQueryInformation( heap, HeapWineStatistics, NULL, 0, &size );
+    if (!ret && GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+    {
+        win_skip( "HeapWineStatistics not supported\n" );
+        HeapDestroy( heap );
+        return;
+    }
+    ok( !ret, "HeapQueryInformation succeeded\n" );
+    ok( size >= sizeof(*stats), "got size %Iu\n", size );
+
+    stats = malloc( size );
+    prev = malloc( size );
+
+    get_heap_statistics( heap, prev, size );
+    ok( prev->ReservedSize >= prev->CommittedSize, "got reserved %#Ix, committed %#Ix\n",
+        prev->ReservedSize, prev->CommittedSize );
+    ok( prev->CommittedSize >= prev->FreeSize, "got committed %#Ix, free %#Ix\n",
+        prev->CommittedSize, prev->FreeSize );
+
+    ptr = HeapAlloc( heap, 0, 24 );
+    ok( !!ptr, "HeapAlloc failed\n" );
+    large = HeapAlloc( heap, 0, 0x400000 );
+    ok( !!large, "HeapAlloc failed\n" );
+
+    get_heap_statistics( heap, stats, size );
+    ok( stats->LargeBlockCount == prev->LargeBlockCount + 1, "got %lu large blocks\n", stats->LargeBlockCount );
+    ok( stats->LargeBlocksSize >= prev->LargeBlocksSize + 0x400000, "got large size %#Ix\n", stats->LargeBlocksSize );
+    /* the address space reserved after large blocks is accounted as reserved */
+    ok( stats->ReservedSize - prev->ReservedSize >= (sizeof(void *) == 8 ? 2 : 1) * 0x400000,
+        "got reserved size %#Ix, previous %#Ix\n", stats->ReservedSize, prev->ReservedSize );
+    ok( stats->ReservedSize >= stats->CommittedSize, "got reserved %#Ix, committed %#Ix\n",
+        stats->ReservedSize, stats->CommittedSize );
+
+    /* an in place realloc is counted as a free and an allocation, possibly in another bin */
+    ptr = HeapReAlloc( heap, HEAP_REALLOC_IN_PLACE_ONLY, ptr, 0x200 );
+    ok( !!ptr, "HeapReAlloc failed\n" );
+    HeapFree( heap, 0, ptr );
+    HeapFree( heap, 0, large );
+
+    get_heap_statistics( heap, stats, size );
+    ok( stats->StandardAllocations - prev->StandardAllocations == 2, "got %I64u allocations\n",
+        stats->StandardAllocations - prev->StandardAllocations );
+    ok( stats->StandardFrees - prev->StandardFrees == 2, "got %I64u frees\n",
+        stats->StandardFrees - prev->StandardFrees );
+    ok( stats->LargeAllocations - prev->LargeAllocations == 1, "got %I64u large allocations\n",
+        stats->LargeAllocations - prev->LargeAllocations );
+    ok( stats->LargeFrees - prev->LargeFrees == 1, "got %I64u large frees\n",
+        stats->LargeFrees - prev->LargeFrees );
+    ok( stats->InPlaceReallocations - prev->InPlaceReallocations == 1, "got %I64u in place reallocations\n",
+        stats->InPlaceReallocations - prev->InPlaceReallocations );
+    ok( stats->LargeBlockCount == prev->LargeBlockCount, "got %lu large blocks\n", stats->LargeBlockCount );
+
+    ok( stats->BinCount, "got no bins\n" );
+    ok( get_bin_allocations( stats ) - get_bin_allocations( prev ) == 2, "got %I64u bin allocations\n",
+        get_bin_allocations( stats ) - get_bin_allocations( prev ) );
+    ok( get_bin_frees( stats ) - get_bin_frees( prev ) == 2, "got %I64u bin frees\n",
+        get_bin_frees( stats ) - get_bin_frees( prev ) );
+
+    free( prev );
+    free( stats );
+    HeapDestroy( heap );
+}
+
+static DWORD WINAPI thread_cache_free_thread( void *arg )
+{
+    void **ptrs = arg;
+    UINT i;
+
+    for (i = 0; i < 64; i++) HeapFree( ptrs[64], 0, ptrs[i] );
+    return 0;
+}
+
+static void test_child_thread_cache(void)
+{
+    ULONG compat_info = 2;
+    void *ptrs[65], *ptr;
+    DWORD index;
+    HANDLE heap, thread;
+    UINT i, j;
+    BOOL ret;
+
+    index = TlsAlloc();
+    ok( index != TLS_OUT_OF_INDEXES, "TlsAlloc failed, error %lu\n", GetLastError() );
+    TlsSetValue( index, (void *)0xdeadbeef );
+
+    heap = HeapCreate( HEAP_GROWABLE, 0, 0 );
+    ok( !!heap, "HeapCreate failed, error %lu\n", GetLastError() );
+    ret = pHeapSetInformation( heap, HeapCompatibilityInformation, &compat_info, sizeof(compat_info) );
+    ok( ret, "HeapSetInformation failed, error %lu\n", GetLastError() );
+
+    /* blocks freed and reallocated on the same thread are never handed out twice */
+    for (j = 0; j < 16; j++)
+    {
+        for (i = 0; i < 64; i++)
+        {
+            ptrs[i] = HeapAlloc( heap, 0, 0x20 );
+            ok( !!ptrs[i], "HeapAlloc failed\n" );
+            memset( ptrs[i], i, 0x20 );
+        }
+        for (i = 0; i < 64; i += 2) HeapFree( heap, 0, ptrs[i] );
+        for (i = 0; i < 64; i += 2) ptrs[i] = HeapAlloc( heap, 0, 0x20 );
+        for (i = 0; i < 64; i += 2) memset( ptrs[i], i, 0x20 );
+        for (i = 1; i < 64; i += 2)
+        {
+            unsigned char *data = ptrs[i];
+            UINT k;
+
+            for (k = 0; k < 0x20; k++) if (data[k] != i) break;
+            ok( k == 0x20, "block %u overwritten\n", i );
+        }
+        for (i = 0; i < 64; i++) HeapFree( heap, 0, ptrs[i] );
+    }
+    ok( HeapValidate( heap, 0, NULL ), "HeapValidate failed\n" );
+
+    /* blocks allocated on a thread and freed on another one */
+    for (i = 0; i < 64; i++) ptrs[i] = HeapAlloc( heap, 0, 0x20 );
+    ptrs[64] = heap;
+    thread = CreateThread( NULL, 0, thread_cache_free_thread, ptrs, 0, NULL );
+    ok( !WaitForSingleObject( thread, 5000 ), "wait failed\n" );
+    CloseHandle( thread );
+    ok( HeapValidate( heap, 0, NULL ), "HeapValidate failed\n" );
+
+    /* destroying a heap with cached blocks */
+    for (i = 0; i < 8; i++) ptrs[i] = HeapAlloc( heap, 0, 0x20 );
+    for (i = 0; i < 8; i++) HeapFree( heap, 0, ptrs[i] );
+    ret = HeapDestroy( heap );
+    ok( ret, "HeapDestroy failed, error %lu\n", GetLastError() );
+
+    ptr = HeapAlloc( GetProcessHeap(), 0, 0x20 );
+    ok( !!ptr, "HeapAlloc failed\n" );
+    HeapFree( GetProcessHeap(), 0, ptr );
+
+    /* the cache doesn't use the TLS slots of the application */
+    ok( TlsGetValue( index ) == (void *)0xdeadbeef, "got %p\n", TlsGetValue( index ) );
+    TlsFree( index );
+}
+
+static void test_heap_thread_cache( const char *argv0 )
+{
+    PROCESS_INFORMATION info;
+    STARTUPINFOA startup;
+    char buffer[MAX_PATH];
+    BOOL ret;
+
+    SetEnvironmentVariableA( "WINE_HEAP_THREAD_CACHE", "1" );
+
+    memset( &startup, 0, sizeof(startup) );
+    startup.cb = sizeof(startup);
+    sprintf( buffer, "%s heap.c thread_cache", argv0 );
+    ret = CreateProcessA( NULL, buffer, NULL, NULL, FALSE, 0, NULL, NULL, &startup, &info );
+    ok( ret, "failed to create child process error %lu\n", GetLastError() );
+    if (ret)
+    {
+        wait_child_process( info.hProcess );
+        CloseHandle( info.hThread );
+        CloseHandle( info.hProcess );
+    }
+
+    SetEnvironmentVariableA( "WINE_HEAP_THREAD_CACHE", NULL );
+}
+
 START_TEST(heap)
 {
     int argc;
@@ -3735,6 +3954,11 @@ START_TEST(heap)
     load_functions();
 
     argc = winetest_get_mainargs( &argv );
+    if (argc >= 3 && !strcmp( argv[2], "thread_cache" ))
+    {
+        test_child_thread_cache();
+        return;
+    }
     if (argc >= 3)
     {
         test_child_heap( argv[2] );
@@ -3764,4 +3988,6 @@ START_TEST(heap)
     }
     else win_skip( "RtlGetNtGlobalFlags not found, skipping heap debug tests\n" );
     test_heap_sizes();
+    test_heap_statistics();
+    test_heap_thread_cache( argv[0] );
 }
@@ -487,25 +487,47 @@ BOOL WINAPI DECLSPEC_HOTPATCH AreFileApisANSI(void)
     return !oem_file_apis;
 }
 
+#define COPY_CHUNK_SIZE (4 * 1024 * 1024)
+
+/* copy up to a chunk of data from the current file positions through a buffer */
+static BOOL copy_file_chunk( HANDLE h1, HANDLE h2, char *buffer, DWORD buffer_size, ULONGLONG *copied )
+{
+    DWORD count, res;
+    char *p;
+
+    *copied = 0;
+    while (*copied < COPY_CHUNK_SIZE)
+    {
+        if (!ReadFile( h1, buffer, buffer_size, &count, NULL ) || !count) break;
+        *copied += count;
+        for (p = buffer; count; p += res, count -= res)
+            if (!WriteFile( h2, p, count, &res, NULL ) || !res) return FALSE;
+    }
+    return TRUE;
+}
+
 /******************************************************************************
  *  copy_file
  */
-static BOOL copy_file( const WCHAR *source, const WCHAR *dest, COPYFILE2_EXTENDED_PARAMETERS *params )
+static BOOL copy_file( const WCHAR *source, const WCHAR *dest, COPYFILE2_EXTENDED_PARAMETERS *params,
+                       LPPROGRESS_ROUTINE progress_ex, void *progress_param )
 {
     DWORD flags = params ? params->dwCopyFlags : 0;
     BOOL *cancel_ptr = params ? params->pfCancel : NULL;
     PCOPYFILE2_PROGRESS_ROUTINE progress = params ? params->pProgressRoutine : NULL;
 
     static const int buffer_size = 65536;
+    DWORD reason = CALLBACK_STREAM_SWITCH;
+    BOOL ret = FALSE, offload = TRUE, delete_dest = FALSE, can_delete = FALSE;
+    FILE_DISPOSITION_INFORMATION disposition;
+    LARGE_INTEGER size, transferred;
+    DUPLICATE_EXTENTS_DATA extents;
     HANDLE h1, h2;
     FILE_BASIC_INFORMATION info;
     IO_STATUS_BLOCK io;
-    DWORD count;
-    BOOL ret = FALSE;
-    char *buffer;
+    ULONGLONG copied;
+    char *buffer = NULL;
 
-    if (cancel_ptr)
-        FIXME("pfCancel is not supported\n");
     if (progress)
         FIXME("PCOPYFILE2_PROGRESS_ROUTINE is not supported\n");
 
@@ -514,11 +536,6 @@ static BOOL copy_file( const WCHAR *source, const WCHAR *dest, COPYFILE2_EXTENDE
         SetLastError( ERROR_INVALID_PARAMETER );
         return FALSE;
     }
-    if (!(buffer = HeapAlloc( GetProcessHeap(), 0, buffer_size )))
-    {
-        SetLastError( ERROR_NOT_ENOUGH_MEMORY );
-        return FALSE;
-    }
 
     TRACE("%s -> %s, %lx\n", debugstr_w(source), debugstr_w(dest), flags);
 
@@ -533,14 +550,12 @@ static BOOL copy_file( const WCHAR *source, const WCHAR *dest, COPYFILE2_EXTENDE
                            NULL, OPEN_EXISTING, 0, 0 )) == INVALID_HANDLE_VALUE)
     {
         WARN("Unable to open source %s\n", debugstr_w(source));
-        HeapFree( GetProcessHeap(), 0, buffer );
         return FALSE;
     }
 
     if (!set_ntstatus( NtQueryInformationFile( h1, &io, &info, sizeof(info), FileBasicInformation )))
     {
         WARN("GetFileInformationByHandle returned error for %s\n", debugstr_w(source));
-        HeapFree( GetProcessHeap(), 0, buffer );
         CloseHandle( h1 );
         return FALSE;
     }
@@ -556,42 +571,107 @@ static BOOL copy_file( const WCHAR *source, const WCHAR *dest, COPYFILE2_EXTENDE
         }
         if (same_file)
         {
-            HeapFree( GetProcessHeap(), 0, buffer );
             CloseHandle( h1 );
             SetLastError( ERROR_SHARING_VIOLATION );
             return FALSE;
         }
     }
 
-    if ((h2 = CreateFileW( dest, GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
-                           (flags & COPY_FILE_FAIL_IF_EXISTS) ? CREATE_NEW : CREATE_ALWAYS,
-                           info.FileAttributes, h1 )) == INVALID_HANDLE_VALUE)
+    /* the destination can only be deleted on cancel if other handles share delete access */
+    h2 = CreateFileW( dest, GENERIC_WRITE | DELETE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                      (flags & COPY_FILE_FAIL_IF_EXISTS) ? CREATE_NEW : CREATE_ALWAYS, info.FileAttributes, h1 );
+    if (h2 != INVALID_HANDLE_VALUE) can_delete = TRUE;
+    else if (GetLastError() == ERROR_SHARING_VIOLATION || GetLastError() == ERROR_ACCESS_DENIED)
+        h2 = CreateFileW( dest, GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                          (flags & COPY_FILE_FAIL_IF_EXISTS) ? CREATE_NEW : CREATE_ALWAYS, info.FileAttributes, h1 );
+    if (h2 == INVALID_HANDLE_VALUE)
     {
         WARN("Unable to open dest %s\n", debugstr_w(dest));
-        HeapFree( GetProcessHeap(), 0, buffer );
         CloseHandle( h1 );
         return FALSE;
     }
 
-    while (ReadFile( h1, buffer, buffer_size, &count, NULL ) && count)
+    if (!GetFileSizeEx( h1, &size ))
+    {
+        size.QuadPart = 0;
+        offload = FALSE;
+    }
+    transferred.QuadPart = 0;
+
+    for (;;)
     {
-        char *p = buffer;
-        while (count != 0)
+        if (progress_ex)
         {
-            DWORD res;
-            if (!WriteFile( h2, p, count, &res, NULL ) || !res) goto done;
-            p += res;
-            count -= res;
+            switch (progress_ex( size, transferred, size, transferred, 1, reason, h1, h2, progress_param ))
+            {
+            case PROGRESS_CONTINUE:
+                break;
+            case PROGRESS_QUIET:
+                progress_ex = NULL;
+                break;
+            case PROGRESS_CANCEL:
+                delete_dest = TRUE;
+                /* fall through */
+            default:
+                SetLastError( ERROR_REQUEST_ABORTED );
+                goto done;
+            }
+            reason = CALLBACK_CHUNK_FINISHED;
+        }
+        if (cancel_ptr && *cancel_ptr)
+        {
+            delete_dest = TRUE;
+            SetLastError( ERROR_REQUEST_ABORTED );
+            goto done;
+        }
+
+        if (offload)
+        {
+            if (transferred.QuadPart >= size.QuadPart) break;
+
+            /* let the file system copy the data, or share it between both files */
+            extents.FileHandle = h1;
+            extents.SourceFileOffset = transferred;
+            extents.TargetFileOffset = transferred;
+            extents.ByteCount.QuadPart = min( size.QuadPart - transferred.QuadPart, COPY_CHUNK_SIZE );
+            if (!NtFsControlFile( h2, NULL, NULL, NULL, &io, FSCTL_DUPLICATE_EXTENTS_TO_FILE,
+                                  &extents, sizeof(extents), NULL, 0 ))
+            {
+                transferred.QuadPart += extents.ByteCount.QuadPart;
+                continue;
+            }
+
+            /* not supported, copy the rest of the file through a buffer */
+            offload = FALSE;
+            if (!SetFilePointerEx( h1, transferred, NULL, FILE_BEGIN ) ||
+                !SetFilePointerEx( h2, transferred, NULL, FILE_BEGIN ))
+                goto done;
+        }
+
+        if (!buffer && !(buffer = HeapAlloc( GetProcessHeap(), 0, buffer_size )))
+        {
+            SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+            goto done;
         }
+        if (!copy_file_chunk( h1, h2, buffer, buffer_size, &copied )) goto done;
+        if (!copied) break;
+        transferred.QuadPart += copied;
+        if (size.QuadPart < transferred.QuadPart) size = transferred;
     }
     ret = TRUE;
 done:
     /* Maintain the timestamp of source file to destination file */
     info.FileAttributes = 0;
     NtSetInformationFile( h2, &io, &info, sizeof(info), FileBasicInformation );
+    if (delete_dest && can_delete)
+    {
+        disposition.DoDeleteFile = TRUE;
+        NtSetInformationFile( h2, &io, &disposition, sizeof(disposition), FileDispositionInformation );
+    }
     HeapFree( GetProcessHeap(), 0, buffer );
     CloseHandle( h1 );
     CloseHandle( h2 );
+    if (delete_dest) SetLastError( ERROR_REQUEST_ABORTED );
     if (ret) SetLastError( 0 );
     return ret;
 }
@@ -601,7 +681,7 @@ done:
  */
 HRESULT WINAPI CopyFile2( const WCHAR *source, const WCHAR *dest, COPYFILE2_EXTENDED_PARAMETERS *params )
 {
-    return copy_file(source, dest, params) ? S_OK : HRESULT_FROM_WIN32(GetLastError());
+    return copy_file(source, dest, params, NULL, NULL) ? S_OK : HRESULT_FROM_WIN32(GetLastError());
 }
 
 
@@ -613,18 +693,13 @@ BOOL WINAPI CopyFileExW( const WCHAR *source, const WCHAR *dest, LPPROGRESS_ROUT
 {
     COPYFILE2_EXTENDED_PARAMETERS params;
 
-    if (progress)
-        FIXME("LPPROGRESS_ROUTINE is not supported\n");
-    if (cancel_ptr)
-        FIXME("cancel_ptr is not supported\n");
-
     params.dwSize = sizeof(params);
     params.dwCopyFlags = flags;
     params.pProgressRoutine = NULL;
     params.pvCallbackContext = NULL;
-    params.pfCancel = NULL;
+    params.pfCancel = cancel_ptr;
 
-    return copy_file( source, dest, &params );
+    return copy_file( source, dest, &params, progress, param );
 }
 
 
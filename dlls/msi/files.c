@@ -472,6 +472,191 @@ static UINT copy_install_file(MSIPACKAGE *package, MSIFILE *file, LPWSTR source)
     return gle;
 }
 
+/* Files are written out by a small private thread pool, so that creating and
+ * copying them overlaps with decompressing cabinets on the installer thread.
+ * Jobs are completed on the installer thread in the order they were queued,
+ * and failed jobs are retried there to handle read-only and in use files. */
+
+#define FILE_QUEUE_MAX_THREADS 4
+#define FILE_QUEUE_MAX_SIZE    (64 * 1024 * 1024)
+
+struct file_queue
+{
+    MSIPACKAGE *package;
+    PTP_POOL pool;
+    TP_CALLBACK_ENVIRON environment;
+    CRITICAL_SECTION cs;
+    CONDITION_VARIABLE cv;
+    struct list jobs;
+    UINT pending;
+    SIZE_T pending_size;
+    UINT status;
+};
+
+static void CALLBACK file_queue_worker( TP_CALLBACK_INSTANCE *instance, void *context )
+{
+    struct file_job *job = context;
+    struct file_queue *queue = job->queue;
+    BOOL redirect = is_wow64 && queue->package->platform == PLATFORM_X64;
+    void *cookie;
+    UINT status;
+
+    /* redirection is per thread, the package cookie belongs to the installer thread */
+    if (redirect) Wow64DisableWow64FsRedirection( &cookie );
+    status = job->run( job );
+    if (redirect) Wow64RevertWow64FsRedirection( cookie );
+
+    EnterCriticalSection( &queue->cs );
+    job->status = status;
+    job->done = TRUE;
+    queue->pending--;
+    queue->pending_size -= job->size;
+    WakeAllConditionVariable( &queue->cv );
+    LeaveCriticalSection( &queue->cs );
+}
+
+/* called with the queue lock held */
+static void complete_file_jobs( struct file_queue *queue )
+{
+    struct file_job *job;
+    struct list *ptr;
+    UINT status;
+
+    while ((ptr = list_head( &queue->jobs )))
+    {
+        job = LIST_ENTRY( ptr, struct file_job, entry );
+        if (!job->done) break;
+        list_remove( &job->entry );
+
+        LeaveCriticalSection( &queue->cs );
+        status = job->complete( queue->package, job, job->status );
+        EnterCriticalSection( &queue->cs );
+
+        if (status != ERROR_SUCCESS && queue->status == ERROR_SUCCESS) queue->status = status;
+    }
+}
+
+struct file_queue *msi_create_file_queue( MSIPACKAGE *package )
+{
+    struct file_queue *queue;
+
+    if (!(queue = calloc( 1, sizeof(*queue) ))) return NULL;
+    if (!(queue->pool = CreateThreadpool( NULL )))
+    {
+        free( queue );
+        return NULL;
+    }
+    SetThreadpoolThreadMaximum( queue->pool, FILE_QUEUE_MAX_THREADS );
+    queue->environment.Version = 1;
+    queue->environment.Pool = queue->pool;
+    InitializeCriticalSection( &queue->cs );
+    InitializeConditionVariable( &queue->cv );
+    list_init( &queue->jobs );
+    queue->package = package;
+    return queue;
+}
+
+void msi_queue_file_job( struct file_queue *queue, struct file_job *job )
+{
+    job->queue = queue;
+    job->status = ERROR_SUCCESS;
+    job->done = FALSE;
+
+    EnterCriticalSection( &queue->cs );
+    /* bound the amount of data waiting to be written */
+    while (queue->pending && queue->pending_size + job->size > FILE_QUEUE_MAX_SIZE)
+        SleepConditionVariableCS( &queue->cv, &queue->cs, INFINITE );
+    complete_file_jobs( queue );
+    list_add_tail( &queue->jobs, &job->entry );
+    queue->pending++;
+    queue->pending_size += job->size;
+    LeaveCriticalSection( &queue->cs );
+
+    if (!TrySubmitThreadpoolCallback( file_queue_worker, job, &queue->environment ))
+        file_queue_worker( NULL, job );
+}
+
+/* waits for all queued jobs and returns the first failure */
+UINT msi_destroy_file_queue( struct file_queue *queue )
+{
+    UINT status;
+
+    if (!queue) return ERROR_SUCCESS;
+
+    EnterCriticalSection( &queue->cs );
+    while (queue->pending)
+        SleepConditionVariableCS( &queue->cv, &queue->cs, INFINITE );
+    complete_file_jobs( queue );
+    status = queue->status;
+    LeaveCriticalSection( &queue->cs );
+
+    CloseThreadpool( queue->pool );
+    DeleteCriticalSection( &queue->cs );
+    free( queue );
+    return status;
+}
+
+struct copy_job
+{
+    struct file_job job;
+    MSIFILE *file;
+    WCHAR *source;
+};
+
+static UINT run_copy_job( struct file_job *job )
+{
+    struct copy_job *copy = CONTAINING_RECORD( job, struct copy_job, job );
+
+    if (!CopyFileW( copy->source, copy->file->TargetPath, FALSE ))
+        return GetLastError();
+
+    SetFileAttributesW( copy->file->TargetPath, FILE_ATTRIBUTE_NORMAL );
+    return ERROR_SUCCESS;
+}
+
+static UINT complete_copy_job( MSIPACKAGE *package, struct file_job *job, UINT status )
+{
+    struct copy_job *copy = CONTAINING_RECORD( job, struct copy_job, job );
+
+    if (status != ERROR_SUCCESS && (status = copy_install_file( package, copy->file, copy->source )))
+    {
+        ERR("Failed to copy %s to %s (%u)\n", debugstr_w(copy->source), debugstr_w(copy->file->TargetPath), status);
+        status = ERROR_INSTALL_FAILURE;
+    }
+    else if (!msi_is_global_assembly( copy->file->Component )) copy->file->state = msifs_installed;
+    free( copy->source );
+    free( copy );
+    return status;
+}
+
+static UINT install_uncompressed_file( MSIPACKAGE *package, struct file_queue *queue, MSIFILE *file, WCHAR *source )
+{
+    struct copy_job *copy;
+    UINT rc;
+
+    if (queue && (copy = malloc( sizeof(*copy) )))
+    {
+        copy->job.run = run_copy_job;
+        copy->job.complete = complete_copy_job;
+        copy->job.size = 0;
+        copy->file = file;
+        copy->source = source;
+        if (!msi_is_global_assembly( file->Component )) file->state = msifs_queued;
+        msi_queue_file_job( queue, &copy->job );
+        return ERROR_SUCCESS;
+    }
+
+    rc = copy_install_file( package, file, source );
+    if (rc != ERROR_SUCCESS)
+    {
+        ERR("Failed to copy %s to %s (%u)\n", debugstr_w(source), debugstr_w(file->TargetPath), rc);
+        rc = ERROR_INSTALL_FAILURE;
+    }
+    else if (!msi_is_global_assembly( file->Component )) file->state = msifs_installed;
+    free( source );
+    return rc;
+}
+
 static UINT create_folder( MSIPACKAGE *package, const WCHAR *dir )
 {
     MSIFOLDER *folder;
@@ -497,15 +682,27 @@ static MSIFILE *find_file( MSIPACKAGE *package, UINT disk_id, const WCHAR *filen
     {
         if (file->disk_id == disk_id &&
             file->state != msifs_installed &&
+            file->state != msifs_queued &&
             !wcsicmp( filename, file->File )) return file;
     }
     return NULL;
 }
 
+static MSIFILE *find_queued_file( MSIPACKAGE *package, const WCHAR *filename )
+{
+    MSIFILE *file;
+
+    LIST_FOR_EACH_ENTRY( file, &package->files, MSIFILE, entry )
+    {
+        if (file->state == msifs_queued && !wcsicmp( filename, file->File )) return file;
+    }
+    return NULL;
+}
+
 static BOOL installfiles_cb(MSIPACKAGE *package, LPCWSTR filename, DWORD action,
                             LPWSTR *path, DWORD *attrs, PVOID user)
 {
-    MSIFILE *file = *(MSIFILE **)user;
+    MSIFILE *file = user ? *(MSIFILE **)user : NULL;
 
     if (action == MSICABEXTRACT_BEGINEXTRACT)
     {
@@ -525,8 +722,14 @@ static BOOL installfiles_cb(MSIPACKAGE *package, LPCWSTR filename, DWORD action,
         *attrs = file->Attributes;
         *(MSIFILE **)user = file;
     }
+    else if (action == MSICABEXTRACT_FILEQUEUED)
+    {
+        if (!msi_is_global_assembly( file->Component )) file->state = msifs_queued;
+    }
     else if (action == MSICABEXTRACT_FILEEXTRACTED)
     {
+        /* queued files are reported once written, when the cursor is gone */
+        if (!user && !(file = find_queued_file( package, filename ))) return TRUE;
         if (!msi_is_global_assembly( file->Component )) file->state = msifs_installed;
     }
 
@@ -564,7 +767,8 @@ WCHAR *msi_resolve_file_source( MSIPACKAGE *package, MSIFILE *file )
 UINT ACTION_InstallFiles(MSIPACKAGE *package)
 {
     MSIMEDIAINFO *mi;
-    UINT rc = ERROR_SUCCESS;
+    struct file_queue *queue;
+    UINT r, rc = ERROR_SUCCESS;
     MSIFILE *file;
 
     msi_set_sourcedir_props(package, FALSE);
@@ -574,6 +778,7 @@ UINT ACTION_InstallFiles(MSIPACKAGE *package)
 
     schedule_install_files(package);
     mi = calloc(1, sizeof(MSIMEDIAINFO));
+    queue = msi_create_file_queue( package );
 
     LIST_FOR_EACH_ENTRY( file, &package->files, MSIFILE, entry )
     {
@@ -611,6 +816,7 @@ UINT ACTION_InstallFiles(MSIPACKAGE *package)
             data.package = package;
             data.cb = installfiles_cb;
             data.user = &cursor;
+            data.queue = queue;
 
             if (file->IsCompressed && !msi_cabextract(package, mi, &data))
             {
@@ -630,18 +836,11 @@ UINT ACTION_InstallFiles(MSIPACKAGE *package)
             {
                 create_folder(package, file->Component->Directory);
             }
-            rc = copy_install_file(package, file, source);
+            rc = install_uncompressed_file(package, queue, file, source);
             if (rc != ERROR_SUCCESS)
-            {
-                ERR("Failed to copy %s to %s (%u)\n", debugstr_w(source), debugstr_w(file->TargetPath), rc);
-                rc = ERROR_INSTALL_FAILURE;
-                free(source);
                 goto done;
-            }
-            if (!is_global_assembly) file->state = msifs_installed;
-            free(source);
         }
-        else if (!is_global_assembly && file->state != msifs_installed &&
+        else if (!is_global_assembly && file->state != msifs_installed && file->state != msifs_queued &&
                  !(file->Attributes & msidbFileAttributesPatchAdded))
         {
             ERR("compressed file wasn't installed (%s)\n", debugstr_w(file->File));
@@ -651,6 +850,9 @@ UINT ACTION_InstallFiles(MSIPACKAGE *package)
     }
 
 done:
+    /* all files have to be in place before the next action runs */
+    r = msi_destroy_file_queue( queue );
+    if (r != ERROR_SUCCESS && rc == ERROR_SUCCESS) rc = ERROR_INSTALL_FAILURE;
     msi_free_media_info(mi);
     return rc;
 }
@@ -818,6 +1020,7 @@ UINT ACTION_PatchFiles( MSIPACKAGE *package )
             data.package = package;
             data.cb      = patchfiles_cb;
             data.user    = &cursor;
+            data.queue   = NULL;
 
             if (!msi_cabextract( package, mi, &data ))
             {
@@ -150,12 +150,81 @@ static UINT CDECL cabinet_read(INT_PTR hf, void *pv, UINT cb)
     return 0;
 }
 
+/* Files extracted from a cabinet. Small files are buffered and written out
+ * through the file queue once they are complete, larger ones and files
+ * extracted without a queue are written directly. */
+
+#define CABINET_BUFFER_SIZE (4 * 1024 * 1024)
+
+struct cabinet_output
+{
+    struct file_job job;
+    struct list entry;
+    WCHAR *path;
+    DWORD attrs;
+    HANDLE handle;
+    BYTE *data;
+    UINT size;
+    UINT capacity;
+    FILETIME time;
+    PMSICABEXTRACTCB cb;
+    WCHAR *file;
+};
+
+/* outputs owned by FDI, which may close them along with the cabinets on failure */
+static struct list cabinet_outputs = LIST_INIT( cabinet_outputs );
+
+static CRITICAL_SECTION cabinet_outputs_cs;
+static CRITICAL_SECTION_DEBUG cabinet_outputs_cs_debug =
+{
+    0, 0, &cabinet_outputs_cs,
+    { &cabinet_outputs_cs_debug.ProcessLocksList,
+      &cabinet_outputs_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": cabinet_outputs_cs") }
+};
+static CRITICAL_SECTION cabinet_outputs_cs = { &cabinet_outputs_cs_debug, -1, 0, 0, 0, 0 };
+
+static void free_cabinet_output( struct cabinet_output *output )
+{
+    if (output->handle != INVALID_HANDLE_VALUE) CloseHandle( output->handle );
+    free( output->data );
+    free( output->path );
+    free( output->file );
+    free( output );
+}
+
+static BOOL close_cabinet_output( INT_PTR hf )
+{
+    struct cabinet_output *output;
+
+    EnterCriticalSection( &cabinet_outputs_cs );
+    LIST_FOR_EACH_ENTRY( output, &cabinet_outputs, struct cabinet_output, entry )
+    {
+        if ((INT_PTR)output != hf) continue;
+        list_remove( &output->entry );
+        LeaveCriticalSection( &cabinet_outputs_cs );
+        free_cabinet_output( output );
+        return TRUE;
+    }
+    LeaveCriticalSection( &cabinet_outputs_cs );
+    return FALSE;
+}
+
 static UINT CDECL cabinet_write(INT_PTR hf, void *pv, UINT cb)
 {
-    HANDLE handle = (HANDLE)hf;
+    struct cabinet_output *output = (struct cabinet_output *)hf;
     DWORD written;
 
-    if (WriteFile(handle, pv, cb, &written, NULL))
+    if (output->data)
+    {
+        if (cb > output->capacity - output->size)
+            return 0;
+        memcpy( output->data + output->size, pv, cb );
+        output->size += cb;
+        return cb;
+    }
+
+    if (WriteFile(output->handle, pv, cb, &written, NULL))
         return written;
 
     return 0;
@@ -164,6 +233,9 @@ static UINT CDECL cabinet_write(INT_PTR hf, void *pv, UINT cb)
 static int CDECL cabinet_close(INT_PTR hf)
 {
     HANDLE handle = (HANDLE)hf;
+
+    if (close_cabinet_output( hf ))
+        return 0;
     return CloseHandle(handle) ? 0 : -1;
 }
 
@@ -238,6 +310,9 @@ static UINT CDECL cabinet_read_stream( INT_PTR hf, void *pv, UINT cb )
 static int CDECL cabinet_close_stream( INT_PTR hf )
 {
     IStream *stm = (IStream *)hf;
+
+    if (close_cabinet_output( hf ))
+        return 0;
     IStream_Release( stm );
     return 0;
 }
@@ -398,47 +473,28 @@ static INT_PTR cabinet_next_cabinet_stream( FDINOTIFICATIONTYPE fdint,
     return 0;
 }
 
-static INT_PTR cabinet_copy_file(FDINOTIFICATIONTYPE fdint,
-                                 PFDINOTIFICATION pfdin)
+static HANDLE create_output_file( MSIPACKAGE *package, const WCHAR *path, DWORD attrs )
 {
-    MSICABDATA *data = pfdin->pv;
-    HANDLE handle = 0;
-    LPWSTR path = NULL;
-    DWORD attrs;
-
-    data->curfile = strdupAtoW(pfdin->psz1);
-    if (!data->cb(data->package, data->curfile, MSICABEXTRACT_BEGINEXTRACT, &path,
-                  &attrs, data->user))
-    {
-        /* We're not extracting this file, so free the filename. */
-        free(data->curfile);
-        data->curfile = NULL;
-        goto done;
-    }
-
-    TRACE("extracting %s -> %s\n", debugstr_w(data->curfile), debugstr_w(path));
-
-    attrs = attrs & (FILE_ATTRIBUTE_READONLY|FILE_ATTRIBUTE_HIDDEN|FILE_ATTRIBUTE_SYSTEM);
-    if (!attrs) attrs = FILE_ATTRIBUTE_NORMAL;
+    HANDLE handle;
 
-    handle = msi_create_file( data->package, path, GENERIC_READ | GENERIC_WRITE, 0, CREATE_ALWAYS, attrs );
+    handle = msi_create_file( package, path, GENERIC_READ | GENERIC_WRITE, 0, CREATE_ALWAYS, attrs );
     if (handle == INVALID_HANDLE_VALUE)
     {
         DWORD err = GetLastError();
-        DWORD attrs2 = msi_get_file_attributes( data->package, path );
+        DWORD attrs2 = msi_get_file_attributes( package, path );
 
         if (attrs2 == INVALID_FILE_ATTRIBUTES)
         {
             ERR( "failed to create %s (error %lu)\n", debugstr_w(path), err );
-            goto done;
+            return handle;
         }
         else if (err == ERROR_ACCESS_DENIED && (attrs2 & FILE_ATTRIBUTE_READONLY))
         {
             TRACE("removing read-only attribute on %s\n", debugstr_w(path));
-            msi_set_file_attributes( data->package, path, attrs2 & ~FILE_ATTRIBUTE_READONLY );
-            handle = msi_create_file( data->package, path, GENERIC_READ | GENERIC_WRITE, 0, CREATE_ALWAYS, attrs );
+            msi_set_file_attributes( package, path, attrs2 & ~FILE_ATTRIBUTE_READONLY );
+            handle = msi_create_file( package, path, GENERIC_READ | GENERIC_WRITE, 0, CREATE_ALWAYS, attrs );
 
-            if (handle != INVALID_HANDLE_VALUE) goto done;
+            if (handle != INVALID_HANDLE_VALUE) return handle;
             err = GetLastError();
         }
         if (err == ERROR_SHARING_VIOLATION || err == ERROR_USER_MAPPED_FILE)
@@ -448,68 +504,173 @@ static INT_PTR cabinet_copy_file(FDINOTIFICATIONTYPE fdint,
 
             TRACE("file in use, scheduling rename operation\n");
 
-            if (!(tmppathW = wcsdup(path))) return ERROR_OUTOFMEMORY;
+            if (!(tmppathW = wcsdup(path))) return INVALID_HANDLE_VALUE;
             if ((p = wcsrchr(tmppathW, '\\'))) *p = 0;
             len = lstrlenW( tmppathW ) + 16;
             if (!(tmpfileW = malloc(len * sizeof(WCHAR))))
             {
                 free( tmppathW );
-                return ERROR_OUTOFMEMORY;
+                return INVALID_HANDLE_VALUE;
             }
-            if (!msi_get_temp_file_name( data->package, tmppathW, L"msi", tmpfileW )) tmpfileW[0] = 0;
+            if (!msi_get_temp_file_name( package, tmppathW, L"msi", tmpfileW )) tmpfileW[0] = 0;
             free( tmppathW );
 
-            handle = msi_create_file( data->package, tmpfileW, GENERIC_READ | GENERIC_WRITE, 0, CREATE_ALWAYS, attrs );
+            handle = msi_create_file( package, tmpfileW, GENERIC_READ | GENERIC_WRITE, 0, CREATE_ALWAYS, attrs );
 
             if (handle != INVALID_HANDLE_VALUE &&
-                msi_move_file( data->package, path, NULL, MOVEFILE_DELAY_UNTIL_REBOOT ) &&
-                msi_move_file( data->package, tmpfileW, path, MOVEFILE_DELAY_UNTIL_REBOOT ))
+                msi_move_file( package, path, NULL, MOVEFILE_DELAY_UNTIL_REBOOT ) &&
+                msi_move_file( package, tmpfileW, path, MOVEFILE_DELAY_UNTIL_REBOOT ))
             {
-                data->package->need_reboot_at_end = 1;
+                package->need_reboot_at_end = 1;
             }
             else
             {
                 WARN( "failed to schedule rename operation %s (error %lu)\n", debugstr_w(path), GetLastError() );
-                msi_delete_file( data->package, tmpfileW );
+                msi_delete_file( package, tmpfileW );
             }
             free(tmpfileW);
         }
         else WARN( "failed to create %s (error %lu)\n", debugstr_w(path), err );
     }
+    return handle;
+}
 
-done:
-    free(path);
+static UINT write_output_data( struct cabinet_output *output )
+{
+    DWORD written;
 
-    return (INT_PTR)handle;
+    if (!WriteFile( output->handle, output->data, output->size, &written, NULL ))
+        return GetLastError();
+    if (!SetFileTime( output->handle, &output->time, 0, &output->time ))
+        return GetLastError();
+    return ERROR_SUCCESS;
+}
+
+static UINT write_cabinet_output( struct file_job *job )
+{
+    struct cabinet_output *output = CONTAINING_RECORD( job, struct cabinet_output, job );
+    UINT ret;
+
+    output->handle = CreateFileW( output->path, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                                  output->attrs, NULL );
+    if (output->handle == INVALID_HANDLE_VALUE)
+        return GetLastError();
+
+    ret = write_output_data( output );
+    CloseHandle( output->handle );
+    output->handle = INVALID_HANDLE_VALUE;
+    return ret;
+}
+
+static UINT complete_cabinet_output( MSIPACKAGE *package, struct file_job *job, UINT status )
+{
+    struct cabinet_output *output = CONTAINING_RECORD( job, struct cabinet_output, job );
+
+    if (status != ERROR_SUCCESS)
+    {
+        TRACE("retrying %s (error %u)\n", debugstr_w(output->path), status);
+
+        output->handle = create_output_file( package, output->path, output->attrs );
+        if (output->handle == INVALID_HANDLE_VALUE)
+            status = ERROR_INSTALL_FAILURE;
+        else if ((status = write_output_data( output )))
+            ERR("failed to write %s (error %u)\n", debugstr_w(output->path), status);
+    }
+    if (status == ERROR_SUCCESS)
+        output->cb( package, output->file, MSICABEXTRACT_FILEEXTRACTED, NULL, NULL, NULL );
+    free_cabinet_output( output );
+    return status;
+}
+
+static INT_PTR cabinet_copy_file(FDINOTIFICATIONTYPE fdint,
+                                 PFDINOTIFICATION pfdin)
+{
+    MSICABDATA *data = pfdin->pv;
+    struct cabinet_output *output;
+    LPWSTR path = NULL;
+    DWORD attrs;
+
+    data->curfile = strdupAtoW(pfdin->psz1);
+    if (!data->cb(data->package, data->curfile, MSICABEXTRACT_BEGINEXTRACT, &path,
+                  &attrs, data->user))
+    {
+        /* We're not extracting this file, so free the filename. */
+        free(data->curfile);
+        data->curfile = NULL;
+        return 0;
+    }
+
+    TRACE("extracting %s -> %s\n", debugstr_w(data->curfile), debugstr_w(path));
+
+    attrs = attrs & (FILE_ATTRIBUTE_READONLY|FILE_ATTRIBUTE_HIDDEN|FILE_ATTRIBUTE_SYSTEM);
+    if (!attrs) attrs = FILE_ATTRIBUTE_NORMAL;
+
+    if (!(output = calloc( 1, sizeof(*output) )))
+    {
+        free( path );
+        return -1;
+    }
+    output->path = path;
+    output->attrs = attrs;
+    output->handle = INVALID_HANDLE_VALUE;
+
+    if (data->queue && pfdin->cb <= CABINET_BUFFER_SIZE && (output->data = malloc( max( pfdin->cb, 1 ) )))
+        output->capacity = pfdin->cb;
+    else if ((output->handle = create_output_file( data->package, path, attrs )) == INVALID_HANDLE_VALUE)
+    {
+        free_cabinet_output( output );
+        return -1;
+    }
+
+    EnterCriticalSection( &cabinet_outputs_cs );
+    list_add_tail( &cabinet_outputs, &output->entry );
+    LeaveCriticalSection( &cabinet_outputs_cs );
+
+    return (INT_PTR)output;
 }
 
 static INT_PTR cabinet_close_file_info(FDINOTIFICATIONTYPE fdint,
                                        PFDINOTIFICATION pfdin)
 {
     MSICABDATA *data = pfdin->pv;
+    struct cabinet_output *output = (struct cabinet_output *)pfdin->hf;
     FILETIME ft;
-    FILETIME ftLocal;
-    HANDLE handle = (HANDLE)pfdin->hf;
 
     data->mi->is_continuous = FALSE;
 
-    if (!DosDateTimeToFileTime(pfdin->date, pfdin->time, &ft))
+    EnterCriticalSection( &cabinet_outputs_cs );
+    list_remove( &output->entry );
+    LeaveCriticalSection( &cabinet_outputs_cs );
+
+    if (!DosDateTimeToFileTime(pfdin->date, pfdin->time, &ft) ||
+        !LocalFileTimeToFileTime(&ft, &output->time))
     {
-        CloseHandle(handle);
+        free_cabinet_output( output );
         return -1;
     }
-    if (!LocalFileTimeToFileTime(&ft, &ftLocal))
+
+    if (output->data)
     {
-        CloseHandle(handle);
-        return -1;
+        /* the extraction is only reported once the file has been written */
+        data->cb(data->package, data->curfile, MSICABEXTRACT_FILEQUEUED, NULL, NULL, data->user);
+        output->cb = data->cb;
+        output->file = data->curfile;
+        data->curfile = NULL;
+
+        output->job.run = write_cabinet_output;
+        output->job.complete = complete_cabinet_output;
+        output->job.size = output->size;
+        msi_queue_file_job( data->queue, &output->job );
+        return 1;
     }
-    if (!SetFileTime(handle, &ftLocal, 0, &ftLocal))
+    else
     {
-        CloseHandle(handle);
-        return -1;
+        BOOL ret = SetFileTime( output->handle, &output->time, 0, &output->time );
+
+        free_cabinet_output( output );
+        if (!ret) return -1;
     }
 
-    CloseHandle(handle);
     data->cb(data->package, data->curfile, MSICABEXTRACT_FILEEXTRACTED, NULL, NULL, data->user);
 
     free(data->curfile);
@@ -226,7 +226,7 @@ typedef struct _column_info
     struct _column_info *next;
 } column_info;
 
-typedef const struct tagMSICOLUMNHASHENTRY *MSIITERHANDLE;
+typedef const struct column_hash_entry *MSIITERHANDLE;
 
 typedef struct tagMSIVIEWOPS
 {
@@ -347,6 +347,18 @@ typedef struct tagMSIVIEWOPS
      * drop - drops the table from the database
      */
     UINT (*drop)( struct tagMSIVIEW *view );
+
+    /*
+     * find_matching_rows - iterates through rows that match a value
+     *
+     * The value is compared with the raw column data as returned by
+     *  fetch_int, so a string ID has to be passed in for string columns.
+     * The handle is an input/output parameter that keeps track of the current
+     *  position in the iteration. It must be initialised to zero before the
+     *  first call and continued to be passed in to subsequent calls.
+     * Views that cannot look up rows by value leave this NULL.
+     */
+    UINT (*find_matching_rows)( struct tagMSIVIEW *view, UINT col, UINT val, UINT *row, MSIITERHANDLE *handle );
 } MSIVIEWOPS;
 
 struct tagMSIVIEW
@@ -596,7 +608,8 @@ typedef enum _msi_file_state {
     msifs_present,
     msifs_installed,
     msifs_skipped,
-    msifs_hashmatch
+    msifs_hashmatch,
+    msifs_queued      /* waiting in a file queue, msifs_installed once written */
 } msi_file_state;
 
 typedef struct tagMSIFILE
@@ -1093,12 +1106,34 @@ extern UINT msi_get_filehash( MSIPACKAGE *, const WCHAR *, MSIFILEHASHINFO * );
 extern WCHAR *msi_get_font_file_version( MSIPACKAGE *,
                                          const WCHAR * ) __WINE_DEALLOC(free) __WINE_MALLOC;
 
+/* file writes performed on worker threads */
+struct file_queue;
+
+struct file_job
+{
+    struct list entry;
+    struct file_queue *queue;
+    /* called on a worker thread, with file system redirection already disabled */
+    UINT (*run)( struct file_job *job );
+    /* called on the installer thread in submission order, retries the job if it
+     * failed and frees it */
+    UINT (*complete)( MSIPACKAGE *package, struct file_job *job, UINT status );
+    SIZE_T size;
+    UINT status;
+    BOOL done;
+};
+
+extern struct file_queue *msi_create_file_queue( MSIPACKAGE * );
+extern void msi_queue_file_job( struct file_queue *, struct file_job * );
+extern UINT msi_destroy_file_queue( struct file_queue * );
+
 /* media */
 
 typedef BOOL (*PMSICABEXTRACTCB)(MSIPACKAGE *, LPCWSTR, DWORD, LPWSTR *, DWORD *, PVOID);
 
 #define MSICABEXTRACT_BEGINEXTRACT  0x01
 #define MSICABEXTRACT_FILEEXTRACTED 0x02
+#define MSICABEXTRACT_FILEQUEUED    0x03  /* FILEEXTRACTED follows with a NULL user once written */
 
 typedef struct
 {
@@ -1107,6 +1142,7 @@ typedef struct
     PMSICABEXTRACTCB cb;
     LPWSTR curfile;
     PVOID user;
+    struct file_queue *queue;
 } MSICABDATA;
 
 extern UINT ready_media(MSIPACKAGE *package, BOOL compressed, MSIMEDIAINFO *mi);
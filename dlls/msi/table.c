@@ -55,6 +55,7 @@ struct column_info
     UINT    type;
     UINT    offset;
     struct column_hash_entry **hash_table;
+    UINT    hash_size;
 };
 
 struct tagMSITABLE
@@ -361,6 +362,18 @@ static void free_colinfo( struct column_info *colinfo, UINT count )
     for (i = 0; i < count; i++) free( colinfo[i].hash_table );
 }
 
+/* drop the column indexes, they are rebuilt on the next lookup */
+static void reset_hash_tables( struct column_info *colinfo, UINT count )
+{
+    UINT i;
+
+    for (i = 0; i < count; i++)
+    {
+        free( colinfo[i].hash_table );
+        colinfo[i].hash_table = NULL;
+    }
+}
+
 static void free_table( MSITABLE *table )
 {
     UINT i;
@@ -1176,8 +1189,11 @@ static UINT table_set_bytes( struct table_view *tv, UINT row, UINT col, UINT val
         return ERROR_FUNCTION_FAILED;
     }
 
-    free( tv->columns[col-1].hash_table );
-    tv->columns[col-1].hash_table = NULL;
+    if (col <= tv->table->col_count)
+    {
+        free( tv->table->colinfo[col-1].hash_table );
+        tv->table->colinfo[col-1].hash_table = NULL;
+    }
 
     n = bytes_per_column( tv->db, &tv->columns[col - 1], LONG_STR_BYTES );
     if ( n != 2 && n != 3 && n != 4 )
@@ -1520,6 +1536,8 @@ static UINT table_create_new_row( struct tagMSIVIEW *view, UINT *num, BOOL tempo
         return ERROR_NOT_ENOUGH_MEMORY;
     }
 
+    reset_hash_tables( tv->table->colinfo, tv->table->col_count );
+
     *data_ptr = p;
     (*data_ptr)[*row_count] = row;
 
@@ -1758,12 +1776,7 @@ static UINT TABLE_delete_row( struct tagMSIVIEW *view, UINT row )
     num_rows = tv->table->row_count;
     tv->table->row_count--;
 
-    /* reset the hash tables */
-    for (i = 0; i < tv->num_cols; i++)
-    {
-        free(tv->columns[i].hash_table);
-        tv->columns[i].hash_table = NULL;
-    }
+    reset_hash_tables( tv->table->colinfo, tv->table->col_count );
 
     for (i = row + 1; i < num_rows; i++)
     {
@@ -1947,6 +1960,7 @@ static UINT TABLE_remove_column(struct tagMSIVIEW *view, UINT number)
     if (tv->table->colinfo[number-1].type & MSITYPE_TEMPORARY)
     {
         UINT size = tv->table->colinfo[number-1].offset;
+        free( tv->table->colinfo[number-1].hash_table );
         tv->table->col_count--;
         tv->table->colinfo = realloc(tv->table->colinfo, sizeof(*tv->table->colinfo) * tv->table->col_count);
 
@@ -2165,6 +2179,75 @@ done:
     return r;
 }
 
+static UINT TABLE_find_matching_rows( struct tagMSIVIEW *view, UINT col,
+    UINT val, UINT *row, MSIITERHANDLE *handle )
+{
+    struct table_view *tv = (struct table_view *)view;
+    struct column_info *column;
+    const struct column_hash_entry *entry;
+
+    TRACE("%p, %d, %u, %p\n", view, col, val, *handle);
+
+    if( !tv->table )
+        return ERROR_INVALID_PARAMETER;
+
+    /* the indexes are shared by all views of the table */
+    if( (col==0) || (col > tv->num_cols) || (col > tv->table->col_count) )
+        return ERROR_INVALID_PARAMETER;
+
+    column = &tv->table->colinfo[col - 1];
+    if( !column->hash_table )
+    {
+        UINT i, size, num_rows = tv->table->row_count;
+        struct column_hash_entry **hash_table;
+        struct column_hash_entry *new_entry;
+
+        /* one bucket per row keeps the chains short for large tables */
+        size = max( MSITABLE_HASH_TABLE_SIZE, num_rows | 1 );
+
+        /* allocate contiguous memory for the table and its entries so we
+         * don't have to do an expensive cleanup */
+        hash_table = calloc( 1, size * sizeof(*hash_table) + num_rows * sizeof(*new_entry) );
+        if( !hash_table )
+            return ERROR_OUTOFMEMORY;
+
+        new_entry = (struct column_hash_entry *)(hash_table + size);
+
+        /* insert backwards so that each chain is sorted by row */
+        for (i = num_rows; i > 0; i--)
+        {
+            UINT row_value;
+
+            if (TABLE_fetch_int( view, i - 1, col, &row_value ))
+                continue;
+
+            new_entry->value = row_value;
+            new_entry->row = i - 1;
+            new_entry->next = hash_table[row_value % size];
+            hash_table[row_value % size] = new_entry++;
+        }
+
+        column->hash_table = hash_table;
+        column->hash_size = size;
+    }
+
+    if( !*handle )
+        entry = column->hash_table[val % column->hash_size];
+    else
+        entry = (*handle)->next;
+
+    while (entry && entry->value != val)
+        entry = entry->next;
+
+    *handle = entry;
+    if (!entry)
+        return ERROR_NO_MORE_ITEMS;
+
+    *row = entry->row;
+
+    return ERROR_SUCCESS;
+}
+
 static const MSIVIEWOPS table_ops =
 {
     TABLE_fetch_int,
@@ -2186,6 +2269,7 @@ static const MSIVIEWOPS table_ops =
     TABLE_add_column,
     NULL,
     TABLE_drop,
+    TABLE_find_matching_rows,
 };
 
 UINT TABLE_CreateView( MSIDATABASE *db, LPCWSTR name, MSIVIEW **view )
@@ -3149,17 +3233,28 @@ static UINT row_matches( struct table_view *tv, UINT row, const UINT *data, UINT
 static UINT table_find_row( struct table_view *tv, MSIRECORD *rec, UINT *row, UINT *column )
 {
     UINT i, r = ERROR_FUNCTION_FAILED, *data;
+    MSIITERHANDLE handle = NULL;
 
     data = record_to_row( tv, rec );
     if( !data )
         return r;
-    for( i = 0; i < tv->table->row_count; i++ )
+
+    /* only rows matching the first key column need to be compared */
+    for( i = 0; i < tv->num_cols; i++ )
+        if ( tv->columns[i].type & MSITYPE_KEY ) break;
+
+    if ( i < tv->num_cols )
     {
-        r = row_matches( tv, i, data, column );
-        if( r == ERROR_SUCCESS )
+        UINT candidate;
+
+        while ( TABLE_find_matching_rows( &tv->view, i + 1, data[i], &candidate, &handle ) == ERROR_SUCCESS )
         {
-            *row = i;
-            break;
+            r = row_matches( tv, candidate, data, column );
+            if( r == ERROR_SUCCESS )
+            {
+                *row = candidate;
+                break;
+            }
         }
     }
     free( data );
@@ -3855,6 +3855,122 @@ static void test_join(void)
     DeleteFileA(msifile);
 }
 
+static void test_join_large(void)
+{
+    MSIHANDLE hdb, hview, hrec;
+    char query[MAX_PATH], buffer[MAX_PATH];
+    DWORD start, count, size;
+    UINT r, i;
+
+    hdb = create_db();
+    ok( hdb, "failed to create db\n");
+
+    r = run_query( hdb, 0, "CREATE TABLE `Parent` (`Name` CHAR(72) NOT NULL, `Value` SHORT PRIMARY KEY `Name`)" );
+    ok( r == ERROR_SUCCESS, "cannot create table: %u\n", r );
+
+    r = run_query( hdb, 0, "CREATE TABLE `Child` (`Id` LONG NOT NULL, `Parent_` CHAR(72), `Value` SHORT PRIMARY KEY `Id`)" );
+    ok( r == ERROR_SUCCESS, "cannot create table: %u\n", r );
+
+    for (i = 0; i < 500; i++)
+    {
+        sprintf( query, "INSERT INTO `Parent` (`Name`, `Value`) VALUES ('parent%u', %u)", i, i % 10 );
+        r = run_query( hdb, 0, query );
+        ok( r == ERROR_SUCCESS, "cannot insert into table: %u\n", r );
+    }
+
+    for (i = 0; i < 2000; i++)
+    {
+        sprintf( query, "INSERT INTO `Child` (`Id`, `Parent_`, `Value`) VALUES (%u, 'parent%u', %u)",
+                 i, (i * 7) % 500, i % 4 );
+        r = run_query( hdb, 0, query );
+        ok( r == ERROR_SUCCESS, "cannot insert into table: %u\n", r );
+    }
+    r = run_query( hdb, 0, "INSERT INTO `Child` (`Id`, `Value`) VALUES (2000, 0)" );
+    ok( r == ERROR_SUCCESS, "cannot insert into table: %u\n", r );
+
+    start = GetTickCount();
+    r = MsiDatabaseOpenViewA( hdb, "SELECT `Child`.`Id`, `Parent`.`Name` FROM `Parent`, `Child` "
+                              "WHERE `Child`.`Parent_` = `Parent`.`Name` AND `Child`.`Value` = 1", &hview );
+    ok( r == ERROR_SUCCESS, "failed to open view: %u\n", r );
+    r = MsiViewExecute( hview, 0 );
+    ok( r == ERROR_SUCCESS, "failed to execute view: %u\n", r );
+
+    count = 0;
+    while (!MsiViewFetch( hview, &hrec ))
+    {
+        i = MsiRecordGetInteger( hrec, 1 );
+        ok( i % 4 == 1, "got id %u\n", i );
+        sprintf( query, "parent%u", (i * 7) % 500 );
+        size = sizeof(buffer);
+        r = MsiRecordGetStringA( hrec, 2, buffer, &size );
+        ok( r == ERROR_SUCCESS, "failed to get string: %u\n", r );
+        ok( !strcmp( buffer, query ), "got %s, expected %s\n", buffer, query );
+        MsiCloseHandle( hrec );
+        count++;
+    }
+    ok( count == 500, "got %lu rows\n", count );
+    MsiViewClose( hview );
+    MsiCloseHandle( hview );
+    trace( "join of %u rows took %lu ms\n", 2500, GetTickCount() - start );
+
+    r = MsiDatabaseOpenViewA( hdb, "SELECT `Child`.`Id` FROM `Child`, `Parent` "
+                              "WHERE `Parent`.`Name` = ? AND `Parent`.`Name` = `Child`.`Parent_`", &hview );
+    ok( r == ERROR_SUCCESS, "failed to open view: %u\n", r );
+
+    hrec = MsiCreateRecord( 1 );
+    MsiRecordSetStringA( hrec, 1, "parent7" );
+    r = MsiViewExecute( hview, hrec );
+    ok( r == ERROR_SUCCESS, "failed to execute view: %u\n", r );
+    MsiCloseHandle( hrec );
+
+    for (i = 1; i < 2000; i += 500)
+    {
+        r = MsiViewFetch( hview, &hrec );
+        ok( r == ERROR_SUCCESS, "failed to fetch: %u\n", r );
+        ok( MsiRecordGetInteger( hrec, 1 ) == i, "got %d, expected %u\n", MsiRecordGetInteger( hrec, 1 ), i );
+        MsiCloseHandle( hrec );
+    }
+    r = MsiViewFetch( hview, &hrec );
+    ok( r == ERROR_NO_MORE_ITEMS, "got %u\n", r );
+    MsiViewClose( hview );
+
+    hrec = MsiCreateRecord( 1 );
+    MsiRecordSetStringA( hrec, 1, "notaparent" );
+    r = MsiViewExecute( hview, hrec );
+    ok( r == ERROR_SUCCESS, "failed to execute view: %u\n", r );
+    MsiCloseHandle( hrec );
+
+    r = MsiViewFetch( hview, &hrec );
+    ok( r == ERROR_NO_MORE_ITEMS, "got %u\n", r );
+    MsiViewClose( hview );
+    MsiCloseHandle( hview );
+
+    r = do_query( hdb, "SELECT `Id` FROM `Child` WHERE `Parent_` = ''", &hrec );
+    ok( r == ERROR_SUCCESS, "got %u\n", r );
+    ok( MsiRecordGetInteger( hrec, 1 ) == 2000, "got %d\n", MsiRecordGetInteger( hrec, 1 ) );
+    MsiCloseHandle( hrec );
+
+    r = do_query( hdb, "SELECT `Id` FROM `Child` WHERE `Id` = 1234", &hrec );
+    ok( r == ERROR_SUCCESS, "got %u\n", r );
+    ok( MsiRecordGetInteger( hrec, 1 ) == 1234, "got %d\n", MsiRecordGetInteger( hrec, 1 ) );
+    MsiCloseHandle( hrec );
+
+    r = do_query( hdb, "SELECT `Name` FROM `Parent` WHERE `Value` = 100000", &hrec );
+    ok( r == ERROR_NO_MORE_ITEMS, "got %u\n", r );
+
+    /* rows added after the first lookup must be found as well */
+    r = run_query( hdb, 0, "INSERT INTO `Child` (`Id`, `Parent_`, `Value`) VALUES (3000, 'parent0', 5)" );
+    ok( r == ERROR_SUCCESS, "cannot insert into table: %u\n", r );
+
+    r = do_query( hdb, "SELECT `Id` FROM `Child` WHERE `Id` = 3000", &hrec );
+    ok( r == ERROR_SUCCESS, "got %u\n", r );
+    ok( MsiRecordGetInteger( hrec, 1 ) == 3000, "got %d\n", MsiRecordGetInteger( hrec, 1 ) );
+    MsiCloseHandle( hrec );
+
+    MsiCloseHandle( hdb );
+    DeleteFileA( msifile );
+}
+
 static void test_temporary_table(void)
 {
     MSICONDITION cond;
@@ -9427,6 +9543,7 @@ START_TEST(db)
     test_handle_limit();
     test_try_transform();
     test_join();
+    test_join_large();
     test_temporary_table();
     test_alter();
     test_integers();
@@ -3348,6 +3348,102 @@ error:
     DeleteFileA(msifile);
 }
 
+static const CHAR mf_component_dat[] = "Component\tComponentId\tDirectory_\tAttributes\tCondition\tKeyPath\n"
+                                       "s72\tS38\ts72\ti2\tS255\tS72\n"
+                                       "Component\tComponent\n"
+                                       "manyfiles\t\tMSITESTDIR\t0\t1\tmf00000\n";
+
+static const CHAR mf_feature_comp_dat[] = "Feature_\tComponent_\n"
+                                          "s38\ts72\n"
+                                          "FeatureComponents\tFeature_\tComponent_\n"
+                                          "feature\tmanyfiles\n";
+
+static void test_manyfiles(void)
+{
+    static const char file_header[] = "File\tComponent_\tFileName\tFileSize\tVersion\tLanguage\tAttributes\tSequence\n"
+                                      "s72\ts72\tl255\ti4\tS72\tS20\tI2\ti2\n"
+                                      "File\tFile\n";
+    msi_table tables[] =
+    {
+        ADD_TABLE(mf_component),
+        ADD_TABLE(directory),
+        ADD_TABLE(cc_feature),
+        ADD_TABLE(mf_feature_comp),
+        ADD_TABLE(install_exec_seq),
+        ADD_TABLE(property),
+        {"file.idt"},
+        {"media.idt"},
+    };
+    UINT r, i, count = winetest_interactive ? 20000 : 1000;
+    char *file_dat, *cab_files, *p, *q, media_dat[256], name[MAX_PATH];
+    DWORD start;
+
+    if (is_process_limited())
+    {
+        skip("process is limited\n");
+        return;
+    }
+
+    CreateDirectoryA("msitest", NULL);
+
+    /* every other file is compressed */
+    file_dat = malloc( sizeof(file_header) + count * 64 );
+    cab_files = calloc( count, 8 );
+    p = file_dat + sprintf( file_dat, "%s", file_header );
+    q = cab_files;
+    for (i = 0; i < count; i++)
+    {
+        p += sprintf( p, "mf%05u\tmanyfiles\tmf%05u\t100\t\t\t%u\t%u\n", i, i, i % 2 ? 8192 : 16384, i + 1 );
+        sprintf( name, i % 2 ? "msitest\\mf%05u" : "mf%05u", i );
+        create_file_data( name, name, 100 );
+        if (i % 2) continue;
+        strcpy( q, name );
+        q += strlen( q ) + 1;
+    }
+    sprintf( media_dat, "DiskId\tLastSequence\tDiskPrompt\tCabinet\tVolumeLabel\tSource\n"
+             "i2\ti4\tL64\tS255\tS32\tS72\n"
+             "Media\tDiskId\n"
+             "1\t%u\t\ttest1.cab\tDISK1\t\n", count );
+
+    tables[6].data = file_dat;
+    tables[6].size = strlen( file_dat ) + 1;
+    tables[7].data = media_dat;
+    tables[7].size = strlen( media_dat ) + 1;
+    create_database(msifile, tables, ARRAY_SIZE(tables));
+    create_cab_file("test1.cab", MEDIA_SIZE, cab_files);
+
+    MsiSetInternalUI(INSTALLUILEVEL_NONE, NULL);
+
+    start = GetTickCount();
+    r = MsiInstallProductA(msifile, NULL);
+    if (r == ERROR_INSTALL_PACKAGE_REJECTED)
+    {
+        skip("Not enough rights to perform tests\n");
+        goto error;
+    }
+    ok(r == ERROR_SUCCESS, "Expected ERROR_SUCCESS, got %u\n", r);
+    trace("installing %u files took %lu ms\n", count, GetTickCount() - start);
+
+    for (i = 0; i < count; i++)
+    {
+        sprintf( name, "msitest\\mf%05u", i );
+        ok(delete_pf(name, TRUE), "File %s not installed\n", name);
+    }
+    ok(delete_pf("msitest", FALSE), "Directory not created\n");
+
+error:
+    for (i = 0; i < count; i++)
+    {
+        sprintf( name, i % 2 ? "msitest\\mf%05u" : "mf%05u", i );
+        DeleteFileA(name);
+    }
+    RemoveDirectoryA("msitest");
+    DeleteFileA("test1.cab");
+    DeleteFileA(msifile);
+    free(cab_files);
+    free(file_dat);
+}
+
 static void test_samesequence(void)
 {
     UINT r;
@@ -6329,6 +6425,7 @@ START_TEST(install)
     test_continuouscabs();
     test_caborder();
     test_mixedmedia();
+    test_manyfiles();
     test_samesequence();
     test_uiLevelFlags();
     test_readonlyfile();
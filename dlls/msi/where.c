@@ -51,6 +51,11 @@ struct join_table
     UINT col_count;
     UINT row_count;
     UINT table_index;
+    /* "key_column = key_value" term used to look up rows in the table index */
+    UINT key_column;
+    UINT key_type;
+    UINT key_wildcard;
+    const struct expr *key_value;
 };
 
 typedef struct tagMSIORDERINFO
@@ -647,38 +652,123 @@ static UINT WHERE_evaluate( MSIWHEREVIEW *wv, const UINT rows[],
     return ERROR_SUCCESS;
 }
 
+/* returns ERROR_CONTINUE if the index can't be used for the current rows */
+static UINT get_key_value( MSIWHEREVIEW *wv, const struct join_table *table, MSIRECORD *record,
+                           const UINT rows[], UINT *key )
+{
+    const struct expr *value = table->key_value;
+    const WCHAR *str = NULL;
+    INT ival = 0;
+    UINT r;
+
+    switch (value->type)
+    {
+    case EXPR_COL_NUMBER:
+    case EXPR_COL_NUMBER32:
+        return expr_fetch_value( &value->u.column, rows, key );
+
+    case EXPR_COL_NUMBER_STRING:
+        r = expr_fetch_value( &value->u.column, rows, key );
+        if (r != ERROR_SUCCESS)
+            return r;
+        /* null and empty strings compare equal */
+        str = msi_string_lookup( wv->db->strings, *key, NULL );
+        return str && *str ? ERROR_SUCCESS : ERROR_CONTINUE;
+
+    case EXPR_SVAL:
+        str = value->u.sval;
+        break;
+
+    case EXPR_UVAL:
+        ival = value->u.uval;
+        break;
+
+    case EXPR_WILDCARD:
+        if (!record)
+            return ERROR_CONTINUE;
+        if (table->key_type == EXPR_COL_NUMBER_STRING)
+            str = MSI_RecordGetString( record, table->key_wildcard );
+        else
+            ival = MSI_RecordGetInteger( record, table->key_wildcard );
+        break;
+
+    default:
+        return ERROR_CONTINUE;
+    }
+
+    if (table->key_type == EXPR_COL_NUMBER_STRING)
+    {
+        if (!str || !*str)
+            return ERROR_CONTINUE;
+        if (msi_string2id( wv->db->strings, str, -1, key ) != ERROR_SUCCESS)
+            return ERROR_NO_MORE_ITEMS;
+        return ERROR_SUCCESS;
+    }
+
+    /* convert to the stored representation, see WHERE_evaluate */
+    if (table->key_type == EXPR_COL_NUMBER32)
+    {
+        *key = ival + 0x80000000;
+        return ERROR_SUCCESS;
+    }
+    if (ival < -0x8000 || ival > 0x7fff)
+        return ERROR_NO_MORE_ITEMS;
+    *key = ival + 0x8000;
+    return ERROR_SUCCESS;
+}
+
+static UINT check_condition( MSIWHEREVIEW *wv, MSIRECORD *record, struct join_table **tables,
+                             UINT table_rows[] );
+
+static UINT check_row( MSIWHEREVIEW *wv, MSIRECORD *record, struct join_table **tables,
+                       UINT table_rows[] )
+{
+    UINT r;
+    INT val = 0;
+
+    wv->rec_index = 0;
+    r = WHERE_evaluate( wv, table_rows, wv->cond, &val, record );
+    if (r != ERROR_SUCCESS && r != ERROR_CONTINUE)
+        return r;
+    if (!val)
+        return ERROR_SUCCESS;
+
+    if (*(tables + 1))
+        return check_condition(wv, record, tables + 1, table_rows);
+
+    if (r != ERROR_SUCCESS)
+        return r;
+    add_row (wv, table_rows);
+    return ERROR_SUCCESS;
+}
+
 static UINT check_condition( MSIWHEREVIEW *wv, MSIRECORD *record, struct join_table **tables,
                              UINT table_rows[] )
 {
-    UINT r = ERROR_FUNCTION_FAILED;
-    INT val;
+    struct join_table *table = *tables;
+    UINT *row = &table_rows[table->table_index];
+    MSIITERHANDLE handle = NULL;
+    UINT r = ERROR_SUCCESS, key;
 
-    for (table_rows[(*tables)->table_index] = 0;
-         table_rows[(*tables)->table_index] < (*tables)->row_count;
-         table_rows[(*tables)->table_index]++)
+    if (table->key_value && (r = get_key_value( wv, table, record, table_rows, &key )) != ERROR_CONTINUE)
     {
-        val = 0;
-        wv->rec_index = 0;
-        r = WHERE_evaluate( wv, table_rows, wv->cond, &val, record );
-        if (r != ERROR_SUCCESS && r != ERROR_CONTINUE)
-            break;
-        if (val)
+        /* only the rows with a matching key can satisfy the condition */
+        while (r == ERROR_SUCCESS &&
+               !table->view->ops->find_matching_rows( table->view, table->key_column, key, row, &handle ))
+            r = check_row( wv, record, tables, table_rows );
+        if (r == ERROR_NO_MORE_ITEMS)
+            r = ERROR_SUCCESS;
+    }
+    else
+    {
+        for (*row = 0; *row < table->row_count; (*row)++)
         {
-            if (*(tables + 1))
-            {
-                r = check_condition(wv, record, tables + 1, table_rows);
-                if (r != ERROR_SUCCESS)
-                    break;
-            }
-            else
-            {
-                if (r != ERROR_SUCCESS)
-                    break;
-                add_row (wv, table_rows);
-            }
+            r = check_row( wv, record, tables, table_rows );
+            if (r != ERROR_SUCCESS)
+                break;
         }
     }
-    table_rows[(*tables)->table_index] = INVALID_ROW_INDEX;
+    *row = INVALID_ROW_INDEX;
     return r;
 }
 
@@ -786,10 +876,92 @@ static UINT reorder_check( const struct expr *expr, struct join_table **ordered_
     }
 }
 
+static UINT count_wildcards( const struct expr *expr )
+{
+    switch (expr->type)
+    {
+    case EXPR_WILDCARD:
+        return 1;
+    case EXPR_COMPLEX:
+    case EXPR_STRCMP:
+        return count_wildcards( expr->u.expr.left ) + count_wildcards( expr->u.expr.right );
+    default:
+        return 0;
+    }
+}
+
+/* whether "value" is known once the first "count" tables have a current row */
+static BOOL is_key_value( const struct expr *value, int column_type, struct join_table **tables, UINT count )
+{
+    UINT i;
+
+    switch (value->type)
+    {
+    case EXPR_COL_NUMBER:
+    case EXPR_COL_NUMBER32:
+    case EXPR_COL_NUMBER_STRING:
+        if (value->type != column_type)
+            return FALSE;
+        for (i = 0; i < count; i++)
+            if (tables[i] == value->u.column.parsed.table) return TRUE;
+        return FALSE;
+    case EXPR_SVAL:
+        return column_type == EXPR_COL_NUMBER_STRING;
+    case EXPR_UVAL:
+        return column_type != EXPR_COL_NUMBER_STRING;
+    case EXPR_WILDCARD:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+static void set_key( struct join_table *table, const struct expr *column, const struct expr *value, UINT wildcard )
+{
+    table->key_column = column->u.column.parsed.column;
+    table->key_type = column->type;
+    table->key_value = value;
+    table->key_wildcard = wildcard;
+}
+
+/* looks for an equality in the AND terms of the condition that selects the
+ * rows of tables[count] from the tables preceding it or from constants */
+static void find_key( struct join_table **tables, UINT count, const struct expr *expr, UINT *wildcard )
+{
+    struct join_table *table = tables[count];
+    const struct expr *left, *right;
+
+    if (expr->type == EXPR_COMPLEX && expr->u.expr.op == OP_AND)
+    {
+        find_key( tables, count, expr->u.expr.left, wildcard );
+        find_key( tables, count, expr->u.expr.right, wildcard );
+        return;
+    }
+
+    if (!table->key_value && (expr->type == EXPR_COMPLEX || expr->type == EXPR_STRCMP) &&
+        expr->u.expr.op == OP_EQ)
+    {
+        left = expr->u.expr.left;
+        right = expr->u.expr.right;
+
+        if ((left->type == EXPR_COL_NUMBER || left->type == EXPR_COL_NUMBER32 ||
+             left->type == EXPR_COL_NUMBER_STRING) && left->u.column.parsed.table == table &&
+            is_key_value( right, left->type, tables, count ))
+            set_key( table, left, right, *wildcard + 1 );
+        else if ((right->type == EXPR_COL_NUMBER || right->type == EXPR_COL_NUMBER32 ||
+                  right->type == EXPR_COL_NUMBER_STRING) && right->u.column.parsed.table == table &&
+                 is_key_value( left, right->type, tables, count ))
+            set_key( table, right, left, *wildcard + count_wildcards( right ) + 1 );
+    }
+
+    *wildcard += count_wildcards( expr );
+}
+
 /* reorders the tablelist in a way to evaluate the condition as fast as possible */
 static struct join_table **ordertables( MSIWHEREVIEW *wv )
 {
     struct join_table *table, **tables;
+    UINT i, wildcard;
 
     tables = calloc(wv->table_count + 1, sizeof(*tables));
 
@@ -807,6 +979,21 @@ static struct join_table **ordertables( MSIWHEREVIEW *wv )
         add_to_array(tables, table);
         table = table->next;
     }
+
+    /* use the table indexes for equality joins and comparisons to constants,
+     * instead of scanning every row of the inner tables */
+    for (i = 0; i < wv->table_count; i++)
+    {
+        tables[i]->key_value = NULL;
+        if (!wv->cond || !tables[i]->view->ops->find_matching_rows)
+            continue;
+
+        wildcard = 0;
+        find_key( tables, i, wv->cond, &wildcard );
+        if (tables[i]->key_value)
+            TRACE("looking up rows of table %u through column %u\n", tables[i]->table_index,
+                  tables[i]->key_column);
+    }
     return tables;
 }
 
@@ -34,6 +34,7 @@
 #include "winternl.h"
 #include "ntdll_misc.h"
 #include "wine/list.h"
+#include "wine/heap_stats.h"
 #include "wine/debug.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(heap);
@@ -122,10 +123,13 @@ C_ASSERT( sizeof(struct entry) == 2 * BLOCK_ALIGN );
 
 typedef struct
 {
-    SIZE_T __pad[sizeof(SIZE_T) / sizeof(DWORD)];
+#ifdef _WIN64
+    SIZE_T __pad;
+#endif
     struct list           entry;      /* entry in heap large blocks list */
     SIZE_T                data_size;  /* size of user data */
     SIZE_T                block_size; /* total size of virtual memory block */
+    SIZE_T                reserve_size; /* size of the reserved address space, from the arena */
     void                 *user_value;
     struct block block;
 } ARENA_LARGE;
@@ -167,6 +171,12 @@ C_ASSERT( HEAP_MAX_FREE_BLOCK_SIZE >= HEAP_MAX_BLOCK_REGION_SIZE );
 
 /* minimum size to start allocating large blocks */
 #define HEAP_MIN_LARGE_BLOCK_SIZE  (HEAP_MAX_USED_BLOCK_SIZE - 0x1000)
+/* address space reserved after large blocks, so that they can grow in place */
+#ifdef _WIN64
+#define HEAP_MAX_LARGE_BLOCK_HEADROOM  ((SIZE_T)1 << 30)
+#else
+#define HEAP_MAX_LARGE_BLOCK_HEADROOM  0
+#endif
 
 #define FREE_LIST_LINEAR_BITS 2
 #define FREE_LIST_LINEAR_MASK ((1 << FREE_LIST_LINEAR_BITS) - 1)
@@ -276,6 +286,20 @@ static inline struct group **bin_get_affinity_group( struct bin *bin, BYTE affin
     return bin->affinity_group_base + affinity * BLOCK_SIZE_BIN_COUNT;
 }
 
+/* allocation statistics, kept for each thread affinity so that threads don't share counters */
+struct DECLSPEC_ALIGN(64) heap_stats
+{
+    LONG64 alloc_lfh;
+    LONG64 free_lfh;
+    LONG64 alloc_std;
+    LONG64 free_std;
+    LONG64 alloc_large;
+    LONG64 free_large;
+    LONG64 realloc_in_place;
+    LONG64 bin_alloc[BLOCK_SIZE_BIN_COUNT];
+    LONG64 bin_freed[BLOCK_SIZE_BIN_COUNT];
+};
+
 struct heap
 {                                  /* win32/win64 */
     DWORD_PTR        unknown1[2];   /* 0000/0000 */
@@ -289,6 +313,7 @@ struct heap
     /* end of the Windows 10 compatible struct layout */
 
     LONG             compat_info;   /* HeapCompatibilityInformation / heap frontend type */
+    LONG             cache_id;      /* unique id, to detect destroyed heaps in thread caches */
     struct list      entry;         /* Entry in process heap list */
     struct list      subheap_list;  /* Sub-heap list */
     struct list      large_list;    /* Large blocks list */
@@ -300,6 +325,7 @@ struct heap
     RTL_CRITICAL_SECTION cs;
     struct entry     free_lists[FREE_LIST_COUNT];
     struct bin      *bins;
+    struct heap_stats *stats;       /* allocation statistics, for each thread affinity */
     SUBHEAP          subheap;
 };
 
@@ -330,10 +356,15 @@ C_ASSERT( HEAP_MIN_LARGE_BLOCK_SIZE <= HEAP_INITIAL_GROW_SIZE );
 
 BOOL delay_heap_free = FALSE;
 BOOL heap_zero_hack = FALSE;
+BOOL heap_thread_cache = FALSE;
+BOOL heap_dump_stats = FALSE;
+
+static LONG next_heap_cache_id;
 
 static struct heap *process_heap;  /* main process heap */
 
 static NTSTATUS heap_free_block_lfh( struct heap *heap, ULONG flags, struct block *block );
+static void thread_cache_remove_heap( struct heap *heap );
 
 /* check if memory range a contains memory range b */
 static inline BOOL contains( const void *a, SIZE_T a_size, const void *b, SIZE_T b_size )
@@ -1002,15 +1033,18 @@ static NTSTATUS heap_allocate_large( struct heap *heap, ULONG flags, SIZE_T bloc
                                      SIZE_T size, void **ret )
 {
     ARENA_LARGE *arena;
-    SIZE_T total_size = ROUND_SIZE( sizeof(*arena) + size, REGION_ALIGN - 1 );
+    SIZE_T total_size = ROUND_SIZE( sizeof(*arena) + size, REGION_ALIGN - 1 ), reserve_size;
     struct block *block;
 
     if (total_size < size) return STATUS_NO_MEMORY;  /* overflow */
-    if (!(arena = allocate_region( heap, flags, &total_size, &total_size ))) return STATUS_NO_MEMORY;
+    reserve_size = total_size + min( total_size, HEAP_MAX_LARGE_BLOCK_HEADROOM );
+    if (reserve_size < total_size) reserve_size = total_size;
+    if (!(arena = allocate_region( heap, flags, &reserve_size, &total_size ))) return STATUS_NO_MEMORY;
 
     block = &arena->block;
     arena->data_size = size;
     arena->block_size = (char *)arena + total_size - (char *)block;
+    arena->reserve_size = reserve_size;
 
     block_set_type( block, BLOCK_TYPE_LARGE );
     block_set_base( block, arena );
@@ -1513,7 +1547,7 @@ HANDLE WINAPI RtlCreateHeap( ULONG flags, void *addr, SIZE_T total_size, SIZE_T
 {
     struct entry *entry;
     struct heap *heap;
-    SIZE_T block_size;
+    SIZE_T block_size, size;
     SUBHEAP *subheap;
     unsigned int i;
 
@@ -1541,6 +1575,7 @@ HANDLE WINAPI RtlCreateHeap( ULONG flags, void *addr, SIZE_T total_size, SIZE_T
     heap->flags         = (flags & ~HEAP_SHARED);
     heap->compat_info   = HEAP_STD;
     heap->magic         = HEAP_MAGIC;
+    heap->stats         = NULL;
     heap->grow_size     = HEAP_INITIAL_GROW_SIZE;
     heap->min_size      = commit_size;
     list_init( &heap->subheap_list );
@@ -1582,10 +1617,14 @@ HANDLE WINAPI RtlCreateHeap( ULONG flags, void *addr, SIZE_T total_size, SIZE_T
     list_add_head( &heap->subheap_list, &subheap->entry );
 
     heap_set_debug_flags( heap );
+    heap->cache_id = InterlockedIncrement( &next_heap_cache_id );
+
+    size = sizeof(*heap->stats) * ARRAY_SIZE(affinity_mapping);
+    NtAllocateVirtualMemory( NtCurrentProcess(), (void *)&heap->stats, 0, &size, MEM_COMMIT, PAGE_READWRITE );
 
     if (heap->flags & HEAP_GROWABLE)
     {
-        SIZE_T size = (sizeof(struct bin) + sizeof(struct group *) * ARRAY_SIZE(affinity_mapping)) * BLOCK_SIZE_BIN_COUNT;
+        size = (sizeof(struct bin) + sizeof(struct group *) * ARRAY_SIZE(affinity_mapping)) * BLOCK_SIZE_BIN_COUNT;
         NtAllocateVirtualMemory( NtCurrentProcess(), (void *)&heap->bins,
                                  0, &size, MEM_COMMIT, PAGE_READWRITE );
 
@@ -1660,6 +1699,8 @@ HANDLE WINAPI RtlDestroyHeap( HANDLE handle )
 
     if (heap == process_heap) return handle; /* cannot delete the main process heap */
 
+    thread_cache_remove_heap( heap );
+
     /* remove it from the per-process list */
     RtlEnterCriticalSection( &process_heap->cs );
     list_remove( &heap->entry );
@@ -1690,6 +1731,11 @@ HANDLE WINAPI RtlDestroyHeap( HANDLE handle )
         size = 0;
         NtFreeVirtualMemory( NtCurrentProcess(), &addr, &size, MEM_RELEASE );
     }
+    if ((addr = heap->stats))
+    {
+        size = 0;
+        NtFreeVirtualMemory( NtCurrentProcess(), &addr, &size, MEM_RELEASE );
+    }
     size = 0;
     addr = heap;
     NtFreeVirtualMemory( NtCurrentProcess(), &addr, &size, MEM_RELEASE );
@@ -1932,6 +1978,183 @@ static struct block *find_free_bin_block( struct heap *heap, ULONG flags, SIZE_T
     return block;
 }
 
+/* give a block already marked as free back to its group */
+static NTSTATUS group_free_block( struct heap *heap, ULONG flags, struct bin *bin, struct block *block )
+{
+    struct group *group = block_get_group( block );
+    SIZE_T i = block_get_group_index( block );
+
+    /* if this was the last used block in a group and GROUP_FLAG_FREE was set */
+    if (InterlockedOr( &group->free_bits, 1 << i ) == ~(1 << i))
+    {
+        /* thread now owns the group, and can release it to its bin */
+        group->free_bits = ~GROUP_FLAG_FREE;
+        return heap_release_bin_group( heap, flags, bin, group );
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/* Per-thread cache of recently freed LFH blocks
+ *
+ * Freed blocks are kept, already marked as free, in per-thread magazines for
+ * each bin, and handed back to the next allocation of the same bin from that
+ * thread without touching the shared group free bits. The magazines are given
+ * back to their groups when the thread exits or when the heap is compacted.
+ */
+
+#define THREAD_CACHE_HEAPS  2
+#define THREAD_CACHE_BINS   0x40
+#define THREAD_CACHE_DEPTH  8
+#define THREAD_CACHE_NONE   ((struct thread_cache *)~(UINT_PTR)0)
+
+struct thread_cache_heap
+{
+    struct heap  *heap;
+    LONG          cache_id;
+    BYTE          count[THREAD_CACHE_BINS];
+    struct block *blocks[THREAD_CACHE_BINS][THREAD_CACHE_DEPTH];
+};
+
+struct thread_cache
+{
+    struct thread_cache_heap heaps[THREAD_CACHE_HEAPS];
+    UINT                     next_evict;
+};
+
+/* the TLS slot is only reserved, and must only be accessed, when the cache is enabled */
+static inline struct thread_cache **thread_cache_ptr(void)
+{
+    return (struct thread_cache **)&NtCurrentTeb()->TlsSlots[NTDLL_TLS_HEAP_CACHE];
+}
+
+static struct thread_cache *get_thread_cache( BOOL create )
+{
+    struct thread_cache **ptr, *cache;
+
+    if (!heap_thread_cache) return NULL;
+    ptr = thread_cache_ptr();
+    cache = *ptr;
+
+    /* THREAD_CACHE_NONE is set while the cache is allocated and after the thread detached */
+    if (cache == THREAD_CACHE_NONE) return NULL;
+    if (cache || !create) return cache;
+
+    *ptr = THREAD_CACHE_NONE;
+    cache = RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(*cache) );
+    *ptr = cache;
+    return cache;
+}
+
+/* check that a cached heap still exists, process heap lock must be held */
+static BOOL thread_cache_heap_alive( const struct thread_cache_heap *entry )
+{
+    struct heap *heap;
+
+    if (entry->heap == process_heap) return entry->cache_id == process_heap->cache_id;
+    LIST_FOR_EACH_ENTRY( heap, &process_heap->entry, struct heap, entry )
+        if (heap == entry->heap) return entry->cache_id == heap->cache_id;
+    return FALSE;
+}
+
+/* give the cached blocks back to their groups, heap must be alive */
+static void thread_cache_flush( struct thread_cache_heap *entry )
+{
+    struct heap *heap = entry->heap;
+    UINT i;
+
+    for (i = 0; i < THREAD_CACHE_BINS; i++)
+        while (entry->count[i]) group_free_block( heap, heap->flags, heap->bins + i, entry->blocks[i][--entry->count[i]] );
+}
+
+static struct thread_cache_heap *thread_cache_get_heap( struct heap *heap, BOOL create )
+{
+    struct thread_cache *cache;
+    struct thread_cache_heap *entry;
+    UINT i;
+
+    if (!(cache = get_thread_cache( create ))) return NULL;
+
+    for (i = 0; i < THREAD_CACHE_HEAPS; i++)
+    {
+        entry = cache->heaps + i;
+        if (entry->heap != heap) continue;
+        if (entry->cache_id == heap->cache_id) return entry;
+        /* the heap was destroyed and another one created at the same address */
+        memset( entry->count, 0, sizeof(entry->count) );
+        entry->cache_id = heap->cache_id;
+        return entry;
+    }
+    if (!create) return NULL;
+
+    for (i = 0; i < THREAD_CACHE_HEAPS; i++) if (!cache->heaps[i].heap) break;
+    if (i == THREAD_CACHE_HEAPS)
+    {
+        i = cache->next_evict++ % THREAD_CACHE_HEAPS;
+        RtlEnterCriticalSection( &process_heap->cs );
+        if (thread_cache_heap_alive( cache->heaps + i )) thread_cache_flush( cache->heaps + i );
+        RtlLeaveCriticalSection( &process_heap->cs );
+    }
+
+    entry = cache->heaps + i;
+    memset( entry->count, 0, sizeof(entry->count) );
+    entry->heap = heap;
+    entry->cache_id = heap->cache_id;
+    return entry;
+}
+
+static struct block *thread_cache_get_block( struct heap *heap, UINT bin )
+{
+    struct thread_cache_heap *entry;
+
+    if (bin >= THREAD_CACHE_BINS || !(entry = thread_cache_get_heap( heap, FALSE ))) return NULL;
+    if (!entry->count[bin]) return NULL;
+    return entry->blocks[bin][--entry->count[bin]];
+}
+
+static BOOL thread_cache_put_block( struct heap *heap, UINT bin, struct block *block )
+{
+    struct thread_cache_heap *entry;
+
+    if (bin >= THREAD_CACHE_BINS || !(entry = thread_cache_get_heap( heap, TRUE ))) return FALSE;
+    if (entry->count[bin] == THREAD_CACHE_DEPTH) return FALSE;
+    entry->blocks[bin][entry->count[bin]++] = block;
+    return TRUE;
+}
+
+static void thread_cache_flush_heap( struct heap *heap )
+{
+    struct thread_cache_heap *entry;
+
+    if ((entry = thread_cache_get_heap( heap, FALSE ))) thread_cache_flush( entry );
+}
+
+/* forget the cached blocks of a heap being destroyed */
+static void thread_cache_remove_heap( struct heap *heap )
+{
+    struct thread_cache_heap *entry;
+
+    if ((entry = thread_cache_get_heap( heap, FALSE ))) entry->heap = NULL;
+}
+
+/* release the current thread cache, process heap lock must be held */
+static void thread_cache_detach(void)
+{
+    struct thread_cache **ptr, *cache;
+    UINT i;
+
+    if (!heap_thread_cache) return;
+    ptr = thread_cache_ptr();
+    cache = *ptr;
+
+    *ptr = THREAD_CACHE_NONE;
+    if (!cache || cache == THREAD_CACHE_NONE) return;
+
+    for (i = 0; i < THREAD_CACHE_HEAPS; i++)
+        if (thread_cache_heap_alive( cache->heaps + i )) thread_cache_flush( cache->heaps + i );
+    RtlFreeHeap( GetProcessHeap(), 0, cache );
+}
+
 static NTSTATUS heap_allocate_block_lfh( struct heap *heap, ULONG flags, SIZE_T block_size,
                                          SIZE_T size, void **ret )
 {
@@ -1946,7 +2169,8 @@ static NTSTATUS heap_allocate_block_lfh( struct heap *heap, ULONG flags, SIZE_T
 
     block_size = BLOCK_BIN_SIZE( BLOCK_SIZE_BIN( block_size ) );
 
-    if ((block = find_free_bin_block( heap, flags, block_size, bin )))
+    if ((block = thread_cache_get_block( heap, bin - heap->bins )) ||
+        (block = find_free_bin_block( heap, flags, block_size, bin )))
     {
         block_set_type( block, BLOCK_TYPE_USED );
         block_set_flags( block, (BYTE)~BLOCK_FLAG_LFH, BLOCK_USER_FLAGS( flags ) );
@@ -1962,30 +2186,20 @@ static NTSTATUS heap_allocate_block_lfh( struct heap *heap, ULONG flags, SIZE_T
 static NTSTATUS heap_free_block_lfh( struct heap *heap, ULONG flags, struct block *block )
 {
     struct bin *bin, *last = heap->bins + BLOCK_SIZE_BIN_COUNT - 1;
-    SIZE_T i, block_size = block_get_size( block );
-    struct group *group = block_get_group( block );
-    NTSTATUS status = STATUS_SUCCESS;
+    SIZE_T block_size = block_get_size( block );
 
     if (!(block_get_flags( block ) & BLOCK_FLAG_LFH)) return STATUS_UNSUCCESSFUL;
 
     bin = heap->bins + BLOCK_SIZE_BIN( block_size );
     if (bin == last) return STATUS_UNSUCCESSFUL;
 
-    i = block_get_group_index( block );
     valgrind_make_writable( block, sizeof(*block) );
     block_set_type( block, BLOCK_TYPE_FREE );
     block_set_flags( block, (BYTE)~BLOCK_FLAG_LFH, BLOCK_FLAG_FREE );
     mark_block_free( block + 1, (char *)block + block_size - (char *)(block + 1), flags );
 
-    /* if this was the last used block in a group and GROUP_FLAG_FREE was set */
-    if (InterlockedOr( &group->free_bits, 1 << i ) == ~(1 << i))
-    {
-        /* thread now owns the group, and can release it to its bin */
-        group->free_bits = ~GROUP_FLAG_FREE;
-        status = heap_release_bin_group( heap, flags, bin, group );
-    }
-
-    return status;
+    if (thread_cache_put_block( heap, bin - heap->bins, block )) return STATUS_SUCCESS;
+    return group_free_block( heap, flags, bin, block );
 }
 
 static void bin_try_enable( struct heap *heap, struct bin *bin )
@@ -2038,6 +2252,8 @@ void heap_thread_detach(void)
 
     RtlEnterCriticalSection( &process_heap->cs );
 
+    thread_cache_detach();
+
     LIST_FOR_EACH_ENTRY( heap, &process_heap->entry, struct heap, entry )
         heap_thread_detach_bin_groups( heap );
 
@@ -2046,6 +2262,32 @@ void heap_thread_detach(void)
     RtlLeaveCriticalSection( &process_heap->cs );
 }
 
+/* get the allocation statistics of the current thread affinity */
+static inline struct heap_stats *heap_get_thread_stats( struct heap *heap )
+{
+    if (!heap->stats) return NULL;
+    return heap->stats + heap_current_thread_affinity();
+}
+
+/* update the allocation statistics, when a block is allocated or freed */
+static void heap_update_stats( struct heap *heap, struct heap_stats *stats, BYTE flags, SIZE_T block_size, BOOL alloc )
+{
+    SIZE_T bin;
+
+    if (flags & BLOCK_FLAG_LARGE)
+    {
+        InterlockedIncrement64( alloc ? &stats->alloc_large : &stats->free_large );
+        return;
+    }
+
+    if (flags & BLOCK_FLAG_LFH) InterlockedIncrement64( alloc ? &stats->alloc_lfh : &stats->free_lfh );
+    else InterlockedIncrement64( alloc ? &stats->alloc_std : &stats->free_std );
+
+    if (!heap->bins) return;
+    bin = BLOCK_SIZE_BIN( block_size );
+    InterlockedIncrement64( alloc ? &stats->bin_alloc[bin] : &stats->bin_freed[bin] );
+}
+
 /***********************************************************************
  *           RtlAllocateHeap   (NTDLL.@)
  */
@@ -2078,7 +2320,15 @@ void *WINAPI DECLSPEC_HOTPATCH RtlAllocateHeap( HANDLE handle, ULONG flags, SIZE
         }
     }
 
-    if (!status) valgrind_notify_alloc( ptr, size, flags & HEAP_ZERO_MEMORY );
+    if (!status)
+    {
+        const struct block *block = (struct block *)ptr - 1;
+        struct heap_stats *stats;
+
+        if ((stats = heap_get_thread_stats( heap )))
+            heap_update_stats( heap, stats, block_get_flags( block ), block_get_size( block ), TRUE );
+        valgrind_notify_alloc( ptr, size, flags & HEAP_ZERO_MEMORY );
+    }
 
     TRACE( "handle %p, flags %#lx, size %#Ix, return %p, status %#lx.\n", handle, flags, size, ptr, status );
     heap_set_status( heap, flags, status );
@@ -2104,21 +2354,29 @@ BOOLEAN WINAPI DECLSPEC_HOTPATCH RtlFreeHeap( HANDLE handle, ULONG flags, void *
         status = STATUS_INVALID_PARAMETER;
     else if (!(block = unsafe_block_from_ptr( heap, heap_flags, ptr )))
         status = STATUS_INVALID_PARAMETER;
-    else if (block_get_flags( block ) & BLOCK_FLAG_LARGE)
-        status = heap_free_large( heap, heap_flags, block );
-    else if (!(block = heap_delay_free( heap, heap_flags, block )))
-        status = STATUS_SUCCESS;
-    else if (!heap_free_block_lfh( heap, heap_flags, block ))
-        status = STATUS_SUCCESS;
     else
     {
-        SIZE_T block_size = block_get_size( block ), bin = BLOCK_SIZE_BIN( block_size );
+        struct heap_stats *stats;
 
-        heap_lock( heap, heap_flags );
-        status = heap_free_block( heap, heap_flags, block );
-        heap_unlock( heap, heap_flags );
+        if ((stats = heap_get_thread_stats( heap )))
+            heap_update_stats( heap, stats, block_get_flags( block ), block_get_size( block ), FALSE );
 
-        if (!status && heap->bins) InterlockedIncrement( &heap->bins[bin].count_freed );
+        if (block_get_flags( block ) & BLOCK_FLAG_LARGE)
+            status = heap_free_large( heap, heap_flags, block );
+        else if (!(block = heap_delay_free( heap, heap_flags, block )))
+            status = STATUS_SUCCESS;
+        else if (!heap_free_block_lfh( heap, heap_flags, block ))
+            status = STATUS_SUCCESS;
+        else
+        {
+            SIZE_T block_size = block_get_size( block ), bin = BLOCK_SIZE_BIN( block_size );
+
+            heap_lock( heap, heap_flags );
+            status = heap_free_block( heap, heap_flags, block );
+            heap_unlock( heap, heap_flags );
+
+            if (!status && heap->bins) InterlockedIncrement( &heap->bins[bin].count_freed );
+        }
     }
 
     TRACE( "handle %p, flags %#lx, ptr %p, return %u, status %#lx.\n", handle, flags, ptr, !status, status );
@@ -2133,15 +2391,36 @@ static NTSTATUS heap_resize_large( struct heap *heap, ULONG flags, struct block
     SIZE_T old_block_size = large->block_size;
     *old_size = large->data_size;
 
-    if (old_block_size < block_size) return STATUS_NO_MEMORY;
+    if (old_block_size < block_size)
+    {
+        /* commit more of the address space reserved after the block, if there's enough */
+        SIZE_T total_size = ROUND_SIZE( sizeof(*large) + size, REGION_ALIGN - 1 ), commit_size;
+        char *commit_end = (char *)block + old_block_size;
+        MEMORY_BASIC_INFORMATION info;
+        void *addr = commit_end;
+
+        if (total_size < size) return STATUS_NO_MEMORY;  /* overflow */
+        if ((char *)large + total_size <= commit_end) return STATUS_NO_MEMORY;
+        commit_size = (char *)large + total_size - commit_end;
+
+        if (NtQueryVirtualMemory( NtCurrentProcess(), commit_end, MemoryBasicInformation,
+                                  &info, sizeof(info), NULL )) return STATUS_NO_MEMORY;
+        if (info.State != MEM_RESERVE || info.AllocationBase != large) return STATUS_NO_MEMORY;
+        if (info.RegionSize < commit_size) return STATUS_NO_MEMORY;
+        if (NtAllocateVirtualMemory( NtCurrentProcess(), &addr, 0, &commit_size, MEM_COMMIT,
+                                     get_protection_type( flags ) )) return STATUS_NO_MEMORY;
+
+        heap_lock( heap, flags );
+        large->block_size = (char *)addr + commit_size - (char *)block;
+        heap_unlock( heap, flags );
+    }
 
-    /* FIXME: we could remap zero-pages instead */
     valgrind_notify_resize( block + 1, *old_size, size );
     initialize_block( block, *old_size, size, flags );
 
     large->data_size = size;
     valgrind_make_noaccess( (char *)block + sizeof(*block) + large->data_size,
-                            old_block_size - sizeof(*block) - large->data_size );
+                            large->block_size - sizeof(*block) - large->data_size );
 
     *ret = block + 1;
     return STATUS_SUCCESS;
@@ -2241,10 +2520,12 @@ static NTSTATUS heap_resize_in_place( struct heap *heap, ULONG flags, struct blo
  */
 void *WINAPI RtlReAllocateHeap( HANDLE handle, ULONG flags, void *ptr, SIZE_T size )
 {
-    SIZE_T block_size, old_size;
+    SIZE_T block_size, old_size, old_block_size;
+    struct heap_stats *stats;
     struct block *block;
     struct heap *heap;
     ULONG heap_flags;
+    BYTE old_flags;
     void *ret = NULL;
     NTSTATUS status;
 
@@ -2256,10 +2537,22 @@ void *WINAPI RtlReAllocateHeap( HANDLE handle, ULONG flags, void *ptr, SIZE_T si
         status = STATUS_NO_MEMORY;
     else if (!(block = unsafe_block_from_ptr( heap, heap_flags, ptr )))
         status = STATUS_INVALID_PARAMETER;
-    else if ((status = heap_resize_in_place( heap, heap_flags, block, block_size, size,
-                                        &old_size, &ret )))
+    else
     {
-        if (flags & HEAP_REALLOC_IN_PLACE_ONLY)
+        old_flags = block_get_flags( block );
+        old_block_size = block_get_size( block );
+
+        if (!(status = heap_resize_in_place( heap, heap_flags, block, block_size, size, &old_size, &ret )))
+        {
+            /* account it as a free and an allocation, the block may have moved to another bin */
+            if ((stats = heap_get_thread_stats( heap )))
+            {
+                heap_update_stats( heap, stats, old_flags, old_block_size, FALSE );
+                heap_update_stats( heap, stats, block_get_flags( block ), block_get_size( block ), TRUE );
+                InterlockedIncrement64( &stats->realloc_in_place );
+            }
+        }
+        else if (flags & HEAP_REALLOC_IN_PLACE_ONLY)
             status = STATUS_NO_MEMORY;
         else if (!(ret = RtlAllocateHeap( heap, flags, size )))
             status = STATUS_NO_MEMORY;
@@ -2295,6 +2588,12 @@ void *WINAPI RtlReAllocateHeap( HANDLE handle, ULONG flags, void *ptr, SIZE_T si
 ULONG WINAPI RtlCompactHeap( HANDLE handle, ULONG flags )
 {
     static BOOL reported;
+    struct heap *heap;
+    ULONG heap_flags;
+
+    if ((heap = unsafe_heap_from_handle( handle, flags, &heap_flags )) && heap->bins)
+        thread_cache_flush_heap( heap );
+
     if (!reported++) FIXME( "handle %p, flags %#lx stub!\n", handle, flags );
     return 0;
 }
@@ -2566,6 +2865,118 @@ ULONG WINAPI RtlGetProcessHeaps( ULONG count, HANDLE *heaps )
     return total;
 }
 
+static void heap_get_statistics( struct heap *heap, ULONG flags, HEAP_WINE_STATISTICS *stats )
+{
+    const struct entry *entry;
+    const ARENA_LARGE *large;
+    const SUBHEAP *subheap;
+    const struct list *ptr;
+    SIZE_T size;
+    ULONG i, j;
+
+    memset( stats, 0, offsetof(HEAP_WINE_STATISTICS, Bins[0]) );
+
+    heap_lock( heap, flags );
+
+    LIST_FOR_EACH_ENTRY( subheap, &heap->subheap_list, SUBHEAP, entry )
+    {
+        stats->ReservedSize += subheap_size( subheap );
+        stats->CommittedSize += (char *)subheap_commit_end( subheap ) - (char *)subheap_base( subheap );
+        stats->SubheapCount++;
+    }
+
+    LIST_FOR_EACH_ENTRY( large, &heap->large_list, ARENA_LARGE, entry )
+    {
+        size = (char *)&large->block + large->block_size - (char *)large;
+        stats->ReservedSize += large->reserve_size;
+        stats->CommittedSize += size;
+        stats->LargeBlocksSize += size;
+        stats->LargeBlockCount++;
+    }
+
+    /* only the free lists are walked, used blocks are accounted as committed minus free size */
+    ptr = &heap->free_lists[0].entry;
+    while ((ptr = list_next( &heap->free_lists[0].entry, ptr )))
+    {
+        entry = LIST_ENTRY( ptr, struct entry, entry );
+        if (block_get_flags( &entry->block ) == BLOCK_FLAG_FREE_LINK) continue;
+        size = block_get_size( &entry->block );
+        stats->FreeSize += size;
+        stats->LargestFreeSize = max( stats->LargestFreeSize, size );
+        stats->FreeBlockCount++;
+    }
+
+    heap_unlock( heap, flags );
+
+    stats->BinCount = heap->bins ? BLOCK_SIZE_BIN_COUNT : 0;
+    for (i = 0; i < stats->BinCount; i++)
+    {
+        stats->Bins[i].BlockSize = BLOCK_BIN_SIZE( i );
+        stats->Bins[i].Allocations = 0;
+        stats->Bins[i].Frees = 0;
+        stats->Bins[i].LfhEnabled = !!ReadNoFence( &heap->bins[i].enabled );
+    }
+
+    /* sum the counters of all the thread affinities */
+    for (j = 0; heap->stats && j < ARRAY_SIZE(affinity_mapping); j++)
+    {
+        const struct heap_stats *thread_stats = heap->stats + j;
+
+        stats->LfhAllocations += thread_stats->alloc_lfh;
+        stats->LfhFrees += thread_stats->free_lfh;
+        stats->StandardAllocations += thread_stats->alloc_std;
+        stats->StandardFrees += thread_stats->free_std;
+        stats->LargeAllocations += thread_stats->alloc_large;
+        stats->LargeFrees += thread_stats->free_large;
+        stats->InPlaceReallocations += thread_stats->realloc_in_place;
+        for (i = 0; i < stats->BinCount; i++)
+        {
+            stats->Bins[i].Allocations += thread_stats->bin_alloc[i];
+            stats->Bins[i].Frees += thread_stats->bin_freed[i];
+        }
+    }
+}
+
+static void heap_dump_statistics( struct heap *heap )
+{
+    HEAP_WINE_STATISTICS *stats;
+    SIZE_T size = offsetof(HEAP_WINE_STATISTICS, Bins[BLOCK_SIZE_BIN_COUNT]);
+    ULONG i;
+
+    if (!(stats = RtlAllocateHeap( process_heap, 0, size ))) return;
+    heap_get_statistics( heap, heap->flags, stats );
+
+    MESSAGE( "heap %p: reserved %#Ix, committed %#Ix, free %#Ix in %lu blocks, largest free %#Ix, "
+             "large blocks %lu of %#Ix, subheaps %lu\n", heap, stats->ReservedSize, stats->CommittedSize,
+             stats->FreeSize, stats->FreeBlockCount, stats->LargestFreeSize, stats->LargeBlockCount,
+             stats->LargeBlocksSize, stats->SubheapCount );
+    MESSAGE( "heap %p: lfh alloc %I64u free %I64u, std alloc %I64u free %I64u, large alloc %I64u free %I64u, "
+             "in place realloc %I64u\n", heap, stats->LfhAllocations, stats->LfhFrees, stats->StandardAllocations,
+             stats->StandardFrees, stats->LargeAllocations, stats->LargeFrees, stats->InPlaceReallocations );
+    for (i = 0; i < stats->BinCount; i++)
+    {
+        if (!stats->Bins[i].Allocations) continue;
+        MESSAGE( "heap %p:   bin %3lu: size %#6Ix, alloc %I64u, free %I64u%s\n", heap, i, stats->Bins[i].BlockSize,
+                 stats->Bins[i].Allocations, stats->Bins[i].Frees, stats->Bins[i].LfhEnabled ? ", lfh" : "" );
+    }
+
+    RtlFreeHeap( process_heap, 0, stats );
+}
+
+/* dump the statistics of all the process heaps, enabled with WINE_HEAP_STATS */
+void heap_dump_all_statistics(void)
+{
+    struct heap *heap;
+
+    if (!heap_dump_stats) return;
+
+    RtlEnterCriticalSection( &process_heap->cs );
+    heap_dump_statistics( process_heap );
+    LIST_FOR_EACH_ENTRY( heap, &process_heap->entry, struct heap, entry )
+        heap_dump_statistics( heap );
+    RtlLeaveCriticalSection( &process_heap->cs );
+}
+
 /***********************************************************************
  *           RtlQueryHeapInformation    (NTDLL.@)
  */
@@ -2577,7 +2988,7 @@ NTSTATUS WINAPI RtlQueryHeapInformation( HANDLE handle, HEAP_INFORMATION_CLASS i
 
     TRACE( "handle %p, info_class %u, info %p, size_in %Iu, size_out %p.\n", handle, info_class, info, size_in, size_out );
 
-    switch (info_class)
+    switch ((ULONG)info_class)
     {
     case HeapCompatibilityInformation:
         if (!(heap = unsafe_heap_from_handle( handle, 0, &flags ))) return STATUS_ACCESS_VIOLATION;
@@ -2586,6 +2997,18 @@ NTSTATUS WINAPI RtlQueryHeapInformation( HANDLE handle, HEAP_INFORMATION_CLASS i
         *(ULONG *)info = ReadNoFence( &heap->compat_info );
         return STATUS_SUCCESS;
 
+    case HeapWineStatistics:
+    {
+        SIZE_T size;
+
+        if (!(heap = unsafe_heap_from_handle( handle, 0, &flags ))) return STATUS_ACCESS_VIOLATION;
+        size = offsetof(HEAP_WINE_STATISTICS, Bins[heap->bins ? BLOCK_SIZE_BIN_COUNT : 0]);
+        if (size_out) *size_out = size;
+        if (size_in < size) return STATUS_BUFFER_TOO_SMALL;
+        heap_get_statistics( heap, flags, info );
+        return STATUS_SUCCESS;
+    }
+
     default:
         FIXME( "HEAP_INFORMATION_CLASS %u not implemented!\n", info_class );
         return STATUS_INVALID_INFO_CLASS;
@@ -2602,7 +3025,7 @@ NTSTATUS WINAPI RtlSetHeapInformation( HANDLE handle, HEAP_INFORMATION_CLASS inf
 
     TRACE( "handle %p, info_class %u, info %p, size %Iu.\n", handle, info_class, info, size );
 
-    switch (info_class)
+    switch ((ULONG)info_class)
     {
     case HeapCompatibilityInformation:
     {
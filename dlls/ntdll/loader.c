@@ -4021,6 +4021,7 @@ void WINAPI LdrShutdownProcess(void)
         RtlProcessFlsData( NtCurrentTeb()->FlsSlots, 1 );
 
     process_detach();
+    heap_dump_all_statistics();
 }
 
 
@@ -4544,6 +4545,13 @@ void loader_init( CONTEXT *context, void **entry )
             ERR( "Enabling heap zero hack.\n" );
             heap_zero_hack = TRUE;
         }
+        if (get_env( L"WINE_HEAP_THREAD_CACHE", env_str, sizeof(env_str)) && env_str[0] == L'1')
+        {
+            TRACE( "Enabling per-thread heap cache.\n" );
+            heap_thread_cache = TRUE;
+        }
+        if (get_env( L"WINE_HEAP_STATS", env_str, sizeof(env_str)) && env_str[0] == L'1')
+            heap_dump_stats = TRUE;
 
         peb->ProcessHeap        = RtlCreateHeap( heap_flags, NULL, 0, 0, NULL, NULL );
 
@@ -4553,6 +4561,7 @@ void loader_init( CONTEXT *context, void **entry )
         /* TLS index 0 is always reserved, and wow64 reserves extra TLS entries */
         RtlSetBits( peb->TlsBitmap, 0, NtCurrentTeb()->WowTebOffset ? WOW64_TLS_MAX_NUMBER : 1 );
         RtlSetBits( peb->TlsBitmap, NTDLL_TLS_ERRNO, 1 );
+        if (heap_thread_cache) RtlSetBits( peb->TlsBitmap, NTDLL_TLS_HEAP_CACHE, 1 );
 
         /* initialize hash table */
         for (i = 0; i < HASH_MAP_SIZE; i++)
@@ -40,6 +40,7 @@
 #define MAX_NT_PATH_LENGTH 277
 
 #define NTDLL_TLS_ERRNO 16  /* TLS slot for _errno() */
+#define NTDLL_TLS_HEAP_CACHE 17  /* TLS slot for the heap thread cache */
 
 #if defined(__i386__) || defined(__x86_64__) || defined(__arm__) || defined(__aarch64__)
 static const UINT_PTR page_size = 0x1000;
@@ -49,6 +50,8 @@ extern UINT_PTR page_size;
 
 extern BOOL delay_heap_free;
 extern BOOL heap_zero_hack;
+extern BOOL heap_thread_cache;
+extern BOOL heap_dump_stats;
 
 /* exceptions */
 extern LONG call_vectored_handlers( EXCEPTION_RECORD *rec, CONTEXT *context );
@@ -133,6 +136,7 @@ static inline void ascii_to_unicode( WCHAR *dst, const char *src, size_t len )
 /* FLS data */
 extern TEB_FLS_DATA *fls_alloc_data(void);
 extern void heap_thread_detach(void);
+extern void heap_dump_all_statistics(void);
 
 #ifdef __arm64ec__
 
@@ -836,25 +836,48 @@ struct futex_entry
     DWORD tid;
 };
 
-struct futex_queue
+/* The table of queues has a fixed size, and waiters are woken one by one with
+ * NtAlertThreadByThreadId, since alerting a thread must also end its wait.
+ * Waking all the waiters on an address is thus linear in their number, but no
+ * system call is made while a queue is locked. */
+
+/* each queue has its own cache line, so that waiters on unrelated addresses don't contend */
+struct DECLSPEC_ALIGN(64) futex_queue
 {
     struct list queue;
     LONG lock;
 };
 
-static struct futex_queue futex_queues[256];
+#define FUTEX_QUEUE_BITS 10
+
+static struct futex_queue futex_queues[1 << FUTEX_QUEUE_BITS];
 
 static struct futex_queue *get_futex_queue( const void *addr )
 {
     ULONG_PTR val = (ULONG_PTR)addr;
-
-    return &futex_queues[(val >> 4) % ARRAY_SIZE(futex_queues)];
+    ULONG hash = (ULONG)(val >> 2);
+
+#ifdef _WIN64
+    hash ^= (ULONG)(val >> 32);
+#endif
+    /* multiplicative hashing spreads neighbouring addresses over the whole table */
+    hash *= 0x9e3779b1;
+    return &futex_queues[hash >> (32 - FUTEX_QUEUE_BITS)];
 }
 
 static void spin_lock( LONG *lock )
 {
+    unsigned int spins = 0;
+
     while (InterlockedCompareExchange( lock, -1, 0 ))
-        YieldProcessor();
+    {
+        /* wait for the lock to look free before retrying, and yield if its owner got preempted */
+        while (ReadNoFence( lock ))
+        {
+            if (++spins < 128) YieldProcessor();
+            else NtYieldExecution();
+        }
+    }
 }
 
 static void spin_unlock( LONG *lock )
@@ -937,37 +960,39 @@ void WINAPI RtlWakeAddressAll( const void *addr )
 {
     struct futex_queue *queue = get_futex_queue( addr );
     struct futex_entry *entry, *next;
-    unsigned int count = 0, i;
+    unsigned int count, i;
     DWORD tids[256];
 
     TRACE("%p\n", addr);
 
     if (!addr) return;
 
-    spin_lock( &queue->lock );
+    do
+    {
+        count = 0;
+        spin_lock( &queue->lock );
 
-    if (!queue->queue.next)
-        list_init(&queue->queue);
+        if (!queue->queue.next)
+            list_init(&queue->queue);
 
-    LIST_FOR_EACH_ENTRY_SAFE( entry, next, &queue->queue, struct futex_entry, entry )
-    {
-        if (entry->addr == addr)
+        LIST_FOR_EACH_ENTRY_SAFE( entry, next, &queue->queue, struct futex_entry, entry )
         {
-            entry->addr = NULL;
-            list_remove( &entry->entry );
-            /* Try to buffer wakes, so that we don't make a system call while
-             * holding a spinlock. */
-            if (count < ARRAY_SIZE(tids))
+            if (entry->addr == addr)
+            {
+                entry->addr = NULL;
+                list_remove( &entry->entry );
+                /* Buffer wakes, so that we don't make a system call while
+                 * holding a spinlock, and come back for the other waiters. */
                 tids[count++] = entry->tid;
-            else
-                NtAlertThreadByThreadId( (HANDLE)(DWORD_PTR)entry->tid );
+                if (count == ARRAY_SIZE(tids)) break;
+            }
         }
-    }
 
-    spin_unlock( &queue->lock );
+        spin_unlock( &queue->lock );
 
-    for (i = 0; i < count; ++i)
-        NtAlertThreadByThreadId( (HANDLE)(DWORD_PTR)tids[i] );
+        for (i = 0; i < count; ++i)
+            NtAlertThreadByThreadId( (HANDLE)(DWORD_PTR)tids[i] );
+    } while (count == ARRAY_SIZE(tids));
 }
 
 /***********************************************************************
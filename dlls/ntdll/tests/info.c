@@ -717,6 +717,95 @@ static void test_query_process( BOOL extended )
     winetest_pop_context();
 }
 
+static SYSTEM_PROCESS_INFORMATION *query_process_list(void)
+{
+    SYSTEM_PROCESS_INFORMATION *spi = NULL;
+    ULONG size = 0x10000;
+    NTSTATUS status;
+
+    for (;;)
+    {
+        spi = HeapAlloc( GetProcessHeap(), 0, size );
+        status = pNtQuerySystemInformation( SystemProcessInformation, spi, size, &size );
+        if (status != STATUS_INFO_LENGTH_MISMATCH) break;
+        HeapFree( GetProcessHeap(), 0, spi );
+    }
+    ok( status == STATUS_SUCCESS, "got %#lx\n", status );
+    return spi;
+}
+
+static DWORD count_process_threads( SYSTEM_PROCESS_INFORMATION *spi, DWORD tid, BOOL *found )
+{
+    DWORD i;
+
+    *found = FALSE;
+    for (;;)
+    {
+        if (HandleToUlong( spi->UniqueProcessId ) == GetCurrentProcessId())
+        {
+            for (i = 0; i < spi->dwThreadCount; i++)
+                if (HandleToUlong( spi->ti[i].ClientId.UniqueThread ) == tid) *found = TRUE;
+            return spi->dwThreadCount;
+        }
+        if (!spi->NextEntryOffset) return 0;
+        spi = (SYSTEM_PROCESS_INFORMATION *)((char *)spi + spi->NextEntryOffset);
+    }
+}
+
+static DWORD WINAPI process_list_thread( void *arg )
+{
+    WaitForSingleObject( arg, INFINITE );
+    return 0;
+}
+
+static void test_query_process_list_changes(void)
+{
+    SYSTEM_PROCESS_INFORMATION *spi;
+    HANDLE threads[50], event;
+    DWORD count, new_count, tid, start, i;
+    BOOL found;
+
+    event = CreateEventW( NULL, TRUE, FALSE, NULL );
+
+    spi = query_process_list();
+    count = count_process_threads( spi, GetCurrentThreadId(), &found );
+    ok( found, "current thread not found\n" );
+    HeapFree( GetProcessHeap(), 0, spi );
+
+    for (i = 0; i < ARRAY_SIZE(threads); i++)
+    {
+        threads[i] = CreateThread( NULL, 0, process_list_thread, event, 0, &tid );
+        ok( threads[i] != NULL, "CreateThread failed, error %lu\n", GetLastError() );
+    }
+
+    spi = query_process_list();
+    new_count = count_process_threads( spi, tid, &found );
+    ok( found, "new thread %04lx not found\n", tid );
+    ok( new_count >= count + ARRAY_SIZE(threads), "got %lu threads, expected at least %lu\n",
+        new_count, count + (DWORD)ARRAY_SIZE(threads) );
+    HeapFree( GetProcessHeap(), 0, spi );
+
+    /* repeated queries with an unchanged process list */
+    start = GetTickCount();
+    for (i = 0; i < 200; i++)
+    {
+        spi = query_process_list();
+        HeapFree( GetProcessHeap(), 0, spi );
+    }
+    trace( "200 process list queries took %lu ms\n", GetTickCount() - start );
+
+    SetEvent( event );
+    WaitForMultipleObjects( ARRAY_SIZE(threads), threads, TRUE, INFINITE );
+    for (i = 0; i < ARRAY_SIZE(threads); i++) CloseHandle( threads[i] );
+
+    spi = query_process_list();
+    count_process_threads( spi, tid, &found );
+    ok( !found, "thread %04lx still listed after exit\n", tid );
+    HeapFree( GetProcessHeap(), 0, spi );
+
+    CloseHandle( event );
+}
+
 static void test_query_procperf(void)
 {
     NTSTATUS status;
@@ -3984,6 +4073,7 @@ START_TEST(info)
     test_query_timeofday();
     test_query_process( TRUE );
     test_query_process( FALSE );
+    test_query_process_list_changes();
     test_query_procperf();
     test_query_module();
     test_query_handle();
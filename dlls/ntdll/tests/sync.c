@@ -603,6 +603,91 @@ static void test_wait_on_address(void)
     ok(address == 0, "got %s\n", wine_dbgstr_longlong(address));
 }
 
+static LONG wait_on_address_started;
+
+static DWORD WINAPI wait_on_address_thread(void *arg)
+{
+    LONG *address = arg, compare = 0;
+    NTSTATUS status;
+
+    InterlockedIncrement(&wait_on_address_started);
+    while (!ReadAcquire(address))
+    {
+        status = pRtlWaitOnAddress(address, &compare, sizeof(compare), NULL);
+        ok(!status, "got 0x%08lx\n", status);
+    }
+    return 0;
+}
+
+static void test_wait_on_address_threads(void)
+{
+    LONG shared, addresses[32];
+    HANDLE threads[32];
+    DWORD ret, start;
+    unsigned int i;
+
+    if (!pRtlWaitOnAddress)
+    {
+        win_skip("RtlWaitOnAddress not supported, skipping test\n");
+        return;
+    }
+
+    /* many waiters on the same address */
+    shared = 0;
+    wait_on_address_started = 0;
+    for (i = 0; i < ARRAY_SIZE(threads); i++)
+        threads[i] = CreateThread(NULL, 0, wait_on_address_thread, &shared, 0, NULL);
+    while (ReadAcquire(&wait_on_address_started) < ARRAY_SIZE(threads)) Sleep(1);
+    Sleep(50);
+
+    /* all the waiters wake up, and none of them returns before the wake */
+    ret = WaitForMultipleObjects(ARRAY_SIZE(threads), threads, FALSE, 0);
+    ok(ret == WAIT_TIMEOUT, "got %lu\n", ret);
+    start = GetTickCount();
+    WriteRelease(&shared, 1);
+    pRtlWakeAddressAll(&shared);
+    ret = WaitForMultipleObjects(ARRAY_SIZE(threads), threads, TRUE, 5000);
+    ok(ret == WAIT_OBJECT_0, "got %lu\n", ret);
+    trace("woke %u waiters on one address in %lu ms\n", (UINT)ARRAY_SIZE(threads), GetTickCount() - start);
+    for (i = 0; i < ARRAY_SIZE(threads); i++) CloseHandle(threads[i]);
+
+    /* waiters on many neighbouring addresses */
+    memset(addresses, 0, sizeof(addresses));
+    wait_on_address_started = 0;
+    for (i = 0; i < ARRAY_SIZE(threads); i++)
+        threads[i] = CreateThread(NULL, 0, wait_on_address_thread, addresses + i, 0, NULL);
+    while (ReadAcquire(&wait_on_address_started) < ARRAY_SIZE(threads)) Sleep(1);
+    Sleep(50);
+
+    /* waking every other address leaves the waiters on the neighbouring ones alone */
+    start = GetTickCount();
+    for (i = 0; i < ARRAY_SIZE(threads); i += 2)
+    {
+        WriteRelease(addresses + i, 1);
+        pRtlWakeAddressAll(addresses + i);
+    }
+    for (i = 0; i < ARRAY_SIZE(threads); i += 2)
+    {
+        ret = WaitForSingleObject(threads[i], 5000);
+        ok(ret == WAIT_OBJECT_0, "%u: got %lu\n", i, ret);
+    }
+    for (i = 1; i < ARRAY_SIZE(threads); i += 2)
+    {
+        ret = WaitForSingleObject(threads[i], 0);
+        ok(ret == WAIT_TIMEOUT, "%u: got %lu\n", i, ret);
+    }
+
+    for (i = 1; i < ARRAY_SIZE(threads); i += 2)
+    {
+        WriteRelease(addresses + i, 1);
+        pRtlWakeAddressSingle(addresses + i);
+    }
+    ret = WaitForMultipleObjects(ARRAY_SIZE(threads), threads, TRUE, 5000);
+    ok(ret == WAIT_OBJECT_0, "got %lu\n", ret);
+    trace("woke %u waiters on different addresses in %lu ms\n", (UINT)ARRAY_SIZE(threads), GetTickCount() - start);
+    for (i = 0; i < ARRAY_SIZE(threads); i++) CloseHandle(threads[i]);
+}
+
 static HANDLE thread_ready, thread_done;
 
 static DWORD WINAPI resource_shared_thread(void *arg)
@@ -942,6 +1027,7 @@ START_TEST(sync)
     pRtlWakeAddressSingle           = (void *)GetProcAddress(module, "RtlWakeAddressSingle");
 
     test_wait_on_address();
+    test_wait_on_address_threads();
     test_event();
     test_mutant();
     test_semaphore();
@@ -479,6 +479,48 @@ static void test_user_shared_data_time(void)
             t1, timeofday.TimeZoneBias.QuadPart);
 }
 
+static void test_syscall_overhead(void)
+{
+    static const unsigned int count = 100000;
+    MEMORY_BASIC_INFORMATION mbi;
+    LARGE_INTEGER start, end, freq, counter;
+    NTSTATUS status;
+    unsigned int i;
+    ULONG cpu = 0;
+    TEB *teb = NULL;
+
+    QueryPerformanceFrequency( &freq );
+
+    QueryPerformanceCounter( &start );
+    for (i = 0; i < count; i++) teb = NtCurrentTeb();
+    QueryPerformanceCounter( &end );
+    ok( teb == NtCurrentTeb(), "got teb %p\n", teb );
+    trace( "NtCurrentTeb: %I64u ns/call\n",
+           (end.QuadPart - start.QuadPart) * 1000000000 / freq.QuadPart / count );
+
+    QueryPerformanceCounter( &start );
+    for (i = 0; i < count; i++) cpu = NtGetCurrentProcessorNumber();
+    QueryPerformanceCounter( &end );
+    ok( cpu < 1024, "got processor %lu\n", cpu );
+    trace( "NtGetCurrentProcessorNumber: %I64u ns/call\n",
+           (end.QuadPart - start.QuadPart) * 1000000000 / freq.QuadPart / count );
+
+    QueryPerformanceCounter( &start );
+    for (i = 0; i < count; i++) pNtQueryPerformanceCounter( &counter, NULL );
+    QueryPerformanceCounter( &end );
+    ok( counter.QuadPart >= start.QuadPart, "counter went backwards\n" );
+    trace( "NtQueryPerformanceCounter: %I64u ns/call\n",
+           (end.QuadPart - start.QuadPart) * 1000000000 / freq.QuadPart / count );
+
+    QueryPerformanceCounter( &start );
+    for (i = 0; i < count; i++)
+        status = NtQueryVirtualMemory( GetCurrentProcess(), &mbi, MemoryBasicInformation, &mbi, sizeof(mbi), NULL );
+    QueryPerformanceCounter( &end );
+    ok( !status, "NtQueryVirtualMemory failed %#lx\n", status );
+    trace( "NtQueryVirtualMemory: %I64u ns/call\n",
+           (end.QuadPart - start.QuadPart) * 1000000000 / freq.QuadPart / count );
+}
+
 START_TEST(time)
 {
     HMODULE mod = GetModuleHandleA("ntdll.dll");
@@ -505,4 +547,5 @@ START_TEST(time)
     test_RtlQueryPerformanceCounter();
 #endif
     test_TimerResolution();
+    test_syscall_overhead();
 }
@@ -163,6 +163,18 @@ typedef struct
 #define AT_NO_AUTOMOUNT 0x800
 #endif
 
+/* Define the ioctl to share extents between files, supported by btrfs and xfs */
+#ifndef FICLONERANGE
+struct file_clone_range
+{
+    int64_t  src_fd;
+    uint64_t src_offset;
+    uint64_t src_length;
+    uint64_t dest_offset;
+};
+#define FICLONERANGE _IOW(0x94, 13, struct file_clone_range)
+#endif
+
 #endif  /* linux */
 
 #define IS_SEPARATOR(ch)   ((ch) == '\\' || (ch) == '/')
@@ -6539,6 +6551,75 @@ static void ignore_server_ioctl_struct_holes( ULONG code, const void *in_buffer,
 }
 
 
+/* copy a range of data between two files without going through user space, reflinking it when possible */
+NTSTATUS copy_file_range_unix( int src_fd, ULONGLONG src_offset, int dst_fd, ULONGLONG dst_offset,
+                               ULONGLONG count )
+{
+#ifdef linux
+    struct file_clone_range range;
+
+    /* a zero length would clone up to the end of the source file */
+    if (!count) return STATUS_SUCCESS;
+
+    range.src_fd = src_fd;
+    range.src_offset = src_offset;
+    range.src_length = count;
+    range.dest_offset = dst_offset;
+    if (!ioctl( dst_fd, FICLONERANGE, &range )) return STATUS_SUCCESS;
+
+#ifdef __NR_copy_file_range
+    while (count)
+    {
+        loff_t src_pos = src_offset, dst_pos = dst_offset;
+        ssize_t ret = syscall( __NR_copy_file_range, src_fd, &src_pos, dst_fd, &dst_pos, count, 0 );
+
+        if (ret < 0)
+        {
+            if (errno == EINTR) continue;
+            if (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP)
+                return STATUS_NOT_SUPPORTED;
+            return errno_to_status( errno );
+        }
+        if (!ret) return STATUS_END_OF_FILE;
+        src_offset += ret;
+        dst_offset += ret;
+        count -= ret;
+    }
+    return STATUS_SUCCESS;
+#endif
+#endif
+    return STATUS_NOT_SUPPORTED;
+}
+
+static NTSTATUS duplicate_extents( HANDLE handle, const DUPLICATE_EXTENTS_DATA *data, ULONG size )
+{
+    int src_fd, dst_fd, src_needs_close, dst_needs_close;
+    enum server_fd_type src_type, dst_type;
+    HANDLE source;
+    NTSTATUS status;
+
+    if (!data || size < sizeof(*data)) return STATUS_INVALID_PARAMETER;
+    if (data->SourceFileOffset.QuadPart < 0 || data->TargetFileOffset.QuadPart < 0 ||
+        data->ByteCount.QuadPart < 0)
+        return STATUS_INVALID_PARAMETER;
+
+    /* the 32-bit structure has the same layout, but only the low part of the handle is set */
+    source = is_wow64() ? ULongToHandle( *(const ULONG *)&data->FileHandle ) : data->FileHandle;
+
+    if ((status = server_get_unix_fd( handle, FILE_WRITE_DATA, &dst_fd, &dst_needs_close, &dst_type, NULL )))
+        return status;
+    if (!(status = server_get_unix_fd( source, FILE_READ_DATA, &src_fd, &src_needs_close, &src_type, NULL )))
+    {
+        if (src_type != FD_TYPE_FILE || dst_type != FD_TYPE_FILE) status = STATUS_INVALID_DEVICE_REQUEST;
+        else status = copy_file_range_unix( src_fd, data->SourceFileOffset.QuadPart, dst_fd,
+                                            data->TargetFileOffset.QuadPart, data->ByteCount.QuadPart );
+        if (src_needs_close) close( src_fd );
+    }
+    if (dst_needs_close) close( dst_fd );
+    return status;
+}
+
+
 /******************************************************************************
  *              NtFsControlFile   (NTDLL.@)
  */
@@ -6637,6 +6718,11 @@ NTSTATUS WINAPI NtFsControlFile( HANDLE handle, HANDLE event, PIO_APC_ROUTINE ap
         io->Information = 0;
         status = STATUS_SUCCESS;
         break;
+
+    case FSCTL_DUPLICATE_EXTENTS_TO_FILE:
+        io->Information = 0;
+        status = duplicate_extents( handle, in_buffer, in_size );
+        break;
     default:
         return server_ioctl_file( handle, event, apc, apc_context, io, code,
                                   in_buffer, in_size, out_buffer, out_size );
@@ -145,6 +145,19 @@ SYSTEM_SERVICE_TABLE KeServiceDescriptorTable[4] =
     { (ULONG_PTR *)syscalls, NULL, ARRAY_SIZE(syscalls), syscall_args }
 };
 
+/* bitmap of the syscalls using the lightweight transition, indexed by (table << 12) | number */
+UINT leaf_syscall_map[ARRAY_SIZE(KeServiceDescriptorTable) * 0x1000 / 32];
+
+/* syscalls that don't block, raise exceptions, or call back into PE code */
+static const void * const leaf_syscalls[] =
+{
+    NtGetCurrentProcessorNumber,
+    NtQueryPerformanceCounter,
+    NtQuerySystemTime,
+    NtQueryTimerResolution,
+    NtYieldExecution,
+};
+
 #ifdef __GNUC__
 static void fatal_error( const char *err, ... ) __attribute__((noreturn, format(printf,1,2)));
 #endif
@@ -715,6 +728,35 @@ BOOLEAN KeAddSystemServiceTable( ULONG_PTR *funcs, ULONG_PTR *counters, ULONG li
 }
 
 
+/***********************************************************************
+ *           ntdll_add_leaf_syscalls
+ *
+ * Mark syscalls of a service table as leaf functions. They must not block,
+ * raise exceptions or call back into PE code, as the dispatcher may then skip
+ * saving the extended processor state.
+ */
+BOOLEAN ntdll_add_leaf_syscalls( ULONG index, const void * const *funcs, ULONG count )
+{
+    const SYSTEM_SERVICE_TABLE *table;
+    ULONG i, id;
+
+    if (index >= ARRAY_SIZE(KeServiceDescriptorTable)) return FALSE;
+    table = &KeServiceDescriptorTable[index];
+
+    for (i = 0; i < count; i++)
+    {
+        for (id = 0; id < table->ServiceLimit; id++)
+        {
+            if ((const void *)table->ServiceTable[id] != funcs[i]) continue;
+            id |= index << 12;
+            leaf_syscall_map[id / 32] |= 1u << (id % 32);
+            break;
+        }
+    }
+    return TRUE;
+}
+
+
 /*************************************************************************
  *		map_so_dll
  *
@@ -2167,6 +2209,7 @@ static void start_main_thread(void)
 
     signal_init_threading();
     signal_alloc_thread( teb );
+    ntdll_add_leaf_syscalls( 0, leaf_syscalls, ARRAY_SIZE(leaf_syscalls) );
     dbg_init();
     startup_info_size = server_init_process();
     hacks_init();
@@ -26,6 +26,7 @@
 
 #include <assert.h>
 #include <ctype.h>
+#include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
 #ifdef HAVE_LWP_H
@@ -1281,6 +1282,155 @@ static const char *init_server_dir( dev_t dev, ino_t ino )
 }
 
 
+/***********************************************************************
+ *           clone_file
+ *
+ * Copy a regular file, sharing its data with the source when the file system supports it.
+ */
+static int clone_file( const char *src, const char *dst, const struct stat *st )
+{
+    char buffer[65536];
+    ssize_t size;
+    int src_fd, dst_fd, ret = -1;
+
+    if ((src_fd = open( src, O_RDONLY )) == -1) return -1;
+    if ((dst_fd = open( dst, O_WRONLY | O_CREAT | O_EXCL, st->st_mode & 0777 )) != -1)
+    {
+        if (!copy_file_range_unix( src_fd, 0, dst_fd, 0, st->st_size )) ret = 0;
+        else
+        {
+            while ((size = read( src_fd, buffer, sizeof(buffer) )) > 0)
+                if (write( dst_fd, buffer, size ) != size) break;
+            if (!size) ret = 0;
+        }
+        close( dst_fd );
+    }
+    close( src_fd );
+    return ret;
+}
+
+
+/***********************************************************************
+ *           clone_dir
+ *
+ * Recursively copy the contents of a template directory.
+ */
+static int clone_dir( const char *src, const char *dst )
+{
+    DIR *dir;
+    struct dirent *de;
+    struct stat st;
+    char *src_name, *dst_name, *link;
+    int ret = 0;
+
+    if (!(dir = opendir( src ))) return -1;
+    while (!ret && (de = readdir( dir )))
+    {
+        if (!strcmp( de->d_name, "." ) || !strcmp( de->d_name, ".." )) continue;
+        if (!strcmp( de->d_name, ".wineserver" )) continue;
+        if (asprintf( &src_name, "%s/%s", src, de->d_name ) == -1) ret = -1;
+        else if (asprintf( &dst_name, "%s/%s", dst, de->d_name ) == -1)
+        {
+            free( src_name );
+            ret = -1;
+        }
+        if (ret == -1) break;
+
+        if (lstat( src_name, &st ) == -1) ret = -1;
+        else if (S_ISDIR( st.st_mode ))
+        {
+            if (mkdir( dst_name, st.st_mode & 0777 ) == -1) ret = -1;
+            else ret = clone_dir( src_name, dst_name );
+        }
+        else if (S_ISLNK( st.st_mode ))
+        {
+            ret = -1;
+            if ((link = malloc( st.st_size + 1 )))
+            {
+                if (readlink( src_name, link, st.st_size + 1 ) == st.st_size)
+                {
+                    link[st.st_size] = 0;
+                    ret = symlink( link, dst_name );
+                }
+                free( link );
+            }
+        }
+        else if (S_ISREG( st.st_mode )) ret = clone_file( src_name, dst_name, &st );
+
+        if (ret == -1) ERR( "failed to copy %s to %s: %s\n", src_name, dst_name, strerror( errno ));
+        free( src_name );
+        free( dst_name );
+    }
+    closedir( dir );
+    return ret;
+}
+
+
+/***********************************************************************
+ *           remove_dir
+ *
+ * Recursively remove a directory, without following symlinks.
+ */
+static void remove_dir( const char *path )
+{
+    DIR *dir;
+    struct dirent *de;
+    struct stat st;
+    char *name;
+
+    if ((dir = opendir( path )))
+    {
+        while ((de = readdir( dir )))
+        {
+            if (!strcmp( de->d_name, "." ) || !strcmp( de->d_name, ".." )) continue;
+            if (asprintf( &name, "%s/%s", path, de->d_name ) == -1) continue;
+            if (!lstat( name, &st ) && S_ISDIR( st.st_mode )) remove_dir( name );
+            else unlink( name );
+            free( name );
+        }
+        closedir( dir );
+    }
+    rmdir( path );
+}
+
+
+/***********************************************************************
+ *           clone_config_dir
+ *
+ * Create the configuration dir as a copy of a template prefix. The copy is
+ * done in a temporary directory that is renamed once it is complete. The
+ * wineserver must not be running on the template while it's being copied.
+ */
+static BOOL clone_config_dir( const char *template )
+{
+    LARGE_INTEGER start, end, freq;
+    char *tmp_dir;
+    BOOL ret = FALSE;
+
+    NtQueryPerformanceCounter( &start, &freq );
+    if (asprintf( &tmp_dir, "%s.tmp-%u", config_dir, (int)getpid() ) == -1) return FALSE;
+    if (mkdir( tmp_dir, 0777 ) == -1)
+    {
+        free( tmp_dir );
+        return FALSE;
+    }
+    if (!clone_dir( template, tmp_dir ) && !rename( tmp_dir, config_dir ))
+    {
+        NtQueryPerformanceCounter( &end, NULL );
+        MESSAGE( "wine: created the configuration directory '%s' from '%s' in %u ms\n", config_dir, template,
+                 (unsigned int)((end.QuadPart - start.QuadPart) * 1000 / freq.QuadPart) );
+        ret = TRUE;
+    }
+    else
+    {
+        MESSAGE( "wine: failed to copy the template prefix '%s'\n", template );
+        remove_dir( tmp_dir );
+    }
+    free( tmp_dir );
+    return ret;
+}
+
+
 /***********************************************************************
  *           setup_config_dir
  *
@@ -1288,6 +1438,7 @@ static const char *init_server_dir( dev_t dev, ino_t ino )
  */
 static int setup_config_dir(void)
 {
+    const char *template;
     char *p;
     struct stat st;
     int fd_cwd = open( ".", O_RDONLY );
@@ -1304,9 +1455,12 @@ static int setup_config_dir(void)
                              config_dir );
             *p = '/';
         }
-        mkdir( config_dir, 0777 );
+        if (!(template = getenv( "WINEPREFIXTEMPLATE" )) || !clone_config_dir( template ))
+        {
+            mkdir( config_dir, 0777 );
+            MESSAGE( "wine: created the configuration directory '%s'\n", config_dir );
+        }
         if (chdir( config_dir ) == -1) fatal_perror( "chdir to %s", config_dir );
-        MESSAGE( "wine: created the configuration directory '%s'\n", config_dir );
     }
 
     if (stat( ".", &st ) == -1) fatal_perror( "stat %s", config_dir );
@@ -455,6 +455,7 @@ struct amd64_thread_data
     DWORD                 fs;            /* 0338 WOW TEB selector */
     DWORD                 xstate_features_size;  /* 033c */
     UINT64                xstate_features_mask;  /* 0340 */
+    UINT                 *leaf_syscalls; /* 0348 bitmap of lightweight syscalls */
 };
 
 C_ASSERT( sizeof(struct amd64_thread_data) <= sizeof(((struct ntdll_thread_data *)0)->cpu_data) );
@@ -464,6 +465,7 @@ C_ASSERT( offsetof( TEB, GdiTebBatch ) + offsetof( struct amd64_thread_data, sys
 C_ASSERT( offsetof( TEB, GdiTebBatch ) + offsetof( struct amd64_thread_data, fs ) == 0x338 );
 C_ASSERT( offsetof( TEB, GdiTebBatch ) + offsetof( struct amd64_thread_data, xstate_features_size ) == 0x33c );
 C_ASSERT( offsetof( TEB, GdiTebBatch ) + offsetof( struct amd64_thread_data, xstate_features_mask ) == 0x340 );
+C_ASSERT( offsetof( TEB, GdiTebBatch ) + offsetof( struct amd64_thread_data, leaf_syscalls ) == 0x348 );
 
 static inline struct amd64_thread_data *amd64_thread_data(void)
 {
@@ -2864,6 +2866,7 @@ void call_init_thunk( LPTHREAD_START_ROUTINE entry, void *arg, BOOL suspend, TEB
     I386_CONTEXT *wow_context;
 
     thread_data->syscall_table = KeServiceDescriptorTable;
+    thread_data->leaf_syscalls = leaf_syscall_map;
     thread_data->xstate_features_mask = xstate_supported_features_mask;
     assert( thread_data->xstate_features_size == xstate_features_size );
 
@@ -3037,6 +3040,16 @@ __ASM_GLOBAL_FUNC( __wine_syscall_dispatcher,
                     * depends on us returning to it. Adjust the return address accordingly. */
                    "subq $0xb,0x70(%rcx)\n\t"
                    "movl 0xb0(%rcx),%r14d\n\t"     /* frame->syscall_flags */
+#ifdef __APPLE__
+                   "movq %gs:0x30,%rdx\n\t"
+                   "movq 0x348(%rdx),%rdx\n\t"
+#else
+                   "movq %gs:0x348,%rdx\n\t"       /* amd64_thread_data()->leaf_syscalls */
+#endif
+                   "movl %eax,%ebp\n\t"
+                   "andl $0x3fff,%ebp\n\t"         /* syscall table and number */
+                   "btl %ebp,(%rdx)\n\t"
+                   "jc 4f\n\t"
                    "testl $3,%r14d\n\t"            /* SYSCALL_HAVE_XSAVE | SYSCALL_HAVE_XSAVEC */
                    "jz 2f\n\t"
 #ifdef __APPLE__
@@ -3064,7 +3077,19 @@ __ASM_GLOBAL_FUNC( __wine_syscall_dispatcher,
                    "jmp 3f\n"
                    "1:\txsave64 0xc0(%rcx)\n\t"
                    "jmp 3f\n"
-                   "2:\tfxsave64 0xc0(%rcx)\n"
+                   "2:\tfxsave64 0xc0(%rcx)\n\t"
+                   "jmp 3f\n"
+                   /* leaf syscall, only save the non-volatile registers like unix calls */
+                   "4:\tmovdqa %xmm6,0x1c0(%rcx)\n\t"
+                   "movdqa %xmm7,0x1d0(%rcx)\n\t"
+                   "movdqa %xmm8,0x1e0(%rcx)\n\t"
+                   "movdqa %xmm9,0x1f0(%rcx)\n\t"
+                   "movdqa %xmm10,0x200(%rcx)\n\t"
+                   "movdqa %xmm11,0x210(%rcx)\n\t"
+                   "movdqa %xmm12,0x220(%rcx)\n\t"
+                   "movdqa %xmm13,0x230(%rcx)\n\t"
+                   "movdqa %xmm14,0x240(%rcx)\n\t"
+                   "movdqa %xmm15,0x250(%rcx)\n"
                    "3:\tleaq 0x98(%rcx),%rbp\n\t"
                    __ASM_CFI_CFA_IS_AT1(rbp, 0x70)
                    __ASM_CFI_REG_IS_AT1(rip, rbp, 0x58)
@@ -2859,6 +2859,91 @@ static void read_dev_urandom( void *buf, ULONG len )
     else WARN( "can't open /dev/urandom\n" );
 }
 
+#if defined(__i386__) || defined(__x86_64__)
+#define __SHARED_READ_SEQ( x )  (x)
+#define __SHARED_READ_FENCE     do {} while(0)
+#else
+#define __SHARED_READ_SEQ( x )  __atomic_load_n( &(x), __ATOMIC_RELAXED )
+#define __SHARED_READ_FENCE     __atomic_thread_fence( __ATOMIC_ACQUIRE )
+#endif
+
+/* map the process snapshot maintained by the server */
+static const process_snapshot_shm_t *get_process_snapshot_shared_memory(void)
+{
+    static const WCHAR snapshotW[] =
+    {
+        '\\','K','e','r','n','e','l','O','b','j','e','c','t','s','\\',
+        '_','_','w','i','n','e','_','t','h','r','e','a','d','_','m','a','p','p','i','n','g','s','\\',
+        '_','_','w','i','n','e','_','p','r','o','c','e','s','s','_','s','n','a','p','s','h','o','t',0
+    };
+    static const process_snapshot_shm_t *snapshot;
+    const process_snapshot_shm_t *ret;
+    OBJECT_ATTRIBUTES attr;
+    UNICODE_STRING nameW;
+    SIZE_T size = sizeof(*ret);
+    HANDLE handle;
+    void *ptr = NULL;
+
+    __WINE_ATOMIC_LOAD_ACQUIRE( &snapshot, &ret );
+    if (ret) return ret;
+
+    init_unicode_string( &nameW, snapshotW );
+    InitializeObjectAttributes( &attr, &nameW, 0, 0, NULL );
+    if (NtOpenSection( &handle, SECTION_MAP_READ, &attr )) return NULL;
+    if (NtMapViewOfSection( handle, NtCurrentProcess(), &ptr, 0, 0, NULL, &size, ViewShare, 0, PAGE_READONLY ))
+        ptr = NULL;
+    NtClose( handle );
+    if (!ptr) return NULL;
+
+    if ((ret = InterlockedCompareExchangePointer( (void **)&snapshot, ptr, NULL )))
+    {
+        NtUnmapViewOfSection( NtCurrentProcess(), ptr );
+        return ret;
+    }
+    return ptr;
+}
+
+/* copy the process list from the server snapshot, rebuilding it first if it is out of date */
+static char *read_process_snapshot( unsigned int *process_count, unsigned int *total_thread_count,
+                                    unsigned int *total_name_len )
+{
+    const process_snapshot_shm_t *snapshot = get_process_snapshot_shared_memory();
+    char *buffer = NULL, *new_buffer;
+    data_size_t info_size;
+    unsigned int seq, ret;
+
+    if (!snapshot || snapshot->built != snapshot->generation)
+    {
+        SERVER_START_REQ( update_process_snapshot )
+        {
+            ret = wine_server_call( req );
+        }
+        SERVER_END_REQ;
+        if (ret) return NULL;
+        if (!snapshot && !(snapshot = get_process_snapshot_shared_memory())) return NULL;
+    }
+
+    do
+    {
+        while ((seq = __SHARED_READ_SEQ( snapshot->seq )) & 1) YieldProcessor();
+        __SHARED_READ_FENCE;
+        info_size = min( snapshot->info_size, sizeof(snapshot->data) );
+        if (!(new_buffer = realloc( buffer, max( info_size, 1 ) )))
+        {
+            free( buffer );
+            return NULL;
+        }
+        buffer = new_buffer;
+        memcpy( buffer, (const char *)snapshot->data, info_size );
+        *process_count = snapshot->process_count;
+        *total_thread_count = snapshot->total_thread_count;
+        *total_name_len = snapshot->total_name_len;
+        __SHARED_READ_FENCE;
+    } while (__SHARED_READ_SEQ( snapshot->seq ) != seq);
+
+    return buffer;
+}
+
 static unsigned int get_system_process_info( SYSTEM_INFORMATION_CLASS class, void *info, ULONG size, ULONG *len )
 {
     unsigned int process_count, total_thread_count, total_name_len, i, j;
@@ -2876,17 +2961,22 @@ C_ASSERT( sizeof(struct process_info) <= sizeof(SYSTEM_PROCESS_INFORMATION) );
         thread_info_size = sizeof(SYSTEM_THREAD_INFORMATION);
 
     *len = 0;
-    if (size && !(buffer = malloc( size ))) return STATUS_NO_MEMORY;
-
-    SERVER_START_REQ( list_processes )
+    if ((buffer = read_process_snapshot( &process_count, &total_thread_count, &total_name_len )))
+        ret = STATUS_SUCCESS;
+    else
     {
-        wine_server_set_reply( req, buffer, size );
-        ret = wine_server_call( req );
-        total_thread_count = reply->total_thread_count;
-        total_name_len = reply->total_name_len;
-        process_count = reply->process_count;
+        if (size && !(buffer = malloc( size ))) return STATUS_NO_MEMORY;
+
+        SERVER_START_REQ( list_processes )
+        {
+            wine_server_set_reply( req, buffer, size );
+            ret = wine_server_call( req );
+            total_thread_count = reply->total_thread_count;
+            total_name_len = reply->total_name_len;
+            process_count = reply->process_count;
+        }
+        SERVER_END_REQ;
     }
-    SERVER_END_REQ;
 
     if (ret)
     {
@@ -319,6 +319,7 @@ extern void signal_init_process(void);
 extern void DECLSPEC_NORETURN signal_start_thread( PRTL_THREAD_START_ROUTINE entry, void *arg,
                                                    BOOL suspend, TEB *teb );
 extern SYSTEM_SERVICE_TABLE KeServiceDescriptorTable[4];
+extern UINT leaf_syscall_map[];
 extern void __wine_syscall_dispatcher(void);
 extern void DECLSPEC_NORETURN __wine_syscall_dispatcher_return( void *frame, ULONG_PTR retval );
 extern void __wine_unix_call_dispatcher(void);
@@ -356,6 +357,8 @@ extern NTSTATUS open_unix_file( HANDLE *handle, const char *unix_name, ACCESS_MA
                                 OBJECT_ATTRIBUTES *attr, ULONG attributes, ULONG sharing, ULONG disposition,
                                 ULONG options, void *ea_buffer, ULONG ea_length );
 extern NTSTATUS get_device_info( int fd, struct _FILE_FS_DEVICE_INFORMATION *info );
+extern NTSTATUS copy_file_range_unix( int src_fd, ULONGLONG src_offset, int dst_fd, ULONGLONG dst_offset,
+                                      ULONGLONG count );
 extern void init_files(void);
 extern void init_cpu_info(void);
 extern void add_completion( HANDLE handle, ULONG_PTR value, NTSTATUS status, ULONG info, BOOL async );
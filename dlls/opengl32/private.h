@@ -32,4 +32,25 @@ extern const void *extension_procs[];
 
 extern int WINAPI wglDescribePixelFormat( HDC hdc, int ipfd, UINT cjpfd, PIXELFORMATDESCRIPTOR *ppfd );
 
+#define COMMAND_BATCH_SIZE 0x10000
+
+/* per-thread buffer of calls waiting to be executed, stored in the TEB glReserved2 field */
+struct command_batch
+{
+    UINT size;       /* size of the recorded calls */
+    UINT count;      /* number of recorded calls */
+    BOOL executing;  /* the batch is being executed */
+    UINT padding;
+    char data[COMMAND_BATCH_SIZE];
+};
+
+extern void flush_command_batch( struct command_batch *batch );
+extern void batch_call( UINT code, void *params, UINT size );
+
+static inline void flush_batch(void)
+{
+    struct command_batch *batch = NtCurrentTeb()->glReserved2;
+    if (batch && batch->size) flush_command_batch( batch );
+}
+
 #endif /* __WINE_OPENGL32_PRIVATE_H */
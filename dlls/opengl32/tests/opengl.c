@@ -1074,6 +1074,38 @@ static void test_deletecontext(HWND hwnd, HDC hdc)
 }
 
 
+static void test_call_rate(void)
+{
+    GLfloat color[4];
+    DWORD start, i;
+    GLenum err;
+
+    /* state changes have to be visible to the following queries */
+    glColor4f( 0.25f, 0.5f, 0.75f, 1.0f );
+    glGetFloatv( GL_CURRENT_COLOR, color );
+    ok( color[0] == 0.25f && color[1] == 0.5f && color[2] == 0.75f && color[3] == 1.0f,
+        "got color %f,%f,%f,%f\n", color[0], color[1], color[2], color[3] );
+
+    while (glGetError()) ;
+    glEnable( 0xdead );
+    err = glGetError();
+    ok( err == GL_INVALID_ENUM, "got error %#x\n", err );
+
+    start = GetTickCount();
+    glBegin( GL_TRIANGLES );
+    for (i = 0; i < 300000; i++)
+    {
+        glColor3f( (i % 3) / 2.0f, 0.0f, 1.0f );
+        glVertex3f( (i % 3) - 1.0f, (i % 2) - 0.5f, 0.0f );
+    }
+    glEnd();
+    glFinish();
+    trace( "600000 immediate mode calls took %lu ms\n", GetTickCount() - start );
+
+    err = glGetError();
+    ok( err == GL_NO_ERROR, "got error %#x\n", err );
+}
+
 static void test_getprocaddress(HDC hdc)
 {
     const char *extensions = (const char*)glGetString(GL_EXTENSIONS);
@@ -2144,6 +2176,7 @@ START_TEST(opengl)
          * any WGL call :( On Wine this would work but not on real Windows because there can be different implementations (software, ICD, MCD).
          */
         init_functions();
+        test_call_rate();
         test_getprocaddress(hdc);
         test_deletecontext(hwnd, hdc);
         test_makecurrent(hdc);
@@ -82,17 +82,15 @@ BOOL WINAPI wglShareLists( HGLRC hrcSrvShare, HGLRC hrcSrvSource )
 void WINAPI glAccum( GLenum op, GLfloat value )
 {
     struct glAccum_params args = { .teb = NtCurrentTeb(), .op = op, .value = value };
-    NTSTATUS status;
     TRACE( "op %d, value %f\n", op, value );
-    if ((status = UNIX_CALL( glAccum, &args ))) WARN( "glAccum returned %#lx\n", status );
+    UNIX_BATCH( glAccum, &args );
 }
 
 void WINAPI glAlphaFunc( GLenum func, GLfloat ref )
 {
     struct glAlphaFunc_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref };
-    NTSTATUS status;
     TRACE( "func %d, ref %f\n", func, ref );
-    if ((status = UNIX_CALL( glAlphaFunc, &args ))) WARN( "glAlphaFunc returned %#lx\n", status );
+    UNIX_BATCH( glAlphaFunc, &args );
 }
 
 GLboolean WINAPI glAreTexturesResident( GLsizei n, const GLuint *textures, GLboolean *residences )
@@ -115,17 +113,15 @@ void WINAPI glArrayElement( GLint i )
 void WINAPI glBegin( GLenum mode )
 {
     struct glBegin_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glBegin, &args ))) WARN( "glBegin returned %#lx\n", status );
+    UNIX_BATCH( glBegin, &args );
 }
 
 void WINAPI glBindTexture( GLenum target, GLuint texture )
 {
     struct glBindTexture_params args = { .teb = NtCurrentTeb(), .target = target, .texture = texture };
-    NTSTATUS status;
     TRACE( "target %d, texture %d\n", target, texture );
-    if ((status = UNIX_CALL( glBindTexture, &args ))) WARN( "glBindTexture returned %#lx\n", status );
+    UNIX_BATCH( glBindTexture, &args );
 }
 
 void WINAPI glBitmap( GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap )
@@ -139,17 +135,15 @@ void WINAPI glBitmap( GLsizei width, GLsizei height, GLfloat xorig, GLfloat yori
 void WINAPI glBlendFunc( GLenum sfactor, GLenum dfactor )
 {
     struct glBlendFunc_params args = { .teb = NtCurrentTeb(), .sfactor = sfactor, .dfactor = dfactor };
-    NTSTATUS status;
     TRACE( "sfactor %d, dfactor %d\n", sfactor, dfactor );
-    if ((status = UNIX_CALL( glBlendFunc, &args ))) WARN( "glBlendFunc returned %#lx\n", status );
+    UNIX_BATCH( glBlendFunc, &args );
 }
 
 void WINAPI glCallList( GLuint list )
 {
     struct glCallList_params args = { .teb = NtCurrentTeb(), .list = list };
-    NTSTATUS status;
     TRACE( "list %d\n", list );
-    if ((status = UNIX_CALL( glCallList, &args ))) WARN( "glCallList returned %#lx\n", status );
+    UNIX_BATCH( glCallList, &args );
 }
 
 void WINAPI glCallLists( GLsizei n, GLenum type, const void *lists )
@@ -163,49 +157,43 @@ void WINAPI glCallLists( GLsizei n, GLenum type, const void *lists )
 void WINAPI glClear( GLbitfield mask )
 {
     struct glClear_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glClear, &args ))) WARN( "glClear returned %#lx\n", status );
+    UNIX_BATCH( glClear, &args );
 }
 
 void WINAPI glClearAccum( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
 {
     struct glClearAccum_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearAccum, &args ))) WARN( "glClearAccum returned %#lx\n", status );
+    UNIX_BATCH( glClearAccum, &args );
 }
 
 void WINAPI glClearColor( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
 {
     struct glClearColor_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearColor, &args ))) WARN( "glClearColor returned %#lx\n", status );
+    UNIX_BATCH( glClearColor, &args );
 }
 
 void WINAPI glClearDepth( GLdouble depth )
 {
     struct glClearDepth_params args = { .teb = NtCurrentTeb(), .depth = depth };
-    NTSTATUS status;
     TRACE( "depth %f\n", depth );
-    if ((status = UNIX_CALL( glClearDepth, &args ))) WARN( "glClearDepth returned %#lx\n", status );
+    UNIX_BATCH( glClearDepth, &args );
 }
 
 void WINAPI glClearIndex( GLfloat c )
 {
     struct glClearIndex_params args = { .teb = NtCurrentTeb(), .c = c };
-    NTSTATUS status;
     TRACE( "c %f\n", c );
-    if ((status = UNIX_CALL( glClearIndex, &args ))) WARN( "glClearIndex returned %#lx\n", status );
+    UNIX_BATCH( glClearIndex, &args );
 }
 
 void WINAPI glClearStencil( GLint s )
 {
     struct glClearStencil_params args = { .teb = NtCurrentTeb(), .s = s };
-    NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glClearStencil, &args ))) WARN( "glClearStencil returned %#lx\n", status );
+    UNIX_BATCH( glClearStencil, &args );
 }
 
 void WINAPI glClipPlane( GLenum plane, const GLdouble *equation )
@@ -219,9 +207,8 @@ void WINAPI glClipPlane( GLenum plane, const GLdouble *equation )
 void WINAPI glColor3b( GLbyte red, GLbyte green, GLbyte blue )
 {
     struct glColor3b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3b, &args ))) WARN( "glColor3b returned %#lx\n", status );
+    UNIX_BATCH( glColor3b, &args );
 }
 
 void WINAPI glColor3bv( const GLbyte *v )
@@ -235,9 +222,8 @@ void WINAPI glColor3bv( const GLbyte *v )
 void WINAPI glColor3d( GLdouble red, GLdouble green, GLdouble blue )
 {
     struct glColor3d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3d, &args ))) WARN( "glColor3d returned %#lx\n", status );
+    UNIX_BATCH( glColor3d, &args );
 }
 
 void WINAPI glColor3dv( const GLdouble *v )
@@ -251,9 +237,8 @@ void WINAPI glColor3dv( const GLdouble *v )
 void WINAPI glColor3f( GLfloat red, GLfloat green, GLfloat blue )
 {
     struct glColor3f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3f, &args ))) WARN( "glColor3f returned %#lx\n", status );
+    UNIX_BATCH( glColor3f, &args );
 }
 
 void WINAPI glColor3fv( const GLfloat *v )
@@ -267,9 +252,8 @@ void WINAPI glColor3fv( const GLfloat *v )
 void WINAPI glColor3i( GLint red, GLint green, GLint blue )
 {
     struct glColor3i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3i, &args ))) WARN( "glColor3i returned %#lx\n", status );
+    UNIX_BATCH( glColor3i, &args );
 }
 
 void WINAPI glColor3iv( const GLint *v )
@@ -283,9 +267,8 @@ void WINAPI glColor3iv( const GLint *v )
 void WINAPI glColor3s( GLshort red, GLshort green, GLshort blue )
 {
     struct glColor3s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3s, &args ))) WARN( "glColor3s returned %#lx\n", status );
+    UNIX_BATCH( glColor3s, &args );
 }
 
 void WINAPI glColor3sv( const GLshort *v )
@@ -299,9 +282,8 @@ void WINAPI glColor3sv( const GLshort *v )
 void WINAPI glColor3ub( GLubyte red, GLubyte green, GLubyte blue )
 {
     struct glColor3ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3ub, &args ))) WARN( "glColor3ub returned %#lx\n", status );
+    UNIX_BATCH( glColor3ub, &args );
 }
 
 void WINAPI glColor3ubv( const GLubyte *v )
@@ -315,9 +297,8 @@ void WINAPI glColor3ubv( const GLubyte *v )
 void WINAPI glColor3ui( GLuint red, GLuint green, GLuint blue )
 {
     struct glColor3ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3ui, &args ))) WARN( "glColor3ui returned %#lx\n", status );
+    UNIX_BATCH( glColor3ui, &args );
 }
 
 void WINAPI glColor3uiv( const GLuint *v )
@@ -331,9 +312,8 @@ void WINAPI glColor3uiv( const GLuint *v )
 void WINAPI glColor3us( GLushort red, GLushort green, GLushort blue )
 {
     struct glColor3us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3us, &args ))) WARN( "glColor3us returned %#lx\n", status );
+    UNIX_BATCH( glColor3us, &args );
 }
 
 void WINAPI glColor3usv( const GLushort *v )
@@ -347,9 +327,8 @@ void WINAPI glColor3usv( const GLushort *v )
 void WINAPI glColor4b( GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha )
 {
     struct glColor4b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4b, &args ))) WARN( "glColor4b returned %#lx\n", status );
+    UNIX_BATCH( glColor4b, &args );
 }
 
 void WINAPI glColor4bv( const GLbyte *v )
@@ -363,9 +342,8 @@ void WINAPI glColor4bv( const GLbyte *v )
 void WINAPI glColor4d( GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha )
 {
     struct glColor4d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4d, &args ))) WARN( "glColor4d returned %#lx\n", status );
+    UNIX_BATCH( glColor4d, &args );
 }
 
 void WINAPI glColor4dv( const GLdouble *v )
@@ -379,9 +357,8 @@ void WINAPI glColor4dv( const GLdouble *v )
 void WINAPI glColor4f( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
 {
     struct glColor4f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4f, &args ))) WARN( "glColor4f returned %#lx\n", status );
+    UNIX_BATCH( glColor4f, &args );
 }
 
 void WINAPI glColor4fv( const GLfloat *v )
@@ -395,9 +372,8 @@ void WINAPI glColor4fv( const GLfloat *v )
 void WINAPI glColor4i( GLint red, GLint green, GLint blue, GLint alpha )
 {
     struct glColor4i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4i, &args ))) WARN( "glColor4i returned %#lx\n", status );
+    UNIX_BATCH( glColor4i, &args );
 }
 
 void WINAPI glColor4iv( const GLint *v )
@@ -411,9 +387,8 @@ void WINAPI glColor4iv( const GLint *v )
 void WINAPI glColor4s( GLshort red, GLshort green, GLshort blue, GLshort alpha )
 {
     struct glColor4s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4s, &args ))) WARN( "glColor4s returned %#lx\n", status );
+    UNIX_BATCH( glColor4s, &args );
 }
 
 void WINAPI glColor4sv( const GLshort *v )
@@ -427,9 +402,8 @@ void WINAPI glColor4sv( const GLshort *v )
 void WINAPI glColor4ub( GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha )
 {
     struct glColor4ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4ub, &args ))) WARN( "glColor4ub returned %#lx\n", status );
+    UNIX_BATCH( glColor4ub, &args );
 }
 
 void WINAPI glColor4ubv( const GLubyte *v )
@@ -443,9 +417,8 @@ void WINAPI glColor4ubv( const GLubyte *v )
 void WINAPI glColor4ui( GLuint red, GLuint green, GLuint blue, GLuint alpha )
 {
     struct glColor4ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4ui, &args ))) WARN( "glColor4ui returned %#lx\n", status );
+    UNIX_BATCH( glColor4ui, &args );
 }
 
 void WINAPI glColor4uiv( const GLuint *v )
@@ -459,9 +432,8 @@ void WINAPI glColor4uiv( const GLuint *v )
 void WINAPI glColor4us( GLushort red, GLushort green, GLushort blue, GLushort alpha )
 {
     struct glColor4us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4us, &args ))) WARN( "glColor4us returned %#lx\n", status );
+    UNIX_BATCH( glColor4us, &args );
 }
 
 void WINAPI glColor4usv( const GLushort *v )
@@ -475,17 +447,15 @@ void WINAPI glColor4usv( const GLushort *v )
 void WINAPI glColorMask( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha )
 {
     struct glColorMask_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColorMask, &args ))) WARN( "glColorMask returned %#lx\n", status );
+    UNIX_BATCH( glColorMask, &args );
 }
 
 void WINAPI glColorMaterial( GLenum face, GLenum mode )
 {
     struct glColorMaterial_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
-    NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glColorMaterial, &args ))) WARN( "glColorMaterial returned %#lx\n", status );
+    UNIX_BATCH( glColorMaterial, &args );
 }
 
 void WINAPI glColorPointer( GLint size, GLenum type, GLsizei stride, const void *pointer )
@@ -499,57 +469,50 @@ void WINAPI glColorPointer( GLint size, GLenum type, GLsizei stride, const void
 void WINAPI glCopyPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum type )
 {
     struct glCopyPixels_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .width = width, .height = height, .type = type };
-    NTSTATUS status;
     TRACE( "x %d, y %d, width %d, height %d, type %d\n", x, y, width, height, type );
-    if ((status = UNIX_CALL( glCopyPixels, &args ))) WARN( "glCopyPixels returned %#lx\n", status );
+    UNIX_BATCH( glCopyPixels, &args );
 }
 
 void WINAPI glCopyTexImage1D( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border )
 {
     struct glCopyTexImage1D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .border = border };
-    NTSTATUS status;
     TRACE( "target %d, level %d, internalformat %d, x %d, y %d, width %d, border %d\n", target, level, internalformat, x, y, width, border );
-    if ((status = UNIX_CALL( glCopyTexImage1D, &args ))) WARN( "glCopyTexImage1D returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexImage1D, &args );
 }
 
 void WINAPI glCopyTexImage2D( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
 {
     struct glCopyTexImage2D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height, .border = border };
-    NTSTATUS status;
     TRACE( "target %d, level %d, internalformat %d, x %d, y %d, width %d, height %d, border %d\n", target, level, internalformat, x, y, width, height, border );
-    if ((status = UNIX_CALL( glCopyTexImage2D, &args ))) WARN( "glCopyTexImage2D returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexImage2D, &args );
 }
 
 void WINAPI glCopyTexSubImage1D( GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
 {
     struct glCopyTexSubImage1D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, x %d, y %d, width %d\n", target, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyTexSubImage1D, &args ))) WARN( "glCopyTexSubImage1D returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexSubImage1D, &args );
 }
 
 void WINAPI glCopyTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyTexSubImage2D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", target, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTexSubImage2D, &args ))) WARN( "glCopyTexSubImage2D returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexSubImage2D, &args );
 }
 
 void WINAPI glCullFace( GLenum mode )
 {
     struct glCullFace_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glCullFace, &args ))) WARN( "glCullFace returned %#lx\n", status );
+    UNIX_BATCH( glCullFace, &args );
 }
 
 void WINAPI glDeleteLists( GLuint list, GLsizei range )
 {
     struct glDeleteLists_params args = { .teb = NtCurrentTeb(), .list = list, .range = range };
-    NTSTATUS status;
     TRACE( "list %d, range %d\n", list, range );
-    if ((status = UNIX_CALL( glDeleteLists, &args ))) WARN( "glDeleteLists returned %#lx\n", status );
+    UNIX_BATCH( glDeleteLists, &args );
 }
 
 void WINAPI glDeleteTextures( GLsizei n, const GLuint *textures )
@@ -563,41 +526,36 @@ void WINAPI glDeleteTextures( GLsizei n, const GLuint *textures )
 void WINAPI glDepthFunc( GLenum func )
 {
     struct glDepthFunc_params args = { .teb = NtCurrentTeb(), .func = func };
-    NTSTATUS status;
     TRACE( "func %d\n", func );
-    if ((status = UNIX_CALL( glDepthFunc, &args ))) WARN( "glDepthFunc returned %#lx\n", status );
+    UNIX_BATCH( glDepthFunc, &args );
 }
 
 void WINAPI glDepthMask( GLboolean flag )
 {
     struct glDepthMask_params args = { .teb = NtCurrentTeb(), .flag = flag };
-    NTSTATUS status;
     TRACE( "flag %d\n", flag );
-    if ((status = UNIX_CALL( glDepthMask, &args ))) WARN( "glDepthMask returned %#lx\n", status );
+    UNIX_BATCH( glDepthMask, &args );
 }
 
 void WINAPI glDepthRange( GLdouble n, GLdouble f )
 {
     struct glDepthRange_params args = { .teb = NtCurrentTeb(), .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "n %f, f %f\n", n, f );
-    if ((status = UNIX_CALL( glDepthRange, &args ))) WARN( "glDepthRange returned %#lx\n", status );
+    UNIX_BATCH( glDepthRange, &args );
 }
 
 void WINAPI glDisable( GLenum cap )
 {
     struct glDisable_params args = { .teb = NtCurrentTeb(), .cap = cap };
-    NTSTATUS status;
     TRACE( "cap %d\n", cap );
-    if ((status = UNIX_CALL( glDisable, &args ))) WARN( "glDisable returned %#lx\n", status );
+    UNIX_BATCH( glDisable, &args );
 }
 
 void WINAPI glDisableClientState( GLenum array )
 {
     struct glDisableClientState_params args = { .teb = NtCurrentTeb(), .array = array };
-    NTSTATUS status;
     TRACE( "array %d\n", array );
-    if ((status = UNIX_CALL( glDisableClientState, &args ))) WARN( "glDisableClientState returned %#lx\n", status );
+    UNIX_BATCH( glDisableClientState, &args );
 }
 
 void WINAPI glDrawArrays( GLenum mode, GLint first, GLsizei count )
@@ -611,9 +569,8 @@ void WINAPI glDrawArrays( GLenum mode, GLint first, GLsizei count )
 void WINAPI glDrawBuffer( GLenum buf )
 {
     struct glDrawBuffer_params args = { .teb = NtCurrentTeb(), .buf = buf };
-    NTSTATUS status;
     TRACE( "buf %d\n", buf );
-    if ((status = UNIX_CALL( glDrawBuffer, &args ))) WARN( "glDrawBuffer returned %#lx\n", status );
+    UNIX_BATCH( glDrawBuffer, &args );
 }
 
 void WINAPI glDrawElements( GLenum mode, GLsizei count, GLenum type, const void *indices )
@@ -635,9 +592,8 @@ void WINAPI glDrawPixels( GLsizei width, GLsizei height, GLenum format, GLenum t
 void WINAPI glEdgeFlag( GLboolean flag )
 {
     struct glEdgeFlag_params args = { .teb = NtCurrentTeb(), .flag = flag };
-    NTSTATUS status;
     TRACE( "flag %d\n", flag );
-    if ((status = UNIX_CALL( glEdgeFlag, &args ))) WARN( "glEdgeFlag returned %#lx\n", status );
+    UNIX_BATCH( glEdgeFlag, &args );
 }
 
 void WINAPI glEdgeFlagPointer( GLsizei stride, const void *pointer )
@@ -659,41 +615,36 @@ void WINAPI glEdgeFlagv( const GLboolean *flag )
 void WINAPI glEnable( GLenum cap )
 {
     struct glEnable_params args = { .teb = NtCurrentTeb(), .cap = cap };
-    NTSTATUS status;
     TRACE( "cap %d\n", cap );
-    if ((status = UNIX_CALL( glEnable, &args ))) WARN( "glEnable returned %#lx\n", status );
+    UNIX_BATCH( glEnable, &args );
 }
 
 void WINAPI glEnableClientState( GLenum array )
 {
     struct glEnableClientState_params args = { .teb = NtCurrentTeb(), .array = array };
-    NTSTATUS status;
     TRACE( "array %d\n", array );
-    if ((status = UNIX_CALL( glEnableClientState, &args ))) WARN( "glEnableClientState returned %#lx\n", status );
+    UNIX_BATCH( glEnableClientState, &args );
 }
 
 void WINAPI glEnd(void)
 {
     struct glEnd_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEnd, &args ))) WARN( "glEnd returned %#lx\n", status );
+    UNIX_BATCH( glEnd, &args );
 }
 
 void WINAPI glEndList(void)
 {
     struct glEndList_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndList, &args ))) WARN( "glEndList returned %#lx\n", status );
+    UNIX_BATCH( glEndList, &args );
 }
 
 void WINAPI glEvalCoord1d( GLdouble u )
 {
     struct glEvalCoord1d_params args = { .teb = NtCurrentTeb(), .u = u };
-    NTSTATUS status;
     TRACE( "u %f\n", u );
-    if ((status = UNIX_CALL( glEvalCoord1d, &args ))) WARN( "glEvalCoord1d returned %#lx\n", status );
+    UNIX_BATCH( glEvalCoord1d, &args );
 }
 
 void WINAPI glEvalCoord1dv( const GLdouble *u )
@@ -707,9 +658,8 @@ void WINAPI glEvalCoord1dv( const GLdouble *u )
 void WINAPI glEvalCoord1f( GLfloat u )
 {
     struct glEvalCoord1f_params args = { .teb = NtCurrentTeb(), .u = u };
-    NTSTATUS status;
     TRACE( "u %f\n", u );
-    if ((status = UNIX_CALL( glEvalCoord1f, &args ))) WARN( "glEvalCoord1f returned %#lx\n", status );
+    UNIX_BATCH( glEvalCoord1f, &args );
 }
 
 void WINAPI glEvalCoord1fv( const GLfloat *u )
@@ -723,9 +673,8 @@ void WINAPI glEvalCoord1fv( const GLfloat *u )
 void WINAPI glEvalCoord2d( GLdouble u, GLdouble v )
 {
     struct glEvalCoord2d_params args = { .teb = NtCurrentTeb(), .u = u, .v = v };
-    NTSTATUS status;
     TRACE( "u %f, v %f\n", u, v );
-    if ((status = UNIX_CALL( glEvalCoord2d, &args ))) WARN( "glEvalCoord2d returned %#lx\n", status );
+    UNIX_BATCH( glEvalCoord2d, &args );
 }
 
 void WINAPI glEvalCoord2dv( const GLdouble *u )
@@ -739,9 +688,8 @@ void WINAPI glEvalCoord2dv( const GLdouble *u )
 void WINAPI glEvalCoord2f( GLfloat u, GLfloat v )
 {
     struct glEvalCoord2f_params args = { .teb = NtCurrentTeb(), .u = u, .v = v };
-    NTSTATUS status;
     TRACE( "u %f, v %f\n", u, v );
-    if ((status = UNIX_CALL( glEvalCoord2f, &args ))) WARN( "glEvalCoord2f returned %#lx\n", status );
+    UNIX_BATCH( glEvalCoord2f, &args );
 }
 
 void WINAPI glEvalCoord2fv( const GLfloat *u )
@@ -755,33 +703,29 @@ void WINAPI glEvalCoord2fv( const GLfloat *u )
 void WINAPI glEvalMesh1( GLenum mode, GLint i1, GLint i2 )
 {
     struct glEvalMesh1_params args = { .teb = NtCurrentTeb(), .mode = mode, .i1 = i1, .i2 = i2 };
-    NTSTATUS status;
     TRACE( "mode %d, i1 %d, i2 %d\n", mode, i1, i2 );
-    if ((status = UNIX_CALL( glEvalMesh1, &args ))) WARN( "glEvalMesh1 returned %#lx\n", status );
+    UNIX_BATCH( glEvalMesh1, &args );
 }
 
 void WINAPI glEvalMesh2( GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2 )
 {
     struct glEvalMesh2_params args = { .teb = NtCurrentTeb(), .mode = mode, .i1 = i1, .i2 = i2, .j1 = j1, .j2 = j2 };
-    NTSTATUS status;
     TRACE( "mode %d, i1 %d, i2 %d, j1 %d, j2 %d\n", mode, i1, i2, j1, j2 );
-    if ((status = UNIX_CALL( glEvalMesh2, &args ))) WARN( "glEvalMesh2 returned %#lx\n", status );
+    UNIX_BATCH( glEvalMesh2, &args );
 }
 
 void WINAPI glEvalPoint1( GLint i )
 {
     struct glEvalPoint1_params args = { .teb = NtCurrentTeb(), .i = i };
-    NTSTATUS status;
     TRACE( "i %d\n", i );
-    if ((status = UNIX_CALL( glEvalPoint1, &args ))) WARN( "glEvalPoint1 returned %#lx\n", status );
+    UNIX_BATCH( glEvalPoint1, &args );
 }
 
 void WINAPI glEvalPoint2( GLint i, GLint j )
 {
     struct glEvalPoint2_params args = { .teb = NtCurrentTeb(), .i = i, .j = j };
-    NTSTATUS status;
     TRACE( "i %d, j %d\n", i, j );
-    if ((status = UNIX_CALL( glEvalPoint2, &args ))) WARN( "glEvalPoint2 returned %#lx\n", status );
+    UNIX_BATCH( glEvalPoint2, &args );
 }
 
 void WINAPI glFeedbackBuffer( GLsizei size, GLenum type, GLfloat *buffer )
@@ -811,9 +755,8 @@ void WINAPI glFlush(void)
 void WINAPI glFogf( GLenum pname, GLfloat param )
 {
     struct glFogf_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glFogf, &args ))) WARN( "glFogf returned %#lx\n", status );
+    UNIX_BATCH( glFogf, &args );
 }
 
 void WINAPI glFogfv( GLenum pname, const GLfloat *params )
@@ -827,9 +770,8 @@ void WINAPI glFogfv( GLenum pname, const GLfloat *params )
 void WINAPI glFogi( GLenum pname, GLint param )
 {
     struct glFogi_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glFogi, &args ))) WARN( "glFogi returned %#lx\n", status );
+    UNIX_BATCH( glFogi, &args );
 }
 
 void WINAPI glFogiv( GLenum pname, const GLint *params )
@@ -843,17 +785,15 @@ void WINAPI glFogiv( GLenum pname, const GLint *params )
 void WINAPI glFrontFace( GLenum mode )
 {
     struct glFrontFace_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glFrontFace, &args ))) WARN( "glFrontFace returned %#lx\n", status );
+    UNIX_BATCH( glFrontFace, &args );
 }
 
 void WINAPI glFrustum( GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar )
 {
     struct glFrustum_params args = { .teb = NtCurrentTeb(), .left = left, .right = right, .bottom = bottom, .top = top, .zNear = zNear, .zFar = zFar };
-    NTSTATUS status;
     TRACE( "left %f, right %f, bottom %f, top %f, zNear %f, zFar %f\n", left, right, bottom, top, zNear, zFar );
-    if ((status = UNIX_CALL( glFrustum, &args ))) WARN( "glFrustum returned %#lx\n", status );
+    UNIX_BATCH( glFrustum, &args );
 }
 
 GLuint WINAPI glGenLists( GLsizei range )
@@ -1101,17 +1041,15 @@ void WINAPI glGetTexParameteriv( GLenum target, GLenum pname, GLint *params )
 void WINAPI glHint( GLenum target, GLenum mode )
 {
     struct glHint_params args = { .teb = NtCurrentTeb(), .target = target, .mode = mode };
-    NTSTATUS status;
     TRACE( "target %d, mode %d\n", target, mode );
-    if ((status = UNIX_CALL( glHint, &args ))) WARN( "glHint returned %#lx\n", status );
+    UNIX_BATCH( glHint, &args );
 }
 
 void WINAPI glIndexMask( GLuint mask )
 {
     struct glIndexMask_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glIndexMask, &args ))) WARN( "glIndexMask returned %#lx\n", status );
+    UNIX_BATCH( glIndexMask, &args );
 }
 
 void WINAPI glIndexPointer( GLenum type, GLsizei stride, const void *pointer )
@@ -1125,9 +1063,8 @@ void WINAPI glIndexPointer( GLenum type, GLsizei stride, const void *pointer )
 void WINAPI glIndexd( GLdouble c )
 {
     struct glIndexd_params args = { .teb = NtCurrentTeb(), .c = c };
-    NTSTATUS status;
     TRACE( "c %f\n", c );
-    if ((status = UNIX_CALL( glIndexd, &args ))) WARN( "glIndexd returned %#lx\n", status );
+    UNIX_BATCH( glIndexd, &args );
 }
 
 void WINAPI glIndexdv( const GLdouble *c )
@@ -1141,9 +1078,8 @@ void WINAPI glIndexdv( const GLdouble *c )
 void WINAPI glIndexf( GLfloat c )
 {
     struct glIndexf_params args = { .teb = NtCurrentTeb(), .c = c };
-    NTSTATUS status;
     TRACE( "c %f\n", c );
-    if ((status = UNIX_CALL( glIndexf, &args ))) WARN( "glIndexf returned %#lx\n", status );
+    UNIX_BATCH( glIndexf, &args );
 }
 
 void WINAPI glIndexfv( const GLfloat *c )
@@ -1157,9 +1093,8 @@ void WINAPI glIndexfv( const GLfloat *c )
 void WINAPI glIndexi( GLint c )
 {
     struct glIndexi_params args = { .teb = NtCurrentTeb(), .c = c };
-    NTSTATUS status;
     TRACE( "c %d\n", c );
-    if ((status = UNIX_CALL( glIndexi, &args ))) WARN( "glIndexi returned %#lx\n", status );
+    UNIX_BATCH( glIndexi, &args );
 }
 
 void WINAPI glIndexiv( const GLint *c )
@@ -1173,9 +1108,8 @@ void WINAPI glIndexiv( const GLint *c )
 void WINAPI glIndexs( GLshort c )
 {
     struct glIndexs_params args = { .teb = NtCurrentTeb(), .c = c };
-    NTSTATUS status;
     TRACE( "c %d\n", c );
-    if ((status = UNIX_CALL( glIndexs, &args ))) WARN( "glIndexs returned %#lx\n", status );
+    UNIX_BATCH( glIndexs, &args );
 }
 
 void WINAPI glIndexsv( const GLshort *c )
@@ -1189,9 +1123,8 @@ void WINAPI glIndexsv( const GLshort *c )
 void WINAPI glIndexub( GLubyte c )
 {
     struct glIndexub_params args = { .teb = NtCurrentTeb(), .c = c };
-    NTSTATUS status;
     TRACE( "c %d\n", c );
-    if ((status = UNIX_CALL( glIndexub, &args ))) WARN( "glIndexub returned %#lx\n", status );
+    UNIX_BATCH( glIndexub, &args );
 }
 
 void WINAPI glIndexubv( const GLubyte *c )
@@ -1205,9 +1138,8 @@ void WINAPI glIndexubv( const GLubyte *c )
 void WINAPI glInitNames(void)
 {
     struct glInitNames_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glInitNames, &args ))) WARN( "glInitNames returned %#lx\n", status );
+    UNIX_BATCH( glInitNames, &args );
 }
 
 void WINAPI glInterleavedArrays( GLenum format, GLsizei stride, const void *pointer )
@@ -1248,9 +1180,8 @@ GLboolean WINAPI glIsTexture( GLuint texture )
 void WINAPI glLightModelf( GLenum pname, GLfloat param )
 {
     struct glLightModelf_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glLightModelf, &args ))) WARN( "glLightModelf returned %#lx\n", status );
+    UNIX_BATCH( glLightModelf, &args );
 }
 
 void WINAPI glLightModelfv( GLenum pname, const GLfloat *params )
@@ -1264,9 +1195,8 @@ void WINAPI glLightModelfv( GLenum pname, const GLfloat *params )
 void WINAPI glLightModeli( GLenum pname, GLint param )
 {
     struct glLightModeli_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glLightModeli, &args ))) WARN( "glLightModeli returned %#lx\n", status );
+    UNIX_BATCH( glLightModeli, &args );
 }
 
 void WINAPI glLightModeliv( GLenum pname, const GLint *params )
@@ -1280,9 +1210,8 @@ void WINAPI glLightModeliv( GLenum pname, const GLint *params )
 void WINAPI glLightf( GLenum light, GLenum pname, GLfloat param )
 {
     struct glLightf_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "light %d, pname %d, param %f\n", light, pname, param );
-    if ((status = UNIX_CALL( glLightf, &args ))) WARN( "glLightf returned %#lx\n", status );
+    UNIX_BATCH( glLightf, &args );
 }
 
 void WINAPI glLightfv( GLenum light, GLenum pname, const GLfloat *params )
@@ -1296,9 +1225,8 @@ void WINAPI glLightfv( GLenum light, GLenum pname, const GLfloat *params )
 void WINAPI glLighti( GLenum light, GLenum pname, GLint param )
 {
     struct glLighti_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "light %d, pname %d, param %d\n", light, pname, param );
-    if ((status = UNIX_CALL( glLighti, &args ))) WARN( "glLighti returned %#lx\n", status );
+    UNIX_BATCH( glLighti, &args );
 }
 
 void WINAPI glLightiv( GLenum light, GLenum pname, const GLint *params )
@@ -1312,33 +1240,29 @@ void WINAPI glLightiv( GLenum light, GLenum pname, const GLint *params )
 void WINAPI glLineStipple( GLint factor, GLushort pattern )
 {
     struct glLineStipple_params args = { .teb = NtCurrentTeb(), .factor = factor, .pattern = pattern };
-    NTSTATUS status;
     TRACE( "factor %d, pattern %d\n", factor, pattern );
-    if ((status = UNIX_CALL( glLineStipple, &args ))) WARN( "glLineStipple returned %#lx\n", status );
+    UNIX_BATCH( glLineStipple, &args );
 }
 
 void WINAPI glLineWidth( GLfloat width )
 {
     struct glLineWidth_params args = { .teb = NtCurrentTeb(), .width = width };
-    NTSTATUS status;
     TRACE( "width %f\n", width );
-    if ((status = UNIX_CALL( glLineWidth, &args ))) WARN( "glLineWidth returned %#lx\n", status );
+    UNIX_BATCH( glLineWidth, &args );
 }
 
 void WINAPI glListBase( GLuint base )
 {
     struct glListBase_params args = { .teb = NtCurrentTeb(), .base = base };
-    NTSTATUS status;
     TRACE( "base %d\n", base );
-    if ((status = UNIX_CALL( glListBase, &args ))) WARN( "glListBase returned %#lx\n", status );
+    UNIX_BATCH( glListBase, &args );
 }
 
 void WINAPI glLoadIdentity(void)
 {
     struct glLoadIdentity_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glLoadIdentity, &args ))) WARN( "glLoadIdentity returned %#lx\n", status );
+    UNIX_BATCH( glLoadIdentity, &args );
 }
 
 void WINAPI glLoadMatrixd( const GLdouble *m )
@@ -1360,17 +1284,15 @@ void WINAPI glLoadMatrixf( const GLfloat *m )
 void WINAPI glLoadName( GLuint name )
 {
     struct glLoadName_params args = { .teb = NtCurrentTeb(), .name = name };
-    NTSTATUS status;
     TRACE( "name %d\n", name );
-    if ((status = UNIX_CALL( glLoadName, &args ))) WARN( "glLoadName returned %#lx\n", status );
+    UNIX_BATCH( glLoadName, &args );
 }
 
 void WINAPI glLogicOp( GLenum opcode )
 {
     struct glLogicOp_params args = { .teb = NtCurrentTeb(), .opcode = opcode };
-    NTSTATUS status;
     TRACE( "opcode %d\n", opcode );
-    if ((status = UNIX_CALL( glLogicOp, &args ))) WARN( "glLogicOp returned %#lx\n", status );
+    UNIX_BATCH( glLogicOp, &args );
 }
 
 void WINAPI glMap1d( GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points )
@@ -1408,41 +1330,36 @@ void WINAPI glMap2f( GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint
 void WINAPI glMapGrid1d( GLint un, GLdouble u1, GLdouble u2 )
 {
     struct glMapGrid1d_params args = { .teb = NtCurrentTeb(), .un = un, .u1 = u1, .u2 = u2 };
-    NTSTATUS status;
     TRACE( "un %d, u1 %f, u2 %f\n", un, u1, u2 );
-    if ((status = UNIX_CALL( glMapGrid1d, &args ))) WARN( "glMapGrid1d returned %#lx\n", status );
+    UNIX_BATCH( glMapGrid1d, &args );
 }
 
 void WINAPI glMapGrid1f( GLint un, GLfloat u1, GLfloat u2 )
 {
     struct glMapGrid1f_params args = { .teb = NtCurrentTeb(), .un = un, .u1 = u1, .u2 = u2 };
-    NTSTATUS status;
     TRACE( "un %d, u1 %f, u2 %f\n", un, u1, u2 );
-    if ((status = UNIX_CALL( glMapGrid1f, &args ))) WARN( "glMapGrid1f returned %#lx\n", status );
+    UNIX_BATCH( glMapGrid1f, &args );
 }
 
 void WINAPI glMapGrid2d( GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2 )
 {
     struct glMapGrid2d_params args = { .teb = NtCurrentTeb(), .un = un, .u1 = u1, .u2 = u2, .vn = vn, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "un %d, u1 %f, u2 %f, vn %d, v1 %f, v2 %f\n", un, u1, u2, vn, v1, v2 );
-    if ((status = UNIX_CALL( glMapGrid2d, &args ))) WARN( "glMapGrid2d returned %#lx\n", status );
+    UNIX_BATCH( glMapGrid2d, &args );
 }
 
 void WINAPI glMapGrid2f( GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2 )
 {
     struct glMapGrid2f_params args = { .teb = NtCurrentTeb(), .un = un, .u1 = u1, .u2 = u2, .vn = vn, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "un %d, u1 %f, u2 %f, vn %d, v1 %f, v2 %f\n", un, u1, u2, vn, v1, v2 );
-    if ((status = UNIX_CALL( glMapGrid2f, &args ))) WARN( "glMapGrid2f returned %#lx\n", status );
+    UNIX_BATCH( glMapGrid2f, &args );
 }
 
 void WINAPI glMaterialf( GLenum face, GLenum pname, GLfloat param )
 {
     struct glMaterialf_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "face %d, pname %d, param %f\n", face, pname, param );
-    if ((status = UNIX_CALL( glMaterialf, &args ))) WARN( "glMaterialf returned %#lx\n", status );
+    UNIX_BATCH( glMaterialf, &args );
 }
 
 void WINAPI glMaterialfv( GLenum face, GLenum pname, const GLfloat *params )
@@ -1456,9 +1373,8 @@ void WINAPI glMaterialfv( GLenum face, GLenum pname, const GLfloat *params )
 void WINAPI glMateriali( GLenum face, GLenum pname, GLint param )
 {
     struct glMateriali_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "face %d, pname %d, param %d\n", face, pname, param );
-    if ((status = UNIX_CALL( glMateriali, &args ))) WARN( "glMateriali returned %#lx\n", status );
+    UNIX_BATCH( glMateriali, &args );
 }
 
 void WINAPI glMaterialiv( GLenum face, GLenum pname, const GLint *params )
@@ -1472,9 +1388,8 @@ void WINAPI glMaterialiv( GLenum face, GLenum pname, const GLint *params )
 void WINAPI glMatrixMode( GLenum mode )
 {
     struct glMatrixMode_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glMatrixMode, &args ))) WARN( "glMatrixMode returned %#lx\n", status );
+    UNIX_BATCH( glMatrixMode, &args );
 }
 
 void WINAPI glMultMatrixd( const GLdouble *m )
@@ -1496,17 +1411,15 @@ void WINAPI glMultMatrixf( const GLfloat *m )
 void WINAPI glNewList( GLuint list, GLenum mode )
 {
     struct glNewList_params args = { .teb = NtCurrentTeb(), .list = list, .mode = mode };
-    NTSTATUS status;
     TRACE( "list %d, mode %d\n", list, mode );
-    if ((status = UNIX_CALL( glNewList, &args ))) WARN( "glNewList returned %#lx\n", status );
+    UNIX_BATCH( glNewList, &args );
 }
 
 void WINAPI glNormal3b( GLbyte nx, GLbyte ny, GLbyte nz )
 {
     struct glNormal3b_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3b, &args ))) WARN( "glNormal3b returned %#lx\n", status );
+    UNIX_BATCH( glNormal3b, &args );
 }
 
 void WINAPI glNormal3bv( const GLbyte *v )
@@ -1520,9 +1433,8 @@ void WINAPI glNormal3bv( const GLbyte *v )
 void WINAPI glNormal3d( GLdouble nx, GLdouble ny, GLdouble nz )
 {
     struct glNormal3d_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "nx %f, ny %f, nz %f\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3d, &args ))) WARN( "glNormal3d returned %#lx\n", status );
+    UNIX_BATCH( glNormal3d, &args );
 }
 
 void WINAPI glNormal3dv( const GLdouble *v )
@@ -1536,9 +1448,8 @@ void WINAPI glNormal3dv( const GLdouble *v )
 void WINAPI glNormal3f( GLfloat nx, GLfloat ny, GLfloat nz )
 {
     struct glNormal3f_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "nx %f, ny %f, nz %f\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3f, &args ))) WARN( "glNormal3f returned %#lx\n", status );
+    UNIX_BATCH( glNormal3f, &args );
 }
 
 void WINAPI glNormal3fv( const GLfloat *v )
@@ -1552,9 +1463,8 @@ void WINAPI glNormal3fv( const GLfloat *v )
 void WINAPI glNormal3i( GLint nx, GLint ny, GLint nz )
 {
     struct glNormal3i_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3i, &args ))) WARN( "glNormal3i returned %#lx\n", status );
+    UNIX_BATCH( glNormal3i, &args );
 }
 
 void WINAPI glNormal3iv( const GLint *v )
@@ -1568,9 +1478,8 @@ void WINAPI glNormal3iv( const GLint *v )
 void WINAPI glNormal3s( GLshort nx, GLshort ny, GLshort nz )
 {
     struct glNormal3s_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3s, &args ))) WARN( "glNormal3s returned %#lx\n", status );
+    UNIX_BATCH( glNormal3s, &args );
 }
 
 void WINAPI glNormal3sv( const GLshort *v )
@@ -1592,17 +1501,15 @@ void WINAPI glNormalPointer( GLenum type, GLsizei stride, const void *pointer )
 void WINAPI glOrtho( GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar )
 {
     struct glOrtho_params args = { .teb = NtCurrentTeb(), .left = left, .right = right, .bottom = bottom, .top = top, .zNear = zNear, .zFar = zFar };
-    NTSTATUS status;
     TRACE( "left %f, right %f, bottom %f, top %f, zNear %f, zFar %f\n", left, right, bottom, top, zNear, zFar );
-    if ((status = UNIX_CALL( glOrtho, &args ))) WARN( "glOrtho returned %#lx\n", status );
+    UNIX_BATCH( glOrtho, &args );
 }
 
 void WINAPI glPassThrough( GLfloat token )
 {
     struct glPassThrough_params args = { .teb = NtCurrentTeb(), .token = token };
-    NTSTATUS status;
     TRACE( "token %f\n", token );
-    if ((status = UNIX_CALL( glPassThrough, &args ))) WARN( "glPassThrough returned %#lx\n", status );
+    UNIX_BATCH( glPassThrough, &args );
 }
 
 void WINAPI glPixelMapfv( GLenum map, GLsizei mapsize, const GLfloat *values )
@@ -1632,65 +1539,57 @@ void WINAPI glPixelMapusv( GLenum map, GLsizei mapsize, const GLushort *values )
 void WINAPI glPixelStoref( GLenum pname, GLfloat param )
 {
     struct glPixelStoref_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPixelStoref, &args ))) WARN( "glPixelStoref returned %#lx\n", status );
+    UNIX_BATCH( glPixelStoref, &args );
 }
 
 void WINAPI glPixelStorei( GLenum pname, GLint param )
 {
     struct glPixelStorei_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelStorei, &args ))) WARN( "glPixelStorei returned %#lx\n", status );
+    UNIX_BATCH( glPixelStorei, &args );
 }
 
 void WINAPI glPixelTransferf( GLenum pname, GLfloat param )
 {
     struct glPixelTransferf_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTransferf, &args ))) WARN( "glPixelTransferf returned %#lx\n", status );
+    UNIX_BATCH( glPixelTransferf, &args );
 }
 
 void WINAPI glPixelTransferi( GLenum pname, GLint param )
 {
     struct glPixelTransferi_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTransferi, &args ))) WARN( "glPixelTransferi returned %#lx\n", status );
+    UNIX_BATCH( glPixelTransferi, &args );
 }
 
 void WINAPI glPixelZoom( GLfloat xfactor, GLfloat yfactor )
 {
     struct glPixelZoom_params args = { .teb = NtCurrentTeb(), .xfactor = xfactor, .yfactor = yfactor };
-    NTSTATUS status;
     TRACE( "xfactor %f, yfactor %f\n", xfactor, yfactor );
-    if ((status = UNIX_CALL( glPixelZoom, &args ))) WARN( "glPixelZoom returned %#lx\n", status );
+    UNIX_BATCH( glPixelZoom, &args );
 }
 
 void WINAPI glPointSize( GLfloat size )
 {
     struct glPointSize_params args = { .teb = NtCurrentTeb(), .size = size };
-    NTSTATUS status;
     TRACE( "size %f\n", size );
-    if ((status = UNIX_CALL( glPointSize, &args ))) WARN( "glPointSize returned %#lx\n", status );
+    UNIX_BATCH( glPointSize, &args );
 }
 
 void WINAPI glPolygonMode( GLenum face, GLenum mode )
 {
     struct glPolygonMode_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
-    NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glPolygonMode, &args ))) WARN( "glPolygonMode returned %#lx\n", status );
+    UNIX_BATCH( glPolygonMode, &args );
 }
 
 void WINAPI glPolygonOffset( GLfloat factor, GLfloat units )
 {
     struct glPolygonOffset_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units };
-    NTSTATUS status;
     TRACE( "factor %f, units %f\n", factor, units );
-    if ((status = UNIX_CALL( glPolygonOffset, &args ))) WARN( "glPolygonOffset returned %#lx\n", status );
+    UNIX_BATCH( glPolygonOffset, &args );
 }
 
 void WINAPI glPolygonStipple( const GLubyte *mask )
@@ -1704,33 +1603,29 @@ void WINAPI glPolygonStipple( const GLubyte *mask )
 void WINAPI glPopAttrib(void)
 {
     struct glPopAttrib_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopAttrib, &args ))) WARN( "glPopAttrib returned %#lx\n", status );
+    UNIX_BATCH( glPopAttrib, &args );
 }
 
 void WINAPI glPopClientAttrib(void)
 {
     struct glPopClientAttrib_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopClientAttrib, &args ))) WARN( "glPopClientAttrib returned %#lx\n", status );
+    UNIX_BATCH( glPopClientAttrib, &args );
 }
 
 void WINAPI glPopMatrix(void)
 {
     struct glPopMatrix_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopMatrix, &args ))) WARN( "glPopMatrix returned %#lx\n", status );
+    UNIX_BATCH( glPopMatrix, &args );
 }
 
 void WINAPI glPopName(void)
 {
     struct glPopName_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopName, &args ))) WARN( "glPopName returned %#lx\n", status );
+    UNIX_BATCH( glPopName, &args );
 }
 
 void WINAPI glPrioritizeTextures( GLsizei n, const GLuint *textures, const GLfloat *priorities )
@@ -1744,41 +1639,36 @@ void WINAPI glPrioritizeTextures( GLsizei n, const GLuint *textures, const GLflo
 void WINAPI glPushAttrib( GLbitfield mask )
 {
     struct glPushAttrib_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glPushAttrib, &args ))) WARN( "glPushAttrib returned %#lx\n", status );
+    UNIX_BATCH( glPushAttrib, &args );
 }
 
 void WINAPI glPushClientAttrib( GLbitfield mask )
 {
     struct glPushClientAttrib_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glPushClientAttrib, &args ))) WARN( "glPushClientAttrib returned %#lx\n", status );
+    UNIX_BATCH( glPushClientAttrib, &args );
 }
 
 void WINAPI glPushMatrix(void)
 {
     struct glPushMatrix_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPushMatrix, &args ))) WARN( "glPushMatrix returned %#lx\n", status );
+    UNIX_BATCH( glPushMatrix, &args );
 }
 
 void WINAPI glPushName( GLuint name )
 {
     struct glPushName_params args = { .teb = NtCurrentTeb(), .name = name };
-    NTSTATUS status;
     TRACE( "name %d\n", name );
-    if ((status = UNIX_CALL( glPushName, &args ))) WARN( "glPushName returned %#lx\n", status );
+    UNIX_BATCH( glPushName, &args );
 }
 
 void WINAPI glRasterPos2d( GLdouble x, GLdouble y )
 {
     struct glRasterPos2d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2d, &args ))) WARN( "glRasterPos2d returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos2d, &args );
 }
 
 void WINAPI glRasterPos2dv( const GLdouble *v )
@@ -1792,9 +1682,8 @@ void WINAPI glRasterPos2dv( const GLdouble *v )
 void WINAPI glRasterPos2f( GLfloat x, GLfloat y )
 {
     struct glRasterPos2f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2f, &args ))) WARN( "glRasterPos2f returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos2f, &args );
 }
 
 void WINAPI glRasterPos2fv( const GLfloat *v )
@@ -1808,9 +1697,8 @@ void WINAPI glRasterPos2fv( const GLfloat *v )
 void WINAPI glRasterPos2i( GLint x, GLint y )
 {
     struct glRasterPos2i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2i, &args ))) WARN( "glRasterPos2i returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos2i, &args );
 }
 
 void WINAPI glRasterPos2iv( const GLint *v )
@@ -1824,9 +1712,8 @@ void WINAPI glRasterPos2iv( const GLint *v )
 void WINAPI glRasterPos2s( GLshort x, GLshort y )
 {
     struct glRasterPos2s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2s, &args ))) WARN( "glRasterPos2s returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos2s, &args );
 }
 
 void WINAPI glRasterPos2sv( const GLshort *v )
@@ -1840,9 +1727,8 @@ void WINAPI glRasterPos2sv( const GLshort *v )
 void WINAPI glRasterPos3d( GLdouble x, GLdouble y, GLdouble z )
 {
     struct glRasterPos3d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3d, &args ))) WARN( "glRasterPos3d returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos3d, &args );
 }
 
 void WINAPI glRasterPos3dv( const GLdouble *v )
@@ -1856,9 +1742,8 @@ void WINAPI glRasterPos3dv( const GLdouble *v )
 void WINAPI glRasterPos3f( GLfloat x, GLfloat y, GLfloat z )
 {
     struct glRasterPos3f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3f, &args ))) WARN( "glRasterPos3f returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos3f, &args );
 }
 
 void WINAPI glRasterPos3fv( const GLfloat *v )
@@ -1872,9 +1757,8 @@ void WINAPI glRasterPos3fv( const GLfloat *v )
 void WINAPI glRasterPos3i( GLint x, GLint y, GLint z )
 {
     struct glRasterPos3i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3i, &args ))) WARN( "glRasterPos3i returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos3i, &args );
 }
 
 void WINAPI glRasterPos3iv( const GLint *v )
@@ -1888,9 +1772,8 @@ void WINAPI glRasterPos3iv( const GLint *v )
 void WINAPI glRasterPos3s( GLshort x, GLshort y, GLshort z )
 {
     struct glRasterPos3s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3s, &args ))) WARN( "glRasterPos3s returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos3s, &args );
 }
 
 void WINAPI glRasterPos3sv( const GLshort *v )
@@ -1904,9 +1787,8 @@ void WINAPI glRasterPos3sv( const GLshort *v )
 void WINAPI glRasterPos4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glRasterPos4d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4d, &args ))) WARN( "glRasterPos4d returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos4d, &args );
 }
 
 void WINAPI glRasterPos4dv( const GLdouble *v )
@@ -1920,9 +1802,8 @@ void WINAPI glRasterPos4dv( const GLdouble *v )
 void WINAPI glRasterPos4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glRasterPos4f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4f, &args ))) WARN( "glRasterPos4f returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos4f, &args );
 }
 
 void WINAPI glRasterPos4fv( const GLfloat *v )
@@ -1936,9 +1817,8 @@ void WINAPI glRasterPos4fv( const GLfloat *v )
 void WINAPI glRasterPos4i( GLint x, GLint y, GLint z, GLint w )
 {
     struct glRasterPos4i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4i, &args ))) WARN( "glRasterPos4i returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos4i, &args );
 }
 
 void WINAPI glRasterPos4iv( const GLint *v )
@@ -1952,9 +1832,8 @@ void WINAPI glRasterPos4iv( const GLint *v )
 void WINAPI glRasterPos4s( GLshort x, GLshort y, GLshort z, GLshort w )
 {
     struct glRasterPos4s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4s, &args ))) WARN( "glRasterPos4s returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos4s, &args );
 }
 
 void WINAPI glRasterPos4sv( const GLshort *v )
@@ -1968,9 +1847,8 @@ void WINAPI glRasterPos4sv( const GLshort *v )
 void WINAPI glReadBuffer( GLenum src )
 {
     struct glReadBuffer_params args = { .teb = NtCurrentTeb(), .src = src };
-    NTSTATUS status;
     TRACE( "src %d\n", src );
-    if ((status = UNIX_CALL( glReadBuffer, &args ))) WARN( "glReadBuffer returned %#lx\n", status );
+    UNIX_BATCH( glReadBuffer, &args );
 }
 
 void WINAPI glReadPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels )
@@ -1984,9 +1862,8 @@ void WINAPI glReadPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenu
 void WINAPI glRectd( GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2 )
 {
     struct glRectd_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
-    NTSTATUS status;
     TRACE( "x1 %f, y1 %f, x2 %f, y2 %f\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRectd, &args ))) WARN( "glRectd returned %#lx\n", status );
+    UNIX_BATCH( glRectd, &args );
 }
 
 void WINAPI glRectdv( const GLdouble *v1, const GLdouble *v2 )
@@ -2000,9 +1877,8 @@ void WINAPI glRectdv( const GLdouble *v1, const GLdouble *v2 )
 void WINAPI glRectf( GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2 )
 {
     struct glRectf_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
-    NTSTATUS status;
     TRACE( "x1 %f, y1 %f, x2 %f, y2 %f\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRectf, &args ))) WARN( "glRectf returned %#lx\n", status );
+    UNIX_BATCH( glRectf, &args );
 }
 
 void WINAPI glRectfv( const GLfloat *v1, const GLfloat *v2 )
@@ -2016,9 +1892,8 @@ void WINAPI glRectfv( const GLfloat *v1, const GLfloat *v2 )
 void WINAPI glRecti( GLint x1, GLint y1, GLint x2, GLint y2 )
 {
     struct glRecti_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
-    NTSTATUS status;
     TRACE( "x1 %d, y1 %d, x2 %d, y2 %d\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRecti, &args ))) WARN( "glRecti returned %#lx\n", status );
+    UNIX_BATCH( glRecti, &args );
 }
 
 void WINAPI glRectiv( const GLint *v1, const GLint *v2 )
@@ -2032,9 +1907,8 @@ void WINAPI glRectiv( const GLint *v1, const GLint *v2 )
 void WINAPI glRects( GLshort x1, GLshort y1, GLshort x2, GLshort y2 )
 {
     struct glRects_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
-    NTSTATUS status;
     TRACE( "x1 %d, y1 %d, x2 %d, y2 %d\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRects, &args ))) WARN( "glRects returned %#lx\n", status );
+    UNIX_BATCH( glRects, &args );
 }
 
 void WINAPI glRectsv( const GLshort *v1, const GLshort *v2 )
@@ -2057,41 +1931,36 @@ GLint WINAPI glRenderMode( GLenum mode )
 void WINAPI glRotated( GLdouble angle, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glRotated_params args = { .teb = NtCurrentTeb(), .angle = angle, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "angle %f, x %f, y %f, z %f\n", angle, x, y, z );
-    if ((status = UNIX_CALL( glRotated, &args ))) WARN( "glRotated returned %#lx\n", status );
+    UNIX_BATCH( glRotated, &args );
 }
 
 void WINAPI glRotatef( GLfloat angle, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glRotatef_params args = { .teb = NtCurrentTeb(), .angle = angle, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "angle %f, x %f, y %f, z %f\n", angle, x, y, z );
-    if ((status = UNIX_CALL( glRotatef, &args ))) WARN( "glRotatef returned %#lx\n", status );
+    UNIX_BATCH( glRotatef, &args );
 }
 
 void WINAPI glScaled( GLdouble x, GLdouble y, GLdouble z )
 {
     struct glScaled_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glScaled, &args ))) WARN( "glScaled returned %#lx\n", status );
+    UNIX_BATCH( glScaled, &args );
 }
 
 void WINAPI glScalef( GLfloat x, GLfloat y, GLfloat z )
 {
     struct glScalef_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glScalef, &args ))) WARN( "glScalef returned %#lx\n", status );
+    UNIX_BATCH( glScalef, &args );
 }
 
 void WINAPI glScissor( GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glScissor_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "x %d, y %d, width %d, height %d\n", x, y, width, height );
-    if ((status = UNIX_CALL( glScissor, &args ))) WARN( "glScissor returned %#lx\n", status );
+    UNIX_BATCH( glScissor, &args );
 }
 
 void WINAPI glSelectBuffer( GLsizei size, GLuint *buffer )
@@ -2105,41 +1974,36 @@ void WINAPI glSelectBuffer( GLsizei size, GLuint *buffer )
 void WINAPI glShadeModel( GLenum mode )
 {
     struct glShadeModel_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glShadeModel, &args ))) WARN( "glShadeModel returned %#lx\n", status );
+    UNIX_BATCH( glShadeModel, &args );
 }
 
 void WINAPI glStencilFunc( GLenum func, GLint ref, GLuint mask )
 {
     struct glStencilFunc_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref, .mask = mask };
-    NTSTATUS status;
     TRACE( "func %d, ref %d, mask %d\n", func, ref, mask );
-    if ((status = UNIX_CALL( glStencilFunc, &args ))) WARN( "glStencilFunc returned %#lx\n", status );
+    UNIX_BATCH( glStencilFunc, &args );
 }
 
 void WINAPI glStencilMask( GLuint mask )
 {
     struct glStencilMask_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glStencilMask, &args ))) WARN( "glStencilMask returned %#lx\n", status );
+    UNIX_BATCH( glStencilMask, &args );
 }
 
 void WINAPI glStencilOp( GLenum fail, GLenum zfail, GLenum zpass )
 {
     struct glStencilOp_params args = { .teb = NtCurrentTeb(), .fail = fail, .zfail = zfail, .zpass = zpass };
-    NTSTATUS status;
     TRACE( "fail %d, zfail %d, zpass %d\n", fail, zfail, zpass );
-    if ((status = UNIX_CALL( glStencilOp, &args ))) WARN( "glStencilOp returned %#lx\n", status );
+    UNIX_BATCH( glStencilOp, &args );
 }
 
 void WINAPI glTexCoord1d( GLdouble s )
 {
     struct glTexCoord1d_params args = { .teb = NtCurrentTeb(), .s = s };
-    NTSTATUS status;
     TRACE( "s %f\n", s );
-    if ((status = UNIX_CALL( glTexCoord1d, &args ))) WARN( "glTexCoord1d returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord1d, &args );
 }
 
 void WINAPI glTexCoord1dv( const GLdouble *v )
@@ -2153,9 +2017,8 @@ void WINAPI glTexCoord1dv( const GLdouble *v )
 void WINAPI glTexCoord1f( GLfloat s )
 {
     struct glTexCoord1f_params args = { .teb = NtCurrentTeb(), .s = s };
-    NTSTATUS status;
     TRACE( "s %f\n", s );
-    if ((status = UNIX_CALL( glTexCoord1f, &args ))) WARN( "glTexCoord1f returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord1f, &args );
 }
 
 void WINAPI glTexCoord1fv( const GLfloat *v )
@@ -2169,9 +2032,8 @@ void WINAPI glTexCoord1fv( const GLfloat *v )
 void WINAPI glTexCoord1i( GLint s )
 {
     struct glTexCoord1i_params args = { .teb = NtCurrentTeb(), .s = s };
-    NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1i, &args ))) WARN( "glTexCoord1i returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord1i, &args );
 }
 
 void WINAPI glTexCoord1iv( const GLint *v )
@@ -2185,9 +2047,8 @@ void WINAPI glTexCoord1iv( const GLint *v )
 void WINAPI glTexCoord1s( GLshort s )
 {
     struct glTexCoord1s_params args = { .teb = NtCurrentTeb(), .s = s };
-    NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1s, &args ))) WARN( "glTexCoord1s returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord1s, &args );
 }
 
 void WINAPI glTexCoord1sv( const GLshort *v )
@@ -2201,9 +2062,8 @@ void WINAPI glTexCoord1sv( const GLshort *v )
 void WINAPI glTexCoord2d( GLdouble s, GLdouble t )
 {
     struct glTexCoord2d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "s %f, t %f\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2d, &args ))) WARN( "glTexCoord2d returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2d, &args );
 }
 
 void WINAPI glTexCoord2dv( const GLdouble *v )
@@ -2217,9 +2077,8 @@ void WINAPI glTexCoord2dv( const GLdouble *v )
 void WINAPI glTexCoord2f( GLfloat s, GLfloat t )
 {
     struct glTexCoord2f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "s %f, t %f\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2f, &args ))) WARN( "glTexCoord2f returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2f, &args );
 }
 
 void WINAPI glTexCoord2fv( const GLfloat *v )
@@ -2233,9 +2092,8 @@ void WINAPI glTexCoord2fv( const GLfloat *v )
 void WINAPI glTexCoord2i( GLint s, GLint t )
 {
     struct glTexCoord2i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2i, &args ))) WARN( "glTexCoord2i returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2i, &args );
 }
 
 void WINAPI glTexCoord2iv( const GLint *v )
@@ -2249,9 +2107,8 @@ void WINAPI glTexCoord2iv( const GLint *v )
 void WINAPI glTexCoord2s( GLshort s, GLshort t )
 {
     struct glTexCoord2s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2s, &args ))) WARN( "glTexCoord2s returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2s, &args );
 }
 
 void WINAPI glTexCoord2sv( const GLshort *v )
@@ -2265,9 +2122,8 @@ void WINAPI glTexCoord2sv( const GLshort *v )
 void WINAPI glTexCoord3d( GLdouble s, GLdouble t, GLdouble r )
 {
     struct glTexCoord3d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "s %f, t %f, r %f\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3d, &args ))) WARN( "glTexCoord3d returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord3d, &args );
 }
 
 void WINAPI glTexCoord3dv( const GLdouble *v )
@@ -2281,9 +2137,8 @@ void WINAPI glTexCoord3dv( const GLdouble *v )
 void WINAPI glTexCoord3f( GLfloat s, GLfloat t, GLfloat r )
 {
     struct glTexCoord3f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "s %f, t %f, r %f\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3f, &args ))) WARN( "glTexCoord3f returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord3f, &args );
 }
 
 void WINAPI glTexCoord3fv( const GLfloat *v )
@@ -2297,9 +2152,8 @@ void WINAPI glTexCoord3fv( const GLfloat *v )
 void WINAPI glTexCoord3i( GLint s, GLint t, GLint r )
 {
     struct glTexCoord3i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3i, &args ))) WARN( "glTexCoord3i returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord3i, &args );
 }
 
 void WINAPI glTexCoord3iv( const GLint *v )
@@ -2313,9 +2167,8 @@ void WINAPI glTexCoord3iv( const GLint *v )
 void WINAPI glTexCoord3s( GLshort s, GLshort t, GLshort r )
 {
     struct glTexCoord3s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3s, &args ))) WARN( "glTexCoord3s returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord3s, &args );
 }
 
 void WINAPI glTexCoord3sv( const GLshort *v )
@@ -2329,9 +2182,8 @@ void WINAPI glTexCoord3sv( const GLshort *v )
 void WINAPI glTexCoord4d( GLdouble s, GLdouble t, GLdouble r, GLdouble q )
 {
     struct glTexCoord4d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "s %f, t %f, r %f, q %f\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4d, &args ))) WARN( "glTexCoord4d returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4d, &args );
 }
 
 void WINAPI glTexCoord4dv( const GLdouble *v )
@@ -2345,9 +2197,8 @@ void WINAPI glTexCoord4dv( const GLdouble *v )
 void WINAPI glTexCoord4f( GLfloat s, GLfloat t, GLfloat r, GLfloat q )
 {
     struct glTexCoord4f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "s %f, t %f, r %f, q %f\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4f, &args ))) WARN( "glTexCoord4f returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4f, &args );
 }
 
 void WINAPI glTexCoord4fv( const GLfloat *v )
@@ -2361,9 +2212,8 @@ void WINAPI glTexCoord4fv( const GLfloat *v )
 void WINAPI glTexCoord4i( GLint s, GLint t, GLint r, GLint q )
 {
     struct glTexCoord4i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4i, &args ))) WARN( "glTexCoord4i returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4i, &args );
 }
 
 void WINAPI glTexCoord4iv( const GLint *v )
@@ -2377,9 +2227,8 @@ void WINAPI glTexCoord4iv( const GLint *v )
 void WINAPI glTexCoord4s( GLshort s, GLshort t, GLshort r, GLshort q )
 {
     struct glTexCoord4s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4s, &args ))) WARN( "glTexCoord4s returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4s, &args );
 }
 
 void WINAPI glTexCoord4sv( const GLshort *v )
@@ -2401,9 +2250,8 @@ void WINAPI glTexCoordPointer( GLint size, GLenum type, GLsizei stride, const vo
 void WINAPI glTexEnvf( GLenum target, GLenum pname, GLfloat param )
 {
     struct glTexEnvf_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %f\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexEnvf, &args ))) WARN( "glTexEnvf returned %#lx\n", status );
+    UNIX_BATCH( glTexEnvf, &args );
 }
 
 void WINAPI glTexEnvfv( GLenum target, GLenum pname, const GLfloat *params )
@@ -2417,9 +2265,8 @@ void WINAPI glTexEnvfv( GLenum target, GLenum pname, const GLfloat *params )
 void WINAPI glTexEnvi( GLenum target, GLenum pname, GLint param )
 {
     struct glTexEnvi_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexEnvi, &args ))) WARN( "glTexEnvi returned %#lx\n", status );
+    UNIX_BATCH( glTexEnvi, &args );
 }
 
 void WINAPI glTexEnviv( GLenum target, GLenum pname, const GLint *params )
@@ -2433,9 +2280,8 @@ void WINAPI glTexEnviv( GLenum target, GLenum pname, const GLint *params )
 void WINAPI glTexGend( GLenum coord, GLenum pname, GLdouble param )
 {
     struct glTexGend_params args = { .teb = NtCurrentTeb(), .coord = coord, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "coord %d, pname %d, param %f\n", coord, pname, param );
-    if ((status = UNIX_CALL( glTexGend, &args ))) WARN( "glTexGend returned %#lx\n", status );
+    UNIX_BATCH( glTexGend, &args );
 }
 
 void WINAPI glTexGendv( GLenum coord, GLenum pname, const GLdouble *params )
@@ -2449,9 +2295,8 @@ void WINAPI glTexGendv( GLenum coord, GLenum pname, const GLdouble *params )
 void WINAPI glTexGenf( GLenum coord, GLenum pname, GLfloat param )
 {
     struct glTexGenf_params args = { .teb = NtCurrentTeb(), .coord = coord, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "coord %d, pname %d, param %f\n", coord, pname, param );
-    if ((status = UNIX_CALL( glTexGenf, &args ))) WARN( "glTexGenf returned %#lx\n", status );
+    UNIX_BATCH( glTexGenf, &args );
 }
 
 void WINAPI glTexGenfv( GLenum coord, GLenum pname, const GLfloat *params )
@@ -2465,9 +2310,8 @@ void WINAPI glTexGenfv( GLenum coord, GLenum pname, const GLfloat *params )
 void WINAPI glTexGeni( GLenum coord, GLenum pname, GLint param )
 {
     struct glTexGeni_params args = { .teb = NtCurrentTeb(), .coord = coord, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "coord %d, pname %d, param %d\n", coord, pname, param );
-    if ((status = UNIX_CALL( glTexGeni, &args ))) WARN( "glTexGeni returned %#lx\n", status );
+    UNIX_BATCH( glTexGeni, &args );
 }
 
 void WINAPI glTexGeniv( GLenum coord, GLenum pname, const GLint *params )
@@ -2497,9 +2341,8 @@ void WINAPI glTexImage2D( GLenum target, GLint level, GLint internalformat, GLsi
 void WINAPI glTexParameterf( GLenum target, GLenum pname, GLfloat param )
 {
     struct glTexParameterf_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %f\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexParameterf, &args ))) WARN( "glTexParameterf returned %#lx\n", status );
+    UNIX_BATCH( glTexParameterf, &args );
 }
 
 void WINAPI glTexParameterfv( GLenum target, GLenum pname, const GLfloat *params )
@@ -2513,9 +2356,8 @@ void WINAPI glTexParameterfv( GLenum target, GLenum pname, const GLfloat *params
 void WINAPI glTexParameteri( GLenum target, GLenum pname, GLint param )
 {
     struct glTexParameteri_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexParameteri, &args ))) WARN( "glTexParameteri returned %#lx\n", status );
+    UNIX_BATCH( glTexParameteri, &args );
 }
 
 void WINAPI glTexParameteriv( GLenum target, GLenum pname, const GLint *params )
@@ -2545,25 +2387,22 @@ void WINAPI glTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yo
 void WINAPI glTranslated( GLdouble x, GLdouble y, GLdouble z )
 {
     struct glTranslated_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glTranslated, &args ))) WARN( "glTranslated returned %#lx\n", status );
+    UNIX_BATCH( glTranslated, &args );
 }
 
 void WINAPI glTranslatef( GLfloat x, GLfloat y, GLfloat z )
 {
     struct glTranslatef_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glTranslatef, &args ))) WARN( "glTranslatef returned %#lx\n", status );
+    UNIX_BATCH( glTranslatef, &args );
 }
 
 void WINAPI glVertex2d( GLdouble x, GLdouble y )
 {
     struct glVertex2d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glVertex2d, &args ))) WARN( "glVertex2d returned %#lx\n", status );
+    UNIX_BATCH( glVertex2d, &args );
 }
 
 void WINAPI glVertex2dv( const GLdouble *v )
@@ -2577,9 +2416,8 @@ void WINAPI glVertex2dv( const GLdouble *v )
 void WINAPI glVertex2f( GLfloat x, GLfloat y )
 {
     struct glVertex2f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glVertex2f, &args ))) WARN( "glVertex2f returned %#lx\n", status );
+    UNIX_BATCH( glVertex2f, &args );
 }
 
 void WINAPI glVertex2fv( const GLfloat *v )
@@ -2593,9 +2431,8 @@ void WINAPI glVertex2fv( const GLfloat *v )
 void WINAPI glVertex2i( GLint x, GLint y )
 {
     struct glVertex2i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex2i, &args ))) WARN( "glVertex2i returned %#lx\n", status );
+    UNIX_BATCH( glVertex2i, &args );
 }
 
 void WINAPI glVertex2iv( const GLint *v )
@@ -2609,9 +2446,8 @@ void WINAPI glVertex2iv( const GLint *v )
 void WINAPI glVertex2s( GLshort x, GLshort y )
 {
     struct glVertex2s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex2s, &args ))) WARN( "glVertex2s returned %#lx\n", status );
+    UNIX_BATCH( glVertex2s, &args );
 }
 
 void WINAPI glVertex2sv( const GLshort *v )
@@ -2625,9 +2461,8 @@ void WINAPI glVertex2sv( const GLshort *v )
 void WINAPI glVertex3d( GLdouble x, GLdouble y, GLdouble z )
 {
     struct glVertex3d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3d, &args ))) WARN( "glVertex3d returned %#lx\n", status );
+    UNIX_BATCH( glVertex3d, &args );
 }
 
 void WINAPI glVertex3dv( const GLdouble *v )
@@ -2641,9 +2476,8 @@ void WINAPI glVertex3dv( const GLdouble *v )
 void WINAPI glVertex3f( GLfloat x, GLfloat y, GLfloat z )
 {
     struct glVertex3f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3f, &args ))) WARN( "glVertex3f returned %#lx\n", status );
+    UNIX_BATCH( glVertex3f, &args );
 }
 
 void WINAPI glVertex3fv( const GLfloat *v )
@@ -2657,9 +2491,8 @@ void WINAPI glVertex3fv( const GLfloat *v )
 void WINAPI glVertex3i( GLint x, GLint y, GLint z )
 {
     struct glVertex3i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3i, &args ))) WARN( "glVertex3i returned %#lx\n", status );
+    UNIX_BATCH( glVertex3i, &args );
 }
 
 void WINAPI glVertex3iv( const GLint *v )
@@ -2673,9 +2506,8 @@ void WINAPI glVertex3iv( const GLint *v )
 void WINAPI glVertex3s( GLshort x, GLshort y, GLshort z )
 {
     struct glVertex3s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3s, &args ))) WARN( "glVertex3s returned %#lx\n", status );
+    UNIX_BATCH( glVertex3s, &args );
 }
 
 void WINAPI glVertex3sv( const GLshort *v )
@@ -2689,9 +2521,8 @@ void WINAPI glVertex3sv( const GLshort *v )
 void WINAPI glVertex4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glVertex4d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4d, &args ))) WARN( "glVertex4d returned %#lx\n", status );
+    UNIX_BATCH( glVertex4d, &args );
 }
 
 void WINAPI glVertex4dv( const GLdouble *v )
@@ -2705,9 +2536,8 @@ void WINAPI glVertex4dv( const GLdouble *v )
 void WINAPI glVertex4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glVertex4f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4f, &args ))) WARN( "glVertex4f returned %#lx\n", status );
+    UNIX_BATCH( glVertex4f, &args );
 }
 
 void WINAPI glVertex4fv( const GLfloat *v )
@@ -2721,9 +2551,8 @@ void WINAPI glVertex4fv( const GLfloat *v )
 void WINAPI glVertex4i( GLint x, GLint y, GLint z, GLint w )
 {
     struct glVertex4i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4i, &args ))) WARN( "glVertex4i returned %#lx\n", status );
+    UNIX_BATCH( glVertex4i, &args );
 }
 
 void WINAPI glVertex4iv( const GLint *v )
@@ -2737,9 +2566,8 @@ void WINAPI glVertex4iv( const GLint *v )
 void WINAPI glVertex4s( GLshort x, GLshort y, GLshort z, GLshort w )
 {
     struct glVertex4s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4s, &args ))) WARN( "glVertex4s returned %#lx\n", status );
+    UNIX_BATCH( glVertex4s, &args );
 }
 
 void WINAPI glVertex4sv( const GLshort *v )
@@ -2761,17 +2589,15 @@ void WINAPI glVertexPointer( GLint size, GLenum type, GLsizei stride, const void
 void WINAPI glViewport( GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glViewport_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "x %d, y %d, width %d, height %d\n", x, y, width, height );
-    if ((status = UNIX_CALL( glViewport, &args ))) WARN( "glViewport returned %#lx\n", status );
+    UNIX_BATCH( glViewport, &args );
 }
 
 static void WINAPI glAccumxOES( GLenum op, GLfixed value )
 {
     struct glAccumxOES_params args = { .teb = NtCurrentTeb(), .op = op, .value = value };
-    NTSTATUS status;
     TRACE( "op %d, value %d\n", op, value );
-    if ((status = UNIX_CALL( glAccumxOES, &args ))) WARN( "glAccumxOES returned %#lx\n", status );
+    UNIX_BATCH( glAccumxOES, &args );
 }
 
 static GLboolean WINAPI glAcquireKeyedMutexWin32EXT( GLuint memory, GLuint64 key, GLuint timeout )
@@ -2786,41 +2612,36 @@ static GLboolean WINAPI glAcquireKeyedMutexWin32EXT( GLuint memory, GLuint64 key
 static void WINAPI glActiveProgramEXT( GLuint program )
 {
     struct glActiveProgramEXT_params args = { .teb = NtCurrentTeb(), .program = program };
-    NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glActiveProgramEXT, &args ))) WARN( "glActiveProgramEXT returned %#lx\n", status );
+    UNIX_BATCH( glActiveProgramEXT, &args );
 }
 
 static void WINAPI glActiveShaderProgram( GLuint pipeline, GLuint program )
 {
     struct glActiveShaderProgram_params args = { .teb = NtCurrentTeb(), .pipeline = pipeline, .program = program };
-    NTSTATUS status;
     TRACE( "pipeline %d, program %d\n", pipeline, program );
-    if ((status = UNIX_CALL( glActiveShaderProgram, &args ))) WARN( "glActiveShaderProgram returned %#lx\n", status );
+    UNIX_BATCH( glActiveShaderProgram, &args );
 }
 
 static void WINAPI glActiveStencilFaceEXT( GLenum face )
 {
     struct glActiveStencilFaceEXT_params args = { .teb = NtCurrentTeb(), .face = face };
-    NTSTATUS status;
     TRACE( "face %d\n", face );
-    if ((status = UNIX_CALL( glActiveStencilFaceEXT, &args ))) WARN( "glActiveStencilFaceEXT returned %#lx\n", status );
+    UNIX_BATCH( glActiveStencilFaceEXT, &args );
 }
 
 static void WINAPI glActiveTexture( GLenum texture )
 {
     struct glActiveTexture_params args = { .teb = NtCurrentTeb(), .texture = texture };
-    NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glActiveTexture, &args ))) WARN( "glActiveTexture returned %#lx\n", status );
+    UNIX_BATCH( glActiveTexture, &args );
 }
 
 static void WINAPI glActiveTextureARB( GLenum texture )
 {
     struct glActiveTextureARB_params args = { .teb = NtCurrentTeb(), .texture = texture };
-    NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glActiveTextureARB, &args ))) WARN( "glActiveTextureARB returned %#lx\n", status );
+    UNIX_BATCH( glActiveTextureARB, &args );
 }
 
 static void WINAPI glActiveVaryingNV( GLuint program, const GLchar *name )
@@ -2834,57 +2655,50 @@ static void WINAPI glActiveVaryingNV( GLuint program, const GLchar *name )
 static void WINAPI glAlphaFragmentOp1ATI( GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod )
 {
     struct glAlphaFragmentOp1ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod };
-    NTSTATUS status;
     TRACE( "op %d, dst %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod );
-    if ((status = UNIX_CALL( glAlphaFragmentOp1ATI, &args ))) WARN( "glAlphaFragmentOp1ATI returned %#lx\n", status );
+    UNIX_BATCH( glAlphaFragmentOp1ATI, &args );
 }
 
 static void WINAPI glAlphaFragmentOp2ATI( GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod )
 {
     struct glAlphaFragmentOp2ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod, .arg2 = arg2, .arg2Rep = arg2Rep, .arg2Mod = arg2Mod };
-    NTSTATUS status;
     TRACE( "op %d, dst %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d, arg2 %d, arg2Rep %d, arg2Mod %d\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod );
-    if ((status = UNIX_CALL( glAlphaFragmentOp2ATI, &args ))) WARN( "glAlphaFragmentOp2ATI returned %#lx\n", status );
+    UNIX_BATCH( glAlphaFragmentOp2ATI, &args );
 }
 
 static void WINAPI glAlphaFragmentOp3ATI( GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod )
 {
     struct glAlphaFragmentOp3ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod, .arg2 = arg2, .arg2Rep = arg2Rep, .arg2Mod = arg2Mod, .arg3 = arg3, .arg3Rep = arg3Rep, .arg3Mod = arg3Mod };
-    NTSTATUS status;
     TRACE( "op %d, dst %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d, arg2 %d, arg2Rep %d, arg2Mod %d, arg3 %d, arg3Rep %d, arg3Mod %d\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod );
-    if ((status = UNIX_CALL( glAlphaFragmentOp3ATI, &args ))) WARN( "glAlphaFragmentOp3ATI returned %#lx\n", status );
+    UNIX_BATCH( glAlphaFragmentOp3ATI, &args );
 }
 
 static void WINAPI glAlphaFuncxOES( GLenum func, GLfixed ref )
 {
     struct glAlphaFuncxOES_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref };
-    NTSTATUS status;
     TRACE( "func %d, ref %d\n", func, ref );
-    if ((status = UNIX_CALL( glAlphaFuncxOES, &args ))) WARN( "glAlphaFuncxOES returned %#lx\n", status );
+    UNIX_BATCH( glAlphaFuncxOES, &args );
 }
 
 static void WINAPI glAlphaToCoverageDitherControlNV( GLenum mode )
 {
     struct glAlphaToCoverageDitherControlNV_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glAlphaToCoverageDitherControlNV, &args ))) WARN( "glAlphaToCoverageDitherControlNV returned %#lx\n", status );
+    UNIX_BATCH( glAlphaToCoverageDitherControlNV, &args );
 }
 
 static void WINAPI glApplyFramebufferAttachmentCMAAINTEL(void)
 {
     struct glApplyFramebufferAttachmentCMAAINTEL_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glApplyFramebufferAttachmentCMAAINTEL, &args ))) WARN( "glApplyFramebufferAttachmentCMAAINTEL returned %#lx\n", status );
+    UNIX_BATCH( glApplyFramebufferAttachmentCMAAINTEL, &args );
 }
 
 static void WINAPI glApplyTextureEXT( GLenum mode )
 {
     struct glApplyTextureEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glApplyTextureEXT, &args ))) WARN( "glApplyTextureEXT returned %#lx\n", status );
+    UNIX_BATCH( glApplyTextureEXT, &args );
 }
 
 static GLboolean WINAPI glAreProgramsResidentNV( GLsizei n, const GLuint *programs, GLboolean *residences )
@@ -2916,9 +2730,8 @@ static void WINAPI glArrayElementEXT( GLint i )
 static void WINAPI glArrayObjectATI( GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset )
 {
     struct glArrayObjectATI_params args = { .teb = NtCurrentTeb(), .array = array, .size = size, .type = type, .stride = stride, .buffer = buffer, .offset = offset };
-    NTSTATUS status;
     TRACE( "array %d, size %d, type %d, stride %d, buffer %d, offset %d\n", array, size, type, stride, buffer, offset );
-    if ((status = UNIX_CALL( glArrayObjectATI, &args ))) WARN( "glArrayObjectATI returned %#lx\n", status );
+    UNIX_BATCH( glArrayObjectATI, &args );
 }
 
 static GLuint WINAPI glAsyncCopyBufferSubDataNVX( GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *fenceValueArray, GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray )
@@ -2942,145 +2755,127 @@ static GLuint WINAPI glAsyncCopyImageSubDataNVX( GLsizei waitSemaphoreCount, con
 static void WINAPI glAsyncMarkerSGIX( GLuint marker )
 {
     struct glAsyncMarkerSGIX_params args = { .teb = NtCurrentTeb(), .marker = marker };
-    NTSTATUS status;
     TRACE( "marker %d\n", marker );
-    if ((status = UNIX_CALL( glAsyncMarkerSGIX, &args ))) WARN( "glAsyncMarkerSGIX returned %#lx\n", status );
+    UNIX_BATCH( glAsyncMarkerSGIX, &args );
 }
 
 static void WINAPI glAttachObjectARB( GLhandleARB containerObj, GLhandleARB obj )
 {
     struct glAttachObjectARB_params args = { .teb = NtCurrentTeb(), .containerObj = containerObj, .obj = obj };
-    NTSTATUS status;
     TRACE( "containerObj %d, obj %d\n", containerObj, obj );
-    if ((status = UNIX_CALL( glAttachObjectARB, &args ))) WARN( "glAttachObjectARB returned %#lx\n", status );
+    UNIX_BATCH( glAttachObjectARB, &args );
 }
 
 static void WINAPI glAttachShader( GLuint program, GLuint shader )
 {
     struct glAttachShader_params args = { .teb = NtCurrentTeb(), .program = program, .shader = shader };
-    NTSTATUS status;
     TRACE( "program %d, shader %d\n", program, shader );
-    if ((status = UNIX_CALL( glAttachShader, &args ))) WARN( "glAttachShader returned %#lx\n", status );
+    UNIX_BATCH( glAttachShader, &args );
 }
 
 static void WINAPI glBeginConditionalRender( GLuint id, GLenum mode )
 {
     struct glBeginConditionalRender_params args = { .teb = NtCurrentTeb(), .id = id, .mode = mode };
-    NTSTATUS status;
     TRACE( "id %d, mode %d\n", id, mode );
-    if ((status = UNIX_CALL( glBeginConditionalRender, &args ))) WARN( "glBeginConditionalRender returned %#lx\n", status );
+    UNIX_BATCH( glBeginConditionalRender, &args );
 }
 
 static void WINAPI glBeginConditionalRenderNV( GLuint id, GLenum mode )
 {
     struct glBeginConditionalRenderNV_params args = { .teb = NtCurrentTeb(), .id = id, .mode = mode };
-    NTSTATUS status;
     TRACE( "id %d, mode %d\n", id, mode );
-    if ((status = UNIX_CALL( glBeginConditionalRenderNV, &args ))) WARN( "glBeginConditionalRenderNV returned %#lx\n", status );
+    UNIX_BATCH( glBeginConditionalRenderNV, &args );
 }
 
 static void WINAPI glBeginConditionalRenderNVX( GLuint id )
 {
     struct glBeginConditionalRenderNVX_params args = { .teb = NtCurrentTeb(), .id = id };
-    NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glBeginConditionalRenderNVX, &args ))) WARN( "glBeginConditionalRenderNVX returned %#lx\n", status );
+    UNIX_BATCH( glBeginConditionalRenderNVX, &args );
 }
 
 static void WINAPI glBeginFragmentShaderATI(void)
 {
     struct glBeginFragmentShaderATI_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glBeginFragmentShaderATI, &args ))) WARN( "glBeginFragmentShaderATI returned %#lx\n", status );
+    UNIX_BATCH( glBeginFragmentShaderATI, &args );
 }
 
 static void WINAPI glBeginOcclusionQueryNV( GLuint id )
 {
     struct glBeginOcclusionQueryNV_params args = { .teb = NtCurrentTeb(), .id = id };
-    NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glBeginOcclusionQueryNV, &args ))) WARN( "glBeginOcclusionQueryNV returned %#lx\n", status );
+    UNIX_BATCH( glBeginOcclusionQueryNV, &args );
 }
 
 static void WINAPI glBeginPerfMonitorAMD( GLuint monitor )
 {
     struct glBeginPerfMonitorAMD_params args = { .teb = NtCurrentTeb(), .monitor = monitor };
-    NTSTATUS status;
     TRACE( "monitor %d\n", monitor );
-    if ((status = UNIX_CALL( glBeginPerfMonitorAMD, &args ))) WARN( "glBeginPerfMonitorAMD returned %#lx\n", status );
+    UNIX_BATCH( glBeginPerfMonitorAMD, &args );
 }
 
 static void WINAPI glBeginPerfQueryINTEL( GLuint queryHandle )
 {
     struct glBeginPerfQueryINTEL_params args = { .teb = NtCurrentTeb(), .queryHandle = queryHandle };
-    NTSTATUS status;
     TRACE( "queryHandle %d\n", queryHandle );
-    if ((status = UNIX_CALL( glBeginPerfQueryINTEL, &args ))) WARN( "glBeginPerfQueryINTEL returned %#lx\n", status );
+    UNIX_BATCH( glBeginPerfQueryINTEL, &args );
 }
 
 static void WINAPI glBeginQuery( GLenum target, GLuint id )
 {
     struct glBeginQuery_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
-    NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBeginQuery, &args ))) WARN( "glBeginQuery returned %#lx\n", status );
+    UNIX_BATCH( glBeginQuery, &args );
 }
 
 static void WINAPI glBeginQueryARB( GLenum target, GLuint id )
 {
     struct glBeginQueryARB_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
-    NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBeginQueryARB, &args ))) WARN( "glBeginQueryARB returned %#lx\n", status );
+    UNIX_BATCH( glBeginQueryARB, &args );
 }
 
 static void WINAPI glBeginQueryIndexed( GLenum target, GLuint index, GLuint id )
 {
     struct glBeginQueryIndexed_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .id = id };
-    NTSTATUS status;
     TRACE( "target %d, index %d, id %d\n", target, index, id );
-    if ((status = UNIX_CALL( glBeginQueryIndexed, &args ))) WARN( "glBeginQueryIndexed returned %#lx\n", status );
+    UNIX_BATCH( glBeginQueryIndexed, &args );
 }
 
 static void WINAPI glBeginTransformFeedback( GLenum primitiveMode )
 {
     struct glBeginTransformFeedback_params args = { .teb = NtCurrentTeb(), .primitiveMode = primitiveMode };
-    NTSTATUS status;
     TRACE( "primitiveMode %d\n", primitiveMode );
-    if ((status = UNIX_CALL( glBeginTransformFeedback, &args ))) WARN( "glBeginTransformFeedback returned %#lx\n", status );
+    UNIX_BATCH( glBeginTransformFeedback, &args );
 }
 
 static void WINAPI glBeginTransformFeedbackEXT( GLenum primitiveMode )
 {
     struct glBeginTransformFeedbackEXT_params args = { .teb = NtCurrentTeb(), .primitiveMode = primitiveMode };
-    NTSTATUS status;
     TRACE( "primitiveMode %d\n", primitiveMode );
-    if ((status = UNIX_CALL( glBeginTransformFeedbackEXT, &args ))) WARN( "glBeginTransformFeedbackEXT returned %#lx\n", status );
+    UNIX_BATCH( glBeginTransformFeedbackEXT, &args );
 }
 
 static void WINAPI glBeginTransformFeedbackNV( GLenum primitiveMode )
 {
     struct glBeginTransformFeedbackNV_params args = { .teb = NtCurrentTeb(), .primitiveMode = primitiveMode };
-    NTSTATUS status;
     TRACE( "primitiveMode %d\n", primitiveMode );
-    if ((status = UNIX_CALL( glBeginTransformFeedbackNV, &args ))) WARN( "glBeginTransformFeedbackNV returned %#lx\n", status );
+    UNIX_BATCH( glBeginTransformFeedbackNV, &args );
 }
 
 static void WINAPI glBeginVertexShaderEXT(void)
 {
     struct glBeginVertexShaderEXT_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glBeginVertexShaderEXT, &args ))) WARN( "glBeginVertexShaderEXT returned %#lx\n", status );
+    UNIX_BATCH( glBeginVertexShaderEXT, &args );
 }
 
 static void WINAPI glBeginVideoCaptureNV( GLuint video_capture_slot )
 {
     struct glBeginVideoCaptureNV_params args = { .teb = NtCurrentTeb(), .video_capture_slot = video_capture_slot };
-    NTSTATUS status;
     TRACE( "video_capture_slot %d\n", video_capture_slot );
-    if ((status = UNIX_CALL( glBeginVideoCaptureNV, &args ))) WARN( "glBeginVideoCaptureNV returned %#lx\n", status );
+    UNIX_BATCH( glBeginVideoCaptureNV, &args );
 }
 
 static void WINAPI glBindAttribLocation( GLuint program, GLuint index, const GLchar *name )
@@ -3102,41 +2897,36 @@ static void WINAPI glBindAttribLocationARB( GLhandleARB programObj, GLuint index
 static void WINAPI glBindBuffer( GLenum target, GLuint buffer )
 {
     struct glBindBuffer_params args = { .teb = NtCurrentTeb(), .target = target, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "target %d, buffer %d\n", target, buffer );
-    if ((status = UNIX_CALL( glBindBuffer, &args ))) WARN( "glBindBuffer returned %#lx\n", status );
+    UNIX_BATCH( glBindBuffer, &args );
 }
 
 static void WINAPI glBindBufferARB( GLenum target, GLuint buffer )
 {
     struct glBindBufferARB_params args = { .teb = NtCurrentTeb(), .target = target, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "target %d, buffer %d\n", target, buffer );
-    if ((status = UNIX_CALL( glBindBufferARB, &args ))) WARN( "glBindBufferARB returned %#lx\n", status );
+    UNIX_BATCH( glBindBufferARB, &args );
 }
 
 static void WINAPI glBindBufferBase( GLenum target, GLuint index, GLuint buffer )
 {
     struct glBindBufferBase_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "target %d, index %d, buffer %d\n", target, index, buffer );
-    if ((status = UNIX_CALL( glBindBufferBase, &args ))) WARN( "glBindBufferBase returned %#lx\n", status );
+    UNIX_BATCH( glBindBufferBase, &args );
 }
 
 static void WINAPI glBindBufferBaseEXT( GLenum target, GLuint index, GLuint buffer )
 {
     struct glBindBufferBaseEXT_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "target %d, index %d, buffer %d\n", target, index, buffer );
-    if ((status = UNIX_CALL( glBindBufferBaseEXT, &args ))) WARN( "glBindBufferBaseEXT returned %#lx\n", status );
+    UNIX_BATCH( glBindBufferBaseEXT, &args );
 }
 
 static void WINAPI glBindBufferBaseNV( GLenum target, GLuint index, GLuint buffer )
 {
     struct glBindBufferBaseNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "target %d, index %d, buffer %d\n", target, index, buffer );
-    if ((status = UNIX_CALL( glBindBufferBaseNV, &args ))) WARN( "glBindBufferBaseNV returned %#lx\n", status );
+    UNIX_BATCH( glBindBufferBaseNV, &args );
 }
 
 static void WINAPI glBindBufferOffsetEXT( GLenum target, GLuint index, GLuint buffer, GLintptr offset )
@@ -3222,41 +3012,36 @@ static void WINAPI glBindFragDataLocationIndexed( GLuint program, GLuint colorNu
 static void WINAPI glBindFragmentShaderATI( GLuint id )
 {
     struct glBindFragmentShaderATI_params args = { .teb = NtCurrentTeb(), .id = id };
-    NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glBindFragmentShaderATI, &args ))) WARN( "glBindFragmentShaderATI returned %#lx\n", status );
+    UNIX_BATCH( glBindFragmentShaderATI, &args );
 }
 
 static void WINAPI glBindFramebuffer( GLenum target, GLuint framebuffer )
 {
     struct glBindFramebuffer_params args = { .teb = NtCurrentTeb(), .target = target, .framebuffer = framebuffer };
-    NTSTATUS status;
     TRACE( "target %d, framebuffer %d\n", target, framebuffer );
-    if ((status = UNIX_CALL( glBindFramebuffer, &args ))) WARN( "glBindFramebuffer returned %#lx\n", status );
+    UNIX_BATCH( glBindFramebuffer, &args );
 }
 
 static void WINAPI glBindFramebufferEXT( GLenum target, GLuint framebuffer )
 {
     struct glBindFramebufferEXT_params args = { .teb = NtCurrentTeb(), .target = target, .framebuffer = framebuffer };
-    NTSTATUS status;
     TRACE( "target %d, framebuffer %d\n", target, framebuffer );
-    if ((status = UNIX_CALL( glBindFramebufferEXT, &args ))) WARN( "glBindFramebufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glBindFramebufferEXT, &args );
 }
 
 static void WINAPI glBindImageTexture( GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format )
 {
     struct glBindImageTexture_params args = { .teb = NtCurrentTeb(), .unit = unit, .texture = texture, .level = level, .layered = layered, .layer = layer, .access = access, .format = format };
-    NTSTATUS status;
     TRACE( "unit %d, texture %d, level %d, layered %d, layer %d, access %d, format %d\n", unit, texture, level, layered, layer, access, format );
-    if ((status = UNIX_CALL( glBindImageTexture, &args ))) WARN( "glBindImageTexture returned %#lx\n", status );
+    UNIX_BATCH( glBindImageTexture, &args );
 }
 
 static void WINAPI glBindImageTextureEXT( GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format )
 {
     struct glBindImageTextureEXT_params args = { .teb = NtCurrentTeb(), .index = index, .texture = texture, .level = level, .layered = layered, .layer = layer, .access = access, .format = format };
-    NTSTATUS status;
     TRACE( "index %d, texture %d, level %d, layered %d, layer %d, access %d, format %d\n", index, texture, level, layered, layer, access, format );
-    if ((status = UNIX_CALL( glBindImageTextureEXT, &args ))) WARN( "glBindImageTextureEXT returned %#lx\n", status );
+    UNIX_BATCH( glBindImageTextureEXT, &args );
 }
 
 static void WINAPI glBindImageTextures( GLuint first, GLsizei count, const GLuint *textures )
@@ -3288,9 +3073,8 @@ static GLuint WINAPI glBindMaterialParameterEXT( GLenum face, GLenum value )
 static void WINAPI glBindMultiTextureEXT( GLenum texunit, GLenum target, GLuint texture )
 {
     struct glBindMultiTextureEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .texture = texture };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, texture %d\n", texunit, target, texture );
-    if ((status = UNIX_CALL( glBindMultiTextureEXT, &args ))) WARN( "glBindMultiTextureEXT returned %#lx\n", status );
+    UNIX_BATCH( glBindMultiTextureEXT, &args );
 }
 
 static GLuint WINAPI glBindParameterEXT( GLenum value )
@@ -3305,49 +3089,43 @@ static GLuint WINAPI glBindParameterEXT( GLenum value )
 static void WINAPI glBindProgramARB( GLenum target, GLuint program )
 {
     struct glBindProgramARB_params args = { .teb = NtCurrentTeb(), .target = target, .program = program };
-    NTSTATUS status;
     TRACE( "target %d, program %d\n", target, program );
-    if ((status = UNIX_CALL( glBindProgramARB, &args ))) WARN( "glBindProgramARB returned %#lx\n", status );
+    UNIX_BATCH( glBindProgramARB, &args );
 }
 
 static void WINAPI glBindProgramNV( GLenum target, GLuint id )
 {
     struct glBindProgramNV_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
-    NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBindProgramNV, &args ))) WARN( "glBindProgramNV returned %#lx\n", status );
+    UNIX_BATCH( glBindProgramNV, &args );
 }
 
 static void WINAPI glBindProgramPipeline( GLuint pipeline )
 {
     struct glBindProgramPipeline_params args = { .teb = NtCurrentTeb(), .pipeline = pipeline };
-    NTSTATUS status;
     TRACE( "pipeline %d\n", pipeline );
-    if ((status = UNIX_CALL( glBindProgramPipeline, &args ))) WARN( "glBindProgramPipeline returned %#lx\n", status );
+    UNIX_BATCH( glBindProgramPipeline, &args );
 }
 
 static void WINAPI glBindRenderbuffer( GLenum target, GLuint renderbuffer )
 {
     struct glBindRenderbuffer_params args = { .teb = NtCurrentTeb(), .target = target, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "target %d, renderbuffer %d\n", target, renderbuffer );
-    if ((status = UNIX_CALL( glBindRenderbuffer, &args ))) WARN( "glBindRenderbuffer returned %#lx\n", status );
+    UNIX_BATCH( glBindRenderbuffer, &args );
 }
 
 static void WINAPI glBindRenderbufferEXT( GLenum target, GLuint renderbuffer )
 {
     struct glBindRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .target = target, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "target %d, renderbuffer %d\n", target, renderbuffer );
-    if ((status = UNIX_CALL( glBindRenderbufferEXT, &args ))) WARN( "glBindRenderbufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glBindRenderbufferEXT, &args );
 }
 
 static void WINAPI glBindSampler( GLuint unit, GLuint sampler )
 {
     struct glBindSampler_params args = { .teb = NtCurrentTeb(), .unit = unit, .sampler = sampler };
-    NTSTATUS status;
     TRACE( "unit %d, sampler %d\n", unit, sampler );
-    if ((status = UNIX_CALL( glBindSampler, &args ))) WARN( "glBindSampler returned %#lx\n", status );
+    UNIX_BATCH( glBindSampler, &args );
 }
 
 static void WINAPI glBindSamplers( GLuint first, GLsizei count, const GLuint *samplers )
@@ -3361,9 +3139,8 @@ static void WINAPI glBindSamplers( GLuint first, GLsizei count, const GLuint *sa
 static void WINAPI glBindShadingRateImageNV( GLuint texture )
 {
     struct glBindShadingRateImageNV_params args = { .teb = NtCurrentTeb(), .texture = texture };
-    NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glBindShadingRateImageNV, &args ))) WARN( "glBindShadingRateImageNV returned %#lx\n", status );
+    UNIX_BATCH( glBindShadingRateImageNV, &args );
 }
 
 static GLuint WINAPI glBindTexGenParameterEXT( GLenum unit, GLenum coord, GLenum value )
@@ -3378,17 +3155,15 @@ static GLuint WINAPI glBindTexGenParameterEXT( GLenum unit, GLenum coord, GLenum
 static void WINAPI glBindTextureEXT( GLenum target, GLuint texture )
 {
     struct glBindTextureEXT_params args = { .teb = NtCurrentTeb(), .target = target, .texture = texture };
-    NTSTATUS status;
     TRACE( "target %d, texture %d\n", target, texture );
-    if ((status = UNIX_CALL( glBindTextureEXT, &args ))) WARN( "glBindTextureEXT returned %#lx\n", status );
+    UNIX_BATCH( glBindTextureEXT, &args );
 }
 
 static void WINAPI glBindTextureUnit( GLuint unit, GLuint texture )
 {
     struct glBindTextureUnit_params args = { .teb = NtCurrentTeb(), .unit = unit, .texture = texture };
-    NTSTATUS status;
     TRACE( "unit %d, texture %d\n", unit, texture );
-    if ((status = UNIX_CALL( glBindTextureUnit, &args ))) WARN( "glBindTextureUnit returned %#lx\n", status );
+    UNIX_BATCH( glBindTextureUnit, &args );
 }
 
 static GLuint WINAPI glBindTextureUnitParameterEXT( GLenum unit, GLenum value )
@@ -3411,33 +3186,29 @@ static void WINAPI glBindTextures( GLuint first, GLsizei count, const GLuint *te
 static void WINAPI glBindTransformFeedback( GLenum target, GLuint id )
 {
     struct glBindTransformFeedback_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
-    NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBindTransformFeedback, &args ))) WARN( "glBindTransformFeedback returned %#lx\n", status );
+    UNIX_BATCH( glBindTransformFeedback, &args );
 }
 
 static void WINAPI glBindTransformFeedbackNV( GLenum target, GLuint id )
 {
     struct glBindTransformFeedbackNV_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
-    NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBindTransformFeedbackNV, &args ))) WARN( "glBindTransformFeedbackNV returned %#lx\n", status );
+    UNIX_BATCH( glBindTransformFeedbackNV, &args );
 }
 
 static void WINAPI glBindVertexArray( GLuint array )
 {
     struct glBindVertexArray_params args = { .teb = NtCurrentTeb(), .array = array };
-    NTSTATUS status;
     TRACE( "array %d\n", array );
-    if ((status = UNIX_CALL( glBindVertexArray, &args ))) WARN( "glBindVertexArray returned %#lx\n", status );
+    UNIX_BATCH( glBindVertexArray, &args );
 }
 
 static void WINAPI glBindVertexArrayAPPLE( GLuint array )
 {
     struct glBindVertexArrayAPPLE_params args = { .teb = NtCurrentTeb(), .array = array };
-    NTSTATUS status;
     TRACE( "array %d\n", array );
-    if ((status = UNIX_CALL( glBindVertexArrayAPPLE, &args ))) WARN( "glBindVertexArrayAPPLE returned %#lx\n", status );
+    UNIX_BATCH( glBindVertexArrayAPPLE, &args );
 }
 
 static void WINAPI glBindVertexBuffer( GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride )
@@ -3459,9 +3230,8 @@ static void WINAPI glBindVertexBuffers( GLuint first, GLsizei count, const GLuin
 static void WINAPI glBindVertexShaderEXT( GLuint id )
 {
     struct glBindVertexShaderEXT_params args = { .teb = NtCurrentTeb(), .id = id };
-    NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glBindVertexShaderEXT, &args ))) WARN( "glBindVertexShaderEXT returned %#lx\n", status );
+    UNIX_BATCH( glBindVertexShaderEXT, &args );
 }
 
 static void WINAPI glBindVideoCaptureStreamBufferNV( GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset )
@@ -3475,17 +3245,15 @@ static void WINAPI glBindVideoCaptureStreamBufferNV( GLuint video_capture_slot,
 static void WINAPI glBindVideoCaptureStreamTextureNV( GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLenum target, GLuint texture )
 {
     struct glBindVideoCaptureStreamTextureNV_params args = { .teb = NtCurrentTeb(), .video_capture_slot = video_capture_slot, .stream = stream, .frame_region = frame_region, .target = target, .texture = texture };
-    NTSTATUS status;
     TRACE( "video_capture_slot %d, stream %d, frame_region %d, target %d, texture %d\n", video_capture_slot, stream, frame_region, target, texture );
-    if ((status = UNIX_CALL( glBindVideoCaptureStreamTextureNV, &args ))) WARN( "glBindVideoCaptureStreamTextureNV returned %#lx\n", status );
+    UNIX_BATCH( glBindVideoCaptureStreamTextureNV, &args );
 }
 
 static void WINAPI glBinormal3bEXT( GLbyte bx, GLbyte by, GLbyte bz )
 {
     struct glBinormal3bEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
-    NTSTATUS status;
     TRACE( "bx %d, by %d, bz %d\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3bEXT, &args ))) WARN( "glBinormal3bEXT returned %#lx\n", status );
+    UNIX_BATCH( glBinormal3bEXT, &args );
 }
 
 static void WINAPI glBinormal3bvEXT( const GLbyte *v )
@@ -3499,9 +3267,8 @@ static void WINAPI glBinormal3bvEXT( const GLbyte *v )
 static void WINAPI glBinormal3dEXT( GLdouble bx, GLdouble by, GLdouble bz )
 {
     struct glBinormal3dEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
-    NTSTATUS status;
     TRACE( "bx %f, by %f, bz %f\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3dEXT, &args ))) WARN( "glBinormal3dEXT returned %#lx\n", status );
+    UNIX_BATCH( glBinormal3dEXT, &args );
 }
 
 static void WINAPI glBinormal3dvEXT( const GLdouble *v )
@@ -3515,9 +3282,8 @@ static void WINAPI glBinormal3dvEXT( const GLdouble *v )
 static void WINAPI glBinormal3fEXT( GLfloat bx, GLfloat by, GLfloat bz )
 {
     struct glBinormal3fEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
-    NTSTATUS status;
     TRACE( "bx %f, by %f, bz %f\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3fEXT, &args ))) WARN( "glBinormal3fEXT returned %#lx\n", status );
+    UNIX_BATCH( glBinormal3fEXT, &args );
 }
 
 static void WINAPI glBinormal3fvEXT( const GLfloat *v )
@@ -3531,9 +3297,8 @@ static void WINAPI glBinormal3fvEXT( const GLfloat *v )
 static void WINAPI glBinormal3iEXT( GLint bx, GLint by, GLint bz )
 {
     struct glBinormal3iEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
-    NTSTATUS status;
     TRACE( "bx %d, by %d, bz %d\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3iEXT, &args ))) WARN( "glBinormal3iEXT returned %#lx\n", status );
+    UNIX_BATCH( glBinormal3iEXT, &args );
 }
 
 static void WINAPI glBinormal3ivEXT( const GLint *v )
@@ -3547,9 +3312,8 @@ static void WINAPI glBinormal3ivEXT( const GLint *v )
 static void WINAPI glBinormal3sEXT( GLshort bx, GLshort by, GLshort bz )
 {
     struct glBinormal3sEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
-    NTSTATUS status;
     TRACE( "bx %d, by %d, bz %d\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3sEXT, &args ))) WARN( "glBinormal3sEXT returned %#lx\n", status );
+    UNIX_BATCH( glBinormal3sEXT, &args );
 }
 
 static void WINAPI glBinormal3svEXT( const GLshort *v )
@@ -3579,225 +3343,197 @@ static void WINAPI glBitmapxOES( GLsizei width, GLsizei height, GLfixed xorig, G
 static void WINAPI glBlendBarrierKHR(void)
 {
     struct glBlendBarrierKHR_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glBlendBarrierKHR, &args ))) WARN( "glBlendBarrierKHR returned %#lx\n", status );
+    UNIX_BATCH( glBlendBarrierKHR, &args );
 }
 
 static void WINAPI glBlendBarrierNV(void)
 {
     struct glBlendBarrierNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glBlendBarrierNV, &args ))) WARN( "glBlendBarrierNV returned %#lx\n", status );
+    UNIX_BATCH( glBlendBarrierNV, &args );
 }
 
 static void WINAPI glBlendColor( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
 {
     struct glBlendColor_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glBlendColor, &args ))) WARN( "glBlendColor returned %#lx\n", status );
+    UNIX_BATCH( glBlendColor, &args );
 }
 
 static void WINAPI glBlendColorEXT( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
 {
     struct glBlendColorEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glBlendColorEXT, &args ))) WARN( "glBlendColorEXT returned %#lx\n", status );
+    UNIX_BATCH( glBlendColorEXT, &args );
 }
 
 static void WINAPI glBlendColorxOES( GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha )
 {
     struct glBlendColorxOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glBlendColorxOES, &args ))) WARN( "glBlendColorxOES returned %#lx\n", status );
+    UNIX_BATCH( glBlendColorxOES, &args );
 }
 
 static void WINAPI glBlendEquation( GLenum mode )
 {
     struct glBlendEquation_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glBlendEquation, &args ))) WARN( "glBlendEquation returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquation, &args );
 }
 
 static void WINAPI glBlendEquationEXT( GLenum mode )
 {
     struct glBlendEquationEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glBlendEquationEXT, &args ))) WARN( "glBlendEquationEXT returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationEXT, &args );
 }
 
 static void WINAPI glBlendEquationIndexedAMD( GLuint buf, GLenum mode )
 {
     struct glBlendEquationIndexedAMD_params args = { .teb = NtCurrentTeb(), .buf = buf, .mode = mode };
-    NTSTATUS status;
     TRACE( "buf %d, mode %d\n", buf, mode );
-    if ((status = UNIX_CALL( glBlendEquationIndexedAMD, &args ))) WARN( "glBlendEquationIndexedAMD returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationIndexedAMD, &args );
 }
 
 static void WINAPI glBlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha )
 {
     struct glBlendEquationSeparate_params args = { .teb = NtCurrentTeb(), .modeRGB = modeRGB, .modeAlpha = modeAlpha };
-    NTSTATUS status;
     TRACE( "modeRGB %d, modeAlpha %d\n", modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparate, &args ))) WARN( "glBlendEquationSeparate returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationSeparate, &args );
 }
 
 static void WINAPI glBlendEquationSeparateEXT( GLenum modeRGB, GLenum modeAlpha )
 {
     struct glBlendEquationSeparateEXT_params args = { .teb = NtCurrentTeb(), .modeRGB = modeRGB, .modeAlpha = modeAlpha };
-    NTSTATUS status;
     TRACE( "modeRGB %d, modeAlpha %d\n", modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparateEXT, &args ))) WARN( "glBlendEquationSeparateEXT returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationSeparateEXT, &args );
 }
 
 static void WINAPI glBlendEquationSeparateIndexedAMD( GLuint buf, GLenum modeRGB, GLenum modeAlpha )
 {
     struct glBlendEquationSeparateIndexedAMD_params args = { .teb = NtCurrentTeb(), .buf = buf, .modeRGB = modeRGB, .modeAlpha = modeAlpha };
-    NTSTATUS status;
     TRACE( "buf %d, modeRGB %d, modeAlpha %d\n", buf, modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparateIndexedAMD, &args ))) WARN( "glBlendEquationSeparateIndexedAMD returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationSeparateIndexedAMD, &args );
 }
 
 static void WINAPI glBlendEquationSeparatei( GLuint buf, GLenum modeRGB, GLenum modeAlpha )
 {
     struct glBlendEquationSeparatei_params args = { .teb = NtCurrentTeb(), .buf = buf, .modeRGB = modeRGB, .modeAlpha = modeAlpha };
-    NTSTATUS status;
     TRACE( "buf %d, modeRGB %d, modeAlpha %d\n", buf, modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparatei, &args ))) WARN( "glBlendEquationSeparatei returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationSeparatei, &args );
 }
 
 static void WINAPI glBlendEquationSeparateiARB( GLuint buf, GLenum modeRGB, GLenum modeAlpha )
 {
     struct glBlendEquationSeparateiARB_params args = { .teb = NtCurrentTeb(), .buf = buf, .modeRGB = modeRGB, .modeAlpha = modeAlpha };
-    NTSTATUS status;
     TRACE( "buf %d, modeRGB %d, modeAlpha %d\n", buf, modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparateiARB, &args ))) WARN( "glBlendEquationSeparateiARB returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationSeparateiARB, &args );
 }
 
 static void WINAPI glBlendEquationi( GLuint buf, GLenum mode )
 {
     struct glBlendEquationi_params args = { .teb = NtCurrentTeb(), .buf = buf, .mode = mode };
-    NTSTATUS status;
     TRACE( "buf %d, mode %d\n", buf, mode );
-    if ((status = UNIX_CALL( glBlendEquationi, &args ))) WARN( "glBlendEquationi returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationi, &args );
 }
 
 static void WINAPI glBlendEquationiARB( GLuint buf, GLenum mode )
 {
     struct glBlendEquationiARB_params args = { .teb = NtCurrentTeb(), .buf = buf, .mode = mode };
-    NTSTATUS status;
     TRACE( "buf %d, mode %d\n", buf, mode );
-    if ((status = UNIX_CALL( glBlendEquationiARB, &args ))) WARN( "glBlendEquationiARB returned %#lx\n", status );
+    UNIX_BATCH( glBlendEquationiARB, &args );
 }
 
 static void WINAPI glBlendFuncIndexedAMD( GLuint buf, GLenum src, GLenum dst )
 {
     struct glBlendFuncIndexedAMD_params args = { .teb = NtCurrentTeb(), .buf = buf, .src = src, .dst = dst };
-    NTSTATUS status;
     TRACE( "buf %d, src %d, dst %d\n", buf, src, dst );
-    if ((status = UNIX_CALL( glBlendFuncIndexedAMD, &args ))) WARN( "glBlendFuncIndexedAMD returned %#lx\n", status );
+    UNIX_BATCH( glBlendFuncIndexedAMD, &args );
 }
 
 static void WINAPI glBlendFuncSeparate( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha )
 {
     struct glBlendFuncSeparate_params args = { .teb = NtCurrentTeb(), .sfactorRGB = sfactorRGB, .dfactorRGB = dfactorRGB, .sfactorAlpha = sfactorAlpha, .dfactorAlpha = dfactorAlpha };
-    NTSTATUS status;
     TRACE( "sfactorRGB %d, dfactorRGB %d, sfactorAlpha %d, dfactorAlpha %d\n", sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparate, &args ))) WARN( "glBlendFuncSeparate returned %#lx\n", status );
+    UNIX_BATCH( glBlendFuncSeparate, &args );
 }
 
 static void WINAPI glBlendFuncSeparateEXT( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha )
 {
     struct glBlendFuncSeparateEXT_params args = { .teb = NtCurrentTeb(), .sfactorRGB = sfactorRGB, .dfactorRGB = dfactorRGB, .sfactorAlpha = sfactorAlpha, .dfactorAlpha = dfactorAlpha };
-    NTSTATUS status;
     TRACE( "sfactorRGB %d, dfactorRGB %d, sfactorAlpha %d, dfactorAlpha %d\n", sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparateEXT, &args ))) WARN( "glBlendFuncSeparateEXT returned %#lx\n", status );
+    UNIX_BATCH( glBlendFuncSeparateEXT, &args );
 }
 
 static void WINAPI glBlendFuncSeparateINGR( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha )
 {
     struct glBlendFuncSeparateINGR_params args = { .teb = NtCurrentTeb(), .sfactorRGB = sfactorRGB, .dfactorRGB = dfactorRGB, .sfactorAlpha = sfactorAlpha, .dfactorAlpha = dfactorAlpha };
-    NTSTATUS status;
     TRACE( "sfactorRGB %d, dfactorRGB %d, sfactorAlpha %d, dfactorAlpha %d\n", sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparateINGR, &args ))) WARN( "glBlendFuncSeparateINGR returned %#lx\n", status );
+    UNIX_BATCH( glBlendFuncSeparateINGR, &args );
 }
 
 static void WINAPI glBlendFuncSeparateIndexedAMD( GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
 {
     struct glBlendFuncSeparateIndexedAMD_params args = { .teb = NtCurrentTeb(), .buf = buf, .srcRGB = srcRGB, .dstRGB = dstRGB, .srcAlpha = srcAlpha, .dstAlpha = dstAlpha };
-    NTSTATUS status;
     TRACE( "buf %d, srcRGB %d, dstRGB %d, srcAlpha %d, dstAlpha %d\n", buf, srcRGB, dstRGB, srcAlpha, dstAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparateIndexedAMD, &args ))) WARN( "glBlendFuncSeparateIndexedAMD returned %#lx\n", status );
+    UNIX_BATCH( glBlendFuncSeparateIndexedAMD, &args );
 }
 
 static void WINAPI glBlendFuncSeparatei( GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
 {
     struct glBlendFuncSeparatei_params args = { .teb = NtCurrentTeb(), .buf = buf, .srcRGB = srcRGB, .dstRGB = dstRGB, .srcAlpha = srcAlpha, .dstAlpha = dstAlpha };
-    NTSTATUS status;
     TRACE( "buf %d, srcRGB %d, dstRGB %d, srcAlpha %d, dstAlpha %d\n", buf, srcRGB, dstRGB, srcAlpha, dstAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparatei, &args ))) WARN( "glBlendFuncSeparatei returned %#lx\n", status );
+    UNIX_BATCH( glBlendFuncSeparatei, &args );
 }
 
 static void WINAPI glBlendFuncSeparateiARB( GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
 {
     struct glBlendFuncSeparateiARB_params args = { .teb = NtCurrentTeb(), .buf = buf, .srcRGB = srcRGB, .dstRGB = dstRGB, .srcAlpha = srcAlpha, .dstAlpha = dstAlpha };
-    NTSTATUS status;
     TRACE( "buf %d, srcRGB %d, dstRGB %d, srcAlpha %d, dstAlpha %d\n", buf, srcRGB, dstRGB, srcAlpha, dstAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparateiARB, &args ))) WARN( "glBlendFuncSeparateiARB returned %#lx\n", status );
+    UNIX_BATCH( glBlendFuncSeparateiARB, &args );
 }
 
 static void WINAPI glBlendFunci( GLuint buf, GLenum src, GLenum dst )
 {
     struct glBlendFunci_params args = { .teb = NtCurrentTeb(), .buf = buf, .src = src, .dst = dst };
-    NTSTATUS status;
     TRACE( "buf %d, src %d, dst %d\n", buf, src, dst );
-    if ((status = UNIX_CALL( glBlendFunci, &args ))) WARN( "glBlendFunci returned %#lx\n", status );
+    UNIX_BATCH( glBlendFunci, &args );
 }
 
 static void WINAPI glBlendFunciARB( GLuint buf, GLenum src, GLenum dst )
 {
     struct glBlendFunciARB_params args = { .teb = NtCurrentTeb(), .buf = buf, .src = src, .dst = dst };
-    NTSTATUS status;
     TRACE( "buf %d, src %d, dst %d\n", buf, src, dst );
-    if ((status = UNIX_CALL( glBlendFunciARB, &args ))) WARN( "glBlendFunciARB returned %#lx\n", status );
+    UNIX_BATCH( glBlendFunciARB, &args );
 }
 
 static void WINAPI glBlendParameteriNV( GLenum pname, GLint value )
 {
     struct glBlendParameteriNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .value = value };
-    NTSTATUS status;
     TRACE( "pname %d, value %d\n", pname, value );
-    if ((status = UNIX_CALL( glBlendParameteriNV, &args ))) WARN( "glBlendParameteriNV returned %#lx\n", status );
+    UNIX_BATCH( glBlendParameteriNV, &args );
 }
 
 static void WINAPI glBlitFramebuffer( GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
 {
     struct glBlitFramebuffer_params args = { .teb = NtCurrentTeb(), .srcX0 = srcX0, .srcY0 = srcY0, .srcX1 = srcX1, .srcY1 = srcY1, .dstX0 = dstX0, .dstY0 = dstY0, .dstX1 = dstX1, .dstY1 = dstY1, .mask = mask, .filter = filter };
-    NTSTATUS status;
     TRACE( "srcX0 %d, srcY0 %d, srcX1 %d, srcY1 %d, dstX0 %d, dstY0 %d, dstX1 %d, dstY1 %d, mask %d, filter %d\n", srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
-    if ((status = UNIX_CALL( glBlitFramebuffer, &args ))) WARN( "glBlitFramebuffer returned %#lx\n", status );
+    UNIX_BATCH( glBlitFramebuffer, &args );
 }
 
 static void WINAPI glBlitFramebufferEXT( GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
 {
     struct glBlitFramebufferEXT_params args = { .teb = NtCurrentTeb(), .srcX0 = srcX0, .srcY0 = srcY0, .srcX1 = srcX1, .srcY1 = srcY1, .dstX0 = dstX0, .dstY0 = dstY0, .dstX1 = dstX1, .dstY1 = dstY1, .mask = mask, .filter = filter };
-    NTSTATUS status;
     TRACE( "srcX0 %d, srcY0 %d, srcX1 %d, srcY1 %d, dstX0 %d, dstY0 %d, dstX1 %d, dstY1 %d, mask %d, filter %d\n", srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
-    if ((status = UNIX_CALL( glBlitFramebufferEXT, &args ))) WARN( "glBlitFramebufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glBlitFramebufferEXT, &args );
 }
 
 static void WINAPI glBlitNamedFramebuffer( GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
 {
     struct glBlitNamedFramebuffer_params args = { .teb = NtCurrentTeb(), .readFramebuffer = readFramebuffer, .drawFramebuffer = drawFramebuffer, .srcX0 = srcX0, .srcY0 = srcY0, .srcX1 = srcX1, .srcY1 = srcY1, .dstX0 = dstX0, .dstY0 = dstY0, .dstX1 = dstX1, .dstY1 = dstY1, .mask = mask, .filter = filter };
-    NTSTATUS status;
     TRACE( "readFramebuffer %d, drawFramebuffer %d, srcX0 %d, srcY0 %d, srcX1 %d, srcY1 %d, dstX0 %d, dstY0 %d, dstX1 %d, dstY1 %d, mask %d, filter %d\n", readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
-    if ((status = UNIX_CALL( glBlitNamedFramebuffer, &args ))) WARN( "glBlitNamedFramebuffer returned %#lx\n", status );
+    UNIX_BATCH( glBlitNamedFramebuffer, &args );
 }
 
 static void WINAPI glBufferAddressRangeNV( GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length )
@@ -3811,9 +3547,8 @@ static void WINAPI glBufferAddressRangeNV( GLenum pname, GLuint index, GLuint64E
 static void WINAPI glBufferAttachMemoryNV( GLenum target, GLuint memory, GLuint64 offset )
 {
     struct glBufferAttachMemoryNV_params args = { .teb = NtCurrentTeb(), .target = target, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "target %d, memory %d, offset %s\n", target, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glBufferAttachMemoryNV, &args ))) WARN( "glBufferAttachMemoryNV returned %#lx\n", status );
+    UNIX_BATCH( glBufferAttachMemoryNV, &args );
 }
 
 static void WINAPI glBufferData( GLenum target, GLsizeiptr size, const void *data, GLenum usage )
@@ -3843,9 +3578,8 @@ static void WINAPI glBufferPageCommitmentARB( GLenum target, GLintptr offset, GL
 static void WINAPI glBufferParameteriAPPLE( GLenum target, GLenum pname, GLint param )
 {
     struct glBufferParameteriAPPLE_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glBufferParameteriAPPLE, &args ))) WARN( "glBufferParameteriAPPLE returned %#lx\n", status );
+    UNIX_BATCH( glBufferParameteriAPPLE, &args );
 }
 
 static GLuint WINAPI glBufferRegionEnabled(void)
@@ -3900,9 +3634,8 @@ static void WINAPI glBufferSubDataARB( GLenum target, GLintptrARB offset, GLsize
 static void WINAPI glCallCommandListNV( GLuint list )
 {
     struct glCallCommandListNV_params args = { .teb = NtCurrentTeb(), .list = list };
-    NTSTATUS status;
     TRACE( "list %d\n", list );
-    if ((status = UNIX_CALL( glCallCommandListNV, &args ))) WARN( "glCallCommandListNV returned %#lx\n", status );
+    UNIX_BATCH( glCallCommandListNV, &args );
 }
 
 static GLenum WINAPI glCheckFramebufferStatus( GLenum target )
@@ -3944,25 +3677,22 @@ static GLenum WINAPI glCheckNamedFramebufferStatusEXT( GLuint framebuffer, GLenu
 static void WINAPI glClampColor( GLenum target, GLenum clamp )
 {
     struct glClampColor_params args = { .teb = NtCurrentTeb(), .target = target, .clamp = clamp };
-    NTSTATUS status;
     TRACE( "target %d, clamp %d\n", target, clamp );
-    if ((status = UNIX_CALL( glClampColor, &args ))) WARN( "glClampColor returned %#lx\n", status );
+    UNIX_BATCH( glClampColor, &args );
 }
 
 static void WINAPI glClampColorARB( GLenum target, GLenum clamp )
 {
     struct glClampColorARB_params args = { .teb = NtCurrentTeb(), .target = target, .clamp = clamp };
-    NTSTATUS status;
     TRACE( "target %d, clamp %d\n", target, clamp );
-    if ((status = UNIX_CALL( glClampColorARB, &args ))) WARN( "glClampColorARB returned %#lx\n", status );
+    UNIX_BATCH( glClampColorARB, &args );
 }
 
 static void WINAPI glClearAccumxOES( GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha )
 {
     struct glClearAccumxOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearAccumxOES, &args ))) WARN( "glClearAccumxOES returned %#lx\n", status );
+    UNIX_BATCH( glClearAccumxOES, &args );
 }
 
 static void WINAPI glClearBufferData( GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data )
@@ -3984,9 +3714,8 @@ static void WINAPI glClearBufferSubData( GLenum target, GLenum internalformat, G
 static void WINAPI glClearBufferfi( GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil )
 {
     struct glClearBufferfi_params args = { .teb = NtCurrentTeb(), .buffer = buffer, .drawbuffer = drawbuffer, .depth = depth, .stencil = stencil };
-    NTSTATUS status;
     TRACE( "buffer %d, drawbuffer %d, depth %f, stencil %d\n", buffer, drawbuffer, depth, stencil );
-    if ((status = UNIX_CALL( glClearBufferfi, &args ))) WARN( "glClearBufferfi returned %#lx\n", status );
+    UNIX_BATCH( glClearBufferfi, &args );
 }
 
 static void WINAPI glClearBufferfv( GLenum buffer, GLint drawbuffer, const GLfloat *value )
@@ -4016,57 +3745,50 @@ static void WINAPI glClearBufferuiv( GLenum buffer, GLint drawbuffer, const GLui
 static void WINAPI glClearColorIiEXT( GLint red, GLint green, GLint blue, GLint alpha )
 {
     struct glClearColorIiEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearColorIiEXT, &args ))) WARN( "glClearColorIiEXT returned %#lx\n", status );
+    UNIX_BATCH( glClearColorIiEXT, &args );
 }
 
 static void WINAPI glClearColorIuiEXT( GLuint red, GLuint green, GLuint blue, GLuint alpha )
 {
     struct glClearColorIuiEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearColorIuiEXT, &args ))) WARN( "glClearColorIuiEXT returned %#lx\n", status );
+    UNIX_BATCH( glClearColorIuiEXT, &args );
 }
 
 static void WINAPI glClearColorxOES( GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha )
 {
     struct glClearColorxOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearColorxOES, &args ))) WARN( "glClearColorxOES returned %#lx\n", status );
+    UNIX_BATCH( glClearColorxOES, &args );
 }
 
 static void WINAPI glClearDepthdNV( GLdouble depth )
 {
     struct glClearDepthdNV_params args = { .teb = NtCurrentTeb(), .depth = depth };
-    NTSTATUS status;
     TRACE( "depth %f\n", depth );
-    if ((status = UNIX_CALL( glClearDepthdNV, &args ))) WARN( "glClearDepthdNV returned %#lx\n", status );
+    UNIX_BATCH( glClearDepthdNV, &args );
 }
 
 static void WINAPI glClearDepthf( GLfloat d )
 {
     struct glClearDepthf_params args = { .teb = NtCurrentTeb(), .d = d };
-    NTSTATUS status;
     TRACE( "d %f\n", d );
-    if ((status = UNIX_CALL( glClearDepthf, &args ))) WARN( "glClearDepthf returned %#lx\n", status );
+    UNIX_BATCH( glClearDepthf, &args );
 }
 
 static void WINAPI glClearDepthfOES( GLclampf depth )
 {
     struct glClearDepthfOES_params args = { .teb = NtCurrentTeb(), .depth = depth };
-    NTSTATUS status;
     TRACE( "depth %f\n", depth );
-    if ((status = UNIX_CALL( glClearDepthfOES, &args ))) WARN( "glClearDepthfOES returned %#lx\n", status );
+    UNIX_BATCH( glClearDepthfOES, &args );
 }
 
 static void WINAPI glClearDepthxOES( GLfixed depth )
 {
     struct glClearDepthxOES_params args = { .teb = NtCurrentTeb(), .depth = depth };
-    NTSTATUS status;
     TRACE( "depth %d\n", depth );
-    if ((status = UNIX_CALL( glClearDepthxOES, &args ))) WARN( "glClearDepthxOES returned %#lx\n", status );
+    UNIX_BATCH( glClearDepthxOES, &args );
 }
 
 static void WINAPI glClearNamedBufferData( GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data )
@@ -4104,9 +3826,8 @@ static void WINAPI glClearNamedBufferSubDataEXT( GLuint buffer, GLenum internalf
 static void WINAPI glClearNamedFramebufferfi( GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil )
 {
     struct glClearNamedFramebufferfi_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .buffer = buffer, .drawbuffer = drawbuffer, .depth = depth, .stencil = stencil };
-    NTSTATUS status;
     TRACE( "framebuffer %d, buffer %d, drawbuffer %d, depth %f, stencil %d\n", framebuffer, buffer, drawbuffer, depth, stencil );
-    if ((status = UNIX_CALL( glClearNamedFramebufferfi, &args ))) WARN( "glClearNamedFramebufferfi returned %#lx\n", status );
+    UNIX_BATCH( glClearNamedFramebufferfi, &args );
 }
 
 static void WINAPI glClearNamedFramebufferfv( GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value )
@@ -4152,33 +3873,29 @@ static void WINAPI glClearTexSubImage( GLuint texture, GLint level, GLint xoffse
 static void WINAPI glClientActiveTexture( GLenum texture )
 {
     struct glClientActiveTexture_params args = { .teb = NtCurrentTeb(), .texture = texture };
-    NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glClientActiveTexture, &args ))) WARN( "glClientActiveTexture returned %#lx\n", status );
+    UNIX_BATCH( glClientActiveTexture, &args );
 }
 
 static void WINAPI glClientActiveTextureARB( GLenum texture )
 {
     struct glClientActiveTextureARB_params args = { .teb = NtCurrentTeb(), .texture = texture };
-    NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glClientActiveTextureARB, &args ))) WARN( "glClientActiveTextureARB returned %#lx\n", status );
+    UNIX_BATCH( glClientActiveTextureARB, &args );
 }
 
 static void WINAPI glClientActiveVertexStreamATI( GLenum stream )
 {
     struct glClientActiveVertexStreamATI_params args = { .teb = NtCurrentTeb(), .stream = stream };
-    NTSTATUS status;
     TRACE( "stream %d\n", stream );
-    if ((status = UNIX_CALL( glClientActiveVertexStreamATI, &args ))) WARN( "glClientActiveVertexStreamATI returned %#lx\n", status );
+    UNIX_BATCH( glClientActiveVertexStreamATI, &args );
 }
 
 static void WINAPI glClientAttribDefaultEXT( GLbitfield mask )
 {
     struct glClientAttribDefaultEXT_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glClientAttribDefaultEXT, &args ))) WARN( "glClientAttribDefaultEXT returned %#lx\n", status );
+    UNIX_BATCH( glClientAttribDefaultEXT, &args );
 }
 
 static void WINAPI glClientWaitSemaphoreui64NVX( GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray )
@@ -4201,9 +3918,8 @@ static GLenum WINAPI glClientWaitSync( GLsync sync, GLbitfield flags, GLuint64 t
 static void WINAPI glClipControl( GLenum origin, GLenum depth )
 {
     struct glClipControl_params args = { .teb = NtCurrentTeb(), .origin = origin, .depth = depth };
-    NTSTATUS status;
     TRACE( "origin %d, depth %d\n", origin, depth );
-    if ((status = UNIX_CALL( glClipControl, &args ))) WARN( "glClipControl returned %#lx\n", status );
+    UNIX_BATCH( glClipControl, &args );
 }
 
 static void WINAPI glClipPlanefOES( GLenum plane, const GLfloat *equation )
@@ -4225,9 +3941,8 @@ static void WINAPI glClipPlanexOES( GLenum plane, const GLfixed *equation )
 static void WINAPI glColor3fVertex3fSUN( GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glColor3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .r = r, .g = g, .b = b, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "r %f, g %f, b %f, x %f, y %f, z %f\n", r, g, b, x, y, z );
-    if ((status = UNIX_CALL( glColor3fVertex3fSUN, &args ))) WARN( "glColor3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glColor3fVertex3fSUN, &args );
 }
 
 static void WINAPI glColor3fVertex3fvSUN( const GLfloat *c, const GLfloat *v )
@@ -4241,9 +3956,8 @@ static void WINAPI glColor3fVertex3fvSUN( const GLfloat *c, const GLfloat *v )
 static void WINAPI glColor3hNV( GLhalfNV red, GLhalfNV green, GLhalfNV blue )
 {
     struct glColor3hNV_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3hNV, &args ))) WARN( "glColor3hNV returned %#lx\n", status );
+    UNIX_BATCH( glColor3hNV, &args );
 }
 
 static void WINAPI glColor3hvNV( const GLhalfNV *v )
@@ -4257,9 +3971,8 @@ static void WINAPI glColor3hvNV( const GLhalfNV *v )
 static void WINAPI glColor3xOES( GLfixed red, GLfixed green, GLfixed blue )
 {
     struct glColor3xOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3xOES, &args ))) WARN( "glColor3xOES returned %#lx\n", status );
+    UNIX_BATCH( glColor3xOES, &args );
 }
 
 static void WINAPI glColor3xvOES( const GLfixed *components )
@@ -4273,9 +3986,8 @@ static void WINAPI glColor3xvOES( const GLfixed *components )
 static void WINAPI glColor4fNormal3fVertex3fSUN( GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glColor4fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", r, g, b, a, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glColor4fNormal3fVertex3fSUN, &args ))) WARN( "glColor4fNormal3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glColor4fNormal3fVertex3fSUN, &args );
 }
 
 static void WINAPI glColor4fNormal3fVertex3fvSUN( const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -4289,9 +4001,8 @@ static void WINAPI glColor4fNormal3fVertex3fvSUN( const GLfloat *c, const GLfloa
 static void WINAPI glColor4hNV( GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha )
 {
     struct glColor4hNV_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4hNV, &args ))) WARN( "glColor4hNV returned %#lx\n", status );
+    UNIX_BATCH( glColor4hNV, &args );
 }
 
 static void WINAPI glColor4hvNV( const GLhalfNV *v )
@@ -4305,9 +4016,8 @@ static void WINAPI glColor4hvNV( const GLhalfNV *v )
 static void WINAPI glColor4ubVertex2fSUN( GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y )
 {
     struct glColor4ubVertex2fSUN_params args = { .teb = NtCurrentTeb(), .r = r, .g = g, .b = b, .a = a, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "r %d, g %d, b %d, a %d, x %f, y %f\n", r, g, b, a, x, y );
-    if ((status = UNIX_CALL( glColor4ubVertex2fSUN, &args ))) WARN( "glColor4ubVertex2fSUN returned %#lx\n", status );
+    UNIX_BATCH( glColor4ubVertex2fSUN, &args );
 }
 
 static void WINAPI glColor4ubVertex2fvSUN( const GLubyte *c, const GLfloat *v )
@@ -4321,9 +4031,8 @@ static void WINAPI glColor4ubVertex2fvSUN( const GLubyte *c, const GLfloat *v )
 static void WINAPI glColor4ubVertex3fSUN( GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glColor4ubVertex3fSUN_params args = { .teb = NtCurrentTeb(), .r = r, .g = g, .b = b, .a = a, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "r %d, g %d, b %d, a %d, x %f, y %f, z %f\n", r, g, b, a, x, y, z );
-    if ((status = UNIX_CALL( glColor4ubVertex3fSUN, &args ))) WARN( "glColor4ubVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glColor4ubVertex3fSUN, &args );
 }
 
 static void WINAPI glColor4ubVertex3fvSUN( const GLubyte *c, const GLfloat *v )
@@ -4337,9 +4046,8 @@ static void WINAPI glColor4ubVertex3fvSUN( const GLubyte *c, const GLfloat *v )
 static void WINAPI glColor4xOES( GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha )
 {
     struct glColor4xOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4xOES, &args ))) WARN( "glColor4xOES returned %#lx\n", status );
+    UNIX_BATCH( glColor4xOES, &args );
 }
 
 static void WINAPI glColor4xvOES( const GLfixed *components )
@@ -4353,57 +4061,50 @@ static void WINAPI glColor4xvOES( const GLfixed *components )
 static void WINAPI glColorFormatNV( GLint size, GLenum type, GLsizei stride )
 {
     struct glColorFormatNV_params args = { .teb = NtCurrentTeb(), .size = size, .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "size %d, type %d, stride %d\n", size, type, stride );
-    if ((status = UNIX_CALL( glColorFormatNV, &args ))) WARN( "glColorFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glColorFormatNV, &args );
 }
 
 static void WINAPI glColorFragmentOp1ATI( GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod )
 {
     struct glColorFragmentOp1ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMask = dstMask, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod };
-    NTSTATUS status;
     TRACE( "op %d, dst %d, dstMask %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod );
-    if ((status = UNIX_CALL( glColorFragmentOp1ATI, &args ))) WARN( "glColorFragmentOp1ATI returned %#lx\n", status );
+    UNIX_BATCH( glColorFragmentOp1ATI, &args );
 }
 
 static void WINAPI glColorFragmentOp2ATI( GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod )
 {
     struct glColorFragmentOp2ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMask = dstMask, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod, .arg2 = arg2, .arg2Rep = arg2Rep, .arg2Mod = arg2Mod };
-    NTSTATUS status;
     TRACE( "op %d, dst %d, dstMask %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d, arg2 %d, arg2Rep %d, arg2Mod %d\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod );
-    if ((status = UNIX_CALL( glColorFragmentOp2ATI, &args ))) WARN( "glColorFragmentOp2ATI returned %#lx\n", status );
+    UNIX_BATCH( glColorFragmentOp2ATI, &args );
 }
 
 static void WINAPI glColorFragmentOp3ATI( GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod )
 {
     struct glColorFragmentOp3ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMask = dstMask, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod, .arg2 = arg2, .arg2Rep = arg2Rep, .arg2Mod = arg2Mod, .arg3 = arg3, .arg3Rep = arg3Rep, .arg3Mod = arg3Mod };
-    NTSTATUS status;
     TRACE( "op %d, dst %d, dstMask %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d, arg2 %d, arg2Rep %d, arg2Mod %d, arg3 %d, arg3Rep %d, arg3Mod %d\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod );
-    if ((status = UNIX_CALL( glColorFragmentOp3ATI, &args ))) WARN( "glColorFragmentOp3ATI returned %#lx\n", status );
+    UNIX_BATCH( glColorFragmentOp3ATI, &args );
 }
 
 static void WINAPI glColorMaskIndexedEXT( GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a )
 {
     struct glColorMaskIndexedEXT_params args = { .teb = NtCurrentTeb(), .index = index, .r = r, .g = g, .b = b, .a = a };
-    NTSTATUS status;
     TRACE( "index %d, r %d, g %d, b %d, a %d\n", index, r, g, b, a );
-    if ((status = UNIX_CALL( glColorMaskIndexedEXT, &args ))) WARN( "glColorMaskIndexedEXT returned %#lx\n", status );
+    UNIX_BATCH( glColorMaskIndexedEXT, &args );
 }
 
 static void WINAPI glColorMaski( GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a )
 {
     struct glColorMaski_params args = { .teb = NtCurrentTeb(), .index = index, .r = r, .g = g, .b = b, .a = a };
-    NTSTATUS status;
     TRACE( "index %d, r %d, g %d, b %d, a %d\n", index, r, g, b, a );
-    if ((status = UNIX_CALL( glColorMaski, &args ))) WARN( "glColorMaski returned %#lx\n", status );
+    UNIX_BATCH( glColorMaski, &args );
 }
 
 static void WINAPI glColorP3ui( GLenum type, GLuint color )
 {
     struct glColorP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .color = color };
-    NTSTATUS status;
     TRACE( "type %d, color %d\n", type, color );
-    if ((status = UNIX_CALL( glColorP3ui, &args ))) WARN( "glColorP3ui returned %#lx\n", status );
+    UNIX_BATCH( glColorP3ui, &args );
 }
 
 static void WINAPI glColorP3uiv( GLenum type, const GLuint *color )
@@ -4417,9 +4118,8 @@ static void WINAPI glColorP3uiv( GLenum type, const GLuint *color )
 static void WINAPI glColorP4ui( GLenum type, GLuint color )
 {
     struct glColorP4ui_params args = { .teb = NtCurrentTeb(), .type = type, .color = color };
-    NTSTATUS status;
     TRACE( "type %d, color %d\n", type, color );
-    if ((status = UNIX_CALL( glColorP4ui, &args ))) WARN( "glColorP4ui returned %#lx\n", status );
+    UNIX_BATCH( glColorP4ui, &args );
 }
 
 static void WINAPI glColorP4uiv( GLenum type, const GLuint *color )
@@ -4529,25 +4229,22 @@ static void WINAPI glColorTableSGI( GLenum target, GLenum internalformat, GLsize
 static void WINAPI glCombinerInputNV( GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage )
 {
     struct glCombinerInputNV_params args = { .teb = NtCurrentTeb(), .stage = stage, .portion = portion, .variable = variable, .input = input, .mapping = mapping, .componentUsage = componentUsage };
-    NTSTATUS status;
     TRACE( "stage %d, portion %d, variable %d, input %d, mapping %d, componentUsage %d\n", stage, portion, variable, input, mapping, componentUsage );
-    if ((status = UNIX_CALL( glCombinerInputNV, &args ))) WARN( "glCombinerInputNV returned %#lx\n", status );
+    UNIX_BATCH( glCombinerInputNV, &args );
 }
 
 static void WINAPI glCombinerOutputNV( GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum )
 {
     struct glCombinerOutputNV_params args = { .teb = NtCurrentTeb(), .stage = stage, .portion = portion, .abOutput = abOutput, .cdOutput = cdOutput, .sumOutput = sumOutput, .scale = scale, .bias = bias, .abDotProduct = abDotProduct, .cdDotProduct = cdDotProduct, .muxSum = muxSum };
-    NTSTATUS status;
     TRACE( "stage %d, portion %d, abOutput %d, cdOutput %d, sumOutput %d, scale %d, bias %d, abDotProduct %d, cdDotProduct %d, muxSum %d\n", stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum );
-    if ((status = UNIX_CALL( glCombinerOutputNV, &args ))) WARN( "glCombinerOutputNV returned %#lx\n", status );
+    UNIX_BATCH( glCombinerOutputNV, &args );
 }
 
 static void WINAPI glCombinerParameterfNV( GLenum pname, GLfloat param )
 {
     struct glCombinerParameterfNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glCombinerParameterfNV, &args ))) WARN( "glCombinerParameterfNV returned %#lx\n", status );
+    UNIX_BATCH( glCombinerParameterfNV, &args );
 }
 
 static void WINAPI glCombinerParameterfvNV( GLenum pname, const GLfloat *params )
@@ -4561,9 +4258,8 @@ static void WINAPI glCombinerParameterfvNV( GLenum pname, const GLfloat *params
 static void WINAPI glCombinerParameteriNV( GLenum pname, GLint param )
 {
     struct glCombinerParameteriNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glCombinerParameteriNV, &args ))) WARN( "glCombinerParameteriNV returned %#lx\n", status );
+    UNIX_BATCH( glCombinerParameteriNV, &args );
 }
 
 static void WINAPI glCombinerParameterivNV( GLenum pname, const GLint *params )
@@ -4585,33 +4281,29 @@ static void WINAPI glCombinerStageParameterfvNV( GLenum stage, GLenum pname, con
 static void WINAPI glCommandListSegmentsNV( GLuint list, GLuint segments )
 {
     struct glCommandListSegmentsNV_params args = { .teb = NtCurrentTeb(), .list = list, .segments = segments };
-    NTSTATUS status;
     TRACE( "list %d, segments %d\n", list, segments );
-    if ((status = UNIX_CALL( glCommandListSegmentsNV, &args ))) WARN( "glCommandListSegmentsNV returned %#lx\n", status );
+    UNIX_BATCH( glCommandListSegmentsNV, &args );
 }
 
 static void WINAPI glCompileCommandListNV( GLuint list )
 {
     struct glCompileCommandListNV_params args = { .teb = NtCurrentTeb(), .list = list };
-    NTSTATUS status;
     TRACE( "list %d\n", list );
-    if ((status = UNIX_CALL( glCompileCommandListNV, &args ))) WARN( "glCompileCommandListNV returned %#lx\n", status );
+    UNIX_BATCH( glCompileCommandListNV, &args );
 }
 
 static void WINAPI glCompileShader( GLuint shader )
 {
     struct glCompileShader_params args = { .teb = NtCurrentTeb(), .shader = shader };
-    NTSTATUS status;
     TRACE( "shader %d\n", shader );
-    if ((status = UNIX_CALL( glCompileShader, &args ))) WARN( "glCompileShader returned %#lx\n", status );
+    UNIX_BATCH( glCompileShader, &args );
 }
 
 static void WINAPI glCompileShaderARB( GLhandleARB shaderObj )
 {
     struct glCompileShaderARB_params args = { .teb = NtCurrentTeb(), .shaderObj = shaderObj };
-    NTSTATUS status;
     TRACE( "shaderObj %d\n", shaderObj );
-    if ((status = UNIX_CALL( glCompileShaderARB, &args ))) WARN( "glCompileShaderARB returned %#lx\n", status );
+    UNIX_BATCH( glCompileShaderARB, &args );
 }
 
 static void WINAPI glCompileShaderIncludeARB( GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length )
@@ -4841,17 +4533,15 @@ static void WINAPI glCompressedTextureSubImage3DEXT( GLuint texture, GLenum targ
 static void WINAPI glConservativeRasterParameterfNV( GLenum pname, GLfloat value )
 {
     struct glConservativeRasterParameterfNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .value = value };
-    NTSTATUS status;
     TRACE( "pname %d, value %f\n", pname, value );
-    if ((status = UNIX_CALL( glConservativeRasterParameterfNV, &args ))) WARN( "glConservativeRasterParameterfNV returned %#lx\n", status );
+    UNIX_BATCH( glConservativeRasterParameterfNV, &args );
 }
 
 static void WINAPI glConservativeRasterParameteriNV( GLenum pname, GLint param )
 {
     struct glConservativeRasterParameteriNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glConservativeRasterParameteriNV, &args ))) WARN( "glConservativeRasterParameteriNV returned %#lx\n", status );
+    UNIX_BATCH( glConservativeRasterParameteriNV, &args );
 }
 
 static void WINAPI glConvolutionFilter1D( GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image )
@@ -4889,17 +4579,15 @@ static void WINAPI glConvolutionFilter2DEXT( GLenum target, GLenum internalforma
 static void WINAPI glConvolutionParameterf( GLenum target, GLenum pname, GLfloat params )
 {
     struct glConvolutionParameterf_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .params = params };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, params %f\n", target, pname, params );
-    if ((status = UNIX_CALL( glConvolutionParameterf, &args ))) WARN( "glConvolutionParameterf returned %#lx\n", status );
+    UNIX_BATCH( glConvolutionParameterf, &args );
 }
 
 static void WINAPI glConvolutionParameterfEXT( GLenum target, GLenum pname, GLfloat params )
 {
     struct glConvolutionParameterfEXT_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .params = params };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, params %f\n", target, pname, params );
-    if ((status = UNIX_CALL( glConvolutionParameterfEXT, &args ))) WARN( "glConvolutionParameterfEXT returned %#lx\n", status );
+    UNIX_BATCH( glConvolutionParameterfEXT, &args );
 }
 
 static void WINAPI glConvolutionParameterfv( GLenum target, GLenum pname, const GLfloat *params )
@@ -4921,17 +4609,15 @@ static void WINAPI glConvolutionParameterfvEXT( GLenum target, GLenum pname, con
 static void WINAPI glConvolutionParameteri( GLenum target, GLenum pname, GLint params )
 {
     struct glConvolutionParameteri_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .params = params };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, params %d\n", target, pname, params );
-    if ((status = UNIX_CALL( glConvolutionParameteri, &args ))) WARN( "glConvolutionParameteri returned %#lx\n", status );
+    UNIX_BATCH( glConvolutionParameteri, &args );
 }
 
 static void WINAPI glConvolutionParameteriEXT( GLenum target, GLenum pname, GLint params )
 {
     struct glConvolutionParameteriEXT_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .params = params };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, params %d\n", target, pname, params );
-    if ((status = UNIX_CALL( glConvolutionParameteriEXT, &args ))) WARN( "glConvolutionParameteriEXT returned %#lx\n", status );
+    UNIX_BATCH( glConvolutionParameteriEXT, &args );
 }
 
 static void WINAPI glConvolutionParameteriv( GLenum target, GLenum pname, const GLint *params )
@@ -4953,9 +4639,8 @@ static void WINAPI glConvolutionParameterivEXT( GLenum target, GLenum pname, con
 static void WINAPI glConvolutionParameterxOES( GLenum target, GLenum pname, GLfixed param )
 {
     struct glConvolutionParameterxOES_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glConvolutionParameterxOES, &args ))) WARN( "glConvolutionParameterxOES returned %#lx\n", status );
+    UNIX_BATCH( glConvolutionParameterxOES, &args );
 }
 
 static void WINAPI glConvolutionParameterxvOES( GLenum target, GLenum pname, const GLfixed *params )
@@ -4977,121 +4662,106 @@ static void WINAPI glCopyBufferSubData( GLenum readTarget, GLenum writeTarget, G
 static void WINAPI glCopyColorSubTable( GLenum target, GLsizei start, GLint x, GLint y, GLsizei width )
 {
     struct glCopyColorSubTable_params args = { .teb = NtCurrentTeb(), .target = target, .start = start, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, start %d, x %d, y %d, width %d\n", target, start, x, y, width );
-    if ((status = UNIX_CALL( glCopyColorSubTable, &args ))) WARN( "glCopyColorSubTable returned %#lx\n", status );
+    UNIX_BATCH( glCopyColorSubTable, &args );
 }
 
 static void WINAPI glCopyColorSubTableEXT( GLenum target, GLsizei start, GLint x, GLint y, GLsizei width )
 {
     struct glCopyColorSubTableEXT_params args = { .teb = NtCurrentTeb(), .target = target, .start = start, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, start %d, x %d, y %d, width %d\n", target, start, x, y, width );
-    if ((status = UNIX_CALL( glCopyColorSubTableEXT, &args ))) WARN( "glCopyColorSubTableEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyColorSubTableEXT, &args );
 }
 
 static void WINAPI glCopyColorTable( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width )
 {
     struct glCopyColorTable_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d\n", target, internalformat, x, y, width );
-    if ((status = UNIX_CALL( glCopyColorTable, &args ))) WARN( "glCopyColorTable returned %#lx\n", status );
+    UNIX_BATCH( glCopyColorTable, &args );
 }
 
 static void WINAPI glCopyColorTableSGI( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width )
 {
     struct glCopyColorTableSGI_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d\n", target, internalformat, x, y, width );
-    if ((status = UNIX_CALL( glCopyColorTableSGI, &args ))) WARN( "glCopyColorTableSGI returned %#lx\n", status );
+    UNIX_BATCH( glCopyColorTableSGI, &args );
 }
 
 static void WINAPI glCopyConvolutionFilter1D( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width )
 {
     struct glCopyConvolutionFilter1D_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d\n", target, internalformat, x, y, width );
-    if ((status = UNIX_CALL( glCopyConvolutionFilter1D, &args ))) WARN( "glCopyConvolutionFilter1D returned %#lx\n", status );
+    UNIX_BATCH( glCopyConvolutionFilter1D, &args );
 }
 
 static void WINAPI glCopyConvolutionFilter1DEXT( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width )
 {
     struct glCopyConvolutionFilter1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d\n", target, internalformat, x, y, width );
-    if ((status = UNIX_CALL( glCopyConvolutionFilter1DEXT, &args ))) WARN( "glCopyConvolutionFilter1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyConvolutionFilter1DEXT, &args );
 }
 
 static void WINAPI glCopyConvolutionFilter2D( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyConvolutionFilter2D_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d, height %d\n", target, internalformat, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyConvolutionFilter2D, &args ))) WARN( "glCopyConvolutionFilter2D returned %#lx\n", status );
+    UNIX_BATCH( glCopyConvolutionFilter2D, &args );
 }
 
 static void WINAPI glCopyConvolutionFilter2DEXT( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyConvolutionFilter2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d, height %d\n", target, internalformat, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyConvolutionFilter2DEXT, &args ))) WARN( "glCopyConvolutionFilter2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyConvolutionFilter2DEXT, &args );
 }
 
 static void WINAPI glCopyImageSubData( GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth )
 {
     struct glCopyImageSubData_params args = { .teb = NtCurrentTeb(), .srcName = srcName, .srcTarget = srcTarget, .srcLevel = srcLevel, .srcX = srcX, .srcY = srcY, .srcZ = srcZ, .dstName = dstName, .dstTarget = dstTarget, .dstLevel = dstLevel, .dstX = dstX, .dstY = dstY, .dstZ = dstZ, .srcWidth = srcWidth, .srcHeight = srcHeight, .srcDepth = srcDepth };
-    NTSTATUS status;
     TRACE( "srcName %d, srcTarget %d, srcLevel %d, srcX %d, srcY %d, srcZ %d, dstName %d, dstTarget %d, dstLevel %d, dstX %d, dstY %d, dstZ %d, srcWidth %d, srcHeight %d, srcDepth %d\n", srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth );
-    if ((status = UNIX_CALL( glCopyImageSubData, &args ))) WARN( "glCopyImageSubData returned %#lx\n", status );
+    UNIX_BATCH( glCopyImageSubData, &args );
 }
 
 static void WINAPI glCopyImageSubDataNV( GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth )
 {
     struct glCopyImageSubDataNV_params args = { .teb = NtCurrentTeb(), .srcName = srcName, .srcTarget = srcTarget, .srcLevel = srcLevel, .srcX = srcX, .srcY = srcY, .srcZ = srcZ, .dstName = dstName, .dstTarget = dstTarget, .dstLevel = dstLevel, .dstX = dstX, .dstY = dstY, .dstZ = dstZ, .width = width, .height = height, .depth = depth };
-    NTSTATUS status;
     TRACE( "srcName %d, srcTarget %d, srcLevel %d, srcX %d, srcY %d, srcZ %d, dstName %d, dstTarget %d, dstLevel %d, dstX %d, dstY %d, dstZ %d, width %d, height %d, depth %d\n", srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth );
-    if ((status = UNIX_CALL( glCopyImageSubDataNV, &args ))) WARN( "glCopyImageSubDataNV returned %#lx\n", status );
+    UNIX_BATCH( glCopyImageSubDataNV, &args );
 }
 
 static void WINAPI glCopyMultiTexImage1DEXT( GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border )
 {
     struct glCopyMultiTexImage1DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .border = border };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, internalformat %d, x %d, y %d, width %d, border %d\n", texunit, target, level, internalformat, x, y, width, border );
-    if ((status = UNIX_CALL( glCopyMultiTexImage1DEXT, &args ))) WARN( "glCopyMultiTexImage1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyMultiTexImage1DEXT, &args );
 }
 
 static void WINAPI glCopyMultiTexImage2DEXT( GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
 {
     struct glCopyMultiTexImage2DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height, .border = border };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, internalformat %d, x %d, y %d, width %d, height %d, border %d\n", texunit, target, level, internalformat, x, y, width, height, border );
-    if ((status = UNIX_CALL( glCopyMultiTexImage2DEXT, &args ))) WARN( "glCopyMultiTexImage2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyMultiTexImage2DEXT, &args );
 }
 
 static void WINAPI glCopyMultiTexSubImage1DEXT( GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
 {
     struct glCopyMultiTexSubImage1DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, xoffset %d, x %d, y %d, width %d\n", texunit, target, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyMultiTexSubImage1DEXT, &args ))) WARN( "glCopyMultiTexSubImage1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyMultiTexSubImage1DEXT, &args );
 }
 
 static void WINAPI glCopyMultiTexSubImage2DEXT( GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyMultiTexSubImage2DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", texunit, target, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyMultiTexSubImage2DEXT, &args ))) WARN( "glCopyMultiTexSubImage2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyMultiTexSubImage2DEXT, &args );
 }
 
 static void WINAPI glCopyMultiTexSubImage3DEXT( GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyMultiTexSubImage3DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyMultiTexSubImage3DEXT, &args ))) WARN( "glCopyMultiTexSubImage3DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyMultiTexSubImage3DEXT, &args );
 }
 
 static void WINAPI glCopyNamedBufferSubData( GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size )
@@ -5105,121 +4775,106 @@ static void WINAPI glCopyNamedBufferSubData( GLuint readBuffer, GLuint writeBuff
 static void WINAPI glCopyPathNV( GLuint resultPath, GLuint srcPath )
 {
     struct glCopyPathNV_params args = { .teb = NtCurrentTeb(), .resultPath = resultPath, .srcPath = srcPath };
-    NTSTATUS status;
     TRACE( "resultPath %d, srcPath %d\n", resultPath, srcPath );
-    if ((status = UNIX_CALL( glCopyPathNV, &args ))) WARN( "glCopyPathNV returned %#lx\n", status );
+    UNIX_BATCH( glCopyPathNV, &args );
 }
 
 static void WINAPI glCopyTexImage1DEXT( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border )
 {
     struct glCopyTexImage1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .border = border };
-    NTSTATUS status;
     TRACE( "target %d, level %d, internalformat %d, x %d, y %d, width %d, border %d\n", target, level, internalformat, x, y, width, border );
-    if ((status = UNIX_CALL( glCopyTexImage1DEXT, &args ))) WARN( "glCopyTexImage1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexImage1DEXT, &args );
 }
 
 static void WINAPI glCopyTexImage2DEXT( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
 {
     struct glCopyTexImage2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height, .border = border };
-    NTSTATUS status;
     TRACE( "target %d, level %d, internalformat %d, x %d, y %d, width %d, height %d, border %d\n", target, level, internalformat, x, y, width, height, border );
-    if ((status = UNIX_CALL( glCopyTexImage2DEXT, &args ))) WARN( "glCopyTexImage2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexImage2DEXT, &args );
 }
 
 static void WINAPI glCopyTexSubImage1DEXT( GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
 {
     struct glCopyTexSubImage1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, x %d, y %d, width %d\n", target, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyTexSubImage1DEXT, &args ))) WARN( "glCopyTexSubImage1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexSubImage1DEXT, &args );
 }
 
 static void WINAPI glCopyTexSubImage2DEXT( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyTexSubImage2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", target, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTexSubImage2DEXT, &args ))) WARN( "glCopyTexSubImage2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexSubImage2DEXT, &args );
 }
 
 static void WINAPI glCopyTexSubImage3D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyTexSubImage3D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", target, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTexSubImage3D, &args ))) WARN( "glCopyTexSubImage3D returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexSubImage3D, &args );
 }
 
 static void WINAPI glCopyTexSubImage3DEXT( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyTexSubImage3DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", target, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTexSubImage3DEXT, &args ))) WARN( "glCopyTexSubImage3DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTexSubImage3DEXT, &args );
 }
 
 static void WINAPI glCopyTextureImage1DEXT( GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border )
 {
     struct glCopyTextureImage1DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .border = border };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, internalformat %d, x %d, y %d, width %d, border %d\n", texture, target, level, internalformat, x, y, width, border );
-    if ((status = UNIX_CALL( glCopyTextureImage1DEXT, &args ))) WARN( "glCopyTextureImage1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTextureImage1DEXT, &args );
 }
 
 static void WINAPI glCopyTextureImage2DEXT( GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
 {
     struct glCopyTextureImage2DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height, .border = border };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, internalformat %d, x %d, y %d, width %d, height %d, border %d\n", texture, target, level, internalformat, x, y, width, height, border );
-    if ((status = UNIX_CALL( glCopyTextureImage2DEXT, &args ))) WARN( "glCopyTextureImage2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTextureImage2DEXT, &args );
 }
 
 static void WINAPI glCopyTextureSubImage1D( GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
 {
     struct glCopyTextureSubImage1D_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, x %d, y %d, width %d\n", texture, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyTextureSubImage1D, &args ))) WARN( "glCopyTextureSubImage1D returned %#lx\n", status );
+    UNIX_BATCH( glCopyTextureSubImage1D, &args );
 }
 
 static void WINAPI glCopyTextureSubImage1DEXT( GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
 {
     struct glCopyTextureSubImage1DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, xoffset %d, x %d, y %d, width %d\n", texture, target, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyTextureSubImage1DEXT, &args ))) WARN( "glCopyTextureSubImage1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTextureSubImage1DEXT, &args );
 }
 
 static void WINAPI glCopyTextureSubImage2D( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyTextureSubImage2D_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", texture, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTextureSubImage2D, &args ))) WARN( "glCopyTextureSubImage2D returned %#lx\n", status );
+    UNIX_BATCH( glCopyTextureSubImage2D, &args );
 }
 
 static void WINAPI glCopyTextureSubImage2DEXT( GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyTextureSubImage2DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", texture, target, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTextureSubImage2DEXT, &args ))) WARN( "glCopyTextureSubImage2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTextureSubImage2DEXT, &args );
 }
 
 static void WINAPI glCopyTextureSubImage3D( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyTextureSubImage3D_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", texture, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTextureSubImage3D, &args ))) WARN( "glCopyTextureSubImage3D returned %#lx\n", status );
+    UNIX_BATCH( glCopyTextureSubImage3D, &args );
 }
 
 static void WINAPI glCopyTextureSubImage3DEXT( GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glCopyTextureSubImage3DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", texture, target, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTextureSubImage3DEXT, &args ))) WARN( "glCopyTextureSubImage3DEXT returned %#lx\n", status );
+    UNIX_BATCH( glCopyTextureSubImage3DEXT, &args );
 }
 
 static void WINAPI glCoverFillPathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues )
@@ -5233,9 +4888,8 @@ static void WINAPI glCoverFillPathInstancedNV( GLsizei numPaths, GLenum pathName
 static void WINAPI glCoverFillPathNV( GLuint path, GLenum coverMode )
 {
     struct glCoverFillPathNV_params args = { .teb = NtCurrentTeb(), .path = path, .coverMode = coverMode };
-    NTSTATUS status;
     TRACE( "path %d, coverMode %d\n", path, coverMode );
-    if ((status = UNIX_CALL( glCoverFillPathNV, &args ))) WARN( "glCoverFillPathNV returned %#lx\n", status );
+    UNIX_BATCH( glCoverFillPathNV, &args );
 }
 
 static void WINAPI glCoverStrokePathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues )
@@ -5249,17 +4903,15 @@ static void WINAPI glCoverStrokePathInstancedNV( GLsizei numPaths, GLenum pathNa
 static void WINAPI glCoverStrokePathNV( GLuint path, GLenum coverMode )
 {
     struct glCoverStrokePathNV_params args = { .teb = NtCurrentTeb(), .path = path, .coverMode = coverMode };
-    NTSTATUS status;
     TRACE( "path %d, coverMode %d\n", path, coverMode );
-    if ((status = UNIX_CALL( glCoverStrokePathNV, &args ))) WARN( "glCoverStrokePathNV returned %#lx\n", status );
+    UNIX_BATCH( glCoverStrokePathNV, &args );
 }
 
 static void WINAPI glCoverageModulationNV( GLenum components )
 {
     struct glCoverageModulationNV_params args = { .teb = NtCurrentTeb(), .components = components };
-    NTSTATUS status;
     TRACE( "components %d\n", components );
-    if ((status = UNIX_CALL( glCoverageModulationNV, &args ))) WARN( "glCoverageModulationNV returned %#lx\n", status );
+    UNIX_BATCH( glCoverageModulationNV, &args );
 }
 
 static void WINAPI glCoverageModulationTableNV( GLsizei n, const GLfloat *v )
@@ -5465,9 +5117,8 @@ static void WINAPI glCullParameterfvEXT( GLenum pname, GLfloat *params )
 static void WINAPI glCurrentPaletteMatrixARB( GLint index )
 {
     struct glCurrentPaletteMatrixARB_params args = { .teb = NtCurrentTeb(), .index = index };
-    NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glCurrentPaletteMatrixARB, &args ))) WARN( "glCurrentPaletteMatrixARB returned %#lx\n", status );
+    UNIX_BATCH( glCurrentPaletteMatrixARB, &args );
 }
 
 static void WINAPI glDebugMessageCallback( GLDEBUGPROC callback, const void *userParam )
@@ -5545,9 +5196,8 @@ static void WINAPI glDebugMessageInsertARB( GLenum source, GLenum type, GLuint i
 static void WINAPI glDeformSGIX( GLbitfield mask )
 {
     struct glDeformSGIX_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glDeformSGIX, &args ))) WARN( "glDeformSGIX returned %#lx\n", status );
+    UNIX_BATCH( glDeformSGIX, &args );
 }
 
 static void WINAPI glDeformationMap3dSGIX( GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble *points )
@@ -5569,17 +5219,15 @@ static void WINAPI glDeformationMap3fSGIX( GLenum target, GLfloat u1, GLfloat u2
 static void WINAPI glDeleteAsyncMarkersSGIX( GLuint marker, GLsizei range )
 {
     struct glDeleteAsyncMarkersSGIX_params args = { .teb = NtCurrentTeb(), .marker = marker, .range = range };
-    NTSTATUS status;
     TRACE( "marker %d, range %d\n", marker, range );
-    if ((status = UNIX_CALL( glDeleteAsyncMarkersSGIX, &args ))) WARN( "glDeleteAsyncMarkersSGIX returned %#lx\n", status );
+    UNIX_BATCH( glDeleteAsyncMarkersSGIX, &args );
 }
 
 static void WINAPI glDeleteBufferRegion( GLenum region )
 {
     struct glDeleteBufferRegion_params args = { .teb = NtCurrentTeb(), .region = region };
-    NTSTATUS status;
     TRACE( "region %d\n", region );
-    if ((status = UNIX_CALL( glDeleteBufferRegion, &args ))) WARN( "glDeleteBufferRegion returned %#lx\n", status );
+    UNIX_BATCH( glDeleteBufferRegion, &args );
 }
 
 static void WINAPI glDeleteBuffers( GLsizei n, const GLuint *buffers )
@@ -5625,9 +5273,8 @@ static void WINAPI glDeleteFencesNV( GLsizei n, const GLuint *fences )
 static void WINAPI glDeleteFragmentShaderATI( GLuint id )
 {
     struct glDeleteFragmentShaderATI_params args = { .teb = NtCurrentTeb(), .id = id };
-    NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glDeleteFragmentShaderATI, &args ))) WARN( "glDeleteFragmentShaderATI returned %#lx\n", status );
+    UNIX_BATCH( glDeleteFragmentShaderATI, &args );
 }
 
 static void WINAPI glDeleteFramebuffers( GLsizei n, const GLuint *framebuffers )
@@ -5673,17 +5320,15 @@ static void WINAPI glDeleteNamesAMD( GLenum identifier, GLuint num, const GLuint
 static void WINAPI glDeleteObjectARB( GLhandleARB obj )
 {
     struct glDeleteObjectARB_params args = { .teb = NtCurrentTeb(), .obj = obj };
-    NTSTATUS status;
     TRACE( "obj %d\n", obj );
-    if ((status = UNIX_CALL( glDeleteObjectARB, &args ))) WARN( "glDeleteObjectARB returned %#lx\n", status );
+    UNIX_BATCH( glDeleteObjectARB, &args );
 }
 
 static void WINAPI glDeleteObjectBufferATI( GLuint buffer )
 {
     struct glDeleteObjectBufferATI_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
-    NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glDeleteObjectBufferATI, &args ))) WARN( "glDeleteObjectBufferATI returned %#lx\n", status );
+    UNIX_BATCH( glDeleteObjectBufferATI, &args );
 }
 
 static void WINAPI glDeleteOcclusionQueriesNV( GLsizei n, const GLuint *ids )
@@ -5697,9 +5342,8 @@ static void WINAPI glDeleteOcclusionQueriesNV( GLsizei n, const GLuint *ids )
 static void WINAPI glDeletePathsNV( GLuint path, GLsizei range )
 {
     struct glDeletePathsNV_params args = { .teb = NtCurrentTeb(), .path = path, .range = range };
-    NTSTATUS status;
     TRACE( "path %d, range %d\n", path, range );
-    if ((status = UNIX_CALL( glDeletePathsNV, &args ))) WARN( "glDeletePathsNV returned %#lx\n", status );
+    UNIX_BATCH( glDeletePathsNV, &args );
 }
 
 static void WINAPI glDeletePerfMonitorsAMD( GLsizei n, GLuint *monitors )
@@ -5713,17 +5357,15 @@ static void WINAPI glDeletePerfMonitorsAMD( GLsizei n, GLuint *monitors )
 static void WINAPI glDeletePerfQueryINTEL( GLuint queryHandle )
 {
     struct glDeletePerfQueryINTEL_params args = { .teb = NtCurrentTeb(), .queryHandle = queryHandle };
-    NTSTATUS status;
     TRACE( "queryHandle %d\n", queryHandle );
-    if ((status = UNIX_CALL( glDeletePerfQueryINTEL, &args ))) WARN( "glDeletePerfQueryINTEL returned %#lx\n", status );
+    UNIX_BATCH( glDeletePerfQueryINTEL, &args );
 }
 
 static void WINAPI glDeleteProgram( GLuint program )
 {
     struct glDeleteProgram_params args = { .teb = NtCurrentTeb(), .program = program };
-    NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glDeleteProgram, &args ))) WARN( "glDeleteProgram returned %#lx\n", status );
+    UNIX_BATCH( glDeleteProgram, &args );
 }
 
 static void WINAPI glDeleteProgramPipelines( GLsizei n, const GLuint *pipelines )
@@ -5809,9 +5451,8 @@ static void WINAPI glDeleteSemaphoresEXT( GLsizei n, const GLuint *semaphores )
 static void WINAPI glDeleteShader( GLuint shader )
 {
     struct glDeleteShader_params args = { .teb = NtCurrentTeb(), .shader = shader };
-    NTSTATUS status;
     TRACE( "shader %d\n", shader );
-    if ((status = UNIX_CALL( glDeleteShader, &args ))) WARN( "glDeleteShader returned %#lx\n", status );
+    UNIX_BATCH( glDeleteShader, &args );
 }
 
 static void WINAPI glDeleteStatesNV( GLsizei n, const GLuint *states )
@@ -5873,25 +5514,22 @@ static void WINAPI glDeleteVertexArraysAPPLE( GLsizei n, const GLuint *arrays )
 static void WINAPI glDeleteVertexShaderEXT( GLuint id )
 {
     struct glDeleteVertexShaderEXT_params args = { .teb = NtCurrentTeb(), .id = id };
-    NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glDeleteVertexShaderEXT, &args ))) WARN( "glDeleteVertexShaderEXT returned %#lx\n", status );
+    UNIX_BATCH( glDeleteVertexShaderEXT, &args );
 }
 
 static void WINAPI glDepthBoundsEXT( GLclampd zmin, GLclampd zmax )
 {
     struct glDepthBoundsEXT_params args = { .teb = NtCurrentTeb(), .zmin = zmin, .zmax = zmax };
-    NTSTATUS status;
     TRACE( "zmin %f, zmax %f\n", zmin, zmax );
-    if ((status = UNIX_CALL( glDepthBoundsEXT, &args ))) WARN( "glDepthBoundsEXT returned %#lx\n", status );
+    UNIX_BATCH( glDepthBoundsEXT, &args );
 }
 
 static void WINAPI glDepthBoundsdNV( GLdouble zmin, GLdouble zmax )
 {
     struct glDepthBoundsdNV_params args = { .teb = NtCurrentTeb(), .zmin = zmin, .zmax = zmax };
-    NTSTATUS status;
     TRACE( "zmin %f, zmax %f\n", zmin, zmax );
-    if ((status = UNIX_CALL( glDepthBoundsdNV, &args ))) WARN( "glDepthBoundsdNV returned %#lx\n", status );
+    UNIX_BATCH( glDepthBoundsdNV, &args );
 }
 
 static void WINAPI glDepthRangeArraydvNV( GLuint first, GLsizei count, const GLdouble *v )
@@ -5913,65 +5551,57 @@ static void WINAPI glDepthRangeArrayv( GLuint first, GLsizei count, const GLdoub
 static void WINAPI glDepthRangeIndexed( GLuint index, GLdouble n, GLdouble f )
 {
     struct glDepthRangeIndexed_params args = { .teb = NtCurrentTeb(), .index = index, .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "index %d, n %f, f %f\n", index, n, f );
-    if ((status = UNIX_CALL( glDepthRangeIndexed, &args ))) WARN( "glDepthRangeIndexed returned %#lx\n", status );
+    UNIX_BATCH( glDepthRangeIndexed, &args );
 }
 
 static void WINAPI glDepthRangeIndexeddNV( GLuint index, GLdouble n, GLdouble f )
 {
     struct glDepthRangeIndexeddNV_params args = { .teb = NtCurrentTeb(), .index = index, .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "index %d, n %f, f %f\n", index, n, f );
-    if ((status = UNIX_CALL( glDepthRangeIndexeddNV, &args ))) WARN( "glDepthRangeIndexeddNV returned %#lx\n", status );
+    UNIX_BATCH( glDepthRangeIndexeddNV, &args );
 }
 
 static void WINAPI glDepthRangedNV( GLdouble zNear, GLdouble zFar )
 {
     struct glDepthRangedNV_params args = { .teb = NtCurrentTeb(), .zNear = zNear, .zFar = zFar };
-    NTSTATUS status;
     TRACE( "zNear %f, zFar %f\n", zNear, zFar );
-    if ((status = UNIX_CALL( glDepthRangedNV, &args ))) WARN( "glDepthRangedNV returned %#lx\n", status );
+    UNIX_BATCH( glDepthRangedNV, &args );
 }
 
 static void WINAPI glDepthRangef( GLfloat n, GLfloat f )
 {
     struct glDepthRangef_params args = { .teb = NtCurrentTeb(), .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "n %f, f %f\n", n, f );
-    if ((status = UNIX_CALL( glDepthRangef, &args ))) WARN( "glDepthRangef returned %#lx\n", status );
+    UNIX_BATCH( glDepthRangef, &args );
 }
 
 static void WINAPI glDepthRangefOES( GLclampf n, GLclampf f )
 {
     struct glDepthRangefOES_params args = { .teb = NtCurrentTeb(), .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "n %f, f %f\n", n, f );
-    if ((status = UNIX_CALL( glDepthRangefOES, &args ))) WARN( "glDepthRangefOES returned %#lx\n", status );
+    UNIX_BATCH( glDepthRangefOES, &args );
 }
 
 static void WINAPI glDepthRangexOES( GLfixed n, GLfixed f )
 {
     struct glDepthRangexOES_params args = { .teb = NtCurrentTeb(), .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "n %d, f %d\n", n, f );
-    if ((status = UNIX_CALL( glDepthRangexOES, &args ))) WARN( "glDepthRangexOES returned %#lx\n", status );
+    UNIX_BATCH( glDepthRangexOES, &args );
 }
 
 static void WINAPI glDetachObjectARB( GLhandleARB containerObj, GLhandleARB attachedObj )
 {
     struct glDetachObjectARB_params args = { .teb = NtCurrentTeb(), .containerObj = containerObj, .attachedObj = attachedObj };
-    NTSTATUS status;
     TRACE( "containerObj %d, attachedObj %d\n", containerObj, attachedObj );
-    if ((status = UNIX_CALL( glDetachObjectARB, &args ))) WARN( "glDetachObjectARB returned %#lx\n", status );
+    UNIX_BATCH( glDetachObjectARB, &args );
 }
 
 static void WINAPI glDetachShader( GLuint program, GLuint shader )
 {
     struct glDetachShader_params args = { .teb = NtCurrentTeb(), .program = program, .shader = shader };
-    NTSTATUS status;
     TRACE( "program %d, shader %d\n", program, shader );
-    if ((status = UNIX_CALL( glDetachShader, &args ))) WARN( "glDetachShader returned %#lx\n", status );
+    UNIX_BATCH( glDetachShader, &args );
 }
 
 static void WINAPI glDetailTexFuncSGIS( GLenum target, GLsizei n, const GLfloat *points )
@@ -5985,105 +5615,92 @@ static void WINAPI glDetailTexFuncSGIS( GLenum target, GLsizei n, const GLfloat
 static void WINAPI glDisableClientStateIndexedEXT( GLenum array, GLuint index )
 {
     struct glDisableClientStateIndexedEXT_params args = { .teb = NtCurrentTeb(), .array = array, .index = index };
-    NTSTATUS status;
     TRACE( "array %d, index %d\n", array, index );
-    if ((status = UNIX_CALL( glDisableClientStateIndexedEXT, &args ))) WARN( "glDisableClientStateIndexedEXT returned %#lx\n", status );
+    UNIX_BATCH( glDisableClientStateIndexedEXT, &args );
 }
 
 static void WINAPI glDisableClientStateiEXT( GLenum array, GLuint index )
 {
     struct glDisableClientStateiEXT_params args = { .teb = NtCurrentTeb(), .array = array, .index = index };
-    NTSTATUS status;
     TRACE( "array %d, index %d\n", array, index );
-    if ((status = UNIX_CALL( glDisableClientStateiEXT, &args ))) WARN( "glDisableClientStateiEXT returned %#lx\n", status );
+    UNIX_BATCH( glDisableClientStateiEXT, &args );
 }
 
 static void WINAPI glDisableIndexedEXT( GLenum target, GLuint index )
 {
     struct glDisableIndexedEXT_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
-    NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glDisableIndexedEXT, &args ))) WARN( "glDisableIndexedEXT returned %#lx\n", status );
+    UNIX_BATCH( glDisableIndexedEXT, &args );
 }
 
 static void WINAPI glDisableVariantClientStateEXT( GLuint id )
 {
     struct glDisableVariantClientStateEXT_params args = { .teb = NtCurrentTeb(), .id = id };
-    NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glDisableVariantClientStateEXT, &args ))) WARN( "glDisableVariantClientStateEXT returned %#lx\n", status );
+    UNIX_BATCH( glDisableVariantClientStateEXT, &args );
 }
 
 static void WINAPI glDisableVertexArrayAttrib( GLuint vaobj, GLuint index )
 {
     struct glDisableVertexArrayAttrib_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index };
-    NTSTATUS status;
     TRACE( "vaobj %d, index %d\n", vaobj, index );
-    if ((status = UNIX_CALL( glDisableVertexArrayAttrib, &args ))) WARN( "glDisableVertexArrayAttrib returned %#lx\n", status );
+    UNIX_BATCH( glDisableVertexArrayAttrib, &args );
 }
 
 static void WINAPI glDisableVertexArrayAttribEXT( GLuint vaobj, GLuint index )
 {
     struct glDisableVertexArrayAttribEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index };
-    NTSTATUS status;
     TRACE( "vaobj %d, index %d\n", vaobj, index );
-    if ((status = UNIX_CALL( glDisableVertexArrayAttribEXT, &args ))) WARN( "glDisableVertexArrayAttribEXT returned %#lx\n", status );
+    UNIX_BATCH( glDisableVertexArrayAttribEXT, &args );
 }
 
 static void WINAPI glDisableVertexArrayEXT( GLuint vaobj, GLenum array )
 {
     struct glDisableVertexArrayEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .array = array };
-    NTSTATUS status;
     TRACE( "vaobj %d, array %d\n", vaobj, array );
-    if ((status = UNIX_CALL( glDisableVertexArrayEXT, &args ))) WARN( "glDisableVertexArrayEXT returned %#lx\n", status );
+    UNIX_BATCH( glDisableVertexArrayEXT, &args );
 }
 
 static void WINAPI glDisableVertexAttribAPPLE( GLuint index, GLenum pname )
 {
     struct glDisableVertexAttribAPPLE_params args = { .teb = NtCurrentTeb(), .index = index, .pname = pname };
-    NTSTATUS status;
     TRACE( "index %d, pname %d\n", index, pname );
-    if ((status = UNIX_CALL( glDisableVertexAttribAPPLE, &args ))) WARN( "glDisableVertexAttribAPPLE returned %#lx\n", status );
+    UNIX_BATCH( glDisableVertexAttribAPPLE, &args );
 }
 
 static void WINAPI glDisableVertexAttribArray( GLuint index )
 {
     struct glDisableVertexAttribArray_params args = { .teb = NtCurrentTeb(), .index = index };
-    NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glDisableVertexAttribArray, &args ))) WARN( "glDisableVertexAttribArray returned %#lx\n", status );
+    UNIX_BATCH( glDisableVertexAttribArray, &args );
 }
 
 static void WINAPI glDisableVertexAttribArrayARB( GLuint index )
 {
     struct glDisableVertexAttribArrayARB_params args = { .teb = NtCurrentTeb(), .index = index };
-    NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glDisableVertexAttribArrayARB, &args ))) WARN( "glDisableVertexAttribArrayARB returned %#lx\n", status );
+    UNIX_BATCH( glDisableVertexAttribArrayARB, &args );
 }
 
 static void WINAPI glDisablei( GLenum target, GLuint index )
 {
     struct glDisablei_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
-    NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glDisablei, &args ))) WARN( "glDisablei returned %#lx\n", status );
+    UNIX_BATCH( glDisablei, &args );
 }
 
 static void WINAPI glDispatchCompute( GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z )
 {
     struct glDispatchCompute_params args = { .teb = NtCurrentTeb(), .num_groups_x = num_groups_x, .num_groups_y = num_groups_y, .num_groups_z = num_groups_z };
-    NTSTATUS status;
     TRACE( "num_groups_x %d, num_groups_y %d, num_groups_z %d\n", num_groups_x, num_groups_y, num_groups_z );
-    if ((status = UNIX_CALL( glDispatchCompute, &args ))) WARN( "glDispatchCompute returned %#lx\n", status );
+    UNIX_BATCH( glDispatchCompute, &args );
 }
 
 static void WINAPI glDispatchComputeGroupSizeARB( GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z )
 {
     struct glDispatchComputeGroupSizeARB_params args = { .teb = NtCurrentTeb(), .num_groups_x = num_groups_x, .num_groups_y = num_groups_y, .num_groups_z = num_groups_z, .group_size_x = group_size_x, .group_size_y = group_size_y, .group_size_z = group_size_z };
-    NTSTATUS status;
     TRACE( "num_groups_x %d, num_groups_y %d, num_groups_z %d, group_size_x %d, group_size_y %d, group_size_z %d\n", num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z );
-    if ((status = UNIX_CALL( glDispatchComputeGroupSizeARB, &args ))) WARN( "glDispatchComputeGroupSizeARB returned %#lx\n", status );
+    UNIX_BATCH( glDispatchComputeGroupSizeARB, &args );
 }
 
 static void WINAPI glDispatchComputeIndirect( GLintptr indirect )
@@ -6145,9 +5762,8 @@ static void WINAPI glDrawArraysInstancedEXT( GLenum mode, GLint start, GLsizei c
 static void WINAPI glDrawBufferRegion( GLenum region, GLint x, GLint y, GLsizei width, GLsizei height, GLint xDest, GLint yDest )
 {
     struct glDrawBufferRegion_params args = { .teb = NtCurrentTeb(), .region = region, .x = x, .y = y, .width = width, .height = height, .xDest = xDest, .yDest = yDest };
-    NTSTATUS status;
     TRACE( "region %d, x %d, y %d, width %d, height %d, xDest %d, yDest %d\n", region, x, y, width, height, xDest, yDest );
-    if ((status = UNIX_CALL( glDrawBufferRegion, &args ))) WARN( "glDrawBufferRegion returned %#lx\n", status );
+    UNIX_BATCH( glDrawBufferRegion, &args );
 }
 
 static void WINAPI glDrawBuffers( GLsizei n, const GLenum *bufs )
@@ -6305,9 +5921,8 @@ static void WINAPI glDrawMeshTasksIndirectNV( GLintptr indirect )
 static void WINAPI glDrawMeshTasksNV( GLuint first, GLuint count )
 {
     struct glDrawMeshTasksNV_params args = { .teb = NtCurrentTeb(), .first = first, .count = count };
-    NTSTATUS status;
     TRACE( "first %d, count %d\n", first, count );
-    if ((status = UNIX_CALL( glDrawMeshTasksNV, &args ))) WARN( "glDrawMeshTasksNV returned %#lx\n", status );
+    UNIX_BATCH( glDrawMeshTasksNV, &args );
 }
 
 static void WINAPI glDrawRangeElementArrayAPPLE( GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count )
@@ -6353,57 +5968,50 @@ static void WINAPI glDrawRangeElementsEXT( GLenum mode, GLuint start, GLuint end
 static void WINAPI glDrawTextureNV( GLuint texture, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1 )
 {
     struct glDrawTextureNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .sampler = sampler, .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1, .z = z, .s0 = s0, .t0 = t0, .s1 = s1, .t1 = t1 };
-    NTSTATUS status;
     TRACE( "texture %d, sampler %d, x0 %f, y0 %f, x1 %f, y1 %f, z %f, s0 %f, t0 %f, s1 %f, t1 %f\n", texture, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1 );
-    if ((status = UNIX_CALL( glDrawTextureNV, &args ))) WARN( "glDrawTextureNV returned %#lx\n", status );
+    UNIX_BATCH( glDrawTextureNV, &args );
 }
 
 static void WINAPI glDrawTransformFeedback( GLenum mode, GLuint id )
 {
     struct glDrawTransformFeedback_params args = { .teb = NtCurrentTeb(), .mode = mode, .id = id };
-    NTSTATUS status;
     TRACE( "mode %d, id %d\n", mode, id );
-    if ((status = UNIX_CALL( glDrawTransformFeedback, &args ))) WARN( "glDrawTransformFeedback returned %#lx\n", status );
+    UNIX_BATCH( glDrawTransformFeedback, &args );
 }
 
 static void WINAPI glDrawTransformFeedbackInstanced( GLenum mode, GLuint id, GLsizei instancecount )
 {
     struct glDrawTransformFeedbackInstanced_params args = { .teb = NtCurrentTeb(), .mode = mode, .id = id, .instancecount = instancecount };
-    NTSTATUS status;
     TRACE( "mode %d, id %d, instancecount %d\n", mode, id, instancecount );
-    if ((status = UNIX_CALL( glDrawTransformFeedbackInstanced, &args ))) WARN( "glDrawTransformFeedbackInstanced returned %#lx\n", status );
+    UNIX_BATCH( glDrawTransformFeedbackInstanced, &args );
 }
 
 static void WINAPI glDrawTransformFeedbackNV( GLenum mode, GLuint id )
 {
     struct glDrawTransformFeedbackNV_params args = { .teb = NtCurrentTeb(), .mode = mode, .id = id };
-    NTSTATUS status;
     TRACE( "mode %d, id %d\n", mode, id );
-    if ((status = UNIX_CALL( glDrawTransformFeedbackNV, &args ))) WARN( "glDrawTransformFeedbackNV returned %#lx\n", status );
+    UNIX_BATCH( glDrawTransformFeedbackNV, &args );
 }
 
 static void WINAPI glDrawTransformFeedbackStream( GLenum mode, GLuint id, GLuint stream )
 {
     struct glDrawTransformFeedbackStream_params args = { .teb = NtCurrentTeb(), .mode = mode, .id = id, .stream = stream };
-    NTSTATUS status;
     TRACE( "mode %d, id %d, stream %d\n", mode, id, stream );
-    if ((status = UNIX_CALL( glDrawTransformFeedbackStream, &args ))) WARN( "glDrawTransformFeedbackStream returned %#lx\n", status );
+    UNIX_BATCH( glDrawTransformFeedbackStream, &args );
 }
 
 static void WINAPI glDrawTransformFeedbackStreamInstanced( GLenum mode, GLuint id, GLuint stream, GLsizei instancecount )
 {
     struct glDrawTransformFeedbackStreamInstanced_params args = { .teb = NtCurrentTeb(), .mode = mode, .id = id, .stream = stream, .instancecount = instancecount };
-    NTSTATUS status;
     TRACE( "mode %d, id %d, stream %d, instancecount %d\n", mode, id, stream, instancecount );
-    if ((status = UNIX_CALL( glDrawTransformFeedbackStreamInstanced, &args ))) WARN( "glDrawTransformFeedbackStreamInstanced returned %#lx\n", status );
+    UNIX_BATCH( glDrawTransformFeedbackStreamInstanced, &args );
 }
 
 static void WINAPI glDrawVkImageNV( GLuint64 vkImage, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1 )
 {
     struct glDrawVkImageNV_params args = { .teb = NtCurrentTeb(), .vkImage = vkImage, .sampler = sampler, .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1, .z = z, .s0 = s0, .t0 = t0, .s1 = s1, .t1 = t1 };
-    NTSTATUS status;
     TRACE( "vkImage %s, sampler %d, x0 %f, y0 %f, x1 %f, y1 %f, z %f, s0 %f, t0 %f, s1 %f, t1 %f\n", wine_dbgstr_longlong(vkImage), sampler, x0, y0, x1, y1, z, s0, t0, s1, t1 );
-    if ((status = UNIX_CALL( glDrawVkImageNV, &args ))) WARN( "glDrawVkImageNV returned %#lx\n", status );
+    UNIX_BATCH( glDrawVkImageNV, &args );
 }
 
 static void WINAPI glEGLImageTargetTexStorageEXT( GLenum target, GLeglImageOES image, const GLint* attrib_list )
@@ -6425,9 +6033,8 @@ static void WINAPI glEGLImageTargetTextureStorageEXT( GLuint texture, GLeglImage
 static void WINAPI glEdgeFlagFormatNV( GLsizei stride )
 {
     struct glEdgeFlagFormatNV_params args = { .teb = NtCurrentTeb(), .stride = stride };
-    NTSTATUS status;
     TRACE( "stride %d\n", stride );
-    if ((status = UNIX_CALL( glEdgeFlagFormatNV, &args ))) WARN( "glEdgeFlagFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glEdgeFlagFormatNV, &args );
 }
 
 static void WINAPI glEdgeFlagPointerEXT( GLsizei stride, GLsizei count, const GLboolean *pointer )
@@ -6465,217 +6072,190 @@ static void WINAPI glElementPointerATI( GLenum type, const void *pointer )
 static void WINAPI glEnableClientStateIndexedEXT( GLenum array, GLuint index )
 {
     struct glEnableClientStateIndexedEXT_params args = { .teb = NtCurrentTeb(), .array = array, .index = index };
-    NTSTATUS status;
     TRACE( "array %d, index %d\n", array, index );
-    if ((status = UNIX_CALL( glEnableClientStateIndexedEXT, &args ))) WARN( "glEnableClientStateIndexedEXT returned %#lx\n", status );
+    UNIX_BATCH( glEnableClientStateIndexedEXT, &args );
 }
 
 static void WINAPI glEnableClientStateiEXT( GLenum array, GLuint index )
 {
     struct glEnableClientStateiEXT_params args = { .teb = NtCurrentTeb(), .array = array, .index = index };
-    NTSTATUS status;
     TRACE( "array %d, index %d\n", array, index );
-    if ((status = UNIX_CALL( glEnableClientStateiEXT, &args ))) WARN( "glEnableClientStateiEXT returned %#lx\n", status );
+    UNIX_BATCH( glEnableClientStateiEXT, &args );
 }
 
 static void WINAPI glEnableIndexedEXT( GLenum target, GLuint index )
 {
     struct glEnableIndexedEXT_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
-    NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glEnableIndexedEXT, &args ))) WARN( "glEnableIndexedEXT returned %#lx\n", status );
+    UNIX_BATCH( glEnableIndexedEXT, &args );
 }
 
 static void WINAPI glEnableVariantClientStateEXT( GLuint id )
 {
     struct glEnableVariantClientStateEXT_params args = { .teb = NtCurrentTeb(), .id = id };
-    NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glEnableVariantClientStateEXT, &args ))) WARN( "glEnableVariantClientStateEXT returned %#lx\n", status );
+    UNIX_BATCH( glEnableVariantClientStateEXT, &args );
 }
 
 static void WINAPI glEnableVertexArrayAttrib( GLuint vaobj, GLuint index )
 {
     struct glEnableVertexArrayAttrib_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index };
-    NTSTATUS status;
     TRACE( "vaobj %d, index %d\n", vaobj, index );
-    if ((status = UNIX_CALL( glEnableVertexArrayAttrib, &args ))) WARN( "glEnableVertexArrayAttrib returned %#lx\n", status );
+    UNIX_BATCH( glEnableVertexArrayAttrib, &args );
 }
 
 static void WINAPI glEnableVertexArrayAttribEXT( GLuint vaobj, GLuint index )
 {
     struct glEnableVertexArrayAttribEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index };
-    NTSTATUS status;
     TRACE( "vaobj %d, index %d\n", vaobj, index );
-    if ((status = UNIX_CALL( glEnableVertexArrayAttribEXT, &args ))) WARN( "glEnableVertexArrayAttribEXT returned %#lx\n", status );
+    UNIX_BATCH( glEnableVertexArrayAttribEXT, &args );
 }
 
 static void WINAPI glEnableVertexArrayEXT( GLuint vaobj, GLenum array )
 {
     struct glEnableVertexArrayEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .array = array };
-    NTSTATUS status;
     TRACE( "vaobj %d, array %d\n", vaobj, array );
-    if ((status = UNIX_CALL( glEnableVertexArrayEXT, &args ))) WARN( "glEnableVertexArrayEXT returned %#lx\n", status );
+    UNIX_BATCH( glEnableVertexArrayEXT, &args );
 }
 
 static void WINAPI glEnableVertexAttribAPPLE( GLuint index, GLenum pname )
 {
     struct glEnableVertexAttribAPPLE_params args = { .teb = NtCurrentTeb(), .index = index, .pname = pname };
-    NTSTATUS status;
     TRACE( "index %d, pname %d\n", index, pname );
-    if ((status = UNIX_CALL( glEnableVertexAttribAPPLE, &args ))) WARN( "glEnableVertexAttribAPPLE returned %#lx\n", status );
+    UNIX_BATCH( glEnableVertexAttribAPPLE, &args );
 }
 
 static void WINAPI glEnableVertexAttribArray( GLuint index )
 {
     struct glEnableVertexAttribArray_params args = { .teb = NtCurrentTeb(), .index = index };
-    NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glEnableVertexAttribArray, &args ))) WARN( "glEnableVertexAttribArray returned %#lx\n", status );
+    UNIX_BATCH( glEnableVertexAttribArray, &args );
 }
 
 static void WINAPI glEnableVertexAttribArrayARB( GLuint index )
 {
     struct glEnableVertexAttribArrayARB_params args = { .teb = NtCurrentTeb(), .index = index };
-    NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glEnableVertexAttribArrayARB, &args ))) WARN( "glEnableVertexAttribArrayARB returned %#lx\n", status );
+    UNIX_BATCH( glEnableVertexAttribArrayARB, &args );
 }
 
 static void WINAPI glEnablei( GLenum target, GLuint index )
 {
     struct glEnablei_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
-    NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glEnablei, &args ))) WARN( "glEnablei returned %#lx\n", status );
+    UNIX_BATCH( glEnablei, &args );
 }
 
 static void WINAPI glEndConditionalRender(void)
 {
     struct glEndConditionalRender_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndConditionalRender, &args ))) WARN( "glEndConditionalRender returned %#lx\n", status );
+    UNIX_BATCH( glEndConditionalRender, &args );
 }
 
 static void WINAPI glEndConditionalRenderNV(void)
 {
     struct glEndConditionalRenderNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndConditionalRenderNV, &args ))) WARN( "glEndConditionalRenderNV returned %#lx\n", status );
+    UNIX_BATCH( glEndConditionalRenderNV, &args );
 }
 
 static void WINAPI glEndConditionalRenderNVX(void)
 {
     struct glEndConditionalRenderNVX_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndConditionalRenderNVX, &args ))) WARN( "glEndConditionalRenderNVX returned %#lx\n", status );
+    UNIX_BATCH( glEndConditionalRenderNVX, &args );
 }
 
 static void WINAPI glEndFragmentShaderATI(void)
 {
     struct glEndFragmentShaderATI_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndFragmentShaderATI, &args ))) WARN( "glEndFragmentShaderATI returned %#lx\n", status );
+    UNIX_BATCH( glEndFragmentShaderATI, &args );
 }
 
 static void WINAPI glEndOcclusionQueryNV(void)
 {
     struct glEndOcclusionQueryNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndOcclusionQueryNV, &args ))) WARN( "glEndOcclusionQueryNV returned %#lx\n", status );
+    UNIX_BATCH( glEndOcclusionQueryNV, &args );
 }
 
 static void WINAPI glEndPerfMonitorAMD( GLuint monitor )
 {
     struct glEndPerfMonitorAMD_params args = { .teb = NtCurrentTeb(), .monitor = monitor };
-    NTSTATUS status;
     TRACE( "monitor %d\n", monitor );
-    if ((status = UNIX_CALL( glEndPerfMonitorAMD, &args ))) WARN( "glEndPerfMonitorAMD returned %#lx\n", status );
+    UNIX_BATCH( glEndPerfMonitorAMD, &args );
 }
 
 static void WINAPI glEndPerfQueryINTEL( GLuint queryHandle )
 {
     struct glEndPerfQueryINTEL_params args = { .teb = NtCurrentTeb(), .queryHandle = queryHandle };
-    NTSTATUS status;
     TRACE( "queryHandle %d\n", queryHandle );
-    if ((status = UNIX_CALL( glEndPerfQueryINTEL, &args ))) WARN( "glEndPerfQueryINTEL returned %#lx\n", status );
+    UNIX_BATCH( glEndPerfQueryINTEL, &args );
 }
 
 static void WINAPI glEndQuery( GLenum target )
 {
     struct glEndQuery_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glEndQuery, &args ))) WARN( "glEndQuery returned %#lx\n", status );
+    UNIX_BATCH( glEndQuery, &args );
 }
 
 static void WINAPI glEndQueryARB( GLenum target )
 {
     struct glEndQueryARB_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glEndQueryARB, &args ))) WARN( "glEndQueryARB returned %#lx\n", status );
+    UNIX_BATCH( glEndQueryARB, &args );
 }
 
 static void WINAPI glEndQueryIndexed( GLenum target, GLuint index )
 {
     struct glEndQueryIndexed_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
-    NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glEndQueryIndexed, &args ))) WARN( "glEndQueryIndexed returned %#lx\n", status );
+    UNIX_BATCH( glEndQueryIndexed, &args );
 }
 
 static void WINAPI glEndTransformFeedback(void)
 {
     struct glEndTransformFeedback_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndTransformFeedback, &args ))) WARN( "glEndTransformFeedback returned %#lx\n", status );
+    UNIX_BATCH( glEndTransformFeedback, &args );
 }
 
 static void WINAPI glEndTransformFeedbackEXT(void)
 {
     struct glEndTransformFeedbackEXT_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndTransformFeedbackEXT, &args ))) WARN( "glEndTransformFeedbackEXT returned %#lx\n", status );
+    UNIX_BATCH( glEndTransformFeedbackEXT, &args );
 }
 
 static void WINAPI glEndTransformFeedbackNV(void)
 {
     struct glEndTransformFeedbackNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndTransformFeedbackNV, &args ))) WARN( "glEndTransformFeedbackNV returned %#lx\n", status );
+    UNIX_BATCH( glEndTransformFeedbackNV, &args );
 }
 
 static void WINAPI glEndVertexShaderEXT(void)
 {
     struct glEndVertexShaderEXT_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndVertexShaderEXT, &args ))) WARN( "glEndVertexShaderEXT returned %#lx\n", status );
+    UNIX_BATCH( glEndVertexShaderEXT, &args );
 }
 
 static void WINAPI glEndVideoCaptureNV( GLuint video_capture_slot )
 {
     struct glEndVideoCaptureNV_params args = { .teb = NtCurrentTeb(), .video_capture_slot = video_capture_slot };
-    NTSTATUS status;
     TRACE( "video_capture_slot %d\n", video_capture_slot );
-    if ((status = UNIX_CALL( glEndVideoCaptureNV, &args ))) WARN( "glEndVideoCaptureNV returned %#lx\n", status );
+    UNIX_BATCH( glEndVideoCaptureNV, &args );
 }
 
 static void WINAPI glEvalCoord1xOES( GLfixed u )
 {
     struct glEvalCoord1xOES_params args = { .teb = NtCurrentTeb(), .u = u };
-    NTSTATUS status;
     TRACE( "u %d\n", u );
-    if ((status = UNIX_CALL( glEvalCoord1xOES, &args ))) WARN( "glEvalCoord1xOES returned %#lx\n", status );
+    UNIX_BATCH( glEvalCoord1xOES, &args );
 }
 
 static void WINAPI glEvalCoord1xvOES( const GLfixed *coords )
@@ -6689,9 +6269,8 @@ static void WINAPI glEvalCoord1xvOES( const GLfixed *coords )
 static void WINAPI glEvalCoord2xOES( GLfixed u, GLfixed v )
 {
     struct glEvalCoord2xOES_params args = { .teb = NtCurrentTeb(), .u = u, .v = v };
-    NTSTATUS status;
     TRACE( "u %d, v %d\n", u, v );
-    if ((status = UNIX_CALL( glEvalCoord2xOES, &args ))) WARN( "glEvalCoord2xOES returned %#lx\n", status );
+    UNIX_BATCH( glEvalCoord2xOES, &args );
 }
 
 static void WINAPI glEvalCoord2xvOES( const GLfixed *coords )
@@ -6705,17 +6284,15 @@ static void WINAPI glEvalCoord2xvOES( const GLfixed *coords )
 static void WINAPI glEvalMapsNV( GLenum target, GLenum mode )
 {
     struct glEvalMapsNV_params args = { .teb = NtCurrentTeb(), .target = target, .mode = mode };
-    NTSTATUS status;
     TRACE( "target %d, mode %d\n", target, mode );
-    if ((status = UNIX_CALL( glEvalMapsNV, &args ))) WARN( "glEvalMapsNV returned %#lx\n", status );
+    UNIX_BATCH( glEvalMapsNV, &args );
 }
 
 static void WINAPI glEvaluateDepthValuesARB(void)
 {
     struct glEvaluateDepthValuesARB_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEvaluateDepthValuesARB, &args ))) WARN( "glEvaluateDepthValuesARB returned %#lx\n", status );
+    UNIX_BATCH( glEvaluateDepthValuesARB, &args );
 }
 
 static void WINAPI glExecuteProgramNV( GLenum target, GLuint id, const GLfloat *params )
@@ -6729,9 +6306,8 @@ static void WINAPI glExecuteProgramNV( GLenum target, GLuint id, const GLfloat *
 static void WINAPI glExtractComponentEXT( GLuint res, GLuint src, GLuint num )
 {
     struct glExtractComponentEXT_params args = { .teb = NtCurrentTeb(), .res = res, .src = src, .num = num };
-    NTSTATUS status;
     TRACE( "res %d, src %d, num %d\n", res, src, num );
-    if ((status = UNIX_CALL( glExtractComponentEXT, &args ))) WARN( "glExtractComponentEXT returned %#lx\n", status );
+    UNIX_BATCH( glExtractComponentEXT, &args );
 }
 
 static void WINAPI glFeedbackBufferxOES( GLsizei n, GLenum type, const GLfixed *buffer )
@@ -6754,9 +6330,8 @@ static GLsync WINAPI glFenceSync( GLenum condition, GLbitfield flags )
 static void WINAPI glFinalCombinerInputNV( GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage )
 {
     struct glFinalCombinerInputNV_params args = { .teb = NtCurrentTeb(), .variable = variable, .input = input, .mapping = mapping, .componentUsage = componentUsage };
-    NTSTATUS status;
     TRACE( "variable %d, input %d, mapping %d, componentUsage %d\n", variable, input, mapping, componentUsage );
-    if ((status = UNIX_CALL( glFinalCombinerInputNV, &args ))) WARN( "glFinalCombinerInputNV returned %#lx\n", status );
+    UNIX_BATCH( glFinalCombinerInputNV, &args );
 }
 
 static GLint WINAPI glFinishAsyncSGIX( GLuint *markerp )
@@ -6771,33 +6346,29 @@ static GLint WINAPI glFinishAsyncSGIX( GLuint *markerp )
 static void WINAPI glFinishFenceAPPLE( GLuint fence )
 {
     struct glFinishFenceAPPLE_params args = { .teb = NtCurrentTeb(), .fence = fence };
-    NTSTATUS status;
     TRACE( "fence %d\n", fence );
-    if ((status = UNIX_CALL( glFinishFenceAPPLE, &args ))) WARN( "glFinishFenceAPPLE returned %#lx\n", status );
+    UNIX_BATCH( glFinishFenceAPPLE, &args );
 }
 
 static void WINAPI glFinishFenceNV( GLuint fence )
 {
     struct glFinishFenceNV_params args = { .teb = NtCurrentTeb(), .fence = fence };
-    NTSTATUS status;
     TRACE( "fence %d\n", fence );
-    if ((status = UNIX_CALL( glFinishFenceNV, &args ))) WARN( "glFinishFenceNV returned %#lx\n", status );
+    UNIX_BATCH( glFinishFenceNV, &args );
 }
 
 static void WINAPI glFinishObjectAPPLE( GLenum object, GLint name )
 {
     struct glFinishObjectAPPLE_params args = { .teb = NtCurrentTeb(), .object = object, .name = name };
-    NTSTATUS status;
     TRACE( "object %d, name %d\n", object, name );
-    if ((status = UNIX_CALL( glFinishObjectAPPLE, &args ))) WARN( "glFinishObjectAPPLE returned %#lx\n", status );
+    UNIX_BATCH( glFinishObjectAPPLE, &args );
 }
 
 static void WINAPI glFinishTextureSUNX(void)
 {
     struct glFinishTextureSUNX_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFinishTextureSUNX, &args ))) WARN( "glFinishTextureSUNX returned %#lx\n", status );
+    UNIX_BATCH( glFinishTextureSUNX, &args );
 }
 
 static void WINAPI glFlushMappedBufferRange( GLenum target, GLintptr offset, GLsizeiptr length )
@@ -6843,9 +6414,8 @@ static void WINAPI glFlushPixelDataRangeNV( GLenum target )
 static void WINAPI glFlushRasterSGIX(void)
 {
     struct glFlushRasterSGIX_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFlushRasterSGIX, &args ))) WARN( "glFlushRasterSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFlushRasterSGIX, &args );
 }
 
 static void WINAPI glFlushStaticDataIBM( GLenum target )
@@ -6875,9 +6445,8 @@ static void WINAPI glFlushVertexArrayRangeNV(void)
 static void WINAPI glFogCoordFormatNV( GLenum type, GLsizei stride )
 {
     struct glFogCoordFormatNV_params args = { .teb = NtCurrentTeb(), .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "type %d, stride %d\n", type, stride );
-    if ((status = UNIX_CALL( glFogCoordFormatNV, &args ))) WARN( "glFogCoordFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glFogCoordFormatNV, &args );
 }
 
 static void WINAPI glFogCoordPointer( GLenum type, GLsizei stride, const void *pointer )
@@ -6907,17 +6476,15 @@ static void WINAPI glFogCoordPointerListIBM( GLenum type, GLint stride, const vo
 static void WINAPI glFogCoordd( GLdouble coord )
 {
     struct glFogCoordd_params args = { .teb = NtCurrentTeb(), .coord = coord };
-    NTSTATUS status;
     TRACE( "coord %f\n", coord );
-    if ((status = UNIX_CALL( glFogCoordd, &args ))) WARN( "glFogCoordd returned %#lx\n", status );
+    UNIX_BATCH( glFogCoordd, &args );
 }
 
 static void WINAPI glFogCoorddEXT( GLdouble coord )
 {
     struct glFogCoorddEXT_params args = { .teb = NtCurrentTeb(), .coord = coord };
-    NTSTATUS status;
     TRACE( "coord %f\n", coord );
-    if ((status = UNIX_CALL( glFogCoorddEXT, &args ))) WARN( "glFogCoorddEXT returned %#lx\n", status );
+    UNIX_BATCH( glFogCoorddEXT, &args );
 }
 
 static void WINAPI glFogCoorddv( const GLdouble *coord )
@@ -6939,17 +6506,15 @@ static void WINAPI glFogCoorddvEXT( const GLdouble *coord )
 static void WINAPI glFogCoordf( GLfloat coord )
 {
     struct glFogCoordf_params args = { .teb = NtCurrentTeb(), .coord = coord };
-    NTSTATUS status;
     TRACE( "coord %f\n", coord );
-    if ((status = UNIX_CALL( glFogCoordf, &args ))) WARN( "glFogCoordf returned %#lx\n", status );
+    UNIX_BATCH( glFogCoordf, &args );
 }
 
 static void WINAPI glFogCoordfEXT( GLfloat coord )
 {
     struct glFogCoordfEXT_params args = { .teb = NtCurrentTeb(), .coord = coord };
-    NTSTATUS status;
     TRACE( "coord %f\n", coord );
-    if ((status = UNIX_CALL( glFogCoordfEXT, &args ))) WARN( "glFogCoordfEXT returned %#lx\n", status );
+    UNIX_BATCH( glFogCoordfEXT, &args );
 }
 
 static void WINAPI glFogCoordfv( const GLfloat *coord )
@@ -6971,9 +6536,8 @@ static void WINAPI glFogCoordfvEXT( const GLfloat *coord )
 static void WINAPI glFogCoordhNV( GLhalfNV fog )
 {
     struct glFogCoordhNV_params args = { .teb = NtCurrentTeb(), .fog = fog };
-    NTSTATUS status;
     TRACE( "fog %d\n", fog );
-    if ((status = UNIX_CALL( glFogCoordhNV, &args ))) WARN( "glFogCoordhNV returned %#lx\n", status );
+    UNIX_BATCH( glFogCoordhNV, &args );
 }
 
 static void WINAPI glFogCoordhvNV( const GLhalfNV *fog )
@@ -6995,9 +6559,8 @@ static void WINAPI glFogFuncSGIS( GLsizei n, const GLfloat *points )
 static void WINAPI glFogxOES( GLenum pname, GLfixed param )
 {
     struct glFogxOES_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glFogxOES, &args ))) WARN( "glFogxOES returned %#lx\n", status );
+    UNIX_BATCH( glFogxOES, &args );
 }
 
 static void WINAPI glFogxvOES( GLenum pname, const GLfixed *param )
@@ -7011,25 +6574,22 @@ static void WINAPI glFogxvOES( GLenum pname, const GLfixed *param )
 static void WINAPI glFragmentColorMaterialSGIX( GLenum face, GLenum mode )
 {
     struct glFragmentColorMaterialSGIX_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
-    NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glFragmentColorMaterialSGIX, &args ))) WARN( "glFragmentColorMaterialSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFragmentColorMaterialSGIX, &args );
 }
 
 static void WINAPI glFragmentCoverageColorNV( GLuint color )
 {
     struct glFragmentCoverageColorNV_params args = { .teb = NtCurrentTeb(), .color = color };
-    NTSTATUS status;
     TRACE( "color %d\n", color );
-    if ((status = UNIX_CALL( glFragmentCoverageColorNV, &args ))) WARN( "glFragmentCoverageColorNV returned %#lx\n", status );
+    UNIX_BATCH( glFragmentCoverageColorNV, &args );
 }
 
 static void WINAPI glFragmentLightModelfSGIX( GLenum pname, GLfloat param )
 {
     struct glFragmentLightModelfSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glFragmentLightModelfSGIX, &args ))) WARN( "glFragmentLightModelfSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFragmentLightModelfSGIX, &args );
 }
 
 static void WINAPI glFragmentLightModelfvSGIX( GLenum pname, const GLfloat *params )
@@ -7043,9 +6603,8 @@ static void WINAPI glFragmentLightModelfvSGIX( GLenum pname, const GLfloat *para
 static void WINAPI glFragmentLightModeliSGIX( GLenum pname, GLint param )
 {
     struct glFragmentLightModeliSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glFragmentLightModeliSGIX, &args ))) WARN( "glFragmentLightModeliSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFragmentLightModeliSGIX, &args );
 }
 
 static void WINAPI glFragmentLightModelivSGIX( GLenum pname, const GLint *params )
@@ -7059,9 +6618,8 @@ static void WINAPI glFragmentLightModelivSGIX( GLenum pname, const GLint *params
 static void WINAPI glFragmentLightfSGIX( GLenum light, GLenum pname, GLfloat param )
 {
     struct glFragmentLightfSGIX_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "light %d, pname %d, param %f\n", light, pname, param );
-    if ((status = UNIX_CALL( glFragmentLightfSGIX, &args ))) WARN( "glFragmentLightfSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFragmentLightfSGIX, &args );
 }
 
 static void WINAPI glFragmentLightfvSGIX( GLenum light, GLenum pname, const GLfloat *params )
@@ -7075,9 +6633,8 @@ static void WINAPI glFragmentLightfvSGIX( GLenum light, GLenum pname, const GLfl
 static void WINAPI glFragmentLightiSGIX( GLenum light, GLenum pname, GLint param )
 {
     struct glFragmentLightiSGIX_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "light %d, pname %d, param %d\n", light, pname, param );
-    if ((status = UNIX_CALL( glFragmentLightiSGIX, &args ))) WARN( "glFragmentLightiSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFragmentLightiSGIX, &args );
 }
 
 static void WINAPI glFragmentLightivSGIX( GLenum light, GLenum pname, const GLint *params )
@@ -7091,9 +6648,8 @@ static void WINAPI glFragmentLightivSGIX( GLenum light, GLenum pname, const GLin
 static void WINAPI glFragmentMaterialfSGIX( GLenum face, GLenum pname, GLfloat param )
 {
     struct glFragmentMaterialfSGIX_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "face %d, pname %d, param %f\n", face, pname, param );
-    if ((status = UNIX_CALL( glFragmentMaterialfSGIX, &args ))) WARN( "glFragmentMaterialfSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFragmentMaterialfSGIX, &args );
 }
 
 static void WINAPI glFragmentMaterialfvSGIX( GLenum face, GLenum pname, const GLfloat *params )
@@ -7107,9 +6663,8 @@ static void WINAPI glFragmentMaterialfvSGIX( GLenum face, GLenum pname, const GL
 static void WINAPI glFragmentMaterialiSGIX( GLenum face, GLenum pname, GLint param )
 {
     struct glFragmentMaterialiSGIX_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "face %d, pname %d, param %d\n", face, pname, param );
-    if ((status = UNIX_CALL( glFragmentMaterialiSGIX, &args ))) WARN( "glFragmentMaterialiSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFragmentMaterialiSGIX, &args );
 }
 
 static void WINAPI glFragmentMaterialivSGIX( GLenum face, GLenum pname, const GLint *params )
@@ -7123,25 +6678,22 @@ static void WINAPI glFragmentMaterialivSGIX( GLenum face, GLenum pname, const GL
 static void WINAPI glFrameTerminatorGREMEDY(void)
 {
     struct glFrameTerminatorGREMEDY_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFrameTerminatorGREMEDY, &args ))) WARN( "glFrameTerminatorGREMEDY returned %#lx\n", status );
+    UNIX_BATCH( glFrameTerminatorGREMEDY, &args );
 }
 
 static void WINAPI glFrameZoomSGIX( GLint factor )
 {
     struct glFrameZoomSGIX_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glFrameZoomSGIX, &args ))) WARN( "glFrameZoomSGIX returned %#lx\n", status );
+    UNIX_BATCH( glFrameZoomSGIX, &args );
 }
 
 static void WINAPI glFramebufferDrawBufferEXT( GLuint framebuffer, GLenum mode )
 {
     struct glFramebufferDrawBufferEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .mode = mode };
-    NTSTATUS status;
     TRACE( "framebuffer %d, mode %d\n", framebuffer, mode );
-    if ((status = UNIX_CALL( glFramebufferDrawBufferEXT, &args ))) WARN( "glFramebufferDrawBufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferDrawBufferEXT, &args );
 }
 
 static void WINAPI glFramebufferDrawBuffersEXT( GLuint framebuffer, GLsizei n, const GLenum *bufs )
@@ -7155,49 +6707,43 @@ static void WINAPI glFramebufferDrawBuffersEXT( GLuint framebuffer, GLsizei n, c
 static void WINAPI glFramebufferFetchBarrierEXT(void)
 {
     struct glFramebufferFetchBarrierEXT_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFramebufferFetchBarrierEXT, &args ))) WARN( "glFramebufferFetchBarrierEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferFetchBarrierEXT, &args );
 }
 
 static void WINAPI glFramebufferParameteri( GLenum target, GLenum pname, GLint param )
 {
     struct glFramebufferParameteri_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glFramebufferParameteri, &args ))) WARN( "glFramebufferParameteri returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferParameteri, &args );
 }
 
 static void WINAPI glFramebufferParameteriMESA( GLenum target, GLenum pname, GLint param )
 {
     struct glFramebufferParameteriMESA_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glFramebufferParameteriMESA, &args ))) WARN( "glFramebufferParameteriMESA returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferParameteriMESA, &args );
 }
 
 static void WINAPI glFramebufferReadBufferEXT( GLuint framebuffer, GLenum mode )
 {
     struct glFramebufferReadBufferEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .mode = mode };
-    NTSTATUS status;
     TRACE( "framebuffer %d, mode %d\n", framebuffer, mode );
-    if ((status = UNIX_CALL( glFramebufferReadBufferEXT, &args ))) WARN( "glFramebufferReadBufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferReadBufferEXT, &args );
 }
 
 static void WINAPI glFramebufferRenderbuffer( GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
 {
     struct glFramebufferRenderbuffer_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .renderbuffertarget = renderbuffertarget, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, renderbuffertarget %d, renderbuffer %d\n", target, attachment, renderbuffertarget, renderbuffer );
-    if ((status = UNIX_CALL( glFramebufferRenderbuffer, &args ))) WARN( "glFramebufferRenderbuffer returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferRenderbuffer, &args );
 }
 
 static void WINAPI glFramebufferRenderbufferEXT( GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
 {
     struct glFramebufferRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .renderbuffertarget = renderbuffertarget, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, renderbuffertarget %d, renderbuffer %d\n", target, attachment, renderbuffertarget, renderbuffer );
-    if ((status = UNIX_CALL( glFramebufferRenderbufferEXT, &args ))) WARN( "glFramebufferRenderbufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferRenderbufferEXT, &args );
 }
 
 static void WINAPI glFramebufferSampleLocationsfvARB( GLenum target, GLuint start, GLsizei count, const GLfloat *v )
@@ -7227,145 +6773,127 @@ static void WINAPI glFramebufferSamplePositionsfvAMD( GLenum target, GLuint nums
 static void WINAPI glFramebufferTexture( GLenum target, GLenum attachment, GLuint texture, GLint level )
 {
     struct glFramebufferTexture_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d\n", target, attachment, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture, &args ))) WARN( "glFramebufferTexture returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTexture, &args );
 }
 
 static void WINAPI glFramebufferTexture1D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
 {
     struct glFramebufferTexture1D_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d\n", target, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture1D, &args ))) WARN( "glFramebufferTexture1D returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTexture1D, &args );
 }
 
 static void WINAPI glFramebufferTexture1DEXT( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
 {
     struct glFramebufferTexture1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d\n", target, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture1DEXT, &args ))) WARN( "glFramebufferTexture1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTexture1DEXT, &args );
 }
 
 static void WINAPI glFramebufferTexture2D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
 {
     struct glFramebufferTexture2D_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d\n", target, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture2D, &args ))) WARN( "glFramebufferTexture2D returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTexture2D, &args );
 }
 
 static void WINAPI glFramebufferTexture2DEXT( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
 {
     struct glFramebufferTexture2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d\n", target, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture2DEXT, &args ))) WARN( "glFramebufferTexture2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTexture2DEXT, &args );
 }
 
 static void WINAPI glFramebufferTexture3D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset )
 {
     struct glFramebufferTexture3D_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level, .zoffset = zoffset };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d, zoffset %d\n", target, attachment, textarget, texture, level, zoffset );
-    if ((status = UNIX_CALL( glFramebufferTexture3D, &args ))) WARN( "glFramebufferTexture3D returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTexture3D, &args );
 }
 
 static void WINAPI glFramebufferTexture3DEXT( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset )
 {
     struct glFramebufferTexture3DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level, .zoffset = zoffset };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d, zoffset %d\n", target, attachment, textarget, texture, level, zoffset );
-    if ((status = UNIX_CALL( glFramebufferTexture3DEXT, &args ))) WARN( "glFramebufferTexture3DEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTexture3DEXT, &args );
 }
 
 static void WINAPI glFramebufferTextureARB( GLenum target, GLenum attachment, GLuint texture, GLint level )
 {
     struct glFramebufferTextureARB_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d\n", target, attachment, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTextureARB, &args ))) WARN( "glFramebufferTextureARB returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTextureARB, &args );
 }
 
 static void WINAPI glFramebufferTextureEXT( GLenum target, GLenum attachment, GLuint texture, GLint level )
 {
     struct glFramebufferTextureEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d\n", target, attachment, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTextureEXT, &args ))) WARN( "glFramebufferTextureEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTextureEXT, &args );
 }
 
 static void WINAPI glFramebufferTextureFaceARB( GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face )
 {
     struct glFramebufferTextureFaceARB_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .face = face };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, face %d\n", target, attachment, texture, level, face );
-    if ((status = UNIX_CALL( glFramebufferTextureFaceARB, &args ))) WARN( "glFramebufferTextureFaceARB returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTextureFaceARB, &args );
 }
 
 static void WINAPI glFramebufferTextureFaceEXT( GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face )
 {
     struct glFramebufferTextureFaceEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .face = face };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, face %d\n", target, attachment, texture, level, face );
-    if ((status = UNIX_CALL( glFramebufferTextureFaceEXT, &args ))) WARN( "glFramebufferTextureFaceEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTextureFaceEXT, &args );
 }
 
 static void WINAPI glFramebufferTextureLayer( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer )
 {
     struct glFramebufferTextureLayer_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, layer %d\n", target, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glFramebufferTextureLayer, &args ))) WARN( "glFramebufferTextureLayer returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTextureLayer, &args );
 }
 
 static void WINAPI glFramebufferTextureLayerARB( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer )
 {
     struct glFramebufferTextureLayerARB_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, layer %d\n", target, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glFramebufferTextureLayerARB, &args ))) WARN( "glFramebufferTextureLayerARB returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTextureLayerARB, &args );
 }
 
 static void WINAPI glFramebufferTextureLayerEXT( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer )
 {
     struct glFramebufferTextureLayerEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, layer %d\n", target, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glFramebufferTextureLayerEXT, &args ))) WARN( "glFramebufferTextureLayerEXT returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTextureLayerEXT, &args );
 }
 
 static void WINAPI glFramebufferTextureMultiviewOVR( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews )
 {
     struct glFramebufferTextureMultiviewOVR_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .baseViewIndex = baseViewIndex, .numViews = numViews };
-    NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, baseViewIndex %d, numViews %d\n", target, attachment, texture, level, baseViewIndex, numViews );
-    if ((status = UNIX_CALL( glFramebufferTextureMultiviewOVR, &args ))) WARN( "glFramebufferTextureMultiviewOVR returned %#lx\n", status );
+    UNIX_BATCH( glFramebufferTextureMultiviewOVR, &args );
 }
 
 static void WINAPI glFreeObjectBufferATI( GLuint buffer )
 {
     struct glFreeObjectBufferATI_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
-    NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glFreeObjectBufferATI, &args ))) WARN( "glFreeObjectBufferATI returned %#lx\n", status );
+    UNIX_BATCH( glFreeObjectBufferATI, &args );
 }
 
 static void WINAPI glFrustumfOES( GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f )
 {
     struct glFrustumfOES_params args = { .teb = NtCurrentTeb(), .l = l, .r = r, .b = b, .t = t, .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "l %f, r %f, b %f, t %f, n %f, f %f\n", l, r, b, t, n, f );
-    if ((status = UNIX_CALL( glFrustumfOES, &args ))) WARN( "glFrustumfOES returned %#lx\n", status );
+    UNIX_BATCH( glFrustumfOES, &args );
 }
 
 static void WINAPI glFrustumxOES( GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f )
 {
     struct glFrustumxOES_params args = { .teb = NtCurrentTeb(), .l = l, .r = r, .b = b, .t = t, .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "l %d, r %d, b %d, t %d, n %d, f %d\n", l, r, b, t, n, f );
-    if ((status = UNIX_CALL( glFrustumxOES, &args ))) WARN( "glFrustumxOES returned %#lx\n", status );
+    UNIX_BATCH( glFrustumxOES, &args );
 }
 
 static GLuint WINAPI glGenAsyncMarkersSGIX( GLsizei range )
@@ -7608,41 +7136,36 @@ static GLuint WINAPI glGenVertexShadersEXT( GLuint range )
 static void WINAPI glGenerateMipmap( GLenum target )
 {
     struct glGenerateMipmap_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glGenerateMipmap, &args ))) WARN( "glGenerateMipmap returned %#lx\n", status );
+    UNIX_BATCH( glGenerateMipmap, &args );
 }
 
 static void WINAPI glGenerateMipmapEXT( GLenum target )
 {
     struct glGenerateMipmapEXT_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glGenerateMipmapEXT, &args ))) WARN( "glGenerateMipmapEXT returned %#lx\n", status );
+    UNIX_BATCH( glGenerateMipmapEXT, &args );
 }
 
 static void WINAPI glGenerateMultiTexMipmapEXT( GLenum texunit, GLenum target )
 {
     struct glGenerateMultiTexMipmapEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d\n", texunit, target );
-    if ((status = UNIX_CALL( glGenerateMultiTexMipmapEXT, &args ))) WARN( "glGenerateMultiTexMipmapEXT returned %#lx\n", status );
+    UNIX_BATCH( glGenerateMultiTexMipmapEXT, &args );
 }
 
 static void WINAPI glGenerateTextureMipmap( GLuint texture )
 {
     struct glGenerateTextureMipmap_params args = { .teb = NtCurrentTeb(), .texture = texture };
-    NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glGenerateTextureMipmap, &args ))) WARN( "glGenerateTextureMipmap returned %#lx\n", status );
+    UNIX_BATCH( glGenerateTextureMipmap, &args );
 }
 
 static void WINAPI glGenerateTextureMipmapEXT( GLuint texture, GLenum target )
 {
     struct glGenerateTextureMipmapEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target };
-    NTSTATUS status;
     TRACE( "texture %d, target %d\n", texture, target );
-    if ((status = UNIX_CALL( glGenerateTextureMipmapEXT, &args ))) WARN( "glGenerateTextureMipmapEXT returned %#lx\n", status );
+    UNIX_BATCH( glGenerateTextureMipmapEXT, &args );
 }
 
 static void WINAPI glGetActiveAtomicCounterBufferiv( GLuint program, GLuint bufferIndex, GLenum pname, GLint *params )
@@ -8695,9 +8218,8 @@ static void WINAPI glGetMapxvOES( GLenum target, GLenum query, GLfixed *v )
 static void WINAPI glGetMaterialxOES( GLenum face, GLenum pname, GLfixed param )
 {
     struct glGetMaterialxOES_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "face %d, pname %d, param %d\n", face, pname, param );
-    if ((status = UNIX_CALL( glGetMaterialxOES, &args ))) WARN( "glGetMaterialxOES returned %#lx\n", status );
+    UNIX_BATCH( glGetMaterialxOES, &args );
 }
 
 static void WINAPI glGetMemoryObjectDetachedResourcesuivNV( GLuint memory, GLenum pname, GLint first, GLsizei count, GLuint *params )
@@ -11081,89 +10603,78 @@ static void WINAPI glGetnUniformuivARB( GLuint program, GLint location, GLsizei
 static void WINAPI glGlobalAlphaFactorbSUN( GLbyte factor )
 {
     struct glGlobalAlphaFactorbSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorbSUN, &args ))) WARN( "glGlobalAlphaFactorbSUN returned %#lx\n", status );
+    UNIX_BATCH( glGlobalAlphaFactorbSUN, &args );
 }
 
 static void WINAPI glGlobalAlphaFactordSUN( GLdouble factor )
 {
     struct glGlobalAlphaFactordSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %f\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactordSUN, &args ))) WARN( "glGlobalAlphaFactordSUN returned %#lx\n", status );
+    UNIX_BATCH( glGlobalAlphaFactordSUN, &args );
 }
 
 static void WINAPI glGlobalAlphaFactorfSUN( GLfloat factor )
 {
     struct glGlobalAlphaFactorfSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %f\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorfSUN, &args ))) WARN( "glGlobalAlphaFactorfSUN returned %#lx\n", status );
+    UNIX_BATCH( glGlobalAlphaFactorfSUN, &args );
 }
 
 static void WINAPI glGlobalAlphaFactoriSUN( GLint factor )
 {
     struct glGlobalAlphaFactoriSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactoriSUN, &args ))) WARN( "glGlobalAlphaFactoriSUN returned %#lx\n", status );
+    UNIX_BATCH( glGlobalAlphaFactoriSUN, &args );
 }
 
 static void WINAPI glGlobalAlphaFactorsSUN( GLshort factor )
 {
     struct glGlobalAlphaFactorsSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorsSUN, &args ))) WARN( "glGlobalAlphaFactorsSUN returned %#lx\n", status );
+    UNIX_BATCH( glGlobalAlphaFactorsSUN, &args );
 }
 
 static void WINAPI glGlobalAlphaFactorubSUN( GLubyte factor )
 {
     struct glGlobalAlphaFactorubSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorubSUN, &args ))) WARN( "glGlobalAlphaFactorubSUN returned %#lx\n", status );
+    UNIX_BATCH( glGlobalAlphaFactorubSUN, &args );
 }
 
 static void WINAPI glGlobalAlphaFactoruiSUN( GLuint factor )
 {
     struct glGlobalAlphaFactoruiSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactoruiSUN, &args ))) WARN( "glGlobalAlphaFactoruiSUN returned %#lx\n", status );
+    UNIX_BATCH( glGlobalAlphaFactoruiSUN, &args );
 }
 
 static void WINAPI glGlobalAlphaFactorusSUN( GLushort factor )
 {
     struct glGlobalAlphaFactorusSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorusSUN, &args ))) WARN( "glGlobalAlphaFactorusSUN returned %#lx\n", status );
+    UNIX_BATCH( glGlobalAlphaFactorusSUN, &args );
 }
 
 static void WINAPI glHintPGI( GLenum target, GLint mode )
 {
     struct glHintPGI_params args = { .teb = NtCurrentTeb(), .target = target, .mode = mode };
-    NTSTATUS status;
     TRACE( "target %d, mode %d\n", target, mode );
-    if ((status = UNIX_CALL( glHintPGI, &args ))) WARN( "glHintPGI returned %#lx\n", status );
+    UNIX_BATCH( glHintPGI, &args );
 }
 
 static void WINAPI glHistogram( GLenum target, GLsizei width, GLenum internalformat, GLboolean sink )
 {
     struct glHistogram_params args = { .teb = NtCurrentTeb(), .target = target, .width = width, .internalformat = internalformat, .sink = sink };
-    NTSTATUS status;
     TRACE( "target %d, width %d, internalformat %d, sink %d\n", target, width, internalformat, sink );
-    if ((status = UNIX_CALL( glHistogram, &args ))) WARN( "glHistogram returned %#lx\n", status );
+    UNIX_BATCH( glHistogram, &args );
 }
 
 static void WINAPI glHistogramEXT( GLenum target, GLsizei width, GLenum internalformat, GLboolean sink )
 {
     struct glHistogramEXT_params args = { .teb = NtCurrentTeb(), .target = target, .width = width, .internalformat = internalformat, .sink = sink };
-    NTSTATUS status;
     TRACE( "target %d, width %d, internalformat %d, sink %d\n", target, width, internalformat, sink );
-    if ((status = UNIX_CALL( glHistogramEXT, &args ))) WARN( "glHistogramEXT returned %#lx\n", status );
+    UNIX_BATCH( glHistogramEXT, &args );
 }
 
 static void WINAPI glIglooInterfaceSGIX( GLenum pname, const void *params )
@@ -11177,9 +10688,8 @@ static void WINAPI glIglooInterfaceSGIX( GLenum pname, const void *params )
 static void WINAPI glImageTransformParameterfHP( GLenum target, GLenum pname, GLfloat param )
 {
     struct glImageTransformParameterfHP_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %f\n", target, pname, param );
-    if ((status = UNIX_CALL( glImageTransformParameterfHP, &args ))) WARN( "glImageTransformParameterfHP returned %#lx\n", status );
+    UNIX_BATCH( glImageTransformParameterfHP, &args );
 }
 
 static void WINAPI glImageTransformParameterfvHP( GLenum target, GLenum pname, const GLfloat *params )
@@ -11193,9 +10703,8 @@ static void WINAPI glImageTransformParameterfvHP( GLenum target, GLenum pname, c
 static void WINAPI glImageTransformParameteriHP( GLenum target, GLenum pname, GLint param )
 {
     struct glImageTransformParameteriHP_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glImageTransformParameteriHP, &args ))) WARN( "glImageTransformParameteriHP returned %#lx\n", status );
+    UNIX_BATCH( glImageTransformParameteriHP, &args );
 }
 
 static void WINAPI glImageTransformParameterivHP( GLenum target, GLenum pname, const GLint *params )
@@ -11209,9 +10718,8 @@ static void WINAPI glImageTransformParameterivHP( GLenum target, GLenum pname, c
 static void WINAPI glImportMemoryFdEXT( GLuint memory, GLuint64 size, GLenum handleType, GLint fd )
 {
     struct glImportMemoryFdEXT_params args = { .teb = NtCurrentTeb(), .memory = memory, .size = size, .handleType = handleType, .fd = fd };
-    NTSTATUS status;
     TRACE( "memory %d, size %s, handleType %d, fd %d\n", memory, wine_dbgstr_longlong(size), handleType, fd );
-    if ((status = UNIX_CALL( glImportMemoryFdEXT, &args ))) WARN( "glImportMemoryFdEXT returned %#lx\n", status );
+    UNIX_BATCH( glImportMemoryFdEXT, &args );
 }
 
 static void WINAPI glImportMemoryWin32HandleEXT( GLuint memory, GLuint64 size, GLenum handleType, void *handle )
@@ -11233,9 +10741,8 @@ static void WINAPI glImportMemoryWin32NameEXT( GLuint memory, GLuint64 size, GLe
 static void WINAPI glImportSemaphoreFdEXT( GLuint semaphore, GLenum handleType, GLint fd )
 {
     struct glImportSemaphoreFdEXT_params args = { .teb = NtCurrentTeb(), .semaphore = semaphore, .handleType = handleType, .fd = fd };
-    NTSTATUS status;
     TRACE( "semaphore %d, handleType %d, fd %d\n", semaphore, handleType, fd );
-    if ((status = UNIX_CALL( glImportSemaphoreFdEXT, &args ))) WARN( "glImportSemaphoreFdEXT returned %#lx\n", status );
+    UNIX_BATCH( glImportSemaphoreFdEXT, &args );
 }
 
 static void WINAPI glImportSemaphoreWin32HandleEXT( GLuint semaphore, GLenum handleType, void *handle )
@@ -11266,25 +10773,22 @@ static GLsync WINAPI glImportSyncEXT( GLenum external_sync_type, GLintptr extern
 static void WINAPI glIndexFormatNV( GLenum type, GLsizei stride )
 {
     struct glIndexFormatNV_params args = { .teb = NtCurrentTeb(), .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "type %d, stride %d\n", type, stride );
-    if ((status = UNIX_CALL( glIndexFormatNV, &args ))) WARN( "glIndexFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glIndexFormatNV, &args );
 }
 
 static void WINAPI glIndexFuncEXT( GLenum func, GLclampf ref )
 {
     struct glIndexFuncEXT_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref };
-    NTSTATUS status;
     TRACE( "func %d, ref %f\n", func, ref );
-    if ((status = UNIX_CALL( glIndexFuncEXT, &args ))) WARN( "glIndexFuncEXT returned %#lx\n", status );
+    UNIX_BATCH( glIndexFuncEXT, &args );
 }
 
 static void WINAPI glIndexMaterialEXT( GLenum face, GLenum mode )
 {
     struct glIndexMaterialEXT_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
-    NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glIndexMaterialEXT, &args ))) WARN( "glIndexMaterialEXT returned %#lx\n", status );
+    UNIX_BATCH( glIndexMaterialEXT, &args );
 }
 
 static void WINAPI glIndexPointerEXT( GLenum type, GLsizei stride, GLsizei count, const void *pointer )
@@ -11306,9 +10810,8 @@ static void WINAPI glIndexPointerListIBM( GLenum type, GLint stride, const void
 static void WINAPI glIndexxOES( GLfixed component )
 {
     struct glIndexxOES_params args = { .teb = NtCurrentTeb(), .component = component };
-    NTSTATUS status;
     TRACE( "component %d\n", component );
-    if ((status = UNIX_CALL( glIndexxOES, &args ))) WARN( "glIndexxOES returned %#lx\n", status );
+    UNIX_BATCH( glIndexxOES, &args );
 }
 
 static void WINAPI glIndexxvOES( const GLfixed *component )
@@ -11322,9 +10825,8 @@ static void WINAPI glIndexxvOES( const GLfixed *component )
 static void WINAPI glInsertComponentEXT( GLuint res, GLuint src, GLuint num )
 {
     struct glInsertComponentEXT_params args = { .teb = NtCurrentTeb(), .res = res, .src = src, .num = num };
-    NTSTATUS status;
     TRACE( "res %d, src %d, num %d\n", res, src, num );
-    if ((status = UNIX_CALL( glInsertComponentEXT, &args ))) WARN( "glInsertComponentEXT returned %#lx\n", status );
+    UNIX_BATCH( glInsertComponentEXT, &args );
 }
 
 static void WINAPI glInsertEventMarkerEXT( GLsizei length, const GLchar *marker )
@@ -11346,17 +10848,15 @@ static void WINAPI glInstrumentsBufferSGIX( GLsizei size, GLint *buffer )
 static void WINAPI glInterpolatePathsNV( GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight )
 {
     struct glInterpolatePathsNV_params args = { .teb = NtCurrentTeb(), .resultPath = resultPath, .pathA = pathA, .pathB = pathB, .weight = weight };
-    NTSTATUS status;
     TRACE( "resultPath %d, pathA %d, pathB %d, weight %f\n", resultPath, pathA, pathB, weight );
-    if ((status = UNIX_CALL( glInterpolatePathsNV, &args ))) WARN( "glInterpolatePathsNV returned %#lx\n", status );
+    UNIX_BATCH( glInterpolatePathsNV, &args );
 }
 
 static void WINAPI glInvalidateBufferData( GLuint buffer )
 {
     struct glInvalidateBufferData_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
-    NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glInvalidateBufferData, &args ))) WARN( "glInvalidateBufferData returned %#lx\n", status );
+    UNIX_BATCH( glInvalidateBufferData, &args );
 }
 
 static void WINAPI glInvalidateBufferSubData( GLuint buffer, GLintptr offset, GLsizeiptr length )
@@ -11402,17 +10902,15 @@ static void WINAPI glInvalidateSubFramebuffer( GLenum target, GLsizei numAttachm
 static void WINAPI glInvalidateTexImage( GLuint texture, GLint level )
 {
     struct glInvalidateTexImage_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "texture %d, level %d\n", texture, level );
-    if ((status = UNIX_CALL( glInvalidateTexImage, &args ))) WARN( "glInvalidateTexImage returned %#lx\n", status );
+    UNIX_BATCH( glInvalidateTexImage, &args );
 }
 
 static void WINAPI glInvalidateTexSubImage( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth )
 {
     struct glInvalidateTexSubImage_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .width = width, .height = height, .depth = depth };
-    NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, yoffset %d, zoffset %d, width %d, height %d, depth %d\n", texture, level, xoffset, yoffset, zoffset, width, height, depth );
-    if ((status = UNIX_CALL( glInvalidateTexSubImage, &args ))) WARN( "glInvalidateTexSubImage returned %#lx\n", status );
+    UNIX_BATCH( glInvalidateTexSubImage, &args );
 }
 
 static GLboolean WINAPI glIsAsyncMarkerSGIX( GLuint marker )
@@ -11814,17 +11312,15 @@ static GLboolean WINAPI glIsVertexAttribEnabledAPPLE( GLuint index, GLenum pname
 static void WINAPI glLGPUCopyImageSubDataNVX( GLuint sourceGpu, GLbitfield destinationGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srxY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth )
 {
     struct glLGPUCopyImageSubDataNVX_params args = { .teb = NtCurrentTeb(), .sourceGpu = sourceGpu, .destinationGpuMask = destinationGpuMask, .srcName = srcName, .srcTarget = srcTarget, .srcLevel = srcLevel, .srcX = srcX, .srxY = srxY, .srcZ = srcZ, .dstName = dstName, .dstTarget = dstTarget, .dstLevel = dstLevel, .dstX = dstX, .dstY = dstY, .dstZ = dstZ, .width = width, .height = height, .depth = depth };
-    NTSTATUS status;
     TRACE( "sourceGpu %d, destinationGpuMask %d, srcName %d, srcTarget %d, srcLevel %d, srcX %d, srxY %d, srcZ %d, dstName %d, dstTarget %d, dstLevel %d, dstX %d, dstY %d, dstZ %d, width %d, height %d, depth %d\n", sourceGpu, destinationGpuMask, srcName, srcTarget, srcLevel, srcX, srxY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth );
-    if ((status = UNIX_CALL( glLGPUCopyImageSubDataNVX, &args ))) WARN( "glLGPUCopyImageSubDataNVX returned %#lx\n", status );
+    UNIX_BATCH( glLGPUCopyImageSubDataNVX, &args );
 }
 
 static void WINAPI glLGPUInterlockNVX(void)
 {
     struct glLGPUInterlockNVX_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glLGPUInterlockNVX, &args ))) WARN( "glLGPUInterlockNVX returned %#lx\n", status );
+    UNIX_BATCH( glLGPUInterlockNVX, &args );
 }
 
 static void WINAPI glLGPUNamedBufferSubDataNVX( GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data )
@@ -11846,17 +11342,15 @@ static void WINAPI glLabelObjectEXT( GLenum type, GLuint object, GLsizei length,
 static void WINAPI glLightEnviSGIX( GLenum pname, GLint param )
 {
     struct glLightEnviSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glLightEnviSGIX, &args ))) WARN( "glLightEnviSGIX returned %#lx\n", status );
+    UNIX_BATCH( glLightEnviSGIX, &args );
 }
 
 static void WINAPI glLightModelxOES( GLenum pname, GLfixed param )
 {
     struct glLightModelxOES_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glLightModelxOES, &args ))) WARN( "glLightModelxOES returned %#lx\n", status );
+    UNIX_BATCH( glLightModelxOES, &args );
 }
 
 static void WINAPI glLightModelxvOES( GLenum pname, const GLfixed *param )
@@ -11870,9 +11364,8 @@ static void WINAPI glLightModelxvOES( GLenum pname, const GLfixed *param )
 static void WINAPI glLightxOES( GLenum light, GLenum pname, GLfixed param )
 {
     struct glLightxOES_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "light %d, pname %d, param %d\n", light, pname, param );
-    if ((status = UNIX_CALL( glLightxOES, &args ))) WARN( "glLightxOES returned %#lx\n", status );
+    UNIX_BATCH( glLightxOES, &args );
 }
 
 static void WINAPI glLightxvOES( GLenum light, GLenum pname, const GLfixed *params )
@@ -11886,25 +11379,22 @@ static void WINAPI glLightxvOES( GLenum light, GLenum pname, const GLfixed *para
 static void WINAPI glLineWidthxOES( GLfixed width )
 {
     struct glLineWidthxOES_params args = { .teb = NtCurrentTeb(), .width = width };
-    NTSTATUS status;
     TRACE( "width %d\n", width );
-    if ((status = UNIX_CALL( glLineWidthxOES, &args ))) WARN( "glLineWidthxOES returned %#lx\n", status );
+    UNIX_BATCH( glLineWidthxOES, &args );
 }
 
 static void WINAPI glLinkProgram( GLuint program )
 {
     struct glLinkProgram_params args = { .teb = NtCurrentTeb(), .program = program };
-    NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glLinkProgram, &args ))) WARN( "glLinkProgram returned %#lx\n", status );
+    UNIX_BATCH( glLinkProgram, &args );
 }
 
 static void WINAPI glLinkProgramARB( GLhandleARB programObj )
 {
     struct glLinkProgramARB_params args = { .teb = NtCurrentTeb(), .programObj = programObj };
-    NTSTATUS status;
     TRACE( "programObj %d\n", programObj );
-    if ((status = UNIX_CALL( glLinkProgramARB, &args ))) WARN( "glLinkProgramARB returned %#lx\n", status );
+    UNIX_BATCH( glLinkProgramARB, &args );
 }
 
 static void WINAPI glListDrawCommandsStatesClientNV( GLuint list, GLuint segment, const void **indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count )
@@ -11918,9 +11408,8 @@ static void WINAPI glListDrawCommandsStatesClientNV( GLuint list, GLuint segment
 static void WINAPI glListParameterfSGIX( GLuint list, GLenum pname, GLfloat param )
 {
     struct glListParameterfSGIX_params args = { .teb = NtCurrentTeb(), .list = list, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "list %d, pname %d, param %f\n", list, pname, param );
-    if ((status = UNIX_CALL( glListParameterfSGIX, &args ))) WARN( "glListParameterfSGIX returned %#lx\n", status );
+    UNIX_BATCH( glListParameterfSGIX, &args );
 }
 
 static void WINAPI glListParameterfvSGIX( GLuint list, GLenum pname, const GLfloat *params )
@@ -11934,9 +11423,8 @@ static void WINAPI glListParameterfvSGIX( GLuint list, GLenum pname, const GLflo
 static void WINAPI glListParameteriSGIX( GLuint list, GLenum pname, GLint param )
 {
     struct glListParameteriSGIX_params args = { .teb = NtCurrentTeb(), .list = list, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "list %d, pname %d, param %d\n", list, pname, param );
-    if ((status = UNIX_CALL( glListParameteriSGIX, &args ))) WARN( "glListParameteriSGIX returned %#lx\n", status );
+    UNIX_BATCH( glListParameteriSGIX, &args );
 }
 
 static void WINAPI glListParameterivSGIX( GLuint list, GLenum pname, const GLint *params )
@@ -11950,9 +11438,8 @@ static void WINAPI glListParameterivSGIX( GLuint list, GLenum pname, const GLint
 static void WINAPI glLoadIdentityDeformationMapSGIX( GLbitfield mask )
 {
     struct glLoadIdentityDeformationMapSGIX_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glLoadIdentityDeformationMapSGIX, &args ))) WARN( "glLoadIdentityDeformationMapSGIX returned %#lx\n", status );
+    UNIX_BATCH( glLoadIdentityDeformationMapSGIX, &args );
 }
 
 static void WINAPI glLoadMatrixxOES( const GLfixed *m )
@@ -12022,9 +11509,8 @@ static void WINAPI glLockArraysEXT( GLint first, GLsizei count )
 static void WINAPI glMTexCoord2fSGIS( GLenum target, GLfloat s, GLfloat t )
 {
     struct glMTexCoord2fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMTexCoord2fSGIS, &args ))) WARN( "glMTexCoord2fSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMTexCoord2fSGIS, &args );
 }
 
 static void WINAPI glMTexCoord2fvSGIS( GLenum target, GLfloat * v )
@@ -12038,113 +11524,99 @@ static void WINAPI glMTexCoord2fvSGIS( GLenum target, GLfloat * v )
 static void WINAPI glMakeBufferNonResidentNV( GLenum target )
 {
     struct glMakeBufferNonResidentNV_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glMakeBufferNonResidentNV, &args ))) WARN( "glMakeBufferNonResidentNV returned %#lx\n", status );
+    UNIX_BATCH( glMakeBufferNonResidentNV, &args );
 }
 
 static void WINAPI glMakeBufferResidentNV( GLenum target, GLenum access )
 {
     struct glMakeBufferResidentNV_params args = { .teb = NtCurrentTeb(), .target = target, .access = access };
-    NTSTATUS status;
     TRACE( "target %d, access %d\n", target, access );
-    if ((status = UNIX_CALL( glMakeBufferResidentNV, &args ))) WARN( "glMakeBufferResidentNV returned %#lx\n", status );
+    UNIX_BATCH( glMakeBufferResidentNV, &args );
 }
 
 static void WINAPI glMakeImageHandleNonResidentARB( GLuint64 handle )
 {
     struct glMakeImageHandleNonResidentARB_params args = { .teb = NtCurrentTeb(), .handle = handle };
-    NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeImageHandleNonResidentARB, &args ))) WARN( "glMakeImageHandleNonResidentARB returned %#lx\n", status );
+    UNIX_BATCH( glMakeImageHandleNonResidentARB, &args );
 }
 
 static void WINAPI glMakeImageHandleNonResidentNV( GLuint64 handle )
 {
     struct glMakeImageHandleNonResidentNV_params args = { .teb = NtCurrentTeb(), .handle = handle };
-    NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeImageHandleNonResidentNV, &args ))) WARN( "glMakeImageHandleNonResidentNV returned %#lx\n", status );
+    UNIX_BATCH( glMakeImageHandleNonResidentNV, &args );
 }
 
 static void WINAPI glMakeImageHandleResidentARB( GLuint64 handle, GLenum access )
 {
     struct glMakeImageHandleResidentARB_params args = { .teb = NtCurrentTeb(), .handle = handle, .access = access };
-    NTSTATUS status;
     TRACE( "handle %s, access %d\n", wine_dbgstr_longlong(handle), access );
-    if ((status = UNIX_CALL( glMakeImageHandleResidentARB, &args ))) WARN( "glMakeImageHandleResidentARB returned %#lx\n", status );
+    UNIX_BATCH( glMakeImageHandleResidentARB, &args );
 }
 
 static void WINAPI glMakeImageHandleResidentNV( GLuint64 handle, GLenum access )
 {
     struct glMakeImageHandleResidentNV_params args = { .teb = NtCurrentTeb(), .handle = handle, .access = access };
-    NTSTATUS status;
     TRACE( "handle %s, access %d\n", wine_dbgstr_longlong(handle), access );
-    if ((status = UNIX_CALL( glMakeImageHandleResidentNV, &args ))) WARN( "glMakeImageHandleResidentNV returned %#lx\n", status );
+    UNIX_BATCH( glMakeImageHandleResidentNV, &args );
 }
 
 static void WINAPI glMakeNamedBufferNonResidentNV( GLuint buffer )
 {
     struct glMakeNamedBufferNonResidentNV_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
-    NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glMakeNamedBufferNonResidentNV, &args ))) WARN( "glMakeNamedBufferNonResidentNV returned %#lx\n", status );
+    UNIX_BATCH( glMakeNamedBufferNonResidentNV, &args );
 }
 
 static void WINAPI glMakeNamedBufferResidentNV( GLuint buffer, GLenum access )
 {
     struct glMakeNamedBufferResidentNV_params args = { .teb = NtCurrentTeb(), .buffer = buffer, .access = access };
-    NTSTATUS status;
     TRACE( "buffer %d, access %d\n", buffer, access );
-    if ((status = UNIX_CALL( glMakeNamedBufferResidentNV, &args ))) WARN( "glMakeNamedBufferResidentNV returned %#lx\n", status );
+    UNIX_BATCH( glMakeNamedBufferResidentNV, &args );
 }
 
 static void WINAPI glMakeTextureHandleNonResidentARB( GLuint64 handle )
 {
     struct glMakeTextureHandleNonResidentARB_params args = { .teb = NtCurrentTeb(), .handle = handle };
-    NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeTextureHandleNonResidentARB, &args ))) WARN( "glMakeTextureHandleNonResidentARB returned %#lx\n", status );
+    UNIX_BATCH( glMakeTextureHandleNonResidentARB, &args );
 }
 
 static void WINAPI glMakeTextureHandleNonResidentNV( GLuint64 handle )
 {
     struct glMakeTextureHandleNonResidentNV_params args = { .teb = NtCurrentTeb(), .handle = handle };
-    NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeTextureHandleNonResidentNV, &args ))) WARN( "glMakeTextureHandleNonResidentNV returned %#lx\n", status );
+    UNIX_BATCH( glMakeTextureHandleNonResidentNV, &args );
 }
 
 static void WINAPI glMakeTextureHandleResidentARB( GLuint64 handle )
 {
     struct glMakeTextureHandleResidentARB_params args = { .teb = NtCurrentTeb(), .handle = handle };
-    NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeTextureHandleResidentARB, &args ))) WARN( "glMakeTextureHandleResidentARB returned %#lx\n", status );
+    UNIX_BATCH( glMakeTextureHandleResidentARB, &args );
 }
 
 static void WINAPI glMakeTextureHandleResidentNV( GLuint64 handle )
 {
     struct glMakeTextureHandleResidentNV_params args = { .teb = NtCurrentTeb(), .handle = handle };
-    NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeTextureHandleResidentNV, &args ))) WARN( "glMakeTextureHandleResidentNV returned %#lx\n", status );
+    UNIX_BATCH( glMakeTextureHandleResidentNV, &args );
 }
 
 static void WINAPI glMap1xOES( GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points )
 {
     struct glMap1xOES_params args = { .teb = NtCurrentTeb(), .target = target, .u1 = u1, .u2 = u2, .stride = stride, .order = order, .points = points };
-    NTSTATUS status;
     TRACE( "target %d, u1 %d, u2 %d, stride %d, order %d, points %d\n", target, u1, u2, stride, order, points );
-    if ((status = UNIX_CALL( glMap1xOES, &args ))) WARN( "glMap1xOES returned %#lx\n", status );
+    UNIX_BATCH( glMap1xOES, &args );
 }
 
 static void WINAPI glMap2xOES( GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points )
 {
     struct glMap2xOES_params args = { .teb = NtCurrentTeb(), .target = target, .u1 = u1, .u2 = u2, .ustride = ustride, .uorder = uorder, .v1 = v1, .v2 = v2, .vstride = vstride, .vorder = vorder, .points = points };
-    NTSTATUS status;
     TRACE( "target %d, u1 %d, u2 %d, ustride %d, uorder %d, v1 %d, v2 %d, vstride %d, vorder %d, points %d\n", target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points );
-    if ((status = UNIX_CALL( glMap2xOES, &args ))) WARN( "glMap2xOES returned %#lx\n", status );
+    UNIX_BATCH( glMap2xOES, &args );
 }
 
 static void WINAPI glMapControlPointsNV( GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void *points )
@@ -12158,17 +11630,15 @@ static void WINAPI glMapControlPointsNV( GLenum target, GLuint index, GLenum typ
 static void WINAPI glMapGrid1xOES( GLint n, GLfixed u1, GLfixed u2 )
 {
     struct glMapGrid1xOES_params args = { .teb = NtCurrentTeb(), .n = n, .u1 = u1, .u2 = u2 };
-    NTSTATUS status;
     TRACE( "n %d, u1 %d, u2 %d\n", n, u1, u2 );
-    if ((status = UNIX_CALL( glMapGrid1xOES, &args ))) WARN( "glMapGrid1xOES returned %#lx\n", status );
+    UNIX_BATCH( glMapGrid1xOES, &args );
 }
 
 static void WINAPI glMapGrid2xOES( GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2 )
 {
     struct glMapGrid2xOES_params args = { .teb = NtCurrentTeb(), .n = n, .u1 = u1, .u2 = u2, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "n %d, u1 %d, u2 %d, v1 %d, v2 %d\n", n, u1, u2, v1, v2 );
-    if ((status = UNIX_CALL( glMapGrid2xOES, &args ))) WARN( "glMapGrid2xOES returned %#lx\n", status );
+    UNIX_BATCH( glMapGrid2xOES, &args );
 }
 
 static void * WINAPI glMapObjectBufferATI( GLuint buffer )
@@ -12240,9 +11710,8 @@ static void WINAPI glMapVertexAttrib2fAPPLE( GLuint index, GLuint size, GLfloat
 static void WINAPI glMaterialxOES( GLenum face, GLenum pname, GLfixed param )
 {
     struct glMaterialxOES_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "face %d, pname %d, param %d\n", face, pname, param );
-    if ((status = UNIX_CALL( glMaterialxOES, &args ))) WARN( "glMaterialxOES returned %#lx\n", status );
+    UNIX_BATCH( glMaterialxOES, &args );
 }
 
 static void WINAPI glMaterialxvOES( GLenum face, GLenum pname, const GLfixed *param )
@@ -12256,9 +11725,8 @@ static void WINAPI glMaterialxvOES( GLenum face, GLenum pname, const GLfixed *pa
 static void WINAPI glMatrixFrustumEXT( GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar )
 {
     struct glMatrixFrustumEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .left = left, .right = right, .bottom = bottom, .top = top, .zNear = zNear, .zFar = zFar };
-    NTSTATUS status;
     TRACE( "mode %d, left %f, right %f, bottom %f, top %f, zNear %f, zFar %f\n", mode, left, right, bottom, top, zNear, zFar );
-    if ((status = UNIX_CALL( glMatrixFrustumEXT, &args ))) WARN( "glMatrixFrustumEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixFrustumEXT, &args );
 }
 
 static void WINAPI glMatrixIndexPointerARB( GLint size, GLenum type, GLsizei stride, const void *pointer )
@@ -12312,9 +11780,8 @@ static void WINAPI glMatrixLoad3x3fNV( GLenum matrixMode, const GLfloat *m )
 static void WINAPI glMatrixLoadIdentityEXT( GLenum mode )
 {
     struct glMatrixLoadIdentityEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glMatrixLoadIdentityEXT, &args ))) WARN( "glMatrixLoadIdentityEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixLoadIdentityEXT, &args );
 }
 
 static void WINAPI glMatrixLoadTranspose3x3fNV( GLenum matrixMode, const GLfloat *m )
@@ -12416,113 +11883,99 @@ static void WINAPI glMatrixMultfEXT( GLenum mode, const GLfloat *m )
 static void WINAPI glMatrixOrthoEXT( GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar )
 {
     struct glMatrixOrthoEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .left = left, .right = right, .bottom = bottom, .top = top, .zNear = zNear, .zFar = zFar };
-    NTSTATUS status;
     TRACE( "mode %d, left %f, right %f, bottom %f, top %f, zNear %f, zFar %f\n", mode, left, right, bottom, top, zNear, zFar );
-    if ((status = UNIX_CALL( glMatrixOrthoEXT, &args ))) WARN( "glMatrixOrthoEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixOrthoEXT, &args );
 }
 
 static void WINAPI glMatrixPopEXT( GLenum mode )
 {
     struct glMatrixPopEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glMatrixPopEXT, &args ))) WARN( "glMatrixPopEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixPopEXT, &args );
 }
 
 static void WINAPI glMatrixPushEXT( GLenum mode )
 {
     struct glMatrixPushEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glMatrixPushEXT, &args ))) WARN( "glMatrixPushEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixPushEXT, &args );
 }
 
 static void WINAPI glMatrixRotatedEXT( GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glMatrixRotatedEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .angle = angle, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "mode %d, angle %f, x %f, y %f, z %f\n", mode, angle, x, y, z );
-    if ((status = UNIX_CALL( glMatrixRotatedEXT, &args ))) WARN( "glMatrixRotatedEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixRotatedEXT, &args );
 }
 
 static void WINAPI glMatrixRotatefEXT( GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glMatrixRotatefEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .angle = angle, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "mode %d, angle %f, x %f, y %f, z %f\n", mode, angle, x, y, z );
-    if ((status = UNIX_CALL( glMatrixRotatefEXT, &args ))) WARN( "glMatrixRotatefEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixRotatefEXT, &args );
 }
 
 static void WINAPI glMatrixScaledEXT( GLenum mode, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glMatrixScaledEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "mode %d, x %f, y %f, z %f\n", mode, x, y, z );
-    if ((status = UNIX_CALL( glMatrixScaledEXT, &args ))) WARN( "glMatrixScaledEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixScaledEXT, &args );
 }
 
 static void WINAPI glMatrixScalefEXT( GLenum mode, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glMatrixScalefEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "mode %d, x %f, y %f, z %f\n", mode, x, y, z );
-    if ((status = UNIX_CALL( glMatrixScalefEXT, &args ))) WARN( "glMatrixScalefEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixScalefEXT, &args );
 }
 
 static void WINAPI glMatrixTranslatedEXT( GLenum mode, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glMatrixTranslatedEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "mode %d, x %f, y %f, z %f\n", mode, x, y, z );
-    if ((status = UNIX_CALL( glMatrixTranslatedEXT, &args ))) WARN( "glMatrixTranslatedEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixTranslatedEXT, &args );
 }
 
 static void WINAPI glMatrixTranslatefEXT( GLenum mode, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glMatrixTranslatefEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "mode %d, x %f, y %f, z %f\n", mode, x, y, z );
-    if ((status = UNIX_CALL( glMatrixTranslatefEXT, &args ))) WARN( "glMatrixTranslatefEXT returned %#lx\n", status );
+    UNIX_BATCH( glMatrixTranslatefEXT, &args );
 }
 
 static void WINAPI glMaxShaderCompilerThreadsARB( GLuint count )
 {
     struct glMaxShaderCompilerThreadsARB_params args = { .teb = NtCurrentTeb(), .count = count };
-    NTSTATUS status;
     TRACE( "count %d\n", count );
-    if ((status = UNIX_CALL( glMaxShaderCompilerThreadsARB, &args ))) WARN( "glMaxShaderCompilerThreadsARB returned %#lx\n", status );
+    UNIX_BATCH( glMaxShaderCompilerThreadsARB, &args );
 }
 
 static void WINAPI glMaxShaderCompilerThreadsKHR( GLuint count )
 {
     struct glMaxShaderCompilerThreadsKHR_params args = { .teb = NtCurrentTeb(), .count = count };
-    NTSTATUS status;
     TRACE( "count %d\n", count );
-    if ((status = UNIX_CALL( glMaxShaderCompilerThreadsKHR, &args ))) WARN( "glMaxShaderCompilerThreadsKHR returned %#lx\n", status );
+    UNIX_BATCH( glMaxShaderCompilerThreadsKHR, &args );
 }
 
 static void WINAPI glMemoryBarrier( GLbitfield barriers )
 {
     struct glMemoryBarrier_params args = { .teb = NtCurrentTeb(), .barriers = barriers };
-    NTSTATUS status;
     TRACE( "barriers %d\n", barriers );
-    if ((status = UNIX_CALL( glMemoryBarrier, &args ))) WARN( "glMemoryBarrier returned %#lx\n", status );
+    UNIX_BATCH( glMemoryBarrier, &args );
 }
 
 static void WINAPI glMemoryBarrierByRegion( GLbitfield barriers )
 {
     struct glMemoryBarrierByRegion_params args = { .teb = NtCurrentTeb(), .barriers = barriers };
-    NTSTATUS status;
     TRACE( "barriers %d\n", barriers );
-    if ((status = UNIX_CALL( glMemoryBarrierByRegion, &args ))) WARN( "glMemoryBarrierByRegion returned %#lx\n", status );
+    UNIX_BATCH( glMemoryBarrierByRegion, &args );
 }
 
 static void WINAPI glMemoryBarrierEXT( GLbitfield barriers )
 {
     struct glMemoryBarrierEXT_params args = { .teb = NtCurrentTeb(), .barriers = barriers };
-    NTSTATUS status;
     TRACE( "barriers %d\n", barriers );
-    if ((status = UNIX_CALL( glMemoryBarrierEXT, &args ))) WARN( "glMemoryBarrierEXT returned %#lx\n", status );
+    UNIX_BATCH( glMemoryBarrierEXT, &args );
 }
 
 static void WINAPI glMemoryObjectParameterivEXT( GLuint memoryObject, GLenum pname, const GLint *params )
@@ -12536,33 +11989,29 @@ static void WINAPI glMemoryObjectParameterivEXT( GLuint memoryObject, GLenum pna
 static void WINAPI glMinSampleShading( GLfloat value )
 {
     struct glMinSampleShading_params args = { .teb = NtCurrentTeb(), .value = value };
-    NTSTATUS status;
     TRACE( "value %f\n", value );
-    if ((status = UNIX_CALL( glMinSampleShading, &args ))) WARN( "glMinSampleShading returned %#lx\n", status );
+    UNIX_BATCH( glMinSampleShading, &args );
 }
 
 static void WINAPI glMinSampleShadingARB( GLfloat value )
 {
     struct glMinSampleShadingARB_params args = { .teb = NtCurrentTeb(), .value = value };
-    NTSTATUS status;
     TRACE( "value %f\n", value );
-    if ((status = UNIX_CALL( glMinSampleShadingARB, &args ))) WARN( "glMinSampleShadingARB returned %#lx\n", status );
+    UNIX_BATCH( glMinSampleShadingARB, &args );
 }
 
 static void WINAPI glMinmax( GLenum target, GLenum internalformat, GLboolean sink )
 {
     struct glMinmax_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .sink = sink };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, sink %d\n", target, internalformat, sink );
-    if ((status = UNIX_CALL( glMinmax, &args ))) WARN( "glMinmax returned %#lx\n", status );
+    UNIX_BATCH( glMinmax, &args );
 }
 
 static void WINAPI glMinmaxEXT( GLenum target, GLenum internalformat, GLboolean sink )
 {
     struct glMinmaxEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .sink = sink };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, sink %d\n", target, internalformat, sink );
-    if ((status = UNIX_CALL( glMinmaxEXT, &args ))) WARN( "glMinmaxEXT returned %#lx\n", status );
+    UNIX_BATCH( glMinmaxEXT, &args );
 }
 
 static void WINAPI glMultMatrixxOES( const GLfixed *m )
@@ -12800,17 +12249,15 @@ static void WINAPI glMultiModeDrawElementsIBM( const GLenum *mode, const GLsizei
 static void WINAPI glMultiTexBufferEXT( GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer )
 {
     struct glMultiTexBufferEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .internalformat = internalformat, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, internalformat %d, buffer %d\n", texunit, target, internalformat, buffer );
-    if ((status = UNIX_CALL( glMultiTexBufferEXT, &args ))) WARN( "glMultiTexBufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexBufferEXT, &args );
 }
 
 static void WINAPI glMultiTexCoord1bOES( GLenum texture, GLbyte s )
 {
     struct glMultiTexCoord1bOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s };
-    NTSTATUS status;
     TRACE( "texture %d, s %d\n", texture, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1bOES, &args ))) WARN( "glMultiTexCoord1bOES returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1bOES, &args );
 }
 
 static void WINAPI glMultiTexCoord1bvOES( GLenum texture, const GLbyte *coords )
@@ -12824,25 +12271,22 @@ static void WINAPI glMultiTexCoord1bvOES( GLenum texture, const GLbyte *coords )
 static void WINAPI glMultiTexCoord1d( GLenum target, GLdouble s )
 {
     struct glMultiTexCoord1d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1d, &args ))) WARN( "glMultiTexCoord1d returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1d, &args );
 }
 
 static void WINAPI glMultiTexCoord1dARB( GLenum target, GLdouble s )
 {
     struct glMultiTexCoord1dARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1dARB, &args ))) WARN( "glMultiTexCoord1dARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1dARB, &args );
 }
 
 static void WINAPI glMultiTexCoord1dSGIS( GLenum target, GLdouble s )
 {
     struct glMultiTexCoord1dSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1dSGIS, &args ))) WARN( "glMultiTexCoord1dSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1dSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord1dv( GLenum target, const GLdouble *v )
@@ -12872,25 +12316,22 @@ static void WINAPI glMultiTexCoord1dvSGIS( GLenum target, GLdouble * v )
 static void WINAPI glMultiTexCoord1f( GLenum target, GLfloat s )
 {
     struct glMultiTexCoord1f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1f, &args ))) WARN( "glMultiTexCoord1f returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1f, &args );
 }
 
 static void WINAPI glMultiTexCoord1fARB( GLenum target, GLfloat s )
 {
     struct glMultiTexCoord1fARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1fARB, &args ))) WARN( "glMultiTexCoord1fARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1fARB, &args );
 }
 
 static void WINAPI glMultiTexCoord1fSGIS( GLenum target, GLfloat s )
 {
     struct glMultiTexCoord1fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1fSGIS, &args ))) WARN( "glMultiTexCoord1fSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1fSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord1fv( GLenum target, const GLfloat *v )
@@ -12920,9 +12361,8 @@ static void WINAPI glMultiTexCoord1fvSGIS( GLenum target, const GLfloat * v )
 static void WINAPI glMultiTexCoord1hNV( GLenum target, GLhalfNV s )
 {
     struct glMultiTexCoord1hNV_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1hNV, &args ))) WARN( "glMultiTexCoord1hNV returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1hNV, &args );
 }
 
 static void WINAPI glMultiTexCoord1hvNV( GLenum target, const GLhalfNV *v )
@@ -12936,25 +12376,22 @@ static void WINAPI glMultiTexCoord1hvNV( GLenum target, const GLhalfNV *v )
 static void WINAPI glMultiTexCoord1i( GLenum target, GLint s )
 {
     struct glMultiTexCoord1i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1i, &args ))) WARN( "glMultiTexCoord1i returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1i, &args );
 }
 
 static void WINAPI glMultiTexCoord1iARB( GLenum target, GLint s )
 {
     struct glMultiTexCoord1iARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1iARB, &args ))) WARN( "glMultiTexCoord1iARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1iARB, &args );
 }
 
 static void WINAPI glMultiTexCoord1iSGIS( GLenum target, GLint s )
 {
     struct glMultiTexCoord1iSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1iSGIS, &args ))) WARN( "glMultiTexCoord1iSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1iSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord1iv( GLenum target, const GLint *v )
@@ -12984,25 +12421,22 @@ static void WINAPI glMultiTexCoord1ivSGIS( GLenum target, GLint * v )
 static void WINAPI glMultiTexCoord1s( GLenum target, GLshort s )
 {
     struct glMultiTexCoord1s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1s, &args ))) WARN( "glMultiTexCoord1s returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1s, &args );
 }
 
 static void WINAPI glMultiTexCoord1sARB( GLenum target, GLshort s )
 {
     struct glMultiTexCoord1sARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1sARB, &args ))) WARN( "glMultiTexCoord1sARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1sARB, &args );
 }
 
 static void WINAPI glMultiTexCoord1sSGIS( GLenum target, GLshort s )
 {
     struct glMultiTexCoord1sSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
-    NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1sSGIS, &args ))) WARN( "glMultiTexCoord1sSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1sSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord1sv( GLenum target, const GLshort *v )
@@ -13032,9 +12466,8 @@ static void WINAPI glMultiTexCoord1svSGIS( GLenum target, GLshort * v )
 static void WINAPI glMultiTexCoord1xOES( GLenum texture, GLfixed s )
 {
     struct glMultiTexCoord1xOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s };
-    NTSTATUS status;
     TRACE( "texture %d, s %d\n", texture, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1xOES, &args ))) WARN( "glMultiTexCoord1xOES returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord1xOES, &args );
 }
 
 static void WINAPI glMultiTexCoord1xvOES( GLenum texture, const GLfixed *coords )
@@ -13048,9 +12481,8 @@ static void WINAPI glMultiTexCoord1xvOES( GLenum texture, const GLfixed *coords
 static void WINAPI glMultiTexCoord2bOES( GLenum texture, GLbyte s, GLbyte t )
 {
     struct glMultiTexCoord2bOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "texture %d, s %d, t %d\n", texture, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2bOES, &args ))) WARN( "glMultiTexCoord2bOES returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2bOES, &args );
 }
 
 static void WINAPI glMultiTexCoord2bvOES( GLenum texture, const GLbyte *coords )
@@ -13064,25 +12496,22 @@ static void WINAPI glMultiTexCoord2bvOES( GLenum texture, const GLbyte *coords )
 static void WINAPI glMultiTexCoord2d( GLenum target, GLdouble s, GLdouble t )
 {
     struct glMultiTexCoord2d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2d, &args ))) WARN( "glMultiTexCoord2d returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2d, &args );
 }
 
 static void WINAPI glMultiTexCoord2dARB( GLenum target, GLdouble s, GLdouble t )
 {
     struct glMultiTexCoord2dARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2dARB, &args ))) WARN( "glMultiTexCoord2dARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2dARB, &args );
 }
 
 static void WINAPI glMultiTexCoord2dSGIS( GLenum target, GLdouble s, GLdouble t )
 {
     struct glMultiTexCoord2dSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2dSGIS, &args ))) WARN( "glMultiTexCoord2dSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2dSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord2dv( GLenum target, const GLdouble *v )
@@ -13112,25 +12541,22 @@ static void WINAPI glMultiTexCoord2dvSGIS( GLenum target, GLdouble * v )
 static void WINAPI glMultiTexCoord2f( GLenum target, GLfloat s, GLfloat t )
 {
     struct glMultiTexCoord2f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2f, &args ))) WARN( "glMultiTexCoord2f returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2f, &args );
 }
 
 static void WINAPI glMultiTexCoord2fARB( GLenum target, GLfloat s, GLfloat t )
 {
     struct glMultiTexCoord2fARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2fARB, &args ))) WARN( "glMultiTexCoord2fARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2fARB, &args );
 }
 
 static void WINAPI glMultiTexCoord2fSGIS( GLenum target, GLfloat s, GLfloat t )
 {
     struct glMultiTexCoord2fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2fSGIS, &args ))) WARN( "glMultiTexCoord2fSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2fSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord2fv( GLenum target, const GLfloat *v )
@@ -13160,9 +12586,8 @@ static void WINAPI glMultiTexCoord2fvSGIS( GLenum target, GLfloat * v )
 static void WINAPI glMultiTexCoord2hNV( GLenum target, GLhalfNV s, GLhalfNV t )
 {
     struct glMultiTexCoord2hNV_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2hNV, &args ))) WARN( "glMultiTexCoord2hNV returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2hNV, &args );
 }
 
 static void WINAPI glMultiTexCoord2hvNV( GLenum target, const GLhalfNV *v )
@@ -13176,25 +12601,22 @@ static void WINAPI glMultiTexCoord2hvNV( GLenum target, const GLhalfNV *v )
 static void WINAPI glMultiTexCoord2i( GLenum target, GLint s, GLint t )
 {
     struct glMultiTexCoord2i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2i, &args ))) WARN( "glMultiTexCoord2i returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2i, &args );
 }
 
 static void WINAPI glMultiTexCoord2iARB( GLenum target, GLint s, GLint t )
 {
     struct glMultiTexCoord2iARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2iARB, &args ))) WARN( "glMultiTexCoord2iARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2iARB, &args );
 }
 
 static void WINAPI glMultiTexCoord2iSGIS( GLenum target, GLint s, GLint t )
 {
     struct glMultiTexCoord2iSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2iSGIS, &args ))) WARN( "glMultiTexCoord2iSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2iSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord2iv( GLenum target, const GLint *v )
@@ -13224,25 +12646,22 @@ static void WINAPI glMultiTexCoord2ivSGIS( GLenum target, GLint * v )
 static void WINAPI glMultiTexCoord2s( GLenum target, GLshort s, GLshort t )
 {
     struct glMultiTexCoord2s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2s, &args ))) WARN( "glMultiTexCoord2s returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2s, &args );
 }
 
 static void WINAPI glMultiTexCoord2sARB( GLenum target, GLshort s, GLshort t )
 {
     struct glMultiTexCoord2sARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2sARB, &args ))) WARN( "glMultiTexCoord2sARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2sARB, &args );
 }
 
 static void WINAPI glMultiTexCoord2sSGIS( GLenum target, GLshort s, GLshort t )
 {
     struct glMultiTexCoord2sSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2sSGIS, &args ))) WARN( "glMultiTexCoord2sSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2sSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord2sv( GLenum target, const GLshort *v )
@@ -13272,9 +12691,8 @@ static void WINAPI glMultiTexCoord2svSGIS( GLenum target, GLshort * v )
 static void WINAPI glMultiTexCoord2xOES( GLenum texture, GLfixed s, GLfixed t )
 {
     struct glMultiTexCoord2xOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "texture %d, s %d, t %d\n", texture, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2xOES, &args ))) WARN( "glMultiTexCoord2xOES returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord2xOES, &args );
 }
 
 static void WINAPI glMultiTexCoord2xvOES( GLenum texture, const GLfixed *coords )
@@ -13288,9 +12706,8 @@ static void WINAPI glMultiTexCoord2xvOES( GLenum texture, const GLfixed *coords
 static void WINAPI glMultiTexCoord3bOES( GLenum texture, GLbyte s, GLbyte t, GLbyte r )
 {
     struct glMultiTexCoord3bOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "texture %d, s %d, t %d, r %d\n", texture, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3bOES, &args ))) WARN( "glMultiTexCoord3bOES returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3bOES, &args );
 }
 
 static void WINAPI glMultiTexCoord3bvOES( GLenum texture, const GLbyte *coords )
@@ -13304,25 +12721,22 @@ static void WINAPI glMultiTexCoord3bvOES( GLenum texture, const GLbyte *coords )
 static void WINAPI glMultiTexCoord3d( GLenum target, GLdouble s, GLdouble t, GLdouble r )
 {
     struct glMultiTexCoord3d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3d, &args ))) WARN( "glMultiTexCoord3d returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3d, &args );
 }
 
 static void WINAPI glMultiTexCoord3dARB( GLenum target, GLdouble s, GLdouble t, GLdouble r )
 {
     struct glMultiTexCoord3dARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3dARB, &args ))) WARN( "glMultiTexCoord3dARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3dARB, &args );
 }
 
 static void WINAPI glMultiTexCoord3dSGIS( GLenum target, GLdouble s, GLdouble t, GLdouble r )
 {
     struct glMultiTexCoord3dSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3dSGIS, &args ))) WARN( "glMultiTexCoord3dSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3dSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord3dv( GLenum target, const GLdouble *v )
@@ -13352,25 +12766,22 @@ static void WINAPI glMultiTexCoord3dvSGIS( GLenum target, GLdouble * v )
 static void WINAPI glMultiTexCoord3f( GLenum target, GLfloat s, GLfloat t, GLfloat r )
 {
     struct glMultiTexCoord3f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3f, &args ))) WARN( "glMultiTexCoord3f returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3f, &args );
 }
 
 static void WINAPI glMultiTexCoord3fARB( GLenum target, GLfloat s, GLfloat t, GLfloat r )
 {
     struct glMultiTexCoord3fARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3fARB, &args ))) WARN( "glMultiTexCoord3fARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3fARB, &args );
 }
 
 static void WINAPI glMultiTexCoord3fSGIS( GLenum target, GLfloat s, GLfloat t, GLfloat r )
 {
     struct glMultiTexCoord3fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3fSGIS, &args ))) WARN( "glMultiTexCoord3fSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3fSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord3fv( GLenum target, const GLfloat *v )
@@ -13400,9 +12811,8 @@ static void WINAPI glMultiTexCoord3fvSGIS( GLenum target, GLfloat * v )
 static void WINAPI glMultiTexCoord3hNV( GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r )
 {
     struct glMultiTexCoord3hNV_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3hNV, &args ))) WARN( "glMultiTexCoord3hNV returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3hNV, &args );
 }
 
 static void WINAPI glMultiTexCoord3hvNV( GLenum target, const GLhalfNV *v )
@@ -13416,25 +12826,22 @@ static void WINAPI glMultiTexCoord3hvNV( GLenum target, const GLhalfNV *v )
 static void WINAPI glMultiTexCoord3i( GLenum target, GLint s, GLint t, GLint r )
 {
     struct glMultiTexCoord3i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3i, &args ))) WARN( "glMultiTexCoord3i returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3i, &args );
 }
 
 static void WINAPI glMultiTexCoord3iARB( GLenum target, GLint s, GLint t, GLint r )
 {
     struct glMultiTexCoord3iARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3iARB, &args ))) WARN( "glMultiTexCoord3iARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3iARB, &args );
 }
 
 static void WINAPI glMultiTexCoord3iSGIS( GLenum target, GLint s, GLint t, GLint r )
 {
     struct glMultiTexCoord3iSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3iSGIS, &args ))) WARN( "glMultiTexCoord3iSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3iSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord3iv( GLenum target, const GLint *v )
@@ -13464,25 +12871,22 @@ static void WINAPI glMultiTexCoord3ivSGIS( GLenum target, GLint * v )
 static void WINAPI glMultiTexCoord3s( GLenum target, GLshort s, GLshort t, GLshort r )
 {
     struct glMultiTexCoord3s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3s, &args ))) WARN( "glMultiTexCoord3s returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3s, &args );
 }
 
 static void WINAPI glMultiTexCoord3sARB( GLenum target, GLshort s, GLshort t, GLshort r )
 {
     struct glMultiTexCoord3sARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3sARB, &args ))) WARN( "glMultiTexCoord3sARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3sARB, &args );
 }
 
 static void WINAPI glMultiTexCoord3sSGIS( GLenum target, GLshort s, GLshort t, GLshort r )
 {
     struct glMultiTexCoord3sSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3sSGIS, &args ))) WARN( "glMultiTexCoord3sSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3sSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord3sv( GLenum target, const GLshort *v )
@@ -13512,9 +12916,8 @@ static void WINAPI glMultiTexCoord3svSGIS( GLenum target, GLshort * v )
 static void WINAPI glMultiTexCoord3xOES( GLenum texture, GLfixed s, GLfixed t, GLfixed r )
 {
     struct glMultiTexCoord3xOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "texture %d, s %d, t %d, r %d\n", texture, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3xOES, &args ))) WARN( "glMultiTexCoord3xOES returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord3xOES, &args );
 }
 
 static void WINAPI glMultiTexCoord3xvOES( GLenum texture, const GLfixed *coords )
@@ -13528,9 +12931,8 @@ static void WINAPI glMultiTexCoord3xvOES( GLenum texture, const GLfixed *coords
 static void WINAPI glMultiTexCoord4bOES( GLenum texture, GLbyte s, GLbyte t, GLbyte r, GLbyte q )
 {
     struct glMultiTexCoord4bOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "texture %d, s %d, t %d, r %d, q %d\n", texture, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4bOES, &args ))) WARN( "glMultiTexCoord4bOES returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4bOES, &args );
 }
 
 static void WINAPI glMultiTexCoord4bvOES( GLenum texture, const GLbyte *coords )
@@ -13544,25 +12946,22 @@ static void WINAPI glMultiTexCoord4bvOES( GLenum texture, const GLbyte *coords )
 static void WINAPI glMultiTexCoord4d( GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q )
 {
     struct glMultiTexCoord4d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4d, &args ))) WARN( "glMultiTexCoord4d returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4d, &args );
 }
 
 static void WINAPI glMultiTexCoord4dARB( GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q )
 {
     struct glMultiTexCoord4dARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4dARB, &args ))) WARN( "glMultiTexCoord4dARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4dARB, &args );
 }
 
 static void WINAPI glMultiTexCoord4dSGIS( GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q )
 {
     struct glMultiTexCoord4dSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4dSGIS, &args ))) WARN( "glMultiTexCoord4dSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4dSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord4dv( GLenum target, const GLdouble *v )
@@ -13592,25 +12991,22 @@ static void WINAPI glMultiTexCoord4dvSGIS( GLenum target, GLdouble * v )
 static void WINAPI glMultiTexCoord4f( GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q )
 {
     struct glMultiTexCoord4f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4f, &args ))) WARN( "glMultiTexCoord4f returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4f, &args );
 }
 
 static void WINAPI glMultiTexCoord4fARB( GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q )
 {
     struct glMultiTexCoord4fARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4fARB, &args ))) WARN( "glMultiTexCoord4fARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4fARB, &args );
 }
 
 static void WINAPI glMultiTexCoord4fSGIS( GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q )
 {
     struct glMultiTexCoord4fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4fSGIS, &args ))) WARN( "glMultiTexCoord4fSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4fSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord4fv( GLenum target, const GLfloat *v )
@@ -13640,9 +13036,8 @@ static void WINAPI glMultiTexCoord4fvSGIS( GLenum target, GLfloat * v )
 static void WINAPI glMultiTexCoord4hNV( GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q )
 {
     struct glMultiTexCoord4hNV_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4hNV, &args ))) WARN( "glMultiTexCoord4hNV returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4hNV, &args );
 }
 
 static void WINAPI glMultiTexCoord4hvNV( GLenum target, const GLhalfNV *v )
@@ -13656,25 +13051,22 @@ static void WINAPI glMultiTexCoord4hvNV( GLenum target, const GLhalfNV *v )
 static void WINAPI glMultiTexCoord4i( GLenum target, GLint s, GLint t, GLint r, GLint q )
 {
     struct glMultiTexCoord4i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4i, &args ))) WARN( "glMultiTexCoord4i returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4i, &args );
 }
 
 static void WINAPI glMultiTexCoord4iARB( GLenum target, GLint s, GLint t, GLint r, GLint q )
 {
     struct glMultiTexCoord4iARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4iARB, &args ))) WARN( "glMultiTexCoord4iARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4iARB, &args );
 }
 
 static void WINAPI glMultiTexCoord4iSGIS( GLenum target, GLint s, GLint t, GLint r, GLint q )
 {
     struct glMultiTexCoord4iSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4iSGIS, &args ))) WARN( "glMultiTexCoord4iSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4iSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord4iv( GLenum target, const GLint *v )
@@ -13704,25 +13096,22 @@ static void WINAPI glMultiTexCoord4ivSGIS( GLenum target, GLint * v )
 static void WINAPI glMultiTexCoord4s( GLenum target, GLshort s, GLshort t, GLshort r, GLshort q )
 {
     struct glMultiTexCoord4s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4s, &args ))) WARN( "glMultiTexCoord4s returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4s, &args );
 }
 
 static void WINAPI glMultiTexCoord4sARB( GLenum target, GLshort s, GLshort t, GLshort r, GLshort q )
 {
     struct glMultiTexCoord4sARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4sARB, &args ))) WARN( "glMultiTexCoord4sARB returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4sARB, &args );
 }
 
 static void WINAPI glMultiTexCoord4sSGIS( GLenum target, GLshort s, GLshort t, GLshort r, GLshort q )
 {
     struct glMultiTexCoord4sSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4sSGIS, &args ))) WARN( "glMultiTexCoord4sSGIS returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4sSGIS, &args );
 }
 
 static void WINAPI glMultiTexCoord4sv( GLenum target, const GLshort *v )
@@ -13752,9 +13141,8 @@ static void WINAPI glMultiTexCoord4svSGIS( GLenum target, GLshort * v )
 static void WINAPI glMultiTexCoord4xOES( GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q )
 {
     struct glMultiTexCoord4xOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "texture %d, s %d, t %d, r %d, q %d\n", texture, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4xOES, &args ))) WARN( "glMultiTexCoord4xOES returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoord4xOES, &args );
 }
 
 static void WINAPI glMultiTexCoord4xvOES( GLenum texture, const GLfixed *coords )
@@ -13768,9 +13156,8 @@ static void WINAPI glMultiTexCoord4xvOES( GLenum texture, const GLfixed *coords
 static void WINAPI glMultiTexCoordP1ui( GLenum texture, GLenum type, GLuint coords )
 {
     struct glMultiTexCoordP1ui_params args = { .teb = NtCurrentTeb(), .texture = texture, .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "texture %d, type %d, coords %d\n", texture, type, coords );
-    if ((status = UNIX_CALL( glMultiTexCoordP1ui, &args ))) WARN( "glMultiTexCoordP1ui returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoordP1ui, &args );
 }
 
 static void WINAPI glMultiTexCoordP1uiv( GLenum texture, GLenum type, const GLuint *coords )
@@ -13784,9 +13171,8 @@ static void WINAPI glMultiTexCoordP1uiv( GLenum texture, GLenum type, const GLui
 static void WINAPI glMultiTexCoordP2ui( GLenum texture, GLenum type, GLuint coords )
 {
     struct glMultiTexCoordP2ui_params args = { .teb = NtCurrentTeb(), .texture = texture, .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "texture %d, type %d, coords %d\n", texture, type, coords );
-    if ((status = UNIX_CALL( glMultiTexCoordP2ui, &args ))) WARN( "glMultiTexCoordP2ui returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoordP2ui, &args );
 }
 
 static void WINAPI glMultiTexCoordP2uiv( GLenum texture, GLenum type, const GLuint *coords )
@@ -13800,9 +13186,8 @@ static void WINAPI glMultiTexCoordP2uiv( GLenum texture, GLenum type, const GLui
 static void WINAPI glMultiTexCoordP3ui( GLenum texture, GLenum type, GLuint coords )
 {
     struct glMultiTexCoordP3ui_params args = { .teb = NtCurrentTeb(), .texture = texture, .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "texture %d, type %d, coords %d\n", texture, type, coords );
-    if ((status = UNIX_CALL( glMultiTexCoordP3ui, &args ))) WARN( "glMultiTexCoordP3ui returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoordP3ui, &args );
 }
 
 static void WINAPI glMultiTexCoordP3uiv( GLenum texture, GLenum type, const GLuint *coords )
@@ -13816,9 +13201,8 @@ static void WINAPI glMultiTexCoordP3uiv( GLenum texture, GLenum type, const GLui
 static void WINAPI glMultiTexCoordP4ui( GLenum texture, GLenum type, GLuint coords )
 {
     struct glMultiTexCoordP4ui_params args = { .teb = NtCurrentTeb(), .texture = texture, .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "texture %d, type %d, coords %d\n", texture, type, coords );
-    if ((status = UNIX_CALL( glMultiTexCoordP4ui, &args ))) WARN( "glMultiTexCoordP4ui returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexCoordP4ui, &args );
 }
 
 static void WINAPI glMultiTexCoordP4uiv( GLenum texture, GLenum type, const GLuint *coords )
@@ -13848,9 +13232,8 @@ static void WINAPI glMultiTexCoordPointerSGIS( GLenum target, GLint size, GLenum
 static void WINAPI glMultiTexEnvfEXT( GLenum texunit, GLenum target, GLenum pname, GLfloat param )
 {
     struct glMultiTexEnvfEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, pname %d, param %f\n", texunit, target, pname, param );
-    if ((status = UNIX_CALL( glMultiTexEnvfEXT, &args ))) WARN( "glMultiTexEnvfEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexEnvfEXT, &args );
 }
 
 static void WINAPI glMultiTexEnvfvEXT( GLenum texunit, GLenum target, GLenum pname, const GLfloat *params )
@@ -13864,9 +13247,8 @@ static void WINAPI glMultiTexEnvfvEXT( GLenum texunit, GLenum target, GLenum pna
 static void WINAPI glMultiTexEnviEXT( GLenum texunit, GLenum target, GLenum pname, GLint param )
 {
     struct glMultiTexEnviEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, pname %d, param %d\n", texunit, target, pname, param );
-    if ((status = UNIX_CALL( glMultiTexEnviEXT, &args ))) WARN( "glMultiTexEnviEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexEnviEXT, &args );
 }
 
 static void WINAPI glMultiTexEnvivEXT( GLenum texunit, GLenum target, GLenum pname, const GLint *params )
@@ -13880,9 +13262,8 @@ static void WINAPI glMultiTexEnvivEXT( GLenum texunit, GLenum target, GLenum pna
 static void WINAPI glMultiTexGendEXT( GLenum texunit, GLenum coord, GLenum pname, GLdouble param )
 {
     struct glMultiTexGendEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .coord = coord, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texunit %d, coord %d, pname %d, param %f\n", texunit, coord, pname, param );
-    if ((status = UNIX_CALL( glMultiTexGendEXT, &args ))) WARN( "glMultiTexGendEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexGendEXT, &args );
 }
 
 static void WINAPI glMultiTexGendvEXT( GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params )
@@ -13896,9 +13277,8 @@ static void WINAPI glMultiTexGendvEXT( GLenum texunit, GLenum coord, GLenum pnam
 static void WINAPI glMultiTexGenfEXT( GLenum texunit, GLenum coord, GLenum pname, GLfloat param )
 {
     struct glMultiTexGenfEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .coord = coord, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texunit %d, coord %d, pname %d, param %f\n", texunit, coord, pname, param );
-    if ((status = UNIX_CALL( glMultiTexGenfEXT, &args ))) WARN( "glMultiTexGenfEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexGenfEXT, &args );
 }
 
 static void WINAPI glMultiTexGenfvEXT( GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params )
@@ -13912,9 +13292,8 @@ static void WINAPI glMultiTexGenfvEXT( GLenum texunit, GLenum coord, GLenum pnam
 static void WINAPI glMultiTexGeniEXT( GLenum texunit, GLenum coord, GLenum pname, GLint param )
 {
     struct glMultiTexGeniEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .coord = coord, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texunit %d, coord %d, pname %d, param %d\n", texunit, coord, pname, param );
-    if ((status = UNIX_CALL( glMultiTexGeniEXT, &args ))) WARN( "glMultiTexGeniEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexGeniEXT, &args );
 }
 
 static void WINAPI glMultiTexGenivEXT( GLenum texunit, GLenum coord, GLenum pname, const GLint *params )
@@ -13968,9 +13347,8 @@ static void WINAPI glMultiTexParameterIuivEXT( GLenum texunit, GLenum target, GL
 static void WINAPI glMultiTexParameterfEXT( GLenum texunit, GLenum target, GLenum pname, GLfloat param )
 {
     struct glMultiTexParameterfEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, pname %d, param %f\n", texunit, target, pname, param );
-    if ((status = UNIX_CALL( glMultiTexParameterfEXT, &args ))) WARN( "glMultiTexParameterfEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexParameterfEXT, &args );
 }
 
 static void WINAPI glMultiTexParameterfvEXT( GLenum texunit, GLenum target, GLenum pname, const GLfloat *params )
@@ -13984,9 +13362,8 @@ static void WINAPI glMultiTexParameterfvEXT( GLenum texunit, GLenum target, GLen
 static void WINAPI glMultiTexParameteriEXT( GLenum texunit, GLenum target, GLenum pname, GLint param )
 {
     struct glMultiTexParameteriEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, pname %d, param %d\n", texunit, target, pname, param );
-    if ((status = UNIX_CALL( glMultiTexParameteriEXT, &args ))) WARN( "glMultiTexParameteriEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexParameteriEXT, &args );
 }
 
 static void WINAPI glMultiTexParameterivEXT( GLenum texunit, GLenum target, GLenum pname, const GLint *params )
@@ -14000,9 +13377,8 @@ static void WINAPI glMultiTexParameterivEXT( GLenum texunit, GLenum target, GLen
 static void WINAPI glMultiTexRenderbufferEXT( GLenum texunit, GLenum target, GLuint renderbuffer )
 {
     struct glMultiTexRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "texunit %d, target %d, renderbuffer %d\n", texunit, target, renderbuffer );
-    if ((status = UNIX_CALL( glMultiTexRenderbufferEXT, &args ))) WARN( "glMultiTexRenderbufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glMultiTexRenderbufferEXT, &args );
 }
 
 static void WINAPI glMultiTexSubImage1DEXT( GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels )
@@ -14032,17 +13408,15 @@ static void WINAPI glMultiTexSubImage3DEXT( GLenum texunit, GLenum target, GLint
 static void WINAPI glMulticastBarrierNV(void)
 {
     struct glMulticastBarrierNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glMulticastBarrierNV, &args ))) WARN( "glMulticastBarrierNV returned %#lx\n", status );
+    UNIX_BATCH( glMulticastBarrierNV, &args );
 }
 
 static void WINAPI glMulticastBlitFramebufferNV( GLuint srcGpu, GLuint dstGpu, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
 {
     struct glMulticastBlitFramebufferNV_params args = { .teb = NtCurrentTeb(), .srcGpu = srcGpu, .dstGpu = dstGpu, .srcX0 = srcX0, .srcY0 = srcY0, .srcX1 = srcX1, .srcY1 = srcY1, .dstX0 = dstX0, .dstY0 = dstY0, .dstX1 = dstX1, .dstY1 = dstY1, .mask = mask, .filter = filter };
-    NTSTATUS status;
     TRACE( "srcGpu %d, dstGpu %d, srcX0 %d, srcY0 %d, srcX1 %d, srcY1 %d, dstX0 %d, dstY0 %d, dstX1 %d, dstY1 %d, mask %d, filter %d\n", srcGpu, dstGpu, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
-    if ((status = UNIX_CALL( glMulticastBlitFramebufferNV, &args ))) WARN( "glMulticastBlitFramebufferNV returned %#lx\n", status );
+    UNIX_BATCH( glMulticastBlitFramebufferNV, &args );
 }
 
 static void WINAPI glMulticastBufferSubDataNV( GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data )
@@ -14064,9 +13438,8 @@ static void WINAPI glMulticastCopyBufferSubDataNV( GLuint readGpu, GLbitfield wr
 static void WINAPI glMulticastCopyImageSubDataNV( GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth )
 {
     struct glMulticastCopyImageSubDataNV_params args = { .teb = NtCurrentTeb(), .srcGpu = srcGpu, .dstGpuMask = dstGpuMask, .srcName = srcName, .srcTarget = srcTarget, .srcLevel = srcLevel, .srcX = srcX, .srcY = srcY, .srcZ = srcZ, .dstName = dstName, .dstTarget = dstTarget, .dstLevel = dstLevel, .dstX = dstX, .dstY = dstY, .dstZ = dstZ, .srcWidth = srcWidth, .srcHeight = srcHeight, .srcDepth = srcDepth };
-    NTSTATUS status;
     TRACE( "srcGpu %d, dstGpuMask %d, srcName %d, srcTarget %d, srcLevel %d, srcX %d, srcY %d, srcZ %d, dstName %d, dstTarget %d, dstLevel %d, dstX %d, dstY %d, dstZ %d, srcWidth %d, srcHeight %d, srcDepth %d\n", srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth );
-    if ((status = UNIX_CALL( glMulticastCopyImageSubDataNV, &args ))) WARN( "glMulticastCopyImageSubDataNV returned %#lx\n", status );
+    UNIX_BATCH( glMulticastCopyImageSubDataNV, &args );
 }
 
 static void WINAPI glMulticastFramebufferSampleLocationsfvNV( GLuint gpu, GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v )
@@ -14128,25 +13501,22 @@ static void WINAPI glMulticastViewportArrayvNVX( GLuint gpu, GLuint first, GLsiz
 static void WINAPI glMulticastViewportPositionWScaleNVX( GLuint gpu, GLuint index, GLfloat xcoeff, GLfloat ycoeff )
 {
     struct glMulticastViewportPositionWScaleNVX_params args = { .teb = NtCurrentTeb(), .gpu = gpu, .index = index, .xcoeff = xcoeff, .ycoeff = ycoeff };
-    NTSTATUS status;
     TRACE( "gpu %d, index %d, xcoeff %f, ycoeff %f\n", gpu, index, xcoeff, ycoeff );
-    if ((status = UNIX_CALL( glMulticastViewportPositionWScaleNVX, &args ))) WARN( "glMulticastViewportPositionWScaleNVX returned %#lx\n", status );
+    UNIX_BATCH( glMulticastViewportPositionWScaleNVX, &args );
 }
 
 static void WINAPI glMulticastWaitSyncNV( GLuint signalGpu, GLbitfield waitGpuMask )
 {
     struct glMulticastWaitSyncNV_params args = { .teb = NtCurrentTeb(), .signalGpu = signalGpu, .waitGpuMask = waitGpuMask };
-    NTSTATUS status;
     TRACE( "signalGpu %d, waitGpuMask %d\n", signalGpu, waitGpuMask );
-    if ((status = UNIX_CALL( glMulticastWaitSyncNV, &args ))) WARN( "glMulticastWaitSyncNV returned %#lx\n", status );
+    UNIX_BATCH( glMulticastWaitSyncNV, &args );
 }
 
 static void WINAPI glNamedBufferAttachMemoryNV( GLuint buffer, GLuint memory, GLuint64 offset )
 {
     struct glNamedBufferAttachMemoryNV_params args = { .teb = NtCurrentTeb(), .buffer = buffer, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "buffer %d, memory %d, offset %s\n", buffer, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glNamedBufferAttachMemoryNV, &args ))) WARN( "glNamedBufferAttachMemoryNV returned %#lx\n", status );
+    UNIX_BATCH( glNamedBufferAttachMemoryNV, &args );
 }
 
 static void WINAPI glNamedBufferData( GLuint buffer, GLsizeiptr size, const void *data, GLenum usage )
@@ -14240,9 +13610,8 @@ static void WINAPI glNamedCopyBufferSubDataEXT( GLuint readBuffer, GLuint writeB
 static void WINAPI glNamedFramebufferDrawBuffer( GLuint framebuffer, GLenum buf )
 {
     struct glNamedFramebufferDrawBuffer_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .buf = buf };
-    NTSTATUS status;
     TRACE( "framebuffer %d, buf %d\n", framebuffer, buf );
-    if ((status = UNIX_CALL( glNamedFramebufferDrawBuffer, &args ))) WARN( "glNamedFramebufferDrawBuffer returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferDrawBuffer, &args );
 }
 
 static void WINAPI glNamedFramebufferDrawBuffers( GLuint framebuffer, GLsizei n, const GLenum *bufs )
@@ -14256,41 +13625,36 @@ static void WINAPI glNamedFramebufferDrawBuffers( GLuint framebuffer, GLsizei n,
 static void WINAPI glNamedFramebufferParameteri( GLuint framebuffer, GLenum pname, GLint param )
 {
     struct glNamedFramebufferParameteri_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "framebuffer %d, pname %d, param %d\n", framebuffer, pname, param );
-    if ((status = UNIX_CALL( glNamedFramebufferParameteri, &args ))) WARN( "glNamedFramebufferParameteri returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferParameteri, &args );
 }
 
 static void WINAPI glNamedFramebufferParameteriEXT( GLuint framebuffer, GLenum pname, GLint param )
 {
     struct glNamedFramebufferParameteriEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "framebuffer %d, pname %d, param %d\n", framebuffer, pname, param );
-    if ((status = UNIX_CALL( glNamedFramebufferParameteriEXT, &args ))) WARN( "glNamedFramebufferParameteriEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferParameteriEXT, &args );
 }
 
 static void WINAPI glNamedFramebufferReadBuffer( GLuint framebuffer, GLenum src )
 {
     struct glNamedFramebufferReadBuffer_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .src = src };
-    NTSTATUS status;
     TRACE( "framebuffer %d, src %d\n", framebuffer, src );
-    if ((status = UNIX_CALL( glNamedFramebufferReadBuffer, &args ))) WARN( "glNamedFramebufferReadBuffer returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferReadBuffer, &args );
 }
 
 static void WINAPI glNamedFramebufferRenderbuffer( GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
 {
     struct glNamedFramebufferRenderbuffer_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .renderbuffertarget = renderbuffertarget, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, renderbuffertarget %d, renderbuffer %d\n", framebuffer, attachment, renderbuffertarget, renderbuffer );
-    if ((status = UNIX_CALL( glNamedFramebufferRenderbuffer, &args ))) WARN( "glNamedFramebufferRenderbuffer returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferRenderbuffer, &args );
 }
 
 static void WINAPI glNamedFramebufferRenderbufferEXT( GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
 {
     struct glNamedFramebufferRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .renderbuffertarget = renderbuffertarget, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, renderbuffertarget %d, renderbuffer %d\n", framebuffer, attachment, renderbuffertarget, renderbuffer );
-    if ((status = UNIX_CALL( glNamedFramebufferRenderbufferEXT, &args ))) WARN( "glNamedFramebufferRenderbufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferRenderbufferEXT, &args );
 }
 
 static void WINAPI glNamedFramebufferSampleLocationsfvARB( GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v )
@@ -14320,73 +13684,64 @@ static void WINAPI glNamedFramebufferSamplePositionsfvAMD( GLuint framebuffer, G
 static void WINAPI glNamedFramebufferTexture( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level )
 {
     struct glNamedFramebufferTexture_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d\n", framebuffer, attachment, texture, level );
-    if ((status = UNIX_CALL( glNamedFramebufferTexture, &args ))) WARN( "glNamedFramebufferTexture returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferTexture, &args );
 }
 
 static void WINAPI glNamedFramebufferTexture1DEXT( GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
 {
     struct glNamedFramebufferTexture1DEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, textarget %d, texture %d, level %d\n", framebuffer, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glNamedFramebufferTexture1DEXT, &args ))) WARN( "glNamedFramebufferTexture1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferTexture1DEXT, &args );
 }
 
 static void WINAPI glNamedFramebufferTexture2DEXT( GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
 {
     struct glNamedFramebufferTexture2DEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, textarget %d, texture %d, level %d\n", framebuffer, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glNamedFramebufferTexture2DEXT, &args ))) WARN( "glNamedFramebufferTexture2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferTexture2DEXT, &args );
 }
 
 static void WINAPI glNamedFramebufferTexture3DEXT( GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset )
 {
     struct glNamedFramebufferTexture3DEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level, .zoffset = zoffset };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, textarget %d, texture %d, level %d, zoffset %d\n", framebuffer, attachment, textarget, texture, level, zoffset );
-    if ((status = UNIX_CALL( glNamedFramebufferTexture3DEXT, &args ))) WARN( "glNamedFramebufferTexture3DEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferTexture3DEXT, &args );
 }
 
 static void WINAPI glNamedFramebufferTextureEXT( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level )
 {
     struct glNamedFramebufferTextureEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d\n", framebuffer, attachment, texture, level );
-    if ((status = UNIX_CALL( glNamedFramebufferTextureEXT, &args ))) WARN( "glNamedFramebufferTextureEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferTextureEXT, &args );
 }
 
 static void WINAPI glNamedFramebufferTextureFaceEXT( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face )
 {
     struct glNamedFramebufferTextureFaceEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level, .face = face };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d, face %d\n", framebuffer, attachment, texture, level, face );
-    if ((status = UNIX_CALL( glNamedFramebufferTextureFaceEXT, &args ))) WARN( "glNamedFramebufferTextureFaceEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferTextureFaceEXT, &args );
 }
 
 static void WINAPI glNamedFramebufferTextureLayer( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer )
 {
     struct glNamedFramebufferTextureLayer_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d, layer %d\n", framebuffer, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glNamedFramebufferTextureLayer, &args ))) WARN( "glNamedFramebufferTextureLayer returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferTextureLayer, &args );
 }
 
 static void WINAPI glNamedFramebufferTextureLayerEXT( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer )
 {
     struct glNamedFramebufferTextureLayerEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
-    NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d, layer %d\n", framebuffer, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glNamedFramebufferTextureLayerEXT, &args ))) WARN( "glNamedFramebufferTextureLayerEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedFramebufferTextureLayerEXT, &args );
 }
 
 static void WINAPI glNamedProgramLocalParameter4dEXT( GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glNamedProgramLocalParameter4dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, target %d, index %d, x %f, y %f, z %f, w %f\n", program, target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glNamedProgramLocalParameter4dEXT, &args ))) WARN( "glNamedProgramLocalParameter4dEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedProgramLocalParameter4dEXT, &args );
 }
 
 static void WINAPI glNamedProgramLocalParameter4dvEXT( GLuint program, GLenum target, GLuint index, const GLdouble *params )
@@ -14400,9 +13755,8 @@ static void WINAPI glNamedProgramLocalParameter4dvEXT( GLuint program, GLenum ta
 static void WINAPI glNamedProgramLocalParameter4fEXT( GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glNamedProgramLocalParameter4fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, target %d, index %d, x %f, y %f, z %f, w %f\n", program, target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glNamedProgramLocalParameter4fEXT, &args ))) WARN( "glNamedProgramLocalParameter4fEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedProgramLocalParameter4fEXT, &args );
 }
 
 static void WINAPI glNamedProgramLocalParameter4fvEXT( GLuint program, GLenum target, GLuint index, const GLfloat *params )
@@ -14416,9 +13770,8 @@ static void WINAPI glNamedProgramLocalParameter4fvEXT( GLuint program, GLenum ta
 static void WINAPI glNamedProgramLocalParameterI4iEXT( GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w )
 {
     struct glNamedProgramLocalParameterI4iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, target %d, index %d, x %d, y %d, z %d, w %d\n", program, target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glNamedProgramLocalParameterI4iEXT, &args ))) WARN( "glNamedProgramLocalParameterI4iEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedProgramLocalParameterI4iEXT, &args );
 }
 
 static void WINAPI glNamedProgramLocalParameterI4ivEXT( GLuint program, GLenum target, GLuint index, const GLint *params )
@@ -14432,9 +13785,8 @@ static void WINAPI glNamedProgramLocalParameterI4ivEXT( GLuint program, GLenum t
 static void WINAPI glNamedProgramLocalParameterI4uiEXT( GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w )
 {
     struct glNamedProgramLocalParameterI4uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, target %d, index %d, x %d, y %d, z %d, w %d\n", program, target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glNamedProgramLocalParameterI4uiEXT, &args ))) WARN( "glNamedProgramLocalParameterI4uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedProgramLocalParameterI4uiEXT, &args );
 }
 
 static void WINAPI glNamedProgramLocalParameterI4uivEXT( GLuint program, GLenum target, GLuint index, const GLuint *params )
@@ -14480,49 +13832,43 @@ static void WINAPI glNamedProgramStringEXT( GLuint program, GLenum target, GLenu
 static void WINAPI glNamedRenderbufferStorage( GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glNamedRenderbufferStorage_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "renderbuffer %d, internalformat %d, width %d, height %d\n", renderbuffer, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorage, &args ))) WARN( "glNamedRenderbufferStorage returned %#lx\n", status );
+    UNIX_BATCH( glNamedRenderbufferStorage, &args );
 }
 
 static void WINAPI glNamedRenderbufferStorageEXT( GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glNamedRenderbufferStorageEXT_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "renderbuffer %d, internalformat %d, width %d, height %d\n", renderbuffer, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageEXT, &args ))) WARN( "glNamedRenderbufferStorageEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedRenderbufferStorageEXT, &args );
 }
 
 static void WINAPI glNamedRenderbufferStorageMultisample( GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glNamedRenderbufferStorageMultisample_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .samples = samples, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "renderbuffer %d, samples %d, internalformat %d, width %d, height %d\n", renderbuffer, samples, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageMultisample, &args ))) WARN( "glNamedRenderbufferStorageMultisample returned %#lx\n", status );
+    UNIX_BATCH( glNamedRenderbufferStorageMultisample, &args );
 }
 
 static void WINAPI glNamedRenderbufferStorageMultisampleAdvancedAMD( GLuint renderbuffer, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glNamedRenderbufferStorageMultisampleAdvancedAMD_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .samples = samples, .storageSamples = storageSamples, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "renderbuffer %d, samples %d, storageSamples %d, internalformat %d, width %d, height %d\n", renderbuffer, samples, storageSamples, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageMultisampleAdvancedAMD, &args ))) WARN( "glNamedRenderbufferStorageMultisampleAdvancedAMD returned %#lx\n", status );
+    UNIX_BATCH( glNamedRenderbufferStorageMultisampleAdvancedAMD, &args );
 }
 
 static void WINAPI glNamedRenderbufferStorageMultisampleCoverageEXT( GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glNamedRenderbufferStorageMultisampleCoverageEXT_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "renderbuffer %d, coverageSamples %d, colorSamples %d, internalformat %d, width %d, height %d\n", renderbuffer, coverageSamples, colorSamples, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageMultisampleCoverageEXT, &args ))) WARN( "glNamedRenderbufferStorageMultisampleCoverageEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedRenderbufferStorageMultisampleCoverageEXT, &args );
 }
 
 static void WINAPI glNamedRenderbufferStorageMultisampleEXT( GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glNamedRenderbufferStorageMultisampleEXT_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .samples = samples, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "renderbuffer %d, samples %d, internalformat %d, width %d, height %d\n", renderbuffer, samples, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageMultisampleEXT, &args ))) WARN( "glNamedRenderbufferStorageMultisampleEXT returned %#lx\n", status );
+    UNIX_BATCH( glNamedRenderbufferStorageMultisampleEXT, &args );
 }
 
 static void WINAPI glNamedStringARB( GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string )
@@ -14554,9 +13900,8 @@ static GLuint WINAPI glNewObjectBufferATI( GLsizei size, const void *pointer, GL
 static void WINAPI glNormal3fVertex3fSUN( GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "nx %f, ny %f, nz %f, x %f, y %f, z %f\n", nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glNormal3fVertex3fSUN, &args ))) WARN( "glNormal3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glNormal3fVertex3fSUN, &args );
 }
 
 static void WINAPI glNormal3fVertex3fvSUN( const GLfloat *n, const GLfloat *v )
@@ -14570,9 +13915,8 @@ static void WINAPI glNormal3fVertex3fvSUN( const GLfloat *n, const GLfloat *v )
 static void WINAPI glNormal3hNV( GLhalfNV nx, GLhalfNV ny, GLhalfNV nz )
 {
     struct glNormal3hNV_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3hNV, &args ))) WARN( "glNormal3hNV returned %#lx\n", status );
+    UNIX_BATCH( glNormal3hNV, &args );
 }
 
 static void WINAPI glNormal3hvNV( const GLhalfNV *v )
@@ -14586,9 +13930,8 @@ static void WINAPI glNormal3hvNV( const GLhalfNV *v )
 static void WINAPI glNormal3xOES( GLfixed nx, GLfixed ny, GLfixed nz )
 {
     struct glNormal3xOES_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3xOES, &args ))) WARN( "glNormal3xOES returned %#lx\n", status );
+    UNIX_BATCH( glNormal3xOES, &args );
 }
 
 static void WINAPI glNormal3xvOES( const GLfixed *coords )
@@ -14602,17 +13945,15 @@ static void WINAPI glNormal3xvOES( const GLfixed *coords )
 static void WINAPI glNormalFormatNV( GLenum type, GLsizei stride )
 {
     struct glNormalFormatNV_params args = { .teb = NtCurrentTeb(), .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "type %d, stride %d\n", type, stride );
-    if ((status = UNIX_CALL( glNormalFormatNV, &args ))) WARN( "glNormalFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glNormalFormatNV, &args );
 }
 
 static void WINAPI glNormalP3ui( GLenum type, GLuint coords )
 {
     struct glNormalP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glNormalP3ui, &args ))) WARN( "glNormalP3ui returned %#lx\n", status );
+    UNIX_BATCH( glNormalP3ui, &args );
 }
 
 static void WINAPI glNormalP3uiv( GLenum type, const GLuint *coords )
@@ -14650,9 +13991,8 @@ static void WINAPI glNormalPointervINTEL( GLenum type, const void **pointer )
 static void WINAPI glNormalStream3bATI( GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz )
 {
     struct glNormalStream3bATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "stream %d, nx %d, ny %d, nz %d\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3bATI, &args ))) WARN( "glNormalStream3bATI returned %#lx\n", status );
+    UNIX_BATCH( glNormalStream3bATI, &args );
 }
 
 static void WINAPI glNormalStream3bvATI( GLenum stream, const GLbyte *coords )
@@ -14666,9 +14006,8 @@ static void WINAPI glNormalStream3bvATI( GLenum stream, const GLbyte *coords )
 static void WINAPI glNormalStream3dATI( GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz )
 {
     struct glNormalStream3dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "stream %d, nx %f, ny %f, nz %f\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3dATI, &args ))) WARN( "glNormalStream3dATI returned %#lx\n", status );
+    UNIX_BATCH( glNormalStream3dATI, &args );
 }
 
 static void WINAPI glNormalStream3dvATI( GLenum stream, const GLdouble *coords )
@@ -14682,9 +14021,8 @@ static void WINAPI glNormalStream3dvATI( GLenum stream, const GLdouble *coords )
 static void WINAPI glNormalStream3fATI( GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz )
 {
     struct glNormalStream3fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "stream %d, nx %f, ny %f, nz %f\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3fATI, &args ))) WARN( "glNormalStream3fATI returned %#lx\n", status );
+    UNIX_BATCH( glNormalStream3fATI, &args );
 }
 
 static void WINAPI glNormalStream3fvATI( GLenum stream, const GLfloat *coords )
@@ -14698,9 +14036,8 @@ static void WINAPI glNormalStream3fvATI( GLenum stream, const GLfloat *coords )
 static void WINAPI glNormalStream3iATI( GLenum stream, GLint nx, GLint ny, GLint nz )
 {
     struct glNormalStream3iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "stream %d, nx %d, ny %d, nz %d\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3iATI, &args ))) WARN( "glNormalStream3iATI returned %#lx\n", status );
+    UNIX_BATCH( glNormalStream3iATI, &args );
 }
 
 static void WINAPI glNormalStream3ivATI( GLenum stream, const GLint *coords )
@@ -14714,9 +14051,8 @@ static void WINAPI glNormalStream3ivATI( GLenum stream, const GLint *coords )
 static void WINAPI glNormalStream3sATI( GLenum stream, GLshort nx, GLshort ny, GLshort nz )
 {
     struct glNormalStream3sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
-    NTSTATUS status;
     TRACE( "stream %d, nx %d, ny %d, nz %d\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3sATI, &args ))) WARN( "glNormalStream3sATI returned %#lx\n", status );
+    UNIX_BATCH( glNormalStream3sATI, &args );
 }
 
 static void WINAPI glNormalStream3svATI( GLenum stream, const GLshort *coords )
@@ -14764,49 +14100,43 @@ static GLenum WINAPI glObjectUnpurgeableAPPLE( GLenum objectType, GLuint name, G
 static void WINAPI glOrthofOES( GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f )
 {
     struct glOrthofOES_params args = { .teb = NtCurrentTeb(), .l = l, .r = r, .b = b, .t = t, .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "l %f, r %f, b %f, t %f, n %f, f %f\n", l, r, b, t, n, f );
-    if ((status = UNIX_CALL( glOrthofOES, &args ))) WARN( "glOrthofOES returned %#lx\n", status );
+    UNIX_BATCH( glOrthofOES, &args );
 }
 
 static void WINAPI glOrthoxOES( GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f )
 {
     struct glOrthoxOES_params args = { .teb = NtCurrentTeb(), .l = l, .r = r, .b = b, .t = t, .n = n, .f = f };
-    NTSTATUS status;
     TRACE( "l %d, r %d, b %d, t %d, n %d, f %d\n", l, r, b, t, n, f );
-    if ((status = UNIX_CALL( glOrthoxOES, &args ))) WARN( "glOrthoxOES returned %#lx\n", status );
+    UNIX_BATCH( glOrthoxOES, &args );
 }
 
 static void WINAPI glPNTrianglesfATI( GLenum pname, GLfloat param )
 {
     struct glPNTrianglesfATI_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPNTrianglesfATI, &args ))) WARN( "glPNTrianglesfATI returned %#lx\n", status );
+    UNIX_BATCH( glPNTrianglesfATI, &args );
 }
 
 static void WINAPI glPNTrianglesiATI( GLenum pname, GLint param )
 {
     struct glPNTrianglesiATI_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPNTrianglesiATI, &args ))) WARN( "glPNTrianglesiATI returned %#lx\n", status );
+    UNIX_BATCH( glPNTrianglesiATI, &args );
 }
 
 static void WINAPI glPassTexCoordATI( GLuint dst, GLuint coord, GLenum swizzle )
 {
     struct glPassTexCoordATI_params args = { .teb = NtCurrentTeb(), .dst = dst, .coord = coord, .swizzle = swizzle };
-    NTSTATUS status;
     TRACE( "dst %d, coord %d, swizzle %d\n", dst, coord, swizzle );
-    if ((status = UNIX_CALL( glPassTexCoordATI, &args ))) WARN( "glPassTexCoordATI returned %#lx\n", status );
+    UNIX_BATCH( glPassTexCoordATI, &args );
 }
 
 static void WINAPI glPassThroughxOES( GLfixed token )
 {
     struct glPassThroughxOES_params args = { .teb = NtCurrentTeb(), .token = token };
-    NTSTATUS status;
     TRACE( "token %d\n", token );
-    if ((status = UNIX_CALL( glPassThroughxOES, &args ))) WARN( "glPassThroughxOES returned %#lx\n", status );
+    UNIX_BATCH( glPassThroughxOES, &args );
 }
 
 static void WINAPI glPatchParameterfv( GLenum pname, const GLfloat *values )
@@ -14820,9 +14150,8 @@ static void WINAPI glPatchParameterfv( GLenum pname, const GLfloat *values )
 static void WINAPI glPatchParameteri( GLenum pname, GLint value )
 {
     struct glPatchParameteri_params args = { .teb = NtCurrentTeb(), .pname = pname, .value = value };
-    NTSTATUS status;
     TRACE( "pname %d, value %d\n", pname, value );
-    if ((status = UNIX_CALL( glPatchParameteri, &args ))) WARN( "glPatchParameteri returned %#lx\n", status );
+    UNIX_BATCH( glPatchParameteri, &args );
 }
 
 static void WINAPI glPathColorGenNV( GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat *coeffs )
@@ -14852,9 +14181,8 @@ static void WINAPI glPathCoordsNV( GLuint path, GLsizei numCoords, GLenum coordT
 static void WINAPI glPathCoverDepthFuncNV( GLenum func )
 {
     struct glPathCoverDepthFuncNV_params args = { .teb = NtCurrentTeb(), .func = func };
-    NTSTATUS status;
     TRACE( "func %d\n", func );
-    if ((status = UNIX_CALL( glPathCoverDepthFuncNV, &args ))) WARN( "glPathCoverDepthFuncNV returned %#lx\n", status );
+    UNIX_BATCH( glPathCoverDepthFuncNV, &args );
 }
 
 static void WINAPI glPathDashArrayNV( GLuint path, GLsizei dashCount, const GLfloat *dashArray )
@@ -14868,9 +14196,8 @@ static void WINAPI glPathDashArrayNV( GLuint path, GLsizei dashCount, const GLfl
 static void WINAPI glPathFogGenNV( GLenum genMode )
 {
     struct glPathFogGenNV_params args = { .teb = NtCurrentTeb(), .genMode = genMode };
-    NTSTATUS status;
     TRACE( "genMode %d\n", genMode );
-    if ((status = UNIX_CALL( glPathFogGenNV, &args ))) WARN( "glPathFogGenNV returned %#lx\n", status );
+    UNIX_BATCH( glPathFogGenNV, &args );
 }
 
 static GLenum WINAPI glPathGlyphIndexArrayNV( GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale )
@@ -14920,9 +14247,8 @@ static GLenum WINAPI glPathMemoryGlyphIndexArrayNV( GLuint firstPathName, GLenum
 static void WINAPI glPathParameterfNV( GLuint path, GLenum pname, GLfloat value )
 {
     struct glPathParameterfNV_params args = { .teb = NtCurrentTeb(), .path = path, .pname = pname, .value = value };
-    NTSTATUS status;
     TRACE( "path %d, pname %d, value %f\n", path, pname, value );
-    if ((status = UNIX_CALL( glPathParameterfNV, &args ))) WARN( "glPathParameterfNV returned %#lx\n", status );
+    UNIX_BATCH( glPathParameterfNV, &args );
 }
 
 static void WINAPI glPathParameterfvNV( GLuint path, GLenum pname, const GLfloat *value )
@@ -14936,9 +14262,8 @@ static void WINAPI glPathParameterfvNV( GLuint path, GLenum pname, const GLfloat
 static void WINAPI glPathParameteriNV( GLuint path, GLenum pname, GLint value )
 {
     struct glPathParameteriNV_params args = { .teb = NtCurrentTeb(), .path = path, .pname = pname, .value = value };
-    NTSTATUS status;
     TRACE( "path %d, pname %d, value %d\n", path, pname, value );
-    if ((status = UNIX_CALL( glPathParameteriNV, &args ))) WARN( "glPathParameteriNV returned %#lx\n", status );
+    UNIX_BATCH( glPathParameteriNV, &args );
 }
 
 static void WINAPI glPathParameterivNV( GLuint path, GLenum pname, const GLint *value )
@@ -14952,17 +14277,15 @@ static void WINAPI glPathParameterivNV( GLuint path, GLenum pname, const GLint *
 static void WINAPI glPathStencilDepthOffsetNV( GLfloat factor, GLfloat units )
 {
     struct glPathStencilDepthOffsetNV_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units };
-    NTSTATUS status;
     TRACE( "factor %f, units %f\n", factor, units );
-    if ((status = UNIX_CALL( glPathStencilDepthOffsetNV, &args ))) WARN( "glPathStencilDepthOffsetNV returned %#lx\n", status );
+    UNIX_BATCH( glPathStencilDepthOffsetNV, &args );
 }
 
 static void WINAPI glPathStencilFuncNV( GLenum func, GLint ref, GLuint mask )
 {
     struct glPathStencilFuncNV_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref, .mask = mask };
-    NTSTATUS status;
     TRACE( "func %d, ref %d, mask %d\n", func, ref, mask );
-    if ((status = UNIX_CALL( glPathStencilFuncNV, &args ))) WARN( "glPathStencilFuncNV returned %#lx\n", status );
+    UNIX_BATCH( glPathStencilFuncNV, &args );
 }
 
 static void WINAPI glPathStringNV( GLuint path, GLenum format, GLsizei length, const void *pathString )
@@ -15000,17 +14323,15 @@ static void WINAPI glPathTexGenNV( GLenum texCoordSet, GLenum genMode, GLint com
 static void WINAPI glPauseTransformFeedback(void)
 {
     struct glPauseTransformFeedback_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPauseTransformFeedback, &args ))) WARN( "glPauseTransformFeedback returned %#lx\n", status );
+    UNIX_BATCH( glPauseTransformFeedback, &args );
 }
 
 static void WINAPI glPauseTransformFeedbackNV(void)
 {
     struct glPauseTransformFeedbackNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPauseTransformFeedbackNV, &args ))) WARN( "glPauseTransformFeedbackNV returned %#lx\n", status );
+    UNIX_BATCH( glPauseTransformFeedbackNV, &args );
 }
 
 static void WINAPI glPixelDataRangeNV( GLenum target, GLsizei length, const void *pointer )
@@ -15032,17 +14353,15 @@ static void WINAPI glPixelMapx( GLenum map, GLint size, const GLfixed *values )
 static void WINAPI glPixelStorex( GLenum pname, GLfixed param )
 {
     struct glPixelStorex_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelStorex, &args ))) WARN( "glPixelStorex returned %#lx\n", status );
+    UNIX_BATCH( glPixelStorex, &args );
 }
 
 static void WINAPI glPixelTexGenParameterfSGIS( GLenum pname, GLfloat param )
 {
     struct glPixelTexGenParameterfSGIS_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTexGenParameterfSGIS, &args ))) WARN( "glPixelTexGenParameterfSGIS returned %#lx\n", status );
+    UNIX_BATCH( glPixelTexGenParameterfSGIS, &args );
 }
 
 static void WINAPI glPixelTexGenParameterfvSGIS( GLenum pname, const GLfloat *params )
@@ -15056,9 +14375,8 @@ static void WINAPI glPixelTexGenParameterfvSGIS( GLenum pname, const GLfloat *pa
 static void WINAPI glPixelTexGenParameteriSGIS( GLenum pname, GLint param )
 {
     struct glPixelTexGenParameteriSGIS_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTexGenParameteriSGIS, &args ))) WARN( "glPixelTexGenParameteriSGIS returned %#lx\n", status );
+    UNIX_BATCH( glPixelTexGenParameteriSGIS, &args );
 }
 
 static void WINAPI glPixelTexGenParameterivSGIS( GLenum pname, const GLint *params )
@@ -15072,25 +14390,22 @@ static void WINAPI glPixelTexGenParameterivSGIS( GLenum pname, const GLint *para
 static void WINAPI glPixelTexGenSGIX( GLenum mode )
 {
     struct glPixelTexGenSGIX_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glPixelTexGenSGIX, &args ))) WARN( "glPixelTexGenSGIX returned %#lx\n", status );
+    UNIX_BATCH( glPixelTexGenSGIX, &args );
 }
 
 static void WINAPI glPixelTransferxOES( GLenum pname, GLfixed param )
 {
     struct glPixelTransferxOES_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTransferxOES, &args ))) WARN( "glPixelTransferxOES returned %#lx\n", status );
+    UNIX_BATCH( glPixelTransferxOES, &args );
 }
 
 static void WINAPI glPixelTransformParameterfEXT( GLenum target, GLenum pname, GLfloat param )
 {
     struct glPixelTransformParameterfEXT_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %f\n", target, pname, param );
-    if ((status = UNIX_CALL( glPixelTransformParameterfEXT, &args ))) WARN( "glPixelTransformParameterfEXT returned %#lx\n", status );
+    UNIX_BATCH( glPixelTransformParameterfEXT, &args );
 }
 
 static void WINAPI glPixelTransformParameterfvEXT( GLenum target, GLenum pname, const GLfloat *params )
@@ -15104,9 +14419,8 @@ static void WINAPI glPixelTransformParameterfvEXT( GLenum target, GLenum pname,
 static void WINAPI glPixelTransformParameteriEXT( GLenum target, GLenum pname, GLint param )
 {
     struct glPixelTransformParameteriEXT_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glPixelTransformParameteriEXT, &args ))) WARN( "glPixelTransformParameteriEXT returned %#lx\n", status );
+    UNIX_BATCH( glPixelTransformParameteriEXT, &args );
 }
 
 static void WINAPI glPixelTransformParameterivEXT( GLenum target, GLenum pname, const GLint *params )
@@ -15120,9 +14434,8 @@ static void WINAPI glPixelTransformParameterivEXT( GLenum target, GLenum pname,
 static void WINAPI glPixelZoomxOES( GLfixed xfactor, GLfixed yfactor )
 {
     struct glPixelZoomxOES_params args = { .teb = NtCurrentTeb(), .xfactor = xfactor, .yfactor = yfactor };
-    NTSTATUS status;
     TRACE( "xfactor %d, yfactor %d\n", xfactor, yfactor );
-    if ((status = UNIX_CALL( glPixelZoomxOES, &args ))) WARN( "glPixelZoomxOES returned %#lx\n", status );
+    UNIX_BATCH( glPixelZoomxOES, &args );
 }
 
 static GLboolean WINAPI glPointAlongPathNV( GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY )
@@ -15137,33 +14450,29 @@ static GLboolean WINAPI glPointAlongPathNV( GLuint path, GLsizei startSegment, G
 static void WINAPI glPointParameterf( GLenum pname, GLfloat param )
 {
     struct glPointParameterf_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameterf, &args ))) WARN( "glPointParameterf returned %#lx\n", status );
+    UNIX_BATCH( glPointParameterf, &args );
 }
 
 static void WINAPI glPointParameterfARB( GLenum pname, GLfloat param )
 {
     struct glPointParameterfARB_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameterfARB, &args ))) WARN( "glPointParameterfARB returned %#lx\n", status );
+    UNIX_BATCH( glPointParameterfARB, &args );
 }
 
 static void WINAPI glPointParameterfEXT( GLenum pname, GLfloat param )
 {
     struct glPointParameterfEXT_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameterfEXT, &args ))) WARN( "glPointParameterfEXT returned %#lx\n", status );
+    UNIX_BATCH( glPointParameterfEXT, &args );
 }
 
 static void WINAPI glPointParameterfSGIS( GLenum pname, GLfloat param )
 {
     struct glPointParameterfSGIS_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameterfSGIS, &args ))) WARN( "glPointParameterfSGIS returned %#lx\n", status );
+    UNIX_BATCH( glPointParameterfSGIS, &args );
 }
 
 static void WINAPI glPointParameterfv( GLenum pname, const GLfloat *params )
@@ -15201,17 +14510,15 @@ static void WINAPI glPointParameterfvSGIS( GLenum pname, const GLfloat *params )
 static void WINAPI glPointParameteri( GLenum pname, GLint param )
 {
     struct glPointParameteri_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameteri, &args ))) WARN( "glPointParameteri returned %#lx\n", status );
+    UNIX_BATCH( glPointParameteri, &args );
 }
 
 static void WINAPI glPointParameteriNV( GLenum pname, GLint param )
 {
     struct glPointParameteriNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameteriNV, &args ))) WARN( "glPointParameteriNV returned %#lx\n", status );
+    UNIX_BATCH( glPointParameteriNV, &args );
 }
 
 static void WINAPI glPointParameteriv( GLenum pname, const GLint *params )
@@ -15241,9 +14548,8 @@ static void WINAPI glPointParameterxvOES( GLenum pname, const GLfixed *params )
 static void WINAPI glPointSizexOES( GLfixed size )
 {
     struct glPointSizexOES_params args = { .teb = NtCurrentTeb(), .size = size };
-    NTSTATUS status;
     TRACE( "size %d\n", size );
-    if ((status = UNIX_CALL( glPointSizexOES, &args ))) WARN( "glPointSizexOES returned %#lx\n", status );
+    UNIX_BATCH( glPointSizexOES, &args );
 }
 
 static GLint WINAPI glPollAsyncSGIX( GLuint *markerp )
@@ -15267,97 +14573,85 @@ static GLint WINAPI glPollInstrumentsSGIX( GLint *marker_p )
 static void WINAPI glPolygonOffsetClamp( GLfloat factor, GLfloat units, GLfloat clamp )
 {
     struct glPolygonOffsetClamp_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units, .clamp = clamp };
-    NTSTATUS status;
     TRACE( "factor %f, units %f, clamp %f\n", factor, units, clamp );
-    if ((status = UNIX_CALL( glPolygonOffsetClamp, &args ))) WARN( "glPolygonOffsetClamp returned %#lx\n", status );
+    UNIX_BATCH( glPolygonOffsetClamp, &args );
 }
 
 static void WINAPI glPolygonOffsetClampEXT( GLfloat factor, GLfloat units, GLfloat clamp )
 {
     struct glPolygonOffsetClampEXT_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units, .clamp = clamp };
-    NTSTATUS status;
     TRACE( "factor %f, units %f, clamp %f\n", factor, units, clamp );
-    if ((status = UNIX_CALL( glPolygonOffsetClampEXT, &args ))) WARN( "glPolygonOffsetClampEXT returned %#lx\n", status );
+    UNIX_BATCH( glPolygonOffsetClampEXT, &args );
 }
 
 static void WINAPI glPolygonOffsetEXT( GLfloat factor, GLfloat bias )
 {
     struct glPolygonOffsetEXT_params args = { .teb = NtCurrentTeb(), .factor = factor, .bias = bias };
-    NTSTATUS status;
     TRACE( "factor %f, bias %f\n", factor, bias );
-    if ((status = UNIX_CALL( glPolygonOffsetEXT, &args ))) WARN( "glPolygonOffsetEXT returned %#lx\n", status );
+    UNIX_BATCH( glPolygonOffsetEXT, &args );
 }
 
 static void WINAPI glPolygonOffsetxOES( GLfixed factor, GLfixed units )
 {
     struct glPolygonOffsetxOES_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units };
-    NTSTATUS status;
     TRACE( "factor %d, units %d\n", factor, units );
-    if ((status = UNIX_CALL( glPolygonOffsetxOES, &args ))) WARN( "glPolygonOffsetxOES returned %#lx\n", status );
+    UNIX_BATCH( glPolygonOffsetxOES, &args );
 }
 
 static void WINAPI glPopDebugGroup(void)
 {
     struct glPopDebugGroup_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopDebugGroup, &args ))) WARN( "glPopDebugGroup returned %#lx\n", status );
+    UNIX_BATCH( glPopDebugGroup, &args );
 }
 
 static void WINAPI glPopGroupMarkerEXT(void)
 {
     struct glPopGroupMarkerEXT_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopGroupMarkerEXT, &args ))) WARN( "glPopGroupMarkerEXT returned %#lx\n", status );
+    UNIX_BATCH( glPopGroupMarkerEXT, &args );
 }
 
 static void WINAPI glPresentFrameDualFillNV( GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3 )
 {
     struct glPresentFrameDualFillNV_params args = { .teb = NtCurrentTeb(), .video_slot = video_slot, .minPresentTime = minPresentTime, .beginPresentTimeId = beginPresentTimeId, .presentDurationId = presentDurationId, .type = type, .target0 = target0, .fill0 = fill0, .target1 = target1, .fill1 = fill1, .target2 = target2, .fill2 = fill2, .target3 = target3, .fill3 = fill3 };
-    NTSTATUS status;
     TRACE( "video_slot %d, minPresentTime %s, beginPresentTimeId %d, presentDurationId %d, type %d, target0 %d, fill0 %d, target1 %d, fill1 %d, target2 %d, fill2 %d, target3 %d, fill3 %d\n", video_slot, wine_dbgstr_longlong(minPresentTime), beginPresentTimeId, presentDurationId, type, target0, fill0, target1, fill1, target2, fill2, target3, fill3 );
-    if ((status = UNIX_CALL( glPresentFrameDualFillNV, &args ))) WARN( "glPresentFrameDualFillNV returned %#lx\n", status );
+    UNIX_BATCH( glPresentFrameDualFillNV, &args );
 }
 
 static void WINAPI glPresentFrameKeyedNV( GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1 )
 {
     struct glPresentFrameKeyedNV_params args = { .teb = NtCurrentTeb(), .video_slot = video_slot, .minPresentTime = minPresentTime, .beginPresentTimeId = beginPresentTimeId, .presentDurationId = presentDurationId, .type = type, .target0 = target0, .fill0 = fill0, .key0 = key0, .target1 = target1, .fill1 = fill1, .key1 = key1 };
-    NTSTATUS status;
     TRACE( "video_slot %d, minPresentTime %s, beginPresentTimeId %d, presentDurationId %d, type %d, target0 %d, fill0 %d, key0 %d, target1 %d, fill1 %d, key1 %d\n", video_slot, wine_dbgstr_longlong(minPresentTime), beginPresentTimeId, presentDurationId, type, target0, fill0, key0, target1, fill1, key1 );
-    if ((status = UNIX_CALL( glPresentFrameKeyedNV, &args ))) WARN( "glPresentFrameKeyedNV returned %#lx\n", status );
+    UNIX_BATCH( glPresentFrameKeyedNV, &args );
 }
 
 static void WINAPI glPrimitiveBoundingBoxARB( GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW )
 {
     struct glPrimitiveBoundingBoxARB_params args = { .teb = NtCurrentTeb(), .minX = minX, .minY = minY, .minZ = minZ, .minW = minW, .maxX = maxX, .maxY = maxY, .maxZ = maxZ, .maxW = maxW };
-    NTSTATUS status;
     TRACE( "minX %f, minY %f, minZ %f, minW %f, maxX %f, maxY %f, maxZ %f, maxW %f\n", minX, minY, minZ, minW, maxX, maxY, maxZ, maxW );
-    if ((status = UNIX_CALL( glPrimitiveBoundingBoxARB, &args ))) WARN( "glPrimitiveBoundingBoxARB returned %#lx\n", status );
+    UNIX_BATCH( glPrimitiveBoundingBoxARB, &args );
 }
 
 static void WINAPI glPrimitiveRestartIndex( GLuint index )
 {
     struct glPrimitiveRestartIndex_params args = { .teb = NtCurrentTeb(), .index = index };
-    NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glPrimitiveRestartIndex, &args ))) WARN( "glPrimitiveRestartIndex returned %#lx\n", status );
+    UNIX_BATCH( glPrimitiveRestartIndex, &args );
 }
 
 static void WINAPI glPrimitiveRestartIndexNV( GLuint index )
 {
     struct glPrimitiveRestartIndexNV_params args = { .teb = NtCurrentTeb(), .index = index };
-    NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glPrimitiveRestartIndexNV, &args ))) WARN( "glPrimitiveRestartIndexNV returned %#lx\n", status );
+    UNIX_BATCH( glPrimitiveRestartIndexNV, &args );
 }
 
 static void WINAPI glPrimitiveRestartNV(void)
 {
     struct glPrimitiveRestartNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPrimitiveRestartNV, &args ))) WARN( "glPrimitiveRestartNV returned %#lx\n", status );
+    UNIX_BATCH( glPrimitiveRestartNV, &args );
 }
 
 static void WINAPI glPrioritizeTexturesEXT( GLsizei n, const GLuint *textures, const GLclampf *priorities )
@@ -15411,9 +14705,8 @@ static void WINAPI glProgramBufferParametersfvNV( GLenum target, GLuint bindingI
 static void WINAPI glProgramEnvParameter4dARB( GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glProgramEnvParameter4dARB_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramEnvParameter4dARB, &args ))) WARN( "glProgramEnvParameter4dARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramEnvParameter4dARB, &args );
 }
 
 static void WINAPI glProgramEnvParameter4dvARB( GLenum target, GLuint index, const GLdouble *params )
@@ -15427,9 +14720,8 @@ static void WINAPI glProgramEnvParameter4dvARB( GLenum target, GLuint index, con
 static void WINAPI glProgramEnvParameter4fARB( GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glProgramEnvParameter4fARB_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramEnvParameter4fARB, &args ))) WARN( "glProgramEnvParameter4fARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramEnvParameter4fARB, &args );
 }
 
 static void WINAPI glProgramEnvParameter4fvARB( GLenum target, GLuint index, const GLfloat *params )
@@ -15443,9 +14735,8 @@ static void WINAPI glProgramEnvParameter4fvARB( GLenum target, GLuint index, con
 static void WINAPI glProgramEnvParameterI4iNV( GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w )
 {
     struct glProgramEnvParameterI4iNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %d, y %d, z %d, w %d\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramEnvParameterI4iNV, &args ))) WARN( "glProgramEnvParameterI4iNV returned %#lx\n", status );
+    UNIX_BATCH( glProgramEnvParameterI4iNV, &args );
 }
 
 static void WINAPI glProgramEnvParameterI4ivNV( GLenum target, GLuint index, const GLint *params )
@@ -15459,9 +14750,8 @@ static void WINAPI glProgramEnvParameterI4ivNV( GLenum target, GLuint index, con
 static void WINAPI glProgramEnvParameterI4uiNV( GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w )
 {
     struct glProgramEnvParameterI4uiNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %d, y %d, z %d, w %d\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramEnvParameterI4uiNV, &args ))) WARN( "glProgramEnvParameterI4uiNV returned %#lx\n", status );
+    UNIX_BATCH( glProgramEnvParameterI4uiNV, &args );
 }
 
 static void WINAPI glProgramEnvParameterI4uivNV( GLenum target, GLuint index, const GLuint *params )
@@ -15499,9 +14789,8 @@ static void WINAPI glProgramEnvParametersI4uivNV( GLenum target, GLuint index, G
 static void WINAPI glProgramLocalParameter4dARB( GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glProgramLocalParameter4dARB_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramLocalParameter4dARB, &args ))) WARN( "glProgramLocalParameter4dARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramLocalParameter4dARB, &args );
 }
 
 static void WINAPI glProgramLocalParameter4dvARB( GLenum target, GLuint index, const GLdouble *params )
@@ -15515,9 +14804,8 @@ static void WINAPI glProgramLocalParameter4dvARB( GLenum target, GLuint index, c
 static void WINAPI glProgramLocalParameter4fARB( GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glProgramLocalParameter4fARB_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramLocalParameter4fARB, &args ))) WARN( "glProgramLocalParameter4fARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramLocalParameter4fARB, &args );
 }
 
 static void WINAPI glProgramLocalParameter4fvARB( GLenum target, GLuint index, const GLfloat *params )
@@ -15531,9 +14819,8 @@ static void WINAPI glProgramLocalParameter4fvARB( GLenum target, GLuint index, c
 static void WINAPI glProgramLocalParameterI4iNV( GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w )
 {
     struct glProgramLocalParameterI4iNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %d, y %d, z %d, w %d\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramLocalParameterI4iNV, &args ))) WARN( "glProgramLocalParameterI4iNV returned %#lx\n", status );
+    UNIX_BATCH( glProgramLocalParameterI4iNV, &args );
 }
 
 static void WINAPI glProgramLocalParameterI4ivNV( GLenum target, GLuint index, const GLint *params )
@@ -15547,9 +14834,8 @@ static void WINAPI glProgramLocalParameterI4ivNV( GLenum target, GLuint index, c
 static void WINAPI glProgramLocalParameterI4uiNV( GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w )
 {
     struct glProgramLocalParameterI4uiNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %d, y %d, z %d, w %d\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramLocalParameterI4uiNV, &args ))) WARN( "glProgramLocalParameterI4uiNV returned %#lx\n", status );
+    UNIX_BATCH( glProgramLocalParameterI4uiNV, &args );
 }
 
 static void WINAPI glProgramLocalParameterI4uivNV( GLenum target, GLuint index, const GLuint *params )
@@ -15619,9 +14905,8 @@ static void WINAPI glProgramNamedParameter4fvNV( GLuint id, GLsizei len, const G
 static void WINAPI glProgramParameter4dNV( GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glProgramParameter4dNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramParameter4dNV, &args ))) WARN( "glProgramParameter4dNV returned %#lx\n", status );
+    UNIX_BATCH( glProgramParameter4dNV, &args );
 }
 
 static void WINAPI glProgramParameter4dvNV( GLenum target, GLuint index, const GLdouble *v )
@@ -15635,9 +14920,8 @@ static void WINAPI glProgramParameter4dvNV( GLenum target, GLuint index, const G
 static void WINAPI glProgramParameter4fNV( GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glProgramParameter4fNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramParameter4fNV, &args ))) WARN( "glProgramParameter4fNV returned %#lx\n", status );
+    UNIX_BATCH( glProgramParameter4fNV, &args );
 }
 
 static void WINAPI glProgramParameter4fvNV( GLenum target, GLuint index, const GLfloat *v )
@@ -15651,25 +14935,22 @@ static void WINAPI glProgramParameter4fvNV( GLenum target, GLuint index, const G
 static void WINAPI glProgramParameteri( GLuint program, GLenum pname, GLint value )
 {
     struct glProgramParameteri_params args = { .teb = NtCurrentTeb(), .program = program, .pname = pname, .value = value };
-    NTSTATUS status;
     TRACE( "program %d, pname %d, value %d\n", program, pname, value );
-    if ((status = UNIX_CALL( glProgramParameteri, &args ))) WARN( "glProgramParameteri returned %#lx\n", status );
+    UNIX_BATCH( glProgramParameteri, &args );
 }
 
 static void WINAPI glProgramParameteriARB( GLuint program, GLenum pname, GLint value )
 {
     struct glProgramParameteriARB_params args = { .teb = NtCurrentTeb(), .program = program, .pname = pname, .value = value };
-    NTSTATUS status;
     TRACE( "program %d, pname %d, value %d\n", program, pname, value );
-    if ((status = UNIX_CALL( glProgramParameteriARB, &args ))) WARN( "glProgramParameteriARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramParameteriARB, &args );
 }
 
 static void WINAPI glProgramParameteriEXT( GLuint program, GLenum pname, GLint value )
 {
     struct glProgramParameteriEXT_params args = { .teb = NtCurrentTeb(), .program = program, .pname = pname, .value = value };
-    NTSTATUS status;
     TRACE( "program %d, pname %d, value %d\n", program, pname, value );
-    if ((status = UNIX_CALL( glProgramParameteriEXT, &args ))) WARN( "glProgramParameteriEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramParameteriEXT, &args );
 }
 
 static void WINAPI glProgramParameters4dvNV( GLenum target, GLuint index, GLsizei count, const GLdouble *v )
@@ -15715,17 +14996,15 @@ static void WINAPI glProgramSubroutineParametersuivNV( GLenum target, GLsizei co
 static void WINAPI glProgramUniform1d( GLuint program, GLint location, GLdouble v0 )
 {
     struct glProgramUniform1d_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1d, &args ))) WARN( "glProgramUniform1d returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1d, &args );
 }
 
 static void WINAPI glProgramUniform1dEXT( GLuint program, GLint location, GLdouble x )
 {
     struct glProgramUniform1dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %f\n", program, location, x );
-    if ((status = UNIX_CALL( glProgramUniform1dEXT, &args ))) WARN( "glProgramUniform1dEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1dEXT, &args );
 }
 
 static void WINAPI glProgramUniform1dv( GLuint program, GLint location, GLsizei count, const GLdouble *value )
@@ -15747,17 +15026,15 @@ static void WINAPI glProgramUniform1dvEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform1f( GLuint program, GLint location, GLfloat v0 )
 {
     struct glProgramUniform1f_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1f, &args ))) WARN( "glProgramUniform1f returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1f, &args );
 }
 
 static void WINAPI glProgramUniform1fEXT( GLuint program, GLint location, GLfloat v0 )
 {
     struct glProgramUniform1fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1fEXT, &args ))) WARN( "glProgramUniform1fEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1fEXT, &args );
 }
 
 static void WINAPI glProgramUniform1fv( GLuint program, GLint location, GLsizei count, const GLfloat *value )
@@ -15779,25 +15056,22 @@ static void WINAPI glProgramUniform1fvEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform1i( GLuint program, GLint location, GLint v0 )
 {
     struct glProgramUniform1i_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1i, &args ))) WARN( "glProgramUniform1i returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1i, &args );
 }
 
 static void WINAPI glProgramUniform1i64ARB( GLuint program, GLint location, GLint64 x )
 {
     struct glProgramUniform1i64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s\n", program, location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glProgramUniform1i64ARB, &args ))) WARN( "glProgramUniform1i64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1i64ARB, &args );
 }
 
 static void WINAPI glProgramUniform1i64NV( GLuint program, GLint location, GLint64EXT x )
 {
     struct glProgramUniform1i64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s\n", program, location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glProgramUniform1i64NV, &args ))) WARN( "glProgramUniform1i64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1i64NV, &args );
 }
 
 static void WINAPI glProgramUniform1i64vARB( GLuint program, GLint location, GLsizei count, const GLint64 *value )
@@ -15819,9 +15093,8 @@ static void WINAPI glProgramUniform1i64vNV( GLuint program, GLint location, GLsi
 static void WINAPI glProgramUniform1iEXT( GLuint program, GLint location, GLint v0 )
 {
     struct glProgramUniform1iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1iEXT, &args ))) WARN( "glProgramUniform1iEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1iEXT, &args );
 }
 
 static void WINAPI glProgramUniform1iv( GLuint program, GLint location, GLsizei count, const GLint *value )
@@ -15843,25 +15116,22 @@ static void WINAPI glProgramUniform1ivEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform1ui( GLuint program, GLint location, GLuint v0 )
 {
     struct glProgramUniform1ui_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1ui, &args ))) WARN( "glProgramUniform1ui returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1ui, &args );
 }
 
 static void WINAPI glProgramUniform1ui64ARB( GLuint program, GLint location, GLuint64 x )
 {
     struct glProgramUniform1ui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s\n", program, location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glProgramUniform1ui64ARB, &args ))) WARN( "glProgramUniform1ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1ui64ARB, &args );
 }
 
 static void WINAPI glProgramUniform1ui64NV( GLuint program, GLint location, GLuint64EXT x )
 {
     struct glProgramUniform1ui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s\n", program, location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glProgramUniform1ui64NV, &args ))) WARN( "glProgramUniform1ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1ui64NV, &args );
 }
 
 static void WINAPI glProgramUniform1ui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *value )
@@ -15883,9 +15153,8 @@ static void WINAPI glProgramUniform1ui64vNV( GLuint program, GLint location, GLs
 static void WINAPI glProgramUniform1uiEXT( GLuint program, GLint location, GLuint v0 )
 {
     struct glProgramUniform1uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1uiEXT, &args ))) WARN( "glProgramUniform1uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform1uiEXT, &args );
 }
 
 static void WINAPI glProgramUniform1uiv( GLuint program, GLint location, GLsizei count, const GLuint *value )
@@ -15907,17 +15176,15 @@ static void WINAPI glProgramUniform1uivEXT( GLuint program, GLint location, GLsi
 static void WINAPI glProgramUniform2d( GLuint program, GLint location, GLdouble v0, GLdouble v1 )
 {
     struct glProgramUniform2d_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2d, &args ))) WARN( "glProgramUniform2d returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2d, &args );
 }
 
 static void WINAPI glProgramUniform2dEXT( GLuint program, GLint location, GLdouble x, GLdouble y )
 {
     struct glProgramUniform2dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %f, y %f\n", program, location, x, y );
-    if ((status = UNIX_CALL( glProgramUniform2dEXT, &args ))) WARN( "glProgramUniform2dEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2dEXT, &args );
 }
 
 static void WINAPI glProgramUniform2dv( GLuint program, GLint location, GLsizei count, const GLdouble *value )
@@ -15939,17 +15206,15 @@ static void WINAPI glProgramUniform2dvEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform2f( GLuint program, GLint location, GLfloat v0, GLfloat v1 )
 {
     struct glProgramUniform2f_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2f, &args ))) WARN( "glProgramUniform2f returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2f, &args );
 }
 
 static void WINAPI glProgramUniform2fEXT( GLuint program, GLint location, GLfloat v0, GLfloat v1 )
 {
     struct glProgramUniform2fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2fEXT, &args ))) WARN( "glProgramUniform2fEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2fEXT, &args );
 }
 
 static void WINAPI glProgramUniform2fv( GLuint program, GLint location, GLsizei count, const GLfloat *value )
@@ -15971,25 +15236,22 @@ static void WINAPI glProgramUniform2fvEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform2i( GLuint program, GLint location, GLint v0, GLint v1 )
 {
     struct glProgramUniform2i_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2i, &args ))) WARN( "glProgramUniform2i returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2i, &args );
 }
 
 static void WINAPI glProgramUniform2i64ARB( GLuint program, GLint location, GLint64 x, GLint64 y )
 {
     struct glProgramUniform2i64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glProgramUniform2i64ARB, &args ))) WARN( "glProgramUniform2i64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2i64ARB, &args );
 }
 
 static void WINAPI glProgramUniform2i64NV( GLuint program, GLint location, GLint64EXT x, GLint64EXT y )
 {
     struct glProgramUniform2i64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glProgramUniform2i64NV, &args ))) WARN( "glProgramUniform2i64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2i64NV, &args );
 }
 
 static void WINAPI glProgramUniform2i64vARB( GLuint program, GLint location, GLsizei count, const GLint64 *value )
@@ -16011,9 +15273,8 @@ static void WINAPI glProgramUniform2i64vNV( GLuint program, GLint location, GLsi
 static void WINAPI glProgramUniform2iEXT( GLuint program, GLint location, GLint v0, GLint v1 )
 {
     struct glProgramUniform2iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2iEXT, &args ))) WARN( "glProgramUniform2iEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2iEXT, &args );
 }
 
 static void WINAPI glProgramUniform2iv( GLuint program, GLint location, GLsizei count, const GLint *value )
@@ -16035,25 +15296,22 @@ static void WINAPI glProgramUniform2ivEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform2ui( GLuint program, GLint location, GLuint v0, GLuint v1 )
 {
     struct glProgramUniform2ui_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2ui, &args ))) WARN( "glProgramUniform2ui returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2ui, &args );
 }
 
 static void WINAPI glProgramUniform2ui64ARB( GLuint program, GLint location, GLuint64 x, GLuint64 y )
 {
     struct glProgramUniform2ui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glProgramUniform2ui64ARB, &args ))) WARN( "glProgramUniform2ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2ui64ARB, &args );
 }
 
 static void WINAPI glProgramUniform2ui64NV( GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y )
 {
     struct glProgramUniform2ui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glProgramUniform2ui64NV, &args ))) WARN( "glProgramUniform2ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2ui64NV, &args );
 }
 
 static void WINAPI glProgramUniform2ui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *value )
@@ -16075,9 +15333,8 @@ static void WINAPI glProgramUniform2ui64vNV( GLuint program, GLint location, GLs
 static void WINAPI glProgramUniform2uiEXT( GLuint program, GLint location, GLuint v0, GLuint v1 )
 {
     struct glProgramUniform2uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2uiEXT, &args ))) WARN( "glProgramUniform2uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform2uiEXT, &args );
 }
 
 static void WINAPI glProgramUniform2uiv( GLuint program, GLint location, GLsizei count, const GLuint *value )
@@ -16099,17 +15356,15 @@ static void WINAPI glProgramUniform2uivEXT( GLuint program, GLint location, GLsi
 static void WINAPI glProgramUniform3d( GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2 )
 {
     struct glProgramUniform3d_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3d, &args ))) WARN( "glProgramUniform3d returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3d, &args );
 }
 
 static void WINAPI glProgramUniform3dEXT( GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glProgramUniform3dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %f, y %f, z %f\n", program, location, x, y, z );
-    if ((status = UNIX_CALL( glProgramUniform3dEXT, &args ))) WARN( "glProgramUniform3dEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3dEXT, &args );
 }
 
 static void WINAPI glProgramUniform3dv( GLuint program, GLint location, GLsizei count, const GLdouble *value )
@@ -16131,17 +15386,15 @@ static void WINAPI glProgramUniform3dvEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform3f( GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
 {
     struct glProgramUniform3f_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3f, &args ))) WARN( "glProgramUniform3f returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3f, &args );
 }
 
 static void WINAPI glProgramUniform3fEXT( GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
 {
     struct glProgramUniform3fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3fEXT, &args ))) WARN( "glProgramUniform3fEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3fEXT, &args );
 }
 
 static void WINAPI glProgramUniform3fv( GLuint program, GLint location, GLsizei count, const GLfloat *value )
@@ -16163,25 +15416,22 @@ static void WINAPI glProgramUniform3fvEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform3i( GLuint program, GLint location, GLint v0, GLint v1, GLint v2 )
 {
     struct glProgramUniform3i_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3i, &args ))) WARN( "glProgramUniform3i returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3i, &args );
 }
 
 static void WINAPI glProgramUniform3i64ARB( GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z )
 {
     struct glProgramUniform3i64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glProgramUniform3i64ARB, &args ))) WARN( "glProgramUniform3i64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3i64ARB, &args );
 }
 
 static void WINAPI glProgramUniform3i64NV( GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z )
 {
     struct glProgramUniform3i64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glProgramUniform3i64NV, &args ))) WARN( "glProgramUniform3i64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3i64NV, &args );
 }
 
 static void WINAPI glProgramUniform3i64vARB( GLuint program, GLint location, GLsizei count, const GLint64 *value )
@@ -16203,9 +15453,8 @@ static void WINAPI glProgramUniform3i64vNV( GLuint program, GLint location, GLsi
 static void WINAPI glProgramUniform3iEXT( GLuint program, GLint location, GLint v0, GLint v1, GLint v2 )
 {
     struct glProgramUniform3iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3iEXT, &args ))) WARN( "glProgramUniform3iEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3iEXT, &args );
 }
 
 static void WINAPI glProgramUniform3iv( GLuint program, GLint location, GLsizei count, const GLint *value )
@@ -16227,25 +15476,22 @@ static void WINAPI glProgramUniform3ivEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform3ui( GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2 )
 {
     struct glProgramUniform3ui_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3ui, &args ))) WARN( "glProgramUniform3ui returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3ui, &args );
 }
 
 static void WINAPI glProgramUniform3ui64ARB( GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z )
 {
     struct glProgramUniform3ui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glProgramUniform3ui64ARB, &args ))) WARN( "glProgramUniform3ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3ui64ARB, &args );
 }
 
 static void WINAPI glProgramUniform3ui64NV( GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z )
 {
     struct glProgramUniform3ui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glProgramUniform3ui64NV, &args ))) WARN( "glProgramUniform3ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3ui64NV, &args );
 }
 
 static void WINAPI glProgramUniform3ui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *value )
@@ -16267,9 +15513,8 @@ static void WINAPI glProgramUniform3ui64vNV( GLuint program, GLint location, GLs
 static void WINAPI glProgramUniform3uiEXT( GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2 )
 {
     struct glProgramUniform3uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3uiEXT, &args ))) WARN( "glProgramUniform3uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform3uiEXT, &args );
 }
 
 static void WINAPI glProgramUniform3uiv( GLuint program, GLint location, GLsizei count, const GLuint *value )
@@ -16291,17 +15536,15 @@ static void WINAPI glProgramUniform3uivEXT( GLuint program, GLint location, GLsi
 static void WINAPI glProgramUniform4d( GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3 )
 {
     struct glProgramUniform4d_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4d, &args ))) WARN( "glProgramUniform4d returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4d, &args );
 }
 
 static void WINAPI glProgramUniform4dEXT( GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glProgramUniform4dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %f, y %f, z %f, w %f\n", program, location, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramUniform4dEXT, &args ))) WARN( "glProgramUniform4dEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4dEXT, &args );
 }
 
 static void WINAPI glProgramUniform4dv( GLuint program, GLint location, GLsizei count, const GLdouble *value )
@@ -16323,17 +15566,15 @@ static void WINAPI glProgramUniform4dvEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform4f( GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
 {
     struct glProgramUniform4f_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4f, &args ))) WARN( "glProgramUniform4f returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4f, &args );
 }
 
 static void WINAPI glProgramUniform4fEXT( GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
 {
     struct glProgramUniform4fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4fEXT, &args ))) WARN( "glProgramUniform4fEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4fEXT, &args );
 }
 
 static void WINAPI glProgramUniform4fv( GLuint program, GLint location, GLsizei count, const GLfloat *value )
@@ -16355,25 +15596,22 @@ static void WINAPI glProgramUniform4fvEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform4i( GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3 )
 {
     struct glProgramUniform4i_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4i, &args ))) WARN( "glProgramUniform4i returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4i, &args );
 }
 
 static void WINAPI glProgramUniform4i64ARB( GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w )
 {
     struct glProgramUniform4i64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s, w %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glProgramUniform4i64ARB, &args ))) WARN( "glProgramUniform4i64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4i64ARB, &args );
 }
 
 static void WINAPI glProgramUniform4i64NV( GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w )
 {
     struct glProgramUniform4i64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s, w %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glProgramUniform4i64NV, &args ))) WARN( "glProgramUniform4i64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4i64NV, &args );
 }
 
 static void WINAPI glProgramUniform4i64vARB( GLuint program, GLint location, GLsizei count, const GLint64 *value )
@@ -16395,9 +15633,8 @@ static void WINAPI glProgramUniform4i64vNV( GLuint program, GLint location, GLsi
 static void WINAPI glProgramUniform4iEXT( GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3 )
 {
     struct glProgramUniform4iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4iEXT, &args ))) WARN( "glProgramUniform4iEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4iEXT, &args );
 }
 
 static void WINAPI glProgramUniform4iv( GLuint program, GLint location, GLsizei count, const GLint *value )
@@ -16419,25 +15656,22 @@ static void WINAPI glProgramUniform4ivEXT( GLuint program, GLint location, GLsiz
 static void WINAPI glProgramUniform4ui( GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3 )
 {
     struct glProgramUniform4ui_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4ui, &args ))) WARN( "glProgramUniform4ui returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4ui, &args );
 }
 
 static void WINAPI glProgramUniform4ui64ARB( GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w )
 {
     struct glProgramUniform4ui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s, w %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glProgramUniform4ui64ARB, &args ))) WARN( "glProgramUniform4ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4ui64ARB, &args );
 }
 
 static void WINAPI glProgramUniform4ui64NV( GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w )
 {
     struct glProgramUniform4ui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s, w %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glProgramUniform4ui64NV, &args ))) WARN( "glProgramUniform4ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4ui64NV, &args );
 }
 
 static void WINAPI glProgramUniform4ui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *value )
@@ -16459,9 +15693,8 @@ static void WINAPI glProgramUniform4ui64vNV( GLuint program, GLint location, GLs
 static void WINAPI glProgramUniform4uiEXT( GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3 )
 {
     struct glProgramUniform4uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4uiEXT, &args ))) WARN( "glProgramUniform4uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniform4uiEXT, &args );
 }
 
 static void WINAPI glProgramUniform4uiv( GLuint program, GLint location, GLsizei count, const GLuint *value )
@@ -16483,17 +15716,15 @@ static void WINAPI glProgramUniform4uivEXT( GLuint program, GLint location, GLsi
 static void WINAPI glProgramUniformHandleui64ARB( GLuint program, GLint location, GLuint64 value )
 {
     struct glProgramUniformHandleui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .value = value };
-    NTSTATUS status;
     TRACE( "program %d, location %d, value %s\n", program, location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glProgramUniformHandleui64ARB, &args ))) WARN( "glProgramUniformHandleui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniformHandleui64ARB, &args );
 }
 
 static void WINAPI glProgramUniformHandleui64NV( GLuint program, GLint location, GLuint64 value )
 {
     struct glProgramUniformHandleui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .value = value };
-    NTSTATUS status;
     TRACE( "program %d, location %d, value %s\n", program, location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glProgramUniformHandleui64NV, &args ))) WARN( "glProgramUniformHandleui64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniformHandleui64NV, &args );
 }
 
 static void WINAPI glProgramUniformHandleui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *values )
@@ -16803,9 +16034,8 @@ static void WINAPI glProgramUniformMatrix4x3fvEXT( GLuint program, GLint locatio
 static void WINAPI glProgramUniformui64NV( GLuint program, GLint location, GLuint64EXT value )
 {
     struct glProgramUniformui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .value = value };
-    NTSTATUS status;
     TRACE( "program %d, location %d, value %s\n", program, location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glProgramUniformui64NV, &args ))) WARN( "glProgramUniformui64NV returned %#lx\n", status );
+    UNIX_BATCH( glProgramUniformui64NV, &args );
 }
 
 static void WINAPI glProgramUniformui64vNV( GLuint program, GLint location, GLsizei count, const GLuint64EXT *value )
@@ -16819,33 +16049,29 @@ static void WINAPI glProgramUniformui64vNV( GLuint program, GLint location, GLsi
 static void WINAPI glProgramVertexLimitNV( GLenum target, GLint limit )
 {
     struct glProgramVertexLimitNV_params args = { .teb = NtCurrentTeb(), .target = target, .limit = limit };
-    NTSTATUS status;
     TRACE( "target %d, limit %d\n", target, limit );
-    if ((status = UNIX_CALL( glProgramVertexLimitNV, &args ))) WARN( "glProgramVertexLimitNV returned %#lx\n", status );
+    UNIX_BATCH( glProgramVertexLimitNV, &args );
 }
 
 static void WINAPI glProvokingVertex( GLenum mode )
 {
     struct glProvokingVertex_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glProvokingVertex, &args ))) WARN( "glProvokingVertex returned %#lx\n", status );
+    UNIX_BATCH( glProvokingVertex, &args );
 }
 
 static void WINAPI glProvokingVertexEXT( GLenum mode )
 {
     struct glProvokingVertexEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glProvokingVertexEXT, &args ))) WARN( "glProvokingVertexEXT returned %#lx\n", status );
+    UNIX_BATCH( glProvokingVertexEXT, &args );
 }
 
 static void WINAPI glPushClientAttribDefaultEXT( GLbitfield mask )
 {
     struct glPushClientAttribDefaultEXT_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glPushClientAttribDefaultEXT, &args ))) WARN( "glPushClientAttribDefaultEXT returned %#lx\n", status );
+    UNIX_BATCH( glPushClientAttribDefaultEXT, &args );
 }
 
 static void WINAPI glPushDebugGroup( GLenum source, GLuint id, GLsizei length, const GLchar *message )
@@ -16867,9 +16093,8 @@ static void WINAPI glPushGroupMarkerEXT( GLsizei length, const GLchar *marker )
 static void WINAPI glQueryCounter( GLuint id, GLenum target )
 {
     struct glQueryCounter_params args = { .teb = NtCurrentTeb(), .id = id, .target = target };
-    NTSTATUS status;
     TRACE( "id %d, target %d\n", id, target );
-    if ((status = UNIX_CALL( glQueryCounter, &args ))) WARN( "glQueryCounter returned %#lx\n", status );
+    UNIX_BATCH( glQueryCounter, &args );
 }
 
 static GLbitfield WINAPI glQueryMatrixxOES( GLfixed *mantissa, GLint *exponent )
@@ -16884,9 +16109,8 @@ static GLbitfield WINAPI glQueryMatrixxOES( GLfixed *mantissa, GLint *exponent )
 static void WINAPI glQueryObjectParameteruiAMD( GLenum target, GLuint id, GLenum pname, GLuint param )
 {
     struct glQueryObjectParameteruiAMD_params args = { .teb = NtCurrentTeb(), .target = target, .id = id, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, id %d, pname %d, param %d\n", target, id, pname, param );
-    if ((status = UNIX_CALL( glQueryObjectParameteruiAMD, &args ))) WARN( "glQueryObjectParameteruiAMD returned %#lx\n", status );
+    UNIX_BATCH( glQueryObjectParameteruiAMD, &args );
 }
 
 static GLint WINAPI glQueryResourceNV( GLenum queryType, GLint tagId, GLuint count, GLint *buffer )
@@ -16909,9 +16133,8 @@ static void WINAPI glQueryResourceTagNV( GLint tagId, const GLchar *tagString )
 static void WINAPI glRasterPos2xOES( GLfixed x, GLfixed y )
 {
     struct glRasterPos2xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2xOES, &args ))) WARN( "glRasterPos2xOES returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos2xOES, &args );
 }
 
 static void WINAPI glRasterPos2xvOES( const GLfixed *coords )
@@ -16925,9 +16148,8 @@ static void WINAPI glRasterPos2xvOES( const GLfixed *coords )
 static void WINAPI glRasterPos3xOES( GLfixed x, GLfixed y, GLfixed z )
 {
     struct glRasterPos3xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3xOES, &args ))) WARN( "glRasterPos3xOES returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos3xOES, &args );
 }
 
 static void WINAPI glRasterPos3xvOES( const GLfixed *coords )
@@ -16941,9 +16163,8 @@ static void WINAPI glRasterPos3xvOES( const GLfixed *coords )
 static void WINAPI glRasterPos4xOES( GLfixed x, GLfixed y, GLfixed z, GLfixed w )
 {
     struct glRasterPos4xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4xOES, &args ))) WARN( "glRasterPos4xOES returned %#lx\n", status );
+    UNIX_BATCH( glRasterPos4xOES, &args );
 }
 
 static void WINAPI glRasterPos4xvOES( const GLfixed *coords )
@@ -16957,25 +16178,22 @@ static void WINAPI glRasterPos4xvOES( const GLfixed *coords )
 static void WINAPI glRasterSamplesEXT( GLuint samples, GLboolean fixedsamplelocations )
 {
     struct glRasterSamplesEXT_params args = { .teb = NtCurrentTeb(), .samples = samples, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "samples %d, fixedsamplelocations %d\n", samples, fixedsamplelocations );
-    if ((status = UNIX_CALL( glRasterSamplesEXT, &args ))) WARN( "glRasterSamplesEXT returned %#lx\n", status );
+    UNIX_BATCH( glRasterSamplesEXT, &args );
 }
 
 static void WINAPI glReadBufferRegion( GLenum region, GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glReadBufferRegion_params args = { .teb = NtCurrentTeb(), .region = region, .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "region %d, x %d, y %d, width %d, height %d\n", region, x, y, width, height );
-    if ((status = UNIX_CALL( glReadBufferRegion, &args ))) WARN( "glReadBufferRegion returned %#lx\n", status );
+    UNIX_BATCH( glReadBufferRegion, &args );
 }
 
 static void WINAPI glReadInstrumentsSGIX( GLint marker )
 {
     struct glReadInstrumentsSGIX_params args = { .teb = NtCurrentTeb(), .marker = marker };
-    NTSTATUS status;
     TRACE( "marker %d\n", marker );
-    if ((status = UNIX_CALL( glReadInstrumentsSGIX, &args ))) WARN( "glReadInstrumentsSGIX returned %#lx\n", status );
+    UNIX_BATCH( glReadInstrumentsSGIX, &args );
 }
 
 static void WINAPI glReadnPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data )
@@ -16997,9 +16215,8 @@ static void WINAPI glReadnPixelsARB( GLint x, GLint y, GLsizei width, GLsizei he
 static void WINAPI glRectxOES( GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2 )
 {
     struct glRectxOES_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
-    NTSTATUS status;
     TRACE( "x1 %d, y1 %d, x2 %d, y2 %d\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRectxOES, &args ))) WARN( "glRectxOES returned %#lx\n", status );
+    UNIX_BATCH( glRectxOES, &args );
 }
 
 static void WINAPI glRectxvOES( const GLfixed *v1, const GLfixed *v2 )
@@ -17030,65 +16247,57 @@ static GLboolean WINAPI glReleaseKeyedMutexWin32EXT( GLuint memory, GLuint64 key
 static void WINAPI glReleaseShaderCompiler(void)
 {
     struct glReleaseShaderCompiler_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glReleaseShaderCompiler, &args ))) WARN( "glReleaseShaderCompiler returned %#lx\n", status );
+    UNIX_BATCH( glReleaseShaderCompiler, &args );
 }
 
 static void WINAPI glRenderGpuMaskNV( GLbitfield mask )
 {
     struct glRenderGpuMaskNV_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glRenderGpuMaskNV, &args ))) WARN( "glRenderGpuMaskNV returned %#lx\n", status );
+    UNIX_BATCH( glRenderGpuMaskNV, &args );
 }
 
 static void WINAPI glRenderbufferStorage( GLenum target, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glRenderbufferStorage_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, width %d, height %d\n", target, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorage, &args ))) WARN( "glRenderbufferStorage returned %#lx\n", status );
+    UNIX_BATCH( glRenderbufferStorage, &args );
 }
 
 static void WINAPI glRenderbufferStorageEXT( GLenum target, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glRenderbufferStorageEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, width %d, height %d\n", target, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageEXT, &args ))) WARN( "glRenderbufferStorageEXT returned %#lx\n", status );
+    UNIX_BATCH( glRenderbufferStorageEXT, &args );
 }
 
 static void WINAPI glRenderbufferStorageMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glRenderbufferStorageMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d\n", target, samples, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageMultisample, &args ))) WARN( "glRenderbufferStorageMultisample returned %#lx\n", status );
+    UNIX_BATCH( glRenderbufferStorageMultisample, &args );
 }
 
 static void WINAPI glRenderbufferStorageMultisampleAdvancedAMD( GLenum target, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glRenderbufferStorageMultisampleAdvancedAMD_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .storageSamples = storageSamples, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, storageSamples %d, internalformat %d, width %d, height %d\n", target, samples, storageSamples, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageMultisampleAdvancedAMD, &args ))) WARN( "glRenderbufferStorageMultisampleAdvancedAMD returned %#lx\n", status );
+    UNIX_BATCH( glRenderbufferStorageMultisampleAdvancedAMD, &args );
 }
 
 static void WINAPI glRenderbufferStorageMultisampleCoverageNV( GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glRenderbufferStorageMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, coverageSamples %d, colorSamples %d, internalformat %d, width %d, height %d\n", target, coverageSamples, colorSamples, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageMultisampleCoverageNV, &args ))) WARN( "glRenderbufferStorageMultisampleCoverageNV returned %#lx\n", status );
+    UNIX_BATCH( glRenderbufferStorageMultisampleCoverageNV, &args );
 }
 
 static void WINAPI glRenderbufferStorageMultisampleEXT( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glRenderbufferStorageMultisampleEXT_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d\n", target, samples, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageMultisampleEXT, &args ))) WARN( "glRenderbufferStorageMultisampleEXT returned %#lx\n", status );
+    UNIX_BATCH( glRenderbufferStorageMultisampleEXT, &args );
 }
 
 static void WINAPI glReplacementCodePointerSUN( GLenum type, GLsizei stride, const void **pointer )
@@ -17102,9 +16311,8 @@ static void WINAPI glReplacementCodePointerSUN( GLenum type, GLsizei stride, con
 static void WINAPI glReplacementCodeubSUN( GLubyte code )
 {
     struct glReplacementCodeubSUN_params args = { .teb = NtCurrentTeb(), .code = code };
-    NTSTATUS status;
     TRACE( "code %d\n", code );
-    if ((status = UNIX_CALL( glReplacementCodeubSUN, &args ))) WARN( "glReplacementCodeubSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeubSUN, &args );
 }
 
 static void WINAPI glReplacementCodeubvSUN( const GLubyte *code )
@@ -17118,9 +16326,8 @@ static void WINAPI glReplacementCodeubvSUN( const GLubyte *code )
 static void WINAPI glReplacementCodeuiColor3fVertex3fSUN( GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glReplacementCodeuiColor3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .r = r, .g = g, .b = b, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "rc %d, r %f, g %f, b %f, x %f, y %f, z %f\n", rc, r, g, b, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiColor3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiColor3fVertex3fSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiColor3fVertex3fvSUN( const GLuint *rc, const GLfloat *c, const GLfloat *v )
@@ -17134,9 +16341,8 @@ static void WINAPI glReplacementCodeuiColor3fVertex3fvSUN( const GLuint *rc, con
 static void WINAPI glReplacementCodeuiColor4fNormal3fVertex3fSUN( GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glReplacementCodeuiColor4fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "rc %d, r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", rc, r, g, b, a, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiColor4fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor4fNormal3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiColor4fNormal3fVertex3fSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiColor4fNormal3fVertex3fvSUN( const GLuint *rc, const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -17150,9 +16356,8 @@ static void WINAPI glReplacementCodeuiColor4fNormal3fVertex3fvSUN( const GLuint
 static void WINAPI glReplacementCodeuiColor4ubVertex3fSUN( GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glReplacementCodeuiColor4ubVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .r = r, .g = g, .b = b, .a = a, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "rc %d, r %d, g %d, b %d, a %d, x %f, y %f, z %f\n", rc, r, g, b, a, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiColor4ubVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor4ubVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiColor4ubVertex3fSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiColor4ubVertex3fvSUN( const GLuint *rc, const GLubyte *c, const GLfloat *v )
@@ -17166,9 +16371,8 @@ static void WINAPI glReplacementCodeuiColor4ubVertex3fvSUN( const GLuint *rc, co
 static void WINAPI glReplacementCodeuiNormal3fVertex3fSUN( GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glReplacementCodeuiNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "rc %d, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", rc, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiNormal3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiNormal3fVertex3fSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiNormal3fVertex3fvSUN( const GLuint *rc, const GLfloat *n, const GLfloat *v )
@@ -17182,17 +16386,15 @@ static void WINAPI glReplacementCodeuiNormal3fVertex3fvSUN( const GLuint *rc, co
 static void WINAPI glReplacementCodeuiSUN( GLuint code )
 {
     struct glReplacementCodeuiSUN_params args = { .teb = NtCurrentTeb(), .code = code };
-    NTSTATUS status;
     TRACE( "code %d\n", code );
-    if ((status = UNIX_CALL( glReplacementCodeuiSUN, &args ))) WARN( "glReplacementCodeuiSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN( GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .s = s, .t = t, .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "rc %d, s %f, t %f, r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", rc, s, t, r, g, b, a, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN( const GLuint *rc, const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -17206,9 +16408,8 @@ static void WINAPI glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN( con
 static void WINAPI glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN( GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .s = s, .t = t, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "rc %d, s %f, t %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", rc, s, t, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN( const GLuint *rc, const GLfloat *tc, const GLfloat *n, const GLfloat *v )
@@ -17222,9 +16423,8 @@ static void WINAPI glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN( const GLui
 static void WINAPI glReplacementCodeuiTexCoord2fVertex3fSUN( GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glReplacementCodeuiTexCoord2fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .s = s, .t = t, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "rc %d, s %f, t %f, x %f, y %f, z %f\n", rc, s, t, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiTexCoord2fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiTexCoord2fVertex3fSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiTexCoord2fVertex3fvSUN( const GLuint *rc, const GLfloat *tc, const GLfloat *v )
@@ -17238,9 +16438,8 @@ static void WINAPI glReplacementCodeuiTexCoord2fVertex3fvSUN( const GLuint *rc,
 static void WINAPI glReplacementCodeuiVertex3fSUN( GLuint rc, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glReplacementCodeuiVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "rc %d, x %f, y %f, z %f\n", rc, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiVertex3fSUN, &args ))) WARN( "glReplacementCodeuiVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeuiVertex3fSUN, &args );
 }
 
 static void WINAPI glReplacementCodeuiVertex3fvSUN( const GLuint *rc, const GLfloat *v )
@@ -17262,9 +16461,8 @@ static void WINAPI glReplacementCodeuivSUN( const GLuint *code )
 static void WINAPI glReplacementCodeusSUN( GLushort code )
 {
     struct glReplacementCodeusSUN_params args = { .teb = NtCurrentTeb(), .code = code };
-    NTSTATUS status;
     TRACE( "code %d\n", code );
-    if ((status = UNIX_CALL( glReplacementCodeusSUN, &args ))) WARN( "glReplacementCodeusSUN returned %#lx\n", status );
+    UNIX_BATCH( glReplacementCodeusSUN, &args );
 }
 
 static void WINAPI glReplacementCodeusvSUN( const GLushort *code )
@@ -17286,153 +16484,134 @@ static void WINAPI glRequestResidentProgramsNV( GLsizei n, const GLuint *program
 static void WINAPI glResetHistogram( GLenum target )
 {
     struct glResetHistogram_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glResetHistogram, &args ))) WARN( "glResetHistogram returned %#lx\n", status );
+    UNIX_BATCH( glResetHistogram, &args );
 }
 
 static void WINAPI glResetHistogramEXT( GLenum target )
 {
     struct glResetHistogramEXT_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glResetHistogramEXT, &args ))) WARN( "glResetHistogramEXT returned %#lx\n", status );
+    UNIX_BATCH( glResetHistogramEXT, &args );
 }
 
 static void WINAPI glResetMemoryObjectParameterNV( GLuint memory, GLenum pname )
 {
     struct glResetMemoryObjectParameterNV_params args = { .teb = NtCurrentTeb(), .memory = memory, .pname = pname };
-    NTSTATUS status;
     TRACE( "memory %d, pname %d\n", memory, pname );
-    if ((status = UNIX_CALL( glResetMemoryObjectParameterNV, &args ))) WARN( "glResetMemoryObjectParameterNV returned %#lx\n", status );
+    UNIX_BATCH( glResetMemoryObjectParameterNV, &args );
 }
 
 static void WINAPI glResetMinmax( GLenum target )
 {
     struct glResetMinmax_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glResetMinmax, &args ))) WARN( "glResetMinmax returned %#lx\n", status );
+    UNIX_BATCH( glResetMinmax, &args );
 }
 
 static void WINAPI glResetMinmaxEXT( GLenum target )
 {
     struct glResetMinmaxEXT_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glResetMinmaxEXT, &args ))) WARN( "glResetMinmaxEXT returned %#lx\n", status );
+    UNIX_BATCH( glResetMinmaxEXT, &args );
 }
 
 static void WINAPI glResizeBuffersMESA(void)
 {
     struct glResizeBuffersMESA_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glResizeBuffersMESA, &args ))) WARN( "glResizeBuffersMESA returned %#lx\n", status );
+    UNIX_BATCH( glResizeBuffersMESA, &args );
 }
 
 static void WINAPI glResolveDepthValuesNV(void)
 {
     struct glResolveDepthValuesNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glResolveDepthValuesNV, &args ))) WARN( "glResolveDepthValuesNV returned %#lx\n", status );
+    UNIX_BATCH( glResolveDepthValuesNV, &args );
 }
 
 static void WINAPI glResumeTransformFeedback(void)
 {
     struct glResumeTransformFeedback_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glResumeTransformFeedback, &args ))) WARN( "glResumeTransformFeedback returned %#lx\n", status );
+    UNIX_BATCH( glResumeTransformFeedback, &args );
 }
 
 static void WINAPI glResumeTransformFeedbackNV(void)
 {
     struct glResumeTransformFeedbackNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glResumeTransformFeedbackNV, &args ))) WARN( "glResumeTransformFeedbackNV returned %#lx\n", status );
+    UNIX_BATCH( glResumeTransformFeedbackNV, &args );
 }
 
 static void WINAPI glRotatexOES( GLfixed angle, GLfixed x, GLfixed y, GLfixed z )
 {
     struct glRotatexOES_params args = { .teb = NtCurrentTeb(), .angle = angle, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "angle %d, x %d, y %d, z %d\n", angle, x, y, z );
-    if ((status = UNIX_CALL( glRotatexOES, &args ))) WARN( "glRotatexOES returned %#lx\n", status );
+    UNIX_BATCH( glRotatexOES, &args );
 }
 
 static void WINAPI glSampleCoverage( GLfloat value, GLboolean invert )
 {
     struct glSampleCoverage_params args = { .teb = NtCurrentTeb(), .value = value, .invert = invert };
-    NTSTATUS status;
     TRACE( "value %f, invert %d\n", value, invert );
-    if ((status = UNIX_CALL( glSampleCoverage, &args ))) WARN( "glSampleCoverage returned %#lx\n", status );
+    UNIX_BATCH( glSampleCoverage, &args );
 }
 
 static void WINAPI glSampleCoverageARB( GLfloat value, GLboolean invert )
 {
     struct glSampleCoverageARB_params args = { .teb = NtCurrentTeb(), .value = value, .invert = invert };
-    NTSTATUS status;
     TRACE( "value %f, invert %d\n", value, invert );
-    if ((status = UNIX_CALL( glSampleCoverageARB, &args ))) WARN( "glSampleCoverageARB returned %#lx\n", status );
+    UNIX_BATCH( glSampleCoverageARB, &args );
 }
 
 static void WINAPI glSampleMapATI( GLuint dst, GLuint interp, GLenum swizzle )
 {
     struct glSampleMapATI_params args = { .teb = NtCurrentTeb(), .dst = dst, .interp = interp, .swizzle = swizzle };
-    NTSTATUS status;
     TRACE( "dst %d, interp %d, swizzle %d\n", dst, interp, swizzle );
-    if ((status = UNIX_CALL( glSampleMapATI, &args ))) WARN( "glSampleMapATI returned %#lx\n", status );
+    UNIX_BATCH( glSampleMapATI, &args );
 }
 
 static void WINAPI glSampleMaskEXT( GLclampf value, GLboolean invert )
 {
     struct glSampleMaskEXT_params args = { .teb = NtCurrentTeb(), .value = value, .invert = invert };
-    NTSTATUS status;
     TRACE( "value %f, invert %d\n", value, invert );
-    if ((status = UNIX_CALL( glSampleMaskEXT, &args ))) WARN( "glSampleMaskEXT returned %#lx\n", status );
+    UNIX_BATCH( glSampleMaskEXT, &args );
 }
 
 static void WINAPI glSampleMaskIndexedNV( GLuint index, GLbitfield mask )
 {
     struct glSampleMaskIndexedNV_params args = { .teb = NtCurrentTeb(), .index = index, .mask = mask };
-    NTSTATUS status;
     TRACE( "index %d, mask %d\n", index, mask );
-    if ((status = UNIX_CALL( glSampleMaskIndexedNV, &args ))) WARN( "glSampleMaskIndexedNV returned %#lx\n", status );
+    UNIX_BATCH( glSampleMaskIndexedNV, &args );
 }
 
 static void WINAPI glSampleMaskSGIS( GLclampf value, GLboolean invert )
 {
     struct glSampleMaskSGIS_params args = { .teb = NtCurrentTeb(), .value = value, .invert = invert };
-    NTSTATUS status;
     TRACE( "value %f, invert %d\n", value, invert );
-    if ((status = UNIX_CALL( glSampleMaskSGIS, &args ))) WARN( "glSampleMaskSGIS returned %#lx\n", status );
+    UNIX_BATCH( glSampleMaskSGIS, &args );
 }
 
 static void WINAPI glSampleMaski( GLuint maskNumber, GLbitfield mask )
 {
     struct glSampleMaski_params args = { .teb = NtCurrentTeb(), .maskNumber = maskNumber, .mask = mask };
-    NTSTATUS status;
     TRACE( "maskNumber %d, mask %d\n", maskNumber, mask );
-    if ((status = UNIX_CALL( glSampleMaski, &args ))) WARN( "glSampleMaski returned %#lx\n", status );
+    UNIX_BATCH( glSampleMaski, &args );
 }
 
 static void WINAPI glSamplePatternEXT( GLenum pattern )
 {
     struct glSamplePatternEXT_params args = { .teb = NtCurrentTeb(), .pattern = pattern };
-    NTSTATUS status;
     TRACE( "pattern %d\n", pattern );
-    if ((status = UNIX_CALL( glSamplePatternEXT, &args ))) WARN( "glSamplePatternEXT returned %#lx\n", status );
+    UNIX_BATCH( glSamplePatternEXT, &args );
 }
 
 static void WINAPI glSamplePatternSGIS( GLenum pattern )
 {
     struct glSamplePatternSGIS_params args = { .teb = NtCurrentTeb(), .pattern = pattern };
-    NTSTATUS status;
     TRACE( "pattern %d\n", pattern );
-    if ((status = UNIX_CALL( glSamplePatternSGIS, &args ))) WARN( "glSamplePatternSGIS returned %#lx\n", status );
+    UNIX_BATCH( glSamplePatternSGIS, &args );
 }
 
 static void WINAPI glSamplerParameterIiv( GLuint sampler, GLenum pname, const GLint *param )
@@ -17454,9 +16633,8 @@ static void WINAPI glSamplerParameterIuiv( GLuint sampler, GLenum pname, const G
 static void WINAPI glSamplerParameterf( GLuint sampler, GLenum pname, GLfloat param )
 {
     struct glSamplerParameterf_params args = { .teb = NtCurrentTeb(), .sampler = sampler, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "sampler %d, pname %d, param %f\n", sampler, pname, param );
-    if ((status = UNIX_CALL( glSamplerParameterf, &args ))) WARN( "glSamplerParameterf returned %#lx\n", status );
+    UNIX_BATCH( glSamplerParameterf, &args );
 }
 
 static void WINAPI glSamplerParameterfv( GLuint sampler, GLenum pname, const GLfloat *param )
@@ -17470,9 +16648,8 @@ static void WINAPI glSamplerParameterfv( GLuint sampler, GLenum pname, const GLf
 static void WINAPI glSamplerParameteri( GLuint sampler, GLenum pname, GLint param )
 {
     struct glSamplerParameteri_params args = { .teb = NtCurrentTeb(), .sampler = sampler, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "sampler %d, pname %d, param %d\n", sampler, pname, param );
-    if ((status = UNIX_CALL( glSamplerParameteri, &args ))) WARN( "glSamplerParameteri returned %#lx\n", status );
+    UNIX_BATCH( glSamplerParameteri, &args );
 }
 
 static void WINAPI glSamplerParameteriv( GLuint sampler, GLenum pname, const GLint *param )
@@ -17486,9 +16663,8 @@ static void WINAPI glSamplerParameteriv( GLuint sampler, GLenum pname, const GLi
 static void WINAPI glScalexOES( GLfixed x, GLfixed y, GLfixed z )
 {
     struct glScalexOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glScalexOES, &args ))) WARN( "glScalexOES returned %#lx\n", status );
+    UNIX_BATCH( glScalexOES, &args );
 }
 
 static void WINAPI glScissorArrayv( GLuint first, GLsizei count, const GLint *v )
@@ -17510,17 +16686,15 @@ static void WINAPI glScissorExclusiveArrayvNV( GLuint first, GLsizei count, cons
 static void WINAPI glScissorExclusiveNV( GLint x, GLint y, GLsizei width, GLsizei height )
 {
     struct glScissorExclusiveNV_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "x %d, y %d, width %d, height %d\n", x, y, width, height );
-    if ((status = UNIX_CALL( glScissorExclusiveNV, &args ))) WARN( "glScissorExclusiveNV returned %#lx\n", status );
+    UNIX_BATCH( glScissorExclusiveNV, &args );
 }
 
 static void WINAPI glScissorIndexed( GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height )
 {
     struct glScissorIndexed_params args = { .teb = NtCurrentTeb(), .index = index, .left = left, .bottom = bottom, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "index %d, left %d, bottom %d, width %d, height %d\n", index, left, bottom, width, height );
-    if ((status = UNIX_CALL( glScissorIndexed, &args ))) WARN( "glScissorIndexed returned %#lx\n", status );
+    UNIX_BATCH( glScissorIndexed, &args );
 }
 
 static void WINAPI glScissorIndexedv( GLuint index, const GLint *v )
@@ -17534,17 +16708,15 @@ static void WINAPI glScissorIndexedv( GLuint index, const GLint *v )
 static void WINAPI glSecondaryColor3b( GLbyte red, GLbyte green, GLbyte blue )
 {
     struct glSecondaryColor3b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3b, &args ))) WARN( "glSecondaryColor3b returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3b, &args );
 }
 
 static void WINAPI glSecondaryColor3bEXT( GLbyte red, GLbyte green, GLbyte blue )
 {
     struct glSecondaryColor3bEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3bEXT, &args ))) WARN( "glSecondaryColor3bEXT returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3bEXT, &args );
 }
 
 static void WINAPI glSecondaryColor3bv( const GLbyte *v )
@@ -17566,17 +16738,15 @@ static void WINAPI glSecondaryColor3bvEXT( const GLbyte *v )
 static void WINAPI glSecondaryColor3d( GLdouble red, GLdouble green, GLdouble blue )
 {
     struct glSecondaryColor3d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3d, &args ))) WARN( "glSecondaryColor3d returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3d, &args );
 }
 
 static void WINAPI glSecondaryColor3dEXT( GLdouble red, GLdouble green, GLdouble blue )
 {
     struct glSecondaryColor3dEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3dEXT, &args ))) WARN( "glSecondaryColor3dEXT returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3dEXT, &args );
 }
 
 static void WINAPI glSecondaryColor3dv( const GLdouble *v )
@@ -17598,17 +16768,15 @@ static void WINAPI glSecondaryColor3dvEXT( const GLdouble *v )
 static void WINAPI glSecondaryColor3f( GLfloat red, GLfloat green, GLfloat blue )
 {
     struct glSecondaryColor3f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3f, &args ))) WARN( "glSecondaryColor3f returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3f, &args );
 }
 
 static void WINAPI glSecondaryColor3fEXT( GLfloat red, GLfloat green, GLfloat blue )
 {
     struct glSecondaryColor3fEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3fEXT, &args ))) WARN( "glSecondaryColor3fEXT returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3fEXT, &args );
 }
 
 static void WINAPI glSecondaryColor3fv( const GLfloat *v )
@@ -17630,9 +16798,8 @@ static void WINAPI glSecondaryColor3fvEXT( const GLfloat *v )
 static void WINAPI glSecondaryColor3hNV( GLhalfNV red, GLhalfNV green, GLhalfNV blue )
 {
     struct glSecondaryColor3hNV_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3hNV, &args ))) WARN( "glSecondaryColor3hNV returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3hNV, &args );
 }
 
 static void WINAPI glSecondaryColor3hvNV( const GLhalfNV *v )
@@ -17646,17 +16813,15 @@ static void WINAPI glSecondaryColor3hvNV( const GLhalfNV *v )
 static void WINAPI glSecondaryColor3i( GLint red, GLint green, GLint blue )
 {
     struct glSecondaryColor3i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3i, &args ))) WARN( "glSecondaryColor3i returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3i, &args );
 }
 
 static void WINAPI glSecondaryColor3iEXT( GLint red, GLint green, GLint blue )
 {
     struct glSecondaryColor3iEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3iEXT, &args ))) WARN( "glSecondaryColor3iEXT returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3iEXT, &args );
 }
 
 static void WINAPI glSecondaryColor3iv( const GLint *v )
@@ -17678,17 +16843,15 @@ static void WINAPI glSecondaryColor3ivEXT( const GLint *v )
 static void WINAPI glSecondaryColor3s( GLshort red, GLshort green, GLshort blue )
 {
     struct glSecondaryColor3s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3s, &args ))) WARN( "glSecondaryColor3s returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3s, &args );
 }
 
 static void WINAPI glSecondaryColor3sEXT( GLshort red, GLshort green, GLshort blue )
 {
     struct glSecondaryColor3sEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3sEXT, &args ))) WARN( "glSecondaryColor3sEXT returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3sEXT, &args );
 }
 
 static void WINAPI glSecondaryColor3sv( const GLshort *v )
@@ -17710,17 +16873,15 @@ static void WINAPI glSecondaryColor3svEXT( const GLshort *v )
 static void WINAPI glSecondaryColor3ub( GLubyte red, GLubyte green, GLubyte blue )
 {
     struct glSecondaryColor3ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3ub, &args ))) WARN( "glSecondaryColor3ub returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3ub, &args );
 }
 
 static void WINAPI glSecondaryColor3ubEXT( GLubyte red, GLubyte green, GLubyte blue )
 {
     struct glSecondaryColor3ubEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3ubEXT, &args ))) WARN( "glSecondaryColor3ubEXT returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3ubEXT, &args );
 }
 
 static void WINAPI glSecondaryColor3ubv( const GLubyte *v )
@@ -17742,17 +16903,15 @@ static void WINAPI glSecondaryColor3ubvEXT( const GLubyte *v )
 static void WINAPI glSecondaryColor3ui( GLuint red, GLuint green, GLuint blue )
 {
     struct glSecondaryColor3ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3ui, &args ))) WARN( "glSecondaryColor3ui returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3ui, &args );
 }
 
 static void WINAPI glSecondaryColor3uiEXT( GLuint red, GLuint green, GLuint blue )
 {
     struct glSecondaryColor3uiEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3uiEXT, &args ))) WARN( "glSecondaryColor3uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3uiEXT, &args );
 }
 
 static void WINAPI glSecondaryColor3uiv( const GLuint *v )
@@ -17774,17 +16933,15 @@ static void WINAPI glSecondaryColor3uivEXT( const GLuint *v )
 static void WINAPI glSecondaryColor3us( GLushort red, GLushort green, GLushort blue )
 {
     struct glSecondaryColor3us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3us, &args ))) WARN( "glSecondaryColor3us returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3us, &args );
 }
 
 static void WINAPI glSecondaryColor3usEXT( GLushort red, GLushort green, GLushort blue )
 {
     struct glSecondaryColor3usEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3usEXT, &args ))) WARN( "glSecondaryColor3usEXT returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColor3usEXT, &args );
 }
 
 static void WINAPI glSecondaryColor3usv( const GLushort *v )
@@ -17806,17 +16963,15 @@ static void WINAPI glSecondaryColor3usvEXT( const GLushort *v )
 static void WINAPI glSecondaryColorFormatNV( GLint size, GLenum type, GLsizei stride )
 {
     struct glSecondaryColorFormatNV_params args = { .teb = NtCurrentTeb(), .size = size, .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "size %d, type %d, stride %d\n", size, type, stride );
-    if ((status = UNIX_CALL( glSecondaryColorFormatNV, &args ))) WARN( "glSecondaryColorFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColorFormatNV, &args );
 }
 
 static void WINAPI glSecondaryColorP3ui( GLenum type, GLuint color )
 {
     struct glSecondaryColorP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .color = color };
-    NTSTATUS status;
     TRACE( "type %d, color %d\n", type, color );
-    if ((status = UNIX_CALL( glSecondaryColorP3ui, &args ))) WARN( "glSecondaryColorP3ui returned %#lx\n", status );
+    UNIX_BATCH( glSecondaryColorP3ui, &args );
 }
 
 static void WINAPI glSecondaryColorP3uiv( GLenum type, const GLuint *color )
@@ -17862,17 +17017,15 @@ static void WINAPI glSelectPerfMonitorCountersAMD( GLuint monitor, GLboolean ena
 static void WINAPI glSelectTextureCoordSetSGIS( GLenum target )
 {
     struct glSelectTextureCoordSetSGIS_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glSelectTextureCoordSetSGIS, &args ))) WARN( "glSelectTextureCoordSetSGIS returned %#lx\n", status );
+    UNIX_BATCH( glSelectTextureCoordSetSGIS, &args );
 }
 
 static void WINAPI glSelectTextureSGIS( GLenum target )
 {
     struct glSelectTextureSGIS_params args = { .teb = NtCurrentTeb(), .target = target };
-    NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glSelectTextureSGIS, &args ))) WARN( "glSelectTextureSGIS returned %#lx\n", status );
+    UNIX_BATCH( glSelectTextureSGIS, &args );
 }
 
 static void WINAPI glSemaphoreParameterui64vEXT( GLuint semaphore, GLenum pname, const GLuint64 *params )
@@ -17902,17 +17055,15 @@ static void WINAPI glSeparableFilter2DEXT( GLenum target, GLenum internalformat,
 static void WINAPI glSetFenceAPPLE( GLuint fence )
 {
     struct glSetFenceAPPLE_params args = { .teb = NtCurrentTeb(), .fence = fence };
-    NTSTATUS status;
     TRACE( "fence %d\n", fence );
-    if ((status = UNIX_CALL( glSetFenceAPPLE, &args ))) WARN( "glSetFenceAPPLE returned %#lx\n", status );
+    UNIX_BATCH( glSetFenceAPPLE, &args );
 }
 
 static void WINAPI glSetFenceNV( GLuint fence, GLenum condition )
 {
     struct glSetFenceNV_params args = { .teb = NtCurrentTeb(), .fence = fence, .condition = condition };
-    NTSTATUS status;
     TRACE( "fence %d, condition %d\n", fence, condition );
-    if ((status = UNIX_CALL( glSetFenceNV, &args ))) WARN( "glSetFenceNV returned %#lx\n", status );
+    UNIX_BATCH( glSetFenceNV, &args );
 }
 
 static void WINAPI glSetFragmentShaderConstantATI( GLuint dst, const GLfloat *value )
@@ -17958,41 +17109,36 @@ static void WINAPI glShaderBinary( GLsizei count, const GLuint *shaders, GLenum
 static void WINAPI glShaderOp1EXT( GLenum op, GLuint res, GLuint arg1 )
 {
     struct glShaderOp1EXT_params args = { .teb = NtCurrentTeb(), .op = op, .res = res, .arg1 = arg1 };
-    NTSTATUS status;
     TRACE( "op %d, res %d, arg1 %d\n", op, res, arg1 );
-    if ((status = UNIX_CALL( glShaderOp1EXT, &args ))) WARN( "glShaderOp1EXT returned %#lx\n", status );
+    UNIX_BATCH( glShaderOp1EXT, &args );
 }
 
 static void WINAPI glShaderOp2EXT( GLenum op, GLuint res, GLuint arg1, GLuint arg2 )
 {
     struct glShaderOp2EXT_params args = { .teb = NtCurrentTeb(), .op = op, .res = res, .arg1 = arg1, .arg2 = arg2 };
-    NTSTATUS status;
     TRACE( "op %d, res %d, arg1 %d, arg2 %d\n", op, res, arg1, arg2 );
-    if ((status = UNIX_CALL( glShaderOp2EXT, &args ))) WARN( "glShaderOp2EXT returned %#lx\n", status );
+    UNIX_BATCH( glShaderOp2EXT, &args );
 }
 
 static void WINAPI glShaderOp3EXT( GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3 )
 {
     struct glShaderOp3EXT_params args = { .teb = NtCurrentTeb(), .op = op, .res = res, .arg1 = arg1, .arg2 = arg2, .arg3 = arg3 };
-    NTSTATUS status;
     TRACE( "op %d, res %d, arg1 %d, arg2 %d, arg3 %d\n", op, res, arg1, arg2, arg3 );
-    if ((status = UNIX_CALL( glShaderOp3EXT, &args ))) WARN( "glShaderOp3EXT returned %#lx\n", status );
+    UNIX_BATCH( glShaderOp3EXT, &args );
 }
 
 static void WINAPI glShaderStorageBlockBinding( GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding )
 {
     struct glShaderStorageBlockBinding_params args = { .teb = NtCurrentTeb(), .program = program, .storageBlockIndex = storageBlockIndex, .storageBlockBinding = storageBlockBinding };
-    NTSTATUS status;
     TRACE( "program %d, storageBlockIndex %d, storageBlockBinding %d\n", program, storageBlockIndex, storageBlockBinding );
-    if ((status = UNIX_CALL( glShaderStorageBlockBinding, &args ))) WARN( "glShaderStorageBlockBinding returned %#lx\n", status );
+    UNIX_BATCH( glShaderStorageBlockBinding, &args );
 }
 
 static void WINAPI glShadingRateImageBarrierNV( GLboolean synchronize )
 {
     struct glShadingRateImageBarrierNV_params args = { .teb = NtCurrentTeb(), .synchronize = synchronize };
-    NTSTATUS status;
     TRACE( "synchronize %d\n", synchronize );
-    if ((status = UNIX_CALL( glShadingRateImageBarrierNV, &args ))) WARN( "glShadingRateImageBarrierNV returned %#lx\n", status );
+    UNIX_BATCH( glShadingRateImageBarrierNV, &args );
 }
 
 static void WINAPI glShadingRateImagePaletteNV( GLuint viewport, GLuint first, GLsizei count, const GLenum *rates )
@@ -18014,9 +17160,8 @@ static void WINAPI glShadingRateSampleOrderCustomNV( GLenum rate, GLuint samples
 static void WINAPI glShadingRateSampleOrderNV( GLenum order )
 {
     struct glShadingRateSampleOrderNV_params args = { .teb = NtCurrentTeb(), .order = order };
-    NTSTATUS status;
     TRACE( "order %d\n", order );
-    if ((status = UNIX_CALL( glShadingRateSampleOrderNV, &args ))) WARN( "glShadingRateSampleOrderNV returned %#lx\n", status );
+    UNIX_BATCH( glShadingRateSampleOrderNV, &args );
 }
 
 static void WINAPI glSharpenTexFuncSGIS( GLenum target, GLsizei n, const GLfloat *points )
@@ -18046,17 +17191,15 @@ static void WINAPI glSignalSemaphoreui64NVX( GLuint signalGpu, GLsizei fenceObje
 static void WINAPI glSignalVkFenceNV( GLuint64 vkFence )
 {
     struct glSignalVkFenceNV_params args = { .teb = NtCurrentTeb(), .vkFence = vkFence };
-    NTSTATUS status;
     TRACE( "vkFence %s\n", wine_dbgstr_longlong(vkFence) );
-    if ((status = UNIX_CALL( glSignalVkFenceNV, &args ))) WARN( "glSignalVkFenceNV returned %#lx\n", status );
+    UNIX_BATCH( glSignalVkFenceNV, &args );
 }
 
 static void WINAPI glSignalVkSemaphoreNV( GLuint64 vkSemaphore )
 {
     struct glSignalVkSemaphoreNV_params args = { .teb = NtCurrentTeb(), .vkSemaphore = vkSemaphore };
-    NTSTATUS status;
     TRACE( "vkSemaphore %s\n", wine_dbgstr_longlong(vkSemaphore) );
-    if ((status = UNIX_CALL( glSignalVkSemaphoreNV, &args ))) WARN( "glSignalVkSemaphoreNV returned %#lx\n", status );
+    UNIX_BATCH( glSignalVkSemaphoreNV, &args );
 }
 
 static void WINAPI glSpecializeShader( GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue )
@@ -18078,9 +17221,8 @@ static void WINAPI glSpecializeShaderARB( GLuint shader, const GLchar *pEntryPoi
 static void WINAPI glSpriteParameterfSGIX( GLenum pname, GLfloat param )
 {
     struct glSpriteParameterfSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glSpriteParameterfSGIX, &args ))) WARN( "glSpriteParameterfSGIX returned %#lx\n", status );
+    UNIX_BATCH( glSpriteParameterfSGIX, &args );
 }
 
 static void WINAPI glSpriteParameterfvSGIX( GLenum pname, const GLfloat *params )
@@ -18094,9 +17236,8 @@ static void WINAPI glSpriteParameterfvSGIX( GLenum pname, const GLfloat *params
 static void WINAPI glSpriteParameteriSGIX( GLenum pname, GLint param )
 {
     struct glSpriteParameteriSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glSpriteParameteriSGIX, &args ))) WARN( "glSpriteParameteriSGIX returned %#lx\n", status );
+    UNIX_BATCH( glSpriteParameteriSGIX, &args );
 }
 
 static void WINAPI glSpriteParameterivSGIX( GLenum pname, const GLint *params )
@@ -18110,25 +17251,22 @@ static void WINAPI glSpriteParameterivSGIX( GLenum pname, const GLint *params )
 static void WINAPI glStartInstrumentsSGIX(void)
 {
     struct glStartInstrumentsSGIX_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glStartInstrumentsSGIX, &args ))) WARN( "glStartInstrumentsSGIX returned %#lx\n", status );
+    UNIX_BATCH( glStartInstrumentsSGIX, &args );
 }
 
 static void WINAPI glStateCaptureNV( GLuint state, GLenum mode )
 {
     struct glStateCaptureNV_params args = { .teb = NtCurrentTeb(), .state = state, .mode = mode };
-    NTSTATUS status;
     TRACE( "state %d, mode %d\n", state, mode );
-    if ((status = UNIX_CALL( glStateCaptureNV, &args ))) WARN( "glStateCaptureNV returned %#lx\n", status );
+    UNIX_BATCH( glStateCaptureNV, &args );
 }
 
 static void WINAPI glStencilClearTagEXT( GLsizei stencilTagBits, GLuint stencilClearTag )
 {
     struct glStencilClearTagEXT_params args = { .teb = NtCurrentTeb(), .stencilTagBits = stencilTagBits, .stencilClearTag = stencilClearTag };
-    NTSTATUS status;
     TRACE( "stencilTagBits %d, stencilClearTag %d\n", stencilTagBits, stencilClearTag );
-    if ((status = UNIX_CALL( glStencilClearTagEXT, &args ))) WARN( "glStencilClearTagEXT returned %#lx\n", status );
+    UNIX_BATCH( glStencilClearTagEXT, &args );
 }
 
 static void WINAPI glStencilFillPathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues )
@@ -18142,57 +17280,50 @@ static void WINAPI glStencilFillPathInstancedNV( GLsizei numPaths, GLenum pathNa
 static void WINAPI glStencilFillPathNV( GLuint path, GLenum fillMode, GLuint mask )
 {
     struct glStencilFillPathNV_params args = { .teb = NtCurrentTeb(), .path = path, .fillMode = fillMode, .mask = mask };
-    NTSTATUS status;
     TRACE( "path %d, fillMode %d, mask %d\n", path, fillMode, mask );
-    if ((status = UNIX_CALL( glStencilFillPathNV, &args ))) WARN( "glStencilFillPathNV returned %#lx\n", status );
+    UNIX_BATCH( glStencilFillPathNV, &args );
 }
 
 static void WINAPI glStencilFuncSeparate( GLenum face, GLenum func, GLint ref, GLuint mask )
 {
     struct glStencilFuncSeparate_params args = { .teb = NtCurrentTeb(), .face = face, .func = func, .ref = ref, .mask = mask };
-    NTSTATUS status;
     TRACE( "face %d, func %d, ref %d, mask %d\n", face, func, ref, mask );
-    if ((status = UNIX_CALL( glStencilFuncSeparate, &args ))) WARN( "glStencilFuncSeparate returned %#lx\n", status );
+    UNIX_BATCH( glStencilFuncSeparate, &args );
 }
 
 static void WINAPI glStencilFuncSeparateATI( GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask )
 {
     struct glStencilFuncSeparateATI_params args = { .teb = NtCurrentTeb(), .frontfunc = frontfunc, .backfunc = backfunc, .ref = ref, .mask = mask };
-    NTSTATUS status;
     TRACE( "frontfunc %d, backfunc %d, ref %d, mask %d\n", frontfunc, backfunc, ref, mask );
-    if ((status = UNIX_CALL( glStencilFuncSeparateATI, &args ))) WARN( "glStencilFuncSeparateATI returned %#lx\n", status );
+    UNIX_BATCH( glStencilFuncSeparateATI, &args );
 }
 
 static void WINAPI glStencilMaskSeparate( GLenum face, GLuint mask )
 {
     struct glStencilMaskSeparate_params args = { .teb = NtCurrentTeb(), .face = face, .mask = mask };
-    NTSTATUS status;
     TRACE( "face %d, mask %d\n", face, mask );
-    if ((status = UNIX_CALL( glStencilMaskSeparate, &args ))) WARN( "glStencilMaskSeparate returned %#lx\n", status );
+    UNIX_BATCH( glStencilMaskSeparate, &args );
 }
 
 static void WINAPI glStencilOpSeparate( GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass )
 {
     struct glStencilOpSeparate_params args = { .teb = NtCurrentTeb(), .face = face, .sfail = sfail, .dpfail = dpfail, .dppass = dppass };
-    NTSTATUS status;
     TRACE( "face %d, sfail %d, dpfail %d, dppass %d\n", face, sfail, dpfail, dppass );
-    if ((status = UNIX_CALL( glStencilOpSeparate, &args ))) WARN( "glStencilOpSeparate returned %#lx\n", status );
+    UNIX_BATCH( glStencilOpSeparate, &args );
 }
 
 static void WINAPI glStencilOpSeparateATI( GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass )
 {
     struct glStencilOpSeparateATI_params args = { .teb = NtCurrentTeb(), .face = face, .sfail = sfail, .dpfail = dpfail, .dppass = dppass };
-    NTSTATUS status;
     TRACE( "face %d, sfail %d, dpfail %d, dppass %d\n", face, sfail, dpfail, dppass );
-    if ((status = UNIX_CALL( glStencilOpSeparateATI, &args ))) WARN( "glStencilOpSeparateATI returned %#lx\n", status );
+    UNIX_BATCH( glStencilOpSeparateATI, &args );
 }
 
 static void WINAPI glStencilOpValueAMD( GLenum face, GLuint value )
 {
     struct glStencilOpValueAMD_params args = { .teb = NtCurrentTeb(), .face = face, .value = value };
-    NTSTATUS status;
     TRACE( "face %d, value %d\n", face, value );
-    if ((status = UNIX_CALL( glStencilOpValueAMD, &args ))) WARN( "glStencilOpValueAMD returned %#lx\n", status );
+    UNIX_BATCH( glStencilOpValueAMD, &args );
 }
 
 static void WINAPI glStencilStrokePathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues )
@@ -18206,9 +17337,8 @@ static void WINAPI glStencilStrokePathInstancedNV( GLsizei numPaths, GLenum path
 static void WINAPI glStencilStrokePathNV( GLuint path, GLint reference, GLuint mask )
 {
     struct glStencilStrokePathNV_params args = { .teb = NtCurrentTeb(), .path = path, .reference = reference, .mask = mask };
-    NTSTATUS status;
     TRACE( "path %d, reference %d, mask %d\n", path, reference, mask );
-    if ((status = UNIX_CALL( glStencilStrokePathNV, &args ))) WARN( "glStencilStrokePathNV returned %#lx\n", status );
+    UNIX_BATCH( glStencilStrokePathNV, &args );
 }
 
 static void WINAPI glStencilThenCoverFillPathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues )
@@ -18222,9 +17352,8 @@ static void WINAPI glStencilThenCoverFillPathInstancedNV( GLsizei numPaths, GLen
 static void WINAPI glStencilThenCoverFillPathNV( GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode )
 {
     struct glStencilThenCoverFillPathNV_params args = { .teb = NtCurrentTeb(), .path = path, .fillMode = fillMode, .mask = mask, .coverMode = coverMode };
-    NTSTATUS status;
     TRACE( "path %d, fillMode %d, mask %d, coverMode %d\n", path, fillMode, mask, coverMode );
-    if ((status = UNIX_CALL( glStencilThenCoverFillPathNV, &args ))) WARN( "glStencilThenCoverFillPathNV returned %#lx\n", status );
+    UNIX_BATCH( glStencilThenCoverFillPathNV, &args );
 }
 
 static void WINAPI glStencilThenCoverStrokePathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues )
@@ -18238,17 +17367,15 @@ static void WINAPI glStencilThenCoverStrokePathInstancedNV( GLsizei numPaths, GL
 static void WINAPI glStencilThenCoverStrokePathNV( GLuint path, GLint reference, GLuint mask, GLenum coverMode )
 {
     struct glStencilThenCoverStrokePathNV_params args = { .teb = NtCurrentTeb(), .path = path, .reference = reference, .mask = mask, .coverMode = coverMode };
-    NTSTATUS status;
     TRACE( "path %d, reference %d, mask %d, coverMode %d\n", path, reference, mask, coverMode );
-    if ((status = UNIX_CALL( glStencilThenCoverStrokePathNV, &args ))) WARN( "glStencilThenCoverStrokePathNV returned %#lx\n", status );
+    UNIX_BATCH( glStencilThenCoverStrokePathNV, &args );
 }
 
 static void WINAPI glStopInstrumentsSGIX( GLint marker )
 {
     struct glStopInstrumentsSGIX_params args = { .teb = NtCurrentTeb(), .marker = marker };
-    NTSTATUS status;
     TRACE( "marker %d\n", marker );
-    if ((status = UNIX_CALL( glStopInstrumentsSGIX, &args ))) WARN( "glStopInstrumentsSGIX returned %#lx\n", status );
+    UNIX_BATCH( glStopInstrumentsSGIX, &args );
 }
 
 static void WINAPI glStringMarkerGREMEDY( GLsizei len, const void *string )
@@ -18262,41 +17389,36 @@ static void WINAPI glStringMarkerGREMEDY( GLsizei len, const void *string )
 static void WINAPI glSubpixelPrecisionBiasNV( GLuint xbits, GLuint ybits )
 {
     struct glSubpixelPrecisionBiasNV_params args = { .teb = NtCurrentTeb(), .xbits = xbits, .ybits = ybits };
-    NTSTATUS status;
     TRACE( "xbits %d, ybits %d\n", xbits, ybits );
-    if ((status = UNIX_CALL( glSubpixelPrecisionBiasNV, &args ))) WARN( "glSubpixelPrecisionBiasNV returned %#lx\n", status );
+    UNIX_BATCH( glSubpixelPrecisionBiasNV, &args );
 }
 
 static void WINAPI glSwizzleEXT( GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW )
 {
     struct glSwizzleEXT_params args = { .teb = NtCurrentTeb(), .res = res, .in = in, .outX = outX, .outY = outY, .outZ = outZ, .outW = outW };
-    NTSTATUS status;
     TRACE( "res %d, in %d, outX %d, outY %d, outZ %d, outW %d\n", res, in, outX, outY, outZ, outW );
-    if ((status = UNIX_CALL( glSwizzleEXT, &args ))) WARN( "glSwizzleEXT returned %#lx\n", status );
+    UNIX_BATCH( glSwizzleEXT, &args );
 }
 
 static void WINAPI glSyncTextureINTEL( GLuint texture )
 {
     struct glSyncTextureINTEL_params args = { .teb = NtCurrentTeb(), .texture = texture };
-    NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glSyncTextureINTEL, &args ))) WARN( "glSyncTextureINTEL returned %#lx\n", status );
+    UNIX_BATCH( glSyncTextureINTEL, &args );
 }
 
 static void WINAPI glTagSampleBufferSGIX(void)
 {
     struct glTagSampleBufferSGIX_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glTagSampleBufferSGIX, &args ))) WARN( "glTagSampleBufferSGIX returned %#lx\n", status );
+    UNIX_BATCH( glTagSampleBufferSGIX, &args );
 }
 
 static void WINAPI glTangent3bEXT( GLbyte tx, GLbyte ty, GLbyte tz )
 {
     struct glTangent3bEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
-    NTSTATUS status;
     TRACE( "tx %d, ty %d, tz %d\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3bEXT, &args ))) WARN( "glTangent3bEXT returned %#lx\n", status );
+    UNIX_BATCH( glTangent3bEXT, &args );
 }
 
 static void WINAPI glTangent3bvEXT( const GLbyte *v )
@@ -18310,9 +17432,8 @@ static void WINAPI glTangent3bvEXT( const GLbyte *v )
 static void WINAPI glTangent3dEXT( GLdouble tx, GLdouble ty, GLdouble tz )
 {
     struct glTangent3dEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
-    NTSTATUS status;
     TRACE( "tx %f, ty %f, tz %f\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3dEXT, &args ))) WARN( "glTangent3dEXT returned %#lx\n", status );
+    UNIX_BATCH( glTangent3dEXT, &args );
 }
 
 static void WINAPI glTangent3dvEXT( const GLdouble *v )
@@ -18326,9 +17447,8 @@ static void WINAPI glTangent3dvEXT( const GLdouble *v )
 static void WINAPI glTangent3fEXT( GLfloat tx, GLfloat ty, GLfloat tz )
 {
     struct glTangent3fEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
-    NTSTATUS status;
     TRACE( "tx %f, ty %f, tz %f\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3fEXT, &args ))) WARN( "glTangent3fEXT returned %#lx\n", status );
+    UNIX_BATCH( glTangent3fEXT, &args );
 }
 
 static void WINAPI glTangent3fvEXT( const GLfloat *v )
@@ -18342,9 +17462,8 @@ static void WINAPI glTangent3fvEXT( const GLfloat *v )
 static void WINAPI glTangent3iEXT( GLint tx, GLint ty, GLint tz )
 {
     struct glTangent3iEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
-    NTSTATUS status;
     TRACE( "tx %d, ty %d, tz %d\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3iEXT, &args ))) WARN( "glTangent3iEXT returned %#lx\n", status );
+    UNIX_BATCH( glTangent3iEXT, &args );
 }
 
 static void WINAPI glTangent3ivEXT( const GLint *v )
@@ -18358,9 +17477,8 @@ static void WINAPI glTangent3ivEXT( const GLint *v )
 static void WINAPI glTangent3sEXT( GLshort tx, GLshort ty, GLshort tz )
 {
     struct glTangent3sEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
-    NTSTATUS status;
     TRACE( "tx %d, ty %d, tz %d\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3sEXT, &args ))) WARN( "glTangent3sEXT returned %#lx\n", status );
+    UNIX_BATCH( glTangent3sEXT, &args );
 }
 
 static void WINAPI glTangent3svEXT( const GLshort *v )
@@ -18382,25 +17500,22 @@ static void WINAPI glTangentPointerEXT( GLenum type, GLsizei stride, const void
 static void WINAPI glTbufferMask3DFX( GLuint mask )
 {
     struct glTbufferMask3DFX_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glTbufferMask3DFX, &args ))) WARN( "glTbufferMask3DFX returned %#lx\n", status );
+    UNIX_BATCH( glTbufferMask3DFX, &args );
 }
 
 static void WINAPI glTessellationFactorAMD( GLfloat factor )
 {
     struct glTessellationFactorAMD_params args = { .teb = NtCurrentTeb(), .factor = factor };
-    NTSTATUS status;
     TRACE( "factor %f\n", factor );
-    if ((status = UNIX_CALL( glTessellationFactorAMD, &args ))) WARN( "glTessellationFactorAMD returned %#lx\n", status );
+    UNIX_BATCH( glTessellationFactorAMD, &args );
 }
 
 static void WINAPI glTessellationModeAMD( GLenum mode )
 {
     struct glTessellationModeAMD_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glTessellationModeAMD, &args ))) WARN( "glTessellationModeAMD returned %#lx\n", status );
+    UNIX_BATCH( glTessellationModeAMD, &args );
 }
 
 static GLboolean WINAPI glTestFenceAPPLE( GLuint fence )
@@ -18433,33 +17548,29 @@ static GLboolean WINAPI glTestObjectAPPLE( GLenum object, GLuint name )
 static void WINAPI glTexAttachMemoryNV( GLenum target, GLuint memory, GLuint64 offset )
 {
     struct glTexAttachMemoryNV_params args = { .teb = NtCurrentTeb(), .target = target, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "target %d, memory %d, offset %s\n", target, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexAttachMemoryNV, &args ))) WARN( "glTexAttachMemoryNV returned %#lx\n", status );
+    UNIX_BATCH( glTexAttachMemoryNV, &args );
 }
 
 static void WINAPI glTexBuffer( GLenum target, GLenum internalformat, GLuint buffer )
 {
     struct glTexBuffer_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, buffer %d\n", target, internalformat, buffer );
-    if ((status = UNIX_CALL( glTexBuffer, &args ))) WARN( "glTexBuffer returned %#lx\n", status );
+    UNIX_BATCH( glTexBuffer, &args );
 }
 
 static void WINAPI glTexBufferARB( GLenum target, GLenum internalformat, GLuint buffer )
 {
     struct glTexBufferARB_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, buffer %d\n", target, internalformat, buffer );
-    if ((status = UNIX_CALL( glTexBufferARB, &args ))) WARN( "glTexBufferARB returned %#lx\n", status );
+    UNIX_BATCH( glTexBufferARB, &args );
 }
 
 static void WINAPI glTexBufferEXT( GLenum target, GLenum internalformat, GLuint buffer )
 {
     struct glTexBufferEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "target %d, internalformat %d, buffer %d\n", target, internalformat, buffer );
-    if ((status = UNIX_CALL( glTexBufferEXT, &args ))) WARN( "glTexBufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glTexBufferEXT, &args );
 }
 
 static void WINAPI glTexBufferRange( GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size )
@@ -18489,9 +17600,8 @@ static void WINAPI glTexBumpParameterivATI( GLenum pname, const GLint *param )
 static void WINAPI glTexCoord1bOES( GLbyte s )
 {
     struct glTexCoord1bOES_params args = { .teb = NtCurrentTeb(), .s = s };
-    NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1bOES, &args ))) WARN( "glTexCoord1bOES returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord1bOES, &args );
 }
 
 static void WINAPI glTexCoord1bvOES( const GLbyte *coords )
@@ -18505,9 +17615,8 @@ static void WINAPI glTexCoord1bvOES( const GLbyte *coords )
 static void WINAPI glTexCoord1hNV( GLhalfNV s )
 {
     struct glTexCoord1hNV_params args = { .teb = NtCurrentTeb(), .s = s };
-    NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1hNV, &args ))) WARN( "glTexCoord1hNV returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord1hNV, &args );
 }
 
 static void WINAPI glTexCoord1hvNV( const GLhalfNV *v )
@@ -18521,9 +17630,8 @@ static void WINAPI glTexCoord1hvNV( const GLhalfNV *v )
 static void WINAPI glTexCoord1xOES( GLfixed s )
 {
     struct glTexCoord1xOES_params args = { .teb = NtCurrentTeb(), .s = s };
-    NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1xOES, &args ))) WARN( "glTexCoord1xOES returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord1xOES, &args );
 }
 
 static void WINAPI glTexCoord1xvOES( const GLfixed *coords )
@@ -18537,9 +17645,8 @@ static void WINAPI glTexCoord1xvOES( const GLfixed *coords )
 static void WINAPI glTexCoord2bOES( GLbyte s, GLbyte t )
 {
     struct glTexCoord2bOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2bOES, &args ))) WARN( "glTexCoord2bOES returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2bOES, &args );
 }
 
 static void WINAPI glTexCoord2bvOES( const GLbyte *coords )
@@ -18553,9 +17660,8 @@ static void WINAPI glTexCoord2bvOES( const GLbyte *coords )
 static void WINAPI glTexCoord2fColor3fVertex3fSUN( GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glTexCoord2fColor3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .g = g, .b = b, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "s %f, t %f, r %f, g %f, b %f, x %f, y %f, z %f\n", s, t, r, g, b, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fColor3fVertex3fSUN, &args ))) WARN( "glTexCoord2fColor3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2fColor3fVertex3fSUN, &args );
 }
 
 static void WINAPI glTexCoord2fColor3fVertex3fvSUN( const GLfloat *tc, const GLfloat *c, const GLfloat *v )
@@ -18569,9 +17675,8 @@ static void WINAPI glTexCoord2fColor3fVertex3fvSUN( const GLfloat *tc, const GLf
 static void WINAPI glTexCoord2fColor4fNormal3fVertex3fSUN( GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glTexCoord2fColor4fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "s %f, t %f, r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", s, t, r, g, b, a, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fColor4fNormal3fVertex3fSUN, &args ))) WARN( "glTexCoord2fColor4fNormal3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2fColor4fNormal3fVertex3fSUN, &args );
 }
 
 static void WINAPI glTexCoord2fColor4fNormal3fVertex3fvSUN( const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -18585,9 +17690,8 @@ static void WINAPI glTexCoord2fColor4fNormal3fVertex3fvSUN( const GLfloat *tc, c
 static void WINAPI glTexCoord2fColor4ubVertex3fSUN( GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glTexCoord2fColor4ubVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .g = g, .b = b, .a = a, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "s %f, t %f, r %d, g %d, b %d, a %d, x %f, y %f, z %f\n", s, t, r, g, b, a, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fColor4ubVertex3fSUN, &args ))) WARN( "glTexCoord2fColor4ubVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2fColor4ubVertex3fSUN, &args );
 }
 
 static void WINAPI glTexCoord2fColor4ubVertex3fvSUN( const GLfloat *tc, const GLubyte *c, const GLfloat *v )
@@ -18601,9 +17705,8 @@ static void WINAPI glTexCoord2fColor4ubVertex3fvSUN( const GLfloat *tc, const GL
 static void WINAPI glTexCoord2fNormal3fVertex3fSUN( GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glTexCoord2fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "s %f, t %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", s, t, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fNormal3fVertex3fSUN, &args ))) WARN( "glTexCoord2fNormal3fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2fNormal3fVertex3fSUN, &args );
 }
 
 static void WINAPI glTexCoord2fNormal3fVertex3fvSUN( const GLfloat *tc, const GLfloat *n, const GLfloat *v )
@@ -18617,9 +17720,8 @@ static void WINAPI glTexCoord2fNormal3fVertex3fvSUN( const GLfloat *tc, const GL
 static void WINAPI glTexCoord2fVertex3fSUN( GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glTexCoord2fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "s %f, t %f, x %f, y %f, z %f\n", s, t, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fVertex3fSUN, &args ))) WARN( "glTexCoord2fVertex3fSUN returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2fVertex3fSUN, &args );
 }
 
 static void WINAPI glTexCoord2fVertex3fvSUN( const GLfloat *tc, const GLfloat *v )
@@ -18633,9 +17735,8 @@ static void WINAPI glTexCoord2fVertex3fvSUN( const GLfloat *tc, const GLfloat *v
 static void WINAPI glTexCoord2hNV( GLhalfNV s, GLhalfNV t )
 {
     struct glTexCoord2hNV_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2hNV, &args ))) WARN( "glTexCoord2hNV returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2hNV, &args );
 }
 
 static void WINAPI glTexCoord2hvNV( const GLhalfNV *v )
@@ -18649,9 +17750,8 @@ static void WINAPI glTexCoord2hvNV( const GLhalfNV *v )
 static void WINAPI glTexCoord2xOES( GLfixed s, GLfixed t )
 {
     struct glTexCoord2xOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
-    NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2xOES, &args ))) WARN( "glTexCoord2xOES returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord2xOES, &args );
 }
 
 static void WINAPI glTexCoord2xvOES( const GLfixed *coords )
@@ -18665,9 +17765,8 @@ static void WINAPI glTexCoord2xvOES( const GLfixed *coords )
 static void WINAPI glTexCoord3bOES( GLbyte s, GLbyte t, GLbyte r )
 {
     struct glTexCoord3bOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3bOES, &args ))) WARN( "glTexCoord3bOES returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord3bOES, &args );
 }
 
 static void WINAPI glTexCoord3bvOES( const GLbyte *coords )
@@ -18681,9 +17780,8 @@ static void WINAPI glTexCoord3bvOES( const GLbyte *coords )
 static void WINAPI glTexCoord3hNV( GLhalfNV s, GLhalfNV t, GLhalfNV r )
 {
     struct glTexCoord3hNV_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3hNV, &args ))) WARN( "glTexCoord3hNV returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord3hNV, &args );
 }
 
 static void WINAPI glTexCoord3hvNV( const GLhalfNV *v )
@@ -18697,9 +17795,8 @@ static void WINAPI glTexCoord3hvNV( const GLhalfNV *v )
 static void WINAPI glTexCoord3xOES( GLfixed s, GLfixed t, GLfixed r )
 {
     struct glTexCoord3xOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3xOES, &args ))) WARN( "glTexCoord3xOES returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord3xOES, &args );
 }
 
 static void WINAPI glTexCoord3xvOES( const GLfixed *coords )
@@ -18713,9 +17810,8 @@ static void WINAPI glTexCoord3xvOES( const GLfixed *coords )
 static void WINAPI glTexCoord4bOES( GLbyte s, GLbyte t, GLbyte r, GLbyte q )
 {
     struct glTexCoord4bOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4bOES, &args ))) WARN( "glTexCoord4bOES returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4bOES, &args );
 }
 
 static void WINAPI glTexCoord4bvOES( const GLbyte *coords )
@@ -18729,9 +17825,8 @@ static void WINAPI glTexCoord4bvOES( const GLbyte *coords )
 static void WINAPI glTexCoord4fColor4fNormal3fVertex4fSUN( GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glTexCoord4fColor4fNormal3fVertex4fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .p = p, .q = q, .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "s %f, t %f, p %f, q %f, r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f, w %f\n", s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w );
-    if ((status = UNIX_CALL( glTexCoord4fColor4fNormal3fVertex4fSUN, &args ))) WARN( "glTexCoord4fColor4fNormal3fVertex4fSUN returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4fColor4fNormal3fVertex4fSUN, &args );
 }
 
 static void WINAPI glTexCoord4fColor4fNormal3fVertex4fvSUN( const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -18745,9 +17840,8 @@ static void WINAPI glTexCoord4fColor4fNormal3fVertex4fvSUN( const GLfloat *tc, c
 static void WINAPI glTexCoord4fVertex4fSUN( GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glTexCoord4fVertex4fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .p = p, .q = q, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "s %f, t %f, p %f, q %f, x %f, y %f, z %f, w %f\n", s, t, p, q, x, y, z, w );
-    if ((status = UNIX_CALL( glTexCoord4fVertex4fSUN, &args ))) WARN( "glTexCoord4fVertex4fSUN returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4fVertex4fSUN, &args );
 }
 
 static void WINAPI glTexCoord4fVertex4fvSUN( const GLfloat *tc, const GLfloat *v )
@@ -18761,9 +17855,8 @@ static void WINAPI glTexCoord4fVertex4fvSUN( const GLfloat *tc, const GLfloat *v
 static void WINAPI glTexCoord4hNV( GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q )
 {
     struct glTexCoord4hNV_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4hNV, &args ))) WARN( "glTexCoord4hNV returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4hNV, &args );
 }
 
 static void WINAPI glTexCoord4hvNV( const GLhalfNV *v )
@@ -18777,9 +17870,8 @@ static void WINAPI glTexCoord4hvNV( const GLhalfNV *v )
 static void WINAPI glTexCoord4xOES( GLfixed s, GLfixed t, GLfixed r, GLfixed q )
 {
     struct glTexCoord4xOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
-    NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4xOES, &args ))) WARN( "glTexCoord4xOES returned %#lx\n", status );
+    UNIX_BATCH( glTexCoord4xOES, &args );
 }
 
 static void WINAPI glTexCoord4xvOES( const GLfixed *coords )
@@ -18793,17 +17885,15 @@ static void WINAPI glTexCoord4xvOES( const GLfixed *coords )
 static void WINAPI glTexCoordFormatNV( GLint size, GLenum type, GLsizei stride )
 {
     struct glTexCoordFormatNV_params args = { .teb = NtCurrentTeb(), .size = size, .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "size %d, type %d, stride %d\n", size, type, stride );
-    if ((status = UNIX_CALL( glTexCoordFormatNV, &args ))) WARN( "glTexCoordFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glTexCoordFormatNV, &args );
 }
 
 static void WINAPI glTexCoordP1ui( GLenum type, GLuint coords )
 {
     struct glTexCoordP1ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glTexCoordP1ui, &args ))) WARN( "glTexCoordP1ui returned %#lx\n", status );
+    UNIX_BATCH( glTexCoordP1ui, &args );
 }
 
 static void WINAPI glTexCoordP1uiv( GLenum type, const GLuint *coords )
@@ -18817,9 +17907,8 @@ static void WINAPI glTexCoordP1uiv( GLenum type, const GLuint *coords )
 static void WINAPI glTexCoordP2ui( GLenum type, GLuint coords )
 {
     struct glTexCoordP2ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glTexCoordP2ui, &args ))) WARN( "glTexCoordP2ui returned %#lx\n", status );
+    UNIX_BATCH( glTexCoordP2ui, &args );
 }
 
 static void WINAPI glTexCoordP2uiv( GLenum type, const GLuint *coords )
@@ -18833,9 +17922,8 @@ static void WINAPI glTexCoordP2uiv( GLenum type, const GLuint *coords )
 static void WINAPI glTexCoordP3ui( GLenum type, GLuint coords )
 {
     struct glTexCoordP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glTexCoordP3ui, &args ))) WARN( "glTexCoordP3ui returned %#lx\n", status );
+    UNIX_BATCH( glTexCoordP3ui, &args );
 }
 
 static void WINAPI glTexCoordP3uiv( GLenum type, const GLuint *coords )
@@ -18849,9 +17937,8 @@ static void WINAPI glTexCoordP3uiv( GLenum type, const GLuint *coords )
 static void WINAPI glTexCoordP4ui( GLenum type, GLuint coords )
 {
     struct glTexCoordP4ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
-    NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glTexCoordP4ui, &args ))) WARN( "glTexCoordP4ui returned %#lx\n", status );
+    UNIX_BATCH( glTexCoordP4ui, &args );
 }
 
 static void WINAPI glTexCoordP4uiv( GLenum type, const GLuint *coords )
@@ -18889,9 +17976,8 @@ static void WINAPI glTexCoordPointervINTEL( GLint size, GLenum type, const void
 static void WINAPI glTexEnvxOES( GLenum target, GLenum pname, GLfixed param )
 {
     struct glTexEnvxOES_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexEnvxOES, &args ))) WARN( "glTexEnvxOES returned %#lx\n", status );
+    UNIX_BATCH( glTexEnvxOES, &args );
 }
 
 static void WINAPI glTexEnvxvOES( GLenum target, GLenum pname, const GLfixed *params )
@@ -18913,9 +17999,8 @@ static void WINAPI glTexFilterFuncSGIS( GLenum target, GLenum filter, GLsizei n,
 static void WINAPI glTexGenxOES( GLenum coord, GLenum pname, GLfixed param )
 {
     struct glTexGenxOES_params args = { .teb = NtCurrentTeb(), .coord = coord, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "coord %d, pname %d, param %d\n", coord, pname, param );
-    if ((status = UNIX_CALL( glTexGenxOES, &args ))) WARN( "glTexGenxOES returned %#lx\n", status );
+    UNIX_BATCH( glTexGenxOES, &args );
 }
 
 static void WINAPI glTexGenxvOES( GLenum coord, GLenum pname, const GLfixed *params )
@@ -18929,17 +18014,15 @@ static void WINAPI glTexGenxvOES( GLenum coord, GLenum pname, const GLfixed *par
 static void WINAPI glTexImage2DMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations )
 {
     struct glTexImage2DMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d, fixedsamplelocations %d\n", target, samples, internalformat, width, height, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTexImage2DMultisample, &args ))) WARN( "glTexImage2DMultisample returned %#lx\n", status );
+    UNIX_BATCH( glTexImage2DMultisample, &args );
 }
 
 static void WINAPI glTexImage2DMultisampleCoverageNV( GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations )
 {
     struct glTexImage2DMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations };
-    NTSTATUS status;
     TRACE( "target %d, coverageSamples %d, colorSamples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d\n", target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTexImage2DMultisampleCoverageNV, &args ))) WARN( "glTexImage2DMultisampleCoverageNV returned %#lx\n", status );
+    UNIX_BATCH( glTexImage2DMultisampleCoverageNV, &args );
 }
 
 static void WINAPI glTexImage3D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels )
@@ -18961,17 +18044,15 @@ static void WINAPI glTexImage3DEXT( GLenum target, GLint level, GLenum internalf
 static void WINAPI glTexImage3DMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations )
 {
     struct glTexImage3DMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .depth = depth, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d, depth %d, fixedsamplelocations %d\n", target, samples, internalformat, width, height, depth, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTexImage3DMultisample, &args ))) WARN( "glTexImage3DMultisample returned %#lx\n", status );
+    UNIX_BATCH( glTexImage3DMultisample, &args );
 }
 
 static void WINAPI glTexImage3DMultisampleCoverageNV( GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations )
 {
     struct glTexImage3DMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations };
-    NTSTATUS status;
     TRACE( "target %d, coverageSamples %d, colorSamples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d\n", target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTexImage3DMultisampleCoverageNV, &args ))) WARN( "glTexImage3DMultisampleCoverageNV returned %#lx\n", status );
+    UNIX_BATCH( glTexImage3DMultisampleCoverageNV, &args );
 }
 
 static void WINAPI glTexImage4DSGIS( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const void *pixels )
@@ -18985,9 +18066,8 @@ static void WINAPI glTexImage4DSGIS( GLenum target, GLint level, GLenum internal
 static void WINAPI glTexPageCommitmentARB( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit )
 {
     struct glTexPageCommitmentARB_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .width = width, .height = height, .depth = depth, .commit = commit };
-    NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, zoffset %d, width %d, height %d, depth %d, commit %d\n", target, level, xoffset, yoffset, zoffset, width, height, depth, commit );
-    if ((status = UNIX_CALL( glTexPageCommitmentARB, &args ))) WARN( "glTexPageCommitmentARB returned %#lx\n", status );
+    UNIX_BATCH( glTexPageCommitmentARB, &args );
 }
 
 static void WINAPI glTexParameterIiv( GLenum target, GLenum pname, const GLint *params )
@@ -19025,9 +18105,8 @@ static void WINAPI glTexParameterIuivEXT( GLenum target, GLenum pname, const GLu
 static void WINAPI glTexParameterxOES( GLenum target, GLenum pname, GLfixed param )
 {
     struct glTexParameterxOES_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexParameterxOES, &args ))) WARN( "glTexParameterxOES returned %#lx\n", status );
+    UNIX_BATCH( glTexParameterxOES, &args );
 }
 
 static void WINAPI glTexParameterxvOES( GLenum target, GLenum pname, const GLfixed *params )
@@ -19041,97 +18120,85 @@ static void WINAPI glTexParameterxvOES( GLenum target, GLenum pname, const GLfix
 static void WINAPI glTexRenderbufferNV( GLenum target, GLuint renderbuffer )
 {
     struct glTexRenderbufferNV_params args = { .teb = NtCurrentTeb(), .target = target, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "target %d, renderbuffer %d\n", target, renderbuffer );
-    if ((status = UNIX_CALL( glTexRenderbufferNV, &args ))) WARN( "glTexRenderbufferNV returned %#lx\n", status );
+    UNIX_BATCH( glTexRenderbufferNV, &args );
 }
 
 static void WINAPI glTexStorage1D( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width )
 {
     struct glTexStorage1D_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalformat = internalformat, .width = width };
-    NTSTATUS status;
     TRACE( "target %d, levels %d, internalformat %d, width %d\n", target, levels, internalformat, width );
-    if ((status = UNIX_CALL( glTexStorage1D, &args ))) WARN( "glTexStorage1D returned %#lx\n", status );
+    UNIX_BATCH( glTexStorage1D, &args );
 }
 
 static void WINAPI glTexStorage2D( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glTexStorage2D_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "target %d, levels %d, internalformat %d, width %d, height %d\n", target, levels, internalformat, width, height );
-    if ((status = UNIX_CALL( glTexStorage2D, &args ))) WARN( "glTexStorage2D returned %#lx\n", status );
+    UNIX_BATCH( glTexStorage2D, &args );
 }
 
 static void WINAPI glTexStorage2DMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations )
 {
     struct glTexStorage2DMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d, fixedsamplelocations %d\n", target, samples, internalformat, width, height, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTexStorage2DMultisample, &args ))) WARN( "glTexStorage2DMultisample returned %#lx\n", status );
+    UNIX_BATCH( glTexStorage2DMultisample, &args );
 }
 
 static void WINAPI glTexStorage3D( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth )
 {
     struct glTexStorage3D_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalformat = internalformat, .width = width, .height = height, .depth = depth };
-    NTSTATUS status;
     TRACE( "target %d, levels %d, internalformat %d, width %d, height %d, depth %d\n", target, levels, internalformat, width, height, depth );
-    if ((status = UNIX_CALL( glTexStorage3D, &args ))) WARN( "glTexStorage3D returned %#lx\n", status );
+    UNIX_BATCH( glTexStorage3D, &args );
 }
 
 static void WINAPI glTexStorage3DMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations )
 {
     struct glTexStorage3DMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .depth = depth, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d, depth %d, fixedsamplelocations %d\n", target, samples, internalformat, width, height, depth, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTexStorage3DMultisample, &args ))) WARN( "glTexStorage3DMultisample returned %#lx\n", status );
+    UNIX_BATCH( glTexStorage3DMultisample, &args );
 }
 
 static void WINAPI glTexStorageMem1DEXT( GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset )
 {
     struct glTexStorageMem1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalFormat = internalFormat, .width = width, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "target %d, levels %d, internalFormat %d, width %d, memory %d, offset %s\n", target, levels, internalFormat, width, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem1DEXT, &args ))) WARN( "glTexStorageMem1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTexStorageMem1DEXT, &args );
 }
 
 static void WINAPI glTexStorageMem2DEXT( GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset )
 {
     struct glTexStorageMem2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalFormat = internalFormat, .width = width, .height = height, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "target %d, levels %d, internalFormat %d, width %d, height %d, memory %d, offset %s\n", target, levels, internalFormat, width, height, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem2DEXT, &args ))) WARN( "glTexStorageMem2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTexStorageMem2DEXT, &args );
 }
 
 static void WINAPI glTexStorageMem2DMultisampleEXT( GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset )
 {
     struct glTexStorageMem2DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d, memory %d, offset %s\n", target, samples, internalFormat, width, height, fixedSampleLocations, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem2DMultisampleEXT, &args ))) WARN( "glTexStorageMem2DMultisampleEXT returned %#lx\n", status );
+    UNIX_BATCH( glTexStorageMem2DMultisampleEXT, &args );
 }
 
 static void WINAPI glTexStorageMem3DEXT( GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset )
 {
     struct glTexStorageMem3DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "target %d, levels %d, internalFormat %d, width %d, height %d, depth %d, memory %d, offset %s\n", target, levels, internalFormat, width, height, depth, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem3DEXT, &args ))) WARN( "glTexStorageMem3DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTexStorageMem3DEXT, &args );
 }
 
 static void WINAPI glTexStorageMem3DMultisampleEXT( GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset )
 {
     struct glTexStorageMem3DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "target %d, samples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d, memory %d, offset %s\n", target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem3DMultisampleEXT, &args ))) WARN( "glTexStorageMem3DMultisampleEXT returned %#lx\n", status );
+    UNIX_BATCH( glTexStorageMem3DMultisampleEXT, &args );
 }
 
 static void WINAPI glTexStorageSparseAMD( GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags )
 {
     struct glTexStorageSparseAMD_params args = { .teb = NtCurrentTeb(), .target = target, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .layers = layers, .flags = flags };
-    NTSTATUS status;
     TRACE( "target %d, internalFormat %d, width %d, height %d, depth %d, layers %d, flags %d\n", target, internalFormat, width, height, depth, layers, flags );
-    if ((status = UNIX_CALL( glTexStorageSparseAMD, &args ))) WARN( "glTexStorageSparseAMD returned %#lx\n", status );
+    UNIX_BATCH( glTexStorageSparseAMD, &args );
 }
 
 static void WINAPI glTexSubImage1DEXT( GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels )
@@ -19177,41 +18244,36 @@ static void WINAPI glTexSubImage4DSGIS( GLenum target, GLint level, GLint xoffse
 static void WINAPI glTextureAttachMemoryNV( GLuint texture, GLuint memory, GLuint64 offset )
 {
     struct glTextureAttachMemoryNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "texture %d, memory %d, offset %s\n", texture, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureAttachMemoryNV, &args ))) WARN( "glTextureAttachMemoryNV returned %#lx\n", status );
+    UNIX_BATCH( glTextureAttachMemoryNV, &args );
 }
 
 static void WINAPI glTextureBarrier(void)
 {
     struct glTextureBarrier_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glTextureBarrier, &args ))) WARN( "glTextureBarrier returned %#lx\n", status );
+    UNIX_BATCH( glTextureBarrier, &args );
 }
 
 static void WINAPI glTextureBarrierNV(void)
 {
     struct glTextureBarrierNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glTextureBarrierNV, &args ))) WARN( "glTextureBarrierNV returned %#lx\n", status );
+    UNIX_BATCH( glTextureBarrierNV, &args );
 }
 
 static void WINAPI glTextureBuffer( GLuint texture, GLenum internalformat, GLuint buffer )
 {
     struct glTextureBuffer_params args = { .teb = NtCurrentTeb(), .texture = texture, .internalformat = internalformat, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "texture %d, internalformat %d, buffer %d\n", texture, internalformat, buffer );
-    if ((status = UNIX_CALL( glTextureBuffer, &args ))) WARN( "glTextureBuffer returned %#lx\n", status );
+    UNIX_BATCH( glTextureBuffer, &args );
 }
 
 static void WINAPI glTextureBufferEXT( GLuint texture, GLenum target, GLenum internalformat, GLuint buffer )
 {
     struct glTextureBufferEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .internalformat = internalformat, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, internalformat %d, buffer %d\n", texture, target, internalformat, buffer );
-    if ((status = UNIX_CALL( glTextureBufferEXT, &args ))) WARN( "glTextureBufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureBufferEXT, &args );
 }
 
 static void WINAPI glTextureBufferRange( GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size )
@@ -19233,9 +18295,8 @@ static void WINAPI glTextureBufferRangeEXT( GLuint texture, GLenum target, GLenu
 static void WINAPI glTextureColorMaskSGIS( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha )
 {
     struct glTextureColorMaskSGIS_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
-    NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glTextureColorMaskSGIS, &args ))) WARN( "glTextureColorMaskSGIS returned %#lx\n", status );
+    UNIX_BATCH( glTextureColorMaskSGIS, &args );
 }
 
 static void WINAPI glTextureImage1DEXT( GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels )
@@ -19257,17 +18318,15 @@ static void WINAPI glTextureImage2DEXT( GLuint texture, GLenum target, GLint lev
 static void WINAPI glTextureImage2DMultisampleCoverageNV( GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations )
 {
     struct glTextureImage2DMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, coverageSamples %d, colorSamples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d\n", texture, target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTextureImage2DMultisampleCoverageNV, &args ))) WARN( "glTextureImage2DMultisampleCoverageNV returned %#lx\n", status );
+    UNIX_BATCH( glTextureImage2DMultisampleCoverageNV, &args );
 }
 
 static void WINAPI glTextureImage2DMultisampleNV( GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations )
 {
     struct glTextureImage2DMultisampleNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, samples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d\n", texture, target, samples, internalFormat, width, height, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTextureImage2DMultisampleNV, &args ))) WARN( "glTextureImage2DMultisampleNV returned %#lx\n", status );
+    UNIX_BATCH( glTextureImage2DMultisampleNV, &args );
 }
 
 static void WINAPI glTextureImage3DEXT( GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels )
@@ -19281,49 +18340,43 @@ static void WINAPI glTextureImage3DEXT( GLuint texture, GLenum target, GLint lev
 static void WINAPI glTextureImage3DMultisampleCoverageNV( GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations )
 {
     struct glTextureImage3DMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, coverageSamples %d, colorSamples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d\n", texture, target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTextureImage3DMultisampleCoverageNV, &args ))) WARN( "glTextureImage3DMultisampleCoverageNV returned %#lx\n", status );
+    UNIX_BATCH( glTextureImage3DMultisampleCoverageNV, &args );
 }
 
 static void WINAPI glTextureImage3DMultisampleNV( GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations )
 {
     struct glTextureImage3DMultisampleNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, samples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d\n", texture, target, samples, internalFormat, width, height, depth, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTextureImage3DMultisampleNV, &args ))) WARN( "glTextureImage3DMultisampleNV returned %#lx\n", status );
+    UNIX_BATCH( glTextureImage3DMultisampleNV, &args );
 }
 
 static void WINAPI glTextureLightEXT( GLenum pname )
 {
     struct glTextureLightEXT_params args = { .teb = NtCurrentTeb(), .pname = pname };
-    NTSTATUS status;
     TRACE( "pname %d\n", pname );
-    if ((status = UNIX_CALL( glTextureLightEXT, &args ))) WARN( "glTextureLightEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureLightEXT, &args );
 }
 
 static void WINAPI glTextureMaterialEXT( GLenum face, GLenum mode )
 {
     struct glTextureMaterialEXT_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
-    NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glTextureMaterialEXT, &args ))) WARN( "glTextureMaterialEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureMaterialEXT, &args );
 }
 
 static void WINAPI glTextureNormalEXT( GLenum mode )
 {
     struct glTextureNormalEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
-    NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glTextureNormalEXT, &args ))) WARN( "glTextureNormalEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureNormalEXT, &args );
 }
 
 static void WINAPI glTexturePageCommitmentEXT( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit )
 {
     struct glTexturePageCommitmentEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .width = width, .height = height, .depth = depth, .commit = commit };
-    NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, yoffset %d, zoffset %d, width %d, height %d, depth %d, commit %d\n", texture, level, xoffset, yoffset, zoffset, width, height, depth, commit );
-    if ((status = UNIX_CALL( glTexturePageCommitmentEXT, &args ))) WARN( "glTexturePageCommitmentEXT returned %#lx\n", status );
+    UNIX_BATCH( glTexturePageCommitmentEXT, &args );
 }
 
 static void WINAPI glTextureParameterIiv( GLuint texture, GLenum pname, const GLint *params )
@@ -19361,17 +18414,15 @@ static void WINAPI glTextureParameterIuivEXT( GLuint texture, GLenum target, GLe
 static void WINAPI glTextureParameterf( GLuint texture, GLenum pname, GLfloat param )
 {
     struct glTextureParameterf_params args = { .teb = NtCurrentTeb(), .texture = texture, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texture %d, pname %d, param %f\n", texture, pname, param );
-    if ((status = UNIX_CALL( glTextureParameterf, &args ))) WARN( "glTextureParameterf returned %#lx\n", status );
+    UNIX_BATCH( glTextureParameterf, &args );
 }
 
 static void WINAPI glTextureParameterfEXT( GLuint texture, GLenum target, GLenum pname, GLfloat param )
 {
     struct glTextureParameterfEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, pname %d, param %f\n", texture, target, pname, param );
-    if ((status = UNIX_CALL( glTextureParameterfEXT, &args ))) WARN( "glTextureParameterfEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureParameterfEXT, &args );
 }
 
 static void WINAPI glTextureParameterfv( GLuint texture, GLenum pname, const GLfloat *param )
@@ -19393,17 +18444,15 @@ static void WINAPI glTextureParameterfvEXT( GLuint texture, GLenum target, GLenu
 static void WINAPI glTextureParameteri( GLuint texture, GLenum pname, GLint param )
 {
     struct glTextureParameteri_params args = { .teb = NtCurrentTeb(), .texture = texture, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texture %d, pname %d, param %d\n", texture, pname, param );
-    if ((status = UNIX_CALL( glTextureParameteri, &args ))) WARN( "glTextureParameteri returned %#lx\n", status );
+    UNIX_BATCH( glTextureParameteri, &args );
 }
 
 static void WINAPI glTextureParameteriEXT( GLuint texture, GLenum target, GLenum pname, GLint param )
 {
     struct glTextureParameteriEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, pname %d, param %d\n", texture, target, pname, param );
-    if ((status = UNIX_CALL( glTextureParameteriEXT, &args ))) WARN( "glTextureParameteriEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureParameteriEXT, &args );
 }
 
 static void WINAPI glTextureParameteriv( GLuint texture, GLenum pname, const GLint *param )
@@ -19433,137 +18482,120 @@ static void WINAPI glTextureRangeAPPLE( GLenum target, GLsizei length, const voi
 static void WINAPI glTextureRenderbufferEXT( GLuint texture, GLenum target, GLuint renderbuffer )
 {
     struct glTextureRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .renderbuffer = renderbuffer };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, renderbuffer %d\n", texture, target, renderbuffer );
-    if ((status = UNIX_CALL( glTextureRenderbufferEXT, &args ))) WARN( "glTextureRenderbufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureRenderbufferEXT, &args );
 }
 
 static void WINAPI glTextureStorage1D( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width )
 {
     struct glTextureStorage1D_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalformat = internalformat, .width = width };
-    NTSTATUS status;
     TRACE( "texture %d, levels %d, internalformat %d, width %d\n", texture, levels, internalformat, width );
-    if ((status = UNIX_CALL( glTextureStorage1D, &args ))) WARN( "glTextureStorage1D returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage1D, &args );
 }
 
 static void WINAPI glTextureStorage1DEXT( GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width )
 {
     struct glTextureStorage1DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .levels = levels, .internalformat = internalformat, .width = width };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, levels %d, internalformat %d, width %d\n", texture, target, levels, internalformat, width );
-    if ((status = UNIX_CALL( glTextureStorage1DEXT, &args ))) WARN( "glTextureStorage1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage1DEXT, &args );
 }
 
 static void WINAPI glTextureStorage2D( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glTextureStorage2D_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "texture %d, levels %d, internalformat %d, width %d, height %d\n", texture, levels, internalformat, width, height );
-    if ((status = UNIX_CALL( glTextureStorage2D, &args ))) WARN( "glTextureStorage2D returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage2D, &args );
 }
 
 static void WINAPI glTextureStorage2DEXT( GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height )
 {
     struct glTextureStorage2DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .levels = levels, .internalformat = internalformat, .width = width, .height = height };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, levels %d, internalformat %d, width %d, height %d\n", texture, target, levels, internalformat, width, height );
-    if ((status = UNIX_CALL( glTextureStorage2DEXT, &args ))) WARN( "glTextureStorage2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage2DEXT, &args );
 }
 
 static void WINAPI glTextureStorage2DMultisample( GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations )
 {
     struct glTextureStorage2DMultisample_params args = { .teb = NtCurrentTeb(), .texture = texture, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "texture %d, samples %d, internalformat %d, width %d, height %d, fixedsamplelocations %d\n", texture, samples, internalformat, width, height, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTextureStorage2DMultisample, &args ))) WARN( "glTextureStorage2DMultisample returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage2DMultisample, &args );
 }
 
 static void WINAPI glTextureStorage2DMultisampleEXT( GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations )
 {
     struct glTextureStorage2DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, samples %d, internalformat %d, width %d, height %d, fixedsamplelocations %d\n", texture, target, samples, internalformat, width, height, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTextureStorage2DMultisampleEXT, &args ))) WARN( "glTextureStorage2DMultisampleEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage2DMultisampleEXT, &args );
 }
 
 static void WINAPI glTextureStorage3D( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth )
 {
     struct glTextureStorage3D_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalformat = internalformat, .width = width, .height = height, .depth = depth };
-    NTSTATUS status;
     TRACE( "texture %d, levels %d, internalformat %d, width %d, height %d, depth %d\n", texture, levels, internalformat, width, height, depth );
-    if ((status = UNIX_CALL( glTextureStorage3D, &args ))) WARN( "glTextureStorage3D returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage3D, &args );
 }
 
 static void WINAPI glTextureStorage3DEXT( GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth )
 {
     struct glTextureStorage3DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .levels = levels, .internalformat = internalformat, .width = width, .height = height, .depth = depth };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, levels %d, internalformat %d, width %d, height %d, depth %d\n", texture, target, levels, internalformat, width, height, depth );
-    if ((status = UNIX_CALL( glTextureStorage3DEXT, &args ))) WARN( "glTextureStorage3DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage3DEXT, &args );
 }
 
 static void WINAPI glTextureStorage3DMultisample( GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations )
 {
     struct glTextureStorage3DMultisample_params args = { .teb = NtCurrentTeb(), .texture = texture, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .depth = depth, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "texture %d, samples %d, internalformat %d, width %d, height %d, depth %d, fixedsamplelocations %d\n", texture, samples, internalformat, width, height, depth, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTextureStorage3DMultisample, &args ))) WARN( "glTextureStorage3DMultisample returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage3DMultisample, &args );
 }
 
 static void WINAPI glTextureStorage3DMultisampleEXT( GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations )
 {
     struct glTextureStorage3DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .depth = depth, .fixedsamplelocations = fixedsamplelocations };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, samples %d, internalformat %d, width %d, height %d, depth %d, fixedsamplelocations %d\n", texture, target, samples, internalformat, width, height, depth, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTextureStorage3DMultisampleEXT, &args ))) WARN( "glTextureStorage3DMultisampleEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorage3DMultisampleEXT, &args );
 }
 
 static void WINAPI glTextureStorageMem1DEXT( GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset )
 {
     struct glTextureStorageMem1DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalFormat = internalFormat, .width = width, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "texture %d, levels %d, internalFormat %d, width %d, memory %d, offset %s\n", texture, levels, internalFormat, width, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem1DEXT, &args ))) WARN( "glTextureStorageMem1DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorageMem1DEXT, &args );
 }
 
 static void WINAPI glTextureStorageMem2DEXT( GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset )
 {
     struct glTextureStorageMem2DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalFormat = internalFormat, .width = width, .height = height, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "texture %d, levels %d, internalFormat %d, width %d, height %d, memory %d, offset %s\n", texture, levels, internalFormat, width, height, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem2DEXT, &args ))) WARN( "glTextureStorageMem2DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorageMem2DEXT, &args );
 }
 
 static void WINAPI glTextureStorageMem2DMultisampleEXT( GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset )
 {
     struct glTextureStorageMem2DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "texture %d, samples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d, memory %d, offset %s\n", texture, samples, internalFormat, width, height, fixedSampleLocations, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem2DMultisampleEXT, &args ))) WARN( "glTextureStorageMem2DMultisampleEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorageMem2DMultisampleEXT, &args );
 }
 
 static void WINAPI glTextureStorageMem3DEXT( GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset )
 {
     struct glTextureStorageMem3DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "texture %d, levels %d, internalFormat %d, width %d, height %d, depth %d, memory %d, offset %s\n", texture, levels, internalFormat, width, height, depth, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem3DEXT, &args ))) WARN( "glTextureStorageMem3DEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorageMem3DEXT, &args );
 }
 
 static void WINAPI glTextureStorageMem3DMultisampleEXT( GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset )
 {
     struct glTextureStorageMem3DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations, .memory = memory, .offset = offset };
-    NTSTATUS status;
     TRACE( "texture %d, samples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d, memory %d, offset %s\n", texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem3DMultisampleEXT, &args ))) WARN( "glTextureStorageMem3DMultisampleEXT returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorageMem3DMultisampleEXT, &args );
 }
 
 static void WINAPI glTextureStorageSparseAMD( GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags )
 {
     struct glTextureStorageSparseAMD_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .layers = layers, .flags = flags };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, internalFormat %d, width %d, height %d, depth %d, layers %d, flags %d\n", texture, target, internalFormat, width, height, depth, layers, flags );
-    if ((status = UNIX_CALL( glTextureStorageSparseAMD, &args ))) WARN( "glTextureStorageSparseAMD returned %#lx\n", status );
+    UNIX_BATCH( glTextureStorageSparseAMD, &args );
 }
 
 static void WINAPI glTextureSubImage1D( GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels )
@@ -19617,17 +18649,15 @@ static void WINAPI glTextureSubImage3DEXT( GLuint texture, GLenum target, GLint
 static void WINAPI glTextureView( GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers )
 {
     struct glTextureView_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .origtexture = origtexture, .internalformat = internalformat, .minlevel = minlevel, .numlevels = numlevels, .minlayer = minlayer, .numlayers = numlayers };
-    NTSTATUS status;
     TRACE( "texture %d, target %d, origtexture %d, internalformat %d, minlevel %d, numlevels %d, minlayer %d, numlayers %d\n", texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers );
-    if ((status = UNIX_CALL( glTextureView, &args ))) WARN( "glTextureView returned %#lx\n", status );
+    UNIX_BATCH( glTextureView, &args );
 }
 
 static void WINAPI glTrackMatrixNV( GLenum target, GLuint address, GLenum matrix, GLenum transform )
 {
     struct glTrackMatrixNV_params args = { .teb = NtCurrentTeb(), .target = target, .address = address, .matrix = matrix, .transform = transform };
-    NTSTATUS status;
     TRACE( "target %d, address %d, matrix %d, transform %d\n", target, address, matrix, transform );
-    if ((status = UNIX_CALL( glTrackMatrixNV, &args ))) WARN( "glTrackMatrixNV returned %#lx\n", status );
+    UNIX_BATCH( glTrackMatrixNV, &args );
 }
 
 static void WINAPI glTransformFeedbackAttribsNV( GLsizei count, const GLint *attribs, GLenum bufferMode )
@@ -19641,9 +18671,8 @@ static void WINAPI glTransformFeedbackAttribsNV( GLsizei count, const GLint *att
 static void WINAPI glTransformFeedbackBufferBase( GLuint xfb, GLuint index, GLuint buffer )
 {
     struct glTransformFeedbackBufferBase_params args = { .teb = NtCurrentTeb(), .xfb = xfb, .index = index, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "xfb %d, index %d, buffer %d\n", xfb, index, buffer );
-    if ((status = UNIX_CALL( glTransformFeedbackBufferBase, &args ))) WARN( "glTransformFeedbackBufferBase returned %#lx\n", status );
+    UNIX_BATCH( glTransformFeedbackBufferBase, &args );
 }
 
 static void WINAPI glTransformFeedbackBufferRange( GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size )
@@ -19697,17 +18726,15 @@ static void WINAPI glTransformPathNV( GLuint resultPath, GLuint srcPath, GLenum
 static void WINAPI glTranslatexOES( GLfixed x, GLfixed y, GLfixed z )
 {
     struct glTranslatexOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glTranslatexOES, &args ))) WARN( "glTranslatexOES returned %#lx\n", status );
+    UNIX_BATCH( glTranslatexOES, &args );
 }
 
 static void WINAPI glUniform1d( GLint location, GLdouble x )
 {
     struct glUniform1d_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "location %d, x %f\n", location, x );
-    if ((status = UNIX_CALL( glUniform1d, &args ))) WARN( "glUniform1d returned %#lx\n", status );
+    UNIX_BATCH( glUniform1d, &args );
 }
 
 static void WINAPI glUniform1dv( GLint location, GLsizei count, const GLdouble *value )
@@ -19721,17 +18748,15 @@ static void WINAPI glUniform1dv( GLint location, GLsizei count, const GLdouble *
 static void WINAPI glUniform1f( GLint location, GLfloat v0 )
 {
     struct glUniform1f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %f\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1f, &args ))) WARN( "glUniform1f returned %#lx\n", status );
+    UNIX_BATCH( glUniform1f, &args );
 }
 
 static void WINAPI glUniform1fARB( GLint location, GLfloat v0 )
 {
     struct glUniform1fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %f\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1fARB, &args ))) WARN( "glUniform1fARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform1fARB, &args );
 }
 
 static void WINAPI glUniform1fv( GLint location, GLsizei count, const GLfloat *value )
@@ -19753,25 +18778,22 @@ static void WINAPI glUniform1fvARB( GLint location, GLsizei count, const GLfloat
 static void WINAPI glUniform1i( GLint location, GLint v0 )
 {
     struct glUniform1i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1i, &args ))) WARN( "glUniform1i returned %#lx\n", status );
+    UNIX_BATCH( glUniform1i, &args );
 }
 
 static void WINAPI glUniform1i64ARB( GLint location, GLint64 x )
 {
     struct glUniform1i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "location %d, x %s\n", location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glUniform1i64ARB, &args ))) WARN( "glUniform1i64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform1i64ARB, &args );
 }
 
 static void WINAPI glUniform1i64NV( GLint location, GLint64EXT x )
 {
     struct glUniform1i64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "location %d, x %s\n", location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glUniform1i64NV, &args ))) WARN( "glUniform1i64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniform1i64NV, &args );
 }
 
 static void WINAPI glUniform1i64vARB( GLint location, GLsizei count, const GLint64 *value )
@@ -19793,9 +18815,8 @@ static void WINAPI glUniform1i64vNV( GLint location, GLsizei count, const GLint6
 static void WINAPI glUniform1iARB( GLint location, GLint v0 )
 {
     struct glUniform1iARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1iARB, &args ))) WARN( "glUniform1iARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform1iARB, &args );
 }
 
 static void WINAPI glUniform1iv( GLint location, GLsizei count, const GLint *value )
@@ -19817,25 +18838,22 @@ static void WINAPI glUniform1ivARB( GLint location, GLsizei count, const GLint *
 static void WINAPI glUniform1ui( GLint location, GLuint v0 )
 {
     struct glUniform1ui_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1ui, &args ))) WARN( "glUniform1ui returned %#lx\n", status );
+    UNIX_BATCH( glUniform1ui, &args );
 }
 
 static void WINAPI glUniform1ui64ARB( GLint location, GLuint64 x )
 {
     struct glUniform1ui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "location %d, x %s\n", location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glUniform1ui64ARB, &args ))) WARN( "glUniform1ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform1ui64ARB, &args );
 }
 
 static void WINAPI glUniform1ui64NV( GLint location, GLuint64EXT x )
 {
     struct glUniform1ui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
-    NTSTATUS status;
     TRACE( "location %d, x %s\n", location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glUniform1ui64NV, &args ))) WARN( "glUniform1ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniform1ui64NV, &args );
 }
 
 static void WINAPI glUniform1ui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -19857,9 +18875,8 @@ static void WINAPI glUniform1ui64vNV( GLint location, GLsizei count, const GLuin
 static void WINAPI glUniform1uiEXT( GLint location, GLuint v0 )
 {
     struct glUniform1uiEXT_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1uiEXT, &args ))) WARN( "glUniform1uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glUniform1uiEXT, &args );
 }
 
 static void WINAPI glUniform1uiv( GLint location, GLsizei count, const GLuint *value )
@@ -19881,9 +18898,8 @@ static void WINAPI glUniform1uivEXT( GLint location, GLsizei count, const GLuint
 static void WINAPI glUniform2d( GLint location, GLdouble x, GLdouble y )
 {
     struct glUniform2d_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "location %d, x %f, y %f\n", location, x, y );
-    if ((status = UNIX_CALL( glUniform2d, &args ))) WARN( "glUniform2d returned %#lx\n", status );
+    UNIX_BATCH( glUniform2d, &args );
 }
 
 static void WINAPI glUniform2dv( GLint location, GLsizei count, const GLdouble *value )
@@ -19897,17 +18913,15 @@ static void WINAPI glUniform2dv( GLint location, GLsizei count, const GLdouble *
 static void WINAPI glUniform2f( GLint location, GLfloat v0, GLfloat v1 )
 {
     struct glUniform2f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2f, &args ))) WARN( "glUniform2f returned %#lx\n", status );
+    UNIX_BATCH( glUniform2f, &args );
 }
 
 static void WINAPI glUniform2fARB( GLint location, GLfloat v0, GLfloat v1 )
 {
     struct glUniform2fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2fARB, &args ))) WARN( "glUniform2fARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform2fARB, &args );
 }
 
 static void WINAPI glUniform2fv( GLint location, GLsizei count, const GLfloat *value )
@@ -19929,25 +18943,22 @@ static void WINAPI glUniform2fvARB( GLint location, GLsizei count, const GLfloat
 static void WINAPI glUniform2i( GLint location, GLint v0, GLint v1 )
 {
     struct glUniform2i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2i, &args ))) WARN( "glUniform2i returned %#lx\n", status );
+    UNIX_BATCH( glUniform2i, &args );
 }
 
 static void WINAPI glUniform2i64ARB( GLint location, GLint64 x, GLint64 y )
 {
     struct glUniform2i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glUniform2i64ARB, &args ))) WARN( "glUniform2i64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform2i64ARB, &args );
 }
 
 static void WINAPI glUniform2i64NV( GLint location, GLint64EXT x, GLint64EXT y )
 {
     struct glUniform2i64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glUniform2i64NV, &args ))) WARN( "glUniform2i64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniform2i64NV, &args );
 }
 
 static void WINAPI glUniform2i64vARB( GLint location, GLsizei count, const GLint64 *value )
@@ -19969,9 +18980,8 @@ static void WINAPI glUniform2i64vNV( GLint location, GLsizei count, const GLint6
 static void WINAPI glUniform2iARB( GLint location, GLint v0, GLint v1 )
 {
     struct glUniform2iARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2iARB, &args ))) WARN( "glUniform2iARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform2iARB, &args );
 }
 
 static void WINAPI glUniform2iv( GLint location, GLsizei count, const GLint *value )
@@ -19993,25 +19003,22 @@ static void WINAPI glUniform2ivARB( GLint location, GLsizei count, const GLint *
 static void WINAPI glUniform2ui( GLint location, GLuint v0, GLuint v1 )
 {
     struct glUniform2ui_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2ui, &args ))) WARN( "glUniform2ui returned %#lx\n", status );
+    UNIX_BATCH( glUniform2ui, &args );
 }
 
 static void WINAPI glUniform2ui64ARB( GLint location, GLuint64 x, GLuint64 y )
 {
     struct glUniform2ui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glUniform2ui64ARB, &args ))) WARN( "glUniform2ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform2ui64ARB, &args );
 }
 
 static void WINAPI glUniform2ui64NV( GLint location, GLuint64EXT x, GLuint64EXT y )
 {
     struct glUniform2ui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glUniform2ui64NV, &args ))) WARN( "glUniform2ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniform2ui64NV, &args );
 }
 
 static void WINAPI glUniform2ui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -20033,9 +19040,8 @@ static void WINAPI glUniform2ui64vNV( GLint location, GLsizei count, const GLuin
 static void WINAPI glUniform2uiEXT( GLint location, GLuint v0, GLuint v1 )
 {
     struct glUniform2uiEXT_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2uiEXT, &args ))) WARN( "glUniform2uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glUniform2uiEXT, &args );
 }
 
 static void WINAPI glUniform2uiv( GLint location, GLsizei count, const GLuint *value )
@@ -20057,9 +19063,8 @@ static void WINAPI glUniform2uivEXT( GLint location, GLsizei count, const GLuint
 static void WINAPI glUniform3d( GLint location, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glUniform3d_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "location %d, x %f, y %f, z %f\n", location, x, y, z );
-    if ((status = UNIX_CALL( glUniform3d, &args ))) WARN( "glUniform3d returned %#lx\n", status );
+    UNIX_BATCH( glUniform3d, &args );
 }
 
 static void WINAPI glUniform3dv( GLint location, GLsizei count, const GLdouble *value )
@@ -20073,17 +19078,15 @@ static void WINAPI glUniform3dv( GLint location, GLsizei count, const GLdouble *
 static void WINAPI glUniform3f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
 {
     struct glUniform3f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f, v2 %f\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3f, &args ))) WARN( "glUniform3f returned %#lx\n", status );
+    UNIX_BATCH( glUniform3f, &args );
 }
 
 static void WINAPI glUniform3fARB( GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
 {
     struct glUniform3fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f, v2 %f\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3fARB, &args ))) WARN( "glUniform3fARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform3fARB, &args );
 }
 
 static void WINAPI glUniform3fv( GLint location, GLsizei count, const GLfloat *value )
@@ -20105,25 +19108,22 @@ static void WINAPI glUniform3fvARB( GLint location, GLsizei count, const GLfloat
 static void WINAPI glUniform3i( GLint location, GLint v0, GLint v1, GLint v2 )
 {
     struct glUniform3i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3i, &args ))) WARN( "glUniform3i returned %#lx\n", status );
+    UNIX_BATCH( glUniform3i, &args );
 }
 
 static void WINAPI glUniform3i64ARB( GLint location, GLint64 x, GLint64 y, GLint64 z )
 {
     struct glUniform3i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glUniform3i64ARB, &args ))) WARN( "glUniform3i64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform3i64ARB, &args );
 }
 
 static void WINAPI glUniform3i64NV( GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z )
 {
     struct glUniform3i64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glUniform3i64NV, &args ))) WARN( "glUniform3i64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniform3i64NV, &args );
 }
 
 static void WINAPI glUniform3i64vARB( GLint location, GLsizei count, const GLint64 *value )
@@ -20145,9 +19145,8 @@ static void WINAPI glUniform3i64vNV( GLint location, GLsizei count, const GLint6
 static void WINAPI glUniform3iARB( GLint location, GLint v0, GLint v1, GLint v2 )
 {
     struct glUniform3iARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3iARB, &args ))) WARN( "glUniform3iARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform3iARB, &args );
 }
 
 static void WINAPI glUniform3iv( GLint location, GLsizei count, const GLint *value )
@@ -20169,25 +19168,22 @@ static void WINAPI glUniform3ivARB( GLint location, GLsizei count, const GLint *
 static void WINAPI glUniform3ui( GLint location, GLuint v0, GLuint v1, GLuint v2 )
 {
     struct glUniform3ui_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3ui, &args ))) WARN( "glUniform3ui returned %#lx\n", status );
+    UNIX_BATCH( glUniform3ui, &args );
 }
 
 static void WINAPI glUniform3ui64ARB( GLint location, GLuint64 x, GLuint64 y, GLuint64 z )
 {
     struct glUniform3ui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glUniform3ui64ARB, &args ))) WARN( "glUniform3ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform3ui64ARB, &args );
 }
 
 static void WINAPI glUniform3ui64NV( GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z )
 {
     struct glUniform3ui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glUniform3ui64NV, &args ))) WARN( "glUniform3ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniform3ui64NV, &args );
 }
 
 static void WINAPI glUniform3ui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -20209,9 +19205,8 @@ static void WINAPI glUniform3ui64vNV( GLint location, GLsizei count, const GLuin
 static void WINAPI glUniform3uiEXT( GLint location, GLuint v0, GLuint v1, GLuint v2 )
 {
     struct glUniform3uiEXT_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3uiEXT, &args ))) WARN( "glUniform3uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glUniform3uiEXT, &args );
 }
 
 static void WINAPI glUniform3uiv( GLint location, GLsizei count, const GLuint *value )
@@ -20233,9 +19228,8 @@ static void WINAPI glUniform3uivEXT( GLint location, GLsizei count, const GLuint
 static void WINAPI glUniform4d( GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glUniform4d_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "location %d, x %f, y %f, z %f, w %f\n", location, x, y, z, w );
-    if ((status = UNIX_CALL( glUniform4d, &args ))) WARN( "glUniform4d returned %#lx\n", status );
+    UNIX_BATCH( glUniform4d, &args );
 }
 
 static void WINAPI glUniform4dv( GLint location, GLsizei count, const GLdouble *value )
@@ -20249,17 +19243,15 @@ static void WINAPI glUniform4dv( GLint location, GLsizei count, const GLdouble *
 static void WINAPI glUniform4f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
 {
     struct glUniform4f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4f, &args ))) WARN( "glUniform4f returned %#lx\n", status );
+    UNIX_BATCH( glUniform4f, &args );
 }
 
 static void WINAPI glUniform4fARB( GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
 {
     struct glUniform4fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4fARB, &args ))) WARN( "glUniform4fARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform4fARB, &args );
 }
 
 static void WINAPI glUniform4fv( GLint location, GLsizei count, const GLfloat *value )
@@ -20281,25 +19273,22 @@ static void WINAPI glUniform4fvARB( GLint location, GLsizei count, const GLfloat
 static void WINAPI glUniform4i( GLint location, GLint v0, GLint v1, GLint v2, GLint v3 )
 {
     struct glUniform4i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4i, &args ))) WARN( "glUniform4i returned %#lx\n", status );
+    UNIX_BATCH( glUniform4i, &args );
 }
 
 static void WINAPI glUniform4i64ARB( GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w )
 {
     struct glUniform4i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s, w %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glUniform4i64ARB, &args ))) WARN( "glUniform4i64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform4i64ARB, &args );
 }
 
 static void WINAPI glUniform4i64NV( GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w )
 {
     struct glUniform4i64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s, w %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glUniform4i64NV, &args ))) WARN( "glUniform4i64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniform4i64NV, &args );
 }
 
 static void WINAPI glUniform4i64vARB( GLint location, GLsizei count, const GLint64 *value )
@@ -20321,9 +19310,8 @@ static void WINAPI glUniform4i64vNV( GLint location, GLsizei count, const GLint6
 static void WINAPI glUniform4iARB( GLint location, GLint v0, GLint v1, GLint v2, GLint v3 )
 {
     struct glUniform4iARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4iARB, &args ))) WARN( "glUniform4iARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform4iARB, &args );
 }
 
 static void WINAPI glUniform4iv( GLint location, GLsizei count, const GLint *value )
@@ -20345,25 +19333,22 @@ static void WINAPI glUniform4ivARB( GLint location, GLsizei count, const GLint *
 static void WINAPI glUniform4ui( GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3 )
 {
     struct glUniform4ui_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4ui, &args ))) WARN( "glUniform4ui returned %#lx\n", status );
+    UNIX_BATCH( glUniform4ui, &args );
 }
 
 static void WINAPI glUniform4ui64ARB( GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w )
 {
     struct glUniform4ui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s, w %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glUniform4ui64ARB, &args ))) WARN( "glUniform4ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniform4ui64ARB, &args );
 }
 
 static void WINAPI glUniform4ui64NV( GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w )
 {
     struct glUniform4ui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s, w %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glUniform4ui64NV, &args ))) WARN( "glUniform4ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniform4ui64NV, &args );
 }
 
 static void WINAPI glUniform4ui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -20385,9 +19370,8 @@ static void WINAPI glUniform4ui64vNV( GLint location, GLsizei count, const GLuin
 static void WINAPI glUniform4uiEXT( GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3 )
 {
     struct glUniform4uiEXT_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4uiEXT, &args ))) WARN( "glUniform4uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glUniform4uiEXT, &args );
 }
 
 static void WINAPI glUniform4uiv( GLint location, GLsizei count, const GLuint *value )
@@ -20409,33 +19393,29 @@ static void WINAPI glUniform4uivEXT( GLint location, GLsizei count, const GLuint
 static void WINAPI glUniformBlockBinding( GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding )
 {
     struct glUniformBlockBinding_params args = { .teb = NtCurrentTeb(), .program = program, .uniformBlockIndex = uniformBlockIndex, .uniformBlockBinding = uniformBlockBinding };
-    NTSTATUS status;
     TRACE( "program %d, uniformBlockIndex %d, uniformBlockBinding %d\n", program, uniformBlockIndex, uniformBlockBinding );
-    if ((status = UNIX_CALL( glUniformBlockBinding, &args ))) WARN( "glUniformBlockBinding returned %#lx\n", status );
+    UNIX_BATCH( glUniformBlockBinding, &args );
 }
 
 static void WINAPI glUniformBufferEXT( GLuint program, GLint location, GLuint buffer )
 {
     struct glUniformBufferEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "program %d, location %d, buffer %d\n", program, location, buffer );
-    if ((status = UNIX_CALL( glUniformBufferEXT, &args ))) WARN( "glUniformBufferEXT returned %#lx\n", status );
+    UNIX_BATCH( glUniformBufferEXT, &args );
 }
 
 static void WINAPI glUniformHandleui64ARB( GLint location, GLuint64 value )
 {
     struct glUniformHandleui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .value = value };
-    NTSTATUS status;
     TRACE( "location %d, value %s\n", location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glUniformHandleui64ARB, &args ))) WARN( "glUniformHandleui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glUniformHandleui64ARB, &args );
 }
 
 static void WINAPI glUniformHandleui64NV( GLint location, GLuint64 value )
 {
     struct glUniformHandleui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .value = value };
-    NTSTATUS status;
     TRACE( "location %d, value %s\n", location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glUniformHandleui64NV, &args ))) WARN( "glUniformHandleui64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniformHandleui64NV, &args );
 }
 
 static void WINAPI glUniformHandleui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -20633,9 +19613,8 @@ static void WINAPI glUniformSubroutinesuiv( GLenum shadertype, GLsizei count, co
 static void WINAPI glUniformui64NV( GLint location, GLuint64EXT value )
 {
     struct glUniformui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .value = value };
-    NTSTATUS status;
     TRACE( "location %d, value %s\n", location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glUniformui64NV, &args ))) WARN( "glUniformui64NV returned %#lx\n", status );
+    UNIX_BATCH( glUniformui64NV, &args );
 }
 
 static void WINAPI glUniformui64vNV( GLint location, GLsizei count, const GLuint64EXT *value )
@@ -20649,25 +19628,22 @@ static void WINAPI glUniformui64vNV( GLint location, GLsizei count, const GLuint
 static void WINAPI glUnlockArraysEXT(void)
 {
     struct glUnlockArraysEXT_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glUnlockArraysEXT, &args ))) WARN( "glUnlockArraysEXT returned %#lx\n", status );
+    UNIX_BATCH( glUnlockArraysEXT, &args );
 }
 
 static void WINAPI glUnmapObjectBufferATI( GLuint buffer )
 {
     struct glUnmapObjectBufferATI_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
-    NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glUnmapObjectBufferATI, &args ))) WARN( "glUnmapObjectBufferATI returned %#lx\n", status );
+    UNIX_BATCH( glUnmapObjectBufferATI, &args );
 }
 
 static void WINAPI glUnmapTexture2DINTEL( GLuint texture, GLint level )
 {
     struct glUnmapTexture2DINTEL_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level };
-    NTSTATUS status;
     TRACE( "texture %d, level %d\n", texture, level );
-    if ((status = UNIX_CALL( glUnmapTexture2DINTEL, &args ))) WARN( "glUnmapTexture2DINTEL returned %#lx\n", status );
+    UNIX_BATCH( glUnmapTexture2DINTEL, &args );
 }
 
 static void WINAPI glUpdateObjectBufferATI( GLuint buffer, GLuint offset, GLsizei size, const void *pointer, GLenum preserve )
@@ -20681,49 +19657,43 @@ static void WINAPI glUpdateObjectBufferATI( GLuint buffer, GLuint offset, GLsize
 static void WINAPI glUploadGpuMaskNVX( GLbitfield mask )
 {
     struct glUploadGpuMaskNVX_params args = { .teb = NtCurrentTeb(), .mask = mask };
-    NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glUploadGpuMaskNVX, &args ))) WARN( "glUploadGpuMaskNVX returned %#lx\n", status );
+    UNIX_BATCH( glUploadGpuMaskNVX, &args );
 }
 
 static void WINAPI glUseProgram( GLuint program )
 {
     struct glUseProgram_params args = { .teb = NtCurrentTeb(), .program = program };
-    NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glUseProgram, &args ))) WARN( "glUseProgram returned %#lx\n", status );
+    UNIX_BATCH( glUseProgram, &args );
 }
 
 static void WINAPI glUseProgramObjectARB( GLhandleARB programObj )
 {
     struct glUseProgramObjectARB_params args = { .teb = NtCurrentTeb(), .programObj = programObj };
-    NTSTATUS status;
     TRACE( "programObj %d\n", programObj );
-    if ((status = UNIX_CALL( glUseProgramObjectARB, &args ))) WARN( "glUseProgramObjectARB returned %#lx\n", status );
+    UNIX_BATCH( glUseProgramObjectARB, &args );
 }
 
 static void WINAPI glUseProgramStages( GLuint pipeline, GLbitfield stages, GLuint program )
 {
     struct glUseProgramStages_params args = { .teb = NtCurrentTeb(), .pipeline = pipeline, .stages = stages, .program = program };
-    NTSTATUS status;
     TRACE( "pipeline %d, stages %d, program %d\n", pipeline, stages, program );
-    if ((status = UNIX_CALL( glUseProgramStages, &args ))) WARN( "glUseProgramStages returned %#lx\n", status );
+    UNIX_BATCH( glUseProgramStages, &args );
 }
 
 static void WINAPI glUseShaderProgramEXT( GLenum type, GLuint program )
 {
     struct glUseShaderProgramEXT_params args = { .teb = NtCurrentTeb(), .type = type, .program = program };
-    NTSTATUS status;
     TRACE( "type %d, program %d\n", type, program );
-    if ((status = UNIX_CALL( glUseShaderProgramEXT, &args ))) WARN( "glUseShaderProgramEXT returned %#lx\n", status );
+    UNIX_BATCH( glUseShaderProgramEXT, &args );
 }
 
 static void WINAPI glVDPAUFiniNV(void)
 {
     struct glVDPAUFiniNV_params args = { .teb = NtCurrentTeb() };
-    NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glVDPAUFiniNV, &args ))) WARN( "glVDPAUFiniNV returned %#lx\n", status );
+    UNIX_BATCH( glVDPAUFiniNV, &args );
 }
 
 static void WINAPI glVDPAUGetSurfaceivNV( GLvdpauSurfaceNV surface, GLenum pname, GLsizei count, GLsizei *length, GLint *values )
@@ -20789,9 +19759,8 @@ static GLvdpauSurfaceNV WINAPI glVDPAURegisterVideoSurfaceWithPictureStructureNV
 static void WINAPI glVDPAUSurfaceAccessNV( GLvdpauSurfaceNV surface, GLenum access )
 {
     struct glVDPAUSurfaceAccessNV_params args = { .teb = NtCurrentTeb(), .surface = surface, .access = access };
-    NTSTATUS status;
     TRACE( "surface %Id, access %d\n", surface, access );
-    if ((status = UNIX_CALL( glVDPAUSurfaceAccessNV, &args ))) WARN( "glVDPAUSurfaceAccessNV returned %#lx\n", status );
+    UNIX_BATCH( glVDPAUSurfaceAccessNV, &args );
 }
 
 static void WINAPI glVDPAUUnmapSurfacesNV( GLsizei numSurface, const GLvdpauSurfaceNV *surfaces )
@@ -20805,41 +19774,36 @@ static void WINAPI glVDPAUUnmapSurfacesNV( GLsizei numSurface, const GLvdpauSurf
 static void WINAPI glVDPAUUnregisterSurfaceNV( GLvdpauSurfaceNV surface )
 {
     struct glVDPAUUnregisterSurfaceNV_params args = { .teb = NtCurrentTeb(), .surface = surface };
-    NTSTATUS status;
     TRACE( "surface %Id\n", surface );
-    if ((status = UNIX_CALL( glVDPAUUnregisterSurfaceNV, &args ))) WARN( "glVDPAUUnregisterSurfaceNV returned %#lx\n", status );
+    UNIX_BATCH( glVDPAUUnregisterSurfaceNV, &args );
 }
 
 static void WINAPI glValidateProgram( GLuint program )
 {
     struct glValidateProgram_params args = { .teb = NtCurrentTeb(), .program = program };
-    NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glValidateProgram, &args ))) WARN( "glValidateProgram returned %#lx\n", status );
+    UNIX_BATCH( glValidateProgram, &args );
 }
 
 static void WINAPI glValidateProgramARB( GLhandleARB programObj )
 {
     struct glValidateProgramARB_params args = { .teb = NtCurrentTeb(), .programObj = programObj };
-    NTSTATUS status;
     TRACE( "programObj %d\n", programObj );
-    if ((status = UNIX_CALL( glValidateProgramARB, &args ))) WARN( "glValidateProgramARB returned %#lx\n", status );
+    UNIX_BATCH( glValidateProgramARB, &args );
 }
 
 static void WINAPI glValidateProgramPipeline( GLuint pipeline )
 {
     struct glValidateProgramPipeline_params args = { .teb = NtCurrentTeb(), .pipeline = pipeline };
-    NTSTATUS status;
     TRACE( "pipeline %d\n", pipeline );
-    if ((status = UNIX_CALL( glValidateProgramPipeline, &args ))) WARN( "glValidateProgramPipeline returned %#lx\n", status );
+    UNIX_BATCH( glValidateProgramPipeline, &args );
 }
 
 static void WINAPI glVariantArrayObjectATI( GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset )
 {
     struct glVariantArrayObjectATI_params args = { .teb = NtCurrentTeb(), .id = id, .type = type, .stride = stride, .buffer = buffer, .offset = offset };
-    NTSTATUS status;
     TRACE( "id %d, type %d, stride %d, buffer %d, offset %d\n", id, type, stride, buffer, offset );
-    if ((status = UNIX_CALL( glVariantArrayObjectATI, &args ))) WARN( "glVariantArrayObjectATI returned %#lx\n", status );
+    UNIX_BATCH( glVariantArrayObjectATI, &args );
 }
 
 static void WINAPI glVariantPointerEXT( GLuint id, GLenum type, GLuint stride, const void *addr )
@@ -20917,9 +19881,8 @@ static void WINAPI glVariantusvEXT( GLuint id, const GLushort *addr )
 static void WINAPI glVertex2bOES( GLbyte x, GLbyte y )
 {
     struct glVertex2bOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex2bOES, &args ))) WARN( "glVertex2bOES returned %#lx\n", status );
+    UNIX_BATCH( glVertex2bOES, &args );
 }
 
 static void WINAPI glVertex2bvOES( const GLbyte *coords )
@@ -20933,9 +19896,8 @@ static void WINAPI glVertex2bvOES( const GLbyte *coords )
 static void WINAPI glVertex2hNV( GLhalfNV x, GLhalfNV y )
 {
     struct glVertex2hNV_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex2hNV, &args ))) WARN( "glVertex2hNV returned %#lx\n", status );
+    UNIX_BATCH( glVertex2hNV, &args );
 }
 
 static void WINAPI glVertex2hvNV( const GLhalfNV *v )
@@ -20949,9 +19911,8 @@ static void WINAPI glVertex2hvNV( const GLhalfNV *v )
 static void WINAPI glVertex2xOES( GLfixed x )
 {
     struct glVertex2xOES_params args = { .teb = NtCurrentTeb(), .x = x };
-    NTSTATUS status;
     TRACE( "x %d\n", x );
-    if ((status = UNIX_CALL( glVertex2xOES, &args ))) WARN( "glVertex2xOES returned %#lx\n", status );
+    UNIX_BATCH( glVertex2xOES, &args );
 }
 
 static void WINAPI glVertex2xvOES( const GLfixed *coords )
@@ -20965,9 +19926,8 @@ static void WINAPI glVertex2xvOES( const GLfixed *coords )
 static void WINAPI glVertex3bOES( GLbyte x, GLbyte y, GLbyte z )
 {
     struct glVertex3bOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3bOES, &args ))) WARN( "glVertex3bOES returned %#lx\n", status );
+    UNIX_BATCH( glVertex3bOES, &args );
 }
 
 static void WINAPI glVertex3bvOES( const GLbyte *coords )
@@ -20981,9 +19941,8 @@ static void WINAPI glVertex3bvOES( const GLbyte *coords )
 static void WINAPI glVertex3hNV( GLhalfNV x, GLhalfNV y, GLhalfNV z )
 {
     struct glVertex3hNV_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3hNV, &args ))) WARN( "glVertex3hNV returned %#lx\n", status );
+    UNIX_BATCH( glVertex3hNV, &args );
 }
 
 static void WINAPI glVertex3hvNV( const GLhalfNV *v )
@@ -20997,9 +19956,8 @@ static void WINAPI glVertex3hvNV( const GLhalfNV *v )
 static void WINAPI glVertex3xOES( GLfixed x, GLfixed y )
 {
     struct glVertex3xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex3xOES, &args ))) WARN( "glVertex3xOES returned %#lx\n", status );
+    UNIX_BATCH( glVertex3xOES, &args );
 }
 
 static void WINAPI glVertex3xvOES( const GLfixed *coords )
@@ -21013,9 +19971,8 @@ static void WINAPI glVertex3xvOES( const GLfixed *coords )
 static void WINAPI glVertex4bOES( GLbyte x, GLbyte y, GLbyte z, GLbyte w )
 {
     struct glVertex4bOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4bOES, &args ))) WARN( "glVertex4bOES returned %#lx\n", status );
+    UNIX_BATCH( glVertex4bOES, &args );
 }
 
 static void WINAPI glVertex4bvOES( const GLbyte *coords )
@@ -21029,9 +19986,8 @@ static void WINAPI glVertex4bvOES( const GLbyte *coords )
 static void WINAPI glVertex4hNV( GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w )
 {
     struct glVertex4hNV_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4hNV, &args ))) WARN( "glVertex4hNV returned %#lx\n", status );
+    UNIX_BATCH( glVertex4hNV, &args );
 }
 
 static void WINAPI glVertex4hvNV( const GLhalfNV *v )
@@ -21045,9 +20001,8 @@ static void WINAPI glVertex4hvNV( const GLhalfNV *v )
 static void WINAPI glVertex4xOES( GLfixed x, GLfixed y, GLfixed z )
 {
     struct glVertex4xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex4xOES, &args ))) WARN( "glVertex4xOES returned %#lx\n", status );
+    UNIX_BATCH( glVertex4xOES, &args );
 }
 
 static void WINAPI glVertex4xvOES( const GLfixed *coords )
@@ -21061,33 +20016,29 @@ static void WINAPI glVertex4xvOES( const GLfixed *coords )
 static void WINAPI glVertexArrayAttribBinding( GLuint vaobj, GLuint attribindex, GLuint bindingindex )
 {
     struct glVertexArrayAttribBinding_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .bindingindex = bindingindex };
-    NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, bindingindex %d\n", vaobj, attribindex, bindingindex );
-    if ((status = UNIX_CALL( glVertexArrayAttribBinding, &args ))) WARN( "glVertexArrayAttribBinding returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayAttribBinding, &args );
 }
 
 static void WINAPI glVertexArrayAttribFormat( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset )
 {
     struct glVertexArrayAttribFormat_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .normalized = normalized, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, normalized %d, relativeoffset %d\n", vaobj, attribindex, size, type, normalized, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayAttribFormat, &args ))) WARN( "glVertexArrayAttribFormat returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayAttribFormat, &args );
 }
 
 static void WINAPI glVertexArrayAttribIFormat( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
 {
     struct glVertexArrayAttribIFormat_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, relativeoffset %d\n", vaobj, attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayAttribIFormat, &args ))) WARN( "glVertexArrayAttribIFormat returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayAttribIFormat, &args );
 }
 
 static void WINAPI glVertexArrayAttribLFormat( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
 {
     struct glVertexArrayAttribLFormat_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, relativeoffset %d\n", vaobj, attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayAttribLFormat, &args ))) WARN( "glVertexArrayAttribLFormat returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayAttribLFormat, &args );
 }
 
 static void WINAPI glVertexArrayBindVertexBufferEXT( GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride )
@@ -21101,9 +20052,8 @@ static void WINAPI glVertexArrayBindVertexBufferEXT( GLuint vaobj, GLuint bindin
 static void WINAPI glVertexArrayBindingDivisor( GLuint vaobj, GLuint bindingindex, GLuint divisor )
 {
     struct glVertexArrayBindingDivisor_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .bindingindex = bindingindex, .divisor = divisor };
-    NTSTATUS status;
     TRACE( "vaobj %d, bindingindex %d, divisor %d\n", vaobj, bindingindex, divisor );
-    if ((status = UNIX_CALL( glVertexArrayBindingDivisor, &args ))) WARN( "glVertexArrayBindingDivisor returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayBindingDivisor, &args );
 }
 
 static void WINAPI glVertexArrayColorOffsetEXT( GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset )
@@ -21125,9 +20075,8 @@ static void WINAPI glVertexArrayEdgeFlagOffsetEXT( GLuint vaobj, GLuint buffer,
 static void WINAPI glVertexArrayElementBuffer( GLuint vaobj, GLuint buffer )
 {
     struct glVertexArrayElementBuffer_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .buffer = buffer };
-    NTSTATUS status;
     TRACE( "vaobj %d, buffer %d\n", vaobj, buffer );
-    if ((status = UNIX_CALL( glVertexArrayElementBuffer, &args ))) WARN( "glVertexArrayElementBuffer returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayElementBuffer, &args );
 }
 
 static void WINAPI glVertexArrayFogCoordOffsetEXT( GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset )
@@ -21165,9 +20114,8 @@ static void WINAPI glVertexArrayNormalOffsetEXT( GLuint vaobj, GLuint buffer, GL
 static void WINAPI glVertexArrayParameteriAPPLE( GLenum pname, GLint param )
 {
     struct glVertexArrayParameteriAPPLE_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glVertexArrayParameteriAPPLE, &args ))) WARN( "glVertexArrayParameteriAPPLE returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayParameteriAPPLE, &args );
 }
 
 static void WINAPI glVertexArrayRangeAPPLE( GLsizei length, void *pointer )
@@ -21205,33 +20153,29 @@ static void WINAPI glVertexArrayTexCoordOffsetEXT( GLuint vaobj, GLuint buffer,
 static void WINAPI glVertexArrayVertexAttribBindingEXT( GLuint vaobj, GLuint attribindex, GLuint bindingindex )
 {
     struct glVertexArrayVertexAttribBindingEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .bindingindex = bindingindex };
-    NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, bindingindex %d\n", vaobj, attribindex, bindingindex );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribBindingEXT, &args ))) WARN( "glVertexArrayVertexAttribBindingEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayVertexAttribBindingEXT, &args );
 }
 
 static void WINAPI glVertexArrayVertexAttribDivisorEXT( GLuint vaobj, GLuint index, GLuint divisor )
 {
     struct glVertexArrayVertexAttribDivisorEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index, .divisor = divisor };
-    NTSTATUS status;
     TRACE( "vaobj %d, index %d, divisor %d\n", vaobj, index, divisor );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribDivisorEXT, &args ))) WARN( "glVertexArrayVertexAttribDivisorEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayVertexAttribDivisorEXT, &args );
 }
 
 static void WINAPI glVertexArrayVertexAttribFormatEXT( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset )
 {
     struct glVertexArrayVertexAttribFormatEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .normalized = normalized, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, normalized %d, relativeoffset %d\n", vaobj, attribindex, size, type, normalized, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribFormatEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayVertexAttribFormatEXT, &args );
 }
 
 static void WINAPI glVertexArrayVertexAttribIFormatEXT( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
 {
     struct glVertexArrayVertexAttribIFormatEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, relativeoffset %d\n", vaobj, attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribIFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribIFormatEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayVertexAttribIFormatEXT, &args );
 }
 
 static void WINAPI glVertexArrayVertexAttribIOffsetEXT( GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset )
@@ -21245,9 +20189,8 @@ static void WINAPI glVertexArrayVertexAttribIOffsetEXT( GLuint vaobj, GLuint buf
 static void WINAPI glVertexArrayVertexAttribLFormatEXT( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
 {
     struct glVertexArrayVertexAttribLFormatEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, relativeoffset %d\n", vaobj, attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribLFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribLFormatEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayVertexAttribLFormatEXT, &args );
 }
 
 static void WINAPI glVertexArrayVertexAttribLOffsetEXT( GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset )
@@ -21269,9 +20212,8 @@ static void WINAPI glVertexArrayVertexAttribOffsetEXT( GLuint vaobj, GLuint buff
 static void WINAPI glVertexArrayVertexBindingDivisorEXT( GLuint vaobj, GLuint bindingindex, GLuint divisor )
 {
     struct glVertexArrayVertexBindingDivisorEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .bindingindex = bindingindex, .divisor = divisor };
-    NTSTATUS status;
     TRACE( "vaobj %d, bindingindex %d, divisor %d\n", vaobj, bindingindex, divisor );
-    if ((status = UNIX_CALL( glVertexArrayVertexBindingDivisorEXT, &args ))) WARN( "glVertexArrayVertexBindingDivisorEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexArrayVertexBindingDivisorEXT, &args );
 }
 
 static void WINAPI glVertexArrayVertexBuffer( GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride )
@@ -21301,25 +20243,22 @@ static void WINAPI glVertexArrayVertexOffsetEXT( GLuint vaobj, GLuint buffer, GL
 static void WINAPI glVertexAttrib1d( GLuint index, GLdouble x )
 {
     struct glVertexAttrib1d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1d, &args ))) WARN( "glVertexAttrib1d returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1d, &args );
 }
 
 static void WINAPI glVertexAttrib1dARB( GLuint index, GLdouble x )
 {
     struct glVertexAttrib1dARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1dARB, &args ))) WARN( "glVertexAttrib1dARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1dARB, &args );
 }
 
 static void WINAPI glVertexAttrib1dNV( GLuint index, GLdouble x )
 {
     struct glVertexAttrib1dNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1dNV, &args ))) WARN( "glVertexAttrib1dNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1dNV, &args );
 }
 
 static void WINAPI glVertexAttrib1dv( GLuint index, const GLdouble *v )
@@ -21349,25 +20288,22 @@ static void WINAPI glVertexAttrib1dvNV( GLuint index, const GLdouble *v )
 static void WINAPI glVertexAttrib1f( GLuint index, GLfloat x )
 {
     struct glVertexAttrib1f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1f, &args ))) WARN( "glVertexAttrib1f returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1f, &args );
 }
 
 static void WINAPI glVertexAttrib1fARB( GLuint index, GLfloat x )
 {
     struct glVertexAttrib1fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1fARB, &args ))) WARN( "glVertexAttrib1fARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1fARB, &args );
 }
 
 static void WINAPI glVertexAttrib1fNV( GLuint index, GLfloat x )
 {
     struct glVertexAttrib1fNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1fNV, &args ))) WARN( "glVertexAttrib1fNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1fNV, &args );
 }
 
 static void WINAPI glVertexAttrib1fv( GLuint index, const GLfloat *v )
@@ -21397,9 +20333,8 @@ static void WINAPI glVertexAttrib1fvNV( GLuint index, const GLfloat *v )
 static void WINAPI glVertexAttrib1hNV( GLuint index, GLhalfNV x )
 {
     struct glVertexAttrib1hNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1hNV, &args ))) WARN( "glVertexAttrib1hNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1hNV, &args );
 }
 
 static void WINAPI glVertexAttrib1hvNV( GLuint index, const GLhalfNV *v )
@@ -21413,25 +20348,22 @@ static void WINAPI glVertexAttrib1hvNV( GLuint index, const GLhalfNV *v )
 static void WINAPI glVertexAttrib1s( GLuint index, GLshort x )
 {
     struct glVertexAttrib1s_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1s, &args ))) WARN( "glVertexAttrib1s returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1s, &args );
 }
 
 static void WINAPI glVertexAttrib1sARB( GLuint index, GLshort x )
 {
     struct glVertexAttrib1sARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1sARB, &args ))) WARN( "glVertexAttrib1sARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1sARB, &args );
 }
 
 static void WINAPI glVertexAttrib1sNV( GLuint index, GLshort x )
 {
     struct glVertexAttrib1sNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1sNV, &args ))) WARN( "glVertexAttrib1sNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib1sNV, &args );
 }
 
 static void WINAPI glVertexAttrib1sv( GLuint index, const GLshort *v )
@@ -21461,25 +20393,22 @@ static void WINAPI glVertexAttrib1svNV( GLuint index, const GLshort *v )
 static void WINAPI glVertexAttrib2d( GLuint index, GLdouble x, GLdouble y )
 {
     struct glVertexAttrib2d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2d, &args ))) WARN( "glVertexAttrib2d returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2d, &args );
 }
 
 static void WINAPI glVertexAttrib2dARB( GLuint index, GLdouble x, GLdouble y )
 {
     struct glVertexAttrib2dARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2dARB, &args ))) WARN( "glVertexAttrib2dARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2dARB, &args );
 }
 
 static void WINAPI glVertexAttrib2dNV( GLuint index, GLdouble x, GLdouble y )
 {
     struct glVertexAttrib2dNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2dNV, &args ))) WARN( "glVertexAttrib2dNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2dNV, &args );
 }
 
 static void WINAPI glVertexAttrib2dv( GLuint index, const GLdouble *v )
@@ -21509,25 +20438,22 @@ static void WINAPI glVertexAttrib2dvNV( GLuint index, const GLdouble *v )
 static void WINAPI glVertexAttrib2f( GLuint index, GLfloat x, GLfloat y )
 {
     struct glVertexAttrib2f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2f, &args ))) WARN( "glVertexAttrib2f returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2f, &args );
 }
 
 static void WINAPI glVertexAttrib2fARB( GLuint index, GLfloat x, GLfloat y )
 {
     struct glVertexAttrib2fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2fARB, &args ))) WARN( "glVertexAttrib2fARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2fARB, &args );
 }
 
 static void WINAPI glVertexAttrib2fNV( GLuint index, GLfloat x, GLfloat y )
 {
     struct glVertexAttrib2fNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2fNV, &args ))) WARN( "glVertexAttrib2fNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2fNV, &args );
 }
 
 static void WINAPI glVertexAttrib2fv( GLuint index, const GLfloat *v )
@@ -21557,9 +20483,8 @@ static void WINAPI glVertexAttrib2fvNV( GLuint index, const GLfloat *v )
 static void WINAPI glVertexAttrib2hNV( GLuint index, GLhalfNV x, GLhalfNV y )
 {
     struct glVertexAttrib2hNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2hNV, &args ))) WARN( "glVertexAttrib2hNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2hNV, &args );
 }
 
 static void WINAPI glVertexAttrib2hvNV( GLuint index, const GLhalfNV *v )
@@ -21573,25 +20498,22 @@ static void WINAPI glVertexAttrib2hvNV( GLuint index, const GLhalfNV *v )
 static void WINAPI glVertexAttrib2s( GLuint index, GLshort x, GLshort y )
 {
     struct glVertexAttrib2s_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2s, &args ))) WARN( "glVertexAttrib2s returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2s, &args );
 }
 
 static void WINAPI glVertexAttrib2sARB( GLuint index, GLshort x, GLshort y )
 {
     struct glVertexAttrib2sARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2sARB, &args ))) WARN( "glVertexAttrib2sARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2sARB, &args );
 }
 
 static void WINAPI glVertexAttrib2sNV( GLuint index, GLshort x, GLshort y )
 {
     struct glVertexAttrib2sNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2sNV, &args ))) WARN( "glVertexAttrib2sNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib2sNV, &args );
 }
 
 static void WINAPI glVertexAttrib2sv( GLuint index, const GLshort *v )
@@ -21621,25 +20543,22 @@ static void WINAPI glVertexAttrib2svNV( GLuint index, const GLshort *v )
 static void WINAPI glVertexAttrib3d( GLuint index, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glVertexAttrib3d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3d, &args ))) WARN( "glVertexAttrib3d returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3d, &args );
 }
 
 static void WINAPI glVertexAttrib3dARB( GLuint index, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glVertexAttrib3dARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3dARB, &args ))) WARN( "glVertexAttrib3dARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3dARB, &args );
 }
 
 static void WINAPI glVertexAttrib3dNV( GLuint index, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glVertexAttrib3dNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3dNV, &args ))) WARN( "glVertexAttrib3dNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3dNV, &args );
 }
 
 static void WINAPI glVertexAttrib3dv( GLuint index, const GLdouble *v )
@@ -21669,25 +20588,22 @@ static void WINAPI glVertexAttrib3dvNV( GLuint index, const GLdouble *v )
 static void WINAPI glVertexAttrib3f( GLuint index, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glVertexAttrib3f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3f, &args ))) WARN( "glVertexAttrib3f returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3f, &args );
 }
 
 static void WINAPI glVertexAttrib3fARB( GLuint index, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glVertexAttrib3fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3fARB, &args ))) WARN( "glVertexAttrib3fARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3fARB, &args );
 }
 
 static void WINAPI glVertexAttrib3fNV( GLuint index, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glVertexAttrib3fNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3fNV, &args ))) WARN( "glVertexAttrib3fNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3fNV, &args );
 }
 
 static void WINAPI glVertexAttrib3fv( GLuint index, const GLfloat *v )
@@ -21717,9 +20633,8 @@ static void WINAPI glVertexAttrib3fvNV( GLuint index, const GLfloat *v )
 static void WINAPI glVertexAttrib3hNV( GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z )
 {
     struct glVertexAttrib3hNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3hNV, &args ))) WARN( "glVertexAttrib3hNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3hNV, &args );
 }
 
 static void WINAPI glVertexAttrib3hvNV( GLuint index, const GLhalfNV *v )
@@ -21733,25 +20648,22 @@ static void WINAPI glVertexAttrib3hvNV( GLuint index, const GLhalfNV *v )
 static void WINAPI glVertexAttrib3s( GLuint index, GLshort x, GLshort y, GLshort z )
 {
     struct glVertexAttrib3s_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3s, &args ))) WARN( "glVertexAttrib3s returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3s, &args );
 }
 
 static void WINAPI glVertexAttrib3sARB( GLuint index, GLshort x, GLshort y, GLshort z )
 {
     struct glVertexAttrib3sARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3sARB, &args ))) WARN( "glVertexAttrib3sARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3sARB, &args );
 }
 
 static void WINAPI glVertexAttrib3sNV( GLuint index, GLshort x, GLshort y, GLshort z )
 {
     struct glVertexAttrib3sNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3sNV, &args ))) WARN( "glVertexAttrib3sNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib3sNV, &args );
 }
 
 static void WINAPI glVertexAttrib3sv( GLuint index, const GLshort *v )
@@ -21829,17 +20741,15 @@ static void WINAPI glVertexAttrib4NsvARB( GLuint index, const GLshort *v )
 static void WINAPI glVertexAttrib4Nub( GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w )
 {
     struct glVertexAttrib4Nub_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4Nub, &args ))) WARN( "glVertexAttrib4Nub returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4Nub, &args );
 }
 
 static void WINAPI glVertexAttrib4NubARB( GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w )
 {
     struct glVertexAttrib4NubARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4NubARB, &args ))) WARN( "glVertexAttrib4NubARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4NubARB, &args );
 }
 
 static void WINAPI glVertexAttrib4Nubv( GLuint index, const GLubyte *v )
@@ -21909,25 +20819,22 @@ static void WINAPI glVertexAttrib4bvARB( GLuint index, const GLbyte *v )
 static void WINAPI glVertexAttrib4d( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glVertexAttrib4d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4d, &args ))) WARN( "glVertexAttrib4d returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4d, &args );
 }
 
 static void WINAPI glVertexAttrib4dARB( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glVertexAttrib4dARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4dARB, &args ))) WARN( "glVertexAttrib4dARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4dARB, &args );
 }
 
 static void WINAPI glVertexAttrib4dNV( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glVertexAttrib4dNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4dNV, &args ))) WARN( "glVertexAttrib4dNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4dNV, &args );
 }
 
 static void WINAPI glVertexAttrib4dv( GLuint index, const GLdouble *v )
@@ -21957,25 +20864,22 @@ static void WINAPI glVertexAttrib4dvNV( GLuint index, const GLdouble *v )
 static void WINAPI glVertexAttrib4f( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glVertexAttrib4f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4f, &args ))) WARN( "glVertexAttrib4f returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4f, &args );
 }
 
 static void WINAPI glVertexAttrib4fARB( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glVertexAttrib4fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4fARB, &args ))) WARN( "glVertexAttrib4fARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4fARB, &args );
 }
 
 static void WINAPI glVertexAttrib4fNV( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glVertexAttrib4fNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4fNV, &args ))) WARN( "glVertexAttrib4fNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4fNV, &args );
 }
 
 static void WINAPI glVertexAttrib4fv( GLuint index, const GLfloat *v )
@@ -22005,9 +20909,8 @@ static void WINAPI glVertexAttrib4fvNV( GLuint index, const GLfloat *v )
 static void WINAPI glVertexAttrib4hNV( GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w )
 {
     struct glVertexAttrib4hNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4hNV, &args ))) WARN( "glVertexAttrib4hNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4hNV, &args );
 }
 
 static void WINAPI glVertexAttrib4hvNV( GLuint index, const GLhalfNV *v )
@@ -22037,25 +20940,22 @@ static void WINAPI glVertexAttrib4ivARB( GLuint index, const GLint *v )
 static void WINAPI glVertexAttrib4s( GLuint index, GLshort x, GLshort y, GLshort z, GLshort w )
 {
     struct glVertexAttrib4s_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4s, &args ))) WARN( "glVertexAttrib4s returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4s, &args );
 }
 
 static void WINAPI glVertexAttrib4sARB( GLuint index, GLshort x, GLshort y, GLshort z, GLshort w )
 {
     struct glVertexAttrib4sARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4sARB, &args ))) WARN( "glVertexAttrib4sARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4sARB, &args );
 }
 
 static void WINAPI glVertexAttrib4sNV( GLuint index, GLshort x, GLshort y, GLshort z, GLshort w )
 {
     struct glVertexAttrib4sNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4sNV, &args ))) WARN( "glVertexAttrib4sNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4sNV, &args );
 }
 
 static void WINAPI glVertexAttrib4sv( GLuint index, const GLshort *v )
@@ -22085,9 +20985,8 @@ static void WINAPI glVertexAttrib4svNV( GLuint index, const GLshort *v )
 static void WINAPI glVertexAttrib4ubNV( GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w )
 {
     struct glVertexAttrib4ubNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4ubNV, &args ))) WARN( "glVertexAttrib4ubNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttrib4ubNV, &args );
 }
 
 static void WINAPI glVertexAttrib4ubv( GLuint index, const GLubyte *v )
@@ -22149,65 +21048,57 @@ static void WINAPI glVertexAttrib4usvARB( GLuint index, const GLushort *v )
 static void WINAPI glVertexAttribArrayObjectATI( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset )
 {
     struct glVertexAttribArrayObjectATI_params args = { .teb = NtCurrentTeb(), .index = index, .size = size, .type = type, .normalized = normalized, .stride = stride, .buffer = buffer, .offset = offset };
-    NTSTATUS status;
     TRACE( "index %d, size %d, type %d, normalized %d, stride %d, buffer %d, offset %d\n", index, size, type, normalized, stride, buffer, offset );
-    if ((status = UNIX_CALL( glVertexAttribArrayObjectATI, &args ))) WARN( "glVertexAttribArrayObjectATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribArrayObjectATI, &args );
 }
 
 static void WINAPI glVertexAttribBinding( GLuint attribindex, GLuint bindingindex )
 {
     struct glVertexAttribBinding_params args = { .teb = NtCurrentTeb(), .attribindex = attribindex, .bindingindex = bindingindex };
-    NTSTATUS status;
     TRACE( "attribindex %d, bindingindex %d\n", attribindex, bindingindex );
-    if ((status = UNIX_CALL( glVertexAttribBinding, &args ))) WARN( "glVertexAttribBinding returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribBinding, &args );
 }
 
 static void WINAPI glVertexAttribDivisor( GLuint index, GLuint divisor )
 {
     struct glVertexAttribDivisor_params args = { .teb = NtCurrentTeb(), .index = index, .divisor = divisor };
-    NTSTATUS status;
     TRACE( "index %d, divisor %d\n", index, divisor );
-    if ((status = UNIX_CALL( glVertexAttribDivisor, &args ))) WARN( "glVertexAttribDivisor returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribDivisor, &args );
 }
 
 static void WINAPI glVertexAttribDivisorARB( GLuint index, GLuint divisor )
 {
     struct glVertexAttribDivisorARB_params args = { .teb = NtCurrentTeb(), .index = index, .divisor = divisor };
-    NTSTATUS status;
     TRACE( "index %d, divisor %d\n", index, divisor );
-    if ((status = UNIX_CALL( glVertexAttribDivisorARB, &args ))) WARN( "glVertexAttribDivisorARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribDivisorARB, &args );
 }
 
 static void WINAPI glVertexAttribFormat( GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset )
 {
     struct glVertexAttribFormat_params args = { .teb = NtCurrentTeb(), .attribindex = attribindex, .size = size, .type = type, .normalized = normalized, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "attribindex %d, size %d, type %d, normalized %d, relativeoffset %d\n", attribindex, size, type, normalized, relativeoffset );
-    if ((status = UNIX_CALL( glVertexAttribFormat, &args ))) WARN( "glVertexAttribFormat returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribFormat, &args );
 }
 
 static void WINAPI glVertexAttribFormatNV( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride )
 {
     struct glVertexAttribFormatNV_params args = { .teb = NtCurrentTeb(), .index = index, .size = size, .type = type, .normalized = normalized, .stride = stride };
-    NTSTATUS status;
     TRACE( "index %d, size %d, type %d, normalized %d, stride %d\n", index, size, type, normalized, stride );
-    if ((status = UNIX_CALL( glVertexAttribFormatNV, &args ))) WARN( "glVertexAttribFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribFormatNV, &args );
 }
 
 static void WINAPI glVertexAttribI1i( GLuint index, GLint x )
 {
     struct glVertexAttribI1i_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribI1i, &args ))) WARN( "glVertexAttribI1i returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI1i, &args );
 }
 
 static void WINAPI glVertexAttribI1iEXT( GLuint index, GLint x )
 {
     struct glVertexAttribI1iEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribI1iEXT, &args ))) WARN( "glVertexAttribI1iEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI1iEXT, &args );
 }
 
 static void WINAPI glVertexAttribI1iv( GLuint index, const GLint *v )
@@ -22229,17 +21120,15 @@ static void WINAPI glVertexAttribI1ivEXT( GLuint index, const GLint *v )
 static void WINAPI glVertexAttribI1ui( GLuint index, GLuint x )
 {
     struct glVertexAttribI1ui_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribI1ui, &args ))) WARN( "glVertexAttribI1ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI1ui, &args );
 }
 
 static void WINAPI glVertexAttribI1uiEXT( GLuint index, GLuint x )
 {
     struct glVertexAttribI1uiEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribI1uiEXT, &args ))) WARN( "glVertexAttribI1uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI1uiEXT, &args );
 }
 
 static void WINAPI glVertexAttribI1uiv( GLuint index, const GLuint *v )
@@ -22261,17 +21150,15 @@ static void WINAPI glVertexAttribI1uivEXT( GLuint index, const GLuint *v )
 static void WINAPI glVertexAttribI2i( GLuint index, GLint x, GLint y )
 {
     struct glVertexAttribI2i_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribI2i, &args ))) WARN( "glVertexAttribI2i returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI2i, &args );
 }
 
 static void WINAPI glVertexAttribI2iEXT( GLuint index, GLint x, GLint y )
 {
     struct glVertexAttribI2iEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribI2iEXT, &args ))) WARN( "glVertexAttribI2iEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI2iEXT, &args );
 }
 
 static void WINAPI glVertexAttribI2iv( GLuint index, const GLint *v )
@@ -22293,17 +21180,15 @@ static void WINAPI glVertexAttribI2ivEXT( GLuint index, const GLint *v )
 static void WINAPI glVertexAttribI2ui( GLuint index, GLuint x, GLuint y )
 {
     struct glVertexAttribI2ui_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribI2ui, &args ))) WARN( "glVertexAttribI2ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI2ui, &args );
 }
 
 static void WINAPI glVertexAttribI2uiEXT( GLuint index, GLuint x, GLuint y )
 {
     struct glVertexAttribI2uiEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribI2uiEXT, &args ))) WARN( "glVertexAttribI2uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI2uiEXT, &args );
 }
 
 static void WINAPI glVertexAttribI2uiv( GLuint index, const GLuint *v )
@@ -22325,17 +21210,15 @@ static void WINAPI glVertexAttribI2uivEXT( GLuint index, const GLuint *v )
 static void WINAPI glVertexAttribI3i( GLuint index, GLint x, GLint y, GLint z )
 {
     struct glVertexAttribI3i_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribI3i, &args ))) WARN( "glVertexAttribI3i returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI3i, &args );
 }
 
 static void WINAPI glVertexAttribI3iEXT( GLuint index, GLint x, GLint y, GLint z )
 {
     struct glVertexAttribI3iEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribI3iEXT, &args ))) WARN( "glVertexAttribI3iEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI3iEXT, &args );
 }
 
 static void WINAPI glVertexAttribI3iv( GLuint index, const GLint *v )
@@ -22357,17 +21240,15 @@ static void WINAPI glVertexAttribI3ivEXT( GLuint index, const GLint *v )
 static void WINAPI glVertexAttribI3ui( GLuint index, GLuint x, GLuint y, GLuint z )
 {
     struct glVertexAttribI3ui_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribI3ui, &args ))) WARN( "glVertexAttribI3ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI3ui, &args );
 }
 
 static void WINAPI glVertexAttribI3uiEXT( GLuint index, GLuint x, GLuint y, GLuint z )
 {
     struct glVertexAttribI3uiEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribI3uiEXT, &args ))) WARN( "glVertexAttribI3uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI3uiEXT, &args );
 }
 
 static void WINAPI glVertexAttribI3uiv( GLuint index, const GLuint *v )
@@ -22405,17 +21286,15 @@ static void WINAPI glVertexAttribI4bvEXT( GLuint index, const GLbyte *v )
 static void WINAPI glVertexAttribI4i( GLuint index, GLint x, GLint y, GLint z, GLint w )
 {
     struct glVertexAttribI4i_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribI4i, &args ))) WARN( "glVertexAttribI4i returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI4i, &args );
 }
 
 static void WINAPI glVertexAttribI4iEXT( GLuint index, GLint x, GLint y, GLint z, GLint w )
 {
     struct glVertexAttribI4iEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribI4iEXT, &args ))) WARN( "glVertexAttribI4iEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI4iEXT, &args );
 }
 
 static void WINAPI glVertexAttribI4iv( GLuint index, const GLint *v )
@@ -22469,17 +21348,15 @@ static void WINAPI glVertexAttribI4ubvEXT( GLuint index, const GLubyte *v )
 static void WINAPI glVertexAttribI4ui( GLuint index, GLuint x, GLuint y, GLuint z, GLuint w )
 {
     struct glVertexAttribI4ui_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribI4ui, &args ))) WARN( "glVertexAttribI4ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI4ui, &args );
 }
 
 static void WINAPI glVertexAttribI4uiEXT( GLuint index, GLuint x, GLuint y, GLuint z, GLuint w )
 {
     struct glVertexAttribI4uiEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribI4uiEXT, &args ))) WARN( "glVertexAttribI4uiEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribI4uiEXT, &args );
 }
 
 static void WINAPI glVertexAttribI4uiv( GLuint index, const GLuint *v )
@@ -22517,17 +21394,15 @@ static void WINAPI glVertexAttribI4usvEXT( GLuint index, const GLushort *v )
 static void WINAPI glVertexAttribIFormat( GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
 {
     struct glVertexAttribIFormat_params args = { .teb = NtCurrentTeb(), .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "attribindex %d, size %d, type %d, relativeoffset %d\n", attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexAttribIFormat, &args ))) WARN( "glVertexAttribIFormat returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribIFormat, &args );
 }
 
 static void WINAPI glVertexAttribIFormatNV( GLuint index, GLint size, GLenum type, GLsizei stride )
 {
     struct glVertexAttribIFormatNV_params args = { .teb = NtCurrentTeb(), .index = index, .size = size, .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "index %d, size %d, type %d, stride %d\n", index, size, type, stride );
-    if ((status = UNIX_CALL( glVertexAttribIFormatNV, &args ))) WARN( "glVertexAttribIFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribIFormatNV, &args );
 }
 
 static void WINAPI glVertexAttribIPointer( GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer )
@@ -22549,17 +21424,15 @@ static void WINAPI glVertexAttribIPointerEXT( GLuint index, GLint size, GLenum t
 static void WINAPI glVertexAttribL1d( GLuint index, GLdouble x )
 {
     struct glVertexAttribL1d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribL1d, &args ))) WARN( "glVertexAttribL1d returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL1d, &args );
 }
 
 static void WINAPI glVertexAttribL1dEXT( GLuint index, GLdouble x )
 {
     struct glVertexAttribL1dEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribL1dEXT, &args ))) WARN( "glVertexAttribL1dEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL1dEXT, &args );
 }
 
 static void WINAPI glVertexAttribL1dv( GLuint index, const GLdouble *v )
@@ -22581,9 +21454,8 @@ static void WINAPI glVertexAttribL1dvEXT( GLuint index, const GLdouble *v )
 static void WINAPI glVertexAttribL1i64NV( GLuint index, GLint64EXT x )
 {
     struct glVertexAttribL1i64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %s\n", index, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glVertexAttribL1i64NV, &args ))) WARN( "glVertexAttribL1i64NV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL1i64NV, &args );
 }
 
 static void WINAPI glVertexAttribL1i64vNV( GLuint index, const GLint64EXT *v )
@@ -22597,17 +21469,15 @@ static void WINAPI glVertexAttribL1i64vNV( GLuint index, const GLint64EXT *v )
 static void WINAPI glVertexAttribL1ui64ARB( GLuint index, GLuint64EXT x )
 {
     struct glVertexAttribL1ui64ARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %s\n", index, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glVertexAttribL1ui64ARB, &args ))) WARN( "glVertexAttribL1ui64ARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL1ui64ARB, &args );
 }
 
 static void WINAPI glVertexAttribL1ui64NV( GLuint index, GLuint64EXT x )
 {
     struct glVertexAttribL1ui64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
     TRACE( "index %d, x %s\n", index, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glVertexAttribL1ui64NV, &args ))) WARN( "glVertexAttribL1ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL1ui64NV, &args );
 }
 
 static void WINAPI glVertexAttribL1ui64vARB( GLuint index, const GLuint64EXT *v )
@@ -22629,17 +21499,15 @@ static void WINAPI glVertexAttribL1ui64vNV( GLuint index, const GLuint64EXT *v )
 static void WINAPI glVertexAttribL2d( GLuint index, GLdouble x, GLdouble y )
 {
     struct glVertexAttribL2d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribL2d, &args ))) WARN( "glVertexAttribL2d returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL2d, &args );
 }
 
 static void WINAPI glVertexAttribL2dEXT( GLuint index, GLdouble x, GLdouble y )
 {
     struct glVertexAttribL2dEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribL2dEXT, &args ))) WARN( "glVertexAttribL2dEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL2dEXT, &args );
 }
 
 static void WINAPI glVertexAttribL2dv( GLuint index, const GLdouble *v )
@@ -22661,9 +21529,8 @@ static void WINAPI glVertexAttribL2dvEXT( GLuint index, const GLdouble *v )
 static void WINAPI glVertexAttribL2i64NV( GLuint index, GLint64EXT x, GLint64EXT y )
 {
     struct glVertexAttribL2i64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %s, y %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glVertexAttribL2i64NV, &args ))) WARN( "glVertexAttribL2i64NV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL2i64NV, &args );
 }
 
 static void WINAPI glVertexAttribL2i64vNV( GLuint index, const GLint64EXT *v )
@@ -22677,9 +21544,8 @@ static void WINAPI glVertexAttribL2i64vNV( GLuint index, const GLint64EXT *v )
 static void WINAPI glVertexAttribL2ui64NV( GLuint index, GLuint64EXT x, GLuint64EXT y )
 {
     struct glVertexAttribL2ui64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "index %d, x %s, y %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glVertexAttribL2ui64NV, &args ))) WARN( "glVertexAttribL2ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL2ui64NV, &args );
 }
 
 static void WINAPI glVertexAttribL2ui64vNV( GLuint index, const GLuint64EXT *v )
@@ -22693,17 +21559,15 @@ static void WINAPI glVertexAttribL2ui64vNV( GLuint index, const GLuint64EXT *v )
 static void WINAPI glVertexAttribL3d( GLuint index, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glVertexAttribL3d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribL3d, &args ))) WARN( "glVertexAttribL3d returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL3d, &args );
 }
 
 static void WINAPI glVertexAttribL3dEXT( GLuint index, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glVertexAttribL3dEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribL3dEXT, &args ))) WARN( "glVertexAttribL3dEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL3dEXT, &args );
 }
 
 static void WINAPI glVertexAttribL3dv( GLuint index, const GLdouble *v )
@@ -22725,9 +21589,8 @@ static void WINAPI glVertexAttribL3dvEXT( GLuint index, const GLdouble *v )
 static void WINAPI glVertexAttribL3i64NV( GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z )
 {
     struct glVertexAttribL3i64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %s, y %s, z %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glVertexAttribL3i64NV, &args ))) WARN( "glVertexAttribL3i64NV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL3i64NV, &args );
 }
 
 static void WINAPI glVertexAttribL3i64vNV( GLuint index, const GLint64EXT *v )
@@ -22741,9 +21604,8 @@ static void WINAPI glVertexAttribL3i64vNV( GLuint index, const GLint64EXT *v )
 static void WINAPI glVertexAttribL3ui64NV( GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z )
 {
     struct glVertexAttribL3ui64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "index %d, x %s, y %s, z %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glVertexAttribL3ui64NV, &args ))) WARN( "glVertexAttribL3ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL3ui64NV, &args );
 }
 
 static void WINAPI glVertexAttribL3ui64vNV( GLuint index, const GLuint64EXT *v )
@@ -22757,17 +21619,15 @@ static void WINAPI glVertexAttribL3ui64vNV( GLuint index, const GLuint64EXT *v )
 static void WINAPI glVertexAttribL4d( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glVertexAttribL4d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribL4d, &args ))) WARN( "glVertexAttribL4d returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL4d, &args );
 }
 
 static void WINAPI glVertexAttribL4dEXT( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glVertexAttribL4dEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribL4dEXT, &args ))) WARN( "glVertexAttribL4dEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL4dEXT, &args );
 }
 
 static void WINAPI glVertexAttribL4dv( GLuint index, const GLdouble *v )
@@ -22789,9 +21649,8 @@ static void WINAPI glVertexAttribL4dvEXT( GLuint index, const GLdouble *v )
 static void WINAPI glVertexAttribL4i64NV( GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w )
 {
     struct glVertexAttribL4i64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %s, y %s, z %s, w %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glVertexAttribL4i64NV, &args ))) WARN( "glVertexAttribL4i64NV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL4i64NV, &args );
 }
 
 static void WINAPI glVertexAttribL4i64vNV( GLuint index, const GLint64EXT *v )
@@ -22805,9 +21664,8 @@ static void WINAPI glVertexAttribL4i64vNV( GLuint index, const GLint64EXT *v )
 static void WINAPI glVertexAttribL4ui64NV( GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w )
 {
     struct glVertexAttribL4ui64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "index %d, x %s, y %s, z %s, w %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glVertexAttribL4ui64NV, &args ))) WARN( "glVertexAttribL4ui64NV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribL4ui64NV, &args );
 }
 
 static void WINAPI glVertexAttribL4ui64vNV( GLuint index, const GLuint64EXT *v )
@@ -22821,17 +21679,15 @@ static void WINAPI glVertexAttribL4ui64vNV( GLuint index, const GLuint64EXT *v )
 static void WINAPI glVertexAttribLFormat( GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
 {
     struct glVertexAttribLFormat_params args = { .teb = NtCurrentTeb(), .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
-    NTSTATUS status;
     TRACE( "attribindex %d, size %d, type %d, relativeoffset %d\n", attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexAttribLFormat, &args ))) WARN( "glVertexAttribLFormat returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribLFormat, &args );
 }
 
 static void WINAPI glVertexAttribLFormatNV( GLuint index, GLint size, GLenum type, GLsizei stride )
 {
     struct glVertexAttribLFormatNV_params args = { .teb = NtCurrentTeb(), .index = index, .size = size, .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "index %d, size %d, type %d, stride %d\n", index, size, type, stride );
-    if ((status = UNIX_CALL( glVertexAttribLFormatNV, &args ))) WARN( "glVertexAttribLFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribLFormatNV, &args );
 }
 
 static void WINAPI glVertexAttribLPointer( GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer )
@@ -22853,9 +21709,8 @@ static void WINAPI glVertexAttribLPointerEXT( GLuint index, GLint size, GLenum t
 static void WINAPI glVertexAttribP1ui( GLuint index, GLenum type, GLboolean normalized, GLuint value )
 {
     struct glVertexAttribP1ui_params args = { .teb = NtCurrentTeb(), .index = index, .type = type, .normalized = normalized, .value = value };
-    NTSTATUS status;
     TRACE( "index %d, type %d, normalized %d, value %d\n", index, type, normalized, value );
-    if ((status = UNIX_CALL( glVertexAttribP1ui, &args ))) WARN( "glVertexAttribP1ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribP1ui, &args );
 }
 
 static void WINAPI glVertexAttribP1uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value )
@@ -22869,9 +21724,8 @@ static void WINAPI glVertexAttribP1uiv( GLuint index, GLenum type, GLboolean nor
 static void WINAPI glVertexAttribP2ui( GLuint index, GLenum type, GLboolean normalized, GLuint value )
 {
     struct glVertexAttribP2ui_params args = { .teb = NtCurrentTeb(), .index = index, .type = type, .normalized = normalized, .value = value };
-    NTSTATUS status;
     TRACE( "index %d, type %d, normalized %d, value %d\n", index, type, normalized, value );
-    if ((status = UNIX_CALL( glVertexAttribP2ui, &args ))) WARN( "glVertexAttribP2ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribP2ui, &args );
 }
 
 static void WINAPI glVertexAttribP2uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value )
@@ -22885,9 +21739,8 @@ static void WINAPI glVertexAttribP2uiv( GLuint index, GLenum type, GLboolean nor
 static void WINAPI glVertexAttribP3ui( GLuint index, GLenum type, GLboolean normalized, GLuint value )
 {
     struct glVertexAttribP3ui_params args = { .teb = NtCurrentTeb(), .index = index, .type = type, .normalized = normalized, .value = value };
-    NTSTATUS status;
     TRACE( "index %d, type %d, normalized %d, value %d\n", index, type, normalized, value );
-    if ((status = UNIX_CALL( glVertexAttribP3ui, &args ))) WARN( "glVertexAttribP3ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribP3ui, &args );
 }
 
 static void WINAPI glVertexAttribP3uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value )
@@ -22901,9 +21754,8 @@ static void WINAPI glVertexAttribP3uiv( GLuint index, GLenum type, GLboolean nor
 static void WINAPI glVertexAttribP4ui( GLuint index, GLenum type, GLboolean normalized, GLuint value )
 {
     struct glVertexAttribP4ui_params args = { .teb = NtCurrentTeb(), .index = index, .type = type, .normalized = normalized, .value = value };
-    NTSTATUS status;
     TRACE( "index %d, type %d, normalized %d, value %d\n", index, type, normalized, value );
-    if ((status = UNIX_CALL( glVertexAttribP4ui, &args ))) WARN( "glVertexAttribP4ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribP4ui, &args );
 }
 
 static void WINAPI glVertexAttribP4uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value )
@@ -22917,9 +21769,8 @@ static void WINAPI glVertexAttribP4uiv( GLuint index, GLenum type, GLboolean nor
 static void WINAPI glVertexAttribParameteriAMD( GLuint index, GLenum pname, GLint param )
 {
     struct glVertexAttribParameteriAMD_params args = { .teb = NtCurrentTeb(), .index = index, .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "index %d, pname %d, param %d\n", index, pname, param );
-    if ((status = UNIX_CALL( glVertexAttribParameteriAMD, &args ))) WARN( "glVertexAttribParameteriAMD returned %#lx\n", status );
+    UNIX_BATCH( glVertexAttribParameteriAMD, &args );
 }
 
 static void WINAPI glVertexAttribPointer( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer )
@@ -23085,49 +21936,43 @@ static void WINAPI glVertexAttribs4ubvNV( GLuint index, GLsizei count, const GLu
 static void WINAPI glVertexBindingDivisor( GLuint bindingindex, GLuint divisor )
 {
     struct glVertexBindingDivisor_params args = { .teb = NtCurrentTeb(), .bindingindex = bindingindex, .divisor = divisor };
-    NTSTATUS status;
     TRACE( "bindingindex %d, divisor %d\n", bindingindex, divisor );
-    if ((status = UNIX_CALL( glVertexBindingDivisor, &args ))) WARN( "glVertexBindingDivisor returned %#lx\n", status );
+    UNIX_BATCH( glVertexBindingDivisor, &args );
 }
 
 static void WINAPI glVertexBlendARB( GLint count )
 {
     struct glVertexBlendARB_params args = { .teb = NtCurrentTeb(), .count = count };
-    NTSTATUS status;
     TRACE( "count %d\n", count );
-    if ((status = UNIX_CALL( glVertexBlendARB, &args ))) WARN( "glVertexBlendARB returned %#lx\n", status );
+    UNIX_BATCH( glVertexBlendARB, &args );
 }
 
 static void WINAPI glVertexBlendEnvfATI( GLenum pname, GLfloat param )
 {
     struct glVertexBlendEnvfATI_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glVertexBlendEnvfATI, &args ))) WARN( "glVertexBlendEnvfATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexBlendEnvfATI, &args );
 }
 
 static void WINAPI glVertexBlendEnviATI( GLenum pname, GLint param )
 {
     struct glVertexBlendEnviATI_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
-    NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glVertexBlendEnviATI, &args ))) WARN( "glVertexBlendEnviATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexBlendEnviATI, &args );
 }
 
 static void WINAPI glVertexFormatNV( GLint size, GLenum type, GLsizei stride )
 {
     struct glVertexFormatNV_params args = { .teb = NtCurrentTeb(), .size = size, .type = type, .stride = stride };
-    NTSTATUS status;
     TRACE( "size %d, type %d, stride %d\n", size, type, stride );
-    if ((status = UNIX_CALL( glVertexFormatNV, &args ))) WARN( "glVertexFormatNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexFormatNV, &args );
 }
 
 static void WINAPI glVertexP2ui( GLenum type, GLuint value )
 {
     struct glVertexP2ui_params args = { .teb = NtCurrentTeb(), .type = type, .value = value };
-    NTSTATUS status;
     TRACE( "type %d, value %d\n", type, value );
-    if ((status = UNIX_CALL( glVertexP2ui, &args ))) WARN( "glVertexP2ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexP2ui, &args );
 }
 
 static void WINAPI glVertexP2uiv( GLenum type, const GLuint *value )
@@ -23141,9 +21986,8 @@ static void WINAPI glVertexP2uiv( GLenum type, const GLuint *value )
 static void WINAPI glVertexP3ui( GLenum type, GLuint value )
 {
     struct glVertexP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .value = value };
-    NTSTATUS status;
     TRACE( "type %d, value %d\n", type, value );
-    if ((status = UNIX_CALL( glVertexP3ui, &args ))) WARN( "glVertexP3ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexP3ui, &args );
 }
 
 static void WINAPI glVertexP3uiv( GLenum type, const GLuint *value )
@@ -23157,9 +22001,8 @@ static void WINAPI glVertexP3uiv( GLenum type, const GLuint *value )
 static void WINAPI glVertexP4ui( GLenum type, GLuint value )
 {
     struct glVertexP4ui_params args = { .teb = NtCurrentTeb(), .type = type, .value = value };
-    NTSTATUS status;
     TRACE( "type %d, value %d\n", type, value );
-    if ((status = UNIX_CALL( glVertexP4ui, &args ))) WARN( "glVertexP4ui returned %#lx\n", status );
+    UNIX_BATCH( glVertexP4ui, &args );
 }
 
 static void WINAPI glVertexP4uiv( GLenum type, const GLuint *value )
@@ -23197,9 +22040,8 @@ static void WINAPI glVertexPointervINTEL( GLint size, GLenum type, const void **
 static void WINAPI glVertexStream1dATI( GLenum stream, GLdouble x )
 {
     struct glVertexStream1dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x };
-    NTSTATUS status;
     TRACE( "stream %d, x %f\n", stream, x );
-    if ((status = UNIX_CALL( glVertexStream1dATI, &args ))) WARN( "glVertexStream1dATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream1dATI, &args );
 }
 
 static void WINAPI glVertexStream1dvATI( GLenum stream, const GLdouble *coords )
@@ -23213,9 +22055,8 @@ static void WINAPI glVertexStream1dvATI( GLenum stream, const GLdouble *coords )
 static void WINAPI glVertexStream1fATI( GLenum stream, GLfloat x )
 {
     struct glVertexStream1fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x };
-    NTSTATUS status;
     TRACE( "stream %d, x %f\n", stream, x );
-    if ((status = UNIX_CALL( glVertexStream1fATI, &args ))) WARN( "glVertexStream1fATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream1fATI, &args );
 }
 
 static void WINAPI glVertexStream1fvATI( GLenum stream, const GLfloat *coords )
@@ -23229,9 +22070,8 @@ static void WINAPI glVertexStream1fvATI( GLenum stream, const GLfloat *coords )
 static void WINAPI glVertexStream1iATI( GLenum stream, GLint x )
 {
     struct glVertexStream1iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x };
-    NTSTATUS status;
     TRACE( "stream %d, x %d\n", stream, x );
-    if ((status = UNIX_CALL( glVertexStream1iATI, &args ))) WARN( "glVertexStream1iATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream1iATI, &args );
 }
 
 static void WINAPI glVertexStream1ivATI( GLenum stream, const GLint *coords )
@@ -23245,9 +22085,8 @@ static void WINAPI glVertexStream1ivATI( GLenum stream, const GLint *coords )
 static void WINAPI glVertexStream1sATI( GLenum stream, GLshort x )
 {
     struct glVertexStream1sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x };
-    NTSTATUS status;
     TRACE( "stream %d, x %d\n", stream, x );
-    if ((status = UNIX_CALL( glVertexStream1sATI, &args ))) WARN( "glVertexStream1sATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream1sATI, &args );
 }
 
 static void WINAPI glVertexStream1svATI( GLenum stream, const GLshort *coords )
@@ -23261,9 +22100,8 @@ static void WINAPI glVertexStream1svATI( GLenum stream, const GLshort *coords )
 static void WINAPI glVertexStream2dATI( GLenum stream, GLdouble x, GLdouble y )
 {
     struct glVertexStream2dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "stream %d, x %f, y %f\n", stream, x, y );
-    if ((status = UNIX_CALL( glVertexStream2dATI, &args ))) WARN( "glVertexStream2dATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream2dATI, &args );
 }
 
 static void WINAPI glVertexStream2dvATI( GLenum stream, const GLdouble *coords )
@@ -23277,9 +22115,8 @@ static void WINAPI glVertexStream2dvATI( GLenum stream, const GLdouble *coords )
 static void WINAPI glVertexStream2fATI( GLenum stream, GLfloat x, GLfloat y )
 {
     struct glVertexStream2fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "stream %d, x %f, y %f\n", stream, x, y );
-    if ((status = UNIX_CALL( glVertexStream2fATI, &args ))) WARN( "glVertexStream2fATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream2fATI, &args );
 }
 
 static void WINAPI glVertexStream2fvATI( GLenum stream, const GLfloat *coords )
@@ -23293,9 +22130,8 @@ static void WINAPI glVertexStream2fvATI( GLenum stream, const GLfloat *coords )
 static void WINAPI glVertexStream2iATI( GLenum stream, GLint x, GLint y )
 {
     struct glVertexStream2iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "stream %d, x %d, y %d\n", stream, x, y );
-    if ((status = UNIX_CALL( glVertexStream2iATI, &args ))) WARN( "glVertexStream2iATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream2iATI, &args );
 }
 
 static void WINAPI glVertexStream2ivATI( GLenum stream, const GLint *coords )
@@ -23309,9 +22145,8 @@ static void WINAPI glVertexStream2ivATI( GLenum stream, const GLint *coords )
 static void WINAPI glVertexStream2sATI( GLenum stream, GLshort x, GLshort y )
 {
     struct glVertexStream2sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "stream %d, x %d, y %d\n", stream, x, y );
-    if ((status = UNIX_CALL( glVertexStream2sATI, &args ))) WARN( "glVertexStream2sATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream2sATI, &args );
 }
 
 static void WINAPI glVertexStream2svATI( GLenum stream, const GLshort *coords )
@@ -23325,9 +22160,8 @@ static void WINAPI glVertexStream2svATI( GLenum stream, const GLshort *coords )
 static void WINAPI glVertexStream3dATI( GLenum stream, GLdouble x, GLdouble y, GLdouble z )
 {
     struct glVertexStream3dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "stream %d, x %f, y %f, z %f\n", stream, x, y, z );
-    if ((status = UNIX_CALL( glVertexStream3dATI, &args ))) WARN( "glVertexStream3dATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream3dATI, &args );
 }
 
 static void WINAPI glVertexStream3dvATI( GLenum stream, const GLdouble *coords )
@@ -23341,9 +22175,8 @@ static void WINAPI glVertexStream3dvATI( GLenum stream, const GLdouble *coords )
 static void WINAPI glVertexStream3fATI( GLenum stream, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glVertexStream3fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "stream %d, x %f, y %f, z %f\n", stream, x, y, z );
-    if ((status = UNIX_CALL( glVertexStream3fATI, &args ))) WARN( "glVertexStream3fATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream3fATI, &args );
 }
 
 static void WINAPI glVertexStream3fvATI( GLenum stream, const GLfloat *coords )
@@ -23357,9 +22190,8 @@ static void WINAPI glVertexStream3fvATI( GLenum stream, const GLfloat *coords )
 static void WINAPI glVertexStream3iATI( GLenum stream, GLint x, GLint y, GLint z )
 {
     struct glVertexStream3iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "stream %d, x %d, y %d, z %d\n", stream, x, y, z );
-    if ((status = UNIX_CALL( glVertexStream3iATI, &args ))) WARN( "glVertexStream3iATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream3iATI, &args );
 }
 
 static void WINAPI glVertexStream3ivATI( GLenum stream, const GLint *coords )
@@ -23373,9 +22205,8 @@ static void WINAPI glVertexStream3ivATI( GLenum stream, const GLint *coords )
 static void WINAPI glVertexStream3sATI( GLenum stream, GLshort x, GLshort y, GLshort z )
 {
     struct glVertexStream3sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "stream %d, x %d, y %d, z %d\n", stream, x, y, z );
-    if ((status = UNIX_CALL( glVertexStream3sATI, &args ))) WARN( "glVertexStream3sATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream3sATI, &args );
 }
 
 static void WINAPI glVertexStream3svATI( GLenum stream, const GLshort *coords )
@@ -23389,9 +22220,8 @@ static void WINAPI glVertexStream3svATI( GLenum stream, const GLshort *coords )
 static void WINAPI glVertexStream4dATI( GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glVertexStream4dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "stream %d, x %f, y %f, z %f, w %f\n", stream, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexStream4dATI, &args ))) WARN( "glVertexStream4dATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream4dATI, &args );
 }
 
 static void WINAPI glVertexStream4dvATI( GLenum stream, const GLdouble *coords )
@@ -23405,9 +22235,8 @@ static void WINAPI glVertexStream4dvATI( GLenum stream, const GLdouble *coords )
 static void WINAPI glVertexStream4fATI( GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glVertexStream4fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "stream %d, x %f, y %f, z %f, w %f\n", stream, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexStream4fATI, &args ))) WARN( "glVertexStream4fATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream4fATI, &args );
 }
 
 static void WINAPI glVertexStream4fvATI( GLenum stream, const GLfloat *coords )
@@ -23421,9 +22250,8 @@ static void WINAPI glVertexStream4fvATI( GLenum stream, const GLfloat *coords )
 static void WINAPI glVertexStream4iATI( GLenum stream, GLint x, GLint y, GLint z, GLint w )
 {
     struct glVertexStream4iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "stream %d, x %d, y %d, z %d, w %d\n", stream, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexStream4iATI, &args ))) WARN( "glVertexStream4iATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream4iATI, &args );
 }
 
 static void WINAPI glVertexStream4ivATI( GLenum stream, const GLint *coords )
@@ -23437,9 +22265,8 @@ static void WINAPI glVertexStream4ivATI( GLenum stream, const GLint *coords )
 static void WINAPI glVertexStream4sATI( GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w )
 {
     struct glVertexStream4sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "stream %d, x %d, y %d, z %d, w %d\n", stream, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexStream4sATI, &args ))) WARN( "glVertexStream4sATI returned %#lx\n", status );
+    UNIX_BATCH( glVertexStream4sATI, &args );
 }
 
 static void WINAPI glVertexStream4svATI( GLenum stream, const GLshort *coords )
@@ -23461,9 +22288,8 @@ static void WINAPI glVertexWeightPointerEXT( GLint size, GLenum type, GLsizei st
 static void WINAPI glVertexWeightfEXT( GLfloat weight )
 {
     struct glVertexWeightfEXT_params args = { .teb = NtCurrentTeb(), .weight = weight };
-    NTSTATUS status;
     TRACE( "weight %f\n", weight );
-    if ((status = UNIX_CALL( glVertexWeightfEXT, &args ))) WARN( "glVertexWeightfEXT returned %#lx\n", status );
+    UNIX_BATCH( glVertexWeightfEXT, &args );
 }
 
 static void WINAPI glVertexWeightfvEXT( const GLfloat *weight )
@@ -23477,9 +22303,8 @@ static void WINAPI glVertexWeightfvEXT( const GLfloat *weight )
 static void WINAPI glVertexWeighthNV( GLhalfNV weight )
 {
     struct glVertexWeighthNV_params args = { .teb = NtCurrentTeb(), .weight = weight };
-    NTSTATUS status;
     TRACE( "weight %d\n", weight );
-    if ((status = UNIX_CALL( glVertexWeighthNV, &args ))) WARN( "glVertexWeighthNV returned %#lx\n", status );
+    UNIX_BATCH( glVertexWeighthNV, &args );
 }
 
 static void WINAPI glVertexWeighthvNV( const GLhalfNV *weight )
@@ -23534,9 +22359,8 @@ static void WINAPI glViewportArrayv( GLuint first, GLsizei count, const GLfloat
 static void WINAPI glViewportIndexedf( GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h )
 {
     struct glViewportIndexedf_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .w = w, .h = h };
-    NTSTATUS status;
     TRACE( "index %d, x %f, y %f, w %f, h %f\n", index, x, y, w, h );
-    if ((status = UNIX_CALL( glViewportIndexedf, &args ))) WARN( "glViewportIndexedf returned %#lx\n", status );
+    UNIX_BATCH( glViewportIndexedf, &args );
 }
 
 static void WINAPI glViewportIndexedfv( GLuint index, const GLfloat *v )
@@ -23550,17 +22374,15 @@ static void WINAPI glViewportIndexedfv( GLuint index, const GLfloat *v )
 static void WINAPI glViewportPositionWScaleNV( GLuint index, GLfloat xcoeff, GLfloat ycoeff )
 {
     struct glViewportPositionWScaleNV_params args = { .teb = NtCurrentTeb(), .index = index, .xcoeff = xcoeff, .ycoeff = ycoeff };
-    NTSTATUS status;
     TRACE( "index %d, xcoeff %f, ycoeff %f\n", index, xcoeff, ycoeff );
-    if ((status = UNIX_CALL( glViewportPositionWScaleNV, &args ))) WARN( "glViewportPositionWScaleNV returned %#lx\n", status );
+    UNIX_BATCH( glViewportPositionWScaleNV, &args );
 }
 
 static void WINAPI glViewportSwizzleNV( GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew )
 {
     struct glViewportSwizzleNV_params args = { .teb = NtCurrentTeb(), .index = index, .swizzlex = swizzlex, .swizzley = swizzley, .swizzlez = swizzlez, .swizzlew = swizzlew };
-    NTSTATUS status;
     TRACE( "index %d, swizzlex %d, swizzley %d, swizzlez %d, swizzlew %d\n", index, swizzlex, swizzley, swizzlez, swizzlew );
-    if ((status = UNIX_CALL( glViewportSwizzleNV, &args ))) WARN( "glViewportSwizzleNV returned %#lx\n", status );
+    UNIX_BATCH( glViewportSwizzleNV, &args );
 }
 
 static void WINAPI glWaitSemaphoreEXT( GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts )
@@ -23590,9 +22412,8 @@ static void WINAPI glWaitSync( GLsync sync, GLbitfield flags, GLuint64 timeout )
 static void WINAPI glWaitVkSemaphoreNV( GLuint64 vkSemaphore )
 {
     struct glWaitVkSemaphoreNV_params args = { .teb = NtCurrentTeb(), .vkSemaphore = vkSemaphore };
-    NTSTATUS status;
     TRACE( "vkSemaphore %s\n", wine_dbgstr_longlong(vkSemaphore) );
-    if ((status = UNIX_CALL( glWaitVkSemaphoreNV, &args ))) WARN( "glWaitVkSemaphoreNV returned %#lx\n", status );
+    UNIX_BATCH( glWaitVkSemaphoreNV, &args );
 }
 
 static void WINAPI glWeightPathsNV( GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights )
@@ -23678,25 +22499,22 @@ static void WINAPI glWeightusvARB( GLint size, const GLushort *weights )
 static void WINAPI glWindowPos2d( GLdouble x, GLdouble y )
 {
     struct glWindowPos2d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2d, &args ))) WARN( "glWindowPos2d returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2d, &args );
 }
 
 static void WINAPI glWindowPos2dARB( GLdouble x, GLdouble y )
 {
     struct glWindowPos2dARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2dARB, &args ))) WARN( "glWindowPos2dARB returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2dARB, &args );
 }
 
 static void WINAPI glWindowPos2dMESA( GLdouble x, GLdouble y )
 {
     struct glWindowPos2dMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2dMESA, &args ))) WARN( "glWindowPos2dMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2dMESA, &args );
 }
 
 static void WINAPI glWindowPos2dv( const GLdouble *v )
@@ -23726,25 +22544,22 @@ static void WINAPI glWindowPos2dvMESA( const GLdouble *v )
 static void WINAPI glWindowPos2f( GLfloat x, GLfloat y )
 {
     struct glWindowPos2f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2f, &args ))) WARN( "glWindowPos2f returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2f, &args );
 }
 
 static void WINAPI glWindowPos2fARB( GLfloat x, GLfloat y )
 {
     struct glWindowPos2fARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2fARB, &args ))) WARN( "glWindowPos2fARB returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2fARB, &args );
 }
 
 static void WINAPI glWindowPos2fMESA( GLfloat x, GLfloat y )
 {
     struct glWindowPos2fMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2fMESA, &args ))) WARN( "glWindowPos2fMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2fMESA, &args );
 }
 
 static void WINAPI glWindowPos2fv( const GLfloat *v )
@@ -23774,25 +22589,22 @@ static void WINAPI glWindowPos2fvMESA( const GLfloat *v )
 static void WINAPI glWindowPos2i( GLint x, GLint y )
 {
     struct glWindowPos2i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2i, &args ))) WARN( "glWindowPos2i returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2i, &args );
 }
 
 static void WINAPI glWindowPos2iARB( GLint x, GLint y )
 {
     struct glWindowPos2iARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2iARB, &args ))) WARN( "glWindowPos2iARB returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2iARB, &args );
 }
 
 static void WINAPI glWindowPos2iMESA( GLint x, GLint y )
 {
     struct glWindowPos2iMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2iMESA, &args ))) WARN( "glWindowPos2iMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2iMESA, &args );
 }
 
 static void WINAPI glWindowPos2iv( const GLint *v )
@@ -23822,25 +22634,22 @@ static void WINAPI glWindowPos2ivMESA( const GLint *v )
 static void WINAPI glWindowPos2s( GLshort x, GLshort y )
 {
     struct glWindowPos2s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2s, &args ))) WARN( "glWindowPos2s returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2s, &args );
 }
 
 static void WINAPI glWindowPos2sARB( GLshort x, GLshort y )
 {
     struct glWindowPos2sARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2sARB, &args ))) WARN( "glWindowPos2sARB returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2sARB, &args );
 }
 
 static void WINAPI glWindowPos2sMESA( GLshort x, GLshort y )
 {
     struct glWindowPos2sMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
-    NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2sMESA, &args ))) WARN( "glWindowPos2sMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos2sMESA, &args );
 }
 
 static void WINAPI glWindowPos2sv( const GLshort *v )
@@ -23870,25 +22679,22 @@ static void WINAPI glWindowPos2svMESA( const GLshort *v )
 static void WINAPI glWindowPos3d( GLdouble x, GLdouble y, GLdouble z )
 {
     struct glWindowPos3d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3d, &args ))) WARN( "glWindowPos3d returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3d, &args );
 }
 
 static void WINAPI glWindowPos3dARB( GLdouble x, GLdouble y, GLdouble z )
 {
     struct glWindowPos3dARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3dARB, &args ))) WARN( "glWindowPos3dARB returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3dARB, &args );
 }
 
 static void WINAPI glWindowPos3dMESA( GLdouble x, GLdouble y, GLdouble z )
 {
     struct glWindowPos3dMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3dMESA, &args ))) WARN( "glWindowPos3dMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3dMESA, &args );
 }
 
 static void WINAPI glWindowPos3dv( const GLdouble *v )
@@ -23918,25 +22724,22 @@ static void WINAPI glWindowPos3dvMESA( const GLdouble *v )
 static void WINAPI glWindowPos3f( GLfloat x, GLfloat y, GLfloat z )
 {
     struct glWindowPos3f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3f, &args ))) WARN( "glWindowPos3f returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3f, &args );
 }
 
 static void WINAPI glWindowPos3fARB( GLfloat x, GLfloat y, GLfloat z )
 {
     struct glWindowPos3fARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3fARB, &args ))) WARN( "glWindowPos3fARB returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3fARB, &args );
 }
 
 static void WINAPI glWindowPos3fMESA( GLfloat x, GLfloat y, GLfloat z )
 {
     struct glWindowPos3fMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3fMESA, &args ))) WARN( "glWindowPos3fMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3fMESA, &args );
 }
 
 static void WINAPI glWindowPos3fv( const GLfloat *v )
@@ -23966,25 +22769,22 @@ static void WINAPI glWindowPos3fvMESA( const GLfloat *v )
 static void WINAPI glWindowPos3i( GLint x, GLint y, GLint z )
 {
     struct glWindowPos3i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3i, &args ))) WARN( "glWindowPos3i returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3i, &args );
 }
 
 static void WINAPI glWindowPos3iARB( GLint x, GLint y, GLint z )
 {
     struct glWindowPos3iARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3iARB, &args ))) WARN( "glWindowPos3iARB returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3iARB, &args );
 }
 
 static void WINAPI glWindowPos3iMESA( GLint x, GLint y, GLint z )
 {
     struct glWindowPos3iMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3iMESA, &args ))) WARN( "glWindowPos3iMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3iMESA, &args );
 }
 
 static void WINAPI glWindowPos3iv( const GLint *v )
@@ -24014,25 +22814,22 @@ static void WINAPI glWindowPos3ivMESA( const GLint *v )
 static void WINAPI glWindowPos3s( GLshort x, GLshort y, GLshort z )
 {
     struct glWindowPos3s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3s, &args ))) WARN( "glWindowPos3s returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3s, &args );
 }
 
 static void WINAPI glWindowPos3sARB( GLshort x, GLshort y, GLshort z )
 {
     struct glWindowPos3sARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3sARB, &args ))) WARN( "glWindowPos3sARB returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3sARB, &args );
 }
 
 static void WINAPI glWindowPos3sMESA( GLshort x, GLshort y, GLshort z )
 {
     struct glWindowPos3sMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3sMESA, &args ))) WARN( "glWindowPos3sMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos3sMESA, &args );
 }
 
 static void WINAPI glWindowPos3sv( const GLshort *v )
@@ -24062,9 +22859,8 @@ static void WINAPI glWindowPos3svMESA( const GLshort *v )
 static void WINAPI glWindowPos4dMESA( GLdouble x, GLdouble y, GLdouble z, GLdouble w )
 {
     struct glWindowPos4dMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glWindowPos4dMESA, &args ))) WARN( "glWindowPos4dMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos4dMESA, &args );
 }
 
 static void WINAPI glWindowPos4dvMESA( const GLdouble *v )
@@ -24078,9 +22874,8 @@ static void WINAPI glWindowPos4dvMESA( const GLdouble *v )
 static void WINAPI glWindowPos4fMESA( GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glWindowPos4fMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glWindowPos4fMESA, &args ))) WARN( "glWindowPos4fMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos4fMESA, &args );
 }
 
 static void WINAPI glWindowPos4fvMESA( const GLfloat *v )
@@ -24094,9 +22889,8 @@ static void WINAPI glWindowPos4fvMESA( const GLfloat *v )
 static void WINAPI glWindowPos4iMESA( GLint x, GLint y, GLint z, GLint w )
 {
     struct glWindowPos4iMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glWindowPos4iMESA, &args ))) WARN( "glWindowPos4iMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos4iMESA, &args );
 }
 
 static void WINAPI glWindowPos4ivMESA( const GLint *v )
@@ -24110,9 +22904,8 @@ static void WINAPI glWindowPos4ivMESA( const GLint *v )
 static void WINAPI glWindowPos4sMESA( GLshort x, GLshort y, GLshort z, GLshort w )
 {
     struct glWindowPos4sMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glWindowPos4sMESA, &args ))) WARN( "glWindowPos4sMESA returned %#lx\n", status );
+    UNIX_BATCH( glWindowPos4sMESA, &args );
 }
 
 static void WINAPI glWindowPos4svMESA( const GLshort *v )
@@ -24134,9 +22927,8 @@ static void WINAPI glWindowRectanglesEXT( GLenum mode, GLsizei count, const GLin
 static void WINAPI glWriteMaskEXT( GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW )
 {
     struct glWriteMaskEXT_params args = { .teb = NtCurrentTeb(), .res = res, .in = in, .outX = outX, .outY = outY, .outZ = outZ, .outW = outW };
-    NTSTATUS status;
     TRACE( "res %d, in %d, outX %d, outY %d, outZ %d, outW %d\n", res, in, outX, outY, outZ, outW );
-    if ((status = UNIX_CALL( glWriteMaskEXT, &args ))) WARN( "glWriteMaskEXT returned %#lx\n", status );
+    UNIX_BATCH( glWriteMaskEXT, &args );
 }
 
 static void * WINAPI wglAllocateMemoryNV( GLsizei size, GLfloat readfreq, GLfloat writefreq, GLfloat priority )
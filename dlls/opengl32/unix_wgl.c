@@ -1157,6 +1157,24 @@ NTSTATUS process_detach( void *args )
     return STATUS_SUCCESS;
 }
 
+/* execute the calls recorded by the PE side, see batch_call */
+NTSTATUS execute_batch( void *args )
+{
+    struct execute_batch_params *params = args;
+    const char *ptr = params->data, *end = ptr + params->size;
+    const struct batch_command *command;
+    NTSTATUS status;
+
+    while (ptr < end)
+    {
+        command = (const struct batch_command *)ptr;
+        if ((status = __wine_unix_call_funcs[command->code]( (void *)(command + 1) )))
+            WARN( "batched call %u returned %#x\n", command->code, status );
+        ptr += sizeof(*command) + command->size;
+    }
+    return STATUS_SUCCESS;
+}
+
 #ifdef _WIN64
 
 typedef ULONG PTR32;
@@ -2221,6 +2239,28 @@ NTSTATUS wow64_thread_attach( void *args )
     return thread_attach( get_teb64( (ULONG_PTR)args ));
 }
 
+NTSTATUS wow64_execute_batch( void *args )
+{
+    struct
+    {
+        PTR32 teb;
+        PTR32 data;
+        UINT size;
+    } *params32 = args;
+    const char *ptr = ULongToPtr(params32->data), *end = ptr + params32->size;
+    const struct batch_command *command;
+    NTSTATUS status;
+
+    while (ptr < end)
+    {
+        command = (const struct batch_command *)ptr;
+        if ((status = __wine_unix_call_wow64_funcs[command->code]( (void *)(command + 1) )))
+            WARN( "batched call %u returned %#x\n", command->code, status );
+        ptr += sizeof(*command) + command->size;
+    }
+    return STATUS_SUCCESS;
+}
+
 NTSTATUS wow64_process_detach( void *args )
 {
     NTSTATUS status;
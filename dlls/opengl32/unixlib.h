@@ -25335,6 +25335,7 @@ enum unix_funcs
 {
     unix_thread_attach,
     unix_process_detach,
+    unix_execute_batch,
     unix_wglCopyContext,
     unix_wglCreateContext,
     unix_wglDeleteContext,
@@ -28391,6 +28392,21 @@ struct wine_gl_debug_message_params
     const GLchar *message;
 };
 
-#define UNIX_CALL( func, params ) WINE_UNIX_CALL( unix_ ## func, params )
+struct batch_command
+{
+    UINT code;
+    UINT size;
+    /* followed by the call parameters */
+};
+
+struct execute_batch_params
+{
+    TEB *teb;
+    const void *data;
+    UINT size;
+};
+
+#define UNIX_CALL( func, params ) (flush_batch(), WINE_UNIX_CALL( unix_ ## func, params ))
+#define UNIX_BATCH( func, params ) batch_call( unix_ ## func, params, sizeof(*(params)) )
 
 #endif /* __WINE_OPENGL32_UNIXLIB_H */
@@ -81,6 +81,61 @@ static void cleanup_wow64_strings(void)
 
 #endif
 
+/* execute the calls recorded by batch_call with a single unix call */
+void flush_command_batch( struct command_batch *batch )
+{
+    struct execute_batch_params args = { .teb = NtCurrentTeb(), .data = batch->data, .size = batch->size };
+    NTSTATUS status;
+
+    /* GL calls from a debug message callback are executed directly */
+    if (batch->executing) return;
+
+    TRACE( "executing %u calls\n", batch->count );
+    batch->executing = TRUE;
+    if ((status = WINE_UNIX_CALL( unix_execute_batch, &args ))) WARN( "execute_batch returned %#lx\n", status );
+    batch->executing = FALSE;
+    batch->size = batch->count = 0;
+}
+
+/* record a call without return value or pointer parameters, see make_opengl */
+void batch_call( UINT code, void *params, UINT size )
+{
+    struct command_batch *batch = NtCurrentTeb()->glReserved2;
+    UINT len = sizeof(struct batch_command) + ((size + 7) & ~7);
+    struct batch_command *command;
+    NTSTATUS status;
+
+    if (!batch && (batch = malloc( sizeof(*batch) )))
+    {
+        batch->size = batch->count = 0;
+        batch->executing = FALSE;
+        NtCurrentTeb()->glReserved2 = batch;
+    }
+    if (!batch || batch->executing)
+    {
+        if ((status = WINE_UNIX_CALL( code, params ))) WARN( "call %u returned %#lx\n", code, status );
+        return;
+    }
+
+    if (batch->size + len > sizeof(batch->data)) flush_command_batch( batch );
+    command = (struct batch_command *)(batch->data + batch->size);
+    command->code = code;
+    command->size = len - sizeof(*command);
+    memcpy( command + 1, params, size );
+    batch->size += len;
+    batch->count++;
+}
+
+static void free_command_batch(void)
+{
+    struct command_batch *batch = NtCurrentTeb()->glReserved2;
+
+    if (!batch) return;
+    flush_batch();
+    NtCurrentTeb()->glReserved2 = NULL;
+    free( batch );
+}
+
 /***********************************************************************
  *		wglGetCurrentReadDCARB
  *
@@ -1470,8 +1525,13 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
         }
         break;
 
+    case DLL_THREAD_DETACH:
+        free_command_batch();
+        break;
+
     case DLL_PROCESS_DETACH:
         if (reserved) break;
+        free_command_batch();
         UNIX_CALL( process_detach, NULL );
 #ifndef _WIN64
         cleanup_wow64_strings();
@@ -25,6 +25,7 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <limits.h>
 #include <string.h>
 
 #include "windef.h"
@@ -660,6 +661,512 @@ PFORMAT_STRING convert_old_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFo
     return (PFORMAT_STRING)args;
 }
 
+/* Precompiled marshalling plans
+ *
+ * The parameter descriptions of a procedure are compiled once into a flat
+ * table of operations. Base types and simple structs are copied directly,
+ * and if all [in] or all [out] params have a constant wire size the sizing
+ * pass is replaced by a precomputed length and the data is copied at fixed
+ * offsets. Conformant arrays of base types compute their conformance once
+ * in the sizing pass and reuse it when marshalling. Everything else goes
+ * through the usual NdrMarshaller & co. tables, with the type format and
+ * routines already resolved. */
+
+static SRWLOCK proc_plans_lock = SRWLOCK_INIT;
+static struct ndr_proc_plan *proc_plans[256];
+
+static inline ULONG plan_align( ULONG len, unsigned int align )
+{
+    return (len + align - 1) & ~(align - 1);
+}
+
+static inline void plan_length_increment( MIDL_STUB_MESSAGE *msg, ULONG size )
+{
+    if (msg->BufferLength + size < msg->BufferLength)
+    {
+        ERR( "buffer length overflow - BufferLength = %lu, size = %lu\n", msg->BufferLength, size );
+        RpcRaiseException( RPC_X_BAD_STUB_DATA );
+    }
+    msg->BufferLength += size;
+}
+
+static inline void plan_align_buffer_clear( MIDL_STUB_MESSAGE *msg, unsigned int align )
+{
+    ULONG_PTR mask = align - 1;
+    memset( msg->Buffer, 0, (align - (ULONG_PTR)msg->Buffer) & mask );
+    msg->Buffer = (unsigned char *)(((ULONG_PTR)msg->Buffer + mask) & ~mask);
+}
+
+static inline void plan_copy_to_buffer( MIDL_STUB_MESSAGE *msg, const void *p, ULONG size )
+{
+    unsigned char *end = (unsigned char *)msg->RpcMsg->Buffer + msg->BufferLength;
+
+    if (msg->Buffer + size < msg->Buffer || msg->Buffer + size > end)
+    {
+        ERR( "buffer overflow - Buffer = %p, BufferEnd = %p, size = %lu\n", msg->Buffer, end, size );
+        RpcRaiseException( RPC_X_BAD_STUB_DATA );
+    }
+    memcpy( msg->Buffer, p, size );
+    msg->Buffer += size;
+}
+
+static inline unsigned char *plan_read_buffer( MIDL_STUB_MESSAGE *msg, unsigned int align, ULONG size )
+{
+    unsigned char *ret;
+
+    msg->Buffer = (unsigned char *)(((ULONG_PTR)msg->Buffer + align - 1) & ~(ULONG_PTR)(align - 1));
+    if (msg->Buffer + size < msg->Buffer || msg->Buffer + size > msg->BufferEnd)
+    {
+        ERR( "buffer overflow - Buffer = %p, BufferEnd = %p, size = %lu\n", msg->Buffer, msg->BufferEnd, size );
+        RpcRaiseException( RPC_X_BAD_STUB_DATA );
+    }
+    ret = msg->Buffer;
+    msg->Buffer += size;
+    return ret;
+}
+
+/* memory holding the data of a parameter, see call_marshaller() */
+static inline unsigned char *plan_param_memory( unsigned char *arg, const NDR_PARAM_OIF *param )
+{
+    if (param->attr.IsBasetype) return param->attr.IsSimpleRef ? *(unsigned char **)arg : arg;
+    return param->attr.IsByValue ? arg : *(unsigned char **)arg;
+}
+
+static inline BOOL plan_param_is_fixed( const struct ndr_plan_param *p )
+{
+    return p->op == NDR_OP_BASETYPE || p->op == NDR_OP_STRUCT;
+}
+
+/* base types that have the same representation in memory and on the wire */
+static unsigned int plan_basetype_size( unsigned char fc )
+{
+    switch (fc)
+    {
+    case FC_BYTE:
+    case FC_CHAR:
+    case FC_SMALL:
+    case FC_USMALL:
+        return sizeof(UCHAR);
+    case FC_WCHAR:
+    case FC_SHORT:
+    case FC_USHORT:
+        return sizeof(USHORT);
+    case FC_LONG:
+    case FC_ULONG:
+    case FC_ERROR_STATUS_T:
+    case FC_ENUM32:
+        return sizeof(ULONG);
+    case FC_FLOAT:
+        return sizeof(float);
+    case FC_HYPER:
+        return sizeof(ULONGLONG);
+    case FC_DOUBLE:
+        return sizeof(double);
+    default:
+        return 0;
+    }
+}
+
+static void compile_plan_param( struct ndr_plan_param *p, const MIDL_STUB_DESC *stub_desc,
+                                unsigned int corr_incr )
+{
+    PFORMAT_STRING format, desc;
+    unsigned int size;
+
+    if (p->param.attr.IsBasetype)
+        format = &p->param.u.type_format_char;
+    else
+        format = &stub_desc->pFormatTypes[p->param.u.type_offset];
+
+    p->op = NDR_OP_GENERIC;
+    p->format = format;
+    p->sizer = NdrBufferSizer[format[0] & NDR_TABLE_MASK];
+    p->marshaller = NdrMarshaller[format[0] & NDR_TABLE_MASK];
+    p->unmarshaller = NdrUnmarshaller[format[0] & NDR_TABLE_MASK];
+
+    if (p->param.attr.IsBasetype)
+    {
+        if (!(size = plan_basetype_size( format[0] ))) return;
+        p->op = NDR_OP_BASETYPE;
+        p->align = p->size = size;
+    }
+    else if (format[0] == FC_STRUCT)
+    {
+        p->op = NDR_OP_STRUCT;
+        p->align = format[1] + 1;
+        p->size = *(const WORD *)(format + 2);
+    }
+    else if (format[0] == FC_RP && !p->param.attr.IsByValue &&
+             !(format[1] & (FC_SIMPLE_POINTER | FC_POINTER_DEREF)))
+    {
+        /* FC_CARRAY, alignment, element size, conformance, element type, FC_END */
+        desc = format + 2 + *(const SHORT *)(format + 2);
+        if (desc[0] != FC_CARRAY) return;
+        if (!(size = plan_basetype_size( desc[8 + corr_incr] ))) return;
+        if (desc[9 + corr_incr] != FC_END || *(const WORD *)(desc + 2) != size) return;
+        p->op = NDR_OP_CARRAY;
+        p->array_format = desc;
+        p->align = desc[1] + 1;
+        p->size = size;
+    }
+}
+
+static struct ndr_proc_plan *compile_proc_plan( const MIDL_STUB_DESC *stub_desc, PFORMAT_STRING format,
+                                                unsigned int count, INTERPRETER_OPT_FLAGS2 ext_flags )
+{
+    const NDR_PARAM_OIF *params = (const NDR_PARAM_OIF *)format;
+    unsigned int i, corr_incr = 0;
+    ULONG in_size = 0, out_size = 0;
+    struct ndr_proc_plan *plan;
+
+    if (ext_flags.HasNewCorrDesc) corr_incr = (ext_flags.Unused & 0x2) ? 12 : 2;
+
+    if (!(plan = calloc( 1, offsetof( struct ndr_proc_plan, params[count] ) ))) return NULL;
+    plan->stub_desc = stub_desc;
+    plan->format = format;
+    plan->count = count;
+    plan->in_fixed = plan->out_fixed = TRUE;
+
+    for (i = 0; i < count; i++)
+    {
+        struct ndr_plan_param *p = &plan->params[i];
+
+        p->param = params[i];
+        compile_plan_param( p, stub_desc, corr_incr );
+
+        if (p->op == NDR_OP_CARRAY)
+        {
+            if (plan->carray_count < NDR_PLAN_MAX_CARRAYS) p->index = plan->carray_count++;
+            else p->op = NDR_OP_GENERIC;
+        }
+
+        if (p->param.attr.IsIn)
+        {
+            if (!plan_param_is_fixed( p )) plan->in_fixed = FALSE;
+            else
+            {
+                in_size = plan_align( in_size, p->align );
+                p->in_offset = in_size;
+                in_size += p->size;
+            }
+        }
+        if (p->param.attr.IsReturn && !p->param.attr.IsOut) plan->out_fixed = FALSE;
+        if (p->param.attr.IsOut)
+        {
+            if (!plan_param_is_fixed( p )) plan->out_fixed = FALSE;
+            else
+            {
+                out_size = plan_align( out_size, p->align );
+                p->out_offset = out_size;
+                out_size += p->size;
+            }
+        }
+        if (in_size > USHRT_MAX) plan->in_fixed = FALSE;
+        if (out_size > USHRT_MAX) plan->out_fixed = FALSE;
+    }
+
+    plan->in_size = in_size;
+    plan->out_size = out_size;
+    TRACE( "compiled plan %p for %p, %u params, in %s %lu, out %s %lu\n", plan, format, count,
+           plan->in_fixed ? "fixed" : "variable", in_size, plan->out_fixed ? "fixed" : "variable", out_size );
+    return plan;
+}
+
+static inline unsigned int proc_plan_hash( PFORMAT_STRING format )
+{
+    ULONG_PTR key = (ULONG_PTR)format;
+    return (key ^ (key >> 8) ^ (key >> 16)) % ARRAY_SIZE(proc_plans);
+}
+
+static BOOL proc_plan_matches( const struct ndr_proc_plan *plan, const MIDL_STUB_DESC *stub_desc,
+                               PFORMAT_STRING format, unsigned int count )
+{
+    const NDR_PARAM_OIF *params = (const NDR_PARAM_OIF *)format;
+    unsigned int i;
+
+    if (plan->format != format || plan->stub_desc != stub_desc || plan->count != count) return FALSE;
+    /* the format string may belong to a module that has been unloaded since */
+    for (i = 0; i < count; i++)
+        if (memcmp( &plan->params[i].param, &params[i], sizeof(params[i]) )) return FALSE;
+    return TRUE;
+}
+
+const struct ndr_proc_plan *ndr_get_proc_plan( const MIDL_STUB_DESC *stub_desc, PFORMAT_STRING format,
+                                               unsigned int count, INTERPRETER_OPT_FLAGS2 ext_flags )
+{
+    unsigned int hash = proc_plan_hash( format );
+    struct ndr_proc_plan *plan, *cur;
+
+    AcquireSRWLockShared( &proc_plans_lock );
+    for (plan = proc_plans[hash]; plan; plan = plan->next)
+        if (proc_plan_matches( plan, stub_desc, format, count )) break;
+    ReleaseSRWLockShared( &proc_plans_lock );
+    if (plan) return plan;
+
+    if (!(plan = compile_proc_plan( stub_desc, format, count, ext_flags ))) return NULL;
+
+    AcquireSRWLockExclusive( &proc_plans_lock );
+    for (cur = proc_plans[hash]; cur; cur = cur->next)
+        if (proc_plan_matches( cur, stub_desc, format, count )) break;
+    if (!cur)
+    {
+        plan->next = proc_plans[hash];
+        proc_plans[hash] = plan;
+    }
+    ReleaseSRWLockExclusive( &proc_plans_lock );
+
+    if (cur)
+    {
+        free( plan );
+        plan = cur;
+    }
+    return plan;
+}
+
+static BOOL proc_plan_in_range( const struct ndr_proc_plan *plan, const void *base, SIZE_T size )
+{
+    ULONG_PTR start = (ULONG_PTR)base;
+
+    return ((ULONG_PTR)plan->format - start < size || (ULONG_PTR)plan->stub_desc - start < size);
+}
+
+static void flush_proc_plans( const MIDL_STUB_DESC *stub_desc, const void *base, SIZE_T size )
+{
+    struct ndr_proc_plan **entry, *plan;
+    unsigned int i;
+
+    AcquireSRWLockExclusive( &proc_plans_lock );
+    for (i = 0; i < ARRAY_SIZE(proc_plans); i++)
+    {
+        entry = &proc_plans[i];
+        while ((plan = *entry))
+        {
+            if (stub_desc ? plan->stub_desc != stub_desc : !proc_plan_in_range( plan, base, size ))
+            {
+                entry = &plan->next;
+                continue;
+            }
+            *entry = plan->next;
+            free( plan );
+        }
+    }
+    ReleaseSRWLockExclusive( &proc_plans_lock );
+}
+
+/* called when dynamically built format strings are about to be freed */
+void ndr_flush_proc_plans( const MIDL_STUB_DESC *stub_desc )
+{
+    flush_proc_plans( stub_desc, NULL, 0 );
+}
+
+static void *proc_plans_cookie;
+
+/* plans compiled from the format strings of a module must not outlive it */
+static void CALLBACK proc_plans_dll_notification( ULONG reason, LDR_DLL_NOTIFICATION_DATA *data, void *context )
+{
+    if (reason != LDR_DLL_NOTIFICATION_REASON_UNLOADED) return;
+    flush_proc_plans( NULL, data->Unloaded.DllBase, data->Unloaded.SizeOfImage );
+}
+
+void ndr_init_proc_plans(void)
+{
+    LdrRegisterDllNotification( 0, proc_plans_dll_notification, NULL, &proc_plans_cookie );
+}
+
+void ndr_free_proc_plans(void)
+{
+    LdrUnregisterDllNotification( proc_plans_cookie );
+    flush_proc_plans( NULL, NULL, ~(SIZE_T)0 );
+}
+
+static unsigned char *client_plan_memory( unsigned char *arg, const struct ndr_plan_param *p,
+                                          void **fpu_args, float *f )
+{
+#ifdef __x86_64__  /* floats are passed as doubles through varargs functions */
+    if (p->param.attr.IsBasetype && p->param.u.type_format_char == FC_FLOAT &&
+        !p->param.attr.IsSimpleRef && !fpu_args)
+    {
+        *f = *(double *)arg;
+        return (unsigned char *)f;
+    }
+#endif
+    return plan_param_memory( arg, &p->param );
+}
+
+/* unmarshals a fixed-size parameter, see NdrBaseTypeUnmarshall() and NdrSimpleStructUnmarshall() */
+static void plan_unmarshall_fixed( MIDL_STUB_MESSAGE *msg, unsigned char *arg, const struct ndr_plan_param *p,
+                                   unsigned char *src )
+{
+    unsigned char **ptr = (unsigned char **)arg;
+    BOOL by_value = p->op == NDR_OP_BASETYPE ? !p->param.attr.IsSimpleRef : p->param.attr.IsByValue;
+
+    if (by_value) memcpy( arg, src, p->size );
+    else if (!msg->IsClient && !*ptr) *ptr = src;  /* for servers, point straight into the RPC buffer */
+    else memcpy( *ptr, src, p->size );
+}
+
+static void plan_unmarshall_generic( MIDL_STUB_MESSAGE *msg, unsigned char *arg, const struct ndr_plan_param *p )
+{
+    unsigned char **ptr = &arg;
+
+    if (p->param.attr.IsBasetype ? p->param.attr.IsSimpleRef : !p->param.attr.IsByValue)
+        ptr = (unsigned char **)arg;
+    if (p->unmarshaller) p->unmarshaller( msg, ptr, p->format, 0 );
+    else call_unmarshaller( msg, &arg, &p->param, 0 );
+}
+
+static void plan_size_generic( MIDL_STUB_MESSAGE *msg, unsigned char *arg, const struct ndr_plan_param *p )
+{
+    if (p->sizer) p->sizer( msg, plan_param_memory( arg, &p->param ), p->format );
+    else call_buffer_sizer( msg, arg, &p->param );
+}
+
+static void plan_marshall_generic( MIDL_STUB_MESSAGE *msg, unsigned char *arg, const struct ndr_plan_param *p )
+{
+    if (p->marshaller) p->marshaller( msg, plan_param_memory( arg, &p->param ), p->format );
+    else call_marshaller( msg, arg, &p->param );
+}
+
+/* checks whether a block of fixed-size params can be copied at precomputed offsets */
+static inline BOOL plan_can_write_block( const MIDL_STUB_MESSAGE *msg, ULONG size )
+{
+    unsigned char *end = (unsigned char *)msg->RpcMsg->Buffer + msg->BufferLength;
+
+    return !((ULONG_PTR)msg->Buffer & 7) && msg->Buffer + size >= msg->Buffer && msg->Buffer + size <= end;
+}
+
+static inline BOOL plan_can_read_block( const MIDL_STUB_MESSAGE *msg, ULONG size )
+{
+    return !((ULONG_PTR)msg->Buffer & 7) && msg->Buffer + size >= msg->Buffer && msg->Buffer + size <= msg->BufferEnd;
+}
+
+static void client_do_plan_args( MIDL_STUB_MESSAGE *msg, const struct ndr_proc_plan *plan,
+                                 struct ndr_plan_state *state, enum stubless_phase phase,
+                                 void **fpu_args, unsigned char *retval )
+{
+    const struct ndr_plan_param *p;
+    unsigned char *arg, *mem, *base;
+    unsigned int i;
+    float f;
+
+    TRACE( "plan %p phase %d\n", plan, phase );
+
+    switch (phase)
+    {
+    case STUBLESS_CALCSIZE:
+        if (plan->in_fixed && !msg->BufferLength)
+        {
+            for (i = 0, p = plan->params; i < plan->count; i++, p++)
+                if (p->param.attr.IsSimpleRef && !*(unsigned char **)(msg->StackTop + p->param.stack_offset))
+                    RpcRaiseException( RPC_X_NULL_REF_POINTER );
+            msg->BufferLength = plan->in_size;
+            break;
+        }
+        for (i = 0, p = plan->params; i < plan->count; i++, p++)
+        {
+            arg = msg->StackTop + p->param.stack_offset;
+            if (p->param.attr.IsSimpleRef && !*(unsigned char **)arg)
+                RpcRaiseException( RPC_X_NULL_REF_POINTER );
+            if (!p->param.attr.IsIn) continue;
+
+            switch (p->op)
+            {
+            case NDR_OP_BASETYPE:
+            case NDR_OP_STRUCT:
+                msg->BufferLength = plan_align( msg->BufferLength, p->align );
+                plan_length_increment( msg, p->size );
+                break;
+            case NDR_OP_CARRAY:
+                if (!(mem = *(unsigned char **)arg))
+                {
+                    ERR( "NULL ref pointer is not allowed\n" );
+                    RpcRaiseException( RPC_X_NULL_REF_POINTER );
+                }
+                ComputeConformance( msg, mem, p->array_format + 4, 0 );
+                state->counts[p->index] = msg->MaxCount;
+                msg->BufferLength = plan_align( msg->BufferLength, 4 );
+                plan_length_increment( msg, 4 );
+                msg->BufferLength = plan_align( msg->BufferLength, p->align );
+                if ((ULONGLONG)p->size * msg->MaxCount > 0xffffffff) RpcRaiseException( RPC_S_INVALID_BOUND );
+                plan_length_increment( msg, p->size * msg->MaxCount );
+                break;
+            default:
+                plan_size_generic( msg, arg, p );
+                break;
+            }
+        }
+        break;
+
+    case STUBLESS_MARSHAL:
+        if (plan->in_fixed && plan_can_write_block( msg, plan->in_size ))
+        {
+            base = msg->Buffer;
+            memset( base, 0, plan->in_size );
+            for (i = 0, p = plan->params; i < plan->count; i++, p++)
+            {
+                if (!p->param.attr.IsIn) continue;
+                mem = client_plan_memory( msg->StackTop + p->param.stack_offset, p, fpu_args, &f );
+                memcpy( base + p->in_offset, mem, p->size );
+            }
+            msg->Buffer += plan->in_size;
+            break;
+        }
+        for (i = 0, p = plan->params; i < plan->count; i++, p++)
+        {
+            if (!p->param.attr.IsIn) continue;
+            arg = msg->StackTop + p->param.stack_offset;
+
+            switch (p->op)
+            {
+            case NDR_OP_BASETYPE:
+            case NDR_OP_STRUCT:
+                plan_align_buffer_clear( msg, p->align );
+                msg->BufferMark = msg->Buffer;
+                plan_copy_to_buffer( msg, client_plan_memory( arg, p, fpu_args, &f ), p->size );
+                break;
+            case NDR_OP_CARRAY:
+                msg->MaxCount = state->counts[p->index];
+                plan_align_buffer_clear( msg, 4 );
+                plan_copy_to_buffer( msg, &state->counts[p->index], sizeof(ULONG) );
+                plan_align_buffer_clear( msg, p->align );
+                plan_copy_to_buffer( msg, *(unsigned char **)arg, p->size * state->counts[p->index] );
+                break;
+            default:
+                plan_marshall_generic( msg, arg, p );
+                break;
+            }
+        }
+        break;
+
+    case STUBLESS_UNMARSHAL:
+        if (plan->out_fixed && plan_can_read_block( msg, plan->out_size ))
+        {
+            base = msg->Buffer;
+            for (i = 0, p = plan->params; i < plan->count; i++, p++)
+            {
+                if (!p->param.attr.IsOut) continue;
+                arg = (p->param.attr.IsReturn && retval) ? retval : msg->StackTop + p->param.stack_offset;
+                plan_unmarshall_fixed( msg, arg, p, base + p->out_offset );
+            }
+            msg->Buffer += plan->out_size;
+            break;
+        }
+        for (i = 0, p = plan->params; i < plan->count; i++, p++)
+        {
+            if (!p->param.attr.IsOut) continue;
+            arg = (p->param.attr.IsReturn && retval) ? retval : msg->StackTop + p->param.stack_offset;
+            if (plan_param_is_fixed( p ))
+                plan_unmarshall_fixed( msg, arg, p, plan_read_buffer( msg, p->align, p->size ));
+            else
+                plan_unmarshall_generic( msg, arg, p );
+        }
+        break;
+
+    default:
+        RpcRaiseException( RPC_S_INTERNAL_ERROR );
+    }
+}
+
 struct ndr_client_call_ctx
 {
     MIDL_STUB_MESSAGE *stub_msg;
@@ -705,9 +1212,11 @@ static void CALLBACK ndr_client_call_finally(BOOL normal, void *arg)
 static LONG_PTR do_ndr_client_call( const MIDL_STUB_DESC *stub_desc, const PFORMAT_STRING format,
         const PFORMAT_STRING handle_format, void **stack_top, void **fpu_stack, MIDL_STUB_MESSAGE *stub_msg,
         unsigned short procedure_number, unsigned short stack_size, unsigned int number_of_params,
-        INTERPRETER_OPT_FLAGS Oif_flags, INTERPRETER_OPT_FLAGS2 ext_flags, const NDR_PROC_HEADER *proc_header )
+        INTERPRETER_OPT_FLAGS Oif_flags, INTERPRETER_OPT_FLAGS2 ext_flags, const NDR_PROC_HEADER *proc_header,
+        const struct ndr_proc_plan *plan )
 {
     struct ndr_client_call_ctx finally_ctx;
+    struct ndr_plan_state plan_state;
     RPC_MESSAGE rpc_msg;
     handle_t hbinding = NULL;
     /* the value to return to the client from the remote procedure */
@@ -795,8 +1304,12 @@ static LONG_PTR do_ndr_client_call( const MIDL_STUB_DESC *stub_desc, const PFORM
 
         /* 2. CALCSIZE */
         TRACE( "CALCSIZE\n" );
-        client_do_args(stub_msg, format, STUBLESS_CALCSIZE, fpu_stack,
-                       number_of_params, (unsigned char *)&retval);
+        if (plan)
+            client_do_plan_args(stub_msg, plan, &plan_state, STUBLESS_CALCSIZE, fpu_stack,
+                                (unsigned char *)&retval);
+        else
+            client_do_args(stub_msg, format, STUBLESS_CALCSIZE, fpu_stack,
+                           number_of_params, (unsigned char *)&retval);
 
         /* 3. GETBUFFER */
         TRACE( "GETBUFFER\n" );
@@ -815,8 +1328,12 @@ static LONG_PTR do_ndr_client_call( const MIDL_STUB_DESC *stub_desc, const PFORM
 
         /* 4. MARSHAL */
         TRACE( "MARSHAL\n" );
-        client_do_args(stub_msg, format, STUBLESS_MARSHAL, fpu_stack,
-                       number_of_params, (unsigned char *)&retval);
+        if (plan)
+            client_do_plan_args(stub_msg, plan, &plan_state, STUBLESS_MARSHAL, fpu_stack,
+                                (unsigned char *)&retval);
+        else
+            client_do_args(stub_msg, format, STUBLESS_MARSHAL, fpu_stack,
+                           number_of_params, (unsigned char *)&retval);
 
         /* 5. SENDRECEIVE */
         TRACE( "SENDRECEIVE\n" );
@@ -841,8 +1358,12 @@ static LONG_PTR do_ndr_client_call( const MIDL_STUB_DESC *stub_desc, const PFORM
 
         /* 6. UNMARSHAL */
         TRACE( "UNMARSHAL\n" );
-        client_do_args(stub_msg, format, STUBLESS_UNMARSHAL, fpu_stack,
-                       number_of_params, (unsigned char *)&retval);
+        if (plan)
+            client_do_plan_args(stub_msg, plan, &plan_state, STUBLESS_UNMARSHAL, fpu_stack,
+                                (unsigned char *)&retval);
+        else
+            client_do_args(stub_msg, format, STUBLESS_UNMARSHAL, fpu_stack,
+                           number_of_params, (unsigned char *)&retval);
     }
     __FINALLY_CTX(ndr_client_call_finally, &finally_ctx)
 
@@ -870,6 +1391,8 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
     LONG_PTR RetVal = 0;
     PFORMAT_STRING pHandleFormat;
     NDR_PARAM_OIF old_args[256];
+    /* precompiled marshalling plan, not used for old style format strings */
+    const struct ndr_proc_plan *plan = NULL;
 
     TRACE("pStubDesc %p, pFormat %p, ...\n", pStubDesc, pFormat);
 
@@ -930,6 +1453,9 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
             }
 #endif
         }
+
+        if (!Oif_flags.HasPipes)
+            plan = ndr_get_proc_plan( pStubDesc, pFormat, number_of_params, ext_flags );
     }
     else
     {
@@ -944,7 +1470,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
         {
             RetVal = do_ndr_client_call(pStubDesc, pFormat, pHandleFormat,
                     stack_top, fpu_stack, &stubMsg, procedure_number, stack_size,
-                    number_of_params, Oif_flags, ext_flags, pProcHeader);
+                    number_of_params, Oif_flags, ext_flags, pProcHeader, plan);
         }
         __EXCEPT_ALL
         {
@@ -962,7 +1488,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
         {
             RetVal = do_ndr_client_call(pStubDesc, pFormat, pHandleFormat,
                     stack_top, fpu_stack, &stubMsg, procedure_number, stack_size,
-                    number_of_params, Oif_flags, ext_flags, pProcHeader);
+                    number_of_params, Oif_flags, ext_flags, pProcHeader, plan);
         }
         __EXCEPT_ALL
         {
@@ -995,7 +1521,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
     {
         RetVal = do_ndr_client_call(pStubDesc, pFormat, pHandleFormat,
                 stack_top, fpu_stack, &stubMsg, procedure_number, stack_size,
-                number_of_params, Oif_flags, ext_flags, pProcHeader);
+                number_of_params, Oif_flags, ext_flags, pProcHeader, plan);
     }
 
     TRACE("RetVal = 0x%Ix\n", RetVal);
@@ -1299,6 +1825,86 @@ static LONG_PTR *stub_do_args(MIDL_STUB_MESSAGE *pStubMsg,
     return retval_ptr;
 }
 
+static void stub_do_plan_args( MIDL_STUB_MESSAGE *msg, const struct ndr_proc_plan *plan, enum stubless_phase phase )
+{
+    const struct ndr_plan_param *p;
+    unsigned char *arg, *base;
+    unsigned int i;
+
+    TRACE( "plan %p phase %d\n", plan, phase );
+
+    switch (phase)
+    {
+    case STUBLESS_UNMARSHAL:
+        base = plan->in_fixed && plan_can_read_block( msg, plan->in_size ) ? msg->Buffer : NULL;
+        for (i = 0, p = plan->params; i < plan->count; i++, p++)
+        {
+            arg = msg->StackTop + p->param.stack_offset;
+            if (p->param.attr.ServerAllocSize)
+                *(void **)arg = calloc( p->param.attr.ServerAllocSize, 8 );
+            if (!p->param.attr.IsIn) continue;
+
+            if (base)
+                plan_unmarshall_fixed( msg, arg, p, base + p->in_offset );
+            else if (plan_param_is_fixed( p ))
+                plan_unmarshall_fixed( msg, arg, p, plan_read_buffer( msg, p->align, p->size ));
+            else
+                plan_unmarshall_generic( msg, arg, p );
+        }
+        if (base) msg->Buffer += plan->in_size;
+        break;
+
+    case STUBLESS_CALCSIZE:
+        if (plan->out_fixed && !msg->BufferLength)
+        {
+            msg->BufferLength = plan->out_size;
+            break;
+        }
+        for (i = 0, p = plan->params; i < plan->count; i++, p++)
+        {
+            if (!p->param.attr.IsOut && !p->param.attr.IsReturn) continue;
+            if (plan_param_is_fixed( p ))
+            {
+                msg->BufferLength = plan_align( msg->BufferLength, p->align );
+                plan_length_increment( msg, p->size );
+            }
+            else plan_size_generic( msg, msg->StackTop + p->param.stack_offset, p );
+        }
+        break;
+
+    case STUBLESS_MARSHAL:
+        if (plan->out_fixed && plan_can_write_block( msg, plan->out_size ))
+        {
+            base = msg->Buffer;
+            memset( base, 0, plan->out_size );
+            for (i = 0, p = plan->params; i < plan->count; i++, p++)
+            {
+                if (!p->param.attr.IsOut) continue;
+                arg = msg->StackTop + p->param.stack_offset;
+                memcpy( base + p->out_offset, plan_param_memory( arg, &p->param ), p->size );
+            }
+            msg->Buffer += plan->out_size;
+            break;
+        }
+        for (i = 0, p = plan->params; i < plan->count; i++, p++)
+        {
+            if (!p->param.attr.IsOut && !p->param.attr.IsReturn) continue;
+            arg = msg->StackTop + p->param.stack_offset;
+            if (plan_param_is_fixed( p ))
+            {
+                plan_align_buffer_clear( msg, p->align );
+                msg->BufferMark = msg->Buffer;
+                plan_copy_to_buffer( msg, plan_param_memory( arg, &p->param ), p->size );
+            }
+            else plan_marshall_generic( msg, arg, p );
+        }
+        break;
+
+    default:
+        RpcRaiseException( RPC_S_INTERNAL_ERROR );
+    }
+}
+
 /***********************************************************************
  *            NdrStubCall2 [RPCRT4.@]
  *
@@ -1336,6 +1942,8 @@ LONG WINAPI NdrStubCall2(
     LONG_PTR *retval_ptr = NULL;
     /* correlation cache */
     ULONG_PTR NdrCorrCache[256];
+    /* precompiled marshalling plan, not used for old style format strings */
+    const struct ndr_proc_plan *plan = NULL;
 
     TRACE("pThis %p, pChannel %p, pRpcMsg %p, pdwStubPhase %p\n", pThis, pChannel, pRpcMsg, pdwStubPhase);
 
@@ -1466,6 +2074,8 @@ LONG WINAPI NdrStubCall2(
             if (ext_flags.Unused & 0x2) /* has range on conformance */
                 stubMsg.CorrDespIncrement = 12;
         }
+
+        plan = ndr_get_proc_plan( pStubDesc, pFormat, number_of_params, ext_flags );
     }
     else
     {
@@ -1534,9 +2144,15 @@ LONG WINAPI NdrStubCall2(
             }
             break;
         case STUBLESS_UNMARSHAL:
-        case STUBLESS_INITOUT:
         case STUBLESS_CALCSIZE:
         case STUBLESS_MARSHAL:
+            if (plan)
+            {
+                stub_do_plan_args(&stubMsg, plan, phase);
+                break;
+            }
+            /* fall through */
+        case STUBLESS_INITOUT:
         case STUBLESS_MUSTFREE:
         case STUBLESS_FREE:
             retval_ptr = stub_do_args(&stubMsg, pFormat, phase, number_of_params);
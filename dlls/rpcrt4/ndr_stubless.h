@@ -19,6 +19,7 @@
  */
 
 #include "ndrtypes.h"
+#include "ndr_misc.h"
 
 /* there can't be any alignment with the structures in this file */
 #include "pshpack1.h"
@@ -241,6 +242,54 @@ struct async_call_data
     ULONG_PTR NdrCorrCache[256];
 };
 
+/* precompiled parameter marshalling plans */
+
+enum ndr_plan_op
+{
+    NDR_OP_GENERIC,   /* dispatched through the NdrMarshaller & co. tables */
+    NDR_OP_BASETYPE,  /* base type with identical memory and wire layout */
+    NDR_OP_STRUCT,    /* FC_STRUCT, i.e. a struct without embedded pointers */
+    NDR_OP_CARRAY,    /* ref pointer to a conformant array of base types */
+};
+
+struct ndr_plan_param
+{
+    NDR_PARAM_OIF param;        /* parameter description from the proc format string */
+    unsigned char op;           /* enum ndr_plan_op */
+    unsigned char align;        /* wire alignment of the data (or array elements) */
+    unsigned short size;        /* wire size of the data (or of one array element) */
+    unsigned short in_offset;   /* offset in the [in] buffer when all [in] params are fixed-size */
+    unsigned short out_offset;  /* offset in the [out] buffer when all [out] params are fixed-size */
+    unsigned short index;       /* index of the conformance in ndr_plan_state, for NDR_OP_CARRAY */
+    PFORMAT_STRING format;      /* resolved type format string */
+    PFORMAT_STRING array_format; /* FC_CARRAY description, for NDR_OP_CARRAY */
+    NDR_BUFFERSIZE sizer;
+    NDR_MARSHALL marshaller;
+    NDR_UNMARSHALL unmarshaller;
+};
+
+struct ndr_proc_plan
+{
+    struct ndr_proc_plan *next;
+    const MIDL_STUB_DESC *stub_desc;
+    PFORMAT_STRING format;      /* parameter format string the plan was compiled from */
+    unsigned int count;         /* number of parameters */
+    BOOL in_fixed;              /* all [in] params have a constant wire size */
+    BOOL out_fixed;             /* all [out] params have a constant wire size */
+    ULONG in_size;              /* wire size of the [in] params, if in_fixed */
+    ULONG out_size;             /* wire size of the [out] params, if out_fixed */
+    unsigned int carray_count;  /* number of NDR_OP_CARRAY params */
+    struct ndr_plan_param params[1];
+};
+
+#define NDR_PLAN_MAX_CARRAYS 8
+
+/* per-call state of a plan, carried from the sizing to the marshalling pass */
+struct ndr_plan_state
+{
+    ULONG counts[NDR_PLAN_MAX_CARRAYS];
+};
+
 enum stubless_phase
 {
     STUBLESS_UNMARSHAL,
@@ -262,5 +311,10 @@ void client_do_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFormat, enum s
 PFORMAT_STRING convert_old_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFormat,
                                  unsigned int stack_size, BOOL object_proc,
                                  void *buffer, unsigned int size, unsigned int *count );
+const struct ndr_proc_plan *ndr_get_proc_plan( const MIDL_STUB_DESC *stub_desc, PFORMAT_STRING format,
+                                               unsigned int count, INTERPRETER_OPT_FLAGS2 ext_flags );
+void ndr_flush_proc_plans( const MIDL_STUB_DESC *stub_desc );
+void ndr_init_proc_plans(void);
+void ndr_free_proc_plans(void);
 RPC_STATUS NdrpCompleteAsyncClientCall(RPC_ASYNC_STATE *pAsync, void *Reply);
 RPC_STATUS NdrpCompleteAsyncServerCall(RPC_ASYNC_STATE *pAsync, void *Reply);
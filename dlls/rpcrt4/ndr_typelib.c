@@ -1327,6 +1327,7 @@ static ULONG WINAPI typelib_proxy_Release(IRpcProxyBuffer *iface)
             IUnknown_Release(proxy->proxy.base_object);
         if (proxy->proxy.base_proxy)
             IRpcProxyBuffer_Release(proxy->proxy.base_proxy);
+        ndr_flush_proc_plans(&proxy->stub_desc);
         free((void *)proxy->stub_desc.pFormatTypes);
         free((void *)proxy->proxy_info.ProcFormatString);
         free(proxy->offset_table);
@@ -1468,6 +1469,7 @@ static ULONG WINAPI typelib_stub_Release(IRpcStubBuffer *iface)
             free(stub->dispatch_table);
         }
 
+        ndr_flush_proc_plans(&stub->stub_desc);
         free((void *)stub->stub_desc.pFormatTypes);
         free((void *)stub->server_info.ProcString);
         free(stub->offset_table);
@@ -355,7 +355,7 @@ static RPC_STATUS RpcAssoc_BindConnection(const RpcAssoc *assoc, RpcConnection *
         break;
     }
 
-    I_RpcFree(msg.Buffer);
+    RPCRT4_FreeMessageBuffer(msg.Buffer);
     free(response_hdr);
     free(auth_data);
     return status;
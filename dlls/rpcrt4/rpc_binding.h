@@ -263,5 +263,7 @@ RpcBinding *RPCRT4_GetThreadCurrentCallHandle(void);
 void RPCRT4_PushThreadContextHandle(NDR_SCONTEXT SContext);
 void RPCRT4_RemoveThreadContextHandle(NDR_SCONTEXT SContext);
 NDR_SCONTEXT RPCRT4_PopThreadContextHandle(void);
+void *RPCRT4_AllocMessageBuffer(unsigned int size);
+void RPCRT4_FreeMessageBuffer(void *buffer);
 
 #endif
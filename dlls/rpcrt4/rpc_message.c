@@ -1410,7 +1410,7 @@ RPC_STATUS RPCRT4_ReceiveWithAuth(RpcConnection *Connection, RpcPktHdr **Header,
 
   TRACE("buffer length = %u\n", pMsg->BufferLength);
 
-  pMsg->Buffer = I_RpcAllocate(pMsg->BufferLength);
+  pMsg->Buffer = RPCRT4_AllocMessageBuffer(pMsg->BufferLength);
   if (!pMsg->Buffer)
   {
     status = ERROR_OUTOFMEMORY;
@@ -1525,7 +1525,7 @@ fail:
   if (CurrentHeader != *Header)
     free(CurrentHeader);
   if (status != RPC_S_OK) {
-    I_RpcFree(pMsg->Buffer);
+    RPCRT4_FreeMessageBuffer(pMsg->Buffer);
     pMsg->Buffer = NULL;
     free(*Header);
     *Header = NULL;
@@ -1642,7 +1642,7 @@ RPC_STATUS WINAPI I_RpcGetBuffer(PRPC_MESSAGE pMsg)
     return RPC_S_INVALID_BINDING;
   }
 
-  pMsg->Buffer = I_RpcAllocate(pMsg->BufferLength);
+  pMsg->Buffer = RPCRT4_AllocMessageBuffer(pMsg->BufferLength);
   TRACE("Buffer=%p\n", pMsg->Buffer);
 
   if (!pMsg->Buffer)
@@ -1652,7 +1652,7 @@ RPC_STATUS WINAPI I_RpcGetBuffer(PRPC_MESSAGE pMsg)
   {
     status = I_RpcNegotiateTransferSyntax(pMsg);
     if (status != RPC_S_OK)
-      I_RpcFree(pMsg->Buffer);
+      RPCRT4_FreeMessageBuffer(pMsg->Buffer);
   }
   else
     status = RPC_S_OK;
@@ -1706,7 +1706,7 @@ RPC_STATUS WINAPI I_RpcFreeBuffer(PRPC_MESSAGE pMsg)
     RPCRT4_ReleaseBinding(bind);
     pMsg->ReservedForRuntime = NULL;
   }
-  I_RpcFree(pMsg->Buffer);
+  RPCRT4_FreeMessageBuffer(pMsg->Buffer);
   return RPC_S_OK;
 }
 
@@ -1922,7 +1922,7 @@ RPC_STATUS WINAPI I_RpcSendReceive(PRPC_MESSAGE pMsg)
     status = I_RpcReceive(pMsg);
   /* free the buffer replaced by a new buffer in I_RpcReceive */
   if (status == RPC_S_OK)
-    I_RpcFree(original_buffer);
+    RPCRT4_FreeMessageBuffer(original_buffer);
   return status;
 }
 
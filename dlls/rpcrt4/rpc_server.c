@@ -467,7 +467,7 @@ static RPC_STATUS process_request_packet(RpcConnection *conn, RpcPktRequestHdr *
 
   if (msg->Buffer == buf) buf = NULL;
   TRACE("freeing Buffer=%p\n", buf);
-  I_RpcFree(buf);
+  RPCRT4_FreeMessageBuffer(buf);
 
   return status;
 }
@@ -524,7 +524,7 @@ static void RPCRT4_process_packet(RpcConnection* conn, RpcPktHdr* hdr,
   }
 
   /* clean up */
-  I_RpcFree(msg->Buffer);
+  RPCRT4_FreeMessageBuffer(msg->Buffer);
   free(hdr);
   free(msg);
   free(auth_data);
@@ -577,7 +577,7 @@ static DWORD CALLBACK RPCRT4_io_thread(LPVOID the_arg)
 
       packet = malloc(sizeof(RpcPacket));
       if (!packet) {
-        I_RpcFree(msg->Buffer);
+        RPCRT4_FreeMessageBuffer(msg->Buffer);
         free(hdr);
         free(msg);
         free(auth_data);
@@ -608,7 +608,7 @@ static DWORD CALLBACK RPCRT4_io_thread(LPVOID the_arg)
       break;
     }
 
-    I_RpcFree(msg->Buffer);
+    RPCRT4_FreeMessageBuffer(msg->Buffer);
     free(hdr);
     free(msg);
     free(auth_data);
@@ -530,3 +530,7 @@
 @ stub tree_into_ndr
 @ stub tree_peek_ndr
 @ stub tree_size_ndr
+
+################################################################
+# Wine internal extensions
+@ stdcall __wine_rpc_get_buffer_stats(ptr ptr)
@@ -31,6 +31,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <malloc.h>
 #include <string.h>
 
 #include "ntstatus.h"
@@ -52,6 +53,7 @@
 
 #include "rpc_binding.h"
 #include "rpc_server.h"
+#include "ndr_stubless.h"
 
 #include "wine/debug.h"
 
@@ -85,6 +87,31 @@ struct context_handle_list
     NDR_SCONTEXT context_handle;
 };
 
+/* message buffers are cached by size class, from 256 bytes to 32k */
+#define BUFFER_CACHE_MIN_SIZE     256
+#define BUFFER_CACHE_CLASSES      8
+#define BUFFER_CACHE_THREAD_DEPTH 4
+#define BUFFER_CACHE_SHARED_DEPTH 16
+
+struct buffer_cache
+{
+    LONG count[BUFFER_CACHE_CLASSES];
+    void *buffers[BUFFER_CACHE_CLASSES][BUFFER_CACHE_SHARED_DEPTH];
+};
+
+/* buffers freed by a thread with a full cache, or received on another thread */
+static struct buffer_cache shared_buffer_cache;
+static LONG buffer_cache_allocs, buffer_cache_reuses;
+
+static CRITICAL_SECTION buffer_cache_cs;
+static CRITICAL_SECTION_DEBUG buffer_cache_cs_debug =
+{
+    0, 0, &buffer_cache_cs,
+    { &buffer_cache_cs_debug.ProcessLocksList, &buffer_cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": buffer_cache_cs") }
+};
+static CRITICAL_SECTION buffer_cache_cs = { &buffer_cache_cs_debug, -1, 0, 0, 0, 0 };
+
 struct threaddata
 {
     struct list entry;
@@ -93,8 +120,17 @@ struct threaddata
     RpcConnection *connection;
     RpcBinding *server_binding;
     struct context_handle_list *context_handle_list;
+    struct buffer_cache buffer_cache; /* only the first BUFFER_CACHE_THREAD_DEPTH entries are used */
 };
 
+static void free_buffer_cache(struct buffer_cache *cache)
+{
+    unsigned int i;
+
+    for (i = 0; i < BUFFER_CACHE_CLASSES; i++)
+        while (cache->count[i]) free(cache->buffers[i][--cache->count[i]]);
+}
+
 struct interface_header
 {
     unsigned int length;
@@ -120,6 +156,7 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved)
 
     switch (fdwReason) {
     case DLL_PROCESS_ATTACH:
+        ndr_init_proc_plans();
         break;
 
     case DLL_THREAD_DETACH:
@@ -136,14 +173,18 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved)
                 ERR("tdata->connection should be NULL but is still set to %p\n", tdata->connection);
             if (tdata->server_binding)
                 ERR("tdata->server_binding should be NULL but is still set to %p\n", tdata->server_binding);
+            free_buffer_cache(&tdata->buffer_cache);
             free(tdata);
         }
         break;
 
     case DLL_PROCESS_DETACH:
+        TRACE("message buffers: %ld allocated, %ld reused\n", buffer_cache_allocs, buffer_cache_reuses);
         if (lpvReserved) break; /* do nothing if process is shutting down */
         RPCRT4_destroy_all_protseqs();
         RPCRT4_ServerFreeAllRegisteredAuthInfo();
+        ndr_free_proc_plans();
+        free_buffer_cache(&shared_buffer_cache);
         DeleteCriticalSection(&uuid_cs);
         DeleteCriticalSection(&threaddata_cs);
         break;
@@ -964,6 +1005,94 @@ static struct threaddata *get_or_create_threaddata(void)
     return tdata;
 }
 
+/***********************************************************************
+ *             RPCRT4_AllocMessageBuffer
+ *
+ * Allocates a message buffer, reusing one freed by RPCRT4_FreeMessageBuffer
+ * when possible. The buffer can also be released with I_RpcFree.
+ */
+void *RPCRT4_AllocMessageBuffer(unsigned int size)
+{
+    struct threaddata *tdata = get_or_create_threaddata();
+    unsigned int class = 0;
+    void *buffer = NULL;
+
+    while (class < BUFFER_CACHE_CLASSES && (BUFFER_CACHE_MIN_SIZE << class) < size) class++;
+    if (class == BUFFER_CACHE_CLASSES)
+    {
+        InterlockedIncrement(&buffer_cache_allocs);
+        return malloc(size);
+    }
+
+    /* the shared count is read unlocked, as a hint to avoid taking the lock
+     * when the shared cache is empty; it is checked again once locked */
+    if (tdata && tdata->buffer_cache.count[class])
+        buffer = tdata->buffer_cache.buffers[class][--tdata->buffer_cache.count[class]];
+    else if (ReadNoFence(&shared_buffer_cache.count[class]))
+    {
+        EnterCriticalSection(&buffer_cache_cs);
+        if (shared_buffer_cache.count[class])
+            buffer = shared_buffer_cache.buffers[class][--shared_buffer_cache.count[class]];
+        LeaveCriticalSection(&buffer_cache_cs);
+    }
+
+    if (buffer)
+    {
+        InterlockedIncrement(&buffer_cache_reuses);
+        return buffer;
+    }
+    InterlockedIncrement(&buffer_cache_allocs);
+    return malloc(BUFFER_CACHE_MIN_SIZE << class);
+}
+
+/***********************************************************************
+ *             RPCRT4_FreeMessageBuffer
+ */
+void RPCRT4_FreeMessageBuffer(void *buffer)
+{
+    struct threaddata *tdata = NtCurrentTeb()->ReservedForNtRpc;
+    size_t size;
+    int class;
+
+    if (!buffer) return;
+
+    /* buffers that were reallocated may have any size, keep them in the class they fit in */
+    size = _msize(buffer);
+    for (class = BUFFER_CACHE_CLASSES - 1; class >= 0; class--)
+        if ((BUFFER_CACHE_MIN_SIZE << class) <= size) break;
+    if (class < 0 || size >= BUFFER_CACHE_MIN_SIZE << BUFFER_CACHE_CLASSES)
+    {
+        free(buffer);
+        return;
+    }
+
+    if (tdata && tdata->buffer_cache.count[class] < BUFFER_CACHE_THREAD_DEPTH)
+    {
+        tdata->buffer_cache.buffers[class][tdata->buffer_cache.count[class]++] = buffer;
+        return;
+    }
+
+    EnterCriticalSection(&buffer_cache_cs);
+    if (shared_buffer_cache.count[class] < BUFFER_CACHE_SHARED_DEPTH)
+    {
+        shared_buffer_cache.buffers[class][shared_buffer_cache.count[class]++] = buffer;
+        buffer = NULL;
+    }
+    LeaveCriticalSection(&buffer_cache_cs);
+    free(buffer);
+}
+
+/***********************************************************************
+ *             __wine_rpc_get_buffer_stats (RPCRT4.@)
+ *
+ * Returns the number of message buffers allocated and reused so far.
+ */
+void WINAPI __wine_rpc_get_buffer_stats(LONG *allocs, LONG *reuses)
+{
+    *allocs = ReadNoFence(&buffer_cache_allocs);
+    *reuses = ReadNoFence(&buffer_cache_reuses);
+}
+
 void RPCRT4_SetThreadCurrentConnection(RpcConnection *Connection)
 {
     struct threaddata *tdata = get_or_create_threaddata();
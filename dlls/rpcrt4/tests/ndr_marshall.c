@@ -37,6 +37,8 @@
 #include "wine/heap.h"
 #include "wine/test.h"
 
+static void (WINAPI *p__wine_rpc_get_buffer_stats)(LONG *, LONG *);
+
 static int my_alloc_called;
 static int my_free_called;
 static void * CALLBACK my_alloc(SIZE_T size)
@@ -2598,8 +2600,15 @@ static void test_conf_complex_array(void)
     HeapFree(GetProcessHeap(), 0, memsrc.array);
 }
 
+static DWORD WINAPI free_buffer_thread(void *arg)
+{
+    NdrFreeBuffer(arg);
+    return 0;
+}
+
 static void test_ndr_buffer(void)
 {
+    static const unsigned int buffer_sizes[] = {10, 256, 300, 4000, 32768, 100000};
     static unsigned char ncalrpc[] = "ncalrpc";
     static unsigned char endpoint[] = "winetest:test_ndr_buffer";
     RPC_MESSAGE RpcMessage;
@@ -2611,6 +2620,7 @@ static void test_ndr_buffer(void)
     RPC_STATUS status;
     ULONG prev_buffer_length;
     BOOL old_buffer_valid_location;
+    unsigned int i;
 
     StubDesc.RpcInterfaceInformation = (void *)&IFoo___RpcServerInterface;
 
@@ -2670,6 +2680,48 @@ static void test_ndr_buffer(void)
     /* attempt double-free */
     NdrFreeBuffer(&StubMsg);
 
+    /* message buffers of all sizes can be allocated and freed repeatedly, on any thread */
+    for (i = 0; i < 2 * ARRAY_SIZE(buffer_sizes); i++)
+    {
+        NdrClientInitializeNew(&RpcMessage, &StubMsg, &StubDesc, 5);
+        ret = NdrGetBuffer(&StubMsg, buffer_sizes[i % ARRAY_SIZE(buffer_sizes)], Handle);
+        ok(ret != NULL, "%u: NdrGetBuffer returned NULL\n", i);
+        ok(RpcMessage.BufferLength >= buffer_sizes[i % ARRAY_SIZE(buffer_sizes)],
+           "%u: got BufferLength %u\n", i, RpcMessage.BufferLength);
+        memset(RpcMessage.Buffer, 0xcc, RpcMessage.BufferLength);
+
+        if (i % 2)
+        {
+            HANDLE thread = CreateThread(NULL, 0, free_buffer_thread, &StubMsg, 0, NULL);
+            ok(!WaitForSingleObject(thread, 5000), "%u: wait failed\n", i);
+            CloseHandle(thread);
+        }
+        else NdrFreeBuffer(&StubMsg);
+    }
+
+    /* buffers are reused in a steady loop, without allocating new ones */
+    if (p__wine_rpc_get_buffer_stats)
+    {
+        LONG allocs, reuses, prev_allocs, prev_reuses;
+
+        NdrClientInitializeNew(&RpcMessage, &StubMsg, &StubDesc, 5);
+        NdrGetBuffer(&StubMsg, 300, Handle);
+        NdrFreeBuffer(&StubMsg);
+
+        p__wine_rpc_get_buffer_stats(&prev_allocs, &prev_reuses);
+        for (i = 0; i < 100; i++)
+        {
+            NdrClientInitializeNew(&RpcMessage, &StubMsg, &StubDesc, 5);
+            ret = NdrGetBuffer(&StubMsg, 300, Handle);
+            ok(ret != NULL, "%u: NdrGetBuffer returned NULL\n", i);
+            NdrFreeBuffer(&StubMsg);
+        }
+        p__wine_rpc_get_buffer_stats(&allocs, &reuses);
+        ok(allocs == prev_allocs, "got %ld new allocations\n", allocs - prev_allocs);
+        ok(reuses - prev_reuses == 100, "got %ld reuses\n", reuses - prev_reuses);
+    }
+    else win_skip("__wine_rpc_get_buffer_stats not available\n");
+
     RpcBindingFree(&Handle);
 
     status = RpcServerUnregisterIf(NULL, NULL, FALSE);
@@ -2999,6 +3051,9 @@ static void test_NdrCorrelationInitialize(void)
 
 START_TEST( ndr_marshall )
 {
+    p__wine_rpc_get_buffer_stats = (void *)GetProcAddress(GetModuleHandleA("rpcrt4.dll"),
+                                                          "__wine_rpc_get_buffer_stats");
+
     determine_pointer_marshalling_style();
 
     test_ndr_simple_type();
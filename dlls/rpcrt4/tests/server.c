@@ -88,6 +88,9 @@ static int (__cdecl *sum_conf_array)(int x[], int n);
 static int (__cdecl *sum_conf_ptr_by_conf_ptr)(int n1, int *n2_then_x1, int *x2);
 static int (__cdecl *sum_unique_conf_array)(int x[], int n);
 static int (__cdecl *sum_unique_conf_ptr)(int *x, int n);
+static int (__cdecl *sum_ref_conf_ptr)(short *x, int n);
+static void (__cdecl *get_conf_ptr)(int n, int *x);
+static void (__cdecl *double_conf_ptr)(int n, int *x);
 static int (__cdecl *sum_var_array)(int x[20], int n);
 static int (__cdecl *dot_two_vectors)(vector_t vs[2]);
 static void (__cdecl *get_number_array)(int x[20], int *n);
@@ -183,6 +186,9 @@ static void (__cdecl *test_I_RpcBindingInqLocalClientPID)(unsigned int protseq,
     X(sum_conf_ptr_by_conf_ptr) \
     X(sum_unique_conf_array) \
     X(sum_unique_conf_ptr) \
+    X(sum_ref_conf_ptr) \
+    X(get_conf_ptr) \
+    X(double_conf_ptr) \
     X(sum_var_array) \
     X(dot_two_vectors) \
     X(get_number_array) \
@@ -498,6 +504,32 @@ int __cdecl s_sum_unique_conf_ptr(int *x, int n)
   return x ? s_sum_conf_array(x, n) : 0;
 }
 
+int __cdecl s_sum_ref_conf_ptr(short *x, int n)
+{
+  int i, sum = 0;
+
+  for (i = 0; i < n; i++)
+    sum += x[i];
+
+  return sum;
+}
+
+void __cdecl s_get_conf_ptr(int n, int *x)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    x[i] = i * i;
+}
+
+void __cdecl s_double_conf_ptr(int n, int *x)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    x[i] *= 2;
+}
+
 int __cdecl s_sum_var_array(int x[20], int n)
 {
   ok(0 <= n, "RPC sum_var_array\n");
@@ -1752,6 +1784,7 @@ array_tests(void)
   };
   int c[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
   int c2[] = {10, 100, 200};
+  short s[] = {0, 1, 2, 3, 4};
   int c3[20];
   vector_t vs[2] = {{1, -2, 3}, {4, -5, -6}};
   cps_t cps;
@@ -1792,6 +1825,21 @@ array_tests(void)
   ok(sum_unique_conf_ptr(ca, 5) == 3, "RPC sum_unique_conf_array\n");
   ok(sum_unique_conf_ptr(NULL, 10) == 0, "RPC sum_unique_conf_array\n");
 
+  ok(sum_ref_conf_ptr(s, 5) == 10, "RPC sum_ref_conf_ptr\n");
+  ok(sum_ref_conf_ptr(&s[3], 2) == 7, "RPC sum_ref_conf_ptr\n");
+  ok(sum_ref_conf_ptr(s, 0) == 0, "RPC sum_ref_conf_ptr\n");
+
+  memset(c3, 0xcc, sizeof(c3));
+  get_conf_ptr(6, c3);
+  for (n = 0; n < 6; n++)
+    ok(c3[n] == n * n, "get_conf_ptr returned wrong value %d @ %d\n", c3[n], n);
+  ok(c3[6] == (int)0xcccccccc, "get_conf_ptr wrote past the end of the array\n");
+
+  memcpy(c3, c, sizeof(c));
+  double_conf_ptr(10, c3);
+  for (n = 0; n < 10; n++)
+    ok(c3[n] == 2 * c[n], "double_conf_ptr returned wrong value %d @ %d\n", c3[n], n);
+
   get_number_array(c3, &n);
   ok(n == 10, "RPC get_num_array\n");
   for (; n > 0; n--)
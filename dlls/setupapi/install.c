@@ -39,6 +39,7 @@
 #include "setupapi.h"
 #include "setupapi_private.h"
 #include "wine/debug.h"
+#include "wine/list.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(setupapi);
 
@@ -58,6 +59,11 @@ struct registry_callback_info
     BOOL delete;
 };
 
+/* Wine extension: the entry may be registered concurrently with neighbouring entries that also have it */
+#define FLG_REGSVR_WINE_CONCURRENT  0x00010000
+
+#define REGISTER_DLL_MAX_THREADS    4
+
 /* info passed to callback functions dealing with registering dlls */
 struct register_dll_info
 {
@@ -67,6 +73,23 @@ struct register_dll_info
     int                 modules_size;
     int                 modules_count;
     HMODULE            *modules;
+    struct list         jobs;          /* pending concurrent registrations */
+    PTP_POOL            pool;
+    PTP_CLEANUP_GROUP   group;
+    TP_CALLBACK_ENVIRON environment;
+};
+
+/* a registration running on a worker thread */
+struct register_dll_job
+{
+    struct list                 entry;
+    BOOL                        unregister;
+    INT                         flags;
+    INT                         timeout;
+    WCHAR                      *args;
+    HMODULE                     module;
+    SP_REGISTER_CONTROL_STATUSW status;
+    WCHAR                       path[1];
 };
 
 typedef BOOL (*iterate_fields_func)( HINF hinf, PCWSTR field, void *arg );
@@ -539,43 +562,23 @@ static BOOL registry_callback( HINF hinf, PCWSTR field, void *arg )
 
 
 /***********************************************************************
- *            do_register_dll
+ *            register_module
  *
- * Register or unregister a dll.
+ * Load a dll and call its registration entry points, or run an executable.
+ * Returns the loaded module, which is kept loaded until the whole section is processed.
  */
-static BOOL do_register_dll( struct register_dll_info *info, const WCHAR *path,
-                             INT flags, INT timeout, const WCHAR *args )
+static HMODULE register_module( const WCHAR *path, INT flags, INT timeout, const WCHAR *args,
+                                BOOL unregister, SP_REGISTER_CONTROL_STATUSW *status )
 {
     HMODULE module;
     HRESULT res;
-    SP_REGISTER_CONTROL_STATUSW status;
     IMAGE_NT_HEADERS *nt;
 
-    status.cbSize = sizeof(status);
-    status.FileName = path;
-    status.FailureCode = SPREG_SUCCESS;
-    status.Win32Error = ERROR_SUCCESS;
-
-    if (info->callback)
-    {
-        switch(info->callback( info->callback_context, SPFILENOTIFY_STARTREGISTRATION,
-                               (UINT_PTR)&status, !info->unregister ))
-        {
-        case FILEOP_ABORT:
-            SetLastError( ERROR_OPERATION_ABORTED );
-            return FALSE;
-        case FILEOP_SKIP:
-            return TRUE;
-        case FILEOP_DOIT:
-            break;
-        }
-    }
-
     if (!(module = LoadLibraryExW( path, 0, LOAD_WITH_ALTERED_SEARCH_PATH )))
     {
         WARN( "could not load %s\n", debugstr_w(path) );
-        status.FailureCode = SPREG_LOADLIBRARY;
-        status.Win32Error = GetLastError();
+        status->FailureCode = SPREG_LOADLIBRARY;
+        status->Win32Error = GetLastError();
         goto done;
     }
 
@@ -601,8 +604,8 @@ static BOOL do_register_dll( struct register_dll_info *info, const WCHAR *path,
         free( cmd_line );
         if (!res)
         {
-            status.FailureCode = SPREG_LOADLIBRARY;
-            status.Win32Error = GetLastError();
+            status->FailureCode = SPREG_LOADLIBRARY;
+            status->Win32Error = GetLastError();
             goto done;
         }
         CloseHandle( process_info.hThread );
@@ -611,8 +614,8 @@ static BOOL do_register_dll( struct register_dll_info *info, const WCHAR *path,
         {
             /* timed out, kill the process */
             TerminateProcess( process_info.hProcess, 1 );
-            status.FailureCode = SPREG_TIMEOUT;
-            status.Win32Error = ERROR_TIMEOUT;
+            status->FailureCode = SPREG_TIMEOUT;
+            status->Win32Error = ERROR_TIMEOUT;
         }
         CloseHandle( process_info.hProcess );
         goto done;
@@ -620,13 +623,13 @@ static BOOL do_register_dll( struct register_dll_info *info, const WCHAR *path,
 
     if (flags & FLG_REGSVR_DLLREGISTER)
     {
-        const char *entry_point = info->unregister ? "DllUnregisterServer" : "DllRegisterServer";
+        const char *entry_point = unregister ? "DllUnregisterServer" : "DllRegisterServer";
         HRESULT (WINAPI *func)(void) = (void *)GetProcAddress( module, entry_point );
 
         if (!func)
         {
-            status.FailureCode = SPREG_GETPROCADDR;
-            status.Win32Error = GetLastError();
+            status->FailureCode = SPREG_GETPROCADDR;
+            status->Win32Error = GetLastError();
             goto done;
         }
 
@@ -636,8 +639,8 @@ static BOOL do_register_dll( struct register_dll_info *info, const WCHAR *path,
         if (FAILED(res))
         {
             WARN( "calling %s in %s returned error %lx\n", entry_point, debugstr_w(path), res );
-            status.FailureCode = SPREG_REGSVR;
-            status.Win32Error = res;
+            status->FailureCode = SPREG_REGSVR;
+            status->Win32Error = res;
             goto done;
         }
     }
@@ -648,46 +651,192 @@ static BOOL do_register_dll( struct register_dll_info *info, const WCHAR *path,
 
         if (!func)
         {
-            status.FailureCode = SPREG_GETPROCADDR;
-            status.Win32Error = GetLastError();
+            status->FailureCode = SPREG_GETPROCADDR;
+            status->Win32Error = GetLastError();
             goto done;
         }
 
         TRACE( "calling DllInstall(%d,%s) in %s\n",
-               !info->unregister, debugstr_w(args), debugstr_w(path) );
-        res = func( !info->unregister, args );
+               !unregister, debugstr_w(args), debugstr_w(path) );
+        res = func( !unregister, args );
 
         if (FAILED(res))
         {
             WARN( "calling DllInstall in %s returned error %lx\n", debugstr_w(path), res );
-            status.FailureCode = SPREG_REGSVR;
-            status.Win32Error = res;
+            status->FailureCode = SPREG_REGSVR;
+            status->Win32Error = res;
             goto done;
         }
     }
 
 done:
-    if (module)
+    return module;
+}
+
+
+/***********************************************************************
+ *            add_registered_module
+ */
+static void add_registered_module( struct register_dll_info *info, HMODULE module )
+{
+    if (!module) return;
+    if (info->modules_count >= info->modules_size)
     {
-        if (info->modules_count >= info->modules_size)
+        int new_size = max( 32, info->modules_size * 2 );
+        HMODULE *new = realloc( info->modules, new_size * sizeof(*new) );
+        if (new)
         {
-            int new_size = max( 32, info->modules_size * 2 );
-            HMODULE *new = realloc( info->modules, new_size * sizeof(*new) );
-            if (new)
-            {
-                info->modules_size = new_size;
-                info->modules = new;
-            }
+            info->modules_size = new_size;
+            info->modules = new;
+        }
+    }
+    if (info->modules_count < info->modules_size) info->modules[info->modules_count++] = module;
+    else FreeLibrary( module );
+}
+
+
+/***********************************************************************
+ *            do_register_dll
+ *
+ * Register or unregister a dll.
+ */
+static BOOL do_register_dll( struct register_dll_info *info, const WCHAR *path,
+                             INT flags, INT timeout, const WCHAR *args )
+{
+    SP_REGISTER_CONTROL_STATUSW status;
+
+    status.cbSize = sizeof(status);
+    status.FileName = path;
+    status.FailureCode = SPREG_SUCCESS;
+    status.Win32Error = ERROR_SUCCESS;
+
+    if (info->callback)
+    {
+        switch(info->callback( info->callback_context, SPFILENOTIFY_STARTREGISTRATION,
+                               (UINT_PTR)&status, !info->unregister ))
+        {
+        case FILEOP_ABORT:
+            SetLastError( ERROR_OPERATION_ABORTED );
+            return FALSE;
+        case FILEOP_SKIP:
+            return TRUE;
+        case FILEOP_DOIT:
+            break;
         }
-        if (info->modules_count < info->modules_size) info->modules[info->modules_count++] = module;
-        else FreeLibrary( module );
     }
+
+    add_registered_module( info, register_module( path, flags, timeout, args, info->unregister, &status ));
+
     if (info->callback) info->callback( info->callback_context, SPFILENOTIFY_ENDREGISTRATION,
                                         (UINT_PTR)&status, !info->unregister );
     return TRUE;
 }
 
 
+static void CALLBACK register_dll_worker( TP_CALLBACK_INSTANCE *instance, void *context )
+{
+    struct register_dll_job *job = context;
+    HRESULT hr = CoInitialize( NULL );
+
+    job->module = register_module( job->path, job->flags, job->timeout, job->args,
+                                   job->unregister, &job->status );
+    if (SUCCEEDED(hr)) CoUninitialize();
+}
+
+
+/***********************************************************************
+ *            queue_register_dll
+ *
+ * Register or unregister a dll on a worker thread. There is no callback
+ * to notify, so the dll is registered synchronously if anything fails.
+ */
+static BOOL queue_register_dll( struct register_dll_info *info, const WCHAR *path,
+                                INT flags, INT timeout, const WCHAR *args )
+{
+    struct register_dll_job *job;
+    DWORD len = lstrlenW( path ) + 1, args_len = args ? lstrlenW( args ) + 1 : 0;
+
+    if (!info->pool)
+    {
+        if (!(info->pool = CreateThreadpool( NULL ))) goto sync;
+        if (!(info->group = CreateThreadpoolCleanupGroup()))
+        {
+            CloseThreadpool( info->pool );
+            info->pool = NULL;
+            goto sync;
+        }
+        SetThreadpoolThreadMaximum( info->pool, REGISTER_DLL_MAX_THREADS );
+        info->environment.Version = 1;
+        info->environment.Pool = info->pool;
+        info->environment.CleanupGroup = info->group;
+        list_init( &info->jobs );
+    }
+
+    if (!(job = malloc( offsetof( struct register_dll_job, path[len + args_len] )))) goto sync;
+    job->unregister = info->unregister;
+    job->flags = flags;
+    job->timeout = timeout;
+    job->module = NULL;
+    lstrcpyW( job->path, path );
+    job->args = NULL;
+    if (args) job->args = lstrcpyW( job->path + len, args );
+    job->status.cbSize = sizeof(job->status);
+    job->status.FileName = job->path;
+    job->status.FailureCode = SPREG_SUCCESS;
+    job->status.Win32Error = ERROR_SUCCESS;
+
+    if (!TrySubmitThreadpoolCallback( register_dll_worker, job, &info->environment ))
+    {
+        free( job );
+        goto sync;
+    }
+    list_add_tail( &info->jobs, &job->entry );
+    return TRUE;
+
+sync:
+    return do_register_dll( info, path, flags, timeout, args );
+}
+
+
+/***********************************************************************
+ *            flush_register_dlls
+ *
+ * Wait for all the queued registrations to complete.
+ */
+static void flush_register_dlls( struct register_dll_info *info )
+{
+    struct register_dll_job *job, *next;
+
+    if (!info->pool) return;
+
+    CloseThreadpoolCleanupGroupMembers( info->group, FALSE, NULL );
+    LIST_FOR_EACH_ENTRY_SAFE( job, next, &info->jobs, struct register_dll_job, entry )
+    {
+        list_remove( &job->entry );
+        add_registered_module( info, job->module );
+        free( job );
+    }
+}
+
+
+/***********************************************************************
+ *            free_register_dll_info
+ */
+static void free_register_dll_info( struct register_dll_info *info )
+{
+    int i;
+
+    flush_register_dlls( info );
+    if (info->pool)
+    {
+        CloseThreadpoolCleanupGroup( info->group );
+        CloseThreadpool( info->pool );
+    }
+    for (i = 0; i < info->modules_count; i++) FreeLibrary( info->modules[i] );
+    free( info->modules );
+}
+
+
 /***********************************************************************
  *            register_dlls_callback
  *
@@ -730,12 +879,19 @@ static BOOL register_dlls_callback( HINF hinf, PCWSTR field, void *arg )
         if (SetupGetStringFieldW( &context, 6, buffer, ARRAY_SIZE( buffer ), NULL ))
             args = buffer;
 
-        ret = do_register_dll( info, path, flags, timeout, args );
+        if (!info->callback && (flags & FLG_REGSVR_WINE_CONCURRENT))
+            ret = queue_register_dll( info, path, flags, timeout, args );
+        else
+        {
+            flush_register_dlls( info );
+            ret = do_register_dll( info, path, flags, timeout, args );
+        }
 
     done:
         free( path );
         if (!ret) break;
     }
+    flush_register_dlls( info );
     return ret;
 }
 
@@ -1109,7 +1265,6 @@ BOOL WINAPI SetupInstallFromInfSectionW( HWND owner, HINF hinf, PCWSTR section,
                                          HDEVINFO devinfo, PSP_DEVINFO_DATA devinfo_data )
 {
     BOOL ret;
-    int i;
 
     if (flags & SPINST_REGSVR)
     {
@@ -1159,12 +1314,11 @@ BOOL WINAPI SetupInstallFromInfSectionW( HWND owner, HINF hinf, PCWSTR section,
         hr = CoInitialize(NULL);
 
         ret = iterate_section_fields( hinf, section, L"RegisterDlls", register_dlls_callback, &info );
-        for (i = 0; i < info.modules_count; i++) FreeLibrary( info.modules[i] );
+        free_register_dll_info( &info );
 
         if (SUCCEEDED(hr))
             CoUninitialize();
 
-        free( info.modules );
         if (!ret) return FALSE;
     }
     if (flags & SPINST_UNREGSVR)
@@ -1181,12 +1335,11 @@ BOOL WINAPI SetupInstallFromInfSectionW( HWND owner, HINF hinf, PCWSTR section,
         hr = CoInitialize(NULL);
 
         ret = iterate_section_fields( hinf, section, L"UnregisterDlls", register_dlls_callback, &info );
-        for (i = 0; i < info.modules_count; i++) FreeLibrary( info.modules[i] );
+        free_register_dll_info( &info );
 
         if (SUCCEEDED(hr))
             CoUninitialize();
 
-        free( info.modules );
         if (!ret) return FALSE;
     }
     if (flags & SPINST_REGISTRY)
@@ -2142,7 +2142,13 @@ static void test_register_dlls(void)
             "RegisterDlls=register_section\n"
             "UnregisterDlls=register_section\n"
             "[register_section]\n"
-            "40000,,winetest_selfreg.dll,1\n";
+            "40000,,winetest_selfreg.dll,1\n"
+            "[ConcurrentInstall]\n"
+            "RegisterDlls=concurrent_section\n"
+            "UnregisterDlls=concurrent_section\n"
+            "[concurrent_section]\n"
+            "40000,,winetest_selfreg.dll,0x10001\n"
+            "40000,,winetest_selfreg.dll,0x10001\n";
 
     void *context = SetupInitDefaultQueueCallbackEx(NULL, INVALID_HANDLE_VALUE, 0, 0, 0);
     char path[MAX_PATH];
@@ -2198,6 +2204,22 @@ static void test_register_dlls(void)
 
     CoUninitialize();
 
+    /* 0x10000 is a Wine extension allowing concurrent registration, native ignores it */
+    ret = SetupInstallFromInfSectionA(NULL, hinf, "ConcurrentInstall", SPINST_REGSVR,
+            NULL, "C:\\", 0, SetupDefaultQueueCallbackA, context, NULL, NULL);
+    ok(ret, "Failed to install, error %#lx.\n", GetLastError());
+
+    l = RegOpenKeyA(HKEY_CURRENT_USER, "winetest_setupapi_selfreg", &key);
+    ok(!l, "Got error %lu.\n", l);
+    RegCloseKey(key);
+
+    ret = SetupInstallFromInfSectionA(NULL, hinf, "ConcurrentInstall", SPINST_UNREGSVR,
+            NULL, "C:\\", 0, SetupDefaultQueueCallbackA, context, NULL, NULL);
+    ok(ret, "Failed to install, error %#lx.\n", GetLastError());
+
+    l = RegOpenKeyA(HKEY_CURRENT_USER, "winetest_setupapi_selfreg", &key);
+    ok(l == ERROR_FILE_NOT_FOUND, "Got error %lu.\n", l);
+
     SetupCloseInfFile(hinf);
     ret = DeleteFileA("test.inf");
     ok(ret, "Failed to delete INF file, error %lu.\n", GetLastError());
@@ -17923,6 +17923,12 @@ static void test_clipboard_viewers(void)
     SetClipboardViewer(hOrigViewer);
 }
 
+static DWORD CALLBACK post_thread_message_thread( void *arg )
+{
+    PostThreadMessageA( PtrToUlong(arg), WM_USER+2, 0, 0 );
+    return 0;
+}
+
 static void test_PostMessage(void)
 {
     static const struct
@@ -17939,6 +17945,8 @@ static void test_PostMessage(void)
         { HWND_MESSAGE, FALSE },
         { (HWND)0xdeadbeef, FALSE }
     };
+    HANDLE thread, event;
+    DWORD status;
     int i;
     HWND hwnd;
     BOOL ret;
@@ -17979,7 +17987,60 @@ static void test_PostMessage(void)
         }
     }
 
+    while (PeekMessageA(&msg, 0, WM_USER+1, WM_USER+3, PM_REMOVE)) /* nothing */;
+
+    /* messages posted by other threads are interleaved with our own in order */
+    GetQueueStatus(QS_ALLINPUT);
+    PostMessageA(hwnd, WM_USER+1, 1, 0);
+    status = GetQueueStatus(QS_POSTMESSAGE);
+    ok(status == MAKELONG(QS_POSTMESSAGE, QS_POSTMESSAGE), "got status %#lx\n", status);
+    status = GetQueueStatus(QS_POSTMESSAGE);
+    ok(status == MAKELONG(0, QS_POSTMESSAGE), "got status %#lx\n", status);
+    thread = CreateThread(NULL, 0, post_thread_message_thread, ULongToPtr(GetCurrentThreadId()), 0, NULL);
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+    PostMessageA(hwnd, WM_USER+3, 3, 0);
+    PostMessageA(hwnd, WM_USER+1, 4, 0);
+
+    ret = PeekMessageA(&msg, hwnd, WM_USER+3, WM_USER+3, PM_NOREMOVE);
+    ok(ret && msg.message == WM_USER+3 && msg.wParam == 3, "got ret %d msg %04x wParam %Ix\n",
+       ret, msg.message, msg.wParam);
+    ret = PeekMessageA(&msg, 0, WM_USER+1, WM_USER+3, PM_REMOVE);
+    ok(ret && msg.message == WM_USER+1 && msg.wParam == 1, "got ret %d msg %04x wParam %Ix\n",
+       ret, msg.message, msg.wParam);
+    ret = PeekMessageA(&msg, 0, WM_USER+1, WM_USER+3, PM_REMOVE);
+    ok(ret && msg.message == WM_USER+2 && !msg.hwnd, "got ret %d msg %04x hwnd %p\n",
+       ret, msg.message, msg.hwnd);
+    ret = PeekMessageA(&msg, 0, WM_USER+1, WM_USER+3, PM_REMOVE);
+    ok(ret && msg.message == WM_USER+3 && msg.wParam == 3, "got ret %d msg %04x wParam %Ix\n",
+       ret, msg.message, msg.wParam);
+    ret = PeekMessageA(&msg, 0, WM_USER+1, WM_USER+3, PM_REMOVE);
+    ok(ret && msg.message == WM_USER+1 && msg.wParam == 4, "got ret %d msg %04x wParam %Ix\n",
+       ret, msg.message, msg.wParam);
+    ret = PeekMessageA(&msg, 0, WM_USER+1, WM_USER+3, PM_REMOVE);
+    ok(!ret, "got message %04x\n", msg.message);
+
+    /* signaled handles and pending messages are still preferred over APCs */
+    event = CreateEventA(NULL, FALSE, TRUE, NULL);
+    PostMessageA(hwnd, WM_USER+1, 6, 0);
+    ret = QueueUserAPC(apc_test_proc, GetCurrentThread(), 0);
+    ok(ret, "QueueUserAPC failed %lu\n", GetLastError());
+    status = MsgWaitForMultipleObjectsEx(1, &event, 0, QS_POSTMESSAGE, MWMO_ALERTABLE);
+    ok(status == WAIT_OBJECT_0, "MsgWaitForMultipleObjectsEx returned %lx\n", status);
+    status = MsgWaitForMultipleObjectsEx(1, &event, 0, QS_POSTMESSAGE, MWMO_ALERTABLE);
+    ok(status == WAIT_OBJECT_0 + 1, "MsgWaitForMultipleObjectsEx returned %lx\n", status);
+    ret = PeekMessageA(&msg, 0, WM_USER+1, WM_USER+3, PM_REMOVE);
+    ok(ret && msg.message == WM_USER+1 && msg.wParam == 6, "got ret %d msg %04x wParam %Ix\n",
+       ret, msg.message, msg.wParam);
+    status = MsgWaitForMultipleObjectsEx(1, &event, 0, QS_POSTMESSAGE, MWMO_ALERTABLE);
+    ok(status == WAIT_IO_COMPLETION, "MsgWaitForMultipleObjectsEx returned %lx\n", status);
+    CloseHandle(event);
+
+    /* messages for destroyed windows are discarded */
+    PostMessageA(hwnd, WM_USER+1, 5, 0);
     DestroyWindow(hwnd);
+    ret = PeekMessageA(&msg, 0, WM_USER+1, WM_USER+3, PM_REMOVE);
+    ok(!ret, "got message %04x\n", msg.message);
     flush_events();
 }
 
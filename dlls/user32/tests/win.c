@@ -11252,10 +11252,93 @@ static void test_winproc_limit(void)
     ok(i == 1, "winproc should be called once (%d)\n", i);
 }
 
+static WNDPROC deferwindowpos_old_proc;
+static HWND deferwindowpos_order[8];
+static LONG deferwindowpos_count;
+
+static LRESULT WINAPI deferwindowpos_proc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
+{
+    LONG i;
+
+    if (msg == WM_WINDOWPOSCHANGING && (i = InterlockedIncrement(&deferwindowpos_count)) <= ARRAY_SIZE(deferwindowpos_order))
+        deferwindowpos_order[i - 1] = hwnd;
+    return CallWindowProcA(deferwindowpos_old_proc, hwnd, msg, wparam, lparam);
+}
+
+struct deferwindowpos_thread_params
+{
+    HWND parent;
+    HWND child;
+    HANDLE ready;
+};
+
+static DWORD CALLBACK deferwindowpos_thread(void *arg)
+{
+    struct deferwindowpos_thread_params *params = arg;
+    MSG msg;
+
+    params->child = CreateWindowExA(WS_EX_NOPARENTNOTIFY, "static", NULL, WS_CHILD | WS_VISIBLE,
+                                    0, 0, 10, 10, params->parent, 0, 0, NULL);
+    ok(params->child != NULL, "CreateWindow failed, error %ld\n", GetLastError());
+    SetWindowLongPtrA(params->child, GWLP_WNDPROC, (LONG_PTR)deferwindowpos_proc);
+    SetEvent(params->ready);
+
+    while (GetMessageA(&msg, 0, 0, 0)) DispatchMessageA(&msg);
+    DestroyWindow(params->child);
+    return 0;
+}
+
+static void test_deferwindowpos_order(void)
+{
+    struct deferwindowpos_thread_params params;
+    HWND children[3];
+    HANDLE thread;
+    DWORD tid;
+    HDWP hdwp;
+    LONG i;
+
+    params.parent = CreateWindowA("static", NULL, WS_POPUP | WS_VISIBLE, 0, 0, 200, 200, 0, 0, 0, NULL);
+    ok(params.parent != NULL, "CreateWindow failed, error %ld\n", GetLastError());
+    params.ready = CreateEventA(NULL, FALSE, FALSE, NULL);
+
+    children[0] = CreateWindowExA(WS_EX_NOPARENTNOTIFY, "static", NULL, WS_CHILD | WS_VISIBLE,
+                                  0, 0, 10, 10, params.parent, 0, 0, NULL);
+    children[2] = CreateWindowExA(WS_EX_NOPARENTNOTIFY, "static", NULL, WS_CHILD | WS_VISIBLE,
+                                  0, 0, 10, 10, params.parent, 0, 0, NULL);
+    deferwindowpos_old_proc = (WNDPROC)SetWindowLongPtrA(children[0], GWLP_WNDPROC, (LONG_PTR)deferwindowpos_proc);
+    SetWindowLongPtrA(children[2], GWLP_WNDPROC, (LONG_PTR)deferwindowpos_proc);
+
+    thread = CreateThread(NULL, 0, deferwindowpos_thread, &params, 0, &tid);
+    wait_for_events(1, &params.ready, 5000);
+    children[1] = params.child;
+
+    /* the window of the other thread is moved between the windows of the current thread */
+    deferwindowpos_count = 0;
+    hdwp = BeginDeferWindowPos(ARRAY_SIZE(children));
+    for (i = 0; i < ARRAY_SIZE(children); i++)
+        hdwp = DeferWindowPos(hdwp, children[i], NULL, i * 20, 0, 15, 15, SWP_NOZORDER | SWP_NOACTIVATE);
+    ok(EndDeferWindowPos(hdwp), "EndDeferWindowPos failed, error %ld\n", GetLastError());
+
+    ok(deferwindowpos_count == ARRAY_SIZE(children), "got %ld WM_WINDOWPOSCHANGING\n", deferwindowpos_count);
+    for (i = 0; i < min(deferwindowpos_count, ARRAY_SIZE(children)); i++)
+        ok(deferwindowpos_order[i] == children[i], "%ld: got %p, expected %p\n",
+           i, deferwindowpos_order[i], children[i]);
+
+    PostThreadMessageA(tid, WM_QUIT, 0, 0);
+    wait_for_events(1, &thread, 5000);
+    CloseHandle(thread);
+    CloseHandle(params.ready);
+    DestroyWindow(params.parent);
+}
+
 static void test_deferwindowpos(void)
 {
+    HWND hwnd, children[500];
     HDWP hdwp, hdwp2;
-    HWND hwnd;
+    unsigned int i;
+    DWORD start;
+    POINT pt;
+    RECT rect;
     BOOL ret;
 
     hdwp = BeginDeferWindowPos(0);
@@ -11295,6 +11378,62 @@ static void test_deferwindowpos(void)
 
     ret = EndDeferWindowPos(hdwp);
     ok(ret, "got %d\n", ret);
+
+    /* move many child windows at once */
+    hwnd = CreateWindowA("static", NULL, WS_POPUP | WS_VISIBLE, 0, 0, 520, 420, 0, 0, 0, NULL);
+    ok(hwnd != NULL, "CreateWindow failed, error %ld\n", GetLastError());
+    for (i = 0; i < ARRAY_SIZE(children); i++)
+    {
+        children[i] = CreateWindowA("static", NULL, WS_CHILD | WS_VISIBLE, 0, 0, 10, 10, hwnd, 0, 0, NULL);
+        ok(children[i] != NULL, "CreateWindow failed, error %ld\n", GetLastError());
+    }
+
+    start = GetTickCount();
+    for (i = 0; i < ARRAY_SIZE(children); i++)
+        SetWindowPos(children[i], NULL, (i % 25) * 10, (i / 25) * 10, 15, 15, SWP_NOZORDER | SWP_NOACTIVATE);
+    trace("SetWindowPos took %lu ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    hdwp = BeginDeferWindowPos(ARRAY_SIZE(children));
+    ok(hdwp != NULL, "got %p\n", hdwp);
+    for (i = 0; i < ARRAY_SIZE(children); i++)
+    {
+        hdwp = DeferWindowPos(hdwp, children[i], NULL, (i % 25) * 20, (i / 25) * 20, 15, 15,
+                              SWP_NOZORDER | SWP_NOACTIVATE);
+        ok(hdwp != NULL, "got %p, error %ld\n", hdwp, GetLastError());
+    }
+    ret = EndDeferWindowPos(hdwp);
+    ok(ret, "got %d\n", ret);
+    trace("DeferWindowPos took %lu ms\n", GetTickCount() - start);
+
+    for (i = 0; i < ARRAY_SIZE(children); i++)
+    {
+        GetWindowRect(children[i], &rect);
+        MapWindowPoints(0, hwnd, (POINT *)&rect, 2);
+        ok(rect.left == (i % 25) * 20 && rect.top == (i / 25) * 20 &&
+           rect.right == rect.left + 15 && rect.bottom == rect.top + 15,
+           "%u: got %s\n", i, wine_dbgstr_rect(&rect));
+    }
+
+    /* a child moved together with its parent follows the new parent position */
+    hdwp = BeginDeferWindowPos(2);
+    ok(hdwp != NULL, "got %p\n", hdwp);
+    hdwp = DeferWindowPos(hdwp, hwnd, NULL, 50, 60, 520, 420, SWP_NOZORDER | SWP_NOACTIVATE);
+    ok(hdwp != NULL, "got %p, error %ld\n", hdwp, GetLastError());
+    hdwp = DeferWindowPos(hdwp, children[0], NULL, 5, 5, 15, 15, SWP_NOZORDER | SWP_NOACTIVATE);
+    ok(hdwp != NULL, "got %p, error %ld\n", hdwp, GetLastError());
+    ret = EndDeferWindowPos(hdwp);
+    ok(ret, "got %d\n", ret);
+
+    pt.x = pt.y = 0;
+    ClientToScreen(hwnd, &pt);
+    ok(pt.x == 50 && pt.y == 60, "got %ld,%ld\n", pt.x, pt.y);
+    GetWindowRect(children[0], &rect);
+    ok(rect.left == pt.x + 5 && rect.top == pt.y + 5 && rect.right == rect.left + 15 &&
+       rect.bottom == rect.top + 15, "got %s\n", wine_dbgstr_rect(&rect));
+    DestroyWindow(hwnd);
+
+    test_deferwindowpos_order();
 }
 
 static void test_LockWindowUpdate(HWND parent)
@@ -12794,6 +12933,121 @@ static void test_SC_SIZE(void)
     DestroyWindow(hwnd);
 }
 
+static void other_process_window_info_proc(HWND hwnd, HWND parent)
+{
+    HANDLE window_ready_event, test_done_event;
+    LARGE_INTEGER frequency, start, end;
+    DWORD ret, pid, tid;
+    unsigned int i;
+    RECT rect;
+
+    window_ready_event = OpenEventA(EVENT_ALL_ACCESS, FALSE, "test_opwi_window");
+    ok(!!window_ready_event, "OpenEvent failed.\n");
+    test_done_event = OpenEventA(EVENT_ALL_ACCESS, FALSE, "test_opwi_test");
+    ok(!!test_done_event, "OpenEvent failed.\n");
+
+    ret = WaitForSingleObject(window_ready_event, 5000);
+    ok(ret == WAIT_OBJECT_0, "Unexpected ret %lx.\n", ret);
+    ok(IsWindow(hwnd), "IsWindow failed.\n");
+    tid = GetWindowThreadProcessId(hwnd, &pid);
+    ok(tid && tid != GetCurrentThreadId(), "Unexpected tid %#lx.\n", tid);
+    ok(pid && pid != GetCurrentProcessId(), "Unexpected pid %#lx.\n", pid);
+    ok(GetParent(hwnd) == parent, "Unexpected parent %p.\n", GetParent(hwnd));
+    ret = GetWindowLongA(hwnd, GWL_STYLE);
+    ok((ret & (WS_CHILD | WS_DISABLED)) == WS_CHILD, "Unexpected style %#lx.\n", ret);
+    ret = GetWindowLongA(hwnd, GWL_EXSTYLE);
+    ok(ret & WS_EX_TRANSPARENT, "Unexpected exstyle %#lx.\n", ret);
+    ret = GetWindowLongPtrA(hwnd, GWLP_ID);
+    ok(ret == 0x1234, "Unexpected id %#lx.\n", ret);
+    ret = GetWindowLongPtrA(hwnd, GWLP_USERDATA);
+    ok(ret == 0xdeadbeef, "Unexpected user data %#lx.\n", ret);
+    GetWindowRect(hwnd, &rect);
+    ok(rect.right - rect.left == 50 && rect.bottom - rect.top == 50, "Unexpected rect %s.\n", wine_dbgstr_rect(&rect));
+
+    /* window longs are read from the shared window table, rects still come from the server */
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&start);
+    for (i = 0; i < 10000; ++i) GetWindowLongA(hwnd, GWL_STYLE);
+    QueryPerformanceCounter(&end);
+    trace("GetWindowLong: %.0f calls/s.\n", i * (double)frequency.QuadPart / (end.QuadPart - start.QuadPart));
+    QueryPerformanceCounter(&start);
+    for (i = 0; i < 10000; ++i) GetWindowRect(hwnd, &rect);
+    QueryPerformanceCounter(&end);
+    trace("GetWindowRect: %.0f calls/s.\n", i * (double)frequency.QuadPart / (end.QuadPart - start.QuadPart));
+    SetEvent(test_done_event);
+
+    /* changes made by the owner are visible right away */
+    ret = WaitForSingleObject(window_ready_event, 5000);
+    ok(ret == WAIT_OBJECT_0, "Unexpected ret %lx.\n", ret);
+    ret = GetWindowLongA(hwnd, GWL_STYLE);
+    ok(ret & WS_DISABLED, "Unexpected style %#lx.\n", ret);
+    ret = GetWindowLongPtrA(hwnd, GWLP_USERDATA);
+    ok(ret == 0xfeedf00d, "Unexpected user data %#lx.\n", ret);
+    ok(GetParent(hwnd) == GetDesktopWindow() || !GetParent(hwnd), "Unexpected parent %p.\n", GetParent(hwnd));
+    SetEvent(test_done_event);
+
+    ret = WaitForSingleObject(window_ready_event, 5000);
+    ok(ret == WAIT_OBJECT_0, "Unexpected ret %lx.\n", ret);
+    ok(!IsWindow(hwnd), "Window still exists.\n");
+    tid = GetWindowThreadProcessId(hwnd, &pid);
+    ok(!tid, "Unexpected tid %#lx.\n", tid);
+    SetEvent(test_done_event);
+
+    CloseHandle(window_ready_event);
+    CloseHandle(test_done_event);
+}
+
+static void test_other_process_window_info(const char *argv0)
+{
+    HANDLE window_ready_event, test_done_event;
+    PROCESS_INFORMATION info;
+    STARTUPINFOA startup;
+    char cmd[MAX_PATH];
+    HWND parent, hwnd;
+    DWORD ret;
+
+    parent = CreateWindowExA(0, "static", NULL, WS_POPUP, 100, 100, 100, 100, 0, 0, NULL, NULL);
+    ok(!!parent, "CreateWindowEx failed.\n");
+    hwnd = CreateWindowExA(WS_EX_TRANSPARENT, "static", NULL, WS_CHILD, 0, 0, 50, 50,
+            parent, (HMENU)0x1234, NULL, NULL);
+    ok(!!hwnd, "CreateWindowEx failed.\n");
+    SetWindowLongPtrA(hwnd, GWLP_USERDATA, 0xdeadbeef);
+
+    window_ready_event = CreateEventA(NULL, FALSE, FALSE, "test_opwi_window");
+    ok(!!window_ready_event, "CreateEvent failed.\n");
+    test_done_event = CreateEventA(NULL, FALSE, FALSE, "test_opwi_test");
+    ok(!!test_done_event, "CreateEvent failed.\n");
+
+    sprintf(cmd, "%s win test_other_process_window_info %p %p", argv0, hwnd, parent);
+    memset(&startup, 0, sizeof(startup));
+    startup.cb = sizeof(startup);
+    ok(CreateProcessA(NULL, cmd, NULL, NULL, FALSE, 0, NULL, NULL,
+            &startup, &info), "CreateProcess failed.\n");
+
+    SetEvent(window_ready_event);
+    ret = WaitForSingleObject(test_done_event, 5000);
+    ok(ret == WAIT_OBJECT_0, "Unexpected ret %lx.\n", ret);
+
+    SetWindowLongA(hwnd, GWL_STYLE, GetWindowLongA(hwnd, GWL_STYLE) | WS_DISABLED);
+    SetWindowLongPtrA(hwnd, GWLP_USERDATA, 0xfeedf00d);
+    SetParent(hwnd, NULL);
+    SetEvent(window_ready_event);
+    ret = WaitForSingleObject(test_done_event, 5000);
+    ok(ret == WAIT_OBJECT_0, "Unexpected ret %lx.\n", ret);
+
+    DestroyWindow(hwnd);
+    SetEvent(window_ready_event);
+    ret = WaitForSingleObject(test_done_event, 5000);
+    ok(ret == WAIT_OBJECT_0, "Unexpected ret %lx.\n", ret);
+
+    wait_child_process(info.hProcess);
+    CloseHandle(info.hProcess);
+    CloseHandle(info.hThread);
+    CloseHandle(window_ready_event);
+    CloseHandle(test_done_event);
+    DestroyWindow(parent);
+}
+
 static void test_other_process_window(const char *argv0)
 {
     HANDLE window_ready_event, test_done_event;
@@ -13177,6 +13431,16 @@ START_TEST(win)
         }
     }
 
+    if (argc == 5 && !strcmp(argv[2], "test_other_process_window_info"))
+    {
+        HWND hwnd, parent;
+
+        sscanf(argv[3], "%p", &hwnd);
+        sscanf(argv[4], "%p", &parent);
+        other_process_window_info_proc(hwnd, parent);
+        return;
+    }
+
     if (argc == 3 && !strcmp(argv[2], "winproc_limit"))
     {
         test_winproc_limit();
@@ -13313,6 +13577,7 @@ START_TEST(win)
     test_window_placement();
     test_arrange_iconic_windows();
     test_other_process_window(argv[0]);
+    test_other_process_window_info(argv[0]);
     test_SC_SIZE();
     test_cancel_mode();
     test_DragDetect();
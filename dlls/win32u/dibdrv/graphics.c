@@ -24,6 +24,7 @@
 
 #include <assert.h>
 #include <pthread.h>
+#include <stdlib.h>
 #include "ntgdi_private.h"
 #include "dibdrv.h"
 
@@ -62,6 +63,52 @@ static struct list font_cache = LIST_INIT( font_cache );
 
 static pthread_mutex_t font_cache_lock = PTHREAD_MUTEX_INITIALIZER;
 
+/* Shared glyph cache
+ *
+ * When WINE_SHARED_GLYPH_CACHE is set, glyph bitmaps are also stored in a
+ * named section shared by all the processes, indexed by a hash table keyed
+ * on the font id and the glyph. Entries are published without locking, and
+ * never removed; once the data area is full, glyphs are cached per process
+ * only. The zero-filled section is a valid empty cache. Since any process can
+ * write to the section, glyphs are validated and copied out on lookup.
+ */
+
+#define SHARED_GLYPH_SLOTS     0x10000
+#define SHARED_GLYPH_PROBES    32
+#define SHARED_GLYPH_DATA_SIZE (32 * 1024 * 1024)
+
+enum shared_glyph_state
+{
+    SHARED_GLYPH_FREE,
+    SHARED_GLYPH_BUSY,
+    SHARED_GLYPH_READY,
+    SHARED_GLYPH_DEAD,
+};
+
+struct shared_glyph_slot
+{
+    LONG   state;
+    UINT   index;       /* glyph index or character, and glyph type */
+    UINT64 font_id;
+    UINT   offset;      /* offset of the glyph in the data area */
+    UINT   size;
+};
+
+struct shared_glyph_cache
+{
+    LONG                     data_used;
+    LONG                     hits;
+    LONG                     misses;
+    LONG                     inserts;
+    LONG                     full;
+    LONG                     reserved[11];
+    struct shared_glyph_slot slots[SHARED_GLYPH_SLOTS];
+    BYTE                     data[SHARED_GLYPH_DATA_SIZE];
+};
+
+static struct shared_glyph_cache *shared_glyphs;
+static pthread_once_t shared_glyphs_once = PTHREAD_ONCE_INIT;
+
 
 static BOOL brush_rect( dibdrv_physdev *pdev, dib_brush *brush, const RECT *rect, HRGN clip )
 {
@@ -551,6 +598,142 @@ static int font_cache_cmp( const struct cached_font *p1, const struct cached_fon
     return ret;
 }
 
+static void init_shared_glyph_cache(void)
+{
+    static const WCHAR nameW[] =
+        {'\\','B','a','s','e','N','a','m','e','d','O','b','j','e','c','t','s','\\',
+         '_','_','w','i','n','e','_','g','l','y','p','h','_','c','a','c','h','e'};
+    const char *env = getenv( "WINE_SHARED_GLYPH_CACHE" );
+    OBJECT_ATTRIBUTES attr;
+    UNICODE_STRING name;
+    LARGE_INTEGER size;
+    SIZE_T view_size = 0;
+    HANDLE handle;
+    void *ptr = NULL;
+
+    if (!env || !atoi( env )) return;
+
+    name.Buffer = (WCHAR *)nameW;
+    name.Length = name.MaximumLength = sizeof(nameW);
+    InitializeObjectAttributes( &attr, &name, OBJ_OPENIF, 0, NULL );
+    size.QuadPart = sizeof(*shared_glyphs);
+    if (NtCreateSection( &handle, SECTION_MAP_READ | SECTION_MAP_WRITE | SECTION_QUERY, &attr,
+                         &size, PAGE_READWRITE, SEC_COMMIT, 0 ) < 0)
+        return;
+    if (!NtMapViewOfSection( handle, GetCurrentProcess(), &ptr, 0, 0, NULL, &view_size,
+                             ViewShare, 0, PAGE_READWRITE ))
+    {
+        if (view_size >= sizeof(*shared_glyphs)) shared_glyphs = ptr;
+        else NtUnmapViewOfSection( GetCurrentProcess(), ptr );
+    }
+    NtClose( handle );
+    TRACE( "shared glyph cache %p\n", shared_glyphs );
+}
+
+static inline UINT shared_glyph_hash( UINT64 font_id, UINT index )
+{
+    return ((UINT)font_id ^ (UINT)(font_id >> 32) ^ (index * 0x9e3779b1)) % SHARED_GLYPH_SLOTS;
+}
+
+static struct cached_glyph *copy_shared_glyph( const struct shared_glyph_slot *slot, int bit_count )
+{
+    UINT offset = ReadNoFence( (LONG *)&slot->offset ), size = ReadNoFence( (LONG *)&slot->size );
+    const struct cached_glyph *src;
+    struct cached_glyph *glyph;
+    GLYPHMETRICS metrics;
+    UINT bits_size;
+
+    if (size < FIELD_OFFSET( struct cached_glyph, bits ) || size > SHARED_GLYPH_DATA_SIZE ||
+        offset > SHARED_GLYPH_DATA_SIZE - size)
+        return NULL;
+
+    src = (const struct cached_glyph *)(shared_glyphs->data + offset);
+    memcpy( &metrics, &src->metrics, sizeof(metrics) );
+    if (metrics.gmBlackBoxX > 0x10000 || metrics.gmBlackBoxY > 0x10000) return NULL;
+    bits_size = metrics.gmBlackBoxY * get_dib_stride( metrics.gmBlackBoxX, bit_count );
+    if (bits_size > size - FIELD_OFFSET( struct cached_glyph, bits )) return NULL;
+
+    if (!(glyph = malloc( FIELD_OFFSET( struct cached_glyph, bits[bits_size] )))) return NULL;
+    glyph->metrics = metrics;
+    memcpy( glyph->bits, src->bits, bits_size );
+    return glyph;
+}
+
+static struct cached_glyph *get_shared_glyph( UINT64 font_id, UINT index, int bit_count )
+{
+    struct shared_glyph_slot *slot;
+    UINT i, pos = shared_glyph_hash( font_id, index );
+    struct cached_glyph *glyph;
+    LONG hits, misses;
+
+    for (i = 0; i < SHARED_GLYPH_PROBES; i++, pos = (pos + 1) % SHARED_GLYPH_SLOTS)
+    {
+        slot = &shared_glyphs->slots[pos];
+        switch (ReadAcquire( &slot->state ))
+        {
+        case SHARED_GLYPH_FREE:
+            i = SHARED_GLYPH_PROBES;
+            break;
+        case SHARED_GLYPH_READY:
+            if (slot->font_id != font_id || slot->index != index) break;
+            if (!(glyph = copy_shared_glyph( slot, bit_count )))
+            {
+                WARN( "invalid shared glyph entry %u\n", pos );
+                i = SHARED_GLYPH_PROBES;
+                break;
+            }
+            hits = InterlockedIncrement( &shared_glyphs->hits );
+            if (!(hits % 4096))
+            {
+                misses = ReadNoFence( &shared_glyphs->misses );
+                TRACE( "%d hits, %d misses (%u%%), %d inserts, %d bytes used\n", (int)hits, (int)misses,
+                       (UINT)((UINT64)hits * 100 / (hits + misses)), (int)ReadNoFence( &shared_glyphs->inserts ),
+                       (int)ReadNoFence( &shared_glyphs->data_used ));
+            }
+            return glyph;
+        }
+    }
+    InterlockedIncrement( &shared_glyphs->misses );
+    return NULL;
+}
+
+static void add_shared_glyph( UINT64 font_id, UINT index, const struct cached_glyph *glyph, UINT size )
+{
+    struct shared_glyph_slot *slot;
+    UINT i, offset, alloc_size = (size + 15) & ~15, pos = shared_glyph_hash( font_id, index );
+
+    if (ReadNoFence( &shared_glyphs->data_used ) > SHARED_GLYPH_DATA_SIZE - alloc_size) return;
+
+    for (i = 0; i < SHARED_GLYPH_PROBES; i++, pos = (pos + 1) % SHARED_GLYPH_SLOTS)
+    {
+        slot = &shared_glyphs->slots[pos];
+        if (InterlockedCompareExchange( &slot->state, SHARED_GLYPH_BUSY, SHARED_GLYPH_FREE ) != SHARED_GLYPH_FREE)
+        {
+            if (ReadAcquire( &slot->state ) == SHARED_GLYPH_READY &&
+                slot->font_id == font_id && slot->index == index)
+                return;
+            continue;
+        }
+
+        offset = InterlockedExchangeAdd( &shared_glyphs->data_used, alloc_size );
+        if (offset > SHARED_GLYPH_DATA_SIZE - alloc_size)
+        {
+            InterlockedIncrement( &shared_glyphs->full );
+            WriteRelease( &slot->state, SHARED_GLYPH_DEAD );
+            return;
+        }
+
+        memcpy( shared_glyphs->data + offset, glyph, size );
+        slot->font_id = font_id;
+        slot->index = index;
+        slot->offset = offset;
+        slot->size = size;
+        WriteRelease( &slot->state, SHARED_GLYPH_READY );
+        InterlockedIncrement( &shared_glyphs->inserts );
+        return;
+    }
+}
+
 static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
 {
     struct cached_font font, *ptr, *last_unused = NULL;
@@ -753,6 +936,13 @@ static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font
     int pad = 0, stride, bit_count;
     GLYPHMETRICS metrics;
     struct cached_glyph *glyph;
+    UINT shared_index = index | (font->aa_flags << 16) | ((flags & ETO_GLYPH_INDEX) ? 0x80000000 : 0);
+    UINT64 font_id = 0;
+
+    pthread_once( &shared_glyphs_once, init_shared_glyph_cache );
+    if (shared_glyphs && (font_id = get_gdi_font_id( dc )) &&
+        (glyph = get_shared_glyph( font_id, shared_index, get_glyph_depth( font->aa_flags ))))
+        return add_cached_glyph( font, index, flags, glyph );
 
     if (flags & ETO_GLYPH_INDEX) ggo_flags |= GGO_GLYPH_INDEX;
     indices[0] = index;
@@ -804,6 +994,7 @@ static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font
 
 done:
     glyph->metrics = metrics;
+    if (font_id) add_shared_glyph( font_id, shared_index, glyph, FIELD_OFFSET( struct cached_glyph, bits[size] ));
     return add_cached_glyph( font, index, flags, glyph );
 }
 
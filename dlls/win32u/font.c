@@ -1416,6 +1416,381 @@ static void remove_face_from_cache( struct gdi_font_face *face )
     NtClose( hkey_family );
 }
 
+/* font catalog
+ *
+ * Parsing every font file found in the font directories is slow, so the
+ * resulting face list is saved to system32\fntcache.dat, and mapped by the
+ * following processes instead. The catalog stores the last write time of
+ * every scanned directory, and is rebuilt as soon as one of them changes.
+ */
+
+#define FONT_CATALOG_MAGIC   0x54414346  /* "FCAT" */
+#define FONT_CATALOG_VERSION 1
+
+struct font_catalog_header
+{
+    DWORD magic;
+    DWORD version;
+    DWORD size;         /* total size of the catalog */
+    DWORD dpi;
+    DWORD ansi_cp;
+    DWORD oem_cp;
+    DWORD lcid;
+    DWORD dir_count;
+    DWORD face_count;
+    DWORD reserved;
+};
+
+struct font_catalog_dir
+{
+    DWORD         record_size;
+    DWORD         reserved;
+    LARGE_INTEGER write_time;   /* 0 if the directory doesn't exist */
+    WCHAR         path[1];
+};
+
+struct font_catalog_face
+{
+    DWORD                   record_size;
+    DWORD                   index;
+    DWORD                   flags;
+    DWORD                   ntmflags;
+    DWORD                   weight;
+    DWORD                   version;
+    DWORD                   scalable;
+    struct bitmap_font_size size;
+    FONTSIGNATURE           fs;
+    WCHAR                   names[1];
+    /* family name, second name, style name, full name and file name, all null-terminated */
+};
+
+#define FONT_CATALOG_FACE_NAMES 5
+
+/* \SystemRoot is resolved by ntdll to the configured Windows directory */
+static void get_font_catalog_path( WCHAR *path )
+{
+    asciiz_to_unicode( path, "\\SystemRoot\\system32\\fntcache.dat" );
+}
+
+static WCHAR **catalog_dirs;
+static UINT catalog_dir_count, catalog_dir_max;
+
+static inline DWORD catalog_record_size( DWORD size )
+{
+    return (size + 7) & ~7;
+}
+
+static void catalog_add_dir( const WCHAR *path, UINT len )
+{
+    WCHAR *dir;
+    UINT i;
+
+    for (i = 0; i < catalog_dir_count; i++)
+        if (!wcsnicmp( catalog_dirs[i], path, len ) && !catalog_dirs[i][len]) return;
+
+    if (catalog_dir_count == catalog_dir_max)
+    {
+        UINT new_max = max( 16, catalog_dir_max * 2 );
+        WCHAR **new_dirs = realloc( catalog_dirs, new_max * sizeof(*new_dirs) );
+
+        if (!new_dirs) return;
+        catalog_dirs = new_dirs;
+        catalog_dir_max = new_max;
+    }
+
+    if (!(dir = malloc( (len + 1) * sizeof(WCHAR) ))) return;
+    memcpy( dir, path, len * sizeof(WCHAR) );
+    dir[len] = 0;
+    catalog_dirs[catalog_dir_count++] = dir;
+}
+
+/* directories scanned by the font backend */
+void add_font_catalog_dir( const WCHAR *path )
+{
+    UINT len = lstrlenW( path );
+
+    while (len && path[len - 1] == '\\') len--;
+    catalog_add_dir( path, len );
+}
+
+static void catalog_free_dirs(void)
+{
+    UINT i;
+
+    for (i = 0; i < catalog_dir_count; i++) free( catalog_dirs[i] );
+    free( catalog_dirs );
+    catalog_dirs = NULL;
+    catalog_dir_count = catalog_dir_max = 0;
+}
+
+static LONGLONG get_dir_write_time( const WCHAR *path, UINT len )
+{
+    FILE_NETWORK_OPEN_INFORMATION info;
+    UNICODE_STRING nt_name;
+    OBJECT_ATTRIBUTES attr;
+
+    nt_name.Buffer = (WCHAR *)path;
+    nt_name.Length = nt_name.MaximumLength = len * sizeof(WCHAR);
+    InitializeObjectAttributes( &attr, &nt_name, OBJ_CASE_INSENSITIVE, 0, NULL );
+    if (NtQueryFullAttributesFile( &attr, &info )) return 0;
+    return info.LastWriteTime.QuadPart;
+}
+
+static void get_font_catalog_header( struct font_catalog_header *header, UINT dpi )
+{
+    LCID lcid = 0;
+
+    NtQueryDefaultLocale( FALSE, &lcid );
+    memset( header, 0, sizeof(*header) );
+    header->magic   = FONT_CATALOG_MAGIC;
+    header->version = FONT_CATALOG_VERSION;
+    header->dpi     = dpi;
+    header->ansi_cp = ansi_cp.CodePage;
+    header->oem_cp  = oem_cp.CodePage;
+    header->lcid    = lcid;
+}
+
+static const struct font_catalog_face *validate_font_catalog( const char *data, SIZE_T size, UINT dpi )
+{
+    const struct font_catalog_header *header = (const struct font_catalog_header *)data;
+    const struct font_catalog_face *face;
+    const struct font_catalog_dir *dir;
+    struct font_catalog_header expected;
+    const char *ptr, *end;
+    DWORD i, j, count;
+
+    if (size < sizeof(*header) || header->size > size) return NULL;
+    get_font_catalog_header( &expected, dpi );
+    expected.size = header->size;
+    expected.dir_count = header->dir_count;
+    expected.face_count = header->face_count;
+    if (memcmp( header, &expected, sizeof(expected) )) return NULL;
+
+    ptr = data + sizeof(*header);
+    end = data + header->size;
+
+    for (i = 0; i < header->dir_count; i++)
+    {
+        dir = (const struct font_catalog_dir *)ptr;
+        if (end - ptr < offsetof( struct font_catalog_dir, path[1] ) ||
+            dir->record_size > end - ptr || dir->record_size < offsetof( struct font_catalog_dir, path[1] ))
+            return NULL;
+        count = (dir->record_size - offsetof( struct font_catalog_dir, path )) / sizeof(WCHAR);
+        for (j = 0; j < count; j++) if (!dir->path[j]) break;
+        if (j == count) return NULL;
+        if (get_dir_write_time( dir->path, j ) != dir->write_time.QuadPart)
+        {
+            TRACE( "directory %s changed, discarding catalog\n", debugstr_wn(dir->path, j) );
+            return NULL;
+        }
+        ptr += dir->record_size;
+    }
+
+    face = (const struct font_catalog_face *)ptr;
+
+    for (i = 0; i < header->face_count; i++)
+    {
+        const struct font_catalog_face *rec = (const struct font_catalog_face *)ptr;
+        DWORD names = 0;
+
+        if (end - ptr < offsetof( struct font_catalog_face, names[1] ) ||
+            rec->record_size > end - ptr || rec->record_size < offsetof( struct font_catalog_face, names[1] ))
+            return NULL;
+        count = (rec->record_size - offsetof( struct font_catalog_face, names )) / sizeof(WCHAR);
+        for (j = 0; j < count && names < FONT_CATALOG_FACE_NAMES; j++) if (!rec->names[j]) names++;
+        if (names < FONT_CATALOG_FACE_NAMES) return NULL;
+        ptr += rec->record_size;
+    }
+
+    return face;
+}
+
+static BOOL load_font_catalog( UINT dpi )
+{
+    const struct font_catalog_header *header;
+    const struct font_catalog_face *rec;
+    struct gdi_font_family *family;
+    struct gdi_font_face *face;
+    UNICODE_STRING nt_name;
+    OBJECT_ATTRIBUTES attr;
+    IO_STATUS_BLOCK io;
+    HANDLE file, section;
+    SIZE_T size = 0;
+    void *ptr = NULL;
+    const WCHAR *second_name, *style_name, *full_name, *file_name;
+    WCHAR path[MAX_PATH];
+    DWORD i;
+
+    get_font_catalog_path( path );
+    nt_name.Buffer = path;
+    nt_name.Length = nt_name.MaximumLength = lstrlenW( path ) * sizeof(WCHAR);
+    InitializeObjectAttributes( &attr, &nt_name, OBJ_CASE_INSENSITIVE, 0, NULL );
+    if (NtOpenFile( &file, GENERIC_READ | SYNCHRONIZE, &attr, &io, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                    FILE_SYNCHRONOUS_IO_NONALERT | FILE_NON_DIRECTORY_FILE ))
+        return FALSE;
+
+    if (NtCreateSection( &section, SECTION_MAP_READ | SECTION_QUERY, NULL, NULL, PAGE_READONLY, SEC_COMMIT, file ))
+    {
+        NtClose( file );
+        return FALSE;
+    }
+    NtClose( file );
+
+    if (NtMapViewOfSection( section, GetCurrentProcess(), &ptr, 0, 0, NULL, &size, ViewShare, 0, PAGE_READONLY ))
+    {
+        NtClose( section );
+        return FALSE;
+    }
+    NtClose( section );
+
+    header = ptr;
+    if (!(rec = validate_font_catalog( ptr, size, dpi )))
+    {
+        NtUnmapViewOfSection( GetCurrentProcess(), ptr );
+        return FALSE;
+    }
+
+    for (i = 0; i < header->face_count; i++)
+    {
+        second_name = rec->names + lstrlenW( rec->names ) + 1;
+        style_name = second_name + lstrlenW( second_name ) + 1;
+        full_name = style_name + lstrlenW( style_name ) + 1;
+        file_name = full_name + lstrlenW( full_name ) + 1;
+
+        if ((family = find_family_from_name( rec->names ))) family->refcount++;
+        else family = create_family( rec->names, second_name );
+
+        if ((face = create_face( family, style_name, full_name, file_name, NULL, 0, rec->index, rec->fs,
+                                 rec->ntmflags, rec->weight, rec->version, rec->flags,
+                                 rec->scalable ? NULL : &rec->size )))
+            release_face( face );
+        release_family( family );
+
+        rec = (const struct font_catalog_face *)((const char *)rec + rec->record_size);
+    }
+
+    TRACE( "loaded %u faces from catalog\n", (int)header->face_count );
+    NtUnmapViewOfSection( GetCurrentProcess(), ptr );
+    return TRUE;
+}
+
+static BOOL catalog_grow( char **data, SIZE_T *max, SIZE_T size )
+{
+    SIZE_T new_max = max( *max * 2, size );
+    char *new_data;
+
+    if (size <= *max) return TRUE;
+    if (!(new_data = realloc( *data, new_max ))) return FALSE;
+    *data = new_data;
+    *max = new_max;
+    return TRUE;
+}
+
+static void save_font_catalog( UINT dpi )
+{
+    struct font_catalog_header *header;
+    struct font_catalog_face *rec;
+    struct font_catalog_dir *dir;
+    struct gdi_font_family *family;
+    struct gdi_font_face *face;
+    const WCHAR *names[FONT_CATALOG_FACE_NAMES], *p;
+    static const WCHAR emptyW[] = {0};
+    SIZE_T pos, size, max = 0x10000;
+    WCHAR path[MAX_PATH];
+    UNICODE_STRING nt_name;
+    OBJECT_ATTRIBUTES attr;
+    IO_STATUS_BLOCK io;
+    HANDLE file;
+    char *data;
+    UINT i, len;
+
+    WINE_RB_FOR_EACH_ENTRY( family, &family_name_tree, struct gdi_font_family, name_entry )
+    {
+        LIST_FOR_EACH_ENTRY( face, &family->faces, struct gdi_font_face, entry )
+        {
+            if (face->data_ptr || !face->file) continue;
+            if ((p = wcsrchr( face->file, '\\' ))) catalog_add_dir( face->file, p - face->file );
+        }
+    }
+
+    if (!(data = malloc( max ))) goto done;
+    pos = sizeof(*header);
+
+    for (i = 0; i < catalog_dir_count; i++)
+    {
+        len = lstrlenW( catalog_dirs[i] );
+        size = catalog_record_size( offsetof( struct font_catalog_dir, path[len + 1] ));
+        if (!catalog_grow( &data, &max, pos + size )) goto done;
+        dir = (struct font_catalog_dir *)(data + pos);
+        memset( dir, 0, size );
+        dir->record_size = size;
+        dir->write_time.QuadPart = get_dir_write_time( catalog_dirs[i], len );
+        memcpy( dir->path, catalog_dirs[i], len * sizeof(WCHAR) );
+        pos += size;
+    }
+
+    header = (struct font_catalog_header *)data;
+    get_font_catalog_header( header, dpi );
+    header->dir_count = catalog_dir_count;
+
+    WINE_RB_FOR_EACH_ENTRY( family, &family_name_tree, struct gdi_font_family, name_entry )
+    {
+        LIST_FOR_EACH_ENTRY( face, &family->faces, struct gdi_font_face, entry )
+        {
+            if (face->data_ptr || !face->file) continue;
+
+            names[0] = family->family_name;
+            names[1] = family->second_name;
+            names[2] = face->style_name;
+            names[3] = face->full_name ? face->full_name : emptyW;
+            names[4] = face->file;
+            for (i = len = 0; i < FONT_CATALOG_FACE_NAMES; i++) len += lstrlenW( names[i] ) + 1;
+
+            size = catalog_record_size( offsetof( struct font_catalog_face, names[len] ));
+            if (!catalog_grow( &data, &max, pos + size )) goto done;
+            rec = (struct font_catalog_face *)(data + pos);
+            memset( rec, 0, size );
+            rec->record_size = size;
+            rec->index       = face->face_index;
+            rec->flags       = face->flags;
+            rec->ntmflags    = face->ntmFlags;
+            rec->weight      = face->weight;
+            rec->version     = face->version;
+            rec->scalable    = face->scalable;
+            rec->size        = face->size;
+            rec->fs          = face->fs;
+            for (i = len = 0; i < FONT_CATALOG_FACE_NAMES; i++)
+            {
+                lstrcpyW( rec->names + len, names[i] );
+                len += lstrlenW( names[i] ) + 1;
+            }
+            pos += size;
+            ((struct font_catalog_header *)data)->face_count++;
+        }
+    }
+
+    header = (struct font_catalog_header *)data;
+    header->size = pos;
+
+    get_font_catalog_path( path );
+    nt_name.Buffer = path;
+    nt_name.Length = nt_name.MaximumLength = lstrlenW( path ) * sizeof(WCHAR);
+    InitializeObjectAttributes( &attr, &nt_name, OBJ_CASE_INSENSITIVE, 0, NULL );
+    if (!NtCreateFile( &file, GENERIC_WRITE | SYNCHRONIZE, &attr, &io, NULL, FILE_ATTRIBUTE_NORMAL, 0,
+                       FILE_OVERWRITE_IF, FILE_SYNCHRONOUS_IO_NONALERT | FILE_NON_DIRECTORY_FILE, NULL, 0 ))
+    {
+        if (NtWriteFile( file, 0, NULL, NULL, &io, data, pos, NULL, NULL ) || io.Information != pos)
+            WARN( "failed to write font catalog\n" );
+        else
+            TRACE( "saved %u faces to catalog\n", (int)header->face_count );
+        NtClose( file );
+    }
+
+done:
+    free( data );
+    catalog_free_dirs();
+}
+
 /* font links */
 
 struct gdi_font_link
@@ -4804,6 +5179,43 @@ const struct gdi_dc_funcs font_driver =
     GDI_PRIORITY_FONT_DRV           /* priority */
 };
 
+static UINT64 hash_font_data( UINT64 hash, const void *data, SIZE_T size )
+{
+    const BYTE *ptr = data;
+
+    while (size--) hash = (hash ^ *ptr++) * 0x100000001b3ull;
+    return hash;
+}
+
+/***********************************************************************
+ *           get_gdi_font_id
+ *
+ * Return an identifier of the glyph bitmaps rendered with the font
+ * selected in the DC, that is the same in all processes, or 0 if the
+ * font isn't loaded from a file.
+ */
+UINT64 get_gdi_font_id( DC *dc )
+{
+    PHYSDEV dev = find_dc_driver( dc, &font_driver );
+    struct gdi_font *font;
+    UINT64 hash = 0xcbf29ce484222325ull;
+    UINT flags;
+
+    if (!dev || !(font = get_font_dev( dev )->font) || !font->file[0]) return 0;
+
+    flags = font->fake_bold | (font->fake_italic << 1) | (font->can_use_bitmap << 2);
+    hash = hash_font_data( hash, font->file, lstrlenW( font->file ) * sizeof(WCHAR) );
+    hash = hash_font_data( hash, &font->writetime, sizeof(font->writetime) );
+    hash = hash_font_data( hash, &font->data_size, sizeof(font->data_size) );
+    hash = hash_font_data( hash, &font->face_index, sizeof(font->face_index) );
+    hash = hash_font_data( hash, &font->lf, offsetof( LOGFONTW, lfFaceName ));
+    hash = hash_font_data( hash, &font->matrix, sizeof(font->matrix) );
+    hash = hash_font_data( hash, &font->scale_y, sizeof(font->scale_y) );
+    hash = hash_font_data( hash, &font->aa_flags, sizeof(font->aa_flags) );
+    hash = hash_font_data( hash, &flags, sizeof(flags) );
+    return hash ? hash : 1;
+}
+
 static BOOL get_key_value( HKEY key, const char *name, DWORD *value )
 {
     char value_buffer[FIELD_OFFSET(KEY_VALUE_PARTIAL_INFORMATION, Data[12 * sizeof(WCHAR)])];
@@ -6582,6 +6994,7 @@ static void load_directory_fonts( WCHAR *path, UINT flags )
 
     len = lstrlenW( path );
     while (len && path[len - 1] == '\\') len--;
+    catalog_add_dir( path, len );
 
     nt_name.Buffer = path;
     nt_name.MaximumLength = nt_name.Length = len * sizeof(WCHAR);
@@ -6831,6 +7244,7 @@ UINT font_init(void)
     UNICODE_STRING name;
     HANDLE mutex;
     DWORD disposition;
+    ULONG start;
     UINT dpi = 0;
 
     static WCHAR wine_font_mutexW[] =
@@ -6849,18 +7263,31 @@ UINT font_init(void)
     if (!(font_funcs = init_freetype_lib()))
         return dpi;
 
-    load_system_bitmap_fonts();
-    load_file_system_fonts();
-    font_funcs->load_fonts();
-
     attr.Attributes = OBJ_OPENIF;
     attr.ObjectName = &name;
     name.Buffer = wine_font_mutexW;
     name.Length = name.MaximumLength = sizeof(wine_font_mutexW);
 
-    if (NtCreateMutant( &mutex, MUTEX_ALL_ACCESS, &attr, FALSE ) < 0) return dpi;
+    if (NtCreateMutant( &mutex, MUTEX_ALL_ACCESS, &attr, FALSE ) < 0)
+    {
+        load_system_bitmap_fonts();
+        load_file_system_fonts();
+        font_funcs->load_fonts();
+        catalog_free_dirs();
+        return dpi;
+    }
     NtWaitForSingleObject( mutex, FALSE, NULL );
 
+    start = NtGetTickCount();
+    if (!load_font_catalog( dpi ))
+    {
+        load_system_bitmap_fonts();
+        load_file_system_fonts();
+        font_funcs->load_fonts();
+        save_font_catalog( dpi );
+    }
+    TRACE( "system fonts loaded in %u ms\n", (int)(NtGetTickCount() - start) );
+
     wine_fonts_cache_key = reg_create_key( wine_fonts_key, cacheW, sizeof(cacheW),
                                            REG_OPTION_VOLATILE, &disposition );
 
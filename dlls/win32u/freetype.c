@@ -1669,8 +1669,17 @@ static void fontconfig_add_fonts_from_dir_list( FcConfig *config, FcStrList *dir
 
     while ((dir = pFcStrListNext( dir_list )))
     {
+        WCHAR *dos_name;
+
         if (pFcStrSetMember( done_set, dir )) continue;
 
+        /* missing and empty directories too, so that new fonts in them are noticed */
+        if ((dos_name = get_dos_file_name( (const char *)dir )))
+        {
+            add_font_catalog_dir( dos_name );
+            free( dos_name );
+        }
+
         TRACE( "adding fonts from %s\n", dir );
         if (!(cache = pFcDirCacheRead( dir, FcFalse, config ))) continue;
 
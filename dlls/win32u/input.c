@@ -850,6 +850,7 @@ DWORD WINAPI NtUserGetQueueStatus( UINT flags )
         ret = MAKELONG( reply->changed_bits & flags, reply->wake_bits & flags );
     }
     SERVER_END_REQ;
+    ret |= get_local_queue_status( flags ) & MAKELONG( flags, flags );
     return ret;
 }
 
@@ -2787,6 +2787,197 @@ static BOOL process_hardware_message( MSG *msg, UINT hw_id, const struct hardwar
     return ret;
 }
 
+/* messages posted by a thread to itself are kept on the client side as long as
+ * the server queue has no posted messages, so ordering is preserved */
+struct local_message
+{
+    struct list entry;
+    MSG         msg;
+};
+
+struct local_message_queue
+{
+    struct list messages;
+    UINT        count;
+    UINT        changed_bits;  /* queue bits changed since the last retrieval */
+};
+
+#define MAX_LOCAL_MESSAGES 10000
+
+static struct local_message_queue *get_local_message_queue( BOOL create )
+{
+    struct user_thread_info *thread_info = get_user_thread_info();
+    struct local_message_queue *queue;
+
+    if ((queue = thread_info->local_queue) || !create) return queue;
+    if (!(queue = malloc( sizeof(*queue) ))) return NULL;
+    list_init( &queue->messages );
+    queue->count = 0;
+    queue->changed_bits = 0;
+    return thread_info->local_queue = queue;
+}
+
+static void remove_local_message( struct local_message_queue *queue, struct local_message *msg )
+{
+    list_remove( &msg->entry );
+    queue->count--;
+    free( msg );
+}
+
+/***********************************************************************
+ *           post_local_message
+ *
+ * Try to queue a message posted to the current thread without a server round trip.
+ */
+static BOOL post_local_message( const struct send_message_info *info )
+{
+    const queue_shm_t *queue_shm = get_queue_shared_memory();
+    const desktop_shm_t *desktop_shm = get_desktop_shared_memory();
+    struct local_message_queue *queue;
+    struct local_message *msg;
+    BOOL server_messages = TRUE;
+    HWND hwnd = 0;
+    POINT pt = {0};
+
+    if (info->dest_tid != GetCurrentThreadId()) return FALSE;
+    if (info->msg & 0x80000000) return FALSE;  /* internal message */
+    if (info->msg >= WM_DDE_FIRST && info->msg <= WM_DDE_LAST) return FALSE;
+    if (info->msg == WM_HOTKEY || info->msg == WM_PAINT) return FALSE;
+    if (info->hwnd && !(hwnd = is_current_thread_window( info->hwnd ))) return FALSE;
+    if (!queue_shm || !desktop_shm) return FALSE;
+
+    SHARED_READ_BEGIN( queue_shm, queue_shm_t )
+    {
+        /* posted messages or WM_QUIT already pending on the server side */
+        server_messages = !queue_shm->created || (queue_shm->wake_bits & QS_POSTMESSAGE);
+    }
+    SHARED_READ_END
+    if (server_messages) return FALSE;
+
+    if (!(queue = get_local_message_queue( TRUE ))) return FALSE;
+    if (queue->count >= MAX_LOCAL_MESSAGES) return FALSE;
+    if (!(msg = malloc( sizeof(*msg) ))) return FALSE;
+
+    SHARED_READ_BEGIN( desktop_shm, desktop_shm_t )
+    {
+        pt.x = desktop_shm->cursor.x;
+        pt.y = desktop_shm->cursor.y;
+    }
+    SHARED_READ_END
+
+    msg->msg.hwnd    = hwnd;
+    msg->msg.message = info->msg;
+    msg->msg.wParam  = info->wparam;
+    msg->msg.lParam  = info->lparam;
+    msg->msg.time    = NtGetTickCount();
+    msg->msg.pt      = pt;
+    list_add_tail( &queue->messages, &msg->entry );
+    queue->count++;
+    queue->changed_bits = QS_POSTMESSAGE | QS_ALLPOSTMESSAGE;
+    return TRUE;
+}
+
+/***********************************************************************
+ *           find_local_message
+ *
+ * Find the first locally posted message matching the peek filters.
+ */
+static struct local_message *find_local_message( HWND hwnd, UINT first, UINT last )
+{
+    struct local_message_queue *queue = get_local_message_queue( FALSE );
+    struct local_message *msg, *next;
+    user_handle_t win = wine_server_user_handle( hwnd );
+
+    if (!queue) return NULL;
+    if (win && win != -1 && win != 1) hwnd = get_full_window_handle( hwnd );
+
+    LIST_FOR_EACH_ENTRY_SAFE( msg, next, &queue->messages, struct local_message, entry )
+    {
+        /* drop messages for windows that have been destroyed, like the server does */
+        if (msg->msg.hwnd && !is_current_thread_window( msg->msg.hwnd ))
+        {
+            remove_local_message( queue, msg );
+            continue;
+        }
+        if (msg->msg.message < first || msg->msg.message > last) continue;
+        if (!win) return msg;
+        if (win == -1 || win == 1)
+        {
+            if (!msg->msg.hwnd) return msg;
+            continue;
+        }
+        if (msg->msg.hwnd == hwnd || is_child( hwnd, msg->msg.hwnd )) return msg;
+    }
+    return NULL;
+}
+
+/* check whether the server has to be queried before returning a local message */
+static BOOL local_message_needs_server( const queue_shm_t *shared )
+{
+    struct user_thread_info *thread_info = get_user_thread_info();
+    BOOL ret = TRUE;
+
+    if (!shared || NtGetTickCount() - thread_info->last_getmsg_time >= 3000) return TRUE;
+
+    SHARED_READ_BEGIN( shared, queue_shm_t )
+    {
+        ret = !shared->created || (shared->wake_bits & QS_SENDMESSAGE);
+    }
+    SHARED_READ_END
+
+    return ret;
+}
+
+/* return a local message to the caller of peek_message */
+static void return_local_message( struct local_message *local, MSG *msg, UINT flags )
+{
+    struct user_thread_info *thread_info = get_user_thread_info();
+
+    *msg = local->msg;
+    msg->pt = point_phys_to_win_dpi( local->msg.hwnd, local->msg.pt );
+    thread_info->client_info.message_pos   = MAKELONG( msg->pt.x, msg->pt.y );
+    thread_info->client_info.message_time  = local->msg.time;
+    thread_info->client_info.message_extra = 0;
+    thread_info->client_info.msg_source = msg_source_unavailable;
+    if (flags & PM_REMOVE) remove_local_message( thread_info->local_queue, local );
+
+    TRACE( "got local msg %x (%s) hwnd %p wp %lx lp %lx\n", msg->message,
+           debugstr_msg_name( msg->message, msg->hwnd ), msg->hwnd, (long)msg->wParam, msg->lParam );
+    call_hooks( WH_GETMESSAGE, HC_ACTION, flags & PM_REMOVE, (LPARAM)msg, sizeof(*msg) );
+}
+
+/***********************************************************************
+ *           get_local_queue_status
+ *
+ * Get the queue status bits of the locally posted messages, clearing the changed bits.
+ */
+DWORD get_local_queue_status( UINT clear_bits )
+{
+    struct local_message_queue *queue = get_local_message_queue( FALSE );
+    DWORD ret;
+
+    if (!queue || list_empty( &queue->messages )) return 0;
+    ret = MAKELONG( queue->changed_bits, QS_POSTMESSAGE | QS_ALLPOSTMESSAGE );
+    queue->changed_bits &= ~clear_bits;
+    return ret;
+}
+
+/***********************************************************************
+ *           cleanup_local_messages
+ */
+void cleanup_local_messages(void)
+{
+    struct user_thread_info *thread_info = get_user_thread_info();
+    struct local_message_queue *queue = thread_info->local_queue;
+    struct local_message *msg, *next;
+
+    if (!queue) return;
+    LIST_FOR_EACH_ENTRY_SAFE( msg, next, &queue->messages, struct local_message, entry )
+        remove_local_message( queue, msg );
+    free( queue );
+    thread_info->local_queue = NULL;
+}
+
 /***********************************************************************
  *           peek_message
  *
@@ -2800,6 +2991,7 @@ static int peek_message( MSG *msg, HWND hwnd, UINT first, UINT last, UINT flags,
     struct user_thread_info *thread_info = get_user_thread_info();
     INPUT_MESSAGE_SOURCE prev_source = thread_info->client_info.msg_source;
     const queue_shm_t *shared = get_queue_shared_memory();
+    struct local_message *local;
     struct received_message_info info;
     unsigned char buffer_init[1024];
     unsigned int hw_id = 0;  /* id of previous hardware message */
@@ -2815,7 +3007,7 @@ static int peek_message( MSG *msg, HWND hwnd, UINT first, UINT last, UINT flags,
         NTSTATUS res;
         size_t size = 0;
         const message_data_t *msg_data = buffer;
-        UINT wake_mask = changed_mask & (QS_SENDMESSAGE | QS_SMRESULT);
+        UINT wake_mask = changed_mask & (QS_SENDMESSAGE | QS_SMRESULT), req_flags = flags;
         DWORD clear_bits = 0, filter = flags >> 16 ? flags >> 16 : QS_ALLINPUT;
         if (filter & QS_POSTMESSAGE)
         {
@@ -2830,7 +3022,22 @@ static int peek_message( MSG *msg, HWND hwnd, UINT first, UINT last, UINT flags,
 
         thread_info->client_info.msg_source = prev_source;
 
-        if (waited || !shared || NtGetTickCount() - thread_info->last_getmsg_time >= 3000) skip = FALSE;
+        local = NULL;
+        if (thread_info->local_queue) thread_info->local_queue->changed_bits &= ~clear_bits;
+        if ((filter & QS_POSTMESSAGE) && (local = find_local_message( hwnd, first, last )))
+        {
+            if (!local_message_needs_server( shared ))
+            {
+                if (buffer != buffer_init) free( buffer );
+                return_local_message( local, msg, flags );
+                return 1;
+            }
+            /* process pending sent messages first, the local message is older than any server posted one */
+            req_flags = LOWORD(flags) | PM_QS_SENDMESSAGE;
+        }
+
+        if (local) skip = FALSE;
+        else if (waited || !shared || NtGetTickCount() - thread_info->last_getmsg_time >= 3000) skip = FALSE;
         else SHARED_READ_BEGIN( shared, queue_shm_t )
         {
             /* not created yet */
@@ -2852,7 +3059,7 @@ static int peek_message( MSG *msg, HWND hwnd, UINT first, UINT last, UINT flags,
         if (skip) res = STATUS_PENDING;
         else SERVER_START_REQ( get_message )
         {
-            req->flags     = flags;
+            req->flags     = req_flags;
             req->get_win   = wine_server_user_handle( hwnd );
             req->get_first = first;
             req->get_last  = last;
@@ -2883,6 +3090,12 @@ static int peek_message( MSG *msg, HWND hwnd, UINT first, UINT last, UINT flags,
 
         if (res)
         {
+            if (res == STATUS_PENDING && local)
+            {
+                if (buffer != buffer_init) free( buffer );
+                return_local_message( local, msg, flags );
+                return 1;
+            }
             if (res == STATUS_PENDING)
             {
                 thread_info->wake_mask = changed_mask & (QS_SENDMESSAGE | QS_SMRESULT);
@@ -3273,6 +3486,20 @@ DWORD WINAPI NtUserMsgWaitForMultipleObjectsEx( DWORD count, const HANDLE *handl
     for (i = 0; i < count; i++) wait_handles[i] = normalize_std_handle( handles[i] );
     wait_handles[count] = get_server_queue_handle();
 
+    /* locally posted messages don't signal the server queue */
+    if (mask & QS_POSTMESSAGE)
+    {
+        DWORD status = get_local_queue_status( 0 ), ret;
+        if ((HIWORD(status) & mask) && ((flags & MWMO_INPUTAVAILABLE) || (LOWORD(status) & mask)))
+        {
+            /* the other handles still take precedence, and pending messages over APCs,
+             * just like with a signaled server queue */
+            ret = wait_objects( count+1, wait_handles, 0, (flags & MWMO_INPUTAVAILABLE) ? mask : 0,
+                                mask, flags & ~MWMO_ALERTABLE );
+            return ret == WAIT_TIMEOUT ? count : ret;
+        }
+    }
+
     return wait_objects( count+1, wait_handles, timeout,
                          (flags & MWMO_INPUTAVAILABLE) ? mask : 0, mask, flags );
 }
@@ -3440,6 +3667,8 @@ static BOOL put_message_in_queue( const struct send_message_info *info, size_t *
         timeout = (timeout_t)max( 0, (int)info->timeout ) * -10000;
     }
 
+    if (info->type == MSG_POSTED && post_local_message( info )) return TRUE;
+
     memset( &data, 0, sizeof(data) );
     if (info->type == MSG_OTHER_PROCESS || info->type == MSG_NOTIFY)
     {
@@ -152,6 +152,7 @@ struct user_thread_info
     const queue_shm_t            *queue_shm;              /* Ptr to server's thread queue shared memory */
     const input_shm_t            *input_shm;              /* Ptr to server's thread input shared memory */
     const input_shm_t            *foreground_shm;         /* Ptr to server's foreground thread input shared memory */
+    struct local_message_queue   *local_queue;            /* Messages posted locally to the current thread */
 };
 
 C_ASSERT( sizeof(struct user_thread_info) <= sizeof(((TEB *)0)->Win32ClientInfo) );
@@ -279,6 +280,7 @@ extern volatile struct global_shared_memory *get_global_shared_memory( void );
 extern const desktop_shm_t *get_desktop_shared_memory(void);
 extern const queue_shm_t *get_queue_shared_memory(void);
 extern const input_shm_t *get_input_shared_memory(void);
+extern const window_shm_t *get_windows_shared_memory(void);
 extern const input_shm_t *get_foreground_shared_memory(void);
 
 static inline UINT win_get_flags( HWND hwnd )
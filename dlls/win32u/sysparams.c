@@ -6239,6 +6239,7 @@ static void thread_detach(void)
     free( thread_info->rawinput );
 
     destroy_thread_windows();
+    cleanup_local_messages();
     cleanup_imm_thread();
     NtClose( thread_info->server_queue );
 
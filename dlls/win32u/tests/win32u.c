@@ -2042,6 +2042,31 @@ static void test_wndproc_hook(void)
     UnregisterClassW( L"TestLParamClass", NULL );
 }
 
+static void test_syscall_overhead(void)
+{
+    static const unsigned int count = 100000;
+    LARGE_INTEGER start, end, freq;
+    unsigned int i;
+    HWND hwnd = 0;
+    SHORT state;
+
+    QueryPerformanceFrequency( &freq );
+
+    QueryPerformanceCounter( &start );
+    for (i = 0; i < count; i++) state = NtUserGetKeyState( VK_SHIFT );
+    QueryPerformanceCounter( &end );
+    ok( !(state & ~0x8001), "got state %#x\n", state );
+    trace( "NtUserGetKeyState: %I64u ns/call\n",
+           (end.QuadPart - start.QuadPart) * 1000000000 / freq.QuadPart / count );
+
+    QueryPerformanceCounter( &start );
+    for (i = 0; i < count; i++) hwnd = NtUserGetForegroundWindow();
+    QueryPerformanceCounter( &end );
+    ok( hwnd == GetForegroundWindow(), "got hwnd %p\n", hwnd );
+    trace( "NtUserGetForegroundWindow: %I64u ns/call\n",
+           (end.QuadPart - start.QuadPart) * 1000000000 / freq.QuadPart / count );
+}
+
 START_TEST(win32u)
 {
     char **argv;
@@ -2085,4 +2110,5 @@ START_TEST(win32u)
 
     test_NtUserEnableMouseInPointer( argv, FALSE );
     test_NtUserEnableMouseInPointer( argv, TRUE );
+    test_syscall_overhead();
 }
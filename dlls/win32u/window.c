@@ -175,6 +175,32 @@ HWND get_hwnd_message_parent(void)
     return UlongToHandle( thread_info->msg_window );
 }
 
+/***********************************************************************
+ *           get_shared_window_info
+ *
+ * Read a consistent snapshot of a window from the shared window table,
+ * which avoids a server round trip for windows owned by other processes.
+ * Returns FALSE if the handle isn't found, the caller should then ask
+ * the server to get the proper error.
+ */
+static BOOL get_shared_window_info( HWND hwnd, struct window_shared_memory *info )
+{
+    const window_shm_t *table, *shared;
+    UINT index = USER_HANDLE_TO_INDEX( hwnd );
+
+    if (index >= WINDOW_SHARED_ENTRIES || !(table = get_windows_shared_memory())) return FALSE;
+    shared = &table[index];
+
+    SHARED_READ_BEGIN( shared, window_shm_t )
+    {
+        *info = *shared;
+    }
+    SHARED_READ_END;
+
+    if (!info->handle) return FALSE;
+    return info->handle == HandleToUlong( hwnd ) || !HIWORD(hwnd) || HIWORD(hwnd) == 0xffff;
+}
+
 /***********************************************************************
  *           get_full_window_handle
  *
@@ -204,6 +230,10 @@ HWND get_full_window_handle( HWND hwnd )
     }
     else  /* may belong to another process */
     {
+        struct window_shared_memory info;
+
+        if (get_shared_window_info( hwnd, &info )) return UlongToHandle( info.handle );
+
         SERVER_START_REQ( get_window_info )
         {
             req->handle = wine_server_user_handle( hwnd );
@@ -289,6 +319,7 @@ HWND is_current_process_window( HWND hwnd )
 /* see IsWindow */
 BOOL is_window( HWND hwnd )
 {
+    struct window_shared_memory info;
     WND *win;
     BOOL ret;
 
@@ -302,6 +333,8 @@ BOOL is_window( HWND hwnd )
     }
 
     /* check other processes */
+    if (get_shared_window_info( hwnd, &info )) return TRUE;
+
     SERVER_START_REQ( get_window_info )
     {
         req->handle = wine_server_user_handle( hwnd );
@@ -314,6 +347,7 @@ BOOL is_window( HWND hwnd )
 /* see GetWindowThreadProcessId */
 DWORD get_window_thread( HWND hwnd, DWORD *process )
 {
+    struct window_shared_memory info;
     WND *ptr;
     DWORD tid = 0;
 
@@ -333,6 +367,12 @@ DWORD get_window_thread( HWND hwnd, DWORD *process )
     }
 
     /* check other processes */
+    if (ptr == WND_OTHER_PROCESS && get_shared_window_info( hwnd, &info ))
+    {
+        if (process) *process = info.pid;
+        return info.tid;
+    }
+
     SERVER_START_REQ( get_window_info )
     {
         req->handle = wine_server_user_handle( hwnd );
@@ -360,7 +400,17 @@ HWND get_parent( HWND hwnd )
     if (win == WND_DESKTOP) return 0;
     if (win == WND_OTHER_PROCESS)
     {
-        LONG style = get_window_long( hwnd, GWL_STYLE );
+        struct window_shared_memory info;
+        LONG style;
+
+        if (get_shared_window_info( hwnd, &info ))
+        {
+            if (info.style & WS_POPUP) retval = UlongToHandle( info.owner );
+            else if (info.style & WS_CHILD) retval = UlongToHandle( info.parent );
+            return retval;
+        }
+
+        style = get_window_long( hwnd, GWL_STYLE );
         if (style & (WS_POPUP | WS_CHILD))
         {
             SERVER_START_REQ( get_window_tree )
@@ -843,6 +893,10 @@ BOOL is_window_unicode( HWND hwnd )
     }
     else
     {
+        struct window_shared_memory info;
+
+        if (get_shared_window_info( hwnd, &info )) return info.is_unicode;
+
         SERVER_START_REQ( get_window_info )
         {
             req->handle = wine_server_user_handle( hwnd );
@@ -924,6 +978,10 @@ DPI_AWARENESS_CONTEXT get_window_dpi_awareness_context( HWND hwnd )
     }
     else
     {
+        struct window_shared_memory info;
+
+        if (get_shared_window_info( hwnd, &info )) return ULongToHandle( info.dpi_awareness | 0x10 );
+
         SERVER_START_REQ( get_window_info )
         {
             req->handle = wine_server_user_handle( hwnd );
@@ -958,6 +1016,11 @@ UINT get_dpi_for_window( HWND hwnd )
     }
     else
     {
+        struct window_shared_memory info;
+
+        /* per-monitor aware windows need the server to resolve the monitor DPI */
+        if (get_shared_window_info( hwnd, &info ) && info.dpi) return info.dpi;
+
         SERVER_START_REQ( get_window_info )
         {
             req->handle = wine_server_user_handle( hwnd );
@@ -1062,11 +1125,24 @@ static LONG_PTR get_window_long_size( HWND hwnd, INT offset, UINT size, BOOL ans
 
     if (win == WND_OTHER_PROCESS)
     {
+        struct window_shared_memory info;
+
         if (offset == GWLP_WNDPROC)
         {
             RtlSetLastWin32Error( ERROR_ACCESS_DENIED );
             return 0;
         }
+        if (offset < 0 && get_shared_window_info( hwnd, &info ))
+        {
+            switch(offset)
+            {
+            case GWL_STYLE:      return info.style;
+            case GWL_EXSTYLE:    return info.ex_style;
+            case GWLP_ID:        return info.id;
+            case GWLP_HINSTANCE: return (ULONG_PTR)wine_server_get_ptr( info.instance );
+            case GWLP_USERDATA:  return info.user_data;
+            }
+        }
         SERVER_START_REQ( set_window_info )
         {
             req->handle = wine_server_user_handle( hwnd );
@@ -1822,19 +1898,41 @@ done:
     release_win_ptr( win );
 }
 
+/* state of a window position change between the steps of apply_window_pos */
+struct window_pos_data
+{
+    HWND                   hwnd;
+    HWND                   insert_after;
+    UINT                   swp_flags;
+    UINT                   paint_flags;
+    RECT                   window_rect;
+    RECT                   client_rect;
+    RECT                   visible_rect;
+    RECT                   valid_rects[2];
+    BOOL                   has_valid_rects;
+    RECT                   old_window_rect;   /* old window rect in screen coordinates */
+    RECT                   old_visible_rect;
+    RECT                   old_client_rect;
+    struct window_surface *old_surface;
+    struct window_surface *new_surface;
+    HWND                   surface_win;
+    BOOL                   needs_update;
+};
+
 /***********************************************************************
- *           apply_window_pos
+ *           prepare_window_pos
  *
- * Backend implementation of SetWindowPos.
+ * First step of apply_window_pos: let the driver update the window surface
+ * and compute what needs to be sent to the server.
  */
-static BOOL apply_window_pos( HWND hwnd, HWND insert_after, UINT swp_flags,
-                              const RECT *window_rect, const RECT *client_rect, const RECT *valid_rects )
+static BOOL prepare_window_pos( struct window_pos_data *data, HWND hwnd, HWND insert_after, UINT swp_flags,
+                                const RECT *window_rect, const RECT *client_rect, const RECT *valid_rects )
 {
     WND *win;
-    HWND surface_win = 0, parent = NtUserGetAncestor( hwnd, GA_PARENT );
-    BOOL ret, needs_update = FALSE;
-    RECT visible_rect, old_visible_rect, old_window_rect, old_client_rect, extra_rects[3];
-    struct window_surface *old_surface, *new_surface = NULL;
+    HWND parent = NtUserGetAncestor( hwnd, GA_PARENT );
+    struct window_surface *new_surface = NULL;
+    RECT visible_rect;
+    BOOL ret;
 
     if (!parent || parent == get_desktop_window())
     {
@@ -1853,7 +1951,7 @@ static BOOL apply_window_pos( HWND hwnd, HWND insert_after, UINT swp_flags,
         }
     }
 
-    get_window_rects( hwnd, COORDS_SCREEN, &old_window_rect, NULL, get_thread_dpi() );
+    get_window_rects( hwnd, COORDS_SCREEN, &data->old_window_rect, NULL, get_thread_dpi() );
     if (IsRectEmpty( &valid_rects[0] )) valid_rects = NULL;
 
     if (!(win = get_win_ptr( hwnd )) || win == WND_DESKTOP || win == WND_OTHER_PROCESS)
@@ -1872,22 +1970,166 @@ static BOOL apply_window_pos( HWND hwnd, HWND insert_after, UINT swp_flags,
         create_offscreen_window_surface( &visible_rect, &new_surface );
     }
 
-    old_visible_rect = win->visible_rect;
-    old_client_rect = win->client_rect;
-    old_surface = win->surface;
-    if (old_surface != new_surface) swp_flags |= SWP_FRAMECHANGED;  /* force refreshing non-client area */
+    data->old_visible_rect = win->visible_rect;
+    data->old_client_rect = win->client_rect;
+    data->old_surface = win->surface;
+    if (data->old_surface != new_surface) swp_flags |= SWP_FRAMECHANGED;  /* force refreshing non-client area */
     if (new_surface == &dummy_surface) swp_flags |= SWP_NOREDRAW;
-    else if (old_surface == &dummy_surface)
+    else if (data->old_surface == &dummy_surface)
     {
         swp_flags |= SWP_NOCOPYBITS;
         valid_rects = NULL;
     }
 
+    data->paint_flags = 0;
+    if (new_surface) data->paint_flags |= SET_WINPOS_PAINT_SURFACE;
+    if (win->pixel_format || win->internal_pixel_format)
+        data->paint_flags |= SET_WINPOS_PIXEL_FORMAT;
+    release_win_ptr( win );
+
+    data->hwnd         = hwnd;
+    data->insert_after = insert_after;
+    data->swp_flags    = swp_flags;
+    data->window_rect  = *window_rect;
+    data->client_rect  = *client_rect;
+    data->visible_rect = visible_rect;
+    data->new_surface  = new_surface;
+    data->surface_win  = 0;
+    data->needs_update = FALSE;
+    if ((data->has_valid_rects = valid_rects != NULL))
+        memcpy( data->valid_rects, valid_rects, sizeof(data->valid_rects) );
+    else
+        memset( data->valid_rects, 0, sizeof(data->valid_rects) );
+    return TRUE;
+}
+
+/***********************************************************************
+ *           update_window_pos
+ *
+ * Second step of apply_window_pos: store the new position once the server accepted it.
+ */
+static BOOL update_window_pos( struct window_pos_data *data, UINT new_style, UINT new_ex_style )
+{
+    WND *win;
+
+    if (!(win = get_win_ptr( data->hwnd )) || win == WND_DESKTOP || win == WND_OTHER_PROCESS)
+        return FALSE;
+
+    win->dwStyle      = new_style;
+    win->dwExStyle    = new_ex_style;
+    win->window_rect  = data->window_rect;
+    win->client_rect  = data->client_rect;
+    win->visible_rect = data->visible_rect;
+    win->surface      = data->new_surface;
+    if (get_window_long( win->parent, GWL_EXSTYLE ) & WS_EX_LAYOUTRTL)
+    {
+        RECT client;
+        get_window_rects( win->parent, COORDS_CLIENT, NULL, &client, get_thread_dpi() );
+        mirror_rect( &client, &win->window_rect );
+        mirror_rect( &client, &win->client_rect );
+        mirror_rect( &client, &win->visible_rect );
+    }
+    /* if an RTL window is resized the children have moved */
+    if (win->dwExStyle & WS_EX_LAYOUTRTL &&
+        data->client_rect.right - data->client_rect.left !=
+        data->old_client_rect.right - data->old_client_rect.left)
+        win->flags |= WIN_CHILDREN_MOVED;
+
+    if (data->needs_update) update_surface_region( data->surface_win );
+    if (((data->swp_flags & SWP_AGG_NOPOSCHANGE) != SWP_AGG_NOPOSCHANGE) ||
+        (data->swp_flags & (SWP_HIDEWINDOW | SWP_SHOWWINDOW | SWP_STATECHANGED | SWP_FRAMECHANGED)))
+        invalidate_dce( win, &data->old_window_rect );
+
+    release_win_ptr( win );
+    return TRUE;
+}
+
+/***********************************************************************
+ *           finish_window_pos
+ *
+ * Last step of apply_window_pos: update the window surface and notify the driver.
+ */
+static void finish_window_pos( struct window_pos_data *data, BOOL success )
+{
+    struct window_surface *old_surface = data->old_surface, *new_surface = data->new_surface;
+    const RECT *window_rect = &data->window_rect, *client_rect = &data->client_rect;
+    const RECT *valid_rects = data->has_valid_rects ? data->valid_rects : NULL;
+    RECT visible_rect = data->visible_rect, old_visible_rect = data->old_visible_rect;
+    RECT old_client_rect = data->old_client_rect;
+    HWND hwnd = data->hwnd, surface_win = data->surface_win;
+    UINT swp_flags = data->swp_flags;
+
+    if (!success)
+    {
+        if (new_surface) window_surface_release( new_surface );
+        return;
+    }
+
+    TRACE( "win %p surface %p -> %p\n", hwnd, old_surface, new_surface );
+    register_window_surface( old_surface, new_surface );
+    if (old_surface)
+    {
+        if (valid_rects)
+        {
+            move_window_bits( hwnd, old_surface, new_surface, &visible_rect,
+                              &old_visible_rect, window_rect, valid_rects );
+            valid_rects = NULL;  /* prevent the driver from trying to also move the bits */
+        }
+        window_surface_release( old_surface );
+    }
+    else if (surface_win && surface_win != hwnd)
+    {
+        if (valid_rects)
+        {
+            RECT rects[2];
+            int x_offset = old_visible_rect.left - visible_rect.left;
+            int y_offset = old_visible_rect.top - visible_rect.top;
+
+            /* if all that happened is that the whole window moved, copy everything */
+            if (!(swp_flags & SWP_FRAMECHANGED) &&
+                old_visible_rect.right  - visible_rect.right  == x_offset &&
+                old_visible_rect.bottom - visible_rect.bottom == y_offset &&
+                old_client_rect.left    - client_rect->left   == x_offset &&
+                old_client_rect.right   - client_rect->right  == x_offset &&
+                old_client_rect.top     - client_rect->top    == y_offset &&
+                old_client_rect.bottom  - client_rect->bottom == y_offset &&
+                EqualRect( &valid_rects[0], client_rect ))
+            {
+                rects[0] = visible_rect;
+                rects[1] = old_visible_rect;
+                valid_rects = rects;
+            }
+            move_window_bits_parent( hwnd, surface_win, window_rect, valid_rects );
+            valid_rects = NULL;  /* prevent the driver from trying to also move the bits */
+        }
+    }
+
+    user_driver->pWindowPosChanged( hwnd, data->insert_after, swp_flags, window_rect,
+                                    client_rect, &visible_rect, valid_rects, new_surface );
+}
+
+/***********************************************************************
+ *           apply_window_pos
+ *
+ * Backend implementation of SetWindowPos.
+ */
+static BOOL apply_window_pos( HWND hwnd, HWND insert_after, UINT swp_flags,
+                              const RECT *window_rect, const RECT *client_rect, const RECT *valid_rects )
+{
+    struct window_pos_data data;
+    UINT new_style = 0, new_ex_style = 0;
+    RECT extra_rects[3];
+    BOOL ret;
+
+    if (!prepare_window_pos( &data, hwnd, insert_after, swp_flags, window_rect, client_rect, valid_rects ))
+        return FALSE;
+
     SERVER_START_REQ( set_window_pos )
     {
         req->handle        = wine_server_user_handle( hwnd );
         req->previous      = wine_server_user_handle( insert_after );
-        req->swp_flags     = swp_flags;
+        req->swp_flags     = data.swp_flags;
+        req->paint_flags   = data.paint_flags;
         req->window.left   = window_rect->left;
         req->window.top    = window_rect->top;
         req->window.right  = window_rect->right;
@@ -1896,104 +2138,31 @@ static BOOL apply_window_pos( HWND hwnd, HWND insert_after, UINT swp_flags,
         req->client.top    = client_rect->top;
         req->client.right  = client_rect->right;
         req->client.bottom = client_rect->bottom;
-        if (!EqualRect( window_rect, &visible_rect ) || new_surface || valid_rects)
+        if (!EqualRect( window_rect, &data.visible_rect ) || data.new_surface || data.has_valid_rects)
         {
-            extra_rects[0] = extra_rects[1] = visible_rect;
-            if (new_surface)
+            extra_rects[0] = extra_rects[1] = data.visible_rect;
+            if (data.new_surface)
             {
-                extra_rects[1] = new_surface->rect;
-                OffsetRect( &extra_rects[1], visible_rect.left, visible_rect.top );
+                extra_rects[1] = data.new_surface->rect;
+                OffsetRect( &extra_rects[1], data.visible_rect.left, data.visible_rect.top );
             }
-            if (valid_rects) extra_rects[2] = valid_rects[0];
+            if (data.has_valid_rects) extra_rects[2] = data.valid_rects[0];
             else SetRectEmpty( &extra_rects[2] );
             wine_server_add_data( req, extra_rects, sizeof(extra_rects) );
         }
-        if (new_surface) req->paint_flags |= SET_WINPOS_PAINT_SURFACE;
-        if (win->pixel_format || win->internal_pixel_format)
-            req->paint_flags |= SET_WINPOS_PIXEL_FORMAT;
 
         if ((ret = !wine_server_call( req )))
         {
-            win->dwStyle      = reply->new_style;
-            win->dwExStyle    = reply->new_ex_style;
-            win->window_rect  = *window_rect;
-            win->client_rect  = *client_rect;
-            win->visible_rect = visible_rect;
-            win->surface      = new_surface;
-            surface_win       = wine_server_ptr_handle( reply->surface_win );
-            needs_update      = reply->needs_update;
-            if (get_window_long( win->parent, GWL_EXSTYLE ) & WS_EX_LAYOUTRTL)
-            {
-                RECT client;
-                get_window_rects( win->parent, COORDS_CLIENT, NULL, &client, get_thread_dpi() );
-                mirror_rect( &client, &win->window_rect );
-                mirror_rect( &client, &win->client_rect );
-                mirror_rect( &client, &win->visible_rect );
-            }
-            /* if an RTL window is resized the children have moved */
-            if (win->dwExStyle & WS_EX_LAYOUTRTL &&
-                client_rect->right - client_rect->left != old_client_rect.right - old_client_rect.left)
-                win->flags |= WIN_CHILDREN_MOVED;
+            new_style         = reply->new_style;
+            new_ex_style      = reply->new_ex_style;
+            data.surface_win  = wine_server_ptr_handle( reply->surface_win );
+            data.needs_update = reply->needs_update;
         }
     }
     SERVER_END_REQ;
 
-    if (ret)
-    {
-        if (needs_update) update_surface_region( surface_win );
-        if (((swp_flags & SWP_AGG_NOPOSCHANGE) != SWP_AGG_NOPOSCHANGE) ||
-            (swp_flags & (SWP_HIDEWINDOW | SWP_SHOWWINDOW | SWP_STATECHANGED | SWP_FRAMECHANGED)))
-            invalidate_dce( win, &old_window_rect );
-    }
-
-    release_win_ptr( win );
-
-    if (ret)
-    {
-        TRACE( "win %p surface %p -> %p\n", hwnd, old_surface, new_surface );
-        register_window_surface( old_surface, new_surface );
-        if (old_surface)
-        {
-            if (valid_rects)
-            {
-                move_window_bits( hwnd, old_surface, new_surface, &visible_rect,
-                                  &old_visible_rect, window_rect, valid_rects );
-                valid_rects = NULL;  /* prevent the driver from trying to also move the bits */
-            }
-            window_surface_release( old_surface );
-        }
-        else if (surface_win && surface_win != hwnd)
-        {
-            if (valid_rects)
-            {
-                RECT rects[2];
-                int x_offset = old_visible_rect.left - visible_rect.left;
-                int y_offset = old_visible_rect.top - visible_rect.top;
-
-                /* if all that happened is that the whole window moved, copy everything */
-                if (!(swp_flags & SWP_FRAMECHANGED) &&
-                    old_visible_rect.right  - visible_rect.right  == x_offset &&
-                    old_visible_rect.bottom - visible_rect.bottom == y_offset &&
-                    old_client_rect.left    - client_rect->left   == x_offset &&
-                    old_client_rect.right   - client_rect->right  == x_offset &&
-                    old_client_rect.top     - client_rect->top    == y_offset &&
-                    old_client_rect.bottom  - client_rect->bottom == y_offset &&
-                    EqualRect( &valid_rects[0], client_rect ))
-                {
-                    rects[0] = visible_rect;
-                    rects[1] = old_visible_rect;
-                    valid_rects = rects;
-                }
-                move_window_bits_parent( hwnd, surface_win, window_rect, valid_rects );
-                valid_rects = NULL;  /* prevent the driver from trying to also move the bits */
-            }
-        }
-
-        user_driver->pWindowPosChanged( hwnd, insert_after, swp_flags, window_rect,
-                                        client_rect, &visible_rect, valid_rects, new_surface );
-    }
-    else if (new_surface) window_surface_release( new_surface );
-
+    if (ret) ret = update_window_pos( &data, new_style, new_ex_style );
+    finish_window_pos( &data, ret );
     return ret;
 }
 
@@ -3434,15 +3603,35 @@ done:
     return after;
 }
 
-/* NtUserSetWindowPos implementation */
-BOOL set_window_pos( WINDOWPOS *winpos, int parent_x, int parent_y )
+/* state of a SetWindowPos call, split in steps so that DeferWindowPos can batch them */
+struct window_pos_change
 {
-    RECT old_window_rect, old_client_rect, new_window_rect, new_client_rect, valid_rects[2];
-    UINT orig_flags;
-    BOOL ret = FALSE;
+    WINDOWPOS             *winpos;
+    UINT                   orig_flags;
+    DPI_AWARENESS_CONTEXT  context;          /* DPI awareness context of the window */
+    RECT                   new_window_rect;
+    RECT                   new_client_rect;
+    RECT                   valid_rects[2];
+    struct window_pos_data data;
+};
+
+/***********************************************************************
+ *           begin_window_pos
+ *
+ * First step of set_window_pos: validate the parameters, send WM_WINDOWPOSCHANGING
+ * and compute the new window rectangles.
+ * Returns FALSE if there is nothing more to do, with the final result in *ret.
+ */
+static BOOL begin_window_pos( struct window_pos_change *change, WINDOWPOS *winpos,
+                              int parent_x, int parent_y, BOOL *ret )
+{
+    RECT old_window_rect, old_client_rect;
     DPI_AWARENESS_CONTEXT context;
+    BOOL res = FALSE;
 
-    orig_flags = winpos->flags;
+    change->winpos = winpos;
+    change->orig_flags = winpos->flags;
+    *ret = FALSE;
 
     /* First, check z-order arguments.  */
     if (!(winpos->flags & SWP_NOZORDER))
@@ -3461,7 +3650,11 @@ BOOL set_window_pos( WINDOWPOS *winpos, int parent_x, int parent_y )
 
             /* hwndInsertAfter must be a sibling of the window */
             if (!insertafter_parent) return FALSE;
-            if (insertafter_parent != parent) return TRUE;
+            if (insertafter_parent != parent)
+            {
+                *ret = TRUE;
+                return FALSE;
+            }
         }
     }
 
@@ -3481,10 +3674,11 @@ BOOL set_window_pos( WINDOWPOS *winpos, int parent_x, int parent_y )
         else if (winpos->cy > 32767) winpos->cy = 32767;
     }
 
-    context = SetThreadDpiAwarenessContext( get_window_dpi_awareness_context( winpos->hwnd ));
+    change->context = get_window_dpi_awareness_context( winpos->hwnd );
+    context = SetThreadDpiAwarenessContext( change->context );
 
     if (!calc_winpos( winpos, &old_window_rect, &old_client_rect,
-                      &new_window_rect, &new_client_rect )) goto done;
+                      &change->new_window_rect, &change->new_client_rect )) goto done;
 
     /* Fix redundant flags */
     if (!fixup_swp_flags( winpos, &old_window_rect, parent_x, parent_y )) goto done;
@@ -3497,12 +3691,24 @@ BOOL set_window_pos( WINDOWPOS *winpos, int parent_x, int parent_y )
 
     /* Common operations */
 
-    calc_ncsize( winpos, &old_window_rect, &old_client_rect,
-                 &new_window_rect, &new_client_rect, valid_rects, parent_x, parent_y );
+    calc_ncsize( winpos, &old_window_rect, &old_client_rect, &change->new_window_rect,
+                 &change->new_client_rect, change->valid_rects, parent_x, parent_y );
+    res = TRUE;
 
-    if (!apply_window_pos( winpos->hwnd, winpos->hwndInsertAfter, winpos->flags,
-                           &new_window_rect, &new_client_rect, valid_rects ))
-        goto done;
+done:
+    SetThreadDpiAwarenessContext( context );
+    return res;
+}
+
+/***********************************************************************
+ *           end_window_pos
+ *
+ * Last step of set_window_pos, once the new position has been applied.
+ */
+static void end_window_pos( struct window_pos_change *change )
+{
+    WINDOWPOS *winpos = change->winpos;
+    UINT orig_flags = change->orig_flags;
 
     if (winpos->flags & SWP_HIDEWINDOW)
     {
@@ -3556,22 +3762,139 @@ BOOL set_window_pos( WINDOWPOS *winpos, int parent_x, int parent_y )
         /* WM_WINDOWPOSCHANGED is sent even if SWP_NOSENDCHANGING is set
            and always contains final window position.
          */
-        winpos->x  = new_window_rect.left;
-        winpos->y  = new_window_rect.top;
-        winpos->cx = new_window_rect.right - new_window_rect.left;
-        winpos->cy = new_window_rect.bottom - new_window_rect.top;
+        winpos->x  = change->new_window_rect.left;
+        winpos->y  = change->new_window_rect.top;
+        winpos->cx = change->new_window_rect.right - change->new_window_rect.left;
+        winpos->cy = change->new_window_rect.bottom - change->new_window_rect.top;
         send_message( winpos->hwnd, WM_WINDOWPOSCHANGED, 0, (LPARAM)winpos );
     }
 
     if ((winpos->flags & (SWP_NOMOVE|SWP_NOSIZE)) != (SWP_NOMOVE|SWP_NOSIZE))
         NtUserNotifyWinEvent( EVENT_OBJECT_LOCATIONCHANGE, winpos->hwnd, OBJID_WINDOW, 0 );
+}
 
-    ret = TRUE;
-done:
+/* NtUserSetWindowPos implementation */
+BOOL set_window_pos( WINDOWPOS *winpos, int parent_x, int parent_y )
+{
+    struct window_pos_change change;
+    DPI_AWARENESS_CONTEXT context;
+    BOOL ret;
+
+    if (!begin_window_pos( &change, winpos, parent_x, parent_y, &ret )) return ret;
+
+    context = SetThreadDpiAwarenessContext( change.context );
+    if ((ret = apply_window_pos( winpos->hwnd, winpos->hwndInsertAfter, winpos->flags,
+                                 &change.new_window_rect, &change.new_client_rect, change.valid_rects )))
+        end_window_pos( &change );
     SetThreadDpiAwarenessContext( context );
     return ret;
 }
 
+/***********************************************************************
+ *           set_window_pos_batch
+ *
+ * Apply the position changes of several windows of the current thread with a
+ * single server request, so that the server recomputes the exposed areas once.
+ * All the windows get WM_WINDOWPOSCHANGING before any of them is moved.
+ */
+static void set_window_pos_batch( WINDOWPOS *winpos, UINT count )
+{
+    struct window_pos_change *changes;
+    struct set_window_pos_entry *entries;
+    struct set_window_pos_result *results;
+    DPI_AWARENESS_CONTEXT context;
+    UINT i, n = 0;
+    BOOL ret;
+
+    changes = malloc( count * sizeof(*changes) );
+    entries = malloc( count * sizeof(*entries) );
+    results = malloc( count * sizeof(*results) );
+    if (count == 1 || !changes || !entries || !results)
+    {
+        for (i = 0; i < count; i++) set_window_pos( &winpos[i], 0, 0 );
+        goto done;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        struct window_pos_change *change = &changes[n];
+        struct set_window_pos_entry *entry = &entries[n];
+        struct window_pos_data *data = &change->data;
+
+        if (!begin_window_pos( change, &winpos[i], 0, 0, &ret )) continue;
+
+        context = SetThreadDpiAwarenessContext( change->context );
+        ret = prepare_window_pos( data, winpos[i].hwnd, winpos[i].hwndInsertAfter, winpos[i].flags,
+                                  &change->new_window_rect, &change->new_client_rect, change->valid_rects );
+        SetThreadDpiAwarenessContext( context );
+        if (!ret) continue;
+
+        entry->handle      = wine_server_user_handle( data->hwnd );
+        entry->previous    = wine_server_user_handle( data->insert_after );
+        entry->swp_flags   = data->swp_flags;
+        entry->paint_flags = data->paint_flags;
+        entry->window.left   = data->window_rect.left;
+        entry->window.top    = data->window_rect.top;
+        entry->window.right  = data->window_rect.right;
+        entry->window.bottom = data->window_rect.bottom;
+        entry->client.left   = data->client_rect.left;
+        entry->client.top    = data->client_rect.top;
+        entry->client.right  = data->client_rect.right;
+        entry->client.bottom = data->client_rect.bottom;
+        entry->visible.left   = data->visible_rect.left;
+        entry->visible.top    = data->visible_rect.top;
+        entry->visible.right  = data->visible_rect.right;
+        entry->visible.bottom = data->visible_rect.bottom;
+        entry->surface = entry->visible;
+        if (data->new_surface)
+        {
+            entry->surface.left   = data->visible_rect.left + data->new_surface->rect.left;
+            entry->surface.top    = data->visible_rect.top + data->new_surface->rect.top;
+            entry->surface.right  = data->visible_rect.left + data->new_surface->rect.right;
+            entry->surface.bottom = data->visible_rect.top + data->new_surface->rect.bottom;
+        }
+        entry->valid.left   = data->valid_rects[0].left;
+        entry->valid.top    = data->valid_rects[0].top;
+        entry->valid.right  = data->valid_rects[0].right;
+        entry->valid.bottom = data->valid_rects[0].bottom;
+        n++;
+    }
+    if (!n) goto done;
+
+    SERVER_START_REQ( set_window_pos_batch )
+    {
+        wine_server_add_data( req, entries, n * sizeof(*entries) );
+        wine_server_set_reply( req, results, n * sizeof(*results) );
+        if (wine_server_call( req ))
+        {
+            for (i = 0; i < n; i++) results[i].status = STATUS_UNSUCCESSFUL;
+        }
+    }
+    SERVER_END_REQ;
+
+    for (i = 0; i < n; i++)
+    {
+        struct window_pos_change *change = &changes[i];
+        struct window_pos_data *data = &change->data;
+
+        context = SetThreadDpiAwarenessContext( change->context );
+        if ((ret = !results[i].status))
+        {
+            data->surface_win  = wine_server_ptr_handle( results[i].surface_win );
+            data->needs_update = results[i].needs_update;
+            ret = update_window_pos( data, results[i].new_style, results[i].new_ex_style );
+        }
+        finish_window_pos( data, ret );
+        if (ret) end_window_pos( change );
+        SetThreadDpiAwarenessContext( context );
+    }
+
+done:
+    free( changes );
+    free( entries );
+    free( results );
+}
+
 /*******************************************************************
  *           NtUserSetWindowPos (win32u.@)
  */
@@ -3732,6 +4055,21 @@ done:
     return retvalue;
 }
 
+/* check if one of the ancestors of a child window is already part of a batch */
+static BOOL is_ancestor_in_batch( HWND hwnd, const WINDOWPOS *winpos, UINT count )
+{
+    HWND *list;
+    UINT i, j;
+    BOOL ret = FALSE;
+
+    if (!count || !(get_window_long( hwnd, GWL_STYLE ) & WS_CHILD)) return FALSE;
+    if (!(list = list_window_parents( hwnd ))) return FALSE;
+    for (i = 0; list[i] && !ret; i++)
+        for (j = 0; j < count && !ret; j++) ret = (winpos[j].hwnd == list[i]);
+    free( list );
+    return ret;
+}
+
 /***********************************************************************
  *           NtUserEndDeferWindowPosEx (win32u.@)
  */
@@ -3739,7 +4077,7 @@ BOOL WINAPI NtUserEndDeferWindowPosEx( HDWP hdwp, BOOL async )
 {
     WINDOWPOS *winpos;
     DWP *dwp;
-    int i;
+    int i, count;
 
     TRACE( "%p\n", hdwp );
 
@@ -3752,17 +4090,30 @@ BOOL WINAPI NtUserEndDeferWindowPosEx( HDWP hdwp, BOOL async )
         return FALSE;
     }
 
-    for (i = 0, winpos = dwp->winpos; i < dwp->count; i++, winpos++)
+    for (i = 0, count = 0, winpos = dwp->winpos; i < dwp->count; i++, winpos++)
     {
         TRACE( "hwnd %p, after %p, %d,%d (%dx%d), flags %08x\n",
                winpos->hwnd, winpos->hwndInsertAfter, winpos->x, winpos->y,
                winpos->cx, winpos->cy, winpos->flags );
 
+        /* consecutive windows of the current thread are moved together, the others by their
+         * own thread, so that the messages are still sent in the order of the batch */
         if (is_current_thread_window( winpos->hwnd ))
-            set_window_pos( winpos, 0, 0 );
-        else
-            send_message( winpos->hwnd, WM_WINE_SETWINDOWPOS, 0, (LPARAM)winpos );
+        {
+            /* a child is placed relative to the new position of its parent */
+            if (is_ancestor_in_batch( winpos->hwnd, dwp->winpos, count ))
+            {
+                set_window_pos_batch( dwp->winpos, count );
+                count = 0;
+            }
+            dwp->winpos[count++] = *winpos;
+            continue;
+        }
+        if (count) set_window_pos_batch( dwp->winpos, count );
+        count = 0;
+        send_message( winpos->hwnd, WM_WINE_SETWINDOWPOS, 0, (LPARAM)winpos );
     }
+    if (count) set_window_pos_batch( dwp->winpos, count );
     free( dwp->winpos );
     free( dwp );
     return TRUE;
@@ -743,6 +743,32 @@ const desktop_shm_t *get_desktop_shared_memory(void)
     return thread_info->desktop_shm;
 }
 
+/* map the server-maintained window table, shared by all processes */
+const window_shm_t *get_windows_shared_memory(void)
+{
+    static const WCHAR windows_mappingW[] =
+    {
+        '\\','K','e','r','n','e','l','O','b','j','e','c','t','s','\\',
+        '_','_','w','i','n','e','_','t','h','r','e','a','d','_','m','a','p','p','i','n','g','s','\\',
+        '_','_','w','i','n','e','_','w','i','n','d','o','w','s',0
+    };
+    static const window_shm_t *windows_shared;
+    const window_shm_t *ret;
+
+    __WINE_ATOMIC_LOAD_RELAXED( &windows_shared, &ret );
+    if (ret) return ret;
+
+    /* the table is created along with the first window, so don't cache failures */
+    if (!(ret = map_shared_memory_section( windows_mappingW, WINDOW_SHARED_ENTRIES * sizeof(*ret), NULL )))
+        return NULL;
+    if (InterlockedCompareExchangePointer( (void **)&windows_shared, (void *)ret, NULL ))
+    {
+        NtUnmapViewOfSection( GetCurrentProcess(), (void *)ret );
+        ret = windows_shared;
+    }
+    return ret;
+}
+
 const queue_shm_t *get_queue_shared_memory(void)
 {
     struct user_thread_info *thread_info = get_user_thread_info();
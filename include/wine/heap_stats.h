@@ -0,0 +1,54 @@
+/*
+ * Wine specific heap statistics
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#ifndef __WINE_WINE_HEAP_STATS_H
+#define __WINE_WINE_HEAP_STATS_H
+
+/* HeapQueryInformation returns a HEAP_WINE_STATISTICS structure */
+#define HeapWineStatistics ((HEAP_INFORMATION_CLASS)1000)
+
+typedef struct _HEAP_WINE_BIN_STATISTICS
+{
+    SIZE_T  BlockSize;
+    ULONG64 Allocations;
+    ULONG64 Frees;
+    BOOLEAN LfhEnabled;
+} HEAP_WINE_BIN_STATISTICS;
+
+typedef struct _HEAP_WINE_STATISTICS
+{
+    SIZE_T  ReservedSize;
+    SIZE_T  CommittedSize;
+    SIZE_T  FreeSize;
+    SIZE_T  LargestFreeSize;
+    SIZE_T  LargeBlocksSize;
+    ULONG   SubheapCount;
+    ULONG   FreeBlockCount;
+    ULONG   LargeBlockCount;
+    ULONG   BinCount;
+    ULONG64 LfhAllocations;
+    ULONG64 LfhFrees;
+    ULONG64 StandardAllocations;
+    ULONG64 StandardFrees;
+    ULONG64 LargeAllocations;
+    ULONG64 LargeFrees;
+    ULONG64 InPlaceReallocations;
+    HEAP_WINE_BIN_STATISTICS Bins[1];
+} HEAP_WINE_STATISTICS;
+
+#endif  /* __WINE_WINE_HEAP_STATS_H */
@@ -4023,6 +4023,9 @@ static inline HRESULT HRESULT_FROM_WIN32(unsigned int x)
 #define DXGI_ERROR_HW_PROTECTION_OUTOFMEMORY               _HRESULT_TYPEDEF_(0x887a0030)
 #define DXGI_ERROR_MODE_CHANGE_IN_PROGRESS                 _HRESULT_TYPEDEF_(0x887a0025)
 
+#define D3D12_ERROR_ADAPTER_NOT_FOUND                      _HRESULT_TYPEDEF_(0x887e0001)
+#define D3D12_ERROR_DRIVER_VERSION_MISMATCH                _HRESULT_TYPEDEF_(0x887e0002)
+
 #define DCOMPOSITION_ERROR_WINDOW_ALREADY_COMPOSED         _HRESULT_TYPEDEF_(0x88980800)
 #define DCOMPOSITION_ERROR_SURFACE_BEING_RENDERED          _HRESULT_TYPEDEF_(0x88980801)
 #define DCOMPOSITION_ERROR_SURFACE_NOT_BEING_RENDERED      _HRESULT_TYPEDEF_(0x88980802)
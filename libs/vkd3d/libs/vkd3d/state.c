@@ -21,6 +21,7 @@
 #include "vkd3d_private.h"
 #include "vkd3d_shaders.h"
 #include "vkd3d_shader_utils.h"
+#include "vkd3d_version.h"
 
 /* ID3D12RootSignature */
 static inline struct d3d12_root_signature *impl_from_ID3D12RootSignature(ID3D12RootSignature *iface)
@@ -1537,6 +1538,7 @@ HRESULT d3d12_root_signature_create(struct d3d12_device *device,
         vkd3d_free(object);
         return hr;
     }
+    object->hash = vkd3d_hash_data(VKD3D_HASH_INIT, bytecode, bytecode_length);
 
     TRACE("Created root signature %p.\n", object);
 
@@ -2005,6 +2007,15 @@ static void d3d12_pipeline_uav_counter_state_cleanup(struct d3d12_pipeline_uav_c
     vkd3d_free(uav_counters->bindings);
 }
 
+static void d3d12_pipeline_state_free_shaders(struct d3d12_pipeline_state *state)
+{
+    unsigned int i;
+
+    for (i = 0; i < state->shader_count; ++i)
+        vkd3d_shader_free_shader_code(&state->shaders[i].spirv);
+    state->shader_count = 0;
+}
+
 static ULONG STDMETHODCALLTYPE d3d12_pipeline_state_Release(ID3D12PipelineState *iface)
 {
     struct d3d12_pipeline_state *state = impl_from_ID3D12PipelineState(iface);
@@ -2025,7 +2036,10 @@ static ULONG STDMETHODCALLTYPE d3d12_pipeline_state_Release(ID3D12PipelineState
             VK_CALL(vkDestroyPipeline(device->vk_device, state->u.compute.vk_pipeline, NULL));
 
         d3d12_pipeline_uav_counter_state_cleanup(&state->uav_counters, device);
+        d3d12_pipeline_state_free_shaders(state);
 
+        if (state->library)
+            ID3D12PipelineLibrary1_Release(&state->library->ID3D12PipelineLibrary1_iface);
         vkd3d_free(state);
 
         d3d12_device_release(device);
@@ -2129,65 +2143,331 @@ static inline unsigned int typed_uav_compile_option(const struct d3d12_device *d
             : VKD3D_SHADER_COMPILE_OPTION_TYPED_UAV_READ_FORMAT_R32;
 }
 
-static HRESULT create_shader_stage(struct d3d12_device *device,
-        struct VkPipelineShaderStageCreateInfo *stage_desc, enum VkShaderStageFlagBits stage,
-        const D3D12_SHADER_BYTECODE *code, const struct vkd3d_shader_interface_info *shader_interface)
+static void vkd3d_shader_compile_job_run(struct vkd3d_shader_compile_job *job)
+{
+    if ((job->ret = vkd3d_shader_parse_dxbc_source_type(&job->compile_info.source,
+            &job->compile_info.source_type, NULL)) >= 0)
+        job->ret = vkd3d_shader_compile(&job->compile_info, &job->spirv, NULL);
+}
+
+static void *vkd3d_shader_compile_worker_main(void *arg)
+{
+    struct vkd3d_shader_compile_pool *pool = arg;
+    struct vkd3d_shader_compile_job *job;
+
+    vkd3d_set_thread_name("vkd3d_shader");
+
+    vkd3d_mutex_lock(&pool->mutex);
+
+    for (;;)
+    {
+        while (list_empty(&pool->jobs) && !pool->should_exit)
+            vkd3d_cond_wait(&pool->cond, &pool->mutex);
+
+        if (pool->should_exit)
+            break;
+
+        job = LIST_ENTRY(list_head(&pool->jobs), struct vkd3d_shader_compile_job, entry);
+        list_remove(&job->entry);
+        job->state = VKD3D_SHADER_COMPILE_JOB_RUNNING;
+        vkd3d_mutex_unlock(&pool->mutex);
+
+        vkd3d_shader_compile_job_run(job);
+
+        vkd3d_mutex_lock(&pool->mutex);
+        job->state = VKD3D_SHADER_COMPILE_JOB_DONE;
+        vkd3d_cond_broadcast(&pool->done_cond);
+    }
+
+    vkd3d_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+
+HRESULT vkd3d_shader_compile_pool_init(struct vkd3d_shader_compile_pool *pool, struct d3d12_device *device)
+{
+    vkd3d_mutex_init(&pool->mutex);
+    vkd3d_cond_init(&pool->cond);
+    vkd3d_cond_init(&pool->done_cond);
+    list_init(&pool->jobs);
+    pool->should_exit = false;
+    pool->thread_count = 0;
+    pool->threads_started = false;
+
+    return S_OK;
+}
+
+/* Called with the pool mutex held. The thread waiting for the jobs runs some
+ * of them itself, so one thread less than the CPU count is enough. */
+static void vkd3d_shader_compile_pool_start_threads(struct vkd3d_shader_compile_pool *pool,
+        struct d3d12_device *device)
+{
+    unsigned int i, count;
+    HRESULT hr;
+
+    pool->threads_started = true;
+
+    count = min(vkd3d_get_cpu_count() - 1, ARRAY_SIZE(pool->threads));
+    for (i = 0; i < count; ++i)
+    {
+        if (FAILED(hr = vkd3d_create_thread(device->vkd3d_instance,
+                vkd3d_shader_compile_worker_main, pool, &pool->threads[i])))
+        {
+            WARN("Failed to create shader compile thread, hr %#x.\n", hr);
+            break;
+        }
+        ++pool->thread_count;
+    }
+
+    TRACE("Started %u shader compile threads.\n", pool->thread_count);
+}
+
+void vkd3d_shader_compile_pool_cleanup(struct vkd3d_shader_compile_pool *pool, struct d3d12_device *device)
+{
+    unsigned int i;
+
+    vkd3d_mutex_lock(&pool->mutex);
+    pool->should_exit = true;
+    vkd3d_cond_broadcast(&pool->cond);
+    vkd3d_mutex_unlock(&pool->mutex);
+
+    for (i = 0; i < pool->thread_count; ++i)
+        vkd3d_join_thread(device->vkd3d_instance, &pool->threads[i]);
+
+    assert(list_empty(&pool->jobs));
+
+    vkd3d_cond_destroy(&pool->done_cond);
+    vkd3d_cond_destroy(&pool->cond);
+    vkd3d_mutex_destroy(&pool->mutex);
+}
+
+void vkd3d_shader_compile_pool_submit(struct vkd3d_shader_compile_pool *pool,
+        struct vkd3d_shader_compile_job *job, struct d3d12_device *device)
+{
+    vkd3d_mutex_lock(&pool->mutex);
+    if (!pool->threads_started)
+        vkd3d_shader_compile_pool_start_threads(pool, device);
+    job->state = VKD3D_SHADER_COMPILE_JOB_QUEUED;
+    list_add_tail(&pool->jobs, &job->entry);
+    vkd3d_cond_signal(&pool->cond);
+    vkd3d_mutex_unlock(&pool->mutex);
+}
+
+int vkd3d_shader_compile_pool_wait(struct vkd3d_shader_compile_pool *pool, struct vkd3d_shader_compile_job *job)
+{
+    vkd3d_mutex_lock(&pool->mutex);
+
+    /* Run the job on this thread rather than waiting for a worker to pick it up. */
+    if (job->state == VKD3D_SHADER_COMPILE_JOB_QUEUED)
+    {
+        list_remove(&job->entry);
+        job->state = VKD3D_SHADER_COMPILE_JOB_RUNNING;
+        vkd3d_mutex_unlock(&pool->mutex);
+
+        vkd3d_shader_compile_job_run(job);
+        job->state = VKD3D_SHADER_COMPILE_JOB_DONE;
+
+        return job->ret;
+    }
+
+    while (job->state != VKD3D_SHADER_COMPILE_JOB_DONE)
+        vkd3d_cond_wait(&pool->done_cond, &pool->mutex);
+
+    vkd3d_mutex_unlock(&pool->mutex);
+
+    return job->ret;
+}
+
+/* A named pipeline stored in an ID3D12PipelineLibrary. */
+struct d3d12_pipeline_library_entry
+{
+    struct rb_entry entry;
+    char *name;
+
+    VkPipelineBindPoint bind_point;
+    struct d3d12_pipeline_shader shaders[VKD3D_MAX_SHADER_STAGES];
+    unsigned int shader_count;
+};
+
+static const struct d3d12_pipeline_shader *d3d12_pipeline_library_entry_find_shader(
+        const struct d3d12_pipeline_library_entry *entry, VkShaderStageFlagBits stage, uint64_t key)
+{
+    unsigned int i;
+
+    for (i = 0; i < entry->shader_count; ++i)
+    {
+        if (entry->shaders[i].stage == stage && entry->shaders[i].key == key)
+            return &entry->shaders[i];
+    }
+
+    return NULL;
+}
+
+/* Translation of a single shader stage. The interface structures are owned
+ * by the stage, since the translation may run on a compile pool thread. */
+struct d3d12_shader_stage_compile
+{
+    struct vkd3d_shader_compile_job job;
+    struct vkd3d_shader_compile_option options[3];
+    enum VkShaderStageFlagBits stage;
+    uint64_t key;
+    bool submitted;
+
+    struct vkd3d_shader_interface_info shader_interface;
+    struct vkd3d_shader_spirv_target_info target_info;
+    struct vkd3d_shader_transform_feedback_info xfb_info;
+    struct vkd3d_shader_descriptor_offset_info offset_info;
+};
+
+/* If "cached" is not NULL, the SPIR-V is taken from the library entry instead
+ * of translating the DXBC, and the stage must match the stored one. Otherwise
+ * the translation is queued on the device compile pool if "async" is set, or
+ * done immediately. */
+static HRESULT d3d12_shader_stage_compile_begin(struct d3d12_device *device,
+        struct d3d12_shader_stage_compile *compile, enum VkShaderStageFlagBits stage,
+        const D3D12_SHADER_BYTECODE *code, const struct vkd3d_shader_interface_info *shader_interface,
+        uint64_t variant, const struct d3d12_pipeline_library_entry *cached, bool async)
+{
+    struct vkd3d_shader_compile_info *compile_info = &compile->job.compile_info;
+    const struct d3d12_pipeline_shader *cached_shader;
+    void *data;
+
+    compile->stage = stage;
+    compile->key = vkd3d_hash_data(variant, code->pShaderBytecode, code->BytecodeLength);
+    compile->submitted = false;
+    memset(&compile->job.spirv, 0, sizeof(compile->job.spirv));
+
+    if (cached)
+    {
+        if (!(cached_shader = d3d12_pipeline_library_entry_find_shader(cached, stage, compile->key)))
+        {
+            WARN("Shader stage %#x does not match the stored pipeline.\n", stage);
+            return E_INVALIDARG;
+        }
+
+        if (!(data = vkd3d_malloc(cached_shader->spirv.size)))
+            return E_OUTOFMEMORY;
+        memcpy(data, cached_shader->spirv.code, cached_shader->spirv.size);
+        compile->job.spirv.code = data;
+        compile->job.spirv.size = cached_shader->spirv.size;
+        compile->job.state = VKD3D_SHADER_COMPILE_JOB_DONE;
+        compile->job.ret = VKD3D_OK;
+        return S_OK;
+    }
+
+    compile->options[0].name = VKD3D_SHADER_COMPILE_OPTION_API_VERSION;
+    compile->options[0].value = VKD3D_SHADER_API_VERSION_1_10;
+    compile->options[1].name = VKD3D_SHADER_COMPILE_OPTION_TYPED_UAV;
+    compile->options[1].value = typed_uav_compile_option(device);
+    compile->options[2].name = VKD3D_SHADER_COMPILE_OPTION_WRITE_TESS_GEOM_POINT_SIZE;
+    compile->options[2].value = 0;
+
+    compile_info->type = VKD3D_SHADER_STRUCTURE_TYPE_COMPILE_INFO;
+    compile_info->next = shader_interface;
+    compile_info->source.code = code->pShaderBytecode;
+    compile_info->source.size = code->BytecodeLength;
+    compile_info->target_type = VKD3D_SHADER_TARGET_SPIRV_BINARY;
+    compile_info->options = compile->options;
+    compile_info->option_count = ARRAY_SIZE(compile->options);
+    compile_info->log_level = VKD3D_SHADER_LOG_NONE;
+    compile_info->source_name = NULL;
+
+    if (async)
+    {
+        vkd3d_shader_compile_pool_submit(&device->shader_compile_pool, &compile->job, device);
+        compile->submitted = true;
+    }
+    else
+    {
+        vkd3d_shader_compile_job_run(&compile->job);
+        compile->job.state = VKD3D_SHADER_COMPILE_JOB_DONE;
+    }
+
+    return S_OK;
+}
+
+/* The SPIR-V is kept in "state" if it is not NULL. */
+static HRESULT d3d12_shader_stage_compile_end(struct d3d12_device *device, struct d3d12_pipeline_state *state,
+        struct d3d12_shader_stage_compile *compile, struct VkPipelineShaderStageCreateInfo *stage_desc)
 {
     const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
-    struct vkd3d_shader_compile_info compile_info;
+    struct vkd3d_shader_code *spirv = &compile->job.spirv;
     struct VkShaderModuleCreateInfo shader_desc;
-    struct vkd3d_shader_code spirv = {0};
+    struct d3d12_pipeline_shader *shader;
     VkResult vr;
     int ret;
 
-    const struct vkd3d_shader_compile_option options[] =
+    if (compile->submitted)
     {
-        {VKD3D_SHADER_COMPILE_OPTION_API_VERSION, VKD3D_SHADER_API_VERSION_1_10},
-        {VKD3D_SHADER_COMPILE_OPTION_TYPED_UAV, typed_uav_compile_option(device)},
-        {VKD3D_SHADER_COMPILE_OPTION_WRITE_TESS_GEOM_POINT_SIZE, 0},
-    };
+        vkd3d_shader_compile_pool_wait(&device->shader_compile_pool, &compile->job);
+        compile->submitted = false;
+    }
+
+    if ((ret = compile->job.ret) < 0)
+    {
+        WARN("Failed to compile shader, vkd3d result %d.\n", ret);
+        return hresult_from_vkd3d_result(ret);
+    }
 
     stage_desc->sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage_desc->pNext = NULL;
     stage_desc->flags = 0;
-    stage_desc->stage = stage;
+    stage_desc->stage = compile->stage;
     stage_desc->pName = "main";
     stage_desc->pSpecializationInfo = NULL;
 
     shader_desc.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
     shader_desc.pNext = NULL;
     shader_desc.flags = 0;
-
-    compile_info.type = VKD3D_SHADER_STRUCTURE_TYPE_COMPILE_INFO;
-    compile_info.next = shader_interface;
-    compile_info.source.code = code->pShaderBytecode;
-    compile_info.source.size = code->BytecodeLength;
-    compile_info.target_type = VKD3D_SHADER_TARGET_SPIRV_BINARY;
-    compile_info.options = options;
-    compile_info.option_count = ARRAY_SIZE(options);
-    compile_info.log_level = VKD3D_SHADER_LOG_NONE;
-    compile_info.source_name = NULL;
-
-    if ((ret = vkd3d_shader_parse_dxbc_source_type(&compile_info.source, &compile_info.source_type, NULL)) < 0
-            || (ret = vkd3d_shader_compile(&compile_info, &spirv, NULL)) < 0)
-    {
-        WARN("Failed to compile shader, vkd3d result %d.\n", ret);
-        return hresult_from_vkd3d_result(ret);
-    }
-    shader_desc.codeSize = spirv.size;
-    shader_desc.pCode = spirv.code;
+    shader_desc.codeSize = spirv->size;
+    shader_desc.pCode = spirv->code;
 
     vr = VK_CALL(vkCreateShaderModule(device->vk_device, &shader_desc, NULL, &stage_desc->module));
-    vkd3d_shader_free_shader_code(&spirv);
     if (vr < 0)
     {
         WARN("Failed to create Vulkan shader module, vr %d.\n", vr);
+        vkd3d_shader_free_shader_code(spirv);
         return hresult_from_vk_result(vr);
     }
 
+    if (state)
+    {
+        shader = &state->shaders[state->shader_count++];
+        shader->stage = compile->stage;
+        shader->key = compile->key;
+        shader->spirv = *spirv;
+    }
+    else
+    {
+        vkd3d_shader_free_shader_code(spirv);
+    }
+
     return S_OK;
 }
 
+static void d3d12_shader_stage_compile_discard(struct d3d12_device *device,
+        struct d3d12_shader_stage_compile *compile)
+{
+    if (compile->submitted)
+        vkd3d_shader_compile_pool_wait(&device->shader_compile_pool, &compile->job);
+    vkd3d_shader_free_shader_code(&compile->job.spirv);
+}
+
+static HRESULT create_shader_stage(struct d3d12_device *device, struct d3d12_pipeline_state *state,
+        struct VkPipelineShaderStageCreateInfo *stage_desc, enum VkShaderStageFlagBits stage,
+        const D3D12_SHADER_BYTECODE *code, const struct vkd3d_shader_interface_info *shader_interface,
+        uint64_t variant, const struct d3d12_pipeline_library_entry *cached)
+{
+    struct d3d12_shader_stage_compile compile;
+    HRESULT hr;
+
+    if (FAILED(hr = d3d12_shader_stage_compile_begin(device, &compile, stage,
+            code, shader_interface, variant, cached, false)))
+        return hr;
+
+    return d3d12_shader_stage_compile_end(device, state, &compile, stage_desc);
+}
+
 static int vkd3d_scan_dxbc(const struct d3d12_device *device, const D3D12_SHADER_BYTECODE *code,
         struct vkd3d_shader_scan_descriptor_info *descriptor_info)
 {
@@ -2216,8 +2496,18 @@ static int vkd3d_scan_dxbc(const struct d3d12_device *device, const D3D12_SHADER
     return vkd3d_shader_scan(&compile_info, NULL);
 }
 
-static HRESULT vkd3d_create_compute_pipeline(struct d3d12_device *device,
+/* Pipelines loaded from a library are created from the library cache. */
+static VkPipelineCache d3d12_pipeline_state_get_vk_pipeline_cache(const struct d3d12_pipeline_state *state,
+        const struct d3d12_device *device)
+{
+    if (state && state->library && state->library->vk_pipeline_cache)
+        return state->library->vk_pipeline_cache;
+    return device->vk_pipeline_cache;
+}
+
+static HRESULT vkd3d_create_compute_pipeline(struct d3d12_device *device, struct d3d12_pipeline_state *state,
         const D3D12_SHADER_BYTECODE *code, const struct vkd3d_shader_interface_info *shader_interface,
+        uint64_t variant, const struct d3d12_pipeline_library_entry *cached,
         VkPipelineLayout vk_pipeline_layout, VkPipeline *vk_pipeline)
 {
     const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
@@ -2228,15 +2518,15 @@ static HRESULT vkd3d_create_compute_pipeline(struct d3d12_device *device,
     pipeline_info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
     pipeline_info.pNext = NULL;
     pipeline_info.flags = 0;
-    if (FAILED(hr = create_shader_stage(device, &pipeline_info.stage,
-            VK_SHADER_STAGE_COMPUTE_BIT, code, shader_interface)))
+    if (FAILED(hr = create_shader_stage(device, state, &pipeline_info.stage,
+            VK_SHADER_STAGE_COMPUTE_BIT, code, shader_interface, variant, cached)))
         return hr;
     pipeline_info.layout = vk_pipeline_layout;
     pipeline_info.basePipelineHandle = VK_NULL_HANDLE;
     pipeline_info.basePipelineIndex = -1;
 
     vr = VK_CALL(vkCreateComputePipelines(device->vk_device,
-            VK_NULL_HANDLE, 1, &pipeline_info, NULL, vk_pipeline));
+            d3d12_pipeline_state_get_vk_pipeline_cache(state, device), 1, &pipeline_info, NULL, vk_pipeline));
     VK_CALL(vkDestroyShaderModule(device->vk_device, pipeline_info.stage.module, NULL));
     if (vr < 0)
     {
@@ -2376,7 +2666,8 @@ static HRESULT d3d12_pipeline_state_find_and_init_uav_counters(struct d3d12_pipe
 }
 
 static HRESULT d3d12_pipeline_state_init_compute(struct d3d12_pipeline_state *state,
-        struct d3d12_device *device, const struct d3d12_pipeline_state_desc *desc)
+        struct d3d12_device *device, const struct d3d12_pipeline_state_desc *desc,
+        const struct d3d12_pipeline_library_entry *cached)
 {
     const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
     struct vkd3d_shader_interface_info shader_interface;
@@ -2388,6 +2679,7 @@ static HRESULT d3d12_pipeline_state_init_compute(struct d3d12_pipeline_state *st
 
     state->ID3D12PipelineState_iface.lpVtbl = &d3d12_pipeline_state_vtbl;
     state->refcount = 1;
+    state->shader_count = 0;
 
     memset(&state->uav_counters, 0, sizeof(state->uav_counters));
 
@@ -2439,11 +2731,12 @@ static HRESULT d3d12_pipeline_state_init_compute(struct d3d12_pipeline_state *st
 
     vk_pipeline_layout = state->uav_counters.vk_pipeline_layout
             ? state->uav_counters.vk_pipeline_layout : root_signature->vk_pipeline_layout;
-    if (FAILED(hr = vkd3d_create_compute_pipeline(device, &desc->cs, &shader_interface,
-            vk_pipeline_layout, &state->u.compute.vk_pipeline)))
+    if (FAILED(hr = vkd3d_create_compute_pipeline(device, state, &desc->cs, &shader_interface,
+            root_signature->hash, cached, vk_pipeline_layout, &state->u.compute.vk_pipeline)))
     {
         WARN("Failed to create Vulkan compute pipeline, hr %#x.\n", hr);
         d3d12_pipeline_uav_counter_state_cleanup(&state->uav_counters, device);
+        d3d12_pipeline_state_free_shaders(state);
         return hr;
     }
 
@@ -2451,6 +2744,7 @@ static HRESULT d3d12_pipeline_state_init_compute(struct d3d12_pipeline_state *st
     {
         VK_CALL(vkDestroyPipeline(device->vk_device, state->u.compute.vk_pipeline, NULL));
         d3d12_pipeline_uav_counter_state_cleanup(&state->uav_counters, device);
+        d3d12_pipeline_state_free_shaders(state);
         return hr;
     }
 
@@ -2472,7 +2766,7 @@ HRESULT d3d12_pipeline_state_create_compute(struct d3d12_device *device,
     if (!(object = vkd3d_malloc(sizeof(*object))))
         return E_OUTOFMEMORY;
 
-    if (FAILED(hr = d3d12_pipeline_state_init_compute(object, device, &pipeline_desc)))
+    if (FAILED(hr = d3d12_pipeline_state_init_compute(object, device, &pipeline_desc, NULL)))
     {
         vkd3d_free(object);
         return hr;
@@ -2923,8 +3217,39 @@ static VkLogicOp vk_logic_op_from_d3d12(D3D12_LOGIC_OP op)
     }
 }
 
+static uint64_t hash_stream_output_desc(uint64_t hash, const D3D12_STREAM_OUTPUT_DESC *desc)
+{
+    const D3D12_SO_DECLARATION_ENTRY *e;
+    unsigned int i;
+
+    for (i = 0; i < desc->NumEntries; ++i)
+    {
+        e = &desc->pSODeclaration[i];
+        hash = vkd3d_hash_data(hash, &e->Stream, sizeof(e->Stream));
+        if (e->SemanticName)
+            hash = vkd3d_hash_data(hash, e->SemanticName, strlen(e->SemanticName));
+        hash = vkd3d_hash_data(hash, &e->SemanticIndex, sizeof(e->SemanticIndex));
+        hash = vkd3d_hash_data(hash, &e->StartComponent, sizeof(e->StartComponent));
+        hash = vkd3d_hash_data(hash, &e->ComponentCount, sizeof(e->ComponentCount));
+        hash = vkd3d_hash_data(hash, &e->OutputSlot, sizeof(e->OutputSlot));
+    }
+    hash = vkd3d_hash_data(hash, desc->pBufferStrides, desc->NumStrides * sizeof(*desc->pBufferStrides));
+    return vkd3d_hash_data(hash, &desc->RasterizedStream, sizeof(desc->RasterizedStream));
+}
+
+static uint64_t hash_ps_target_info(uint64_t hash, const struct vkd3d_shader_spirv_target_info *info)
+{
+    unsigned int i;
+
+    for (i = 0; i < info->parameter_count; ++i)
+        hash = vkd3d_hash_data(hash, &info->parameters[i].u.immediate_constant.u.u32, sizeof(uint32_t));
+    hash = vkd3d_hash_data(hash, &info->dual_source_blending, sizeof(info->dual_source_blending));
+    return vkd3d_hash_data(hash, info->output_swizzles, info->output_swizzle_count * sizeof(*info->output_swizzles));
+}
+
 static HRESULT d3d12_pipeline_state_init_graphics(struct d3d12_pipeline_state *state,
-        struct d3d12_device *device, const struct d3d12_pipeline_state_desc *desc)
+        struct d3d12_device *device, const struct d3d12_pipeline_state_desc *desc,
+        const struct d3d12_pipeline_library_entry *cached)
 {
     unsigned int ps_output_swizzle[D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT];
     struct d3d12_graphics_pipeline_state *graphics = &state->u.graphics;
@@ -2933,8 +3258,11 @@ static HRESULT d3d12_pipeline_state_init_graphics(struct d3d12_pipeline_state *s
     VkVertexInputBindingDivisorDescriptionEXT *binding_divisor;
     const struct vkd3d_vulkan_info *vk_info = &device->vk_info;
     uint32_t instance_divisors[D3D12_VS_INPUT_REGISTER_COUNT];
+    struct d3d12_shader_stage_compile stage_compiles[VKD3D_MAX_SHADER_STAGES];
     struct vkd3d_shader_spirv_target_info *stage_target_info;
     uint32_t aligned_offsets[D3D12_VS_INPUT_REGISTER_COUNT];
+    struct d3d12_shader_stage_compile *compile;
+    unsigned int stage_compile_count = 0;
     struct vkd3d_shader_descriptor_offset_info offset_info;
     struct vkd3d_shader_parameter ps_shader_parameters[1];
     struct vkd3d_shader_transform_feedback_info xfb_info;
@@ -2949,6 +3277,7 @@ static HRESULT d3d12_pipeline_state_init_graphics(struct d3d12_pipeline_state *s
     const struct vkd3d_format *format;
     unsigned int instance_divisor;
     VkVertexInputRate input_rate;
+    uint64_t variant, xfb_variant = 0;
     unsigned int i, j;
     size_t rt_count;
     uint32_t mask;
@@ -2985,6 +3314,7 @@ static HRESULT d3d12_pipeline_state_init_graphics(struct d3d12_pipeline_state *s
 
     memset(&state->uav_counters, 0, sizeof(state->uav_counters));
     graphics->stage_count = 0;
+    state->shader_count = 0;
 
     memset(&input_signature, 0, sizeof(input_signature));
 
@@ -3108,8 +3438,8 @@ static HRESULT d3d12_pipeline_state_init_graphics(struct d3d12_pipeline_state *s
 
         if (!desc->ps.pShaderBytecode)
         {
-            if (FAILED(hr = create_shader_stage(device, &graphics->stages[graphics->stage_count],
-                    VK_SHADER_STAGE_FRAGMENT_BIT, &default_ps, NULL)))
+            if (FAILED(hr = create_shader_stage(device, state, &graphics->stages[graphics->stage_count],
+                    VK_SHADER_STAGE_FRAGMENT_BIT, &default_ps, NULL, VKD3D_HASH_INIT, cached)))
                 goto fail;
 
             ++graphics->stage_count;
@@ -3184,6 +3514,7 @@ static HRESULT d3d12_pipeline_state_init_graphics(struct d3d12_pipeline_state *s
         xfb_info.element_count = so_desc->NumEntries;
         xfb_info.buffer_strides = so_desc->pBufferStrides;
         xfb_info.buffer_stride_count = so_desc->NumStrides;
+        xfb_variant = hash_stream_output_desc(root_signature->hash, so_desc);
 
         if (desc->gs.pShaderBytecode)
             xfb_stage = VK_SHADER_STAGE_GEOMETRY_BIT;
@@ -3263,23 +3594,49 @@ static HRESULT d3d12_pipeline_state_init_graphics(struct d3d12_pipeline_state *s
                 goto fail;
         }
 
-        shader_interface.next = NULL;
-        xfb_info.next = NULL;
-        ps_target_info.next = NULL;
-        target_info.next = NULL;
-        offset_info.next = NULL;
+        compile = &stage_compiles[stage_compile_count];
+        compile->shader_interface = shader_interface;
+        compile->shader_interface.next = NULL;
+        variant = root_signature->hash;
         if (shader_stages[i].stage == xfb_stage)
-            vkd3d_prepend_struct(&shader_interface, &xfb_info);
-        vkd3d_prepend_struct(&shader_interface, stage_target_info);
+        {
+            compile->xfb_info = xfb_info;
+            compile->xfb_info.next = NULL;
+            vkd3d_prepend_struct(&compile->shader_interface, &compile->xfb_info);
+            variant = xfb_variant;
+        }
+        if (stage_target_info == &ps_target_info)
+            variant = hash_ps_target_info(variant, &ps_target_info);
+        compile->target_info = *stage_target_info;
+        compile->target_info.next = NULL;
+        vkd3d_prepend_struct(&compile->shader_interface, &compile->target_info);
         if (root_signature->descriptor_offsets)
-            vkd3d_prepend_struct(&shader_interface, &offset_info);
+        {
+            compile->offset_info = offset_info;
+            compile->offset_info.next = NULL;
+            vkd3d_prepend_struct(&compile->shader_interface, &compile->offset_info);
+        }
 
-        if (FAILED(hr = create_shader_stage(device, &graphics->stages[graphics->stage_count],
-                shader_stages[i].stage, b, &shader_interface)))
+        /* Translate the stages concurrently on the device compile pool. */
+        if (FAILED(hr = d3d12_shader_stage_compile_begin(device, compile, shader_stages[i].stage,
+                b, &compile->shader_interface, variant, cached, true)))
             goto fail;
 
-        ++graphics->stage_count;
+        ++stage_compile_count;
+    }
+
+    hr = S_OK;
+    for (i = 0; i < stage_compile_count; ++i)
+    {
+        if (FAILED(hr))
+            d3d12_shader_stage_compile_discard(device, &stage_compiles[i]);
+        else if (SUCCEEDED(hr = d3d12_shader_stage_compile_end(device, state,
+                &stage_compiles[i], &graphics->stages[graphics->stage_count])))
+            ++graphics->stage_count;
     }
+    stage_compile_count = 0;
+    if (FAILED(hr))
+        goto fail;
 
     graphics->attribute_count = desc->input_layout.NumElements;
     if (graphics->attribute_count > ARRAY_SIZE(graphics->attributes))
@@ -3457,6 +3814,8 @@ static HRESULT d3d12_pipeline_state_init_graphics(struct d3d12_pipeline_state *s
     return S_OK;
 
 fail:
+    for (i = 0; i < stage_compile_count; ++i)
+        d3d12_shader_stage_compile_discard(device, &stage_compiles[i]);
     for (i = 0; i < graphics->stage_count; ++i)
     {
         VK_CALL(vkDestroyShaderModule(device->vk_device, state->u.graphics.stages[i].module, NULL));
@@ -3464,6 +3823,7 @@ fail:
     vkd3d_shader_free_shader_signature(&input_signature);
 
     d3d12_pipeline_uav_counter_state_cleanup(&state->uav_counters, device);
+    d3d12_pipeline_state_free_shaders(state);
 
     return hr;
 }
@@ -3480,7 +3840,7 @@ HRESULT d3d12_pipeline_state_create_graphics(struct d3d12_device *device,
     if (!(object = vkd3d_malloc(sizeof(*object))))
         return E_OUTOFMEMORY;
 
-    if (FAILED(hr = d3d12_pipeline_state_init_graphics(object, device, &pipeline_desc)))
+    if (FAILED(hr = d3d12_pipeline_state_init_graphics(object, device, &pipeline_desc, NULL)))
     {
         vkd3d_free(object);
         return hr;
@@ -3493,28 +3853,27 @@ HRESULT d3d12_pipeline_state_create_graphics(struct d3d12_device *device,
     return S_OK;
 }
 
-HRESULT d3d12_pipeline_state_create(struct d3d12_device *device,
-        const D3D12_PIPELINE_STATE_STREAM_DESC *desc, struct d3d12_pipeline_state **state)
+/* If "cached" is not NULL, it is an entry of "library". */
+static HRESULT d3d12_pipeline_state_create_from_desc(struct d3d12_device *device,
+        const struct d3d12_pipeline_state_desc *desc, VkPipelineBindPoint bind_point,
+        struct d3d12_pipeline_library *library, const struct d3d12_pipeline_library_entry *cached,
+        struct d3d12_pipeline_state **state)
 {
-    struct d3d12_pipeline_state_desc pipeline_desc;
     struct d3d12_pipeline_state *object;
-    VkPipelineBindPoint bind_point;
     HRESULT hr;
 
-    if (FAILED(hr = pipeline_state_desc_from_d3d12_stream_desc(&pipeline_desc, desc, &bind_point)))
-        return hr;
-
     if (!(object = vkd3d_calloc(1, sizeof(*object))))
         return E_OUTOFMEMORY;
+    object->library = library;
 
     switch (bind_point)
     {
         case VK_PIPELINE_BIND_POINT_COMPUTE:
-            hr = d3d12_pipeline_state_init_compute(object, device, &pipeline_desc);
+            hr = d3d12_pipeline_state_init_compute(object, device, desc, cached);
             break;
 
         case VK_PIPELINE_BIND_POINT_GRAPHICS:
-            hr = d3d12_pipeline_state_init_graphics(object, device, &pipeline_desc);
+            hr = d3d12_pipeline_state_init_graphics(object, device, desc, cached);
             break;
 
         default:
@@ -3527,12 +3886,28 @@ HRESULT d3d12_pipeline_state_create(struct d3d12_device *device,
         return hr;
     }
 
+    if (library)
+        ID3D12PipelineLibrary1_AddRef(&library->ID3D12PipelineLibrary1_iface);
+
     TRACE("Created pipeline state %p.\n", object);
 
     *state = object;
     return S_OK;
 }
 
+HRESULT d3d12_pipeline_state_create(struct d3d12_device *device,
+        const D3D12_PIPELINE_STATE_STREAM_DESC *desc, struct d3d12_pipeline_state **state)
+{
+    struct d3d12_pipeline_state_desc pipeline_desc;
+    VkPipelineBindPoint bind_point;
+    HRESULT hr;
+
+    if (FAILED(hr = pipeline_state_desc_from_d3d12_stream_desc(&pipeline_desc, desc, &bind_point)))
+        return hr;
+
+    return d3d12_pipeline_state_create_from_desc(device, &pipeline_desc, bind_point, NULL, NULL, state);
+}
+
 static enum VkPrimitiveTopology vk_topology_from_d3d12_topology(D3D12_PRIMITIVE_TOPOLOGY topology)
 {
     switch (topology)
@@ -3830,8 +4205,8 @@ VkPipeline d3d12_pipeline_state_get_or_create_pipeline(struct d3d12_pipeline_sta
 
     *vk_render_pass = pipeline_desc.renderPass;
 
-    if ((vr = VK_CALL(vkCreateGraphicsPipelines(device->vk_device, device->vk_pipeline_cache,
-            1, &pipeline_desc, NULL, &vk_pipeline))) < 0)
+    if ((vr = VK_CALL(vkCreateGraphicsPipelines(device->vk_device,
+            d3d12_pipeline_state_get_vk_pipeline_cache(state, device), 1, &pipeline_desc, NULL, &vk_pipeline))) < 0)
     {
         WARN("Failed to create Vulkan graphics pipeline, vr %d.\n", vr);
         return VK_NULL_HANDLE;
@@ -3848,6 +4223,687 @@ VkPipeline d3d12_pipeline_state_get_or_create_pipeline(struct d3d12_pipeline_sta
     return vk_pipeline;
 }
 
+/* ID3D12PipelineLibrary */
+#define VKD3D_PIPELINE_LIBRARY_MAGIC VKD3D_MAKE_TAG('V', 'K', 'P', 'L')
+#define VKD3D_PIPELINE_LIBRARY_VERSION 1
+
+struct vkd3d_pipeline_library_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint32_t entry_count;
+    uint8_t cache_uuid[VK_UUID_SIZE];
+    uint64_t build_id;
+    uint64_t vk_cache_size;
+};
+
+struct vkd3d_pipeline_library_entry_header
+{
+    uint32_t name_size;
+    uint32_t bind_point;
+    uint32_t shader_count;
+    uint32_t padding;
+};
+
+struct vkd3d_pipeline_library_shader_header
+{
+    uint32_t stage;
+    uint32_t spirv_size;
+    uint64_t key;
+};
+
+static inline struct d3d12_pipeline_library *impl_from_ID3D12PipelineLibrary1(ID3D12PipelineLibrary1 *iface)
+{
+    return CONTAINING_RECORD(iface, struct d3d12_pipeline_library, ID3D12PipelineLibrary1_iface);
+}
+
+static int d3d12_pipeline_library_compare_entry(const void *key, const struct rb_entry *entry)
+{
+    return strcmp(key, RB_ENTRY_VALUE(entry, const struct d3d12_pipeline_library_entry, entry)->name);
+}
+
+static void d3d12_pipeline_library_entry_destroy(struct d3d12_pipeline_library_entry *entry)
+{
+    unsigned int i;
+
+    for (i = 0; i < entry->shader_count; ++i)
+        vkd3d_shader_free_shader_code(&entry->shaders[i].spirv);
+    vkd3d_free(entry->name);
+    vkd3d_free(entry);
+}
+
+static void d3d12_pipeline_library_destroy_entry(struct rb_entry *entry, void *context)
+{
+    d3d12_pipeline_library_entry_destroy(RB_ENTRY_VALUE(entry, struct d3d12_pipeline_library_entry, entry));
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_QueryInterface(ID3D12PipelineLibrary1 *iface,
+        REFIID riid, void **object)
+{
+    TRACE("iface %p, riid %s, object %p.\n", iface, debugstr_guid(riid), object);
+
+    if (IsEqualGUID(riid, &IID_ID3D12PipelineLibrary1)
+            || IsEqualGUID(riid, &IID_ID3D12PipelineLibrary)
+            || IsEqualGUID(riid, &IID_ID3D12DeviceChild)
+            || IsEqualGUID(riid, &IID_ID3D12Object)
+            || IsEqualGUID(riid, &IID_IUnknown))
+    {
+        ID3D12PipelineLibrary1_AddRef(iface);
+        *object = iface;
+        return S_OK;
+    }
+
+    WARN("%s not implemented, returning E_NOINTERFACE.\n", debugstr_guid(riid));
+
+    *object = NULL;
+    return E_NOINTERFACE;
+}
+
+static ULONG STDMETHODCALLTYPE d3d12_pipeline_library_AddRef(ID3D12PipelineLibrary1 *iface)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+    ULONG refcount = InterlockedIncrement(&library->refcount);
+
+    TRACE("%p increasing refcount to %u.\n", library, refcount);
+
+    return refcount;
+}
+
+static ULONG STDMETHODCALLTYPE d3d12_pipeline_library_Release(ID3D12PipelineLibrary1 *iface)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+    ULONG refcount = InterlockedDecrement(&library->refcount);
+
+    TRACE("%p decreasing refcount to %u.\n", library, refcount);
+
+    if (!refcount)
+    {
+        struct d3d12_device *device = library->device;
+        const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
+
+        vkd3d_private_store_destroy(&library->private_store);
+        rb_destroy(&library->entries, d3d12_pipeline_library_destroy_entry, NULL);
+        if (library->vk_pipeline_cache)
+            VK_CALL(vkDestroyPipelineCache(device->vk_device, library->vk_pipeline_cache, NULL));
+        vkd3d_mutex_destroy(&library->mutex);
+        vkd3d_free(library);
+
+        d3d12_device_release(device);
+    }
+
+    return refcount;
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_GetPrivateData(ID3D12PipelineLibrary1 *iface,
+        REFGUID guid, UINT *data_size, void *data)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+
+    TRACE("iface %p, guid %s, data_size %p, data %p.\n", iface, debugstr_guid(guid), data_size, data);
+
+    return vkd3d_get_private_data(&library->private_store, guid, data_size, data);
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_SetPrivateData(ID3D12PipelineLibrary1 *iface,
+        REFGUID guid, UINT data_size, const void *data)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+
+    TRACE("iface %p, guid %s, data_size %u, data %p.\n", iface, debugstr_guid(guid), data_size, data);
+
+    return vkd3d_set_private_data(&library->private_store, guid, data_size, data);
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_SetPrivateDataInterface(ID3D12PipelineLibrary1 *iface,
+        REFGUID guid, const IUnknown *data)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+
+    TRACE("iface %p, guid %s, data %p.\n", iface, debugstr_guid(guid), data);
+
+    return vkd3d_set_private_data_interface(&library->private_store, guid, data);
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_SetName(ID3D12PipelineLibrary1 *iface, const WCHAR *name)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+
+    TRACE("iface %p, name %s.\n", iface, debugstr_w(name, library->device->wchar_size));
+
+    return name ? S_OK : E_INVALIDARG;
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_GetDevice(ID3D12PipelineLibrary1 *iface,
+        REFIID iid, void **device)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+
+    TRACE("iface %p, iid %s, device %p.\n", iface, debugstr_guid(iid), device);
+
+    return d3d12_device_query_interface(library->device, iid, device);
+}
+
+static HRESULT d3d12_pipeline_library_add_entry(struct d3d12_pipeline_library *library,
+        struct d3d12_pipeline_library_entry *entry)
+{
+    vkd3d_mutex_lock(&library->mutex);
+    if (rb_put(&library->entries, entry->name, &entry->entry) == -1)
+    {
+        vkd3d_mutex_unlock(&library->mutex);
+        WARN("Pipeline %s already exists.\n", debugstr_a(entry->name));
+        return E_INVALIDARG;
+    }
+    ++library->entry_count;
+    vkd3d_mutex_unlock(&library->mutex);
+
+    return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_StorePipeline(ID3D12PipelineLibrary1 *iface,
+        const WCHAR *name, ID3D12PipelineState *pipeline)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+    struct d3d12_pipeline_library_entry *entry;
+    struct d3d12_pipeline_state *state;
+    unsigned int i;
+    void *code;
+    HRESULT hr;
+
+    TRACE("iface %p, name %s, pipeline %p.\n", iface, debugstr_w(name, library->device->wchar_size), pipeline);
+
+    if (!name || !(state = unsafe_impl_from_ID3D12PipelineState(pipeline)))
+        return E_INVALIDARG;
+
+    if (!(entry = vkd3d_calloc(1, sizeof(*entry))))
+        return E_OUTOFMEMORY;
+    if (!(entry->name = vkd3d_strdup_w_utf8(name, library->device->wchar_size)))
+    {
+        vkd3d_free(entry);
+        return E_OUTOFMEMORY;
+    }
+    entry->bind_point = state->vk_bind_point;
+
+    for (i = 0; i < state->shader_count; ++i)
+    {
+        if (!(code = vkd3d_malloc(state->shaders[i].spirv.size)))
+        {
+            d3d12_pipeline_library_entry_destroy(entry);
+            return E_OUTOFMEMORY;
+        }
+        memcpy(code, state->shaders[i].spirv.code, state->shaders[i].spirv.size);
+        entry->shaders[i].stage = state->shaders[i].stage;
+        entry->shaders[i].key = state->shaders[i].key;
+        entry->shaders[i].spirv.code = code;
+        entry->shaders[i].spirv.size = state->shaders[i].spirv.size;
+        ++entry->shader_count;
+    }
+
+    if (FAILED(hr = d3d12_pipeline_library_add_entry(library, entry)))
+        d3d12_pipeline_library_entry_destroy(entry);
+
+    return hr;
+}
+
+static HRESULT d3d12_pipeline_library_load_pipeline(struct d3d12_pipeline_library *library,
+        const WCHAR *name, const struct d3d12_pipeline_state_desc *desc, VkPipelineBindPoint bind_point,
+        REFIID iid, void **pipeline_state)
+{
+    const struct d3d12_pipeline_library_entry *entry = NULL;
+    struct d3d12_pipeline_state *object;
+    struct rb_entry *rb_entry;
+    char *utf8_name;
+    HRESULT hr;
+
+    if (!name)
+        return E_INVALIDARG;
+    if (!(utf8_name = vkd3d_strdup_w_utf8(name, library->device->wchar_size)))
+        return E_OUTOFMEMORY;
+
+    /* Entries are never removed, so they remain valid after unlocking. */
+    vkd3d_mutex_lock(&library->mutex);
+    if ((rb_entry = rb_get(&library->entries, utf8_name)))
+        entry = RB_ENTRY_VALUE(rb_entry, const struct d3d12_pipeline_library_entry, entry);
+    vkd3d_mutex_unlock(&library->mutex);
+    vkd3d_free(utf8_name);
+
+    if (!entry || entry->bind_point != bind_point)
+    {
+        WARN("Pipeline %s not found.\n", debugstr_w(name, library->device->wchar_size));
+        return E_INVALIDARG;
+    }
+
+    if (FAILED(hr = d3d12_pipeline_state_create_from_desc(library->device, desc, bind_point, library, entry, &object)))
+        return hr;
+
+    if (object->shader_count != entry->shader_count)
+    {
+        WARN("Shader stages do not match the stored pipeline.\n");
+        ID3D12PipelineState_Release(&object->ID3D12PipelineState_iface);
+        return E_INVALIDARG;
+    }
+
+    return return_interface(&object->ID3D12PipelineState_iface,
+            &IID_ID3D12PipelineState, iid, pipeline_state);
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_LoadGraphicsPipeline(ID3D12PipelineLibrary1 *iface,
+        const WCHAR *name, const D3D12_GRAPHICS_PIPELINE_STATE_DESC *desc, REFIID iid, void **pipeline_state)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+    struct d3d12_pipeline_state_desc pipeline_desc;
+
+    TRACE("iface %p, name %s, desc %p, iid %s, pipeline_state %p.\n", iface,
+            debugstr_w(name, library->device->wchar_size), desc, debugstr_guid(iid), pipeline_state);
+
+    pipeline_state_desc_from_d3d12_graphics_desc(&pipeline_desc, desc);
+
+    return d3d12_pipeline_library_load_pipeline(library, name, &pipeline_desc,
+            VK_PIPELINE_BIND_POINT_GRAPHICS, iid, pipeline_state);
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_LoadComputePipeline(ID3D12PipelineLibrary1 *iface,
+        const WCHAR *name, const D3D12_COMPUTE_PIPELINE_STATE_DESC *desc, REFIID iid, void **pipeline_state)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+    struct d3d12_pipeline_state_desc pipeline_desc;
+
+    TRACE("iface %p, name %s, desc %p, iid %s, pipeline_state %p.\n", iface,
+            debugstr_w(name, library->device->wchar_size), desc, debugstr_guid(iid), pipeline_state);
+
+    pipeline_state_desc_from_d3d12_compute_desc(&pipeline_desc, desc);
+
+    return d3d12_pipeline_library_load_pipeline(library, name, &pipeline_desc,
+            VK_PIPELINE_BIND_POINT_COMPUTE, iid, pipeline_state);
+}
+
+static size_t d3d12_pipeline_library_entry_get_serialized_size(const struct d3d12_pipeline_library_entry *entry)
+{
+    size_t size;
+    unsigned int i;
+
+    size = sizeof(struct vkd3d_pipeline_library_entry_header) + align(strlen(entry->name) + 1, 8);
+    for (i = 0; i < entry->shader_count; ++i)
+        size += sizeof(struct vkd3d_pipeline_library_shader_header) + align(entry->shaders[i].spirv.size, 8);
+
+    return size;
+}
+
+/* Called with the library mutex held. */
+static size_t d3d12_pipeline_library_get_entries_size(struct d3d12_pipeline_library *library)
+{
+    const struct d3d12_pipeline_library_entry *entry;
+    size_t size = 0;
+
+    RB_FOR_EACH_ENTRY(entry, &library->entries, const struct d3d12_pipeline_library_entry, entry)
+    {
+        size += d3d12_pipeline_library_entry_get_serialized_size(entry);
+    }
+
+    return size;
+}
+
+static VkPipelineCache d3d12_pipeline_library_create_vk_cache(struct d3d12_device *device,
+        const void *data, size_t size)
+{
+    const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
+    VkPipelineCacheCreateInfo cache_info;
+    VkPipelineCache vk_cache;
+    VkResult vr;
+
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.pNext = NULL;
+    cache_info.flags = 0;
+    cache_info.initialDataSize = size;
+    cache_info.pInitialData = data;
+    if ((vr = VK_CALL(vkCreatePipelineCache(device->vk_device, &cache_info, NULL, &vk_cache))) < 0)
+    {
+        WARN("Failed to create Vulkan pipeline cache, vr %d.\n", vr);
+        return VK_NULL_HANDLE;
+    }
+
+    return vk_cache;
+}
+
+/* Pipelines stored in the library may have been created from either the
+ * library or the device cache. Both are merged into a temporary cache, since
+ * vkMergePipelineCaches() requires exclusive access to its destination only.
+ * If "data" is NULL, only the size is returned. */
+static size_t d3d12_pipeline_library_get_vk_cache_data(struct d3d12_pipeline_library *library,
+        void *data, size_t size)
+{
+    struct d3d12_device *device = library->device;
+    const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
+    VkPipelineCache vk_caches[2], vk_cache;
+    unsigned int count = 0;
+    VkResult vr;
+
+    if (device->vk_pipeline_cache)
+        vk_caches[count++] = device->vk_pipeline_cache;
+    if (library->vk_pipeline_cache)
+        vk_caches[count++] = library->vk_pipeline_cache;
+    if (!count || !(vk_cache = d3d12_pipeline_library_create_vk_cache(device, NULL, 0)))
+        return 0;
+
+    if ((vr = VK_CALL(vkMergePipelineCaches(device->vk_device, vk_cache, count, vk_caches))) < 0
+            || (vr = VK_CALL(vkGetPipelineCacheData(device->vk_device, vk_cache, &size, data))) < 0)
+    {
+        WARN("Failed to get pipeline cache data, vr %d.\n", vr);
+        size = 0;
+    }
+    VK_CALL(vkDestroyPipelineCache(device->vk_device, vk_cache, NULL));
+
+    return size;
+}
+
+static SIZE_T STDMETHODCALLTYPE d3d12_pipeline_library_GetSerializedSize(ID3D12PipelineLibrary1 *iface)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+    size_t size;
+
+    TRACE("iface %p.\n", iface);
+
+    vkd3d_mutex_lock(&library->mutex);
+    size = sizeof(struct vkd3d_pipeline_library_header) + d3d12_pipeline_library_get_entries_size(library);
+    vkd3d_mutex_unlock(&library->mutex);
+
+    return size + d3d12_pipeline_library_get_vk_cache_data(library, NULL, 0);
+}
+
+static void d3d12_pipeline_library_get_device_info(struct d3d12_device *device,
+        struct vkd3d_pipeline_library_header *header)
+{
+    const struct vkd3d_vk_instance_procs *vk_procs = &device->vkd3d_instance->vk_procs;
+    static const char build[] = PACKAGE_STRING VKD3D_VCS_ID;
+    VkPhysicalDeviceProperties properties;
+
+    VK_CALL(vkGetPhysicalDeviceProperties(device->vk_physical_device, &properties));
+
+    memset(header, 0, sizeof(*header));
+    header->magic = VKD3D_PIPELINE_LIBRARY_MAGIC;
+    header->version = VKD3D_PIPELINE_LIBRARY_VERSION;
+    header->vendor_id = properties.vendorID;
+    header->device_id = properties.deviceID;
+    header->driver_version = properties.driverVersion;
+    memcpy(header->cache_uuid, properties.pipelineCacheUUID, sizeof(header->cache_uuid));
+    header->build_id = vkd3d_hash_data(VKD3D_HASH_INIT, build, sizeof(build));
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_Serialize(ID3D12PipelineLibrary1 *iface,
+        void *data, SIZE_T data_size)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+    struct vkd3d_pipeline_library_shader_header *shader_header;
+    struct vkd3d_pipeline_library_entry_header *entry_header;
+    const struct d3d12_pipeline_library_entry *entry;
+    struct vkd3d_pipeline_library_header *header;
+    size_t size, name_size;
+    uint8_t *ptr = data;
+    unsigned int i;
+
+    TRACE("iface %p, data %p, data_size %lu.\n", iface, data, data_size);
+
+    vkd3d_mutex_lock(&library->mutex);
+
+    size = sizeof(*header) + d3d12_pipeline_library_get_entries_size(library);
+    if (data_size < size)
+    {
+        vkd3d_mutex_unlock(&library->mutex);
+        WARN("Data size %lu is too small, %zu bytes are needed.\n", data_size, size);
+        return E_INVALIDARG;
+    }
+
+    memset(data, 0, size);
+    header = data;
+    d3d12_pipeline_library_get_device_info(library->device, header);
+    header->entry_count = library->entry_count;
+    ptr += sizeof(*header);
+
+    RB_FOR_EACH_ENTRY(entry, &library->entries, const struct d3d12_pipeline_library_entry, entry)
+    {
+        name_size = strlen(entry->name) + 1;
+        entry_header = (void *)ptr;
+        entry_header->name_size = name_size;
+        entry_header->bind_point = entry->bind_point;
+        entry_header->shader_count = entry->shader_count;
+        ptr += sizeof(*entry_header);
+        memcpy(ptr, entry->name, name_size);
+        ptr += align(name_size, 8);
+
+        for (i = 0; i < entry->shader_count; ++i)
+        {
+            shader_header = (void *)ptr;
+            shader_header->stage = entry->shaders[i].stage;
+            shader_header->spirv_size = entry->shaders[i].spirv.size;
+            shader_header->key = entry->shaders[i].key;
+            ptr += sizeof(*shader_header);
+            memcpy(ptr, entry->shaders[i].spirv.code, entry->shaders[i].spirv.size);
+            ptr += align(entry->shaders[i].spirv.size, 8);
+        }
+    }
+
+    vkd3d_mutex_unlock(&library->mutex);
+
+    /* The Vulkan cache may have grown since GetSerializedSize(). A truncated
+     * cache is still valid initial data. */
+    if (data_size > size)
+        header->vk_cache_size = d3d12_pipeline_library_get_vk_cache_data(library, ptr, data_size - size);
+
+    return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE d3d12_pipeline_library_LoadPipeline(ID3D12PipelineLibrary1 *iface,
+        const WCHAR *name, const D3D12_PIPELINE_STATE_STREAM_DESC *desc, REFIID iid, void **pipeline_state)
+{
+    struct d3d12_pipeline_library *library = impl_from_ID3D12PipelineLibrary1(iface);
+    struct d3d12_pipeline_state_desc pipeline_desc;
+    VkPipelineBindPoint bind_point;
+    HRESULT hr;
+
+    TRACE("iface %p, name %s, desc %p, iid %s, pipeline_state %p.\n", iface,
+            debugstr_w(name, library->device->wchar_size), desc, debugstr_guid(iid), pipeline_state);
+
+    if (FAILED(hr = pipeline_state_desc_from_d3d12_stream_desc(&pipeline_desc, desc, &bind_point)))
+        return hr;
+
+    return d3d12_pipeline_library_load_pipeline(library, name, &pipeline_desc,
+            bind_point, iid, pipeline_state);
+}
+
+static const struct ID3D12PipelineLibrary1Vtbl d3d12_pipeline_library_vtbl =
+{
+    /* IUnknown methods */
+    d3d12_pipeline_library_QueryInterface,
+    d3d12_pipeline_library_AddRef,
+    d3d12_pipeline_library_Release,
+    /* ID3D12Object methods */
+    d3d12_pipeline_library_GetPrivateData,
+    d3d12_pipeline_library_SetPrivateData,
+    d3d12_pipeline_library_SetPrivateDataInterface,
+    d3d12_pipeline_library_SetName,
+    /* ID3D12DeviceChild methods */
+    d3d12_pipeline_library_GetDevice,
+    /* ID3D12PipelineLibrary methods */
+    d3d12_pipeline_library_StorePipeline,
+    d3d12_pipeline_library_LoadGraphicsPipeline,
+    d3d12_pipeline_library_LoadComputePipeline,
+    d3d12_pipeline_library_GetSerializedSize,
+    d3d12_pipeline_library_Serialize,
+    /* ID3D12PipelineLibrary1 methods */
+    d3d12_pipeline_library_LoadPipeline,
+};
+
+static HRESULT d3d12_pipeline_library_read_entry(struct d3d12_pipeline_library *library,
+        const uint8_t **ptr, const uint8_t *end)
+{
+    const struct vkd3d_pipeline_library_shader_header *shader_header;
+    const struct vkd3d_pipeline_library_entry_header *entry_header;
+    struct d3d12_pipeline_library_entry *entry;
+    unsigned int i;
+    void *code;
+    HRESULT hr;
+
+    if (end - *ptr < sizeof(*entry_header))
+        return E_INVALIDARG;
+    entry_header = (const void *)*ptr;
+    *ptr += sizeof(*entry_header);
+
+    if (!entry_header->name_size || end - *ptr < align(entry_header->name_size, 8)
+            || (*ptr)[entry_header->name_size - 1]
+            || entry_header->shader_count > VKD3D_MAX_SHADER_STAGES
+            || (entry_header->bind_point != VK_PIPELINE_BIND_POINT_GRAPHICS
+            && entry_header->bind_point != VK_PIPELINE_BIND_POINT_COMPUTE))
+        return E_INVALIDARG;
+
+    if (!(entry = vkd3d_calloc(1, sizeof(*entry))))
+        return E_OUTOFMEMORY;
+    if (!(entry->name = vkd3d_strdup((const char *)*ptr)))
+    {
+        vkd3d_free(entry);
+        return E_OUTOFMEMORY;
+    }
+    entry->bind_point = entry_header->bind_point;
+    *ptr += align(entry_header->name_size, 8);
+
+    for (i = 0; i < entry_header->shader_count; ++i)
+    {
+        if (end - *ptr < sizeof(*shader_header))
+        {
+            d3d12_pipeline_library_entry_destroy(entry);
+            return E_INVALIDARG;
+        }
+        shader_header = (const void *)*ptr;
+        *ptr += sizeof(*shader_header);
+
+        if (end - *ptr < align(shader_header->spirv_size, 8))
+        {
+            d3d12_pipeline_library_entry_destroy(entry);
+            return E_INVALIDARG;
+        }
+        if (!(code = vkd3d_malloc(shader_header->spirv_size)))
+        {
+            d3d12_pipeline_library_entry_destroy(entry);
+            return E_OUTOFMEMORY;
+        }
+        memcpy(code, *ptr, shader_header->spirv_size);
+        *ptr += align(shader_header->spirv_size, 8);
+
+        entry->shaders[i].stage = shader_header->stage;
+        entry->shaders[i].key = shader_header->key;
+        entry->shaders[i].spirv.code = code;
+        entry->shaders[i].spirv.size = shader_header->spirv_size;
+        ++entry->shader_count;
+    }
+
+    if (FAILED(hr = d3d12_pipeline_library_add_entry(library, entry)))
+        d3d12_pipeline_library_entry_destroy(entry);
+
+    return hr;
+}
+
+static HRESULT d3d12_pipeline_library_read_blob(struct d3d12_pipeline_library *library,
+        const void *blob, size_t blob_size)
+{
+    const struct vkd3d_pipeline_library_header *header = blob;
+    struct vkd3d_pipeline_library_header expected;
+    const uint8_t *ptr, *end;
+    unsigned int i;
+    HRESULT hr;
+
+    if (blob_size < sizeof(*header) || header->magic != VKD3D_PIPELINE_LIBRARY_MAGIC)
+    {
+        WARN("Invalid pipeline library blob.\n");
+        return E_INVALIDARG;
+    }
+
+    d3d12_pipeline_library_get_device_info(library->device, &expected);
+    if (header->vendor_id != expected.vendor_id || header->device_id != expected.device_id)
+    {
+        WARN("Pipeline library was created for device %04x:%04x.\n", header->vendor_id, header->device_id);
+        return D3D12_ERROR_ADAPTER_NOT_FOUND;
+    }
+    if (header->version != expected.version || header->driver_version != expected.driver_version
+            || header->build_id != expected.build_id
+            || memcmp(header->cache_uuid, expected.cache_uuid, sizeof(header->cache_uuid)))
+    {
+        WARN("Pipeline library was created by a different driver or vkd3d version.\n");
+        return D3D12_ERROR_DRIVER_VERSION_MISMATCH;
+    }
+
+    ptr = (const uint8_t *)blob + sizeof(*header);
+    end = (const uint8_t *)blob + blob_size;
+    for (i = 0; i < header->entry_count; ++i)
+    {
+        if (FAILED(hr = d3d12_pipeline_library_read_entry(library, &ptr, end)))
+        {
+            WARN("Failed to read pipeline library entry %u, hr %#x.\n", i, hr);
+            return hr;
+        }
+    }
+
+    if (header->vk_cache_size > end - ptr)
+    {
+        WARN("Invalid Vulkan pipeline cache size %"PRIu64".\n", header->vk_cache_size);
+        return E_INVALIDARG;
+    }
+    if (header->vk_cache_size)
+        library->vk_pipeline_cache = d3d12_pipeline_library_create_vk_cache(library->device,
+                ptr, header->vk_cache_size);
+
+    TRACE("Loaded %u pipelines and %"PRIu64" bytes of Vulkan pipeline cache.\n",
+            header->entry_count, header->vk_cache_size);
+
+    return S_OK;
+}
+
+HRESULT d3d12_pipeline_library_create(struct d3d12_device *device, const void *blob,
+        size_t blob_size, struct d3d12_pipeline_library **library)
+{
+    struct d3d12_pipeline_library *object;
+    HRESULT hr;
+
+    if (!(object = vkd3d_malloc(sizeof(*object))))
+        return E_OUTOFMEMORY;
+
+    object->ID3D12PipelineLibrary1_iface.lpVtbl = &d3d12_pipeline_library_vtbl;
+    object->refcount = 1;
+    vkd3d_mutex_init(&object->mutex);
+    rb_init(&object->entries, d3d12_pipeline_library_compare_entry);
+    object->entry_count = 0;
+    object->vk_pipeline_cache = VK_NULL_HANDLE;
+    object->device = device;
+
+    if (FAILED(hr = vkd3d_private_store_init(&object->private_store)))
+    {
+        vkd3d_mutex_destroy(&object->mutex);
+        vkd3d_free(object);
+        return hr;
+    }
+
+    if (blob_size && FAILED(hr = d3d12_pipeline_library_read_blob(object, blob, blob_size)))
+    {
+        const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
+
+        if (object->vk_pipeline_cache)
+            VK_CALL(vkDestroyPipelineCache(device->vk_device, object->vk_pipeline_cache, NULL));
+        vkd3d_private_store_destroy(&object->private_store);
+        rb_destroy(&object->entries, d3d12_pipeline_library_destroy_entry, NULL);
+        vkd3d_mutex_destroy(&object->mutex);
+        vkd3d_free(object);
+        return hr;
+    }
+
+    d3d12_device_add_ref(device);
+
+    TRACE("Created pipeline library %p.\n", object);
+
+    *library = object;
+
+    return S_OK;
+}
+
 static int compile_hlsl_cs(const struct vkd3d_shader_code *hlsl, struct vkd3d_shader_code *dxbc)
 {
     struct vkd3d_shader_hlsl_source_info hlsl_info;
@@ -4036,8 +5092,8 @@ HRESULT vkd3d_uav_clear_state_init(struct vkd3d_uav_clear_state *state, struct d
         else
             binding.flags = VKD3D_SHADER_BINDING_FLAG_IMAGE;
 
-        hr = vkd3d_create_compute_pipeline(device, &(D3D12_SHADER_BYTECODE){dxbc.code, dxbc.size},
-                &shader_interface, *pipelines[i].pipeline_layout, pipelines[i].pipeline);
+        hr = vkd3d_create_compute_pipeline(device, NULL, &(D3D12_SHADER_BYTECODE){dxbc.code, dxbc.size},
+                &shader_interface, 0, NULL, *pipelines[i].pipeline_layout, pipelines[i].pipeline);
         vkd3d_shader_free_shader_code(&dxbc);
         if (FAILED(hr))
         {
@@ -255,6 +255,14 @@ static inline void vkd3d_cond_destroy(struct vkd3d_cond *cond)
 {
 }
 
+static inline unsigned int vkd3d_get_cpu_count(void)
+{
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+}
+
 static inline unsigned int vkd3d_atomic_increment(unsigned int volatile *x)
 {
     return InterlockedIncrement((LONG volatile *)x);
@@ -288,6 +296,7 @@ static inline void *vkd3d_atomic_exchange_pointer(void * volatile *x, void *val)
 #else  /* _WIN32 */
 
 #include <pthread.h>
+#include <unistd.h>
 
 union vkd3d_thread_handle
 {
@@ -387,6 +396,13 @@ static inline void vkd3d_cond_destroy(struct vkd3d_cond *cond)
         ERR("Could not destroy the condition variable, error %d.\n", ret);
 }
 
+static inline unsigned int vkd3d_get_cpu_count(void)
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return count > 0 ? count : 1;
+}
+
 # if HAVE_SYNC_SUB_AND_FETCH
 static inline unsigned int vkd3d_atomic_decrement(unsigned int volatile *x)
 {
@@ -488,6 +504,44 @@ struct vkd3d_fence_worker
     struct d3d12_device *device;
 };
 
+#define VKD3D_SHADER_COMPILE_MAX_THREAD_COUNT 8
+
+enum vkd3d_shader_compile_job_state
+{
+    VKD3D_SHADER_COMPILE_JOB_QUEUED,
+    VKD3D_SHADER_COMPILE_JOB_RUNNING,
+    VKD3D_SHADER_COMPILE_JOB_DONE,
+};
+
+/* The compile info chain must stay valid until the job has been waited for. */
+struct vkd3d_shader_compile_job
+{
+    struct list entry;
+    struct vkd3d_shader_compile_info compile_info;
+    struct vkd3d_shader_code spirv;
+    enum vkd3d_shader_compile_job_state state;
+    int ret;
+};
+
+struct vkd3d_shader_compile_pool
+{
+    union vkd3d_thread_handle threads[VKD3D_SHADER_COMPILE_MAX_THREAD_COUNT];
+    unsigned int thread_count;
+    bool threads_started;
+
+    struct vkd3d_mutex mutex;
+    struct vkd3d_cond cond;
+    struct vkd3d_cond done_cond;
+    struct list jobs;
+    bool should_exit;
+};
+
+HRESULT vkd3d_shader_compile_pool_init(struct vkd3d_shader_compile_pool *pool, struct d3d12_device *device);
+void vkd3d_shader_compile_pool_cleanup(struct vkd3d_shader_compile_pool *pool, struct d3d12_device *device);
+void vkd3d_shader_compile_pool_submit(struct vkd3d_shader_compile_pool *pool,
+        struct vkd3d_shader_compile_job *job, struct d3d12_device *device);
+int vkd3d_shader_compile_pool_wait(struct vkd3d_shader_compile_pool *pool, struct vkd3d_shader_compile_job *job);
+
 struct vkd3d_gpu_va_allocation
 {
     D3D12_GPU_VIRTUAL_ADDRESS base;
@@ -1207,6 +1261,8 @@ struct d3d12_root_signature
     unsigned int static_sampler_count;
     VkSampler *static_samplers;
 
+    uint64_t hash;
+
     struct d3d12_device *device;
 
     struct vkd3d_private_store private_store;
@@ -1275,6 +1331,16 @@ struct d3d12_pipeline_uav_counter_state
     unsigned int binding_count;
 };
 
+/* SPIR-V of a pipeline stage, kept for storing the pipeline in a library
+ * while the device has any. The key covers the DXBC, the root signature and
+ * the pipeline state the translation depends on. */
+struct d3d12_pipeline_shader
+{
+    VkShaderStageFlagBits stage;
+    uint64_t key;
+    struct vkd3d_shader_code spirv;
+};
+
 /* ID3D12PipelineState */
 struct d3d12_pipeline_state
 {
@@ -1288,9 +1354,13 @@ struct d3d12_pipeline_state
     } u;
     VkPipelineBindPoint vk_bind_point;
 
+    struct d3d12_pipeline_shader shaders[VKD3D_MAX_SHADER_STAGES];
+    unsigned int shader_count;
+
     struct d3d12_pipeline_uav_counter_state uav_counters;
 
     struct d3d12_device *device;
+    struct d3d12_pipeline_library *library;
 
     struct vkd3d_private_store private_store;
 };
@@ -1353,6 +1423,27 @@ VkPipeline d3d12_pipeline_state_get_or_create_pipeline(struct d3d12_pipeline_sta
         D3D12_PRIMITIVE_TOPOLOGY topology, const uint32_t *strides, VkFormat dsv_format, VkRenderPass *vk_render_pass);
 struct d3d12_pipeline_state *unsafe_impl_from_ID3D12PipelineState(ID3D12PipelineState *iface);
 
+/* ID3D12PipelineLibrary */
+struct d3d12_pipeline_library
+{
+    ID3D12PipelineLibrary1 ID3D12PipelineLibrary1_iface;
+    LONG refcount;
+
+    struct vkd3d_mutex mutex;
+    struct rb_tree entries;
+    unsigned int entry_count;
+    /* Pipelines loaded from the library are created from this cache. It is
+     * never written to directly, so that no lock is needed around its use. */
+    VkPipelineCache vk_pipeline_cache;
+
+    struct d3d12_device *device;
+
+    struct vkd3d_private_store private_store;
+};
+
+HRESULT d3d12_pipeline_library_create(struct d3d12_device *device, const void *blob,
+        size_t blob_size, struct d3d12_pipeline_library **library);
+
 struct vkd3d_buffer
 {
     VkBuffer vk_buffer;
@@ -1799,6 +1890,7 @@ struct d3d12_device
     const struct vkd3d_format_compatibility_list *format_compatibility_lists;
     struct vkd3d_null_resources null_resources;
     struct vkd3d_uav_clear_state uav_clear_state;
+    struct vkd3d_shader_compile_pool shader_compile_pool;
 
     VkDescriptorPoolSize vk_pool_sizes[VKD3D_DESCRIPTOR_POOL_COUNT];
     unsigned int vk_pool_count;
@@ -1929,6 +2021,19 @@ static inline unsigned int vkd3d_compute_workgroup_count(unsigned int thread_cou
     return (thread_count + workgroup_size - 1) / workgroup_size;
 }
 
+#define VKD3D_HASH_INIT 0xcbf29ce484222325ull
+
+/* 64-bit FNV-1a. */
+static inline uint64_t vkd3d_hash_data(uint64_t hash, const void *data, size_t size)
+{
+    const uint8_t *p = data;
+    size_t i;
+
+    for (i = 0; i < size; ++i)
+        hash = (hash ^ p[i]) * 0x100000001b3ull;
+    return hash;
+}
+
 VkCompareOp vk_compare_op_from_d3d12(D3D12_COMPARISON_FUNC op);
 VkSampleCountFlagBits vk_samples_from_dxgi_sample_desc(const DXGI_SAMPLE_DESC *desc);
 VkSampleCountFlagBits vk_samples_from_sample_count(unsigned int sample_count);
@@ -1653,7 +1653,7 @@ static void update_wineprefix( BOOL force )
     {
         SYSTEM_SUPPORTED_PROCESSOR_ARCHITECTURES_INFORMATION machines[8];
         HANDLE process = 0;
-        DWORD count = 0;
+        DWORD count = 0, start = GetTickCount();
 
         if (NtQuerySystemInformationEx( SystemSupportedProcessorArchitectures, &process, sizeof(process),
                                         machines, sizeof(machines), NULL )) machines[0].Machine = 0;
@@ -1686,6 +1686,7 @@ static void update_wineprefix( BOOL force )
         update_win_version();
         update_root_certs();
 
+        WINE_TRACE( "update took %lu ms\n", GetTickCount() - start );
         WINE_MESSAGE( "wine: configuration in %s has been updated.\n", debugstr_w(prettyprint_configdir()) );
     }
 
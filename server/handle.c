@@ -230,6 +230,7 @@ static int grow_handle_table( struct handle_table *table )
     }
     table->entries = new_entries;
     table->count   = count;
+    process_snapshot_changed();
     return 1;
 }
 
@@ -352,6 +353,7 @@ static void shrink_handle_table( struct handle_table *table )
     if (!(new_entries = realloc( table->entries, count * sizeof(*new_entries) ))) return;
     table->count   = count;
     table->entries = new_entries;
+    process_snapshot_changed();
 }
 
 static void inherit_handle( struct process *parent, const obj_handle_t handle, struct handle_table *table )
@@ -73,6 +73,8 @@ static int running_processes, user_processes;
 static struct event *shutdown_event;           /* signaled when shutdown starts */
 static struct timeout_user *shutdown_timeout;  /* timeout for server shutdown */
 static int shutdown_stage;  /* current stage in the shutdown process */
+static struct object *snapshot_mapping;           /* mapping of the shared process snapshot */
+static process_snapshot_shm_t *snapshot_shared;   /* shared process snapshot */
 
 static const WCHAR process_name[] = {'P','r','o','c','e','s','s'};
 
@@ -1027,6 +1029,7 @@ static void process_killed( struct process *process )
 void add_process_thread( struct process *process, struct thread *thread )
 {
     list_add_tail( &process->thread_list, &thread->proc_entry );
+    process_snapshot_changed();
     if (!process->running_threads++)
     {
         list_add_tail( &process_list, &process->entry );
@@ -1050,6 +1053,7 @@ void remove_process_thread( struct process *process, struct thread *thread )
     assert( !list_empty( &process->thread_list ));
 
     list_remove( &thread->proc_entry );
+    process_snapshot_changed();
 
     if (!--process->running_threads)
     {
@@ -1495,6 +1499,7 @@ DECL_HANDLER(init_process_done)
 
     process->start_time = current_time;
     current->entry_point = base + image_info->entry_point;
+    process_snapshot_changed();
 
     init_process_tracing( process );
     generate_startup_debug_events( process );
@@ -1701,7 +1706,11 @@ DECL_HANDLER(set_process_info)
 
     if ((process = get_process_from_handle( req->handle, PROCESS_SET_INFORMATION )))
     {
-        if (req->mask & SET_PROCESS_INFO_PRIORITY) process->priority = req->priority;
+        if (req->mask & SET_PROCESS_INFO_PRIORITY)
+        {
+            process->priority = req->priority;
+            process_snapshot_changed();
+        }
         if (req->mask & SET_PROCESS_INFO_AFFINITY) set_process_affinity( process, req->affinity );
         release_object( process );
     }
@@ -1961,39 +1970,37 @@ DECL_HANDLER(resume_process)
     }
 }
 
-/* Get a list of processes and threads currently running */
-DECL_HANDLER(list_processes)
+/* compute the size of the process and thread list */
+static data_size_t get_process_list_size( int *process_count, int *total_thread_count, data_size_t *total_name_len )
 {
     struct process *process;
-    struct thread *thread;
-    unsigned int pos = 0;
-    char *buffer;
+    data_size_t size = 0;
 
-    reply->process_count = 0;
-    reply->total_thread_count = 0;
-    reply->total_name_len = 0;
-    reply->info_size = 0;
+    *process_count = 0;
+    *total_thread_count = 0;
+    *total_name_len = 0;
 
     LIST_FOR_EACH_ENTRY( process, &process_list, struct process, entry )
     {
-        reply->info_size = (reply->info_size + 7) & ~7;
-        reply->info_size += sizeof(struct process_info) + process->imagelen;
-        reply->info_size = (reply->info_size + 7) & ~7;
-        reply->info_size += process->running_threads * sizeof(struct thread_info);
-        reply->process_count++;
-        reply->total_thread_count += process->running_threads;
-        reply->total_name_len += process->imagelen;
-    }
-
-    if (reply->info_size > get_reply_max_size())
-    {
-        set_error( STATUS_INFO_LENGTH_MISMATCH );
-        return;
+        size = (size + 7) & ~7;
+        size += sizeof(struct process_info) + process->imagelen;
+        size = (size + 7) & ~7;
+        size += process->running_threads * sizeof(struct thread_info);
+        (*process_count)++;
+        *total_thread_count += process->running_threads;
+        *total_name_len += process->imagelen;
     }
+    return size;
+}
 
-    if (!(buffer = set_reply_data_size( reply->info_size ))) return;
+/* fill the process and thread list, the buffer size must come from get_process_list_size */
+static void fill_process_list( char *buffer, data_size_t size )
+{
+    struct process *process;
+    struct thread *thread;
+    unsigned int pos = 0;
 
-    memset( buffer, 0, reply->info_size );
+    memset( buffer, 0, size );
     LIST_FOR_EACH_ENTRY( process, &process_list, struct process, entry )
     {
         struct process_info *process_info;
@@ -2028,3 +2035,71 @@ DECL_HANDLER(list_processes)
         }
     }
 }
+
+/* mark the shared process snapshot as out of date */
+void process_snapshot_changed(void)
+{
+    if (snapshot_shared) snapshot_shared->generation++;
+}
+
+/* Get a list of processes and threads currently running */
+DECL_HANDLER(list_processes)
+{
+    char *buffer;
+
+    reply->info_size = get_process_list_size( &reply->process_count, &reply->total_thread_count,
+                                              &reply->total_name_len );
+
+    if (reply->info_size > get_reply_max_size())
+    {
+        set_error( STATUS_INFO_LENGTH_MISMATCH );
+        return;
+    }
+
+    if (!(buffer = set_reply_data_size( reply->info_size ))) return;
+    fill_process_list( buffer, reply->info_size );
+}
+
+/* Rebuild the shared process snapshot if it is out of date */
+DECL_HANDLER(update_process_snapshot)
+{
+    static const WCHAR nameW[] = {'_','_','w','i','n','e','_','p','r','o','c','e','s','s','_','s','n','a','p','s','h','o','t'};
+    static const struct unicode_str name = {nameW, sizeof(nameW)};
+    int process_count, total_thread_count;
+    data_size_t size, total_name_len;
+    struct object *dir;
+    unsigned int seq;
+    void *ptr;
+
+    if (!snapshot_mapping)
+    {
+        if (!(dir = create_thread_map_directory())) return;
+        snapshot_mapping = create_shared_mapping( dir, &name, sizeof(*snapshot_shared), OBJ_OPENIF, NULL, &ptr );
+        release_object( dir );
+        if (!snapshot_mapping) return;
+        snapshot_shared = ptr;
+        snapshot_shared->generation = 1;
+    }
+
+    if (snapshot_shared->built != snapshot_shared->generation)
+    {
+        size = get_process_list_size( &process_count, &total_thread_count, &total_name_len );
+        if (size > sizeof(snapshot_shared->data))
+        {
+            set_error( STATUS_INFO_LENGTH_MISMATCH );
+            return;
+        }
+
+        seq = __SHARED_INCREMENT_SEQ( snapshot_shared->seq );
+        assert( (seq & 1) != 0 );
+        fill_process_list( (char *)snapshot_shared->data, size );
+        snapshot_shared->process_count = process_count;
+        snapshot_shared->total_thread_count = total_thread_count;
+        snapshot_shared->total_name_len = total_name_len;
+        snapshot_shared->info_size = size;
+        snapshot_shared->built = snapshot_shared->generation;
+        seq = __SHARED_INCREMENT_SEQ( snapshot_shared->seq ) - seq;
+        assert( seq == 1 );
+    }
+    reply->generation = snapshot_shared->built;
+}
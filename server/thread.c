@@ -844,6 +844,7 @@ int set_thread_priority( struct thread *thread, int priority_class, int priority
         thread->priority == priority)
         return 0;
     thread->priority = priority;
+    process_snapshot_changed();
 
     apply_thread_priority( thread, priority_class, priority );
     return 0;
@@ -870,7 +871,10 @@ static void set_thread_info( struct thread *thread,
     if (req->mask & SET_THREAD_INFO_TOKEN)
         security_set_thread_token( thread, req->token );
     if (req->mask & SET_THREAD_INFO_ENTRYPOINT)
+    {
         thread->entry_point = req->entry_point;
+        process_snapshot_changed();
+    }
     if (req->mask & SET_THREAD_INFO_DBG_HIDDEN)
         thread->dbg_hidden = 1;
     if (req->mask & SET_THREAD_INFO_DESCRIPTION)
@@ -1671,6 +1675,7 @@ DECL_HANDLER(init_first_thread)
 
     current->unix_pid = process->unix_pid = req->unix_pid;
     current->unix_tid = req->unix_tid;
+    process_snapshot_changed();
 
     if (!process->parent_id)
         process->affinity = current->affinity = get_thread_affinity( current );
@@ -1706,6 +1711,7 @@ DECL_HANDLER(init_thread)
     current->unix_tid = req->unix_tid;
     current->teb      = req->teb;
     current->entry_point = req->entry;
+    process_snapshot_changed();
 
     init_thread_context( current );
     generate_debug_event( current, DbgCreateThreadStateChange, &req->entry );
@@ -30,6 +30,7 @@
 #include "ntuser.h"
 
 #include "object.h"
+#include "file.h"
 #include "request.h"
 #include "thread.h"
 #include "process.h"
@@ -94,6 +95,7 @@ struct window
     struct property *properties;      /* window properties array */
     int              nb_extra_bytes;  /* number of extra bytes */
     char            *extra_bytes;     /* extra bytes storage */
+    const window_shm_t *shared;       /* entry in the shared window table */
 };
 
 static void window_dump( struct object *obj, int verbose );
@@ -189,6 +191,55 @@ static void window_destroy( struct object *obj )
     }
 }
 
+static struct object *windows_mapping;      /* shared window table mapping */
+static window_shm_t *windows_shared;       /* shared window table */
+
+/* get the shared window table entry for a user handle, creating the table if needed */
+static const window_shm_t *get_window_shared( user_handle_t handle )
+{
+    static const WCHAR nameW[] = {'_','_','w','i','n','e','_','w','i','n','d','o','w','s'};
+    static const struct unicode_str name = {nameW, sizeof(nameW)};
+    unsigned int index = ((handle & 0xffff) - FIRST_USER_HANDLE) >> 1;
+    struct object *dir;
+    void *ptr;
+
+    if (index >= WINDOW_SHARED_ENTRIES) return NULL;
+    if (!windows_mapping)
+    {
+        if (!(dir = create_thread_map_directory())) return NULL;
+        windows_mapping = create_shared_mapping( dir, &name, WINDOW_SHARED_ENTRIES * sizeof(*windows_shared),
+                                                 OBJ_OPENIF, NULL, &ptr );
+        release_object( dir );
+        if (!windows_mapping) return NULL;
+        windows_shared = ptr;
+    }
+    return &windows_shared[index];
+}
+
+/* publish the current window state to the shared window table */
+static void update_window_shared( struct window *win )
+{
+    if (!win->shared) return;
+
+    SHARED_WRITE_BEGIN( win, window_shm_t )
+    {
+        shared->handle        = win->handle;
+        shared->parent        = win->parent ? win->parent->handle : 0;
+        shared->owner         = win->owner;
+        shared->tid           = win->thread ? get_thread_id( win->thread ) : 0;
+        shared->pid           = win->thread ? get_process_id( win->thread->process ) : 0;
+        shared->style         = win->style;
+        shared->ex_style      = win->ex_style;
+        shared->is_unicode    = win->is_unicode;
+        shared->dpi           = win->dpi;
+        shared->dpi_awareness = win->dpi_awareness;
+        shared->id            = win->id;
+        shared->instance      = win->instance;
+        shared->user_data     = win->user_data;
+    }
+    SHARED_WRITE_END;
+}
+
 /* retrieve a pointer to a window from its handle */
 static inline struct window *get_window( user_handle_t handle )
 {
@@ -311,6 +362,7 @@ static int link_window( struct window *win, struct window *previous )
     }
 
     win->is_linked = 1;
+    update_window_shared( win );
     return old_prev != win->entry.prev;
 }
 
@@ -356,6 +408,7 @@ static int set_parent_window( struct window *win, struct window *parent )
         win->is_linked = 0;
         win->is_orphan = 1;
     }
+    update_window_shared( win );
     return 1;
 }
 
@@ -494,6 +547,7 @@ static void detach_window_thread( struct window *win )
     /* destroyed when the desktop ref count reaches zero */
     release_object( win->desktop );
     win->thread = NULL;
+    update_window_shared( win );
 }
 
 /* get the process owning the top window of a given desktop */
@@ -586,6 +640,7 @@ static struct window *create_window( struct window *parent, struct window *owner
     win->properties     = NULL;
     win->nb_extra_bytes = 0;
     win->extra_bytes    = NULL;
+    win->shared         = NULL;
     win->window_rect = win->visible_rect = win->surface_rect = win->client_rect = empty_rect;
     list_init( &win->children );
     list_init( &win->unlinked );
@@ -1728,6 +1783,84 @@ static unsigned int get_window_update_flags( struct window *win, struct window *
 }
 
 
+/* parent exposures deferred while processing a batch of window position changes */
+struct expose_batch
+{
+    unsigned int count;
+    unsigned int size;
+    struct
+    {
+        struct window *parent;
+        struct region *region;  /* exposed region in parent client coordinates */
+    } *exposes;
+};
+
+static struct expose_batch *expose_batch;
+
+static void begin_expose_batch( struct expose_batch *batch )
+{
+    batch->count = batch->size = 0;
+    batch->exposes = NULL;
+    expose_batch = batch;
+}
+
+static void end_expose_batch( struct expose_batch *batch )
+{
+    unsigned int i;
+
+    expose_batch = NULL;
+    for (i = 0; i < batch->count; i++)
+    {
+        redraw_window( batch->exposes[i].parent, batch->exposes[i].region, 0,
+                       RDW_INVALIDATE | RDW_ERASE | RDW_ALLCHILDREN );
+        free_region( batch->exposes[i].region );
+        release_object( batch->exposes[i].parent );
+    }
+    free( batch->exposes );
+}
+
+/* invalidate an area of the parent revealed by moving a child, merging it with */
+/* the other exposures of the same parent if a batch is being processed */
+static void expose_parent( struct window *parent, struct region *region )
+{
+    struct expose_batch *batch = expose_batch;
+    struct region *copy;
+    unsigned int i;
+
+    if (batch)
+    {
+        for (i = 0; i < batch->count; i++)
+        {
+            if (batch->exposes[i].parent != parent) continue;
+            if (union_region( batch->exposes[i].region, batch->exposes[i].region, region )) return;
+            break;
+        }
+        if (i == batch->count && (copy = create_empty_region()))
+        {
+            if (batch->count == batch->size)
+            {
+                unsigned int new_size = max( 16, batch->size * 2 );
+                void *new_exposes = realloc( batch->exposes, new_size * sizeof(*batch->exposes) );
+                if (new_exposes)
+                {
+                    batch->exposes = new_exposes;
+                    batch->size = new_size;
+                }
+            }
+            if (batch->count < batch->size && copy_region( copy, region ))
+            {
+                batch->exposes[batch->count].parent = (struct window *)grab_object( parent );
+                batch->exposes[batch->count].region = copy;
+                batch->count++;
+                return;
+            }
+            free_region( copy );
+        }
+        clear_error();
+    }
+    redraw_window( parent, region, 0, RDW_INVALIDATE | RDW_ERASE | RDW_ALLCHILDREN );
+}
+
 /* expose the areas revealed by a vis region change on the window parent */
 /* returns the region exposed on the window itself (in client coordinates) */
 static struct region *expose_window( struct window *win, const rectangle_t *old_window_rect,
@@ -1777,7 +1910,7 @@ static struct region *expose_window( struct window *win, const rectangle_t *old_
             {
                 /* make it relative to parent */
                 offset_region( new_vis_rgn, old_window_rect->left, old_window_rect->top );
-                redraw_window( win->parent, new_vis_rgn, 0, RDW_INVALIDATE | RDW_ERASE | RDW_ALLCHILDREN );
+                expose_parent( win->parent, new_vis_rgn );
             }
         }
     }
@@ -1786,40 +1919,64 @@ static struct region *expose_window( struct window *win, const rectangle_t *old_
 }
 
 
-/* set the window and client rectangles, updating the update region if necessary */
-static void set_window_pos( struct window *win, struct window *previous,
-                            unsigned int swp_flags, const rectangle_t *window_rect,
-                            const rectangle_t *client_rect, const rectangle_t *visible_rect,
-                            const rectangle_t *surface_rect, const rectangle_t *valid_rect )
-{
-    struct region *old_vis_rgn = NULL, *exposed_rgn = NULL;
-    const rectangle_t old_window_rect = win->window_rect;
-    const rectangle_t old_visible_rect = win->visible_rect;
-    const rectangle_t old_client_rect = win->client_rect;
-    rectangle_t rect;
-    int client_changed, frame_changed;
-    int visible = (win->style & WS_VISIBLE) || (swp_flags & SWP_SHOWWINDOW);
-    int zorder_changed = 0;
+/* position change of a window, split so that a batch of windows can be moved at once */
+struct window_pos_change
+{
+    struct window  *win;
+    struct window  *previous;
+    unsigned int    swp_flags;
+    rectangle_t     window_rect;
+    rectangle_t     client_rect;
+    rectangle_t     visible_rect;
+    rectangle_t     surface_rect;
+    rectangle_t     valid_rect;
+    rectangle_t     old_window_rect;
+    rectangle_t     old_visible_rect;
+    rectangle_t     old_client_rect;
+    struct region  *old_vis_rgn;
+    int             visible;
+    int             zorder_changed;
+};
+
+/* save the state of the window before its position changes */
+static int begin_window_pos_change( struct window_pos_change *change )
+{
+    struct window *win = change->win;
 
-    if (win->parent && !is_visible( win->parent )) visible = 0;
+    change->old_window_rect  = win->window_rect;
+    change->old_visible_rect = win->visible_rect;
+    change->old_client_rect  = win->client_rect;
+    change->old_vis_rgn      = NULL;
+    change->zorder_changed   = 0;
+    change->visible = (win->style & WS_VISIBLE) || (change->swp_flags & SWP_SHOWWINDOW);
 
-    if (visible && !(old_vis_rgn = get_visible_region( win, DCX_WINDOW ))) return;
+    if (win->parent && !is_visible( win->parent )) change->visible = 0;
+
+    if (change->visible && !(change->old_vis_rgn = get_visible_region( win, DCX_WINDOW ))) return 0;
+    return 1;
+}
 
-    /* set the new window info before invalidating anything */
+/* set the new window info before invalidating anything */
+static void apply_window_pos_change( struct window_pos_change *change )
+{
+    struct window *win = change->win;
+    unsigned int swp_flags = change->swp_flags;
 
-    win->window_rect  = *window_rect;
-    win->visible_rect = *visible_rect;
-    win->surface_rect = *surface_rect;
-    win->client_rect  = *client_rect;
-    if (!(swp_flags & SWP_NOZORDER) && win->parent) zorder_changed |= link_window( win, previous );
+    win->window_rect  = change->window_rect;
+    win->visible_rect = change->visible_rect;
+    win->surface_rect = change->surface_rect;
+    win->client_rect  = change->client_rect;
+    if (!(swp_flags & SWP_NOZORDER) && win->parent)
+        change->zorder_changed |= link_window( win, change->previous );
     if (swp_flags & SWP_SHOWWINDOW) win->style |= WS_VISIBLE;
     else if (swp_flags & SWP_HIDEWINDOW) win->style &= ~WS_VISIBLE;
+    if (swp_flags & (SWP_SHOWWINDOW | SWP_HIDEWINDOW)) update_window_shared( win );
 
     /* keep children at the same position relative to top right corner when the parent is mirrored */
     if (win->ex_style & WS_EX_LAYOUTRTL)
     {
         struct window *child;
-        int old_size = old_client_rect.right - old_client_rect.left;
+        int old_size = change->old_client_rect.right - change->old_client_rect.left;
         int new_size = win->client_rect.right - win->client_rect.left;
 
         if (old_size != new_size) LIST_FOR_EACH_ENTRY( child, &win->children, struct window, entry )
@@ -1833,14 +1990,33 @@ static void set_window_pos( struct window *win, struct window *previous,
 
     /* reset cursor clip rectangle when the desktop changes size */
     if (win == win->desktop->top_window) set_clip_rectangle( win->desktop, NULL, SET_CURSOR_NOCLIP, 1 );
+}
+
+/* update the window regions once the new position has been set */
+static void end_window_pos_change( struct window_pos_change *change )
+{
+    struct window *win = change->win;
+    struct region *old_vis_rgn = change->old_vis_rgn, *exposed_rgn = NULL;
+    const rectangle_t *window_rect = &change->window_rect;
+    const rectangle_t *client_rect = &change->client_rect;
+    const rectangle_t *visible_rect = &change->visible_rect;
+    const rectangle_t *valid_rect = &change->valid_rect;
+    const rectangle_t old_window_rect = change->old_window_rect;
+    const rectangle_t old_visible_rect = change->old_visible_rect;
+    const rectangle_t old_client_rect = change->old_client_rect;
+    unsigned int swp_flags = change->swp_flags;
+    rectangle_t rect;
+    int client_changed, frame_changed;
+
+    change->old_vis_rgn = NULL;
 
     /* if the window is not visible, everything is easy */
-    if (!visible) return;
+    if (!change->visible) return;
 
     /* expose anything revealed by the change */
 
     if (!(swp_flags & SWP_NOREDRAW))
-        exposed_rgn = expose_window( win, &old_window_rect, old_vis_rgn, zorder_changed );
+        exposed_rgn = expose_window( win, &old_window_rect, old_vis_rgn, change->zorder_changed );
 
     if (!(win->style & WS_VISIBLE))
     {
@@ -1957,6 +2133,16 @@ done:
 }
 
 
+
+/* set the window and client rectangles, updating the update region if necessary */
+static void set_window_pos( struct window_pos_change *change )
+{
+    if (!begin_window_pos_change( change )) return;
+    apply_window_pos_change( change );
+    end_window_pos_change( change );
+}
+
+
 /* set the window region, updating the update region if necessary */
 static void set_window_region( struct window *win, struct region *region, int redraw )
 {
@@ -2048,6 +2234,8 @@ void free_window_handle( struct window *win )
     if (win->parent) set_parent_window( win, NULL );
     free_user_handle( win->handle );
     win->handle = 0;
+    update_window_shared( win );
+    win->shared = NULL;
     release_object( win );
 }
 
@@ -2101,6 +2289,8 @@ DECL_HANDLER(create_window)
     }
     win->style = req->style;
     win->ex_style = req->ex_style;
+    if (!(win->shared = get_window_shared( win->handle ))) clear_error();
+    update_window_shared( win );
 
     reply->handle    = win->handle;
     reply->parent    = win->parent ? win->parent->handle : 0;
@@ -2211,6 +2401,7 @@ DECL_HANDLER(set_window_owner)
 
     reply->prev_owner = win->owner;
     reply->full_owner = win->owner = owner ? owner->handle : 0;
+    update_window_shared( win );
 }
 
 
@@ -2282,6 +2473,7 @@ DECL_HANDLER(set_window_info)
     if (req->flags & SET_WIN_USERDATA) win->user_data = req->user_data;
     if (req->flags & SET_WIN_EXTRA) memcpy( win->extra_bytes + req->extra_offset,
                                             &req->extra_value, req->extra_size );
+    if (req->flags & ~SET_WIN_EXTRA) update_window_shared( win );
 
     /* changing window style triggers a non-client paint */
     if (req->flags & SET_WIN_STYLE) win->paint_flags |= PAINT_NONCLIENT;
@@ -2413,21 +2605,19 @@ DECL_HANDLER(get_window_tree)
 }
 
 
-/* set the position and Z order of a window */
-DECL_HANDLER(set_window_pos)
+/* validate a set_window_pos entry and fill the position change from it */
+static int init_window_pos_change( struct window_pos_change *change, const struct set_window_pos_entry *entry )
 {
-    rectangle_t window_rect, client_rect, visible_rect, surface_rect, valid_rect;
-    const rectangle_t *extra_rects = get_req_data();
     struct window *previous = NULL;
-    struct window *top, *win = get_window( req->handle );
-    unsigned int flags = req->swp_flags;
+    struct window *win = get_window( entry->handle );
+    unsigned int flags = entry->swp_flags;
 
-    if (!win) return;
+    if (!win) return 0;
     if (!win->parent) flags |= SWP_NOZORDER;  /* no Z order for the desktop */
 
     if (!(flags & SWP_NOZORDER))
     {
-        switch ((int)req->previous)
+        switch ((int)entry->previous)
         {
         case 0:   /* HWND_TOP */
             previous = WINPTR_TOP;
@@ -2442,12 +2632,12 @@ DECL_HANDLER(set_window_pos)
             previous = WINPTR_NOTOPMOST;
             break;
         default:
-            if (!(previous = get_window( req->previous ))) return;
+            if (!(previous = get_window( entry->previous ))) return 0;
             /* previous must be a sibling */
             if (previous->parent != win->parent)
             {
                 set_error( STATUS_INVALID_PARAMETER );
-                return;
+                return 0;
             }
             break;
         }
@@ -2458,44 +2648,129 @@ DECL_HANDLER(set_window_pos)
     if ((win->ex_style & WS_EX_LAYERED) && !win->is_layered) flags |= SWP_NOREDRAW;
 
     /* window rectangle must be ordered properly */
-    if (req->window.right < req->window.left || req->window.bottom < req->window.top)
+    if (entry->window.right < entry->window.left || entry->window.bottom < entry->window.top)
     {
         set_error( STATUS_INVALID_PARAMETER );
-        return;
+        return 0;
     }
 
-    window_rect = req->window;
-    client_rect = req->client;
-    if (get_req_data_size() >= sizeof(rectangle_t)) visible_rect = extra_rects[0];
-    else visible_rect = window_rect;
-    if (get_req_data_size() >= 2 * sizeof(rectangle_t)) surface_rect = extra_rects[1];
-    else surface_rect = visible_rect;
-    if (get_req_data_size() >= 3 * sizeof(rectangle_t)) valid_rect = extra_rects[2];
-    else valid_rect = empty_rect;
+    change->win = win;
+    change->previous = previous;
+    change->swp_flags = flags;
+    change->window_rect = entry->window;
+    change->client_rect = entry->client;
+    change->visible_rect = entry->visible;
+    change->surface_rect = entry->surface;
+    change->valid_rect = entry->valid;
     if (win->parent && win->parent->ex_style & WS_EX_LAYOUTRTL)
     {
-        mirror_rect( &win->parent->client_rect, &window_rect );
-        mirror_rect( &win->parent->client_rect, &visible_rect );
-        mirror_rect( &win->parent->client_rect, &client_rect );
-        mirror_rect( &win->parent->client_rect, &surface_rect );
-        mirror_rect( &win->parent->client_rect, &valid_rect );
+        mirror_rect( &win->parent->client_rect, &change->window_rect );
+        mirror_rect( &win->parent->client_rect, &change->visible_rect );
+        mirror_rect( &win->parent->client_rect, &change->client_rect );
+        mirror_rect( &win->parent->client_rect, &change->surface_rect );
+        mirror_rect( &win->parent->client_rect, &change->valid_rect );
     }
 
-    win->paint_flags = (win->paint_flags & ~PAINT_CLIENT_FLAGS) | (req->paint_flags & PAINT_CLIENT_FLAGS);
+    win->paint_flags = (win->paint_flags & ~PAINT_CLIENT_FLAGS) | (entry->paint_flags & PAINT_CLIENT_FLAGS);
     if (win->paint_flags & PAINT_HAS_PIXEL_FORMAT) update_pixel_format_flags( win );
+    return 1;
+}
 
-    set_window_pos( win, previous, flags, &window_rect, &client_rect,
-                    &visible_rect, &surface_rect, &valid_rect );
 
-    reply->new_style = win->style;
-    reply->new_ex_style = win->ex_style;
+/* fill the result of a window position change */
+static void get_window_pos_result( struct window *win, struct set_window_pos_result *result )
+{
+    struct window *top;
+
+    result->new_style = win->style;
+    result->new_ex_style = win->ex_style;
 
     top = get_top_clipping_window( win );
     if (is_visible( top ) && (top->paint_flags & PAINT_HAS_SURFACE))
     {
-        reply->surface_win = top->handle;
-        reply->needs_update = !!(top->paint_flags & (PAINT_HAS_PIXEL_FORMAT | PAINT_PIXEL_FORMAT_CHILD));
+        result->surface_win = top->handle;
+        result->needs_update = !!(top->paint_flags & (PAINT_HAS_PIXEL_FORMAT | PAINT_PIXEL_FORMAT_CHILD));
+    }
+}
+
+
+/* set the position and Z order of a window */
+DECL_HANDLER(set_window_pos)
+{
+    const rectangle_t *extra_rects = get_req_data();
+    struct set_window_pos_entry entry;
+    struct set_window_pos_result result;
+    struct window_pos_change change;
+
+    memset( &result, 0, sizeof(result) );
+    entry.handle      = req->handle;
+    entry.previous    = req->previous;
+    entry.swp_flags   = req->swp_flags;
+    entry.paint_flags = req->paint_flags;
+    entry.window      = req->window;
+    entry.client      = req->client;
+    if (get_req_data_size() >= sizeof(rectangle_t)) entry.visible = extra_rects[0];
+    else entry.visible = entry.window;
+    if (get_req_data_size() >= 2 * sizeof(rectangle_t)) entry.surface = extra_rects[1];
+    else entry.surface = entry.visible;
+    if (get_req_data_size() >= 3 * sizeof(rectangle_t)) entry.valid = extra_rects[2];
+    else entry.valid = empty_rect;
+
+    if (!init_window_pos_change( &change, &entry )) return;
+    set_window_pos( &change );
+    get_window_pos_result( change.win, &result );
+
+    reply->new_style    = result.new_style;
+    reply->new_ex_style = result.new_ex_style;
+    reply->surface_win  = result.surface_win;
+    reply->needs_update = result.needs_update;
+}
+
+
+/* set the position and Z order of several windows at once */
+DECL_HANDLER(set_window_pos_batch)
+{
+    const struct set_window_pos_entry *entries = get_req_data();
+    data_size_t i, count = get_req_data_size() / sizeof(*entries);
+    struct set_window_pos_result *results;
+    struct window_pos_change *changes;
+    struct expose_batch batch;
+
+    if (get_reply_max_size() < count * sizeof(*results))
+    {
+        set_error( STATUS_BUFFER_TOO_SMALL );
+        return;
+    }
+    if (!(results = set_reply_data_size( count * sizeof(*results) ))) return;
+    memset( results, 0, count * sizeof(*results) );
+    if (!count) return;
+    if (!(changes = mem_alloc( count * sizeof(*changes) ))) return;
+
+    /* save the visible regions of all the windows before anything moves, so that they */
+    /* are computed once per batch instead of against the partially moved windows */
+    for (i = 0; i < count; i++)
+    {
+        changes[i].win = NULL;
+        if (init_window_pos_change( &changes[i], &entries[i] ) && !begin_window_pos_change( &changes[i] ))
+            changes[i].win = NULL;
+        results[i].status = get_error();
+        clear_error();
+    }
+
+    for (i = 0; i < count; i++)
+        if (changes[i].win) apply_window_pos_change( &changes[i] );
+
+    /* the areas exposed on the parents are invalidated once all the windows have moved */
+    begin_expose_batch( &batch );
+    for (i = 0; i < count; i++)
+    {
+        if (!changes[i].win) continue;
+        end_window_pos_change( &changes[i] );
+        get_window_pos_result( changes[i].win, &results[i] );
+        clear_error();
     }
+    end_expose_batch( &batch );
+    free( changes );
 }
 
 
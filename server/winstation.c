@@ -136,26 +136,6 @@ static const struct object_ops desktop_ops =
     desktop_destroy               /* destroy */
 };
 
-#if defined(__i386__) || defined(__x86_64__)
-#define __SHARED_INCREMENT_SEQ( x ) ++(x)
-#else
-#define __SHARED_INCREMENT_SEQ( x ) __atomic_add_fetch( &(x), 1, __ATOMIC_RELEASE )
-#endif
-
-#define SHARED_WRITE_BEGIN( object, type )                           \
-    do {                                                             \
-        const type *__shared = (object)->shared;                     \
-        type *shared = (type *)__shared;                             \
-        unsigned int __seq = __SHARED_INCREMENT_SEQ( shared->seq );  \
-        assert( (__seq & 1) != 0 );                                  \
-        do
-
-#define SHARED_WRITE_END                                             \
-        while(0);                                                    \
-        __seq = __SHARED_INCREMENT_SEQ( shared->seq ) - __seq;       \
-        assert( __seq == 1 );                                        \
-    } while(0);
-
 
 /* create a winstation object */
 static struct winstation *create_winstation( struct object *root, const struct unicode_str *name,